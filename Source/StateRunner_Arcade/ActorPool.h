@@ -0,0 +1,532 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/Class.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+#include "Misc/ConfigCacheIni.h"
+#include "StateRunner_Arcade.h"
+
+/**
+ * Actor Pool
+ *
+ * Shared pooling containers used by UObstacleSpawnerComponent and UPickupSpawnerComponent.
+ * Both are plain C++ templates (not UObjects), so the owning component must report their
+ * references to GC from its own AddReferencedObjects().
+ *
+ * REQUIREMENTS ON ActorType:
+ * - int32 GetPoolSlotIndex() const / void SetPoolSlotIndex(int32)
+ * - int32 GetActiveListIndex() const / void SetActiveListIndex(int32)
+ *
+ * The actor stores its own slot/list index so acquire, release and active-list
+ * removal are all O(1) -- no scanning for an inactive actor.
+ *
+ * TPrewarmQueue grows a spawner's pools toward target sizes a slice per frame.
+ * FPoolHistory stores per-type pool peaks between sessions for adaptive sizing.
+ */
+
+/**
+ * Per-type pool: owns every pooled actor of one type and a free stack of
+ * inactive slots. Tracks how many are in use and the peak (high-water mark).
+ *
+ * Actors can be added to a bucket (e.g. the mesh variant they were built with); each
+ * bucket has its own free stack, so a caller can ask for a specific kind of actor and
+ * get one that needs no reconfiguring. Pools that don't care use bucket 0 throughout.
+ */
+template<typename ActorType>
+class TActorPool
+{
+public:
+
+	/**
+	 * Add a freshly spawned, already-deactivated actor to the pool.
+	 *
+	 * @param Actor Actor to take ownership of
+	 * @param Bucket Free stack the actor returns to (negative = 0)
+	 */
+	void Add(ActorType* Actor, int32 Bucket = 0)
+	{
+		if (!Actor)
+		{
+			return;
+		}
+
+		Bucket = FMath::Max(Bucket, 0);
+		if (Bucket >= FreeSlots.Num())
+		{
+			FreeSlots.SetNum(Bucket + 1);
+		}
+
+		const int32 Slot = Items.Add(Actor);
+		SlotFree.Add(true);
+		SlotBucket.Add(Bucket);
+		FreeSlots[Bucket].Push(Slot);
+		NumFree++;
+		Actor->SetPoolSlotIndex(Slot);
+	}
+
+	/**
+	 * Pop an inactive actor off a free stack.
+	 *
+	 * @param Bucket Preferred bucket; if it's empty (or INDEX_NONE) the other buckets are tried
+	 * @return Inactive actor, or nullptr if the pool is exhausted
+	 */
+	ActorType* Acquire(int32 Bucket = INDEX_NONE)
+	{
+		const int32 NumBuckets = FreeSlots.Num();
+		if (NumBuckets == 0)
+		{
+			return nullptr;
+		}
+
+		// Preferred bucket first, then the rest in order after it
+		const int32 FirstBucket = FreeSlots.IsValidIndex(Bucket) ? Bucket : 0;
+		for (int32 Offset = 0; Offset < NumBuckets; Offset++)
+		{
+			if (ActorType* Actor = PopFree((FirstBucket + Offset) % NumBuckets))
+			{
+				return Actor;
+			}
+		}
+
+		return nullptr;
+	}
+
+	/** Actors ready to hand out from one bucket */
+	int32 GetNumFreeInBucket(int32 Bucket) const
+	{
+		return FreeSlots.IsValidIndex(Bucket) ? FreeSlots[Bucket].Num() : 0;
+	}
+
+	/**
+	 * Return an actor to the free stack. Safe to call more than once,
+	 * or with an actor this pool doesn't own.
+	 *
+	 * @param Actor Actor being deactivated
+	 */
+	void Release(ActorType* Actor)
+	{
+		if (!Actor)
+		{
+			return;
+		}
+
+		const int32 Slot = Actor->GetPoolSlotIndex();
+		if (!Items.IsValidIndex(Slot) || Items[Slot] != Actor || SlotFree[Slot])
+		{
+			return;
+		}
+
+		SlotFree[Slot] = true;
+		FreeSlots[SlotBucket[Slot]].Push(Slot);
+		NumFree++;
+		NumInUse--;
+	}
+
+	/** True if Actor lives in this pool */
+	bool Owns(const ActorType* Actor) const
+	{
+		if (!Actor)
+		{
+			return false;
+		}
+		const int32 Slot = Actor->GetPoolSlotIndex();
+		return Items.IsValidIndex(Slot) && Items[Slot] == Actor;
+	}
+
+	/** Reserve storage ahead of a batch of Add() calls */
+	void Reserve(int32 Count)
+	{
+		Items.Reserve(Count);
+		SlotFree.Reserve(Count);
+		SlotBucket.Reserve(Count);
+	}
+
+	/** Total pooled actors (active + inactive) */
+	int32 Num() const { return Items.Num(); }
+
+	/** Actors currently handed out */
+	int32 GetNumInUse() const { return NumInUse; }
+
+	/** Actors ready to hand out */
+	int32 GetNumFree() const { return NumFree; }
+
+	/** Peak NumInUse since the pool was created (or ResetHighWaterMark) */
+	int32 GetHighWaterMark() const { return HighWaterMark; }
+
+	void ResetHighWaterMark() { HighWaterMark = NumInUse; }
+
+	/** All pooled actors, in slot order */
+	const TArray<TObjectPtr<ActorType>>& GetItems() const { return Items; }
+
+	/** Heap used by the pool's own arrays (not the actors) */
+	SIZE_T GetAllocatedSize() const
+	{
+		SIZE_T Size = Items.GetAllocatedSize() + SlotFree.GetAllocatedSize() + SlotBucket.GetAllocatedSize() + FreeSlots.GetAllocatedSize();
+		for (const TArray<int32>& Stack : FreeSlots)
+		{
+			Size += Stack.GetAllocatedSize();
+		}
+		return Size;
+	}
+
+	/** Report pooled actors to GC */
+	void AddReferencedObjects(FReferenceCollector& Collector)
+	{
+		Collector.AddReferencedObjects(Items);
+	}
+
+private:
+
+	/** Pop one valid actor off a bucket's free stack */
+	ActorType* PopFree(int32 Bucket)
+	{
+		TArray<int32>& Stack = FreeSlots[Bucket];
+		while (Stack.Num() > 0)
+		{
+			const int32 Slot = Stack.Pop(EAllowShrinking::No);
+			NumFree--;
+			ActorType* Actor = Items[Slot];
+
+			// Destroyed out from under us (level teardown etc.) -- drop the slot
+			if (!IsValid(Actor))
+			{
+				continue;
+			}
+
+			SlotFree[Slot] = false;
+			NumInUse++;
+			HighWaterMark = FMath::Max(HighWaterMark, NumInUse);
+			return Actor;
+		}
+
+		return nullptr;
+	}
+
+	/** Every pooled actor, indexed by pool slot */
+	TArray<TObjectPtr<ActorType>> Items;
+
+	/** Parallel to Items -- true if the slot is on a free stack */
+	TArray<bool> SlotFree;
+
+	/** Parallel to Items -- which free stack the slot returns to */
+	TArray<int32> SlotBucket;
+
+	/** Stack of inactive slots per bucket */
+	TArray<TArray<int32>> FreeSlots;
+
+	/** Total entries across the free stacks */
+	int32 NumFree = 0;
+
+	int32 NumInUse = 0;
+	int32 HighWaterMark = 0;
+};
+
+/**
+ * Unordered list of active actors with O(1) add and swap-remove.
+ * Each actor remembers its index, so removal never searches.
+ */
+template<typename ActorType>
+class TActiveActorList
+{
+public:
+
+	/** Add an actor (no-op if already present) */
+	void Add(ActorType* Actor)
+	{
+		if (!Actor || Contains(Actor))
+		{
+			return;
+		}
+
+		Actor->SetActiveListIndex(Items.Add(Actor));
+		HighWaterMark = FMath::Max(HighWaterMark, Items.Num());
+	}
+
+	/** Swap-remove an actor (no-op if not present) */
+	void Remove(ActorType* Actor)
+	{
+		if (!Contains(Actor))
+		{
+			return;
+		}
+
+		const int32 Index = Actor->GetActiveListIndex();
+		Items.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		Actor->SetActiveListIndex(INDEX_NONE);
+
+		// Whoever got swapped into the hole needs its index fixed
+		if (Items.IsValidIndex(Index) && Items[Index])
+		{
+			Items[Index]->SetActiveListIndex(Index);
+		}
+	}
+
+	bool Contains(const ActorType* Actor) const
+	{
+		if (!Actor)
+		{
+			return false;
+		}
+		const int32 Index = Actor->GetActiveListIndex();
+		return Items.IsValidIndex(Index) && Items[Index] == Actor;
+	}
+
+	/** Drop everything (actors keep whatever state they're in) */
+	void Reset()
+	{
+		for (ActorType* Actor : Items)
+		{
+			if (Actor)
+			{
+				Actor->SetActiveListIndex(INDEX_NONE);
+			}
+		}
+		Items.Reset();
+	}
+
+	int32 Num() const { return Items.Num(); }
+	bool IsEmpty() const { return Items.Num() == 0; }
+	ActorType* operator[](int32 Index) const { return Items[Index]; }
+	ActorType* Last() const { return Items.Last(); }
+
+	/** Peak Num() seen */
+	int32 GetHighWaterMark() const { return HighWaterMark; }
+
+	/** Snapshot-friendly access (copy before iterating if the loop can deactivate) */
+	const TArray<TObjectPtr<ActorType>>& GetArray() const { return Items; }
+
+	/** Heap used by the list (not the actors) */
+	SIZE_T GetAllocatedSize() const { return Items.GetAllocatedSize(); }
+
+	auto begin() const { return Items.begin(); }
+	auto end() const { return Items.end(); }
+
+	/** Report list entries to GC */
+	void AddReferencedObjects(FReferenceCollector& Collector)
+	{
+		Collector.AddReferencedObjects(Items);
+	}
+
+private:
+
+	TArray<TObjectPtr<ActorType>> Items;
+	int32 HighWaterMark = 0;
+};
+
+/**
+ * Time-sliced pool growth for a spawner with NumTypes pools of ActorType.
+ * Targets only ever rise; each frame the pool furthest below its target gets
+ * a new actor until the frame budget runs out, then the queue reschedules itself
+ * for the next tick. The owner supplies pool lookup and spawning through Initialize().
+ */
+template<typename ActorType, int32 NumTypes>
+class TPrewarmQueue
+{
+public:
+
+	/** Pool for a type index */
+	using FGetPool = TFunction<TActorPool<ActorType>&(int32 TypeIndex)>;
+
+	/** Spawn one deactivated actor of a type and add it to its pool; nullptr if the type can't spawn */
+	using FSpawnIntoPool = TFunction<ActorType*(int32 TypeIndex)>;
+
+	/** Called after each slice; bFinished once every pool reached its target */
+	using FOnSliceDone = TFunction<void(bool bFinished, int32 NumSpawned)>;
+
+	/**
+	 * Bind the queue to its owning component. Must be called before Request().
+	 *
+	 * @param InOwner Component the timer is bound to (the queue stops if it goes away)
+	 * @param InFrameBudgetMs Spawn time allowed per frame
+	 */
+	void Initialize(UObject* InOwner, float InFrameBudgetMs, FGetPool InGetPool, FSpawnIntoPool InSpawnIntoPool, FOnSliceDone InOnSliceDone)
+	{
+		Owner = InOwner;
+		FrameBudgetMs = InFrameBudgetMs;
+		GetPool = MoveTemp(InGetPool);
+		SpawnIntoPool = MoveTemp(InSpawnIntoPool);
+		OnSliceDone = MoveTemp(InOnSliceDone);
+	}
+
+	/**
+	 * Raise a pool's target and make sure a slice is scheduled. Never shrinks a target.
+	 *
+	 * @param TypeIndex Pool to grow
+	 * @param TargetSize Total pool size (active + free) to work toward
+	 */
+	void Request(int32 TypeIndex, int32 TargetSize)
+	{
+		check(TypeIndex >= 0 && TypeIndex < NumTypes);
+		Targets[TypeIndex] = FMath::Max(Targets[TypeIndex], TargetSize);
+
+		if (!bScheduled && HasWork())
+		{
+			ScheduleNextTick();
+		}
+	}
+
+	/** True if any pool is below its target */
+	bool HasWork() const
+	{
+		if (!GetPool)
+		{
+			return false;
+		}
+		for (int32 TypeIndex = 0; TypeIndex < NumTypes; TypeIndex++)
+		{
+			if (GetPool(TypeIndex).Num() < Targets[TypeIndex])
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+private:
+
+	void ScheduleNextTick()
+	{
+		UObject* OwnerObject = Owner.Get();
+		UWorld* World = OwnerObject ? OwnerObject->GetWorld() : nullptr;
+		if (World)
+		{
+			bScheduled = true;
+			World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateWeakLambda(OwnerObject, [this]()
+			{
+				Tick();
+			}));
+		}
+	}
+
+	/** Spawn pool actors until the frame budget runs out, then reschedule */
+	void Tick()
+	{
+		STATERUNNER_SCOPE_CYCLE_COUNTER(PoolPrewarm);
+
+		bScheduled = false;
+
+		const double StartTime = FPlatformTime::Seconds();
+		const double BudgetSeconds = FrameBudgetMs / 1000.0;
+		int32 SpawnedThisFrame = 0;
+
+		while (HasWork())
+		{
+			// Fill whichever pool is furthest behind first
+			int32 TypeIndex = 0;
+			int32 LargestDeficit = 0;
+			for (int32 Candidate = 0; Candidate < NumTypes; Candidate++)
+			{
+				const int32 Deficit = Targets[Candidate] - GetPool(Candidate).Num();
+				if (Deficit > LargestDeficit)
+				{
+					LargestDeficit = Deficit;
+					TypeIndex = Candidate;
+				}
+			}
+
+			if (!SpawnIntoPool(TypeIndex))
+			{
+				// No class assigned -- stop trying for this type
+				Targets[TypeIndex] = GetPool(TypeIndex).Num();
+				continue;
+			}
+			SpawnedThisFrame++;
+
+			if (FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+			{
+				break;
+			}
+		}
+
+		const bool bFinished = !HasWork();
+		if (!bFinished)
+		{
+			ScheduleNextTick();
+		}
+
+		if (OnSliceDone)
+		{
+			OnSliceDone(bFinished, SpawnedThisFrame);
+		}
+	}
+
+	TWeakObjectPtr<UObject> Owner;
+	float FrameBudgetMs = 1.0f;
+	FGetPool GetPool;
+	FSpawnIntoPool SpawnIntoPool;
+	FOnSliceDone OnSliceDone;
+
+	/** Pool size being worked toward, indexed by type */
+	int32 Targets[NumTypes] = {};
+
+	/** True while a Tick() is queued for next frame */
+	bool bScheduled = false;
+};
+
+/**
+ * Recorded pool peaks for adaptive pool sizing. Every spawner's peaks live in one
+ * GameUserSettings section, keyed by enum and value name (e.g. "EObstacleType.LowWall"),
+ * so the section, keys and decay rule are shared rather than copied per spawner.
+ */
+struct FPoolHistory
+{
+	/** GameUserSettings section holding every recorded pool peak */
+	static constexpr const TCHAR* ConfigSection = TEXT("StateRunnerArcade.PoolSizing");
+
+	/** Config key for one type's recorded peak */
+	template<typename EnumType>
+	static FString GetKey(int32 TypeIndex)
+	{
+		const UEnum* Enum = StaticEnum<EnumType>();
+		return FString::Printf(TEXT("%s.%s"), *Enum->GetName(), *Enum->GetNameStringByValue(TypeIndex));
+	}
+
+	/**
+	 * Read recorded peaks, indexed by EnumType. Types with no history keep their current value.
+	 *
+	 * @param OutPeaks Peak per type (0 = no history)
+	 */
+	template<typename EnumType, int32 NumTypes>
+	static void Load(int32 (&OutPeaks)[NumTypes])
+	{
+		if (!GConfig)
+		{
+			return;
+		}
+
+		for (int32 TypeIndex = 0; TypeIndex < NumTypes; TypeIndex++)
+		{
+			int32 SavedPeak = 0;
+			if (GConfig->GetInt(ConfigSection, *GetKey<EnumType>(TypeIndex), SavedPeak, GGameUserSettingsIni))
+			{
+				OutPeaks[TypeIndex] = FMath::Max(0, SavedPeak);
+			}
+		}
+	}
+
+	/**
+	 * Merge a session's peaks into the recorded ones and save them:
+	 * each type stores max(session peak, recorded peak * Decay).
+	 *
+	 * @param RecordedPeaks Peaks read by Load() at the start of the session
+	 * @param GetSessionPeak This session's high-water mark for a type index
+	 * @param Decay Fraction of the recorded peak kept (below 1 lets an unused pool shrink)
+	 */
+	template<typename EnumType, int32 NumTypes>
+	static void Save(const int32 (&RecordedPeaks)[NumTypes], TFunctionRef<int32(int32 TypeIndex)> GetSessionPeak, float Decay)
+	{
+		if (!GConfig)
+		{
+			return;
+		}
+
+		for (int32 TypeIndex = 0; TypeIndex < NumTypes; TypeIndex++)
+		{
+			const int32 DecayedPeak = FMath::FloorToInt(RecordedPeaks[TypeIndex] * Decay);
+			GConfig->SetInt(ConfigSection, *GetKey<EnumType>(TypeIndex), FMath::Max(GetSessionPeak(TypeIndex), DecayedPeak), GGameUserSettingsIni);
+		}
+		GConfig->Flush(false, GGameUserSettingsIni);
+	}
+};
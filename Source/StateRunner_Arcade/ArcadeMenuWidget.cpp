@@ -7,6 +7,7 @@
 #include "Kismet/GameplayStatics.h"
 #include "Sound/SoundBase.h"
 #include "Framework/Application/SlateApplication.h"
+#include "StateRunner_ArcadePlayerController.h"
 #include "StateRunner_Arcade.h"
 
 UArcadeMenuWidget::UArcadeMenuWidget(const FObjectInitializer& ObjectInitializer)
@@ -20,6 +21,14 @@ void UArcadeMenuWidget::NativeConstruct()
 {
 	Super::NativeConstruct();
 
+	if (bQuiesceWorld)
+	{
+		if (AStateRunner_ArcadePlayerController* ArcadeController = Cast<AStateRunner_ArcadePlayerController>(GetOwningPlayer()))
+		{
+			ArcadeController->EnterMenuQuiescence(this, bHidesWorld, bCapsFrameRate);
+		}
+	}
+
 	// Set initial focus index (but don't show visuals until keyboard navigation starts)
 	if (bFocusOnConstruct && FocusableItems.Num() > 0)
 	{
@@ -34,6 +43,12 @@ void UArcadeMenuWidget::NativeDestruct()
 	// Clean up timer
 	StopKeyRepeat();
 
+	// Released unconditionally -- bQuiesceWorld may have been toggled while shown
+	if (AStateRunner_ArcadePlayerController* ArcadeController = Cast<AStateRunner_ArcadePlayerController>(GetOwningPlayer()))
+	{
+		ArcadeController->ExitMenuQuiescence(this);
+	}
+
 	Super::NativeDestruct();
 }
 
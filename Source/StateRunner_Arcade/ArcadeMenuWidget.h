@@ -118,6 +118,21 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Navigation")
 	bool bLeftRightNavigatesMenu = false;
 
+	/**
+	 * While shown, put the world into menu quiescence (gameplay ticks, timeline and physics
+	 * stopped, frame rate capped). See AStateRunner_ArcadePlayerController.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Quiescence")
+	bool bQuiesceWorld = true;
+
+	/** This menu is opaque and full-screen, so the 3D scene isn't drawn behind it */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Quiescence", meta=(EditCondition="bQuiesceWorld"))
+	bool bHidesWorld = false;
+
+	/** Let quiescence cap the frame rate while shown (off for menus that show or change it) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Quiescence", meta=(EditCondition="bQuiesceWorld"))
+	bool bCapsFrameRate = true;
+
 	/**
 	 * Step size for slider adjustment (0.0 to 1.0 range).
 	 * 0.05 = 5% per press.
@@ -0,0 +1,419 @@
+#include "ArcadeSaveSubsystem.h"
+#include "ScoreSystemComponent.h"
+#include "AudioSettingsSubsystem.h"
+#include "Kismet/GameplayStatics.h"
+#include "Async/Async.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "StateRunner_Arcade.h"
+
+const FString UArcadeSaveSubsystem::SaveSlot = TEXT("ArcadeSave");
+const FString UArcadeSaveSubsystem::LegacyHighScoreSlot = TEXT("HighScore");
+const FString UArcadeSaveSubsystem::LegacyLeaderboardSlot = TEXT("Leaderboard");
+
+// --- Legacy ini keys (ThemeSubsystem wrote these before the unified record) ---
+
+static const TCHAR* LegacyThemeConfigSection = TEXT("StateRunnerArcade.Theme");
+static const TCHAR* LegacyThemeConfigKey = TEXT("CurrentTheme");
+
+/** Boards are plain packed arrays -- copying them is a few memcpys */
+static void CopyBoards(const ULeaderboardSaveGame& From, UArcadeSaveGame& To)
+{
+	To.AllTimeBoard = From.AllTimeBoard;
+	To.DailyBoard = From.DailyBoard;
+	To.WeeklyBoard = From.WeeklyBoard;
+}
+
+static void CopyBoards(const UArcadeSaveGame& From, ULeaderboardSaveGame& To)
+{
+	To.AllTimeBoard = From.AllTimeBoard;
+	To.DailyBoard = From.DailyBoard;
+	To.WeeklyBoard = From.WeeklyBoard;
+}
+
+// --- Subsystem Lifecycle ---
+
+void UArcadeSaveSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	Leaderboard = Cast<ULeaderboardSaveGame>(UGameplayStatics::CreateSaveGameObject(ULeaderboardSaveGame::StaticClass()));
+	LoadRecord();
+
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("ArcadeSaveSubsystem: Initialized (version %d, high score %d, %d leaderboard entries)"),
+		Record->Version, Record->HighScore, Leaderboard ? Leaderboard->GetNumEntries(ELeaderboardPeriod::AllTime) : 0);
+}
+
+void UArcadeSaveSubsystem::Deinitialize()
+{
+	bShuttingDown = true;
+
+	if (DebounceHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(DebounceHandle);
+		DebounceHandle.Reset();
+	}
+
+	// An in-flight write must land first, or it could finish after (and over) the final one
+	if (bWriting && WriteTask.IsValid())
+	{
+		WriteTask.Wait();
+	}
+
+	// Last chance -- anything still dirty is written synchronously
+	if (bDirty && Record)
+	{
+		STATERUNNER_SCOPE_CYCLE_COUNTER(SaveWrite);
+
+		if (Leaderboard)
+		{
+			CopyBoards(*Leaderboard, *Record);
+		}
+		bDirty = false;
+		WriteCount++;
+
+		if (!UGameplayStatics::SaveGameToSlot(Record, SaveSlot, 0))
+		{
+			UE_LOG(LogStateRunner_Arcade, Warning, TEXT("ArcadeSaveSubsystem: Final write of slot %s failed"), *SaveSlot);
+		}
+	}
+
+	Super::Deinitialize();
+}
+
+UArcadeSaveSubsystem* UArcadeSaveSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject || !GEngine)
+	{
+		return nullptr;
+	}
+
+	const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<UArcadeSaveSubsystem>() : nullptr;
+}
+
+// --- Scores ---
+
+int32 UArcadeSaveSubsystem::GetHighScore() const
+{
+	return Record ? Record->HighScore : 0;
+}
+
+void UArcadeSaveSubsystem::SetHighScore(int32 NewHighScore)
+{
+	if (!Record || Record->HighScore == NewHighScore)
+	{
+		return;
+	}
+
+	Record->HighScore = NewHighScore;
+	MarkDirty();
+}
+
+// --- Settings ---
+
+void UArcadeSaveSubsystem::GetVolumes(float& OutMasterVolume, float& OutMusicVolume, float& OutSFXVolume) const
+{
+	OutMasterVolume = Record ? Record->MasterVolume : UAudioSettingsSubsystem::DefaultMasterVolume;
+	OutMusicVolume = Record ? Record->MusicVolume : UAudioSettingsSubsystem::DefaultMusicVolume;
+	OutSFXVolume = Record ? Record->SFXVolume : UAudioSettingsSubsystem::DefaultSFXVolume;
+}
+
+void UArcadeSaveSubsystem::SetVolumes(float InMasterVolume, float InMusicVolume, float InSFXVolume)
+{
+	if (!Record)
+	{
+		return;
+	}
+
+	if (FMath::IsNearlyEqual(Record->MasterVolume, InMasterVolume)
+		&& FMath::IsNearlyEqual(Record->MusicVolume, InMusicVolume)
+		&& FMath::IsNearlyEqual(Record->SFXVolume, InSFXVolume))
+	{
+		return;
+	}
+
+	Record->MasterVolume = InMasterVolume;
+	Record->MusicVolume = InMusicVolume;
+	Record->SFXVolume = InSFXVolume;
+	MarkDirty();
+}
+
+int32 UArcadeSaveSubsystem::GetThemeIndex() const
+{
+	return Record ? Record->ThemeIndex : INDEX_NONE;
+}
+
+void UArcadeSaveSubsystem::SetThemeIndex(int32 NewThemeIndex)
+{
+	if (!Record || Record->ThemeIndex == NewThemeIndex)
+	{
+		return;
+	}
+
+	Record->ThemeIndex = NewThemeIndex;
+	MarkDirty();
+}
+
+bool UArcadeSaveSubsystem::IsShuffleEnabled() const
+{
+	return Record && Record->bShuffleEnabled;
+}
+
+void UArcadeSaveSubsystem::SetShuffleEnabled(bool bEnabled)
+{
+	if (!Record || Record->bShuffleEnabled == bEnabled)
+	{
+		return;
+	}
+
+	Record->bShuffleEnabled = bEnabled;
+	MarkDirty();
+}
+
+FDisplaySettings UArcadeSaveSubsystem::GetDisplaySettings() const
+{
+	return Record ? Record->DisplaySettings : FDisplaySettings();
+}
+
+void UArcadeSaveSubsystem::SetDisplaySettings(const FDisplaySettings& NewSettings)
+{
+	if (!Record || Record->DisplaySettings == NewSettings)
+	{
+		return;
+	}
+
+	Record->DisplaySettings = NewSettings;
+	MarkDirty();
+}
+
+// --- Writing ---
+
+void UArcadeSaveSubsystem::MarkDirty()
+{
+	bDirty = true;
+
+	// Restart the debounce window so a burst of changes ends in one write
+	if (DebounceHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(DebounceHandle);
+	}
+	DebounceHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &UArcadeSaveSubsystem::OnDebounceElapsed), DebounceSeconds);
+}
+
+void UArcadeSaveSubsystem::Flush(TFunction<void(bool)>&& OnComplete)
+{
+	if (!bDirty)
+	{
+		// Nothing new -- but if a write is in flight, report when that one lands
+		if (bWriting && OnComplete)
+		{
+			InFlightCallbacks.Add(MoveTemp(OnComplete));
+		}
+		else if (OnComplete)
+		{
+			OnComplete(true);
+		}
+		return;
+	}
+
+	if (DebounceHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(DebounceHandle);
+		DebounceHandle.Reset();
+	}
+
+	if (bWriting)
+	{
+		// The queued write picks up whatever the record holds when the current one finishes
+		bWriteQueued = true;
+		if (OnComplete)
+		{
+			QueuedCallbacks.Add(MoveTemp(OnComplete));
+		}
+		return;
+	}
+
+	if (OnComplete)
+	{
+		InFlightCallbacks.Add(MoveTemp(OnComplete));
+	}
+	BeginWrite();
+}
+
+bool UArcadeSaveSubsystem::OnDebounceElapsed(float DeltaTime)
+{
+	DebounceHandle.Reset();
+	Flush();
+	return false;
+}
+
+void UArcadeSaveSubsystem::BeginWrite()
+{
+	STATERUNNER_SCOPE_CYCLE_COUNTER(SaveWrite);
+
+	if (!Record)
+	{
+		return;
+	}
+
+	if (Leaderboard)
+	{
+		CopyBoards(*Leaderboard, *Record);
+	}
+	Record->Version = UArcadeSaveGame::CurrentVersion;
+
+	bDirty = false;
+	bWriting = true;
+	WriteCount++;
+
+	// Serialize here (the record is a UObject); only the file I/O leaves the game thread
+	TArray<uint8> SaveData;
+	if (!UGameplayStatics::SaveGameToMemory(Record, SaveData))
+	{
+		OnWriteComplete(SaveSlot, 0, false);
+		return;
+	}
+
+	// Kept so shutdown can wait for it; the completion comes back on the game thread
+	TWeakObjectPtr<UArcadeSaveSubsystem> WeakThis(this);
+	WriteTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [WeakThis, SaveData = MoveTemp(SaveData)]()
+	{
+		const bool bSuccess = UGameplayStatics::SaveDataToSlot(SaveData, SaveSlot, 0);
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, bSuccess]()
+		{
+			if (UArcadeSaveSubsystem* Saves = WeakThis.Get())
+			{
+				Saves->OnWriteComplete(SaveSlot, 0, bSuccess);
+			}
+		});
+	});
+}
+
+void UArcadeSaveSubsystem::OnWriteComplete(const FString& SlotName, const int32 UserIndex, bool bSuccess)
+{
+	if (bShuttingDown)
+	{
+		return;
+	}
+
+	bWriting = false;
+
+	if (!bSuccess)
+	{
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("ArcadeSaveSubsystem: Writing slot %s failed"), *SlotName);
+		bDirty = true;
+	}
+
+	TArray<TFunction<void(bool)>> Callbacks = MoveTemp(InFlightCallbacks);
+	InFlightCallbacks.Reset();
+
+	if (bWriteQueued)
+	{
+		bWriteQueued = false;
+		InFlightCallbacks = MoveTemp(QueuedCallbacks);
+		QueuedCallbacks.Reset();
+		BeginWrite();
+	}
+
+	for (TFunction<void(bool)>& Callback : Callbacks)
+	{
+		Callback(bSuccess);
+	}
+}
+
+// --- Loading ---
+
+void UArcadeSaveSubsystem::LoadRecord()
+{
+	STATERUNNER_SCOPE_CYCLE_COUNTER(SaveLoad);
+
+	if (UGameplayStatics::DoesSaveGameExist(SaveSlot, 0))
+	{
+		Record = Cast<UArcadeSaveGame>(UGameplayStatics::LoadGameFromSlot(SaveSlot, 0));
+		if (!Record)
+		{
+			UE_LOG(LogStateRunner_Arcade, Warning, TEXT("ArcadeSaveSubsystem: Slot %s is unreadable, starting fresh"), *SaveSlot);
+		}
+	}
+
+	if (Record)
+	{
+		if (Record->Version < UArcadeSaveGame::CurrentVersion)
+		{
+			MigrateRecord(*Record);
+			bDirty = true;
+		}
+	}
+	else
+	{
+		Record = Cast<UArcadeSaveGame>(UGameplayStatics::CreateSaveGameObject(UArcadeSaveGame::StaticClass()));
+		if (ImportLegacyData(*Record))
+		{
+			UE_LOG(LogStateRunner_Arcade, Log, TEXT("ArcadeSaveSubsystem: Migrated legacy save data into slot %s"), *SaveSlot);
+			bDirty = true;
+		}
+	}
+
+	if (Leaderboard)
+	{
+		CopyBoards(*Record, *Leaderboard);
+
+		// Version 1 records and the legacy slot carry the unpacked top-10 list
+		if (Record->LeaderboardEntries.Num() > 0)
+		{
+			Leaderboard->ImportEntries(Record->LeaderboardEntries);
+			Record->LeaderboardEntries.Reset();
+			bDirty = true;
+		}
+
+		Leaderboard->RollPeriods(FDateTime::Now());
+	}
+
+	// Write the migrated record soon, off the boot path
+	if (bDirty)
+	{
+		MarkDirty();
+	}
+}
+
+bool UArcadeSaveSubsystem::ImportLegacyData(UArcadeSaveGame& Target) const
+{
+	bool bFoundAny = false;
+
+	if (const UHighScoreSaveGame* LegacyHighScore = Cast<UHighScoreSaveGame>(UGameplayStatics::LoadGameFromSlot(LegacyHighScoreSlot, 0)))
+	{
+		Target.HighScore = LegacyHighScore->HighScore;
+		bFoundAny = true;
+	}
+
+	if (const ULeaderboardSaveGame* LegacyLeaderboard = Cast<ULeaderboardSaveGame>(UGameplayStatics::LoadGameFromSlot(LegacyLeaderboardSlot, 0)))
+	{
+		Target.LeaderboardEntries = LegacyLeaderboard->Entries;
+		bFoundAny = true;
+	}
+
+	if (GConfig)
+	{
+		bFoundAny |= GConfig->GetFloat(*UAudioSettingsSubsystem::AudioConfigSection, *UAudioSettingsSubsystem::MasterVolumeKey, Target.MasterVolume, GGameUserSettingsIni);
+		bFoundAny |= GConfig->GetFloat(*UAudioSettingsSubsystem::AudioConfigSection, *UAudioSettingsSubsystem::MusicVolumeKey, Target.MusicVolume, GGameUserSettingsIni);
+		bFoundAny |= GConfig->GetFloat(*UAudioSettingsSubsystem::AudioConfigSection, *UAudioSettingsSubsystem::SFXVolumeKey, Target.SFXVolume, GGameUserSettingsIni);
+		bFoundAny |= GConfig->GetInt(LegacyThemeConfigSection, LegacyThemeConfigKey, Target.ThemeIndex, GGameUserSettingsIni);
+	}
+
+	return bFoundAny;
+}
+
+void UArcadeSaveSubsystem::MigrateRecord(UArcadeSaveGame& Target) const
+{
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("ArcadeSaveSubsystem: Migrating save record from version %d to %d"),
+		Target.Version, UArcadeSaveGame::CurrentVersion);
+
+	// 1 -> 2: LeaderboardEntries became packed boards. The entries are imported by LoadRecord,
+	// which owns the working leaderboard; nothing to rewrite in the record itself.
+
+	Target.Version = UArcadeSaveGame::CurrentVersion;
+}
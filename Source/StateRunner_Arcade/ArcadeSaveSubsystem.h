@@ -0,0 +1,215 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Tasks/Task.h"
+#include "GameFramework/SaveGame.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "ScoreSystemComponent.h"
+#include "AudioSettingsSubsystem.h"
+#include "DisplaySettingsSubsystem.h"
+#include "ArcadeSaveSubsystem.generated.h"
+
+/**
+ * Everything the game persists, in one record (one save slot, one file).
+ * USaveGame serializes tagged properties, so adding fields stays readable by older saves;
+ * Version is for changes that need an explicit migration (see UArcadeSaveSubsystem::MigrateRecord).
+ */
+UCLASS()
+class STATERUNNER_ARCADE_API UArcadeSaveGame : public USaveGame
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Record layout version this save was written with */
+	static constexpr int32 CurrentVersion = 2;
+
+	UPROPERTY()
+	int32 Version = CurrentVersion;
+
+	// --- Scores ---
+
+	UPROPERTY()
+	int32 HighScore = 0;
+
+	UPROPERTY()
+	FLeaderboardBoard AllTimeBoard;
+
+	UPROPERTY()
+	FLeaderboardBoard DailyBoard;
+
+	UPROPERTY()
+	FLeaderboardBoard WeeklyBoard;
+
+	/** Version 1 layout (unpacked top 10); imported into the boards on load, then emptied */
+	UPROPERTY()
+	TArray<FLeaderboardEntry> LeaderboardEntries;
+
+	// --- Settings ---
+
+	UPROPERTY()
+	float MasterVolume = UAudioSettingsSubsystem::DefaultMasterVolume;
+
+	UPROPERTY()
+	float MusicVolume = UAudioSettingsSubsystem::DefaultMusicVolume;
+
+	UPROPERTY()
+	float SFXVolume = UAudioSettingsSubsystem::DefaultSFXVolume;
+
+	/** EThemeType as int; -1 = never chosen (theme subsystem default) */
+	UPROPERTY()
+	int32 ThemeIndex = -1;
+
+	UPROPERTY()
+	bool bShuffleEnabled = false;
+
+	/** Frame rate cap, VSync, low latency and simulation rate */
+	UPROPERTY()
+	FDisplaySettings DisplaySettings;
+};
+
+/**
+ * Arcade Save Subsystem
+ *
+ * The one save store for the session: high score, leaderboard, volumes, theme, music
+ * shuffle and display settings live in a single versioned UArcadeSaveGame, held in memory as the authoritative
+ * copy every level, subsystem and widget reads.
+ *
+ * Loading: the record is read once in Initialize. That's a single small file behind the
+ * boot screen, and settings (volume, theme) must be known before the first map loads, so it
+ * is read synchronously. Older installs are migrated once from the legacy "HighScore" /
+ * "Leaderboard" slots and the GameUserSettings ini keys.
+ *
+ * Writing: setters only mark the record dirty. Dirty data is written in one batch either at
+ * a safe point (Flush -- menu close, game over) or DebounceSeconds after the last change.
+ * Writes are serialized on the game thread and the file I/O runs as a task; a flush
+ * requested while one is still writing is queued and re-issued with the latest data, so
+ * there's never more than one write in flight. Shutdown waits for that write before the
+ * final synchronous one, so the last data written is the newest.
+ */
+UCLASS()
+class STATERUNNER_ARCADE_API UArcadeSaveSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	// --- Subsystem Lifecycle ---
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** Get the subsystem from any world context (null without a game instance) */
+	static UArcadeSaveSubsystem* Get(const UObject* WorldContextObject);
+
+	// --- Slot Names ---
+
+	static const FString SaveSlot;
+
+	/** Pre-unification slots, read once for migration */
+	static const FString LegacyHighScoreSlot;
+	static const FString LegacyLeaderboardSlot;
+
+	// --- Configuration ---
+
+	/** Seconds after the last change before dirty data is written without an explicit Flush */
+	static constexpr float DebounceSeconds = 3.0f;
+
+	// --- Scores ---
+
+	int32 GetHighScore() const;
+	void SetHighScore(int32 NewHighScore);
+
+	/** The authoritative leaderboard (never null after Initialize) */
+	ULeaderboardSaveGame* GetLeaderboard() const { return Leaderboard; }
+
+	/** Call after modifying GetLeaderboard()'s entries */
+	void MarkLeaderboardChanged() { MarkDirty(); }
+
+	// --- Settings ---
+
+	void GetVolumes(float& OutMasterVolume, float& OutMusicVolume, float& OutSFXVolume) const;
+	void SetVolumes(float InMasterVolume, float InMusicVolume, float InSFXVolume);
+
+	/** Saved theme as an EThemeType int, or -1 if none was ever chosen */
+	int32 GetThemeIndex() const;
+	void SetThemeIndex(int32 NewThemeIndex);
+
+	bool IsShuffleEnabled() const;
+	void SetShuffleEnabled(bool bEnabled);
+
+	FDisplaySettings GetDisplaySettings() const;
+	void SetDisplaySettings(const FDisplaySettings& NewSettings);
+
+	// --- Writing ---
+
+	/** True if something changed since the last write was issued */
+	bool IsDirty() const { return bDirty; }
+
+	/** Mark the record changed; it's written after DebounceSeconds unless flushed sooner */
+	void MarkDirty();
+
+	/**
+	 * Write now if dirty (safe points: menu close, game over).
+	 *
+	 * @param OnComplete Called on the game thread once the data is on disk (true = success);
+	 *                   immediately with true if there was nothing to write
+	 */
+	void Flush(TFunction<void(bool)>&& OnComplete = nullptr);
+
+	/** Number of slot writes issued this session (debug) */
+	int32 GetWriteCount() const { return WriteCount; }
+
+	// --- Internal State ---
+
+protected:
+
+	/** The persisted record */
+	UPROPERTY()
+	TObjectPtr<UArcadeSaveGame> Record;
+
+	/** Working leaderboard (keeps AddEntry and the rank queries); copied into Record on write */
+	UPROPERTY()
+	TObjectPtr<ULeaderboardSaveGame> Leaderboard;
+
+	bool bDirty = false;
+	bool bWriting = false;
+	bool bWriteQueued = false;
+
+	/** File I/O of the write in flight (waited on at shutdown) */
+	UE::Tasks::FTask WriteTask;
+
+	/** Callbacks for the write in flight / the queued one */
+	TArray<TFunction<void(bool)>> InFlightCallbacks;
+	TArray<TFunction<void(bool)>> QueuedCallbacks;
+
+	FTSTicker::FDelegateHandle DebounceHandle;
+
+	int32 WriteCount = 0;
+
+	/** Set in Deinitialize -- completions arriving during shutdown do nothing */
+	bool bShuttingDown = false;
+
+	// --- Internal Functions ---
+
+protected:
+
+	/** Read the unified slot, or build the record from the legacy slots/ini on first run */
+	void LoadRecord();
+
+	/** Fill a fresh record from the pre-unification storage; true if anything was found */
+	bool ImportLegacyData(UArcadeSaveGame& Target) const;
+
+	/** Bring a record written by an older version up to CurrentVersion */
+	void MigrateRecord(UArcadeSaveGame& Target) const;
+
+	/** Copy working state into Record, serialize it and start the file write task */
+	void BeginWrite();
+
+	/** Async write finished -- run callbacks and issue the queued write if any */
+	void OnWriteComplete(const FString& SlotName, const int32 UserIndex, bool bSuccess);
+
+	/** Debounce timer fired */
+	bool OnDebounceElapsed(float DeltaTime);
+};
@@ -0,0 +1,168 @@
+#include "AssetPreloadSubsystem.h"
+#include "Sound/SoundBase.h"
+#include "HAL/PlatformTime.h"
+#include "StateRunner_Arcade.h"
+
+// --- Preload Manifest ---
+// Prefixed to avoid Unity build collisions
+
+/** Indexed by EPreloadAsset */
+static const FSoftObjectPath Preload_AssetPaths[] = {
+	FSoftObjectPath(TEXT("/Game/_DEVELOPER/Audio/SoundClasses/SM_GameVolume.SM_GameVolume")),     // GameVolumeMix
+	FSoftObjectPath(TEXT("/Game/_DEVELOPER/Audio/SoundClasses/SClass_Master.SClass_Master")),     // MasterSoundClass
+	FSoftObjectPath(TEXT("/Game/_DEVELOPER/Audio/SoundClasses/SClass_Music.SClass_Music")),       // MusicSoundClass
+	FSoftObjectPath(TEXT("/Game/_DEVELOPER/Audio/SoundClasses/SClass_SFX.SClass_SFX")),           // SFXSoundClass
+};
+static_assert(UE_ARRAY_COUNT(Preload_AssetPaths) == static_cast<int32>(EPreloadAsset::Count), "Preload_AssetPaths must have one path per EPreloadAsset");
+
+static const FSoftObjectPath Preload_MusicTrackPaths[] = {
+	FSoftObjectPath(TEXT("/Game/_DEVELOPER/Audio/Music/Rush.Rush")),
+	FSoftObjectPath(TEXT("/Game/_DEVELOPER/Audio/Music/ByteChaser.ByteChaser")),
+	FSoftObjectPath(TEXT("/Game/_DEVELOPER/Audio/Music/Circuit.Circuit")),
+	FSoftObjectPath(TEXT("/Game/_DEVELOPER/Audio/Music/StateRunner.StateRunner")),
+	FSoftObjectPath(TEXT("/Game/_DEVELOPER/Audio/Music/Velocity.Velocity")),
+};
+
+// --- Subsystem Lifecycle ---
+
+void UAssetPreloadSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	ResolvedAssets.SetNum(static_cast<int32>(EPreloadAsset::Count));
+
+	TArray<FSoftObjectPath> Manifest;
+	Manifest.Append(Preload_AssetPaths, UE_ARRAY_COUNT(Preload_AssetPaths));
+	Manifest.Append(Preload_MusicTrackPaths, UE_ARRAY_COUNT(Preload_MusicTrackPaths));
+
+	// One batched request for the whole manifest, streamed behind the splash screen
+	PreloadStartTime = FPlatformTime::Seconds();
+	PreloadHandle = StreamableManager.RequestAsyncLoad(Manifest,
+		FStreamableDelegate::CreateUObject(this, &UAssetPreloadSubsystem::OnManifestStreamed),
+		FStreamableManager::AsyncLoadHighPriority);
+
+	// Everything may already be in memory (editor), in which case the delegate has run
+	if (!PreloadHandle.IsValid() && !bPreloadComplete)
+	{
+		OnManifestStreamed();
+	}
+
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("AssetPreloadSubsystem: Streaming %d manifest assets"), Manifest.Num());
+}
+
+void UAssetPreloadSubsystem::Deinitialize()
+{
+	if (PreloadHandle.IsValid())
+	{
+		PreloadHandle->CancelHandle();
+		PreloadHandle.Reset();
+	}
+	PendingCallbacks.Empty();
+
+	Super::Deinitialize();
+}
+
+// --- Resolved Assets ---
+
+UObject* UAssetPreloadSubsystem::GetAsset(EPreloadAsset Asset)
+{
+	const int32 Index = static_cast<int32>(Asset);
+	if (!ResolvedAssets.IsValidIndex(Index))
+	{
+		return nullptr;
+	}
+
+	if (!ResolvedAssets[Index])
+	{
+		const FSoftObjectPath& Path = Preload_AssetPaths[Index];
+
+		// Requested before the stream got to it -- resolve it now rather than fail
+		ResolvedAssets[Index] = Path.ResolveObject();
+		if (!ResolvedAssets[Index] && !bPreloadComplete)
+		{
+			UE_LOG(LogStateRunner_Arcade, Warning, TEXT("AssetPreloadSubsystem: %s requested before the preload finished; loading synchronously"), *Path.ToString());
+			ResolvedAssets[Index] = Path.TryLoad();
+		}
+	}
+
+	return ResolvedAssets[Index];
+}
+
+// --- Preload State ---
+
+float UAssetPreloadSubsystem::GetPreloadProgress() const
+{
+	if (bPreloadComplete)
+	{
+		return 1.0f;
+	}
+	return PreloadHandle.IsValid() ? PreloadHandle->GetProgress() : 0.0f;
+}
+
+void UAssetPreloadSubsystem::WhenPreloaded(TFunction<void()>&& Callback)
+{
+	if (!Callback)
+	{
+		return;
+	}
+
+	if (bPreloadComplete)
+	{
+		Callback();
+		return;
+	}
+
+	PendingCallbacks.Add(MoveTemp(Callback));
+}
+
+// --- Internal Functions ---
+
+void UAssetPreloadSubsystem::OnManifestStreamed()
+{
+	if (bPreloadComplete)
+	{
+		return;
+	}
+	bPreloadComplete = true;
+
+	// Resolved from the paths -- the handle may not have been returned yet if everything was resident
+	int32 MissingCount = 0;
+	for (int32 i = 0; i < UE_ARRAY_COUNT(Preload_AssetPaths); i++)
+	{
+		if (!ResolvedAssets[i])
+		{
+			ResolvedAssets[i] = Preload_AssetPaths[i].ResolveObject();
+		}
+		if (!ResolvedAssets[i])
+		{
+			UE_LOG(LogStateRunner_Arcade, Error, TEXT("AssetPreloadSubsystem: FAILED to load %s. Check that it is cooked."), *Preload_AssetPaths[i].ToString());
+			MissingCount++;
+		}
+	}
+
+	DefaultMusicTracks.Reset();
+	for (const FSoftObjectPath& Path : Preload_MusicTrackPaths)
+	{
+		if (USoundBase* Track = Cast<USoundBase>(Path.ResolveObject()))
+		{
+			DefaultMusicTracks.Add(Track);
+		}
+		else
+		{
+			UE_LOG(LogStateRunner_Arcade, Error, TEXT("AssetPreloadSubsystem: FAILED to load track %s"), *Path.ToString());
+			MissingCount++;
+		}
+	}
+
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("AssetPreloadSubsystem: Manifest resident in %.1f ms (%d missing)"),
+		(FPlatformTime::Seconds() - PreloadStartTime) * 1000.0, MissingCount);
+
+	TArray<TFunction<void()>> Callbacks = MoveTemp(PendingCallbacks);
+	PendingCallbacks.Reset();
+	for (TFunction<void()>& Callback : Callbacks)
+	{
+		Callback();
+	}
+
+	OnPreloadComplete.Broadcast();
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Engine/StreamableManager.h"
+#include "AssetPreloadSubsystem.generated.h"
+
+class USoundBase;
+
+/**
+ * Assets in the boot preload manifest.
+ * Paths live in one table in AssetPreloadSubsystem.cpp -- add an entry there with each value here.
+ */
+enum class EPreloadAsset : uint8
+{
+	/** Sound mix the volume sliders override */
+	GameVolumeMix,
+
+	MasterSoundClass,
+	MusicSoundClass,
+	SFXSoundClass,
+
+	Count
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnAssetPreloadComplete);
+
+/**
+ * Asset Preload Subsystem
+ *
+ * Streams the boot preload manifest (audio mix and sound classes, default music tracks)
+ * asynchronously while the splash/intro is up, so subsystems and widgets get already
+ * resolved assets instead of each doing a synchronous LoadObject on first use.
+ *
+ * Consumers either wait with WhenPreloaded (subsystems that initialize at boot) or just call
+ * Get (screens opened later). Get still works before the stream finishes -- it falls back to
+ * a synchronous load and logs a warning, so a miss shows up as a warning rather than a bug.
+ *
+ * The streaming handle keeps every manifest asset resident for the whole session.
+ */
+UCLASS()
+class STATERUNNER_ARCADE_API UAssetPreloadSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	// --- Subsystem Lifecycle ---
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// --- Resolved Assets ---
+
+	/** Get a manifest asset (synchronous fallback if it hasn't streamed in yet) */
+	UObject* GetAsset(EPreloadAsset Asset);
+
+	template<typename T>
+	T* Get(EPreloadAsset Asset)
+	{
+		return Cast<T>(GetAsset(Asset));
+	}
+
+	/** Default music tracks, in manifest order (empty until the preload finishes) */
+	const TArray<TObjectPtr<USoundBase>>& GetDefaultMusicTracks() const { return DefaultMusicTracks; }
+
+	// --- Preload State ---
+
+	/** True once the whole manifest has streamed in */
+	UFUNCTION(BlueprintPure, Category="Preload")
+	bool IsPreloadComplete() const { return bPreloadComplete; }
+
+	/** 0..1 progress of the manifest stream (for a splash progress bar) */
+	UFUNCTION(BlueprintPure, Category="Preload")
+	float GetPreloadProgress() const;
+
+	/** Run Callback once the manifest is resident (immediately if it already is) */
+	void WhenPreloaded(TFunction<void()>&& Callback);
+
+	/** Fires once when the manifest is resident (e.g. to let the splash screen continue) */
+	UPROPERTY(BlueprintAssignable, Category="Preload")
+	FOnAssetPreloadComplete OnPreloadComplete;
+
+protected:
+
+	// --- Internal State ---
+
+	/** Resolved manifest assets, indexed by EPreloadAsset */
+	UPROPERTY()
+	TArray<TObjectPtr<UObject>> ResolvedAssets;
+
+	UPROPERTY()
+	TArray<TObjectPtr<USoundBase>> DefaultMusicTracks;
+
+	/** Keeps the manifest resident */
+	TSharedPtr<FStreamableHandle> PreloadHandle;
+
+	FStreamableManager StreamableManager;
+
+	/** Callbacks waiting for the manifest */
+	TArray<TFunction<void()>> PendingCallbacks;
+
+	bool bPreloadComplete = false;
+
+	/** FPlatformTime::Seconds() when streaming started (for the cold start log) */
+	double PreloadStartTime = 0.0;
+
+	// --- Internal Functions ---
+
+	/** Streaming completion: resolve the manifest and run the waiting callbacks */
+	void OnManifestStreamed();
+};
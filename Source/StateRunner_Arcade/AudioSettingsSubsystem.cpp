@@ -1,45 +1,56 @@
 #include "AudioSettingsSubsystem.h"
 #include "MusicPersistenceSubsystem.h"
+#include "ArcadeSaveSubsystem.h"
+#include "AssetPreloadSubsystem.h"
 #include "Sound/SoundMix.h"
 #include "Sound/SoundClass.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
 #include "GameFramework/GameUserSettings.h"
+#include "HAL/PlatformTime.h"
 #include "StateRunner_Arcade.h"
 
 // Graphics first-time defaults (must match SettingsMenuWidget)
 static const FString GraphicsConfigSection = TEXT("/Script/StateRunner_Arcade.GraphicsSettings");
 static const FString SettingsInitializedKey = TEXT("bSettingsInitialized");
 
-// --- Static Config Keys (must match SettingsMenuWidget) ---
+// How long after a mix change music finish events are held back
+// (SetSoundMixClassOverride can trigger false "track finished" callbacks)
+static constexpr double AudioSettings_FinishedSettleSeconds = 0.5;
+
+// --- Legacy Config Keys (volumes now live in the ArcadeSave record) ---
 
 const FString UAudioSettingsSubsystem::AudioConfigSection = TEXT("/Script/StateRunner_Arcade.AudioSettings");
 const FString UAudioSettingsSubsystem::MasterVolumeKey = TEXT("MasterVolume");
 const FString UAudioSettingsSubsystem::MusicVolumeKey = TEXT("MusicVolume");
 const FString UAudioSettingsSubsystem::SFXVolumeKey = TEXT("SFXVolume");
 
-// --- Asset Paths (prefixed to avoid Unity build collisions) ---
-
-static const TCHAR* Audio_SoundMixPath = TEXT("/Game/_DEVELOPER/Audio/SoundClasses/SM_GameVolume.SM_GameVolume");
-static const TCHAR* Audio_MasterSoundClassPath = TEXT("/Game/_DEVELOPER/Audio/SoundClasses/SClass_Master.SClass_Master");
-static const TCHAR* Audio_MusicSoundClassPath = TEXT("/Game/_DEVELOPER/Audio/SoundClasses/SClass_Music.SClass_Music");
-static const TCHAR* Audio_SFXSoundClassPath = TEXT("/Game/_DEVELOPER/Audio/SoundClasses/SClass_SFX.SClass_SFX");
-
 // --- Subsystem Lifecycle ---
 
 void UAudioSettingsSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 
-	UE_LOG(LogStateRunner_Arcade, Log, TEXT("AudioSettingsSubsystem: Initializing..."));
+	// Saved volumes must be in memory before they're applied
+	Collection.InitializeDependency<UArcadeSaveSubsystem>();
 
-	// Load audio assets
-	LoadAudioAssets();
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("AudioSettingsSubsystem: Initializing..."));
 
-	// Try to apply audio settings immediately
+	// Mix and sound classes come from the boot preload; apply as soon as they're resident
 	// This may fail if world isn't ready yet, so we also schedule a delayed retry
-	ApplyAudioSettings();
+	if (UAssetPreloadSubsystem* Preload = Collection.InitializeDependency<UAssetPreloadSubsystem>())
+	{
+		TWeakObjectPtr<UAudioSettingsSubsystem> WeakThis(this);
+		Preload->WhenPreloaded([WeakThis]()
+		{
+			if (WeakThis.IsValid())
+			{
+				WeakThis->LoadAudioAssets();
+				WeakThis->ApplyAudioSettings();
+			}
+		});
+	}
 
 	// Register for level load events to reapply audio settings on every level change
 	PostLoadMapHandle = FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject(
@@ -60,10 +71,15 @@ void UAudioSettingsSubsystem::Deinitialize()
 		if (UWorld* World = GI->GetWorld())
 		{
 			World->GetTimerManager().ClearTimer(DelayedApplyTimerHandle);
-			World->GetTimerManager().ClearTimer(IgnoreFlagClearTimerHandle);
 		}
 	}
 
+	if (ApplyTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(ApplyTickerHandle);
+		ApplyTickerHandle.Reset();
+	}
+
 	// Unregister level load delegate
 	if (PostLoadMapHandle.IsValid())
 	{
@@ -80,31 +96,18 @@ void UAudioSettingsSubsystem::Deinitialize()
 
 void UAudioSettingsSubsystem::LoadAudioAssets()
 {
-	// Load Sound Mix
-	VolumeSoundMix = LoadObject<USoundMix>(nullptr, Audio_SoundMixPath);
-	if (!VolumeSoundMix)
-	{
-		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("AudioSettingsSubsystem: Failed to load SoundMix from %s"), Audio_SoundMixPath);
-	}
-
-	// Load Sound Classes
-	MasterSoundClass = LoadObject<USoundClass>(nullptr, Audio_MasterSoundClassPath);
-	if (!MasterSoundClass)
-	{
-		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("AudioSettingsSubsystem: Failed to load MasterSoundClass from %s"), Audio_MasterSoundClassPath);
-	}
-
-	MusicSoundClass = LoadObject<USoundClass>(nullptr, Audio_MusicSoundClassPath);
-	if (!MusicSoundClass)
+	// Resolved by the preload manifest (missing assets are reported there)
+	UAssetPreloadSubsystem* Preload = GetGameInstance()->GetSubsystem<UAssetPreloadSubsystem>();
+	if (!Preload)
 	{
-		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("AudioSettingsSubsystem: Failed to load MusicSoundClass from %s"), Audio_MusicSoundClassPath);
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("AudioSettingsSubsystem: No AssetPreloadSubsystem available"));
+		return;
 	}
 
-	SFXSoundClass = LoadObject<USoundClass>(nullptr, Audio_SFXSoundClassPath);
-	if (!SFXSoundClass)
-	{
-		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("AudioSettingsSubsystem: Failed to load SFXSoundClass from %s"), Audio_SFXSoundClassPath);
-	}
+	VolumeSoundMix = Preload->Get<USoundMix>(EPreloadAsset::GameVolumeMix);
+	MasterSoundClass = Preload->Get<USoundClass>(EPreloadAsset::MasterSoundClass);
+	MusicSoundClass = Preload->Get<USoundClass>(EPreloadAsset::MusicSoundClass);
+	SFXSoundClass = Preload->Get<USoundClass>(EPreloadAsset::SFXSoundClass);
 
 	UE_LOG(LogStateRunner_Arcade, Log, TEXT("AudioSettingsSubsystem: Audio assets loaded - SoundMix: %s, Master: %s, Music: %s, SFX: %s"),
 		VolumeSoundMix ? TEXT("OK") : TEXT("MISSING"),
@@ -117,67 +120,60 @@ void UAudioSettingsSubsystem::LoadAudioAssets()
 
 void UAudioSettingsSubsystem::ApplyAudioSettings()
 {
-	float MasterVol, MusicVol, SFXVol;
-	GetVolumeSettings(MasterVol, MusicVol, SFXVol);
+	// Saved volumes replace any uncommitted preview
+	GetVolumeSettings(TargetVolumes[0], TargetVolumes[1], TargetVolumes[2]);
+	bHasUncommittedVolumes = false;
 
 	UE_LOG(LogStateRunner_Arcade, Log, TEXT("AudioSettingsSubsystem: Applying audio settings - Master: %.0f%%, Music: %.0f%%, SFX: %.0f%%"),
-		MasterVol * 100.0f, MusicVol * 100.0f, SFXVol * 100.0f);
+		TargetVolumes[0] * 100.0f, TargetVolumes[1] * 100.0f, TargetVolumes[2] * 100.0f);
 
-	// Get a valid world context (subsystems don't have direct world access)
-	UWorld* World = nullptr;
-	UGameInstance* GI = GetGameInstance();
-	if (GI)
-	{
-		World = GI->GetWorld();
-	}
-	if (!World)
-	{
-		World = GEngine->GetCurrentPlayWorld();
-	}
-	
-	if (!World)
+	// Immediately rather than next frame -- level loads need it before audio starts
+	FlushVolumes(true);
+}
+
+void UAudioSettingsSubsystem::PreviewVolume(EAudioVolumeChannel Channel, float Volume)
+{
+	const int32 ChannelIndex = static_cast<int32>(Channel);
+	if (ChannelIndex >= NumVolumeChannels)
 	{
-		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("AudioSettingsSubsystem: No world available for audio settings"));
 		return;
 	}
 
-	// Tell the music subsystem to ignore OnAudioFinished during volume adjustment
-	// (SetSoundMixClassOverride can trigger false "track finished" callbacks)
-	UMusicPersistenceSubsystem* MusicSubsystem = GI ? GI->GetSubsystem<UMusicPersistenceSubsystem>() : nullptr;
-	if (MusicSubsystem)
+	TargetVolumes[ChannelIndex] = FMath::Clamp(Volume, 0.0f, 1.0f);
+	bHasUncommittedVolumes = true;
+
+	// Every slider tick this frame lands in the same update
+	if (!ApplyTickerHandle.IsValid())
 	{
-		MusicSubsystem->SetIgnoreAudioFinished(true);
-		
-		// Clear any existing re-enable timer (we'll set a new one after this apply)
-		World->GetTimerManager().ClearTimer(IgnoreFlagClearTimerHandle);
+		ApplyTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &UAudioSettingsSubsystem::HandleApplyTick));
 	}
+}
+
+void UAudioSettingsSubsystem::CommitVolumes()
+{
+	FlushVolumes(false);
 
-	// Push the sound mix first (required for SetSoundMixClassOverride to work)
-	if (VolumeSoundMix)
+	if (!bHasUncommittedVolumes)
 	{
-		UGameplayStatics::PushSoundMixModifier(World, VolumeSoundMix);
-		UE_LOG(LogStateRunner_Arcade, Log, TEXT("AudioSettingsSubsystem: Pushed SoundMix %s"), *VolumeSoundMix->GetName());
+		return;
 	}
 
-	// Apply volume to each sound class
-	ApplyVolumeToSoundClass(World, MasterSoundClass, MasterVol);
-	ApplyVolumeToSoundClass(World, MusicSoundClass, MusicVol);
-	ApplyVolumeToSoundClass(World, SFXSoundClass, SFXVol);
-
-	// Re-enable OnAudioFinished after a longer delay to allow the audio system to settle
-	// Using a member timer handle ensures subsequent ApplyAudioSettings calls reset the timer
-	// (prevents early re-enable if multiple applies happen in quick succession)
-	if (MusicSubsystem)
+	if (UArcadeSaveSubsystem* Saves = GetGameInstance()->GetSubsystem<UArcadeSaveSubsystem>())
 	{
-		TWeakObjectPtr<UMusicPersistenceSubsystem> WeakMusicSubsystem = MusicSubsystem;
-		World->GetTimerManager().SetTimer(IgnoreFlagClearTimerHandle, [WeakMusicSubsystem]()
-		{
-			if (WeakMusicSubsystem.IsValid())
-			{
-				WeakMusicSubsystem->SetIgnoreAudioFinished(false);
-			}
-		}, 0.5f, false);  // Extended from 0.1s to 0.5s for more safety margin
+		Saves->SetVolumes(TargetVolumes[0], TargetVolumes[1], TargetVolumes[2]);
+		Saves->Flush();
 	}
+	bHasUncommittedVolumes = false;
+
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("AudioSettingsSubsystem: Volumes committed - Master: %.0f%%, Music: %.0f%%, SFX: %.0f%%"),
+		TargetVolumes[0] * 100.0f, TargetVolumes[1] * 100.0f, TargetVolumes[2] * 100.0f);
+}
+
+float UAudioSettingsSubsystem::GetVolume(EAudioVolumeChannel Channel) const
+{
+	const int32 ChannelIndex = static_cast<int32>(Channel);
+	return ChannelIndex < NumVolumeChannels ? TargetVolumes[ChannelIndex] : 0.0f;
 }
 
 void UAudioSettingsSubsystem::GetVolumeSettings(float& OutMasterVolume, float& OutMusicVolume, float& OutSFXVolume) const
@@ -187,10 +183,11 @@ void UAudioSettingsSubsystem::GetVolumeSettings(float& OutMasterVolume, float& O
 	OutMusicVolume = DefaultMusicVolume;
 	OutSFXVolume = DefaultSFXVolume;
 
-	// Try to load saved settings (overrides defaults if they exist)
-	GConfig->GetFloat(*AudioConfigSection, *MasterVolumeKey, OutMasterVolume, GGameUserSettingsIni);
-	GConfig->GetFloat(*AudioConfigSection, *MusicVolumeKey, OutMusicVolume, GGameUserSettingsIni);
-	GConfig->GetFloat(*AudioConfigSection, *SFXVolumeKey, OutSFXVolume, GGameUserSettingsIni);
+	// Saved settings override the defaults (held in memory by the save subsystem)
+	if (const UArcadeSaveSubsystem* Saves = GetGameInstance()->GetSubsystem<UArcadeSaveSubsystem>())
+	{
+		Saves->GetVolumes(OutMasterVolume, OutMusicVolume, OutSFXVolume);
+	}
 }
 
 void UAudioSettingsSubsystem::ApplyAudioSettingsStatic(const UObject* WorldContextObject)
@@ -228,6 +225,107 @@ void UAudioSettingsSubsystem::ApplyAudioSettingsStatic(const UObject* WorldConte
 
 // --- Internal ---
 
+void UAudioSettingsSubsystem::FlushVolumes(bool bForce)
+{
+	UWorld* World = GetAudioWorld();
+	if (!World)
+	{
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("AudioSettingsSubsystem: No world available for audio settings"));
+		return;
+	}
+
+	// Push the sound mix first (required for SetSoundMixClassOverride to work); once per world,
+	// since every push stacks another reference on the mix
+	if (VolumeSoundMix && MixPushedWorld.Get() != World)
+	{
+		UGameplayStatics::PushSoundMixModifier(World, VolumeSoundMix);
+		MixPushedWorld = World;
+		bForce = true;
+		UE_LOG(LogStateRunner_Arcade, Log, TEXT("AudioSettingsSubsystem: Pushed SoundMix %s"), *VolumeSoundMix->GetName());
+	}
+
+	bool bAnyChanged = false;
+	for (int32 i = 0; i < NumVolumeChannels; i++)
+	{
+		bAnyChanged |= bForce || AppliedVolumes[i] != TargetVolumes[i];
+	}
+	if (!bAnyChanged)
+	{
+		return;
+	}
+
+	// Tell the music subsystem to ignore OnAudioFinished while the mix settles; further
+	// changes just push the end of the window out
+	if (UMusicPersistenceSubsystem* MusicSubsystem = GetGameInstance()->GetSubsystem<UMusicPersistenceSubsystem>())
+	{
+		MusicSubsystem->SetIgnoreAudioFinished(true);
+		IgnoreFinishedUntil = FPlatformTime::Seconds() + AudioSettings_FinishedSettleSeconds;
+
+		if (!ApplyTickerHandle.IsValid())
+		{
+			ApplyTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+				FTickerDelegate::CreateUObject(this, &UAudioSettingsSubsystem::HandleApplyTick));
+		}
+	}
+
+	for (int32 i = 0; i < NumVolumeChannels; i++)
+	{
+		if (bForce || AppliedVolumes[i] != TargetVolumes[i])
+		{
+			ApplyVolumeToSoundClass(World, GetSoundClass(i), TargetVolumes[i]);
+			AppliedVolumes[i] = TargetVolumes[i];
+		}
+	}
+}
+
+bool UAudioSettingsSubsystem::HandleApplyTick(float DeltaTime)
+{
+	FlushVolumes(false);
+
+	if (IgnoreFinishedUntil > 0.0 && FPlatformTime::Seconds() >= IgnoreFinishedUntil)
+	{
+		IgnoreFinishedUntil = 0.0;
+		if (UMusicPersistenceSubsystem* MusicSubsystem = GetGameInstance()->GetSubsystem<UMusicPersistenceSubsystem>())
+		{
+			MusicSubsystem->SetIgnoreAudioFinished(false);
+		}
+	}
+
+	if (IgnoreFinishedUntil > 0.0)
+	{
+		return true;
+	}
+
+	ApplyTickerHandle.Reset();
+	return false;
+}
+
+USoundClass* UAudioSettingsSubsystem::GetSoundClass(int32 ChannelIndex) const
+{
+	switch (static_cast<EAudioVolumeChannel>(ChannelIndex))
+	{
+	case EAudioVolumeChannel::Master: return MasterSoundClass;
+	case EAudioVolumeChannel::Music:  return MusicSoundClass;
+	case EAudioVolumeChannel::SFX:    return SFXSoundClass;
+	default:                          return nullptr;
+	}
+}
+
+UWorld* UAudioSettingsSubsystem::GetAudioWorld() const
+{
+	// Subsystems don't have direct world access
+	UWorld* World = nullptr;
+	if (UGameInstance* GI = GetGameInstance())
+	{
+		World = GI->GetWorld();
+	}
+	if (!World && GEngine)
+	{
+		World = GEngine->GetCurrentPlayWorld();
+	}
+	return World;
+}
+
 void UAudioSettingsSubsystem::ApplyVolumeToSoundClass(UWorld* World, USoundClass* SoundClass, float Volume)
 {
 	if (!World)
@@ -294,17 +392,7 @@ void UAudioSettingsSubsystem::OnPostLoadMapWithWorld(UWorld* LoadedWorld)
 
 void UAudioSettingsSubsystem::ScheduleDelayedApply()
 {
-	UWorld* World = nullptr;
-	if (UGameInstance* GI = GetGameInstance())
-	{
-		World = GI->GetWorld();
-	}
-	if (!World)
-	{
-		World = GEngine->GetCurrentPlayWorld();
-	}
-
-	if (World)
+	if (UWorld* World = GetAudioWorld())
 	{
 		// Clear any existing timer
 		World->GetTimerManager().ClearTimer(DelayedApplyTimerHandle);
@@ -2,11 +2,21 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Containers/Ticker.h"
 #include "AudioSettingsSubsystem.generated.h"
 
 class USoundMix;
 class USoundClass;
 
+/** Volume channels driven by the settings sliders */
+UENUM(BlueprintType)
+enum class EAudioVolumeChannel : uint8
+{
+	Master,
+	Music,
+	SFX
+};
+
 /**
  * Audio Settings Subsystem
  * 
@@ -17,6 +27,10 @@ class USoundClass;
  * 
  * Volume gets applied BEFORE any audio plays, not just when
  * the Settings menu is opened.
+ *
+ * Slider drags go through PreviewVolume: changes are coalesced into one mix update per frame
+ * (only the channels that moved, with the mix pushed once per world), and nothing is written
+ * to the save record until CommitVolumes.
  */
 UCLASS()
 class STATERUNNER_ARCADE_API UAudioSettingsSubsystem : public UGameInstanceSubsystem
@@ -30,7 +44,7 @@ public:
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
 
-	// --- Config Keys (must match SettingsMenuWidget) ---
+	// --- Legacy Config Keys (read once by UArcadeSaveSubsystem to migrate older installs) ---
 
 	static const FString AudioConfigSection;
 	static const FString MasterVolumeKey;
@@ -65,6 +79,21 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Audio", meta=(WorldContext="WorldContextObject"))
 	static void ApplyAudioSettingsStatic(const UObject* WorldContextObject);
 
+	/**
+	 * Fast path for slider drags: queue a volume for this frame's mix update.
+	 * Never touches the save record -- call CommitVolumes when the change is final.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Audio")
+	void PreviewVolume(EAudioVolumeChannel Channel, float Volume);
+
+	/** Apply anything still queued and persist the previewed volumes */
+	UFUNCTION(BlueprintCallable, Category="Audio")
+	void CommitVolumes();
+
+	/** Volume last requested for a channel (previewed or saved) */
+	UFUNCTION(BlueprintPure, Category="Audio")
+	float GetVolume(EAudioVolumeChannel Channel) const;
+
 protected:
 
 	// --- Audio Assets (loaded from paths) ---
@@ -85,11 +114,45 @@ protected:
 	UPROPERTY()
 	TObjectPtr<USoundClass> SFXSoundClass;
 
+	// --- Volume State ---
+
+	static constexpr int32 NumVolumeChannels = 3;
+
+	/** Latest requested volume per EAudioVolumeChannel */
+	float TargetVolumes[NumVolumeChannels] = { DefaultMasterVolume, DefaultMusicVolume, DefaultSFXVolume };
+
+	/** Volume last written to the mix per channel (negative = never applied) */
+	float AppliedVolumes[NumVolumeChannels] = { -1.0f, -1.0f, -1.0f };
+
+	/** Previewed volumes differ from the save record */
+	bool bHasUncommittedVolumes = false;
+
+	/** World the volume mix was last pushed to (pushed again after a map change) */
+	TWeakObjectPtr<UWorld> MixPushedWorld;
+
+	/** Drains queued volumes once per frame and closes the music finish window */
+	FTSTicker::FDelegateHandle ApplyTickerHandle;
+
+	/** FPlatformTime::Seconds() when music finish events are trusted again (0 = not ignoring) */
+	double IgnoreFinishedUntil = 0.0;
+
 	// --- Internal ---
 
-	/** Load audio assets from configured paths */
+	/** Take the mix and sound classes from the boot preload manifest */
 	void LoadAudioAssets();
 
+	/** Write changed channels to the mix (every channel when bForce) */
+	void FlushVolumes(bool bForce);
+
+	/** Per-frame apply; returns false (and unregisters) once there's nothing left to do */
+	bool HandleApplyTick(float DeltaTime);
+
+	/** Sound class for a channel */
+	USoundClass* GetSoundClass(int32 ChannelIndex) const;
+
+	/** World to apply the mix in (game instance world, else the current play world) */
+	UWorld* GetAudioWorld() const;
+
 	/** Apply volume to a specific sound class */
 	void ApplyVolumeToSoundClass(UWorld* World, USoundClass* SoundClass, float Volume);
 
@@ -104,7 +167,4 @@ protected:
 
 	/** Timer handle for delayed apply */
 	FTimerHandle DelayedApplyTimerHandle;
-
-	/** Timer handle for re-enabling OnAudioFinished in MusicPersistenceSubsystem */
-	FTimerHandle IgnoreFlagClearTimerHandle;
 };
@@ -0,0 +1,475 @@
+#include "AutopilotComponent.h"
+#include "StateRunner_ArcadeGameMode.h"
+#include "StateRunner_ArcadeCharacter.h"
+#include "ObstacleSpawnerComponent.h"
+#include "PickupSpawnerComponent.h"
+#include "WorldScrollComponent.h"
+#include "LivesSystemComponent.h"
+#include "OverclockSystemComponent.h"
+#include "GameDebugSubsystem.h"
+#include "RunSeedSubsystem.h"
+#include "SoakTestSubsystem.h"
+#include "BaseObstacle.h"
+#include "BasePickup.h"
+#include "Components/BoxComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "Kismet/GameplayStatics.h"
+#include "Kismet/KismetSystemLibrary.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "StateRunner_Arcade.h"
+
+UAutopilotComponent::UAutopilotComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+
+	// Decide before the runner moves this frame, like an input press would
+	PrimaryComponentTick.TickGroup = TG_PrePhysics;
+}
+
+void UAutopilotComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (Mode == EAutopilotMode::Off)
+	{
+		SetComponentTickEnabled(false);
+		return;
+	}
+
+	CacheReferences();
+	if (CachedLives)
+	{
+		CachedLives->OnDamageTaken.AddDynamic(this, &UAutopilotComponent::HandleDamageTaken);
+		CachedLives->OnPlayerDied.AddDynamic(this, &UAutopilotComponent::HandlePlayerDied);
+	}
+
+	// The level transition has already collected the previous run's world
+	if (Mode == EAutopilotMode::Soak)
+	{
+		if (USoakTestSubsystem* Soak = USoakTestSubsystem::Get(this))
+		{
+			Soak->RecordRunStart();
+		}
+	}
+}
+
+void UAutopilotComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UGameplaySimulationSubsystem* Simulation = UGameplaySimulationSubsystem::Get(this))
+	{
+		Simulation->ClearAllTimers(this);
+	}
+
+	if (CachedLives)
+	{
+		CachedLives->OnDamageTaken.RemoveDynamic(this, &UAutopilotComponent::HandleDamageTaken);
+		CachedLives->OnPlayerDied.RemoveDynamic(this, &UAutopilotComponent::HandlePlayerDied);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UAutopilotComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	if (!CacheReferences() || !CachedWorldScroll || !CachedObstacleSpawner)
+	{
+		return;
+	}
+
+	// Intro, countdown and death all hold input off -- wait them out like a player would
+	if (!CachedRunner->IsGameplayInputEnabled())
+	{
+		return;
+	}
+
+	if ((Mode == EAutopilotMode::Benchmark || Mode == EAutopilotMode::Soak) && !bSessionStarted)
+	{
+		BeginSession();
+	}
+
+	const float RunnerTrackX = CachedWorldScroll->WorldToTrackX(CachedRunner->GetActorLocation().X);
+	UpdateMovement(RunnerTrackX, CachedWorldScroll->GetCurrentScrollSpeed());
+	UpdateOverclock();
+}
+
+// --- Public Functions ---
+
+void UAutopilotComponent::ApplyLaunchOptions(const FString& Options)
+{
+	FString ModeOption = UGameplayStatics::ParseOption(Options, TEXT("Autopilot"));
+	if (ModeOption.IsEmpty() && FParse::Param(FCommandLine::Get(), TEXT("Autopilot")))
+	{
+		ModeOption = TEXT("Benchmark");
+	}
+	if (ModeOption.IsEmpty() && FParse::Param(FCommandLine::Get(), TEXT("Soak")))
+	{
+		ModeOption = TEXT("Soak");
+	}
+
+	if (ModeOption.IsEmpty())
+	{
+		Mode = EAutopilotMode::Off;
+		return;
+	}
+
+	if (ModeOption.Equals(TEXT("Attract"), ESearchCase::IgnoreCase))
+	{
+		Mode = EAutopilotMode::Attract;
+	}
+	else if (ModeOption.Equals(TEXT("Soak"), ESearchCase::IgnoreCase))
+	{
+		Mode = EAutopilotMode::Soak;
+	}
+	else
+	{
+		Mode = EAutopilotMode::Benchmark;
+	}
+
+	if (Mode == EAutopilotMode::Benchmark)
+	{
+		SessionSeed = BenchmarkSeed;
+		SessionDuration = BenchmarkDuration;
+		FParse::Value(FCommandLine::Get(), TEXT("AutopilotSeed="), SessionSeed);
+		FParse::Value(FCommandLine::Get(), TEXT("AutopilotSeconds="), SessionDuration);
+
+		// The run seed drives every spawner stream; the global RNG covers what's left (camera shake)
+		if (URunSeedSubsystem* RunSeed = URunSeedSubsystem::Get(this))
+		{
+			RunSeed->SetNextRunSeed(SessionSeed);
+		}
+		FMath::RandInit(SessionSeed);
+		FMath::SRandInit(SessionSeed);
+
+		UE_LOG(LogStateRunner_Arcade, Display, TEXT("Autopilot: Benchmark session, seed %d, %.0f s"), SessionSeed, SessionDuration);
+	}
+	else if (Mode == EAutopilotMode::Soak)
+	{
+		// Every run keeps a fresh seed, so the soak covers as much content as it can
+		SessionDuration = SoakMaxRunSeconds;
+		if (USoakTestSubsystem* Soak = USoakTestSubsystem::Get(this))
+		{
+			Soak->BeginSoak();
+		}
+	}
+	else
+	{
+		UE_LOG(LogStateRunner_Arcade, Log, TEXT("Autopilot: Attract mode"));
+	}
+}
+
+bool UAutopilotComponent::HandlePlayerInput()
+{
+	if (Mode == EAutopilotMode::Attract)
+	{
+		if (!bLeavingAttract)
+		{
+			bLeavingAttract = true;
+			UE_LOG(LogStateRunner_Arcade, Log, TEXT("Autopilot: Player input, leaving attract mode for %s"), *AttractExitLevelName.ToString());
+			UGameplayStatics::OpenLevel(this, AttractExitLevelName);
+		}
+		return true;
+	}
+
+	// A benchmark only stays reproducible (and a soak unattended) if nobody else is playing
+	return Mode == EAutopilotMode::Benchmark || Mode == EAutopilotMode::Soak;
+}
+
+// --- Internal Functions ---
+
+bool UAutopilotComponent::CacheReferences()
+{
+	if (!CachedObstacleSpawner || !CachedWorldScroll || !CachedLives)
+	{
+		if (AStateRunner_ArcadeGameMode* GameMode = Cast<AStateRunner_ArcadeGameMode>(GetOwner()))
+		{
+			CachedObstacleSpawner = GameMode->GetObstacleSpawnerComponent();
+			CachedPickupSpawner = GameMode->GetPickupSpawnerComponent();
+			CachedWorldScroll = GameMode->GetWorldScrollComponent();
+			CachedLives = GameMode->GetLivesSystemComponent();
+			CachedOverclock = GameMode->GetOverclockSystemComponent();
+		}
+	}
+
+	if (!CachedRunner)
+	{
+		CachedRunner = Cast<AStateRunner_ArcadeCharacter>(UGameplayStatics::GetPlayerPawn(this, 0));
+	}
+
+	return CachedRunner != nullptr;
+}
+
+void UAutopilotComponent::UpdateMovement(float RunnerTrackX, float ScrollSpeed)
+{
+	const float Speed = FMath::Max(ScrollSpeed, 1.0f);
+	const int32 CurrentLane = static_cast<int32>(CachedRunner->GetCurrentLane());
+
+	// Let go of a held jump/slide once what it was for is behind the runner
+	if (bHoldingJump && (RunnerTrackX > HoldClearTrackX || !CachedRunner->IsJumping()))
+	{
+		CachedRunner->EndJump();
+		bHoldingJump = false;
+	}
+	if (bHoldingSlide && (RunnerTrackX > HoldClearTrackX || !CachedRunner->IsSliding()))
+	{
+		CachedRunner->EndSlide();
+		bHoldingSlide = false;
+	}
+
+	// Mid-switch the runner's lane is the one it's leaving; decide again once it lands
+	if (CachedRunner->IsLaneSwitching())
+	{
+		return;
+	}
+
+	// --- Lane choice: room before the next FullWall in each lane ---
+
+	const float LaneRange = Speed * LaneLookAheadSeconds;
+	float LaneRoom[3];
+	for (int32 Lane = 0; Lane < 3; Lane++)
+	{
+		float NearEdge = 0.0f;
+		float FarEdge = 0.0f;
+		LaneRoom[Lane] = FindNextObstacle(Lane, RunnerTrackX, LaneRange, true, NearEdge, FarEdge) ? NearEdge : LaneRange;
+	}
+
+	if (LaneRoom[CurrentLane] < Speed * LaneSwitchLeadSeconds)
+	{
+		// Most room wins; on a tie the closer lane (fewer switches)
+		int32 BestLane = CurrentLane;
+		for (int32 Lane = 0; Lane < 3; Lane++)
+		{
+			const bool bMoreRoom = LaneRoom[Lane] > LaneRoom[BestLane] + KINDA_SMALL_NUMBER;
+			const bool bSameRoomCloser = FMath::IsNearlyEqual(LaneRoom[Lane], LaneRoom[BestLane]) && FMath::Abs(Lane - CurrentLane) < FMath::Abs(BestLane - CurrentLane);
+			if (bMoreRoom || bSameRoomCloser)
+			{
+				BestLane = Lane;
+			}
+		}
+
+		if (BestLane < CurrentLane)
+		{
+			CachedRunner->SwitchLaneLeft();
+			return;
+		}
+		if (BestLane > CurrentLane)
+		{
+			CachedRunner->SwitchLaneRight();
+			return;
+		}
+	}
+
+	// --- Jump / slide the next obstacle in this lane ---
+
+	float NearEdge = 0.0f;
+	float FarEdge = 0.0f;
+	const float ActionRange = Speed * FMath::Max(JumpLeadSeconds, SlideLeadSeconds);
+	if (const ABaseObstacle* Next = FindNextObstacle(CurrentLane, RunnerTrackX, ActionRange, false, NearEdge, FarEdge))
+	{
+		const EObstacleType Type = Next->GetObstacleType();
+		if (Type == EObstacleType::LowWall && NearEdge <= Speed * JumpLeadSeconds && !CachedRunner->IsJumping())
+		{
+			CachedRunner->StartJump();
+			bHoldingJump = CachedRunner->IsJumping();
+			HoldClearTrackX = FarEdge;
+		}
+		else if (Type == EObstacleType::HighBarrier && NearEdge <= Speed * SlideLeadSeconds && !CachedRunner->IsSliding())
+		{
+			// Mid-air this fast-falls into the slide
+			CachedRunner->StartSlide();
+			bHoldingSlide = true;
+			HoldClearTrackX = FarEdge;
+		}
+		return;
+	}
+
+	// --- Nothing to dodge: drift toward pickups ---
+
+	if (bCollectPickups && CachedPickupSpawner && !CachedRunner->IsJumping() && !CachedRunner->IsSliding() && !CachedRunner->IsFastFalling() && !HasPickupAhead(CurrentLane, RunnerTrackX, LaneRange))
+	{
+		for (const int32 Offset : { -1, 1 })
+		{
+			const int32 Lane = CurrentLane + Offset;
+			if (Lane >= 0 && Lane < 3 && LaneRoom[Lane] >= LaneRange && HasPickupAhead(Lane, RunnerTrackX, LaneRange))
+			{
+				Offset < 0 ? CachedRunner->SwitchLaneLeft() : CachedRunner->SwitchLaneRight();
+				return;
+			}
+		}
+	}
+}
+
+void UAutopilotComponent::UpdateOverclock()
+{
+	if (!CachedOverclock)
+	{
+		return;
+	}
+
+	if (!bHoldingOverclock)
+	{
+		if (CachedOverclock->CanActivateOverclock() && CachedOverclock->GetMeterPercent() >= OverclockActivateFraction)
+		{
+			CachedOverclock->OnOverclockKeyPressed();
+			bHoldingOverclock = true;
+		}
+	}
+	else if (!CachedOverclock->IsOverclockActive() || CachedOverclock->GetMeterPercent() <= OverclockReleaseFraction)
+	{
+		CachedOverclock->OnOverclockKeyReleased();
+		bHoldingOverclock = false;
+	}
+}
+
+ABaseObstacle* UAutopilotComponent::FindNextObstacle(int32 Lane, float RunnerTrackX, float Range, bool FullWallsOnly, float& OutNearEdge, float& OutFarEdge)
+{
+	const UCapsuleComponent* Capsule = CachedRunner->GetCapsuleComponent();
+	const float RunnerRadius = Capsule ? Capsule->GetScaledCapsuleRadius() : 0.0f;
+
+	// Start behind the runner so an obstacle it's still overlapping counts
+	LaneObstacles.Reset();
+	CachedObstacleSpawner->GetObstaclesInLaneRange(static_cast<ELane>(Lane), RunnerTrackX - DefaultObstacleHalfLength - RunnerRadius, RunnerTrackX + RunnerRadius + Range, LaneObstacles);
+
+	// Ascending X, so the first one still ahead is the next one
+	for (ABaseObstacle* Obstacle : LaneObstacles)
+	{
+		if (!IsValid(Obstacle) || !Obstacle->IsActive())
+		{
+			continue;
+		}
+		if (FullWallsOnly && Obstacle->GetObstacleType() != EObstacleType::FullWall)
+		{
+			continue;
+		}
+
+		const UBoxComponent* Box = Obstacle->GetCollisionBox();
+		const float CenterX = CachedWorldScroll->WorldToTrackX(Box ? Box->GetComponentLocation().X : Obstacle->GetActorLocation().X);
+		const float HalfLength = Box ? Box->GetScaledBoxExtent().X : DefaultObstacleHalfLength;
+
+		OutFarEdge = CenterX + HalfLength;
+		if (OutFarEdge + RunnerRadius < RunnerTrackX)
+		{
+			continue;
+		}
+
+		OutNearEdge = CenterX - HalfLength - RunnerRadius - RunnerTrackX;
+		return Obstacle;
+	}
+
+	return nullptr;
+}
+
+bool UAutopilotComponent::HasPickupAhead(int32 Lane, float RunnerTrackX, float Range) const
+{
+	for (const ABasePickup* Pickup : CachedPickupSpawner->GetActivePickups())
+	{
+		if (IsValid(Pickup) && static_cast<int32>(Pickup->GetCurrentLane()) == Lane)
+		{
+			const float Distance = CachedWorldScroll->WorldToTrackX(Pickup->GetActorLocation().X) - RunnerTrackX;
+			if (Distance > 0.0f && Distance <= Range)
+			{
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+void UAutopilotComponent::BeginSession()
+{
+	bSessionStarted = true;
+
+	UGameplaySimulationSubsystem* Simulation = UGameplaySimulationSubsystem::Get(this);
+	if (!Simulation)
+	{
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("Autopilot: No gameplay timeline, session will not end on its own"));
+		return;
+	}
+
+	TWeakObjectPtr<UAutopilotComponent> WeakThis(this);
+
+	if (Mode == EAutopilotMode::Soak)
+	{
+		// A run the autopilot survives indefinitely would stall the soak at one sample
+		Simulation->SetTimer(SessionTimer, this, [WeakThis]()
+		{
+			if (WeakThis.IsValid())
+			{
+				WeakThis->RestartLevel();
+			}
+		}, SessionDuration, false, EGameplayClock::Gameplay);
+		return;
+	}
+
+	// Gameplay clock: the session is N seconds of play, however long frames take
+	Simulation->SetTimer(SessionTimer, this, [WeakThis]()
+	{
+		if (WeakThis.IsValid())
+		{
+			WeakThis->FinishBenchmark();
+		}
+	}, SessionDuration, false, EGameplayClock::Gameplay);
+
+	UE_LOG(LogStateRunner_Arcade, Display, TEXT("Autopilot: Benchmark started"));
+}
+
+void UAutopilotComponent::RestartLevel()
+{
+	const FString LevelName = UGameplayStatics::GetCurrentLevelName(this);
+	const TCHAR* ModeOption = Mode == EAutopilotMode::Soak ? TEXT("Autopilot=Soak") : TEXT("Autopilot=Attract");
+	UGameplayStatics::OpenLevel(this, FName(*LevelName), true, ModeOption);
+}
+
+void UAutopilotComponent::FinishBenchmark()
+{
+	FString CsvPath;
+	if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
+	{
+		Debug->EndPerfRun();
+		CsvPath = Debug->GetLastPerfCsvPath();
+	}
+
+	UE_LOG(LogStateRunner_Arcade, Display, TEXT("Autopilot: Benchmark finished (seed %d, %.0f s, difficulty %d), perf CSV: %s"),
+		SessionSeed, SessionDuration, CachedObstacleSpawner ? CachedObstacleSpawner->GetCurrentDifficultyLevel() : 0,
+		CsvPath.IsEmpty() ? TEXT("(none)") : *CsvPath);
+
+	if (bQuitAfterBenchmark)
+	{
+		UKismetSystemLibrary::QuitGame(this, nullptr, EQuitPreference::Quit, false);
+	}
+}
+
+void UAutopilotComponent::HandleDamageTaken(int32 RemainingLives)
+{
+	// Refilled before the death check runs, so a bad dodge costs score, not the session
+	if (Mode == EAutopilotMode::Benchmark && CachedLives)
+	{
+		CachedLives->AddLives(1);
+	}
+}
+
+void UAutopilotComponent::HandlePlayerDied()
+{
+	if ((Mode != EAutopilotMode::Attract && Mode != EAutopilotMode::Soak) || bLeavingAttract)
+	{
+		return;
+	}
+
+	UGameplaySimulationSubsystem* Simulation = UGameplaySimulationSubsystem::Get(this);
+	if (!Simulation)
+	{
+		return;
+	}
+
+	// Real clock: the game over screen may pause the world
+	TWeakObjectPtr<UAutopilotComponent> WeakThis(this);
+	Simulation->SetTimer(SessionTimer, this, [WeakThis]()
+	{
+		if (WeakThis.IsValid() && !WeakThis->bLeavingAttract)
+		{
+			WeakThis->RestartLevel();
+		}
+	}, Mode == EAutopilotMode::Soak ? SoakRestartDelay : AttractRestartDelay, false, EGameplayClock::Real);
+}
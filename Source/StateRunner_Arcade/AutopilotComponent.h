@@ -0,0 +1,258 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "GameplaySimulationSubsystem.h"
+#include "AutopilotComponent.generated.h"
+
+class AStateRunner_ArcadeCharacter;
+class UObstacleSpawnerComponent;
+class UPickupSpawnerComponent;
+class UWorldScrollComponent;
+class ULivesSystemComponent;
+class UOverclockSystemComponent;
+class ABaseObstacle;
+
+/**
+ * What the autopilot is playing for.
+ */
+UENUM(BlueprintType)
+enum class EAutopilotMode : uint8
+{
+	/** Player has control */
+	Off			UMETA(DisplayName = "Off"),
+
+	/** Fixed seed, lives kept topped up, ends after BenchmarkDuration and writes the perf CSV */
+	Benchmark	UMETA(DisplayName = "Benchmark"),
+
+	/** Idle cabinet demo: plays until it dies, then loops; any player input returns to the menu */
+	Attract		UMETA(DisplayName = "Attract"),
+
+	/** Leak hunt: loops runs for hours, sampling memory at every restart (USoakTestSubsystem) */
+	Soak		UMETA(DisplayName = "Soak")
+};
+
+/**
+ * Autopilot Component
+ *
+ * Plays the run by reading the upcoming obstacles from the obstacle spawner's lane index:
+ * changes lane away from FullWalls (toward the lane with the most room, or a pickup when the
+ * lane is otherwise clear), jumps LowWalls, slides under HighBarriers and holds OVERCLOCK
+ * once the meter is full. It drives the runner through the same Start/End functions the
+ * input bindings use, so movement, collision and scoring are the real game code paths.
+ *
+ * Mode comes from the command line or the level URL:
+ * - "-Autopilot" (or ?Autopilot=Benchmark): perf benchmark. The run seed is set from
+ *   -AutopilotSeed=N (default BenchmarkSeed) before the spawners initialize, lives are
+ *   refilled on every hit, and after -AutopilotSeconds=N (default BenchmarkDuration) of
+ *   gameplay the perf run is closed (writing Saved/Profiling/RunPerf CSV) and the game quits.
+ * - ?Autopilot=Attract: opened by the main menu after it sits idle. Loops the level on game
+ *   over; the first player input opens AttractExitLevelName.
+ * - "-Soak" (or ?Autopilot=Soak): memory soak. Plays fresh-seeded runs without refilling
+ *   lives and reopens the level on game over or after SoakMaxRunSeconds, for -SoakHours=N;
+ *   USoakTestSubsystem samples memory at each restart and fails the soak on steady growth.
+ *
+ * Player presses are swallowed while it drives, and its runs never reach the high score or
+ * leaderboard. The benchmark is started on the gameplay map directly, e.g.
+ * "OVERCLOCKED_DDM_Game SR_OfficialTrack -Autopilot -AutopilotSeed=7".
+ *
+ * Attached to GameMode.
+ */
+UCLASS(ClassGroup=(StateRunner), meta=(BlueprintSpawnableComponent))
+class STATERUNNER_ARCADE_API UAutopilotComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+
+	UAutopilotComponent();
+
+protected:
+
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+public:
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	// --- Configuration ---
+
+protected:
+
+	/** Seconds of upcoming track scanned for FullWalls (lane choice) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Autopilot", meta=(ClampMin="0.2", ClampMax="5.0"))
+	float LaneLookAheadSeconds = 1.2f;
+
+	/** Change lane once a FullWall in the runner's lane is this close (seconds) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Autopilot", meta=(ClampMin="0.05", ClampMax="3.0"))
+	float LaneSwitchLeadSeconds = 0.6f;
+
+	/** Jump when a LowWall's near edge is this close (seconds) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Autopilot", meta=(ClampMin="0.0", ClampMax="1.0"))
+	float JumpLeadSeconds = 0.22f;
+
+	/** Slide when a HighBarrier's near edge is this close (seconds) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Autopilot", meta=(ClampMin="0.0", ClampMax="1.0"))
+	float SlideLeadSeconds = 0.18f;
+
+	/** Obstacle half-length used when an obstacle has no collision box */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Autopilot", meta=(ClampMin="0.0"))
+	float DefaultObstacleHalfLength = 100.0f;
+
+	/** Move toward pickups in a neighbouring lane when the runner's lane has nothing to dodge */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Autopilot")
+	bool bCollectPickups = true;
+
+	/** Activate OVERCLOCK at this meter fraction */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Autopilot", meta=(ClampMin="0.0", ClampMax="1.0"))
+	float OverclockActivateFraction = 1.0f;
+
+	/** Release OVERCLOCK below this meter fraction */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Autopilot", meta=(ClampMin="0.0", ClampMax="1.0"))
+	float OverclockReleaseFraction = 0.05f;
+
+	/** Benchmark seed when -AutopilotSeed isn't given */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Autopilot|Benchmark")
+	int32 BenchmarkSeed = 1;
+
+	/** Gameplay seconds a benchmark session runs when -AutopilotSeconds isn't given */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Autopilot|Benchmark", meta=(ClampMin="10.0"))
+	float BenchmarkDuration = 600.0f;
+
+	/** Quit once the benchmark has written its CSV */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Autopilot|Benchmark")
+	bool bQuitAfterBenchmark = true;
+
+	/** Level the first player input opens in attract mode */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Autopilot|Attract")
+	FName AttractExitLevelName = TEXT("SR_MainMenu");
+
+	/** Real seconds after an attract game over before the level restarts */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Autopilot|Attract", meta=(ClampMin="0.0"))
+	float AttractRestartDelay = 4.0f;
+
+	/** Gameplay seconds a soak run may last before the level is reopened anyway */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Autopilot|Soak", meta=(ClampMin="10.0"))
+	float SoakMaxRunSeconds = 300.0f;
+
+	/** Real seconds after a soak game over before the level restarts */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Autopilot|Soak", meta=(ClampMin="0.0"))
+	float SoakRestartDelay = 1.0f;
+
+	// --- Runtime State ---
+
+protected:
+
+	EAutopilotMode Mode = EAutopilotMode::Off;
+
+	/** Seed applied for this session (benchmark only) */
+	int32 SessionSeed = 0;
+
+	/** Gameplay seconds the benchmark runs for */
+	float SessionDuration = 0.0f;
+
+	/** Benchmark / soak run clock started (first frame with gameplay input enabled) */
+	bool bSessionStarted = false;
+
+	/** Jump/slide being held over an obstacle; released once it's behind the runner */
+	bool bHoldingJump = false;
+	bool bHoldingSlide = false;
+	bool bHoldingOverclock = false;
+
+	/** Track X the held jump/slide has to clear */
+	float HoldClearTrackX = 0.0f;
+
+	/** Attract mode is already leaving the level */
+	bool bLeavingAttract = false;
+
+	FGameplayTimerHandle SessionTimer;
+
+	UPROPERTY()
+	TObjectPtr<AStateRunner_ArcadeCharacter> CachedRunner;
+
+	UPROPERTY()
+	TObjectPtr<UObstacleSpawnerComponent> CachedObstacleSpawner;
+
+	UPROPERTY()
+	TObjectPtr<UPickupSpawnerComponent> CachedPickupSpawner;
+
+	UPROPERTY()
+	TObjectPtr<UWorldScrollComponent> CachedWorldScroll;
+
+	UPROPERTY()
+	TObjectPtr<ULivesSystemComponent> CachedLives;
+
+	UPROPERTY()
+	TObjectPtr<UOverclockSystemComponent> CachedOverclock;
+
+	/** Scratch list for lane queries */
+	TArray<ABaseObstacle*> LaneObstacles;
+
+	// --- Public Functions ---
+
+public:
+
+	/**
+	 * Pick the mode from the command line / level options and queue the run seed for a
+	 * benchmark. Called by the GameMode before the run seed is picked.
+	 *
+	 * @param Options The GameMode's OptionsString
+	 */
+	void ApplyLaunchOptions(const FString& Options);
+
+	UFUNCTION(BlueprintPure, Category="Autopilot")
+	EAutopilotMode GetMode() const { return Mode; }
+
+	UFUNCTION(BlueprintPure, Category="Autopilot")
+	bool IsActive() const { return Mode != EAutopilotMode::Off; }
+
+	/**
+	 * A real player input arrived. In attract mode it returns to the menu.
+	 *
+	 * @return True if the input was used up (the runner should ignore it)
+	 */
+	bool HandlePlayerInput();
+
+	// --- Internal Functions ---
+
+protected:
+
+	/** Find the runner and GameMode systems. Returns false if the runner isn't available yet. */
+	bool CacheReferences();
+
+	/** Dodge, collect and release held moves for this frame */
+	void UpdateMovement(float RunnerTrackX, float ScrollSpeed);
+
+	/** Hold OVERCLOCK while the meter lasts */
+	void UpdateOverclock();
+
+	/**
+	 * Nearest obstacle in a lane whose far edge is still ahead of the runner.
+	 *
+	 * @param OutNearEdge Distance from the runner to its near edge (negative = already overlapping)
+	 * @param OutFarEdge Track X of its far edge
+	 * @param FullWallsOnly Skip obstacles that can be jumped or slid
+	 */
+	ABaseObstacle* FindNextObstacle(int32 Lane, float RunnerTrackX, float Range, bool FullWallsOnly, float& OutNearEdge, float& OutFarEdge);
+
+	/** True if a pickup is within Range ahead in Lane */
+	bool HasPickupAhead(int32 Lane, float RunnerTrackX, float Range) const;
+
+	/** Start the benchmark session or soak run clock on the first playable frame */
+	void BeginSession();
+
+	/** Reopen the current level in the same autopilot mode (attract / soak loop) */
+	void RestartLevel();
+
+	/** Benchmark time is up: close the perf run and quit */
+	void FinishBenchmark();
+
+	/** Lives system hit -- keep a benchmark session alive */
+	UFUNCTION()
+	void HandleDamageTaken(int32 RemainingLives);
+
+	/** Lives system death -- loop the attract / soak level */
+	UFUNCTION()
+	void HandlePlayerDied();
+};
@@ -2,16 +2,19 @@
 #include "Components/BoxComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "WorldScrollComponent.h"
+#include "ObstacleSpawnerComponent.h"
 #include "StateRunner_Arcade.h"
 #include "StateRunner_ArcadeGameMode.h"
+#include "LaneCollisionComponent.h"
+#include "RunSeedSubsystem.h"
+#include "SpawnTypeTraits.h"
+#include "VersusModeComponent.h"
 #include "Engine/Engine.h"
-#include "DrawDebugHelpers.h"
 
 ABaseObstacle::ABaseObstacle()
 {
-	// Enable ticking (but we'll disable when inactive for pooling)
-	PrimaryActorTick.bCanEverTick = true;
-	PrimaryActorTick.bStartWithTickEnabled = false; // Start disabled, enable on Activate()
+	// Scrolling, despawn and debug drawing are all batched elsewhere -- obstacles never tick
+	PrimaryActorTick.bCanEverTick = false;
 
 	// Create root component
 	RootSceneComponent = CreateDefaultSubobject<USceneComponent>(TEXT("RootSceneComponent"));
@@ -56,46 +59,17 @@ void ABaseObstacle::BeginPlay()
 		CollisionBox->OnComponentBeginOverlap.AddDynamic(this, &ABaseObstacle::OnCollisionOverlapBegin);
 	}
 
-	// Setup collision box based on configured extent
-	SetupCollisionBox();
-}
-
-void ABaseObstacle::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
-
-	// Only tick if active
-	if (!bIsActive)
-	{
-		return;
-	}
-
-	// Update position based on scroll speed
-	UpdateScrolling(DeltaTime);
-
-	// Debug: Draw collision box (persistent so visible when paused)
-	if (bDrawDebugCollision && CollisionBox)
+	// Analytic mode: the GameMode resolves contacts, so skip physics overlaps entirely
+	if (AStateRunner_ArcadeGameMode* GameMode = GetWorld() ? Cast<AStateRunner_ArcadeGameMode>(GetWorld()->GetAuthGameMode()) : nullptr)
 	{
-		FVector BoxCenter = CollisionBox->GetComponentLocation();
-		FVector BoxExtent = CollisionBox->GetScaledBoxExtent();
-		FColor DebugColor = FColor::Red;
-		
-		switch (ObstacleType)
+		if (ULaneCollisionComponent* LaneCollision = GameMode->GetLaneCollisionComponent())
 		{
-			case EObstacleType::LowWall: DebugColor = FColor::Orange; break;
-			case EObstacleType::HighBarrier: DebugColor = FColor::Purple; break;
-			case EObstacleType::FullWall: DebugColor = FColor::Red; break;
+			SetPhysicsOverlapsEnabled(!LaneCollision->IsAnalytic());
 		}
-		
-		// Use 0.1f duration so it persists when paused, and draw in front of geometry
-		DrawDebugBox(GetWorld(), BoxCenter, BoxExtent, DebugColor, false, 0.1f, 0, 4.0f);
 	}
 
-	// Check if should despawn
-	if (ShouldDespawn())
-	{
-		Deactivate();
-	}
+	// Setup collision box based on configured extent
+	SetupCollisionBox();
 }
 
 // --- Pooling Functions ---
@@ -105,25 +79,56 @@ void ABaseObstacle::Activate(const FVector& SpawnLocation, ELane Lane, EObstacle
 	// Set state
 	bIsActive = true;
 	bHasTriggeredDamage = false;
+	TriggeredSlotMask = 0;
 	CurrentLane = Lane;
 	ObstacleType = Type;
 
-	// Position the obstacle
-	SetActorLocation(SpawnLocation);
+	// Position the obstacle (SpawnLocation is track space -- offset applies in MoveRunner scroll mode)
+	if (!WorldScrollComponent)
+	{
+		CacheWorldScrollComponent();
+	}
+	FVector WorldLocation = SpawnLocation;
+	if (WorldScrollComponent)
+	{
+		WorldLocation.X = WorldScrollComponent->TrackToWorldX(SpawnLocation.X);
+	}
+	SetActorLocation(WorldLocation);
 
-	// Select random mesh variant (if variants are configured)
-	SelectRandomMeshVariant();
+	// Pooled obstacles are built with their variant -- just re-roll the yaw flip
+	if (bMeshVariantBound)
+	{
+		RandomizeVariantYawFlip();
+	}
+	else
+	{
+		SelectRandomMeshVariant();
+	}
 
-	// Make visible and enable collision
-	SetActorHiddenInGame(false);
-	SetActorEnableCollision(true);
+	// Far down the track: lowest LOD and no collision until the scroller promotes us.
+	// LOD is forced before registering so the proxy is built with it.
+	Significance = WorldScrollComponent ? WorldScrollComponent->GetSignificanceAt(SpawnLocation.X) : EScrollSignificance::Contact;
+	if (!bUseInstancedRendering)
+	{
+		UWorldScrollComponent::ApplySignificanceLOD(ObstacleMesh, Significance);
+	}
 
-	// Enable ticking
-	SetActorTickEnabled(true);
+	// Register after the move + mesh swap so proxies are created once, in place
+	ExitDormancy();
+
+	// Make visible and enable collision (analytic mode never needs it)
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(bUsePhysicsOverlaps && Significance == EScrollSignificance::Contact);
 
 	// Setup collision based on type (in case type changed)
 	SetupCollisionBox();
 
+	// Hand movement + despawn over to the batched scroller
+	if (WorldScrollComponent)
+	{
+		WorldScrollComponent->RegisterScrollable(this, this, DespawnXThreshold, Significance);
+	}
+
 }
 
 void ABaseObstacle::Deactivate()
@@ -131,19 +136,52 @@ void ABaseObstacle::Deactivate()
 	// Set state
 	bIsActive = false;
 	bHasTriggeredDamage = false;
+	TriggeredSlotMask = 0;
 
 	// Hide and disable collision
 	SetActorHiddenInGame(true);
 	SetActorEnableCollision(false);
 
-	// Disable ticking for performance
-	SetActorTickEnabled(false);
+	// Stop batched scrolling
+	if (WorldScrollComponent)
+	{
+		WorldScrollComponent->UnregisterScrollable(this);
+	}
+
+	// Back to the pool (also parks the instance slot in instanced mode)
+	if (OwningSpawner.IsValid())
+	{
+		OwningSpawner->ReturnObstacleToPool(this);
+	}
+
+	// Drop render/physics state before the move so it doesn't update either
+	EnterDormancy();
 
 	// Move to a safe pooled position
 	SetActorLocation(FVector(0.0f, 0.0f, -10000.0f));
 
 }
 
+void ABaseObstacle::SetSignificance(EScrollSignificance NewSignificance)
+{
+	if (NewSignificance == Significance)
+	{
+		return;
+	}
+
+	Significance = NewSignificance;
+	if (!bIsActive)
+	{
+		return;
+	}
+
+	if (!bUseInstancedRendering)
+	{
+		UWorldScrollComponent::ApplySignificanceLOD(ObstacleMesh, Significance);
+	}
+	SetActorEnableCollision(bUsePhysicsOverlaps && Significance == EScrollSignificance::Contact);
+}
+
 // --- Collision ---
 
 void ABaseObstacle::OnCollisionOverlapBegin(
@@ -153,70 +191,67 @@ void ABaseObstacle::OnCollisionOverlapBegin(
 	int32 OtherBodyIndex,
 	bool bFromSweep,
 	const FHitResult& SweepResult)
+{
+	HandlePlayerContact(OtherActor);
+}
+
+bool ABaseObstacle::HandlePlayerContact(AActor* PlayerActor)
 {
 	// Ignore if not active
 	if (!bIsActive)
 	{
-		return;
+		return false;
 	}
 
-	// Ignore if already triggered damage this activation
-	if (bHasTriggeredDamage)
+	// Check if it's the player (using tag-based detection)
+	if (!PlayerActor || !PlayerActor->ActorHasTag(TEXT("Player")))
 	{
-		return;
+		return false;
 	}
 
-	// Check if it's the player (using tag-based detection)
-	if (OtherActor && OtherActor->ActorHasTag(TEXT("Player")))
+	// Versus: each runner can hit it once, and a knocked-out runner not at all
+	UVersusModeComponent* Versus = UVersusModeComponent::Get(this);
+	const int32 Slot = Versus ? Versus->GetPlayerSlot(PlayerActor) : 0;
+	if (Versus && Versus->IsPlayerOut(Slot))
 	{
-		bHasTriggeredDamage = true;
-		HandlePlayerCollision(OtherActor);
+		return false;
 	}
-}
 
-void ABaseObstacle::HandlePlayerCollision_Implementation(AActor* PlayerActor)
-{
-	// Base implementation - child classes can override for special behavior
-	// Called when player overlaps the obstacle
-	
-	// Get obstacle type name for debug display
-	FString ObstacleTypeName;
-	switch (ObstacleType)
+	// Ignore if this runner already triggered damage this activation
+	const uint8 SlotBit = static_cast<uint8>(1 << Slot);
+	if (TriggeredSlotMask & SlotBit)
 	{
-		case EObstacleType::LowWall:    ObstacleTypeName = TEXT("LowWall (JUMP)"); break;
-		case EObstacleType::HighBarrier: ObstacleTypeName = TEXT("HighBarrier (SLIDE)"); break;
-		case EObstacleType::FullWall:   ObstacleTypeName = TEXT("FullWall (DODGE)"); break;
-		default:                        ObstacleTypeName = TEXT("Unknown"); break;
+		return false;
 	}
-	
-}
 
-// --- Scrolling ---
+	TriggeredSlotMask |= SlotBit;
+	bHasTriggeredDamage = true;
+
+	UVersusModeComponent::FContactScope ContactScope(Versus, Slot);
+	HandlePlayerCollision(PlayerActor);
+	return true;
+}
 
-void ABaseObstacle::UpdateScrolling(float DeltaTime)
+void ABaseObstacle::SetPhysicsOverlapsEnabled(bool bEnabled)
 {
-	// Get current scroll speed
-	if (!WorldScrollComponent)
+	bUsePhysicsOverlaps = bEnabled;
+
+	if (CollisionBox)
 	{
-		// Try to get it again if we lost the reference
-		CacheWorldScrollComponent();
-		if (!WorldScrollComponent)
-		{
-			return;
-		}
+		CollisionBox->SetGenerateOverlapEvents(bEnabled);
+		CollisionBox->SetCollisionEnabled(bEnabled ? ECollisionEnabled::QueryOnly : ECollisionEnabled::NoCollision);
 	}
 
-	float ScrollSpeed = WorldScrollComponent->GetCurrentScrollSpeed();
-	
-	// Move in NEGATIVE X direction (world scrolls toward player)
-	FVector CurrentLocation = GetActorLocation();
-	CurrentLocation.X -= ScrollSpeed * DeltaTime;
-	SetActorLocation(CurrentLocation);
+	if (!bEnabled)
+	{
+		SetActorEnableCollision(false);
+	}
 }
 
-bool ABaseObstacle::ShouldDespawn() const
+void ABaseObstacle::HandlePlayerCollision_Implementation(AActor* PlayerActor)
 {
-	return GetActorLocation().X < DespawnXThreshold;
+	// Base implementation - child classes can override for special behavior
+	// Called when player overlaps the obstacle
 }
 
 // --- Setup Functions ---
@@ -233,21 +268,14 @@ void ABaseObstacle::SetupCollisionBox()
 	// The collision box position set in the Blueprint editor is preserved
 	CollisionBox->SetWorldScale3D(FVector::OneVector);
 
-	switch (ObstacleType)
+	// Designer-set extent per type, indexed by EObstacleType
+	static constexpr FVector ABaseObstacle::* CollisionExtentByType[NumObstacleTypes] =
 	{
-		case EObstacleType::LowWall:
-			CollisionBox->SetBoxExtent(LowWallCollisionExtent);
-			break;
-
-		case EObstacleType::HighBarrier:
-			CollisionBox->SetBoxExtent(HighBarrierCollisionExtent);
-			break;
-
-		case EObstacleType::FullWall:
-			CollisionBox->SetBoxExtent(FullWallCollisionExtent);
-			break;
-	}
-
+		&ABaseObstacle::LowWallCollisionExtent,
+		&ABaseObstacle::HighBarrierCollisionExtent,
+		&ABaseObstacle::FullWallCollisionExtent
+	};
+	CollisionBox->SetBoxExtent(this->*CollisionExtentByType[static_cast<int32>(ObstacleType)]);
 }
 
 // --- Mesh Variants ---
@@ -257,11 +285,17 @@ void ABaseObstacle::SelectRandomMeshVariant()
 	// Skip if no variants configured - keep whatever mesh is already set
 	if (MeshVariants.Num() == 0)
 	{
+		// Instanced mode still needs to know what to draw
+		if (bUseInstancedRendering && ObstacleMesh)
+		{
+			InstancedMesh = ObstacleMesh->GetStaticMesh();
+			InstanceRelativeTransform = ObstacleMesh->GetRelativeTransform();
+		}
 		return;
 	}
 
 	// Select a random index from available variants
-	const int32 RandomIndex = FMath::RandRange(0, MeshVariants.Num() - 1);
+	const int32 RandomIndex = URunSeedSubsystem::GetStreamFor(this, ERunRandomStream::ObstacleVisuals).RandRange(0, MeshVariants.Num() - 1);
 	ApplyMeshVariant(RandomIndex);
 }
 
@@ -274,6 +308,19 @@ void ABaseObstacle::ApplyMeshVariant(int32 VariantIndex)
 
 	const FMeshVariantData& VariantData = MeshVariants[VariantIndex];
 
+	// Bound variants roll their flip per activation -- the pool prewarm runs on a frame budget
+	// and mustn't draw from the run's stream
+	bVariantYawFlipped = VariantData.bRandomizeYawFlip && !bMeshVariantBound
+		&& URunSeedSubsystem::GetStreamFor(this, ERunRandomStream::ObstacleVisuals).RandRange(0, 1) == 1;
+
+	// Instanced mode: just record what to draw -- no SetStaticMesh / render state churn
+	if (bUseInstancedRendering)
+	{
+		InstancedMesh = VariantData.Mesh ? VariantData.Mesh.Get() : ObstacleMesh->GetStaticMesh();
+		InstanceRelativeTransform = FTransform(GetVariantRotation(VariantData, bVariantYawFlipped), VariantData.LocationOffset, VariantData.Scale);
+		return;
+	}
+
 	if (VariantData.Mesh)
 	{
 		ObstacleMesh->SetStaticMesh(VariantData.Mesh);
@@ -284,19 +331,137 @@ void ABaseObstacle::ApplyMeshVariant(int32 VariantIndex)
 			ObstacleMesh->SetMaterial(i, nullptr);
 		}
 		
-		// Calculate rotation with optional random yaw flip
-		FRotator FinalRotation = VariantData.RotationOffset;
-		if (VariantData.bRandomizeYawFlip && FMath::RandBool())
-		{
-			FinalRotation.Yaw += 180.0f;
-		}
-		
-		ObstacleMesh->SetRelativeRotation(FinalRotation);
+		ObstacleMesh->SetRelativeRotation(GetVariantRotation(VariantData, bVariantYawFlipped));
 		ObstacleMesh->SetRelativeLocation(VariantData.LocationOffset);
 		ObstacleMesh->SetRelativeScale3D(VariantData.Scale);
 	}
 }
 
+void ABaseObstacle::BindMeshVariant(int32 VariantIndex)
+{
+	bMeshVariantBound = true;
+	BoundVariantIndex = MeshVariants.IsValidIndex(VariantIndex) ? VariantIndex : INDEX_NONE;
+
+	if (BoundVariantIndex == INDEX_NONE)
+	{
+		// Blueprint mesh -- instanced mode still needs to know what to draw
+		bVariantYawFlipped = false;
+		if (bUseInstancedRendering && ObstacleMesh)
+		{
+			InstancedMesh = ObstacleMesh->GetStaticMesh();
+			InstanceRelativeTransform = ObstacleMesh->GetRelativeTransform();
+		}
+		return;
+	}
+
+	ApplyMeshVariant(BoundVariantIndex);
+}
+
+FRotator ABaseObstacle::GetVariantRotation(const FMeshVariantData& VariantData, bool bYawFlipped)
+{
+	FRotator Rotation = VariantData.RotationOffset;
+	if (bYawFlipped)
+	{
+		Rotation.Yaw += 180.0f;
+	}
+	return Rotation;
+}
+
+void ABaseObstacle::RandomizeVariantYawFlip()
+{
+	if (!MeshVariants.IsValidIndex(BoundVariantIndex))
+	{
+		return;
+	}
+
+	const FMeshVariantData& VariantData = MeshVariants[BoundVariantIndex];
+	const bool bFlip = VariantData.bRandomizeYawFlip && URunSeedSubsystem::GetStreamFor(this, ERunRandomStream::ObstacleVisuals).RandRange(0, 1) == 1;
+	if (bFlip == bVariantYawFlipped)
+	{
+		return;
+	}
+	bVariantYawFlipped = bFlip;
+
+	const FRotator Rotation = GetVariantRotation(VariantData, bFlip);
+	if (bUseInstancedRendering)
+	{
+		InstanceRelativeTransform.SetRotation(Rotation.Quaternion());
+	}
+	else if (ObstacleMesh && VariantData.Mesh)
+	{
+		// Still dormant here (registered after), so this is just a relative transform update
+		ObstacleMesh->SetRelativeRotation(Rotation);
+	}
+}
+
+// --- Instanced Rendering ---
+
+void ABaseObstacle::EnableInstancedRendering()
+{
+	bUseInstancedRendering = true;
+
+	// The shared instance batch draws us from now on
+	if (ObstacleMesh)
+	{
+		ObstacleMesh->SetVisibility(false);
+	}
+}
+
+void ABaseObstacle::EnterDormancy()
+{
+	if (!bDormantWhenPooled || bIsDormant)
+	{
+		return;
+	}
+
+	if (DormantComponents.Num() == 0)
+	{
+		GetComponents<UPrimitiveComponent>(DormantComponents);
+	}
+
+	for (UPrimitiveComponent* Component : DormantComponents)
+	{
+		if (Component && Component->IsRegistered())
+		{
+			Component->UnregisterComponent();
+		}
+	}
+
+	bIsDormant = true;
+}
+
+void ABaseObstacle::ExitDormancy()
+{
+	if (!bIsDormant)
+	{
+		return;
+	}
+
+	for (UPrimitiveComponent* Component : DormantComponents)
+	{
+		if (!Component || Component->IsRegistered())
+		{
+			continue;
+		}
+
+		// Nothing to draw (instance batch does it) or collide with (analytic collision)
+		if ((bUseInstancedRendering && Component == ObstacleMesh) || (!bUsePhysicsOverlaps && Component == CollisionBox))
+		{
+			continue;
+		}
+
+		Component->RegisterComponent();
+	}
+
+	bIsDormant = false;
+}
+
+float ABaseObstacle::GetTrackX() const
+{
+	const float WorldX = GetActorLocation().X;
+	return WorldScrollComponent ? WorldScrollComponent->WorldToTrackX(WorldX) : WorldX;
+}
+
 void ABaseObstacle::CacheWorldScrollComponent()
 {
 	// Get GameMode and cache WorldScrollComponent reference
@@ -2,9 +2,11 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "WorldScrollable.h"
 #include "BaseObstacle.generated.h"
 
 class UWorldScrollComponent;
+class UObstacleSpawnerComponent;
 class UBoxComponent;
 class UStaticMeshComponent;
 
@@ -84,11 +86,29 @@ enum class ELane : uint8
 	Right		UMETA(DisplayName = "Right Lane")
 };
 
+/**
+ * How much of an active obstacle/pickup is live, by distance ahead of the runner.
+ * Set on Activate() and only ever promoted, by UWorldScrollComponent's scroll pass.
+ */
+UENUM(BlueprintType)
+enum class EScrollSignificance : uint8
+{
+	/** Lowest mesh LOD, no collision, no spin/bob */
+	Far			UMETA(DisplayName = "Far"),
+
+	/** Full detail and effects, still no collision */
+	Near		UMETA(DisplayName = "Near"),
+
+	/** Full fidelity, collision on */
+	Contact		UMETA(DisplayName = "Contact")
+};
+
 /**
  * Base Obstacle Actor
  * 
  * Parent class for all obstacles in the game.
- * Handles scrolling movement, collision detection, and object pooling.
+ * Handles collision detection and object pooling. Scrolling movement is
+ * driven by UWorldScrollComponent, which the obstacle registers with on Activate().
  * 
  * COORDINATE SYSTEM:
  * - X-axis: Length of track (scroll direction - NEGATIVE X)
@@ -104,7 +124,7 @@ enum class ELane : uint8
  * - Use Activate() and Deactivate() instead of Spawn/Destroy
  */
 UCLASS(Abstract)
-class STATERUNNER_ARCADE_API ABaseObstacle : public AActor
+class STATERUNNER_ARCADE_API ABaseObstacle : public AActor, public IWorldScrollable
 {
 	GENERATED_BODY()
 
@@ -118,10 +138,6 @@ protected:
 	/** Called when the game starts */
 	virtual void BeginPlay() override;
 
-public:
-
-	/** Called every frame */
-	virtual void Tick(float DeltaTime) override;
 
 	//=============================================================================
 	// COMPONENTS
@@ -189,7 +205,7 @@ protected:
 
 	/**
 	 * Select and apply a random mesh variant from MeshVariants array.
-	 * Called automatically during Activate().
+	 * Called during Activate() only for obstacles the spawner hasn't bound (see BindMeshVariant).
 	 * Applies the mesh and its associated transform adjustments.
 	 * If MeshVariants is empty, keeps the current mesh unchanged.
 	 */
@@ -200,6 +216,35 @@ protected:
 	UFUNCTION(BlueprintCallable, Category="Mesh Variants")
 	void ApplyMeshVariant(int32 VariantIndex);
 
+public:
+
+	/**
+	 * Bind this actor to one variant for its pooled lifetime (mesh, material reset, transform).
+	 * Called once by the spawner right after spawning; the spawner then picks a variant by
+	 * pulling from that variant's free list, so Activate() never swaps meshes or materials.
+	 * INDEX_NONE keeps the Blueprint mesh.
+	 */
+	void BindMeshVariant(int32 VariantIndex);
+
+	/** Variant bound by BindMeshVariant (INDEX_NONE = Blueprint mesh) */
+	int32 GetBoundVariantIndex() const { return BoundVariantIndex; }
+
+protected:
+
+	/** Set by BindMeshVariant; unbound obstacles still pick a variant per activation */
+	bool bMeshVariantBound = false;
+
+	int32 BoundVariantIndex = INDEX_NONE;
+
+	/** Current variant rotation includes the 180 degree yaw flip */
+	bool bVariantYawFlipped = false;
+
+	/** Variant rotation with the optional yaw flip */
+	static FRotator GetVariantRotation(const FMeshVariantData& VariantData, bool bYawFlipped);
+
+	/** Per-activation yaw flip for a bound variant (a rotation change only, and only when it flips) */
+	void RandomizeVariantYawFlip();
+
 	//=============================================================================
 	// COLLISION BOX CONFIGURATION (Per Obstacle Type)
 	// Edit EXTENT only - collision auto-centers on mesh position
@@ -229,7 +274,7 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Collision Config|FullWall")
 	float FullWallCollisionZ = 150.0f;
 
-	/** Enable debug drawing of collision box (visible in Play mode). */
+	/** Always draw this type's collision box in the debug collision pass (Debug.ToggleCollision draws every obstacle's). */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category="Collision Config|Debug")
 	bool bDrawDebugCollision = false;
 
@@ -241,12 +286,25 @@ protected:
 
 	/**
 	 * X position threshold for despawning (return to pool).
-	 * When obstacle X position goes below this, it's despawned.
+	 * When obstacle X position goes below this, UWorldScrollComponent despawns it.
 	 * Player is at X: -5000, so -8000 gives buffer behind player.
 	 */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Scrolling", meta=(ClampMax="-6000.0"))
 	float DespawnXThreshold = -8000.0f;
 
+	//=============================================================================
+	// POOLING CONFIGURATION
+	//=============================================================================
+
+protected:
+
+	/**
+	 * Unregister primitive components while pooled, so inactive obstacles have no render
+	 * proxy, physics body or broadphase entry. Activate() re-registers them.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Pooling")
+	bool bDormantWhenPooled = true;
+
 	//=============================================================================
 	// RUNTIME STATE
 	//=============================================================================
@@ -275,6 +333,25 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Category="Runtime")
 	bool bHasTriggeredDamage = false;
 
+	/** Versus player slots this obstacle has hit this activation (bit per slot; reset with bHasTriggeredDamage) */
+	uint8 TriggeredSlotMask = 0;
+
+	/**
+	 * Whether CollisionBox generates overlap events.
+	 * False when ULaneCollisionComponent resolves contacts analytically.
+	 */
+	bool bUsePhysicsOverlaps = true;
+
+	/** True while primitive components are unregistered (pooled) */
+	bool bIsDormant = false;
+
+	/** Distance tier for this activation (see SetSignificance) */
+	EScrollSignificance Significance = EScrollSignificance::Contact;
+
+	/** Primitive components toggled by dormancy (gathered on first use) */
+	UPROPERTY()
+	TArray<TObjectPtr<UPrimitiveComponent>> DormantComponents;
+
 	//=============================================================================
 	// POOLING FUNCTIONS
 	//=============================================================================
@@ -285,7 +362,7 @@ public:
 	 * Activate this obstacle from the pool.
 	 * Called by ObstacleSpawnerComponent when spawning an obstacle.
 	 * 
-	 * @param SpawnLocation World location to place the obstacle
+	 * @param SpawnLocation Track-space location (world location in MoveWorld scroll mode)
 	 * @param Lane Which lane the obstacle is in
 	 * @param Type Type of obstacle (for reconfiguration if needed)
 	 */
@@ -307,6 +384,98 @@ public:
 	UFUNCTION(BlueprintPure, Category="Pooling")
 	bool IsActive() const { return bIsActive; }
 
+	/**
+	 * Move to a new distance tier. Far pins ObstacleMesh to its lowest LOD (not in
+	 * instanced mode -- the batch picks LODs itself) and keeps collision off until Contact.
+	 * Called by UWorldScrollComponent as the obstacle closes on the runner.
+	 */
+	void SetSignificance(EScrollSignificance NewSignificance);
+
+	/** Current distance tier */
+	EScrollSignificance GetSignificance() const { return Significance; }
+
+	//=============================================================================
+	// POOL BOOKKEEPING
+	// Indices are owned by TActorPool / TActiveActorList (ActorPool.h) and UWorldScrollComponent
+	//=============================================================================
+
+public:
+
+	/** Spawner whose pool this obstacle belongs to. Deactivate() returns us to it. */
+	void SetOwningSpawner(UObstacleSpawnerComponent* InSpawner) { OwningSpawner = InSpawner; }
+
+	int32 GetPoolSlotIndex() const { return PoolSlotIndex; }
+	void SetPoolSlotIndex(int32 InIndex) { PoolSlotIndex = InIndex; }
+
+	int32 GetActiveListIndex() const { return ActiveListIndex; }
+	void SetActiveListIndex(int32 InIndex) { ActiveListIndex = InIndex; }
+
+	// IWorldScrollable
+	virtual int32 GetScrollEntryIndex() const override { return ScrollEntryIndex; }
+	virtual void SetScrollEntryIndex(int32 InIndex) override { ScrollEntryIndex = InIndex; }
+
+protected:
+
+	/** Owning spawner (null for obstacles placed by hand) */
+	TWeakObjectPtr<UObstacleSpawnerComponent> OwningSpawner;
+
+	/** Slot in the owning TActorPool */
+	int32 PoolSlotIndex = INDEX_NONE;
+
+	/** Index in the spawner's active list */
+	int32 ActiveListIndex = INDEX_NONE;
+
+	/** Index in the world scroller's entry list */
+	int32 ScrollEntryIndex = INDEX_NONE;
+
+	//=============================================================================
+	// INSTANCED RENDERING
+	// When the spawner uses instanced rendering, ObstacleMesh stays hidden and the
+	// chosen variant is drawn through a shared ISM owned by UObstacleSpawnerComponent.
+	//=============================================================================
+
+public:
+
+	/**
+	 * Switch this obstacle to instanced rendering (hides ObstacleMesh).
+	 * Called once by the spawner when the actor is added to a pool.
+	 * Instance batches live on the owning spawner (see SetOwningSpawner).
+	 */
+	void EnableInstancedRendering();
+
+	/** Whether this obstacle is drawn through an instance batch */
+	bool IsUsingInstancedRendering() const { return bUseInstancedRendering; }
+
+	/** Mesh picked for the current activation (instanced mode only) */
+	UStaticMesh* GetInstancedMesh() const { return InstancedMesh; }
+
+	/** World transform the instance should be drawn at (variant offset applied) */
+	FTransform GetInstanceWorldTransform() const { return InstanceRelativeTransform * GetActorTransform(); }
+
+	/** Record the batch/instance slot assigned by the spawner (INDEX_NONE when released) */
+	void SetInstanceSlot(int32 BatchIndex, int32 InstanceIndex) { InstanceBatchIndex = BatchIndex; InstanceSlotIndex = InstanceIndex; }
+
+	int32 GetInstanceBatchIndex() const { return InstanceBatchIndex; }
+	int32 GetInstanceSlotIndex() const { return InstanceSlotIndex; }
+
+protected:
+
+	/** True once EnableInstancedRendering() has been called */
+	bool bUseInstancedRendering = false;
+
+	/** Mesh for the current activation (instanced mode) */
+	UPROPERTY()
+	TObjectPtr<UStaticMesh> InstancedMesh;
+
+	/** Variant offset/rotation/scale relative to the actor (instanced mode) */
+	FTransform InstanceRelativeTransform = FTransform::Identity;
+
+	/** Assigned instance batch, or INDEX_NONE */
+	int32 InstanceBatchIndex = INDEX_NONE;
+
+	/** Assigned instance index within the batch, or INDEX_NONE */
+	int32 InstanceSlotIndex = INDEX_NONE;
+
 	//=============================================================================
 	// GETTERS
 	//=============================================================================
@@ -321,10 +490,46 @@ public:
 	UFUNCTION(BlueprintPure, Category="Obstacle")
 	ELane GetCurrentLane() const { return CurrentLane; }
 
+	/** Get the X position below which this obstacle despawns */
+	float GetDespawnXThreshold() const { return DespawnXThreshold; }
+
+	/** Actor X in track space (player-relative). Equals world X in MoveWorld scroll mode. */
+	float GetTrackX() const;
+
+	/** Collision box (also used for the analytic contact test) */
+	UBoxComponent* GetCollisionBox() const { return CollisionBox; }
+
+	/** True if this obstacle asks for its collision box to be drawn */
+	bool IsDrawingDebugCollision() const { return bDrawDebugCollision; }
+
+	/** Visible mesh component (default mesh and Blueprint material overrides) */
+	UStaticMeshComponent* GetObstacleMesh() const { return ObstacleMesh; }
+
+	/** Configured mesh variants (read from the class default object for precaching) */
+	const TArray<FMeshVariantData>& GetMeshVariants() const { return MeshVariants; }
+
 	//=============================================================================
 	// COLLISION
 	//=============================================================================
 
+public:
+
+	/**
+	 * Register contact with the player. Shared by the overlap handler and ULaneCollisionComponent.
+	 * Triggers HandlePlayerCollision at most once per runner per activation (versus runners share
+	 * the obstacle), with the GameMode's per-player getters routed to that runner.
+	 * 
+	 * @param PlayerActor Actor touching the obstacle (ignored unless tagged "Player")
+	 * @return True if this call triggered the collision
+	 */
+	bool HandlePlayerContact(AActor* PlayerActor);
+
+	/**
+	 * Turn CollisionBox overlap generation on or off.
+	 * Off when contacts are resolved analytically (no physics-scene cost while scrolling).
+	 */
+	void SetPhysicsOverlapsEnabled(bool bEnabled);
+
 protected:
 
 	/**
@@ -349,25 +554,6 @@ protected:
 	UFUNCTION(BlueprintNativeEvent, Category="Collision")
 	void HandlePlayerCollision(AActor* PlayerActor);
 
-	//=============================================================================
-	// SCROLLING
-	//=============================================================================
-
-protected:
-
-	/**
-	 * Update obstacle position based on scroll speed.
-	 * Moves in NEGATIVE X direction.
-	 */
-	virtual void UpdateScrolling(float DeltaTime);
-
-	/**
-	 * Check if obstacle should despawn (past despawn threshold).
-	 * 
-	 * @return True if should despawn
-	 */
-	bool ShouldDespawn() const;
-
 	//=============================================================================
 	// SETUP FUNCTIONS
 	//=============================================================================
@@ -385,4 +571,13 @@ protected:
 	 * Called in BeginPlay.
 	 */
 	void CacheWorldScrollComponent();
+
+	/** Unregister primitive components (no-op unless bDormantWhenPooled). Called from Deactivate(). */
+	void EnterDormancy();
+
+	/**
+	 * Re-register the primitive components this activation needs. Skips the mesh in
+	 * instanced mode and the collision box when overlaps are off. Called from Activate().
+	 */
+	void ExitDormancy();
 };
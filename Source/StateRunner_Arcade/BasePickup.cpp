@@ -11,12 +11,16 @@
 #include "StateRunner_Arcade.h"
 #include "BaseObstacle.h"
 #include "StateRunner_ArcadeGameMode.h"
+#include "LaneCollisionComponent.h"
+#include "SFXSubsystem.h"
+#include "RunSeedSubsystem.h"
+#include "SpawnTypeTraits.h"
+#include "VersusModeComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "Particles/ParticleSystem.h"
 #include "Particles/ParticleSystemComponent.h"
 #include "Sound/SoundBase.h"
 #include "Engine/Engine.h"
-#include "DrawDebugHelpers.h"
 
 ABasePickup::ABasePickup()
 {
@@ -61,6 +65,15 @@ void ABasePickup::BeginPlay()
 	{
 		CollisionBox->OnComponentBeginOverlap.AddDynamic(this, &ABasePickup::OnCollisionOverlapBegin);
 	}
+
+	// Analytic mode: the GameMode resolves contacts, so skip physics overlaps entirely
+	if (AStateRunner_ArcadeGameMode* GameMode = GetWorld() ? Cast<AStateRunner_ArcadeGameMode>(GetWorld()->GetAuthGameMode()) : nullptr)
+	{
+		if (ULaneCollisionComponent* LaneCollision = GameMode->GetLaneCollisionComponent())
+		{
+			SetPhysicsOverlapsEnabled(!LaneCollision->IsAnalytic());
+		}
+	}
 }
 
 void ABasePickup::Tick(float DeltaTime)
@@ -72,36 +85,12 @@ void ABasePickup::Tick(float DeltaTime)
 		return;
 	}
 
-	// Scroll with the world (always, even during collection effect)
-	UpdateScrolling(DeltaTime);
-
+	// World scrolling (including during the collection effect) is batched in UWorldScrollComponent.
 	// Only spin/bob if not playing collection effect (mesh is hidden then anyway)
 	if (!bIsPlayingCollectionEffect)
 	{
 		UpdateVisualEffects(DeltaTime);
 	}
-
-	// Debug collision visualization
-	if (bDrawDebugCollision && CollisionBox)
-	{
-		FVector BoxCenter = CollisionBox->GetComponentLocation();
-		FVector BoxExtent = CollisionBox->GetScaledBoxExtent();
-		FColor DebugColor = FColor::White;
-		
-		switch (PickupType)
-		{
-			case EPickupType::DataPacket: DebugColor = FColor::White; break;
-			case EPickupType::OneUp: DebugColor = FColor::Yellow; break;
-			case EPickupType::EMP: DebugColor = FColor::Cyan; break;
-		}
-		
-		DrawDebugBox(GetWorld(), BoxCenter, BoxExtent, DebugColor, false, 0.1f, 0, 4.0f);
-	}
-
-	if (ShouldDespawn())
-	{
-		Deactivate();
-	}
 }
 
 // --- Pooling ---
@@ -112,13 +101,29 @@ void ABasePickup::Activate(const FVector& SpawnLocation, ELane Lane)
 	bIsPlayingCollectionEffect = false;
 	CurrentLane = Lane;
 	BaseZ = SpawnLocation.Z;
-	BobTime = FMath::FRand() * 2.0f * PI;
+
+	// Look and motion draw from their own stream, so they never shift the run's placements
+	const FRandomStream& VisualRandom = URunSeedSubsystem::GetStreamFor(this, ERunRandomStream::PickupVisuals);
+	BobTime = VisualRandom.FRand() * 2.0f * PI;
 
 	// Randomize rotation speed
-	float SpeedVariation = FMath::FRandRange(-RotationSpeedVariation, RotationSpeedVariation);
+	float SpeedVariation = VisualRandom.FRandRange(-RotationSpeedVariation, RotationSpeedVariation);
 	CurrentRotationSpeed = RotationSpeed * (1.0f + SpeedVariation);
 
-	SetActorLocation(SpawnLocation);
+	// SpawnLocation is track space -- offset applies in MoveRunner scroll mode
+	if (!WorldScrollComponent)
+	{
+		CacheWorldScrollComponent();
+	}
+	FVector WorldLocation = SpawnLocation;
+	if (WorldScrollComponent)
+	{
+		WorldLocation.X = WorldScrollComponent->TrackToWorldX(SpawnLocation.X);
+	}
+	SetActorLocation(WorldLocation);
+
+	// Far down the track: lowest LOD, no collision and no spin/bob until the scroller promotes us
+	Significance = WorldScrollComponent ? WorldScrollComponent->GetSignificanceAt(SpawnLocation.X) : EScrollSignificance::Contact;
 
 	// Pick a random mesh variant first (sets mesh position)
 	SelectRandomMeshVariant();
@@ -130,10 +135,17 @@ void ABasePickup::Activate(const FVector& SpawnLocation, ELane Lane)
 	if (PickupMesh)
 	{
 		FRotator StartRotation = PickupMesh->GetRelativeRotation();
-		StartRotation.Yaw += FMath::FRandRange(0.0f, 360.0f);
+		StartRotation.Yaw += VisualRandom.FRandRange(0.0f, 360.0f);
 		PickupMesh->SetRelativeRotation(StartRotation);
 	}
 
+	// Set before registering so the proxy is created with this activation's phase and LOD
+	PushMaterialAnimationData();
+	UWorldScrollComponent::ApplySignificanceLOD(PickupMesh, Significance);
+
+	// Register after the move + mesh swap so proxies are created once, in place
+	ExitDormancy();
+
 	// Set up collection particle
 	if (CollectionParticleComponent && CollectionParticleEffect)
 	{
@@ -144,8 +156,14 @@ void ABasePickup::Activate(const FVector& SpawnLocation, ELane Lane)
 	}
 
 	SetActorHiddenInGame(false);
-	SetActorEnableCollision(true);
-	SetActorTickEnabled(true);
+	SetActorEnableCollision(bUsePhysicsOverlaps && Significance == EScrollSignificance::Contact);
+	SetActorTickEnabled(HasPerActorTickWork());
+
+	// Hand movement + despawn over to the batched scroller
+	if (WorldScrollComponent)
+	{
+		WorldScrollComponent->RegisterScrollable(this, this, DespawnXThreshold, Significance);
+	}
 }
 
 void ABasePickup::Deactivate()
@@ -177,7 +195,21 @@ void ABasePickup::Deactivate()
 	SetActorHiddenInGame(true);
 	SetActorEnableCollision(false);
 	SetActorTickEnabled(false);
+
+	if (WorldScrollComponent)
+	{
+		WorldScrollComponent->UnregisterScrollable(this);
+	}
+
+	// Drop render/physics state before the move so it doesn't update either
+	EnterDormancy();
 	SetActorLocation(FVector(0.0f, 0.0f, -10000.0f));
+
+	// Back to the pool
+	if (OwningSpawner.IsValid())
+	{
+		OwningSpawner->ReturnPickupToPool(this);
+	}
 }
 
 // --- Collection ---
@@ -189,147 +221,172 @@ void ABasePickup::OnCollisionOverlapBegin(
 	int32 OtherBodyIndex,
 	bool bFromSweep,
 	const FHitResult& SweepResult)
+{
+	HandlePlayerContact(OtherActor);
+}
+
+bool ABasePickup::HandlePlayerContact(AActor* PlayerActor)
 {
 	if (!bIsActive || bIsPlayingCollectionEffect)
 	{
-		return;
+		return false;
+	}
+
+	if (!PlayerActor || !PlayerActor->ActorHasTag(TEXT("Player")))
+	{
+		return false;
+	}
+
+	// Versus: a knocked-out runner can't collect
+	UVersusModeComponent* Versus = UVersusModeComponent::Get(this);
+	const int32 Slot = Versus ? Versus->GetPlayerSlot(PlayerActor) : 0;
+	if (Versus && Versus->IsPlayerOut(Slot))
+	{
+		return false;
+	}
+
+	UVersusModeComponent::FContactScope ContactScope(Versus, Slot);
+	HandleCollection(PlayerActor);
+	return true;
+}
+
+void ABasePickup::SetPhysicsOverlapsEnabled(bool bEnabled)
+{
+	bUsePhysicsOverlaps = bEnabled;
+
+	if (CollisionBox)
+	{
+		CollisionBox->SetGenerateOverlapEvents(bEnabled);
+		CollisionBox->SetCollisionEnabled(bEnabled ? ECollisionEnabled::QueryOnly : ECollisionEnabled::NoCollision);
 	}
 
-	if (OtherActor && OtherActor->ActorHasTag(TEXT("Player")))
+	if (!bEnabled)
 	{
-		HandleCollection(OtherActor);
+		SetActorEnableCollision(false);
 	}
 }
 
 void ABasePickup::HandleCollection_Implementation(AActor* PlayerActor)
 {
-	// Get game systems
-	UScoreSystemComponent* ScoreSystem = nullptr;
-	ULivesSystemComponent* LivesSystem = nullptr;
+	// Get game systems (the per-player getters return the collecting runner's in versus)
+	FPickupCollectionContext Context;
+	Context.Runner = Cast<APawn>(PlayerActor);
 	UOverclockSystemComponent* OverclockSystem = nullptr;
-	UObstacleSpawnerComponent* ObstacleSpawner = nullptr;
 
 	if (UWorld* World = GetWorld())
 	{
 		if (AStateRunner_ArcadeGameMode* GameMode = Cast<AStateRunner_ArcadeGameMode>(World->GetAuthGameMode()))
 		{
-			ScoreSystem = GameMode->GetScoreSystemComponent();
-			LivesSystem = GameMode->GetLivesSystemComponent();
+			Context.ScoreSystem = GameMode->GetScoreSystemComponent();
+			Context.LivesSystem = GameMode->GetLivesSystemComponent();
+			Context.ObstacleSpawner = GameMode->GetObstacleSpawnerComponent();
+			Context.PickupSpawner = GameMode->GetPickupSpawnerComponent();
 			OverclockSystem = GameMode->GetOverclockSystemComponent();
-			ObstacleSpawner = GameMode->GetObstacleSpawnerComponent();
 		}
 	}
 
-	if (PickupType == EPickupType::DataPacket)
+	// Type-specific effect, indexed by EPickupType
+	static constexpr float (ABasePickup::* CollectByType[NumPickupTypes])(const FPickupCollectionContext&) =
 	{
-		if (ScoreSystem)
-		{
-			ScoreSystem->AddPickupBonus();
-		}
-		if (OverclockSystem)
-		{
-			OverclockSystem->AddPickupBonus();
-		}
+		&ABasePickup::CollectDataPacket,
+		&ABasePickup::CollectOneUp,
+		&ABasePickup::CollectEMP,
+		&ABasePickup::CollectMagnet
+	};
+	const float PitchMultiplier = (this->*CollectByType[static_cast<int32>(PickupType)])(Context);
 
-		// Streak-based pitch (computed after AddPickupBonus updates timestamps)
-		float DataPacketPitch = 1.0f;
-		if (ScoreSystem)
+	const FPickupTypeTraits& Traits = GetPickupTypeTraits(PickupType);
+	if (OverclockSystem)
+	{
+		for (int32 Charge = 0; Charge < Traits.OverclockCharges; Charge++)
 		{
-			DataPacketPitch = ScoreSystem->GetCurrentPickupPitchMultiplier();
+			OverclockSystem->AddPickupBonus();
 		}
+	}
 
-		PlayCollectionEffect(DataPacketPitch);
-		OnCollected.Broadcast(this);
-		return;
+	if (Traits.bPlaysCollectionSound)
+	{
+		PlayCollectionEffect(PitchMultiplier);
 	}
-	else if (PickupType == EPickupType::OneUp)
+	else
 	{
-		bool bWasAtMax = false;
-		if (LivesSystem)
-		{
-			bWasAtMax = LivesSystem->Collect1Up();
-		}
-		
-		if (ScoreSystem)
-		{
-			ScoreSystem->Add1UpBonus(bWasAtMax);
-		}
-		
-		// Bonus sound when already at max lives
-		if (bWasAtMax && BonusCollectionSound)
-		{
-			UGameplayStatics::PlaySoundAtLocation(GetWorld(), BonusCollectionSound, GetActorLocation(), CollectionSoundVolume);
-		}
-		
 		PlayCollectionEffectNoSound();
-		OnCollected.Broadcast(this);
-		return;
 	}
-	else if (PickupType == EPickupType::EMP)
+	OnCollected.Broadcast(this);
+}
+
+float ABasePickup::CollectDataPacket(const FPickupCollectionContext& Context)
+{
+	if (!Context.ScoreSystem)
 	{
-		// Screen nuke: deactivate all active obstacles
-		// Only deactivates obstacles -- no side effects on spawning or other systems
-		int32 DestroyedCount = 0;
-		
-		if (ObstacleSpawner)
-		{
-			DestroyedCount = ObstacleSpawner->DeactivateAllActiveObstacles();
-		}
-		
-		if (ScoreSystem)
-		{
-			ScoreSystem->AddEMPBonus(DestroyedCount);
-		}
-		
-		// Triple OVERCLOCK boost for the dramatic moment
-		if (OverclockSystem)
-		{
-			OverclockSystem->AddPickupBonus();
-			OverclockSystem->AddPickupBonus();
-			OverclockSystem->AddPickupBonus();
-		}
-		
-		PlayCollectionEffect();
-		OnCollected.Broadcast(this);
-		return;
+		return 1.0f;
 	}
-	else if (PickupType == EPickupType::Magnet)
+
+	// Streak-based pitch (computed after AddPickupBonus updates timestamps)
+	Context.ScoreSystem->AddPickupBonus();
+	return Context.ScoreSystem->GetCurrentPickupPitchMultiplier();
+}
+
+float ABasePickup::CollectOneUp(const FPickupCollectionContext& Context)
+{
+	bool bWasAtMax = false;
+	if (Context.LivesSystem)
 	{
-		UE_LOG(LogStateRunner_Arcade, Log, TEXT("*** MAGNET COLLECTED! ***"));
-		
-		// Activate the magnet pull effect
-		if (UWorld* World = GetWorld())
-		{
-			if (AStateRunner_ArcadeGameMode* GameMode = Cast<AStateRunner_ArcadeGameMode>(World->GetAuthGameMode()))
-			{
-				if (UPickupSpawnerComponent* PickupSpawner = GameMode->GetPickupSpawnerComponent())
-				{
-					PickupSpawner->ActivateMagnet();
-				}
-				else
-				{
-					UE_LOG(LogStateRunner_Arcade, Warning, TEXT("MAGNET collection: PickupSpawnerComponent is NULL on GameMode!"));
-				}
-				
-				if (ScoreSystem)
-				{
-					ScoreSystem->NotifyMagnetCollected();
-				}
-			}
-			else
-			{
-				UE_LOG(LogStateRunner_Arcade, Warning, TEXT("MAGNET collection: Failed to cast GameMode!"));
-			}
-		}
-		
-		PlayCollectionEffect();
-		OnCollected.Broadcast(this);
-		return;
+		bWasAtMax = Context.LivesSystem->Collect1Up();
 	}
 
-	// Fallback for any unhandled pickup types
-	PlayCollectionEffect();
-	OnCollected.Broadcast(this);
+	if (Context.ScoreSystem)
+	{
+		Context.ScoreSystem->Add1UpBonus(bWasAtMax);
+	}
+
+	// Bonus sound when already at max lives (the regular collection sound is off for 1-Ups)
+	if (bWasAtMax && BonusCollectionSound)
+	{
+		USFXSubsystem::PlaySFXAtLocation(this, ESFXCategory::Pickup, BonusCollectionSound, GetActorLocation(), CollectionSoundVolume);
+	}
+
+	return 1.0f;
+}
+
+float ABasePickup::CollectEMP(const FPickupCollectionContext& Context)
+{
+	// Screen nuke: deactivate all active obstacles
+	// Only deactivates obstacles -- no side effects on spawning or other systems
+	int32 DestroyedCount = 0;
+	if (Context.ObstacleSpawner)
+	{
+		DestroyedCount = Context.ObstacleSpawner->DeactivateAllActiveObstacles();
+	}
+
+	if (Context.ScoreSystem)
+	{
+		Context.ScoreSystem->AddEMPBonus(DestroyedCount);
+	}
+
+	return 1.0f;
+}
+
+float ABasePickup::CollectMagnet(const FPickupCollectionContext& Context)
+{
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("*** MAGNET COLLECTED! ***"));
+
+	// Activate the magnet pull effect
+	if (Context.PickupSpawner)
+	{
+		Context.PickupSpawner->ActivateMagnet(Context.Runner);
+	}
+	else
+	{
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("MAGNET collection: PickupSpawnerComponent is NULL on GameMode!"));
+	}
+
+	if (Context.ScoreSystem)
+	{
+		Context.ScoreSystem->NotifyMagnetCollected();
+	}
+
+	return 1.0f;
 }
 
 // --- Collection Effects ---
@@ -338,11 +395,13 @@ void ABasePickup::PlayCollectionEffect(float PitchMultiplier)
 {
 	PlayCollectionEffectNoSound();
 
-	// Play sound with optional pitch scaling (data packets use streak pitch)
+	// Play sound with optional pitch scaling (data packets use streak pitch).
+	// Pooled voice: a magnet sweep reuses the Pickup voices instead of spawning per pickup.
 	if (CollectionSound)
 	{
-		UGameplayStatics::PlaySoundAtLocation(
-			GetWorld(),
+		USFXSubsystem::PlaySFXAtLocation(
+			this,
+			ESFXCategory::Pickup,
 			CollectionSound,
 			GetActorLocation(),
 			CollectionSoundVolume,
@@ -377,6 +436,9 @@ void ABasePickup::PlayCollectionEffectNoSound()
 	// Disable collision so player can't re-collect
 	SetActorEnableCollision(false);
 
+	// Mesh is hidden, so spin/bob is pointless
+	SetActorTickEnabled(false);
+
 	// Fire off the particle effect
 	if (CollectionParticleComponent && CollectionParticleEffect)
 	{
@@ -411,7 +473,7 @@ void ABasePickup::SelectRandomMeshVariant()
 		return;
 	}
 
-	const int32 RandomIndex = FMath::RandRange(0, MeshVariants.Num() - 1);
+	const int32 RandomIndex = URunSeedSubsystem::GetStreamFor(this, ERunRandomStream::PickupVisuals).RandRange(0, MeshVariants.Num() - 1);
 	ApplyMeshVariant(RandomIndex);
 }
 
@@ -447,7 +509,7 @@ void ABasePickup::ApplyMeshVariant(int32 VariantIndex)
 		
 		// Optional random yaw flip for variety
 		MeshBaseRotation = VariantData.RotationOffset;
-		if (VariantData.bRandomizeYawFlip && FMath::RandBool())
+		if (VariantData.bRandomizeYawFlip && URunSeedSubsystem::GetStreamFor(this, ERunRandomStream::PickupVisuals).RandRange(0, 1) == 1)
 		{
 			MeshBaseRotation.Yaw += 180.0f;
 		}
@@ -462,26 +524,14 @@ void ABasePickup::ApplyMeshVariant(int32 VariantIndex)
 
 // --- Movement ---
 
-void ABasePickup::UpdateScrolling(float DeltaTime)
+void ABasePickup::UpdateVisualEffects(float DeltaTime)
 {
-	if (!WorldScrollComponent)
+	// Material does both on the GPU
+	if (bAnimateInMaterial || AreEffectsSuppressed())
 	{
-		CacheWorldScrollComponent();
-		if (!WorldScrollComponent)
-		{
-			return;
-		}
+		return;
 	}
 
-	float ScrollSpeed = WorldScrollComponent->GetCurrentScrollSpeed();
-	
-	FVector CurrentLocation = GetActorLocation();
-	CurrentLocation.X -= ScrollSpeed * DeltaTime;
-	SetActorLocation(CurrentLocation);
-}
-
-void ABasePickup::UpdateVisualEffects(float DeltaTime)
-{
 	// Spin
 	if (PickupMesh && CurrentRotationSpeed > 0.0f)
 	{
@@ -502,9 +552,133 @@ void ABasePickup::UpdateVisualEffects(float DeltaTime)
 	}
 }
 
-bool ABasePickup::ShouldDespawn() const
+bool ABasePickup::HasPerActorTickWork() const
+{
+	if (bAnimateInMaterial || AreEffectsSuppressed())
+	{
+		return false;
+	}
+
+	return CurrentRotationSpeed > 0.0f || BobAmplitude > 0.0f;
+}
+
+void ABasePickup::SetEffectsReduced(bool bReduced)
+{
+	if (bReduced == bEffectsReduced)
+	{
+		return;
+	}
+
+	bEffectsReduced = bReduced;
+	if (!bIsActive || bIsPlayingCollectionEffect)
+	{
+		return;
+	}
+
+	// Settle on the bob's centre line so the pickup doesn't freeze off its collision height
+	if (bEffectsReduced && !bAnimateInMaterial)
+	{
+		FVector Location = GetActorLocation();
+		Location.Z = BaseZ;
+		SetActorLocation(Location);
+	}
+
+	PushMaterialAnimationData();
+	SetActorTickEnabled(HasPerActorTickWork());
+}
+
+void ABasePickup::SetSignificance(EScrollSignificance NewSignificance)
+{
+	if (NewSignificance == Significance)
+	{
+		return;
+	}
+
+	const bool bWasSuppressed = AreEffectsSuppressed();
+	Significance = NewSignificance;
+	if (!bIsActive)
+	{
+		return;
+	}
+
+	UWorldScrollComponent::ApplySignificanceLOD(PickupMesh, Significance);
+	SetActorEnableCollision(bUsePhysicsOverlaps && Significance == EScrollSignificance::Contact);
+
+	// Far pickups sit at BaseZ (they activate there and never ticked), so spin/bob just starts
+	if (bWasSuppressed != AreEffectsSuppressed() && !bIsPlayingCollectionEffect)
+	{
+		PushMaterialAnimationData();
+		SetActorTickEnabled(HasPerActorTickWork());
+	}
+}
+
+void ABasePickup::PushMaterialAnimationData()
+{
+	if (!bAnimateInMaterial || !PickupMesh)
+	{
+		return;
+	}
+
+	// Layout documented on bAnimateInMaterial
+	PickupMesh->SetCustomPrimitiveDataFloat(0, AreEffectsSuppressed() ? 0.0f : CurrentRotationSpeed);
+	PickupMesh->SetCustomPrimitiveDataFloat(1, AreEffectsSuppressed() ? 0.0f : BobAmplitude);
+	PickupMesh->SetCustomPrimitiveDataFloat(2, BobFrequency);
+	PickupMesh->SetCustomPrimitiveDataFloat(3, BobTime);
+}
+
+void ABasePickup::EnterDormancy()
+{
+	if (!bDormantWhenPooled || bIsDormant)
+	{
+		return;
+	}
+
+	if (DormantComponents.Num() == 0)
+	{
+		GetComponents<UPrimitiveComponent>(DormantComponents);
+	}
+
+	for (UPrimitiveComponent* Component : DormantComponents)
+	{
+		if (Component && Component->IsRegistered())
+		{
+			Component->UnregisterComponent();
+		}
+	}
+
+	bIsDormant = true;
+}
+
+void ABasePickup::ExitDormancy()
+{
+	if (!bIsDormant)
+	{
+		return;
+	}
+
+	for (UPrimitiveComponent* Component : DormantComponents)
+	{
+		if (!Component || Component->IsRegistered())
+		{
+			continue;
+		}
+
+		// Analytic collision never queries the box's physics state
+		if (!bUsePhysicsOverlaps && Component == CollisionBox)
+		{
+			continue;
+		}
+
+		Component->RegisterComponent();
+	}
+
+	bIsDormant = false;
+}
+
+float ABasePickup::GetTrackX() const
 {
-	return GetActorLocation().X < DespawnXThreshold;
+	const float WorldX = GetActorLocation().X;
+	return WorldScrollComponent ? WorldScrollComponent->WorldToTrackX(WorldX) : WorldX;
 }
 
 void ABasePickup::CacheWorldScrollComponent()
@@ -6,7 +6,12 @@
 #include "BasePickup.generated.h"
 
 class UWorldScrollComponent;
+class UPickupSpawnerComponent;
+class UScoreSystemComponent;
+class ULivesSystemComponent;
+class UObstacleSpawnerComponent;
 class UBoxComponent;
+class APawn;
 class UStaticMeshComponent;
 class UParticleSystem;
 class UParticleSystemComponent;
@@ -79,15 +84,27 @@ enum class EPickupType : uint8
 	Magnet			UMETA(DisplayName = "Magnet")
 };
 
+/** Game systems a collection touches, gathered once per HandleCollection (any may be null) */
+struct FPickupCollectionContext
+{
+	/** Runner that collected it (the per-player systems below are that runner's) */
+	APawn* Runner = nullptr;
+	UScoreSystemComponent* ScoreSystem = nullptr;
+	ULivesSystemComponent* LivesSystem = nullptr;
+	UObstacleSpawnerComponent* ObstacleSpawner = nullptr;
+	UPickupSpawnerComponent* PickupSpawner = nullptr;
+};
+
 /** Delegate broadcast when pickup is collected. */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPickupCollected, ABasePickup*, Pickup);
 
 /**
  * Base class for all collectible pickups (data packets, 1-ups, EMPs, etc.).
- * Handles scrolling movement, overlap collection, and object pooling.
+ * Handles overlap collection and object pooling. Scrolling movement is
+ * driven by UWorldScrollComponent, which the pickup registers with on Activate().
  */
 UCLASS(Abstract)
-class STATERUNNER_ARCADE_API ABasePickup : public AActor
+class STATERUNNER_ARCADE_API ABasePickup : public AActor, public IWorldScrollable
 {
 	GENERATED_BODY()
 
@@ -153,7 +170,7 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Pickup Config")
 	float CollisionZOffset = 0.0f;
 
-	/** Enable debug drawing of collision box (visible in Play mode). */
+	/** Always draw this type's collision box in the debug collision pass (Debug.ToggleCollision draws every pickup's). */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category="Pickup Config|Debug")
 	bool bDrawDebugCollision = false;
 
@@ -161,6 +178,13 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Pickup Config")
 	float RotationSpeed = 90.0f;
 
+	/**
+	 * Unregister primitive components while pooled, so inactive pickups have no render
+	 * proxy, physics body or broadphase entry. Activate() re-registers them.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Pooling")
+	bool bDormantWhenPooled = true;
+
 	/** Random variation applied to rotation speed (0.0 to 1.0). 0.3 = +/-30% speed variation. */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Pickup Config", meta=(ClampMin="0.0", ClampMax="0.5"))
 	float RotationSpeedVariation = 0.25f;
@@ -175,6 +199,19 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Pickup Config")
 	float BobFrequency = 2.0f;
 
+	/**
+	 * Spin and bob in the mesh material (world position offset) instead of moving the mesh
+	 * and actor every frame. The actor and collision box then stay put relative to the scroll,
+	 * and the pickup needs no tick at all (debug draw aside).
+	 *
+	 * Parameters are pushed once per activation as Custom Primitive Data on PickupMesh:
+	 * [0] spin speed (deg/s), [1] bob amplitude (units), [2] bob frequency (Hz), [3] bob phase (radians).
+	 * The material rotates about the object pivot's Z by Time * [0] and adds
+	 * Sin(Time * 2pi * [2] + [3]) * [1] to Z. Use the plain Time node so it stops while paused.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Pickup Config")
+	bool bAnimateInMaterial = false;
+
 	// --- Collection Effects ---
 
 protected:
@@ -291,6 +328,16 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Category="Runtime")
 	bool bIsPlayingCollectionEffect = false;
 
+	/** Whether CollisionBox generates overlap events (false when contacts are resolved analytically) */
+	bool bUsePhysicsOverlaps = true;
+
+	/** True while primitive components are unregistered (pooled) */
+	bool bIsDormant = false;
+
+	/** Primitive components toggled by dormancy (gathered on first use) */
+	UPROPERTY()
+	TArray<TObjectPtr<UPrimitiveComponent>> DormantComponents;
+
 	/** Timer handle for collection effect duration */
 	FTimerHandle CollectionEffectTimerHandle;
 
@@ -303,6 +350,12 @@ protected:
 	/** Instance-specific rotation speed (randomized on activation) */
 	float CurrentRotationSpeed = 0.0f;
 
+	/** Spin and bob switched off by the performance governor */
+	bool bEffectsReduced = false;
+
+	/** Distance tier for this activation (see SetSignificance) */
+	EScrollSignificance Significance = EScrollSignificance::Contact;
+
 	// --- Events ---
 
 public:
@@ -318,7 +371,7 @@ public:
 	/**
 	 * Activate this pickup from the pool.
 	 * 
-	 * @param SpawnLocation World location to place the pickup
+	 * @param SpawnLocation Track-space location (world location in MoveWorld scroll mode)
 	 * @param Lane Which lane the pickup is in
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pooling")
@@ -336,6 +389,54 @@ public:
 	UFUNCTION(BlueprintPure, Category="Pooling")
 	bool IsActive() const { return bIsActive; }
 
+	/**
+	 * Turn spin and bob off (performance governor). Kept across pool cycles; an active pickup
+	 * settles at its base height and stops ticking.
+	 */
+	void SetEffectsReduced(bool bReduced);
+
+	/**
+	 * Move to a new distance tier. Far pins PickupMesh to its lowest LOD and holds spin/bob;
+	 * collision stays off until Contact. Called by UWorldScrollComponent as the pickup closes
+	 * on the runner.
+	 */
+	void SetSignificance(EScrollSignificance NewSignificance);
+
+	/** Current distance tier */
+	EScrollSignificance GetSignificance() const { return Significance; }
+
+	// --- Pool Bookkeeping ---
+	// Indices are owned by TActorPool / TActiveActorList (ActorPool.h) and UWorldScrollComponent
+
+public:
+
+	/** Spawner whose pool this pickup belongs to. Deactivate() returns us to it. */
+	void SetOwningSpawner(UPickupSpawnerComponent* InSpawner) { OwningSpawner = InSpawner; }
+
+	int32 GetPoolSlotIndex() const { return PoolSlotIndex; }
+	void SetPoolSlotIndex(int32 InIndex) { PoolSlotIndex = InIndex; }
+
+	int32 GetActiveListIndex() const { return ActiveListIndex; }
+	void SetActiveListIndex(int32 InIndex) { ActiveListIndex = InIndex; }
+
+	// IWorldScrollable
+	virtual int32 GetScrollEntryIndex() const override { return ScrollEntryIndex; }
+	virtual void SetScrollEntryIndex(int32 InIndex) override { ScrollEntryIndex = InIndex; }
+
+protected:
+
+	/** Owning spawner (null for pickups placed by hand) */
+	TWeakObjectPtr<UPickupSpawnerComponent> OwningSpawner;
+
+	/** Slot in the owning TActorPool */
+	int32 PoolSlotIndex = INDEX_NONE;
+
+	/** Index in the spawner's active list */
+	int32 ActiveListIndex = INDEX_NONE;
+
+	/** Index in the world scroller's entry list */
+	int32 ScrollEntryIndex = INDEX_NONE;
+
 	// --- Getters ---
 
 public:
@@ -348,8 +449,41 @@ public:
 	UFUNCTION(BlueprintPure, Category="Pickup")
 	ELane GetCurrentLane() const { return CurrentLane; }
 
+	/** Get the X position below which this pickup despawns */
+	float GetDespawnXThreshold() const { return DespawnXThreshold; }
+
+	/** Actor X in track space (player-relative). Equals world X in MoveWorld scroll mode. */
+	float GetTrackX() const;
+
+	/** Collision box (also used for the analytic contact test) */
+	UBoxComponent* GetCollisionBox() const { return CollisionBox; }
+
+	/** True if this pickup asks for its collision box to be drawn */
+	bool IsDrawingDebugCollision() const { return bDrawDebugCollision; }
+
+	/** Visible mesh component (default mesh and Blueprint material overrides) */
+	UStaticMeshComponent* GetPickupMesh() const { return PickupMesh; }
+
+	/** Configured mesh variants (read from the class default object for precaching) */
+	const TArray<FPickupMeshVariantData>& GetMeshVariants() const { return MeshVariants; }
+
 	// --- Collection ---
 
+public:
+
+	/**
+	 * Register contact with the player. Shared by the overlap handler and ULaneCollisionComponent.
+	 * In versus the first runner to touch it collects it, with the GameMode's per-player getters
+	 * routed to that runner.
+	 * 
+	 * @param PlayerActor Actor touching the pickup (ignored unless tagged "Player")
+	 * @return True if this call collected the pickup
+	 */
+	bool HandlePlayerContact(AActor* PlayerActor);
+
+	/** Turn CollisionBox overlap generation on or off (off in analytic collision mode) */
+	void SetPhysicsOverlapsEnabled(bool bEnabled);
+
 protected:
 
 	/**
@@ -373,22 +507,42 @@ protected:
 	UFUNCTION(BlueprintNativeEvent, Category="Collection")
 	void HandleCollection(AActor* PlayerActor);
 
+	/**
+	 * Per-type collection effects, picked by EPickupType from a table in HandleCollection.
+	 * OVERCLOCK charge and the collection sound come from the type's FPickupTypeTraits.
+	 *
+	 * @return Pitch multiplier for the collection sound
+	 */
+	float CollectDataPacket(const FPickupCollectionContext& Context);
+	float CollectOneUp(const FPickupCollectionContext& Context);
+	float CollectEMP(const FPickupCollectionContext& Context);
+	float CollectMagnet(const FPickupCollectionContext& Context);
+
 	// --- Movement ---
 
 protected:
 
-	/** Update position based on scroll speed */
-	virtual void UpdateScrolling(float DeltaTime);
-
-	/** Update visual effects (rotation, bob) */
+	/** Update visual effects (rotation, bob). World scrolling is done by UWorldScrollComponent. */
 	virtual void UpdateVisualEffects(float DeltaTime);
 
-	/** Check if should despawn */
-	bool ShouldDespawn() const;
+	/** True if spin or bob need this actor to tick */
+	bool HasPerActorTickWork() const;
+
+	/** Spin/bob held, by the governor or because the pickup is still far away */
+	bool AreEffectsSuppressed() const { return bEffectsReduced || Significance == EScrollSignificance::Far; }
+
+	/** Write this activation's spin/bob parameters into PickupMesh's Custom Primitive Data (bAnimateInMaterial only) */
+	void PushMaterialAnimationData();
 
 	/** Cache WorldScrollComponent reference */
 	void CacheWorldScrollComponent();
 
 	/** Setup collision box from Blueprint-configured values. Called in Activate(). */
 	void SetupCollisionBox();
+
+	/** Unregister primitive components (no-op unless bDormantWhenPooled). Called from Deactivate(). */
+	void EnterDormancy();
+
+	/** Re-register primitive components, skipping the collision box when overlaps are off. Called from Activate(). */
+	void ExitDormancy();
 };
@@ -0,0 +1,274 @@
+#include "DifficultyDirectorComponent.h"
+#include "StateRunner_ArcadeGameMode.h"
+#include "StateRunner_Arcade.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+/** Longest scroll speed table baked (an hour at the default step) */
+static constexpr int32 DifficultyDirector_MaxScrollEntries = 36000;
+
+/** Levels are floored, so keep float error on a key (2.9999998) from dropping a whole level */
+static constexpr float DifficultyDirector_LevelTolerance = 1.0e-3f;
+
+/**
+ * Replace a curve's keys with linear ones.
+ * Prefixed to avoid Unity build collisions.
+ */
+static void DifficultyDirector_SetLinearKeys(FRuntimeFloatCurve& Curve, std::initializer_list<TPair<float, float>> Keys, bool bExtrapolate)
+{
+	FRichCurve* RichCurve = Curve.GetRichCurve();
+	RichCurve->Reset();
+	for (const TPair<float, float>& Key : Keys)
+	{
+		RichCurve->SetKeyInterpMode(RichCurve->AddKey(Key.Key, Key.Value), RCIM_Linear);
+	}
+	RichCurve->PreInfinityExtrap = RCCE_Constant;
+	RichCurve->PostInfinityExtrap = bExtrapolate ? RCCE_Linear : RCCE_Constant;
+}
+
+/**
+ * Linear ramp from (0, StartValue) at Slope per unit, held at EndValue once it gets there.
+ * bEndIsCeiling says which side EndValue limits (speed cap vs gap floor) when the ramp never reaches it.
+ */
+static void DifficultyDirector_SetClampedRamp(FRuntimeFloatCurve& Curve, float StartValue, float Slope, float EndValue, bool bEndIsCeiling)
+{
+	Curve.ExternalCurve = nullptr;
+
+	const float Span = EndValue - StartValue;
+	if (FMath::IsNearlyZero(Slope) || FMath::IsNearlyZero(Span) || FMath::Sign(Span) != FMath::Sign(Slope))
+	{
+		// Already at (or moving away from) the limit: flat at whichever bound applies
+		const float Value = bEndIsCeiling ? FMath::Min(StartValue, EndValue) : FMath::Max(StartValue, EndValue);
+		DifficultyDirector_SetLinearKeys(Curve, { { 0.0f, Value } }, false);
+		return;
+	}
+
+	DifficultyDirector_SetLinearKeys(Curve, { { 0.0f, StartValue }, { Span / Slope, EndValue } }, false);
+}
+
+static float DifficultyDirector_Eval(const FRuntimeFloatCurve& Curve, float X)
+{
+	return Curve.GetRichCurveConst()->Eval(X);
+}
+
+static int32 DifficultyDirector_EvalLevel(const FRuntimeFloatCurve& Curve, float X)
+{
+	return FMath::Max(FMath::FloorToInt(DifficultyDirector_Eval(Curve, X) + DifficultyDirector_LevelTolerance), 0);
+}
+
+// --- Component Lifecycle ---
+
+UDifficultyDirectorComponent::UDifficultyDirectorComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+
+	// 1250 units/sec + 8/sec, reaching the 3000 cap at 218.75 s
+	DifficultyDirector_SetLinearKeys(ScrollSpeedCurve, { { 0.0f, 1250.0f }, { 218.75f, 3000.0f } }, false);
+
+	// A level every 7 segments, no cap
+	DifficultyDirector_SetLinearKeys(DifficultyCurve, { { 0.0f, 0.0f }, { 7.0f, 1.0f } }, true);
+
+	// 3 obstacles at level 0, +1 per level (the spawner clamps to its min/max)
+	DifficultyDirector_SetLinearKeys(ObstacleCountCurve, { { 0.0f, 3.0f }, { 1.0f, 4.0f } }, true);
+
+	// 0.25 shrinking 0.04 per level, floored at 0.1 from level 3.75
+	DifficultyDirector_SetLinearKeys(BreatherGapCurve, { { 0.0f, 0.25f }, { 3.75f, 0.1f } }, false);
+
+	// Density follows the obstacle difficulty by default
+	DifficultyDirector_SetLinearKeys(PickupDensityCurve, { { 0.0f, 0.0f }, { 7.0f, 1.0f } }, true);
+}
+
+const UDifficultyDirectorComponent* UDifficultyDirectorComponent::Get(const UObject* WorldContextObject)
+{
+	if (WorldContextObject)
+	{
+		UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+		if (const AStateRunner_ArcadeGameMode* GameMode = World ? Cast<AStateRunner_ArcadeGameMode>(World->GetAuthGameMode()) : nullptr)
+		{
+			if (const UDifficultyDirectorComponent* Director = GameMode->GetDifficultyDirectorComponent())
+			{
+				return Director;
+			}
+		}
+	}
+
+	return GetDefault<UDifficultyDirectorComponent>();
+}
+
+void UDifficultyDirectorComponent::OnRegister()
+{
+	Super::OnRegister();
+
+	// Before any BeginPlay, so every system's first read hits the tables
+	BuildLookupTables();
+}
+
+// --- Public Functions ---
+
+void UDifficultyDirectorComponent::BuildLookupTables()
+{
+	// Scroll speed: one entry past the last key so the lerp covers it
+	ScrollSpeedTable.Reset();
+	const FRichCurve* ScrollCurve = ScrollSpeedCurve.GetRichCurveConst();
+	if (ScrollCurve->GetNumKeys() > 0)
+	{
+		const float LastKeyTime = FMath::Max(ScrollCurve->GetLastKey().Time, 0.0f);
+		const int32 NumEntries = FMath::Min(FMath::FloorToInt(LastKeyTime / ScrollSpeedTableStep) + 2, DifficultyDirector_MaxScrollEntries);
+		ScrollSpeedTable.SetNumUninitialized(NumEntries);
+		for (int32 i = 0; i < NumEntries; i++)
+		{
+			ScrollSpeedTable[i] = ScrollCurve->Eval(i * ScrollSpeedTableStep);
+		}
+	}
+	else
+	{
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("DifficultyDirector: ScrollSpeedCurve has no keys, scroll speed will be 0"));
+	}
+
+	DifficultyTable.SetNumUninitialized(SegmentTableSize);
+	PickupDensityTable.SetNumUninitialized(SegmentTableSize);
+	for (int32 Segment = 0; Segment < SegmentTableSize; Segment++)
+	{
+		DifficultyTable[Segment] = DifficultyDirector_EvalLevel(DifficultyCurve, Segment);
+		PickupDensityTable[Segment] = DifficultyDirector_EvalLevel(PickupDensityCurve, Segment);
+	}
+
+	ObstacleCountTable.SetNumUninitialized(LevelTableSize);
+	BreatherGapTable.SetNumUninitialized(LevelTableSize);
+	for (int32 Level = 0; Level < LevelTableSize; Level++)
+	{
+		ObstacleCountTable[Level] = FMath::Max(FMath::RoundToInt(DifficultyDirector_Eval(ObstacleCountCurve, Level)), 0);
+		BreatherGapTable[Level] = FMath::Clamp(DifficultyDirector_Eval(BreatherGapCurve, Level), 0.0f, 1.0f);
+	}
+
+	FindPeakScrollSpeed(PeakScrollSpeed, PeakScrollSpeedTime);
+
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("DifficultyDirector: Baked %d scroll speed entries (%.2f s step), %d segments, %d levels -- top speed %.0f at %.1f s"),
+		ScrollSpeedTable.Num(), ScrollSpeedTableStep, SegmentTableSize, LevelTableSize, PeakScrollSpeed, PeakScrollSpeedTime);
+}
+
+float UDifficultyDirectorComponent::GetScrollSpeedAt(float Seconds) const
+{
+	const float Position = FMath::Max(Seconds, 0.0f) / ScrollSpeedTableStep;
+	const int32 Index = FMath::FloorToInt(Position);
+	if (Index + 1 < ScrollSpeedTable.Num())
+	{
+		return FMath::Lerp(ScrollSpeedTable[Index], ScrollSpeedTable[Index + 1], Position - Index);
+	}
+
+	// Past the last key a held curve is just its last entry
+	if (ScrollSpeedTable.Num() > 0 && ScrollSpeedCurve.GetRichCurveConst()->PostInfinityExtrap == RCCE_Constant)
+	{
+		return ScrollSpeedTable.Last();
+	}
+
+	return DifficultyDirector_Eval(ScrollSpeedCurve, Seconds);
+}
+
+float UDifficultyDirectorComponent::GetMaxScrollSpeed() const
+{
+	if (ScrollSpeedTable.Num() > 0)
+	{
+		return PeakScrollSpeed;
+	}
+
+	float Speed, Time;
+	FindPeakScrollSpeed(Speed, Time);
+	return Speed;
+}
+
+float UDifficultyDirectorComponent::GetTimeToMaxScrollSpeed() const
+{
+	if (ScrollSpeedTable.Num() > 0)
+	{
+		return PeakScrollSpeedTime;
+	}
+
+	float Speed, Time;
+	FindPeakScrollSpeed(Speed, Time);
+	return Time;
+}
+
+int32 UDifficultyDirectorComponent::GetDifficultyForSegment(int32 SegmentsSpawned) const
+{
+	return DifficultyTable.IsValidIndex(SegmentsSpawned)
+		? DifficultyTable[SegmentsSpawned]
+		: DifficultyDirector_EvalLevel(DifficultyCurve, FMath::Max(SegmentsSpawned, 0));
+}
+
+int32 UDifficultyDirectorComponent::GetBaseObstacleCount(int32 DifficultyLevel) const
+{
+	return ObstacleCountTable.IsValidIndex(DifficultyLevel)
+		? ObstacleCountTable[DifficultyLevel]
+		: FMath::Max(FMath::RoundToInt(DifficultyDirector_Eval(ObstacleCountCurve, FMath::Max(DifficultyLevel, 0))), 0);
+}
+
+float UDifficultyDirectorComponent::GetBreatherGapFraction(int32 DifficultyLevel) const
+{
+	return BreatherGapTable.IsValidIndex(DifficultyLevel)
+		? BreatherGapTable[DifficultyLevel]
+		: FMath::Clamp(DifficultyDirector_Eval(BreatherGapCurve, FMath::Max(DifficultyLevel, 0)), 0.0f, 1.0f);
+}
+
+int32 UDifficultyDirectorComponent::GetPickupDensityForSegment(int32 SegmentsSpawned) const
+{
+	return PickupDensityTable.IsValidIndex(SegmentsSpawned)
+		? PickupDensityTable[SegmentsSpawned]
+		: DifficultyDirector_EvalLevel(PickupDensityCurve, FMath::Max(SegmentsSpawned, 0));
+}
+
+// --- Legacy Ramps ---
+
+void UDifficultyDirectorComponent::SetLinearScrollSpeedRamp(float BaseSpeed, float IncreasePerSecond, float MaxSpeed)
+{
+	DifficultyDirector_SetClampedRamp(ScrollSpeedCurve, BaseSpeed, IncreasePerSecond, MaxSpeed, true);
+}
+
+void UDifficultyDirectorComponent::SetSegmentsPerDifficultyLevel(int32 SegmentsPerLevel)
+{
+	DifficultyCurve.ExternalCurve = nullptr;
+	DifficultyDirector_SetLinearKeys(DifficultyCurve, { { 0.0f, 0.0f }, { (float)FMath::Max(SegmentsPerLevel, 1), 1.0f } }, true);
+}
+
+void UDifficultyDirectorComponent::SetLinearObstacleCountRamp(int32 BaseCount, int32 PerLevel)
+{
+	ObstacleCountCurve.ExternalCurve = nullptr;
+	DifficultyDirector_SetLinearKeys(ObstacleCountCurve, { { 0.0f, (float)BaseCount }, { 1.0f, (float)(BaseCount + PerLevel) } }, true);
+}
+
+void UDifficultyDirectorComponent::SetLinearBreatherGapRamp(float BaseGap, float ShrinkPerLevel, float MinGap)
+{
+	DifficultyDirector_SetClampedRamp(BreatherGapCurve, BaseGap, -ShrinkPerLevel, MinGap, false);
+}
+
+void UDifficultyDirectorComponent::SetSegmentsPerDensityLevel(int32 SegmentsPerLevel)
+{
+	PickupDensityCurve.ExternalCurve = nullptr;
+	DifficultyDirector_SetLinearKeys(PickupDensityCurve, { { 0.0f, 0.0f }, { (float)FMath::Max(SegmentsPerLevel, 1), 1.0f } }, true);
+}
+
+// --- Internal Functions ---
+
+void UDifficultyDirectorComponent::FindPeakScrollSpeed(float& OutSpeed, float& OutTime) const
+{
+	const FRichCurve* ScrollCurve = ScrollSpeedCurve.GetRichCurveConst();
+
+	// A curve that keeps ramping past its last key never tops out
+	if (ScrollCurve->PostInfinityExtrap != RCCE_Constant)
+	{
+		OutSpeed = MAX_flt;
+		OutTime = MAX_flt;
+		return;
+	}
+
+	OutSpeed = 0.0f;
+	OutTime = 0.0f;
+	for (const FRichCurveKey& Key : ScrollCurve->GetConstRefOfKeys())
+	{
+		if (Key.Value > OutSpeed)
+		{
+			OutSpeed = Key.Value;
+			OutTime = Key.Time;
+		}
+	}
+}
@@ -0,0 +1,169 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "Curves/CurveFloat.h"
+#include "DifficultyDirectorComponent.generated.h"
+
+/**
+ * Difficulty Director Component
+ *
+ * The one place the run's difficulty ramp is authored. Each curve can be edited inline on
+ * the GameMode Blueprint or point at a shared CurveFloat asset:
+ * - ScrollSpeedCurve: base scroll speed (units/sec) by seconds of scrolling
+ * - DifficultyCurve: obstacle difficulty level by segments spawned (floored)
+ * - ObstacleCountCurve: obstacles per segment by difficulty level, before the +-1 variance
+ * - BreatherGapCurve: empty lead-in fraction of a breather segment by difficulty level
+ * - PickupDensityCurve: pickup density level by segments spawned (floored)
+ *
+ * At registration every curve is baked into a lookup table (scroll speed every
+ * ScrollSpeedTableStep seconds, the rest per segment or per level), so WorldScroll, both
+ * spawners and the HUD read a table entry instead of evaluating curves or keeping their
+ * own ramp math. Inputs past the end of a table evaluate the curve directly.
+ *
+ * The defaults reproduce the old per-system ramps: 1250 + 8/sec capped at 3000, a level
+ * every 7 segments, 3 obstacles +1 per level, breather gap 0.25 -0.04 per level down to 0.1.
+ * GameMode Blueprints that tuned the old ramp properties get matching curves on load
+ * (AStateRunner_ArcadeGameMode::PostLoad).
+ * Attached to GameMode.
+ */
+UCLASS(ClassGroup=(StateRunner), meta=(BlueprintSpawnableComponent))
+class STATERUNNER_ARCADE_API UDifficultyDirectorComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+
+	UDifficultyDirectorComponent();
+
+	/**
+	 * The world's director, or the class defaults (unbaked, curve-evaluated) when there's
+	 * no StateRunner game mode -- never null.
+	 */
+	static const UDifficultyDirectorComponent* Get(const UObject* WorldContextObject);
+
+protected:
+
+	virtual void OnRegister() override;
+
+	// --- Curves ---
+
+protected:
+
+	/** Base scroll speed (units/sec) by seconds of scrolling. OVERCLOCK and damage slowdown apply on top. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Difficulty|Curves")
+	FRuntimeFloatCurve ScrollSpeedCurve;
+
+	/** Obstacle difficulty level by segments spawned (floored to a whole level) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Difficulty|Curves")
+	FRuntimeFloatCurve DifficultyCurve;
+
+	/** Obstacles per segment by difficulty level (rounded, before the spawner's variance and clamp) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Difficulty|Curves")
+	FRuntimeFloatCurve ObstacleCountCurve;
+
+	/** Empty fraction at the start of a breather segment by difficulty level */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Difficulty|Curves")
+	FRuntimeFloatCurve BreatherGapCurve;
+
+	/** Pickup density level by segments spawned (floored to a whole level) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Difficulty|Curves")
+	FRuntimeFloatCurve PickupDensityCurve;
+
+	// --- Lookup Tables ---
+
+protected:
+
+	/** Seconds between scroll speed table entries (looked up with a lerp between neighbours) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Difficulty|Lookup Tables", meta=(ClampMin="0.01", ClampMax="1.0"))
+	float ScrollSpeedTableStep = 0.1f;
+
+	/** Segments covered by the difficulty and density tables */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Difficulty|Lookup Tables", meta=(ClampMin="16", ClampMax="4096"))
+	int32 SegmentTableSize = 512;
+
+	/** Difficulty levels covered by the obstacle count and breather gap tables */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Difficulty|Lookup Tables", meta=(ClampMin="8", ClampMax="256"))
+	int32 LevelTableSize = 64;
+
+	// --- Baked State ---
+
+protected:
+
+	/** Scroll speed at i * ScrollSpeedTableStep, up to the curve's last key */
+	TArray<float> ScrollSpeedTable;
+
+	TArray<int32> DifficultyTable;
+	TArray<int32> ObstacleCountTable;
+	TArray<float> BreatherGapTable;
+	TArray<int32> PickupDensityTable;
+
+	/** Highest base scroll speed the curve reaches, and when */
+	float PeakScrollSpeed = 0.0f;
+	float PeakScrollSpeedTime = 0.0f;
+
+	// --- Public Functions ---
+
+public:
+
+	/** Bake every curve into its lookup table (done at registration; callable again after edits) */
+	void BuildLookupTables();
+
+	/** Base scroll speed after this many seconds of scrolling */
+	UFUNCTION(BlueprintPure, Category="Difficulty")
+	float GetScrollSpeedAt(float Seconds) const;
+
+	/** Highest base scroll speed the run reaches (the HUD's MAX SPEED point) */
+	UFUNCTION(BlueprintPure, Category="Difficulty")
+	float GetMaxScrollSpeed() const;
+
+	/** Seconds of scrolling until the base speed tops out */
+	UFUNCTION(BlueprintPure, Category="Difficulty")
+	float GetTimeToMaxScrollSpeed() const;
+
+	/** Obstacle difficulty level once this many segments have spawned */
+	UFUNCTION(BlueprintPure, Category="Difficulty")
+	int32 GetDifficultyForSegment(int32 SegmentsSpawned) const;
+
+	/** Obstacles per segment at a difficulty level, before variance and clamping */
+	UFUNCTION(BlueprintPure, Category="Difficulty")
+	int32 GetBaseObstacleCount(int32 DifficultyLevel) const;
+
+	/** Breather segment lead-in fraction at a difficulty level */
+	UFUNCTION(BlueprintPure, Category="Difficulty")
+	float GetBreatherGapFraction(int32 DifficultyLevel) const;
+
+	/** Pickup density level once this many segments have spawned */
+	UFUNCTION(BlueprintPure, Category="Difficulty")
+	int32 GetPickupDensityForSegment(int32 SegmentsSpawned) const;
+
+	// --- Legacy Ramps ---
+
+public:
+
+	// Rebuild a curve as one of the linear ramps the systems computed before the director, to
+	// migrate GameMode Blueprints tuned with the old per-system properties. Each replaces the
+	// curve's inline keys and drops any CurveFloat asset it pointed at.
+
+	/** Scroll speed BaseSpeed + IncreasePerSecond * t, held at MaxSpeed */
+	void SetLinearScrollSpeedRamp(float BaseSpeed, float IncreasePerSecond, float MaxSpeed);
+
+	/** One difficulty level every SegmentsPerLevel segments */
+	void SetSegmentsPerDifficultyLevel(int32 SegmentsPerLevel);
+
+	/** BaseCount obstacles at level 0, PerLevel more each level */
+	void SetLinearObstacleCountRamp(int32 BaseCount, int32 PerLevel);
+
+	/** Breather gap BaseGap - ShrinkPerLevel * level, floored at MinGap */
+	void SetLinearBreatherGapRamp(float BaseGap, float ShrinkPerLevel, float MinGap);
+
+	/** One pickup density level every SegmentsPerLevel segments */
+	void SetSegmentsPerDensityLevel(int32 SegmentsPerLevel);
+
+	// --- Internal Functions ---
+
+protected:
+
+	/** Find the highest base scroll speed from the curve's keys */
+	void FindPeakScrollSpeed(float& OutSpeed, float& OutTime) const;
+};
@@ -0,0 +1,177 @@
+#include "DisplaySettingsSubsystem.h"
+#include "ArcadeSaveSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/LocalPlayer.h"
+#include "GameFramework/GameUserSettings.h"
+#include "HAL/IConsoleManager.h"
+#include "RenderCore.h"
+#include "RHI.h"
+#include "StateRunner_ArcadePlayerController.h"
+#include "StateRunner_Arcade.h"
+
+/** r.GTSyncType values (see the engine's cvar help) */
+static constexpr int32 DisplaySettings_SyncToRHIThread = 1;
+static constexpr int32 DisplaySettings_SyncToSwapChain = 2;
+
+// --- Subsystem Lifecycle ---
+
+void UDisplaySettingsSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// Saved settings must be in memory before they're applied
+	Collection.InitializeDependency<UArcadeSaveSubsystem>();
+
+	if (const IConsoleVariable* SyncTypeVar = IConsoleManager::Get().FindConsoleVariable(TEXT("r.GTSyncType")))
+	{
+		EngineGTSyncType = SyncTypeVar->GetInt();
+	}
+	if (const IConsoleVariable* ThreadLagVar = IConsoleManager::Get().FindConsoleVariable(TEXT("r.OneFrameThreadLag")))
+	{
+		EngineOneFrameThreadLag = ThreadLagVar->GetInt();
+	}
+
+	if (const UArcadeSaveSubsystem* Saves = GetGameInstance()->GetSubsystem<UArcadeSaveSubsystem>())
+	{
+		Settings = Saves->GetDisplaySettings();
+	}
+
+	ApplySettings();
+
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("DisplaySettingsSubsystem: Cap %d Hz, VSync %s, low latency %s, simulation %d Hz"),
+		Settings.FrameRateLimit, Settings.bVSyncEnabled ? TEXT("on") : TEXT("off"),
+		Settings.bLowLatencyMode ? TEXT("on") : TEXT("off"), Settings.SimulationStepRate);
+}
+
+UDisplaySettingsSubsystem* UDisplaySettingsSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<UDisplaySettingsSubsystem>() : nullptr;
+}
+
+// --- Options ---
+
+const TArray<int32>& UDisplaySettingsSubsystem::GetFrameRateOptions()
+{
+	// Cabinet panels first, uncapped last
+	static const TArray<int32> Options = { 60, 120, 144, 0 };
+	return Options;
+}
+
+const TArray<int32>& UDisplaySettingsSubsystem::GetSimulationRateOptions()
+{
+	static const TArray<int32> Options = { 0, 60, 120, 240 };
+	return Options;
+}
+
+// --- Settings ---
+
+void UDisplaySettingsSubsystem::SetFrameRateLimit(int32 NewLimit)
+{
+	FDisplaySettings NewSettings = Settings;
+	NewSettings.FrameRateLimit = FMath::Max(NewLimit, 0);
+	CommitSettings(NewSettings);
+}
+
+void UDisplaySettingsSubsystem::SetVSyncEnabled(bool bEnabled)
+{
+	FDisplaySettings NewSettings = Settings;
+	NewSettings.bVSyncEnabled = bEnabled;
+	CommitSettings(NewSettings);
+}
+
+void UDisplaySettingsSubsystem::SetLowLatencyMode(bool bEnabled)
+{
+	FDisplaySettings NewSettings = Settings;
+	NewSettings.bLowLatencyMode = bEnabled;
+	CommitSettings(NewSettings);
+}
+
+void UDisplaySettingsSubsystem::SetSimulationStepRate(int32 NewRate)
+{
+	FDisplaySettings NewSettings = Settings;
+	NewSettings.SimulationStepRate = FMath::Max(NewRate, 0);
+	CommitSettings(NewSettings);
+}
+
+// --- Frame Timing ---
+
+void UDisplaySettingsSubsystem::GetLastFrameTimings(float& OutGameThreadMs, float& OutGPUMs)
+{
+	OutGameThreadMs = static_cast<float>(FPlatformTime::ToMilliseconds(GGameThreadTime));
+	OutGPUMs = static_cast<float>(FPlatformTime::ToMilliseconds(RHIGetGPUFrameCycles()));
+}
+
+// --- Internal Functions ---
+
+void UDisplaySettingsSubsystem::CommitSettings(const FDisplaySettings& NewSettings)
+{
+	if (NewSettings == Settings)
+	{
+		return;
+	}
+
+	Settings = NewSettings;
+
+	// Written with the next save batch (the settings menu flushes on close)
+	if (UArcadeSaveSubsystem* Saves = GetGameInstance()->GetSubsystem<UArcadeSaveSubsystem>())
+	{
+		Saves->SetDisplaySettings(Settings);
+	}
+
+	ApplySettings();
+}
+
+void UDisplaySettingsSubsystem::ApplySettings() const
+{
+	// Mirrored so a later UGameUserSettings::ApplySettings keeps them
+	if (UGameUserSettings* UserSettings = GEngine ? GEngine->GetGameUserSettings() : nullptr)
+	{
+		UserSettings->SetFrameRateLimit(static_cast<float>(Settings.FrameRateLimit));
+		UserSettings->SetVSyncEnabled(Settings.bVSyncEnabled);
+	}
+
+	// A menu's quiescence cap wins until it closes (the controller re-applies this then)
+	if (GEngine && !IsMenuFrameRateCapped())
+	{
+		GEngine->SetMaxFPS(static_cast<float>(Settings.FrameRateLimit));
+	}
+
+	IConsoleManager& ConsoleManager = IConsoleManager::Get();
+	if (IConsoleVariable* VSyncVar = ConsoleManager.FindConsoleVariable(TEXT("r.VSync")))
+	{
+		VSyncVar->Set(Settings.bVSyncEnabled ? 1 : 0, ECVF_SetByGameSetting);
+	}
+
+	// Flip-paced sync only means something with VSync on; without it, the RHI thread is the closest wait
+	const int32 SyncType = !Settings.bLowLatencyMode ? EngineGTSyncType
+		: Settings.bVSyncEnabled ? DisplaySettings_SyncToSwapChain : DisplaySettings_SyncToRHIThread;
+	if (IConsoleVariable* SyncTypeVar = ConsoleManager.FindConsoleVariable(TEXT("r.GTSyncType")))
+	{
+		SyncTypeVar->Set(SyncType, ECVF_SetByGameSetting);
+	}
+	if (IConsoleVariable* ThreadLagVar = ConsoleManager.FindConsoleVariable(TEXT("r.OneFrameThreadLag")))
+	{
+		ThreadLagVar->Set(Settings.bLowLatencyMode ? 0 : EngineOneFrameThreadLag, ECVF_SetByGameSetting);
+	}
+}
+
+bool UDisplaySettingsSubsystem::IsMenuFrameRateCapped() const
+{
+	for (const ULocalPlayer* LocalPlayer : GetGameInstance()->GetLocalPlayers())
+	{
+		const AStateRunner_ArcadePlayerController* ArcadeController = LocalPlayer ? Cast<AStateRunner_ArcadePlayerController>(LocalPlayer->PlayerController) : nullptr;
+		if (ArcadeController && ArcadeController->IsFrameRateCapped())
+		{
+			return true;
+		}
+	}
+	return false;
+}
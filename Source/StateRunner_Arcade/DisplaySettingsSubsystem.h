@@ -0,0 +1,122 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "DisplaySettingsSubsystem.generated.h"
+
+/**
+ * Frame pacing settings, persisted in the ArcadeSave record.
+ */
+USTRUCT(BlueprintType)
+struct FDisplaySettings
+{
+	GENERATED_BODY()
+
+	/** Frame rate cap in Hz (0 = uncapped) */
+	UPROPERTY(BlueprintReadOnly, Category="Display")
+	int32 FrameRateLimit = 60;
+
+	UPROPERTY(BlueprintReadOnly, Category="Display")
+	bool bVSyncEnabled = true;
+
+	/** Game thread waits on the RHI thread / swap chain instead of running a frame ahead */
+	UPROPERTY(BlueprintReadOnly, Category="Display")
+	bool bLowLatencyMode = false;
+
+	/** Fixed simulation steps per second (0 = the GameplaySimulationSubsystem config rate) */
+	UPROPERTY(BlueprintReadOnly, Category="Display")
+	int32 SimulationStepRate = 0;
+
+	bool operator==(const FDisplaySettings& Other) const
+	{
+		return FrameRateLimit == Other.FrameRateLimit
+			&& bVSyncEnabled == Other.bVSyncEnabled
+			&& bLowLatencyMode == Other.bLowLatencyMode
+			&& SimulationStepRate == Other.SimulationStepRate;
+	}
+
+	bool operator!=(const FDisplaySettings& Other) const { return !(*this == Other); }
+};
+
+/**
+ * Display Settings Subsystem
+ *
+ * Applies the frame pacing settings -- frame rate cap, VSync, low-latency present and the
+ * fixed simulation rate -- at startup and whenever the settings menu changes one. The values
+ * live in the ArcadeSave record, so they are in place before the first map loads.
+ *
+ * The cap and VSync go straight to t.MaxFPS / r.VSync (and are mirrored into
+ * UGameUserSettings so its own apply doesn't undo them). While a menu's quiescence cap is in
+ * force the cap is only stored; the player controller re-applies it when the menu closes. Low latency sets r.GTSyncType
+ * (swap chain flip with VSync, RHI thread without) and turns r.OneFrameThreadLag off. The
+ * simulation rate is read by UGameplaySimulationSubsystem when a world starts, so it
+ * changes from the next run.
+ */
+UCLASS()
+class STATERUNNER_ARCADE_API UDisplaySettingsSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	// --- Subsystem Lifecycle ---
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	/** Get the subsystem from a world context */
+	static UDisplaySettingsSubsystem* Get(const UObject* WorldContextObject);
+
+	// --- Options ---
+
+	/** Frame rate caps offered in the settings menu (0 = uncapped) */
+	static const TArray<int32>& GetFrameRateOptions();
+
+	/** Simulation rates offered in the settings menu (0 = config default) */
+	static const TArray<int32>& GetSimulationRateOptions();
+
+	// --- Settings ---
+
+	UFUNCTION(BlueprintPure, Category="Display")
+	const FDisplaySettings& GetSettings() const { return Settings; }
+
+	UFUNCTION(BlueprintCallable, Category="Display")
+	void SetFrameRateLimit(int32 NewLimit);
+
+	UFUNCTION(BlueprintCallable, Category="Display")
+	void SetVSyncEnabled(bool bEnabled);
+
+	UFUNCTION(BlueprintCallable, Category="Display")
+	void SetLowLatencyMode(bool bEnabled);
+
+	/** Takes effect when the next world starts */
+	UFUNCTION(BlueprintCallable, Category="Display")
+	void SetSimulationStepRate(int32 NewRate);
+
+	/** Push the current settings to the engine (t.MaxFPS is left alone while a menu caps it) */
+	void ApplySettings() const;
+
+	// --- Frame Timing ---
+
+	/** Last completed frame's game thread and GPU time in ms (GPU reads 0 where the RHI doesn't time frames) */
+	static void GetLastFrameTimings(float& OutGameThreadMs, float& OutGPUMs);
+
+	// --- Internal State ---
+
+protected:
+
+	FDisplaySettings Settings;
+
+	/** r.GTSyncType / r.OneFrameThreadLag before low latency changed them */
+	int32 EngineGTSyncType = 0;
+	int32 EngineOneFrameThreadLag = 1;
+
+	// --- Internal Functions ---
+
+protected:
+
+	/** Store in the save record and apply */
+	void CommitSettings(const FDisplaySettings& NewSettings);
+
+	/** A local player's menu holds the quiescent frame cap */
+	bool IsMenuFrameRateCapped() const;
+};
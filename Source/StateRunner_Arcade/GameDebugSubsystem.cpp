@@ -1,8 +1,29 @@
 #include "GameDebugSubsystem.h"
 #include "StateRunner_Arcade.h"
+#include "HardwareTierSubsystem.h"
+#include "BaseObstacle.h"
+#include "BasePickup.h"
+#include "SpawnTypeTraits.h"
+#include "StateRunner_ArcadeGameMode.h"
+#include "StateRunner_ArcadeCharacter.h"
+#include "ObstacleSpawnerComponent.h"
+#include "PickupSpawnerComponent.h"
+#include "LaneCollisionComponent.h"
+#include "WorldScrollComponent.h"
+#include "Components/BoxComponent.h"
 #include "Engine/Engine.h"
 #include "Kismet/GameplayStatics.h"
 #include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+/** Debug subsystem of the current play world (console commands) */
+static UGameDebugSubsystem* GameDebug_GetPlaySubsystem()
+{
+	UWorld* World = GEngine ? GEngine->GetCurrentPlayWorld() : nullptr;
+	UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
+	return GI ? GI->GetSubsystem<UGameDebugSubsystem>() : nullptr;
+}
 
 // Console command to toggle debug display
 static FAutoConsoleCommand ToggleDebugCmd(
@@ -10,35 +31,140 @@ static FAutoConsoleCommand ToggleDebugCmd(
 	TEXT("Toggles the on-screen debug display"),
 	FConsoleCommandDelegate::CreateLambda([]()
 	{
-		if (GEngine)
+		if (UGameDebugSubsystem* DebugSub = GameDebug_GetPlaySubsystem())
+		{
+			DebugSub->ToggleDebugDisplay();
+		}
+	})
+);
+
+// Console command to toggle the performance overlay (the Performance category)
+static FAutoConsoleCommand TogglePerfCmd(
+	TEXT("Debug.TogglePerf"),
+	TEXT("Toggles the performance overlay (frame time histogram, percentiles, per-subsystem ms)"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		if (UGameDebugSubsystem* DebugSub = GameDebug_GetPlaySubsystem())
 		{
-			UWorld* World = GEngine->GetCurrentPlayWorld();
-			if (World)
+			DebugSub->ToggleCategory(EDebugCategory::Performance);
+			if (!DebugSub->bDebugEnabled && DebugSub->IsCategoryEnabled(EDebugCategory::Performance))
 			{
-				UGameInstance* GI = World->GetGameInstance();
-				if (GI)
-				{
-					UGameDebugSubsystem* DebugSub = GI->GetSubsystem<UGameDebugSubsystem>();
-					if (DebugSub)
-					{
-						DebugSub->ToggleDebugDisplay();
-					}
-				}
+				DebugSub->ToggleDebugDisplay();
 			}
 		}
 	})
 );
 
+// Console command to toggle the collision draw (the Collision category)
+static FAutoConsoleCommand ToggleCollisionCmd(
+	TEXT("Debug.ToggleCollision"),
+	TEXT("Toggles the collision draw (obstacle/pickup boxes, lane query interval, pickup occupancy grid)"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		if (UGameDebugSubsystem* DebugSub = GameDebug_GetPlaySubsystem())
+		{
+			DebugSub->ToggleCategory(EDebugCategory::Collision);
+			if (!DebugSub->bDebugEnabled && DebugSub->IsCategoryEnabled(EDebugCategory::Collision))
+			{
+				DebugSub->ToggleDebugDisplay();
+			}
+		}
+	})
+);
+
+static TAutoConsoleVariable<int32> CVarWriteRunPerfCsv(
+	TEXT("StateRunner.Perf.WriteRunCsv"),
+	1,
+	TEXT("Write a frame time CSV per run at game over (Saved/Profiling/RunPerf)"));
+
+static TAutoConsoleVariable<float> CVarPerfHitchMs(
+	TEXT("StateRunner.Perf.HitchMs"),
+	33.3f,
+	TEXT("Frames longer than this (ms) count as hitches in the per-run frame stats"));
+
+// --- Performance Tables ---
+// Prefixed to avoid Unity build collisions
+
+/** Scroll speed bracket width for the per-run CSV (units/s) */
+static constexpr float GameDebug_SpeedBracketSize = 250.0f;
+
+/** Overlay and hitch CSV labels, indexed by EStateRunnerScope */
+static const TCHAR* GameDebug_ScopeNames[] = {
+	TEXT("Scroll"), TEXT("SpawnObs"), TEXT("Fair"), TEXT("SpawnPkp"), TEXT("Prewarm"),
+	TEXT("Magnet"), TEXT("HUD"), TEXT("Theme"), TEXT("SaveW"), TEXT("SaveL"),
+};
+static_assert(UE_ARRAY_COUNT(GameDebug_ScopeNames) == static_cast<int32>(EStateRunnerScope::Count), "GameDebug_ScopeNames must have one entry per EStateRunnerScope");
+
+/** Hitch labels, one per EStateRunnerFrameEvent bit (lowest first) */
+static const TCHAR* GameDebug_FrameEventNames[] = {
+	TEXT("ObstaclePoolExpanded"), TEXT("PickupPoolExpanded"), TEXT("WidgetConstructed"), TEXT("GarbageCollected"),
+};
+
+/** "A|B" for the flags set in Events ("-" for none) */
+static FString GameDebug_FrameEventsToString(EStateRunnerFrameEvent Events)
+{
+	FString Out;
+	for (int32 Bit = 0; Bit < UE_ARRAY_COUNT(GameDebug_FrameEventNames); Bit++)
+	{
+		if (EnumHasAnyFlags(Events, static_cast<EStateRunnerFrameEvent>(1 << Bit)))
+		{
+			Out += Out.IsEmpty() ? TEXT("") : TEXT("|");
+			Out += GameDebug_FrameEventNames[Bit];
+		}
+	}
+	return Out.IsEmpty() ? FString(TEXT("-")) : Out;
+}
+
+#if !UE_BUILD_SHIPPING
+/** Overlay histogram bucket upper edges (ms): 120/90/60/50/40/30/20 fps and slower */
+static const float GameDebug_OverlayBucketMs[] = { 8.3f, 11.1f, 16.7f, 20.0f, 25.0f, 33.3f, 50.0f, FLT_MAX };
+
+/** Line batch id of the collision draw, so each frame replaces the last */
+static constexpr uint32 GameDebug_CollisionBatchId = 0x53524342;
+
+/** World Z the lane intervals and occupancy grid are drawn at (just above the track floor) */
+static constexpr float GameDebug_LaneDrawZ = 2.0f;
+#endif
+
 void UGameDebugSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
+
+	PerfTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &UGameDebugSubsystem::HandlePerfTick));
+
+	// A collection pass is the usual unexplained hitch; flag it for the hitch detector
+	PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddLambda([]()
+	{
+		STATERUNNER_FRAME_EVENT(GarbageCollected);
+	});
+
+#if !UE_BUILD_SHIPPING
+	PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &UGameDebugSubsystem::HandleWorldPostActorTick);
+#endif
 	
 	UE_LOG(LogStateRunner_Arcade, Log, TEXT("GameDebugSubsystem initialized"));
 }
 
 void UGameDebugSubsystem::Deinitialize()
 {
-	RecentEvents.Empty();
+	if (PerfTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(PerfTickerHandle);
+		PerfTickerHandle.Reset();
+	}
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+	PostGarbageCollectHandle.Reset();
+	bPerfRunActive = false;
+
+#if !UE_BUILD_SHIPPING
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+	PostActorTickHandle.Reset();
+
+	NumEvents = 0;
+	NextEventSlot = 0;
+#endif
+	ResetInputLatency();
 	Super::Deinitialize();
 }
 
@@ -66,43 +192,23 @@ UGameDebugSubsystem* UGameDebugSubsystem::Get(const UObject* WorldContextObject)
 
 void UGameDebugSubsystem::LogEvent(EDebugCategory Category, const FString& Message, bool bAlsoLogToConsole)
 {
-	if (!bDebugEnabled)
-	{
-		return;
-	}
-	
-	// Check if category is enabled
-	if (!IsCategoryEnabled(Category))
+#if !UE_BUILD_SHIPPING
+	const int32 Slot = NextEventSlot;
+	if (!PushEvent(Category, EDebugEventId::Custom))
 	{
 		return;
 	}
-	
-	// Add to recent events
-	FDebugEvent Event;
-	Event.Category = Category;
-	Event.Message = Message;
-	Event.Timestamp = FPlatformTime::Seconds();
-	RecentEvents.Insert(Event, 0);
-	
-	// Trim to max size
-	while (RecentEvents.Num() > MaxEventLogSize)
-	{
-		RecentEvents.RemoveAt(RecentEvents.Num() - 1);
-	}
-	
-	// Show on screen immediately
-	if (GEngine)
-	{
-		FColor Color = GetCategoryColor(Category);
-		FString DisplayText = FString::Printf(TEXT("[%s] %s"), *GetCategoryName(Category), *Message);
-		GEngine->AddOnScreenDebugMessage(-1, EventDisplayDuration, Color, DisplayText);
-	}
-	
+
+	// Formatted once here; the display reuses it every frame
+	EventText[Slot] = FString::Printf(TEXT("[%s] %s"), *GetCategoryName(Category), *Message);
+	Events[Slot].bFormatted = true;
+
 	// Also log to console if requested
 	if (bAlsoLogToConsole)
 	{
 		UE_LOG(LogStateRunner_Arcade, Log, TEXT("[%s] %s"), *GetCategoryName(Category), *Message);
 	}
+#endif
 }
 
 void UGameDebugSubsystem::LogError(const FString& Message)
@@ -160,39 +266,54 @@ bool UGameDebugSubsystem::IsCategoryEnabled(EDebugCategory Category) const
 
 void UGameDebugSubsystem::UpdateDisplay()
 {
+#if !UE_BUILD_SHIPPING
 	if (!bDebugEnabled || !GEngine)
 	{
 		return;
 	}
 	
-	PruneOldEvents();
-	
-	// Display stat summary (Key 100 = persistent slot for stats)
+	// Display stat summary (Key 100 = persistent slot for stats, 99 = input latency, 98 = memory budget)
 	if (bShowStatSummary)
 	{
 		FString StatSummary = BuildStatSummary();
 		GEngine->AddOnScreenDebugMessage(100, 0.0f, FColor::Cyan, StatSummary);
+
+		if (InputToStepSamples.Num() > 0)
+		{
+			GEngine->AddOnScreenDebugMessage(99, 0.0f, FColor::Cyan, BuildInputLatencySummary());
+		}
+
+		if (const UHardwareTierSubsystem* HardwareTier = GetGameInstance()->GetSubsystem<UHardwareTierSubsystem>())
+		{
+			GEngine->AddOnScreenDebugMessage(98, 0.0f, HardwareTier->IsOverBudget() ? FColor::Red : FColor::Cyan, HardwareTier->BuildBudgetSummary());
+		}
 	}
 	
-	// Display event log (Keys 101-105 for events)
+	// Display event log (Keys 101+ for events, newest first)
 	if (bShowEventLog)
 	{
-		for (int32 i = 0; i < RecentEvents.Num() && i < MaxEventLogSize; i++)
+		const double CurrentTime = FPlatformTime::Seconds();
+		const int32 ShownCount = FMath::Min(NumEvents, FMath::Clamp(MaxEventLogSize, 0, EventRingCapacity));
+		for (int32 i = 0; i < ShownCount; i++)
 		{
-			const FDebugEvent& Event = RecentEvents[i];
-			float Age = FPlatformTime::Seconds() - Event.Timestamp;
+			const int32 Slot = GetEventSlot(i);
+			const float Age = static_cast<float>(CurrentTime - Events[Slot].Timestamp);
+
+			// Newest first, so everything after the first expired event has expired too
+			if (Age > EventDisplayDuration)
+			{
+				break;
+			}
 			
 			// Fade out as event ages
 			float Alpha = FMath::Clamp(1.0f - (Age / EventDisplayDuration), 0.2f, 1.0f);
-			FColor Color = GetCategoryColor(Event.Category);
+			FColor Color = GetCategoryColor(Events[Slot].Category);
 			Color.A = static_cast<uint8>(Alpha * 255);
 			
-			FString EventText = FString::Printf(TEXT("[%s] %s"), 
-				*GetCategoryName(Event.Category), *Event.Message);
-			
-			GEngine->AddOnScreenDebugMessage(101 + i, 0.0f, Color, EventText);
+			GEngine->AddOnScreenDebugMessage(101 + i, 0.0f, Color, GetEventText(Slot));
 		}
 	}
+#endif
 }
 
 FString UGameDebugSubsystem::GetCategoryName(EDebugCategory Category) const
@@ -205,6 +326,8 @@ FString UGameDebugSubsystem::GetCategoryName(EDebugCategory Category) const
 		case EDebugCategory::Overclock: return TEXT("OC");
 		case EDebugCategory::Movement:  return TEXT("MOVE");
 		case EDebugCategory::Tutorial:  return TEXT("TUTOR");
+		case EDebugCategory::Performance: return TEXT("PERF");
+		case EDebugCategory::Collision: return TEXT("COLL");
 		default:                        return TEXT("???");
 	}
 }
@@ -219,6 +342,8 @@ FColor UGameDebugSubsystem::GetCategoryColor(EDebugCategory Category) const
 		case EDebugCategory::Overclock: return FColor::Orange;
 		case EDebugCategory::Movement:  return FColor::Cyan;
 		case EDebugCategory::Tutorial:  return FColor::Magenta;
+		case EDebugCategory::Performance: return FColor::White;
+		case EDebugCategory::Collision: return FColor::Green;
 		default:                        return FColor::White;
 	}
 }
@@ -241,22 +366,600 @@ FString UGameDebugSubsystem::BuildStatSummary() const
 	);
 }
 
-FString UGameDebugSubsystem::BuildEventLog() const
+// --- Input Latency ---
+
+void UGameDebugSubsystem::RecordInputLatency(float InputToStepMs, float InputToPresentMs)
+{
+	InputToStepSamples.Add(InputToStepMs);
+	InputToPresentSamples.Add(InputToPresentMs);
+}
+
+void UGameDebugSubsystem::ResetInputLatency()
+{
+	InputToStepSamples.Reset();
+	InputToPresentSamples.Reset();
+}
+
+float UGameDebugSubsystem::GetInputLatencyPercentile(float Percentile, bool bToPresent) const
+{
+	const TArray<float>& Samples = bToPresent ? InputToPresentSamples : InputToStepSamples;
+	if (Samples.Num() == 0)
+	{
+		return 0.0f;
+	}
+
+	// Debug query only -- a sorted copy of a few hundred floats is fine
+	TArray<float> Sorted = Samples;
+	Sorted.Sort();
+
+	const int32 Index = FMath::Clamp(FMath::CeilToInt(Percentile / 100.0f * Sorted.Num()) - 1, 0, Sorted.Num() - 1);
+	return Sorted[Index];
+}
+
+FString UGameDebugSubsystem::BuildInputLatencySummary() const
+{
+	if (InputToStepSamples.Num() == 0)
+	{
+		return FString();
+	}
+
+	return FString::Printf(
+		TEXT("Input ms p50/95/99 | Step: %.1f/%.1f/%.1f | Present: %.1f/%.1f/%.1f | n=%d"),
+		GetInputLatencyPercentile(50.0f, false),
+		GetInputLatencyPercentile(95.0f, false),
+		GetInputLatencyPercentile(99.0f, false),
+		GetInputLatencyPercentile(50.0f, true),
+		GetInputLatencyPercentile(95.0f, true),
+		GetInputLatencyPercentile(99.0f, true),
+		InputToStepSamples.Num()
+	);
+}
+
+// --- Performance ---
+
+void UGameDebugSubsystem::FFrameTimeHistogram::Add(float FrameMs, bool bHitch)
+{
+	const int32 Bin = FMath::Clamp(FMath::FloorToInt(FrameMs / BinMs), 0, NumBins - 1);
+	Bins[Bin]++;
+	NumFrames++;
+	NumHitches += bHitch ? 1 : 0;
+	TotalMs += FrameMs;
+	MaxMs = FMath::Max(MaxMs, FrameMs);
+}
+
+float UGameDebugSubsystem::FFrameTimeHistogram::GetPercentile(float Percentile) const
+{
+	if (NumFrames == 0)
+	{
+		return 0.0f;
+	}
+
+	const uint32 Target = FMath::Max<uint32>(1, FMath::CeilToInt(Percentile / 100.0f * NumFrames));
+	uint32 Cumulative = 0;
+	for (int32 Bin = 0; Bin < NumBins - 1; Bin++)
+	{
+		Cumulative += Bins[Bin];
+		if (Cumulative >= Target)
+		{
+			return FMath::Min((Bin + 1) * BinMs, MaxMs);
+		}
+	}
+	return MaxMs;
+}
+
+uint32 UGameDebugSubsystem::FFrameTimeHistogram::CountBelow(float UpToMs) const
+{
+	const int32 EndBin = FMath::Clamp(FMath::FloorToInt(UpToMs / BinMs), 0, NumBins);
+	uint32 Count = 0;
+	for (int32 Bin = 0; Bin < EndBin; Bin++)
+	{
+		Count += Bins[Bin];
+	}
+	return Count;
+}
+
+void UGameDebugSubsystem::BeginPerfRun()
+{
+	RunFrameTimes = FFrameTimeHistogram();
+	BracketFrameTimes.Reset();
+	PerfRunStartDate = FDateTime::Now();
+	PerfRunStartSeconds = FPlatformTime::Seconds();
+	NextHitchSlot = 0;
+	NumHitchSnapshots = 0;
+	bPerfRunActive = true;
+	bSkipNextPerfFrame = true;
+}
+
+void UGameDebugSubsystem::EndPerfRun()
+{
+	if (!bPerfRunActive)
+	{
+		return;
+	}
+	bPerfRunActive = false;
+
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("GameDebugSubsystem: Run frame ms p50/95/99 %.1f/%.1f/%.1f, max %.1f, %u hitches over %u frames"),
+		RunFrameTimes.GetPercentile(50.0f), RunFrameTimes.GetPercentile(95.0f), RunFrameTimes.GetPercentile(99.0f),
+		RunFrameTimes.MaxMs, RunFrameTimes.NumHitches, RunFrameTimes.NumFrames);
+
+	if (CVarWriteRunPerfCsv.GetValueOnGameThread() != 0 && RunFrameTimes.NumFrames > 0)
+	{
+		WritePerfCsv();
+		if (NumHitchSnapshots > 0)
+		{
+			WriteHitchCsv();
+		}
+	}
+}
+
+bool UGameDebugSubsystem::HandlePerfTick(float DeltaTime)
+{
+	// Scope timers and frame events accumulate until sampled here, once per frame
+	float FrameScopeMs[static_cast<int32>(EStateRunnerScope::Count)];
+	for (int32 i = 0; i < static_cast<int32>(EStateRunnerScope::Count); i++)
+	{
+		FrameScopeMs[i] = static_cast<float>(FPlatformTime::ToMilliseconds64(GStateRunnerScopeCycles[i]));
+		GStateRunnerScopeCycles[i] = 0;
+	}
+	const EStateRunnerFrameEvent FrameEvents = GStateRunnerFrameEvents;
+	GStateRunnerFrameEvents = EStateRunnerFrameEvent::None;
+
+	const UWorld* World = GetGameInstance() ? GetGameInstance()->GetWorld() : nullptr;
+	if (bPerfRunActive && World && !World->IsPaused())
+	{
+		if (bSkipNextPerfFrame)
+		{
+			bSkipNextPerfFrame = false;
+		}
+		else
+		{
+			const float FrameMs = DeltaTime * 1000.0f;
+			const bool bHitch = FrameMs > CVarPerfHitchMs.GetValueOnGameThread();
+			const FIntPoint Bracket(Stat_DifficultyLevel, FMath::FloorToInt(Stat_ScrollSpeed / GameDebug_SpeedBracketSize));
+
+			RunFrameTimes.Add(FrameMs, bHitch);
+			BracketFrameTimes.FindOrAdd(Bracket).Add(FrameMs, bHitch);
+
+			if (bHitch)
+			{
+				CaptureHitch(FrameMs, FrameScopeMs, FrameEvents);
+			}
+		}
+	}
+
+#if !UE_BUILD_SHIPPING
+	for (int32 i = 0; i < static_cast<int32>(EStateRunnerScope::Count); i++)
+	{
+		ScopeMs[i] = FMath::Lerp(ScopeMs[i], FrameScopeMs[i], 0.1f);
+	}
+
+	if (bDebugEnabled && IsCategoryEnabled(EDebugCategory::Performance))
+	{
+		DrawPerfOverlay();
+	}
+#endif
+
+	return true;
+}
+
+void UGameDebugSubsystem::CaptureHitch(float FrameMs, const float* FrameScopeMs, EStateRunnerFrameEvent FrameEvents)
+{
+	FHitchSnapshot& Hitch = Hitches[NextHitchSlot];
+	NextHitchSlot = (NextHitchSlot + 1) % HitchRingCapacity;
+	NumHitchSnapshots = FMath::Min(NumHitchSnapshots + 1, HitchRingCapacity);
+
+	Hitch.RunSeconds = static_cast<float>(FPlatformTime::Seconds() - PerfRunStartSeconds);
+	Hitch.FrameMs = FrameMs;
+	FMemory::Memcpy(Hitch.ScopeMs, FrameScopeMs, sizeof(Hitch.ScopeMs));
+	Hitch.Events = FrameEvents;
+	Hitch.Segment = Stat_SegmentsSpawned;
+	Hitch.Difficulty = Stat_DifficultyLevel;
+	Hitch.ScrollSpeed = Stat_ScrollSpeed;
+	Hitch.ActiveObstacles = Stat_ActiveObstacles;
+	Hitch.PooledObstacles = Stat_PooledObstacles;
+	Hitch.ActivePickups = Stat_ActivePickups;
+	Hitch.PooledPickups = Stat_PooledPickups;
+
+	// Biggest gameplay scope, so the log line alone usually names the culprit
+	int32 TopScope = 0;
+	for (int32 i = 1; i < static_cast<int32>(EStateRunnerScope::Count); i++)
+	{
+		if (FrameScopeMs[i] > FrameScopeMs[TopScope])
+		{
+			TopScope = i;
+		}
+	}
+
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("GameDebugSubsystem: Hitch %.1f ms at %.1f s (segment %d): %s %.1f ms, events %s"),
+		FrameMs, Hitch.RunSeconds, Hitch.Segment, GameDebug_ScopeNames[TopScope], FrameScopeMs[TopScope],
+		*GameDebug_FrameEventsToString(FrameEvents));
+}
+
+bool UGameDebugSubsystem::WriteHitchCsv() const
+{
+	const FString Path = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Profiling"), TEXT("RunPerf"),
+		FString::Printf(TEXT("RunHitches_%s.csv"), *PerfRunStartDate.ToString(TEXT("%Y%m%d_%H%M%S"))));
+
+	FString Csv = TEXT("RunSeconds,FrameMs,Segment,Difficulty,ScrollSpeed,ActiveObstacles,PooledObstacles,ActivePickups,PooledPickups");
+	for (const TCHAR* ScopeName : GameDebug_ScopeNames)
+	{
+		Csv += FString::Printf(TEXT(",%sMs"), ScopeName);
+	}
+	Csv += TEXT(",Events\n");
+
+	// Oldest first
+	for (int32 i = NumHitchSnapshots - 1; i >= 0; i--)
+	{
+		const FHitchSnapshot& Hitch = Hitches[(NextHitchSlot - 1 - i + HitchRingCapacity) % HitchRingCapacity];
+		Csv += FString::Printf(TEXT("%.2f,%.2f,%d,%d,%.0f,%d,%d,%d,%d"),
+			Hitch.RunSeconds, Hitch.FrameMs, Hitch.Segment, Hitch.Difficulty, Hitch.ScrollSpeed,
+			Hitch.ActiveObstacles, Hitch.PooledObstacles, Hitch.ActivePickups, Hitch.PooledPickups);
+		for (float Ms : Hitch.ScopeMs)
+		{
+			Csv += FString::Printf(TEXT(",%.2f"), Ms);
+		}
+		Csv += FString::Printf(TEXT(",%s\n"), *GameDebug_FrameEventsToString(Hitch.Events));
+	}
+
+	if (!FFileHelper::SaveStringToFile(Csv, *Path))
+	{
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("GameDebugSubsystem: Could not write run hitch CSV %s"), *Path);
+		return false;
+	}
+
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("GameDebugSubsystem: %d hitch snapshots written to %s (%u hitches this run)"),
+		NumHitchSnapshots, *Path, RunFrameTimes.NumHitches);
+	return true;
+}
+
+bool UGameDebugSubsystem::WritePerfCsv()
+{
+	const FString Path = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Profiling"), TEXT("RunPerf"),
+		FString::Printf(TEXT("RunPerf_%s.csv"), *PerfRunStartDate.ToString(TEXT("%Y%m%d_%H%M%S"))));
+
+	const auto AppendRow = [](FString& Out, const TCHAR* Section, const FString& Difficulty, const FString& SpeedMin, const FString& SpeedMax, const FFrameTimeHistogram& Histogram)
+	{
+		Out += FString::Printf(TEXT("%s,%s,%s,%s,%u,%.1f,%.2f,%.2f,%.2f,%.2f,%.2f,%u\n"),
+			Section, *Difficulty, *SpeedMin, *SpeedMax,
+			Histogram.NumFrames, Histogram.TotalMs / 1000.0, Histogram.GetAverageMs(),
+			Histogram.GetPercentile(50.0f), Histogram.GetPercentile(95.0f), Histogram.GetPercentile(99.0f),
+			Histogram.MaxMs, Histogram.NumHitches);
+	};
+
+	FString Csv = TEXT("Section,Difficulty,SpeedMin,SpeedMax,Frames,Seconds,AvgMs,P50Ms,P95Ms,P99Ms,MaxMs,Hitches\n");
+	AppendRow(Csv, TEXT("Run"), FString(), FString(), FString(), RunFrameTimes);
+
+	// Difficulty, then speed
+	TArray<FIntPoint> Brackets;
+	BracketFrameTimes.GetKeys(Brackets);
+	Brackets.Sort([](const FIntPoint& A, const FIntPoint& B) { return A.X != B.X ? A.X < B.X : A.Y < B.Y; });
+	for (const FIntPoint& Bracket : Brackets)
+	{
+		AppendRow(Csv, TEXT("Bracket"), FString::FromInt(Bracket.X),
+			FString::SanitizeFloat(Bracket.Y * GameDebug_SpeedBracketSize, 0), FString::SanitizeFloat((Bracket.Y + 1) * GameDebug_SpeedBracketSize, 0),
+			BracketFrameTimes[Bracket]);
+	}
+
+	if (!FFileHelper::SaveStringToFile(Csv, *Path))
+	{
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("GameDebugSubsystem: Could not write run perf CSV %s"), *Path);
+		return false;
+	}
+
+	LastPerfCsvPath = Path;
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("GameDebugSubsystem: Run perf CSV written to %s"), *Path);
+	return true;
+}
+
+#if !UE_BUILD_SHIPPING
+void UGameDebugSubsystem::DrawPerfOverlay() const
+{
+	if (!GEngine)
+	{
+		return;
+	}
+
+	const FFrameTimeHistogram& Frames = RunFrameTimes;
+	GEngine->AddOnScreenDebugMessage(90, 0.0f, FColor::White, FString::Printf(
+		TEXT("PERF | Frame ms p50/95/99: %.1f/%.1f/%.1f | max %.1f | hitches %u | %u frames"),
+		Frames.GetPercentile(50.0f), Frames.GetPercentile(95.0f), Frames.GetPercentile(99.0f),
+		Frames.MaxMs, Frames.NumHitches, Frames.NumFrames));
+
+	// Histogram, one bar per bucket (a bar is 40 chars at 100%)
+	uint32 Below = 0;
+	for (int32 Bucket = 0; Bucket < UE_ARRAY_COUNT(GameDebug_OverlayBucketMs); Bucket++)
+	{
+		const float EdgeMs = GameDebug_OverlayBucketMs[Bucket];
+		const uint32 UpToEdge = EdgeMs < FLT_MAX ? Frames.CountBelow(EdgeMs) : Frames.NumFrames;
+		const uint32 InBucket = UpToEdge - Below;
+		Below = UpToEdge;
+
+		const float Fraction = Frames.NumFrames > 0 ? static_cast<float>(InBucket) / Frames.NumFrames : 0.0f;
+		const FString Label = EdgeMs < FLT_MAX ? FString::Printf(TEXT("<%4.1f"), EdgeMs) : FString(TEXT(" 50+ "));
+		GEngine->AddOnScreenDebugMessage(89 - Bucket, 0.0f, EdgeMs > 33.4f ? FColor::Red : FColor::White,
+			FString::Printf(TEXT("  %s ms %-40s %3.0f%%"), *Label, *FString::ChrN(FMath::RoundToInt(Fraction * 40.0f), TEXT('#')), Fraction * 100.0f));
+	}
+
+	FString Scopes = TEXT("ms");
+	for (int32 i = 0; i < static_cast<int32>(EStateRunnerScope::Count); i++)
+	{
+		Scopes += FString::Printf(TEXT(" | %s %.2f"), GameDebug_ScopeNames[i], ScopeMs[i]);
+	}
+	GEngine->AddOnScreenDebugMessage(81, 0.0f, FColor::White, Scopes);
+
+	GEngine->AddOnScreenDebugMessage(80, 0.0f, FColor::White, FString::Printf(
+		TEXT("Obs %d/%d | Pkp %d/%d | Spd %.0f | D %d"),
+		Stat_ActiveObstacles, Stat_PooledObstacles, Stat_ActivePickups, Stat_PooledPickups, Stat_ScrollSpeed, Stat_DifficultyLevel));
+}
+
+void UGameDebugSubsystem::HandleWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	// Every world broadcasts this (editor preview worlds too); only draw in this game's
+	if (!World || !GetGameInstance() || World != GetGameInstance()->GetWorld())
+	{
+		return;
+	}
+
+	ULineBatchComponent* LineBatcher = World->GetLineBatcher(UWorld::ELineBatcherType::World);
+	if (!LineBatcher)
+	{
+		return;
+	}
+
+	// Replace last frame's lines. Redrawn while paused too, so the boxes stay up for inspection.
+	LineBatcher->ClearBatch(GameDebug_CollisionBatchId);
+
+	CollisionLines.Reset();
+	BuildCollisionLines(World, bDebugEnabled && IsCategoryEnabled(EDebugCategory::Collision));
+	if (CollisionLines.Num() > 0)
+	{
+		LineBatcher->DrawLines(CollisionLines);
+	}
+}
+
+void UGameDebugSubsystem::BuildCollisionLines(UWorld* World, bool bDrawAll)
+{
+	const AStateRunner_ArcadeGameMode* GameMode = Cast<AStateRunner_ArcadeGameMode>(World->GetAuthGameMode());
+	if (!GameMode)
+	{
+		return;
+	}
+
+	// --- Collision boxes (colored by type) ---
+
+	const UObstacleSpawnerComponent* ObstacleSpawner = GameMode->GetObstacleSpawnerComponent();
+	if (ObstacleSpawner)
+	{
+		for (const ABaseObstacle* Obstacle : ObstacleSpawner->GetActiveObstacles())
+		{
+			const UBoxComponent* Box = IsValid(Obstacle) ? Obstacle->GetCollisionBox() : nullptr;
+			if (!Box || !(bDrawAll || Obstacle->IsDrawingDebugCollision()))
+			{
+				continue;
+			}
+
+			const FColor Color = GetObstacleTypeTraits(Obstacle->GetObstacleType()).DebugColor;
+			AddCollisionBox(Box->GetComponentLocation(), Box->GetScaledBoxExtent(), Color);
+		}
+	}
+
+	const UPickupSpawnerComponent* PickupSpawner = GameMode->GetPickupSpawnerComponent();
+	if (PickupSpawner)
+	{
+		for (const ABasePickup* Pickup : PickupSpawner->GetActivePickups())
+		{
+			const UBoxComponent* Box = IsValid(Pickup) ? Pickup->GetCollisionBox() : nullptr;
+			if (!Box || !(bDrawAll || Pickup->IsDrawingDebugCollision()))
+			{
+				continue;
+			}
+
+			const FColor Color = GetPickupTypeTraits(Pickup->GetPickupType()).DebugColor;
+			AddCollisionBox(Box->GetComponentLocation(), Box->GetScaledBoxExtent(), Color);
+		}
+	}
+
+	if (!bDrawAll)
+	{
+		return;
+	}
+
+	const UWorldScrollComponent* WorldScroll = GameMode->GetWorldScrollComponent();
+	if (!WorldScroll)
+	{
+		return;
+	}
+
+	// --- Lane query: runner bounds and the track X interval searched in the lane index ---
+
+	const ULaneCollisionComponent* LaneCollision = GameMode->GetLaneCollisionComponent();
+	const AStateRunner_ArcadeCharacter* Runner = Cast<AStateRunner_ArcadeCharacter>(UGameplayStatics::GetPlayerCharacter(World, 0));
+	if (LaneCollision && LaneCollision->IsAnalytic() && Runner)
+	{
+		const ULaneCollisionComponent::FResolveDebugState& Resolve = LaneCollision->GetLastResolve();
+		if (Resolve.RunnerBounds.IsValid)
+		{
+			AddCollisionBox(Resolve.RunnerBounds.GetCenter(), Resolve.RunnerBounds.GetExtent(), FColor::Green);
+
+			const float MinX = WorldScroll->TrackToWorldX(Resolve.MinTrackX);
+			const float MaxX = WorldScroll->TrackToWorldX(Resolve.MaxTrackX);
+			for (int32 Lane = 0; Lane < 3; Lane++)
+			{
+				if (Resolve.Lane != INDEX_NONE && Resolve.Lane != Lane)
+				{
+					continue;
+				}
+
+				// Interval along the lane, with end ticks across it
+				const float Y = Runner->GetLaneYPosition(static_cast<ELanePosition>(Lane));
+				const FColor Color = Resolve.NumCandidates > 0 ? FColor::Cyan : FColor::Blue;
+				CollisionLines.Emplace(FVector(MinX, Y, GameDebug_LaneDrawZ), FVector(MaxX, Y, GameDebug_LaneDrawZ), Color, 0.0f, 6.0f, SDPG_World, GameDebug_CollisionBatchId);
+				CollisionLines.Emplace(FVector(MinX, Y - 40.0f, GameDebug_LaneDrawZ), FVector(MinX, Y + 40.0f, GameDebug_LaneDrawZ), Color, 0.0f, 6.0f, SDPG_World, GameDebug_CollisionBatchId);
+				CollisionLines.Emplace(FVector(MaxX, Y - 40.0f, GameDebug_LaneDrawZ), FVector(MaxX, Y + 40.0f, GameDebug_LaneDrawZ), Color, 0.0f, 6.0f, SDPG_World, GameDebug_CollisionBatchId);
+			}
+		}
+	}
+
+	// --- Pickup placement occupancy grid (runs of blocked / edge buckets) ---
+
+	UPickupSpawnerComponent::FOccupancyGridView Grid;
+	if (PickupSpawner && PickupSpawner->GetOccupancyGridView(Grid))
+	{
+		// The grid is a track-space snapshot from when the segment spawned; move it with the track since
+		const float Drift = static_cast<float>(WorldScroll->GetPresentedScrollDistance() - Grid.ScrollDistance);
+		const float WorldOriginX = WorldScroll->TrackToWorldX(Grid.OriginX - Drift);
+
+		for (int32 Lane = 0; Lane < 3; Lane++)
+		{
+			const float Y = Grid.LaneY[Lane];
+			int32 Bucket = 0;
+			while (Bucket < Grid.BucketCount)
+			{
+				const bool bBlocked = Grid.Blocked[Lane][Bucket];
+				const bool bEdge = Grid.Edge[Lane][Bucket];
+				int32 RunEnd = Bucket + 1;
+				while (RunEnd < Grid.BucketCount && Grid.Blocked[Lane][RunEnd] == bBlocked && Grid.Edge[Lane][RunEnd] == bEdge)
+				{
+					RunEnd++;
+				}
+
+				// Free buckets stay undrawn; one line per run keeps a long segment to a few lines
+				if (bBlocked || bEdge)
+				{
+					const float StartX = WorldOriginX + Bucket * Grid.BucketSize;
+					const float EndX = WorldOriginX + RunEnd * Grid.BucketSize;
+					const FColor Color = bBlocked ? FColor::Red : FColor::Yellow;
+					CollisionLines.Emplace(FVector(StartX, Y + 20.0f, GameDebug_LaneDrawZ), FVector(EndX, Y + 20.0f, GameDebug_LaneDrawZ), Color, 0.0f, 10.0f, SDPG_World, GameDebug_CollisionBatchId);
+				}
+				Bucket = RunEnd;
+			}
+		}
+	}
+}
+
+void UGameDebugSubsystem::AddCollisionBox(const FVector& Center, const FVector& Extent, const FColor& Color)
+{
+	const FVector Corners[8] = {
+		Center + FVector(-Extent.X, -Extent.Y, -Extent.Z), Center + FVector(Extent.X, -Extent.Y, -Extent.Z),
+		Center + FVector(Extent.X, Extent.Y, -Extent.Z), Center + FVector(-Extent.X, Extent.Y, -Extent.Z),
+		Center + FVector(-Extent.X, -Extent.Y, Extent.Z), Center + FVector(Extent.X, -Extent.Y, Extent.Z),
+		Center + FVector(Extent.X, Extent.Y, Extent.Z), Center + FVector(-Extent.X, Extent.Y, Extent.Z),
+	};
+
+	// Bottom ring, top ring, verticals
+	for (int32 i = 0; i < 4; i++)
+	{
+		const int32 Next = (i + 1) % 4;
+		CollisionLines.Emplace(Corners[i], Corners[Next], Color, 0.0f, 4.0f, SDPG_World, GameDebug_CollisionBatchId);
+		CollisionLines.Emplace(Corners[i + 4], Corners[Next + 4], Color, 0.0f, 4.0f, SDPG_World, GameDebug_CollisionBatchId);
+		CollisionLines.Emplace(Corners[i], Corners[i + 4], Color, 0.0f, 4.0f, SDPG_World, GameDebug_CollisionBatchId);
+	}
+}
+#endif
+
+FString UGameDebugSubsystem::BuildEventLog()
 {
 	FString Log;
-	for (const FDebugEvent& Event : RecentEvents)
+#if !UE_BUILD_SHIPPING
+	for (int32 i = 0; i < NumEvents; i++)
 	{
-		Log += FString::Printf(TEXT("[%s] %s\n"), *GetCategoryName(Event.Category), *Event.Message);
+		Log += GetEventText(GetEventSlot(i));
+		Log += TEXT("\n");
 	}
+#endif
 	return Log;
 }
 
-void UGameDebugSubsystem::PruneOldEvents()
+// --- Event Ring Buffer ---
+
+#if !UE_BUILD_SHIPPING
+UGameDebugSubsystem::FDebugEvent* UGameDebugSubsystem::PushEvent(EDebugCategory Category, EDebugEventId Id)
 {
-	float CurrentTime = FPlatformTime::Seconds();
-	
-	RecentEvents.RemoveAll([this, CurrentTime](const FDebugEvent& Event)
+	if (!bDebugEnabled || !IsCategoryEnabled(Category))
 	{
-		return (CurrentTime - Event.Timestamp) > EventDisplayDuration;
-	});
+		return nullptr;
+	}
+
+	const int32 Slot = NextEventSlot;
+	NextEventSlot = (NextEventSlot + 1) % EventRingCapacity;
+	NumEvents = FMath::Min(NumEvents + 1, EventRingCapacity);
+
+	FDebugEvent& Event = Events[Slot];
+	Event = FDebugEvent();
+	Event.Timestamp = FPlatformTime::Seconds();
+	Event.Category = Category;
+	Event.Id = Id;
+	return &Event;
+}
+
+const FString& UGameDebugSubsystem::GetEventText(int32 Slot)
+{
+	FDebugEvent& Event = Events[Slot];
+	if (!Event.bFormatted)
+	{
+		EventText[Slot] = FormatEvent(Event);
+		Event.bFormatted = true;
+	}
+	return EventText[Slot];
+}
+
+FString UGameDebugSubsystem::FormatEvent(const FDebugEvent& Event) const
+{
+	const double* A = Event.Args;
+	const auto Int = [A](int32 Index) { return static_cast<int32>(A[Index]); };
+	const auto LaneName = [A](int32 Index)
+	{
+		switch (static_cast<ELane>(static_cast<int32>(A[Index])))
+		{
+			case ELane::Left:  return TEXT("Left");
+			case ELane::Right: return TEXT("Right");
+			default:           return TEXT("Center");
+		}
+	};
+
+	FString Message;
+	switch (Event.Id)
+	{
+		// Spawning
+		case EDebugEventId::PatternSpawned:           Message = FString::Printf(TEXT("Pattern: %s"), *Event.Name.ToString()); break;
+		case EDebugEventId::EMPClearedObstacles:      Message = FString::Printf(TEXT("EMP cleared %d obstacles"), Int(0)); break;
+		case EDebugEventId::TutorialObstaclesSpawned: Message = FString::Printf(TEXT("Tutorial obstacles spawned with intro offset: %.0f units (%.1fs at %.0f u/s)"), A[0], A[1], A[2]); break;
+		case EDebugEventId::ObstaclePoolExhausted:    Message = FString::Printf(TEXT("Pool %d exhausted at %d, expanding in-frame"), Int(0), Int(1)); break;
+		case EDebugEventId::ObstaclePrewarmDone:      Message = FString::Printf(TEXT("Obstacle prewarm done (LW:%d HB:%d FW:%d)"), Int(0), Int(1), Int(2)); break;
+		case EDebugEventId::InstanceBatchCreated:     Message = FString::Printf(TEXT("Instance batch %d created for %s"), Int(0), *Event.Name.ToString()); break;
+		case EDebugEventId::DifficultyChanged:        Message = FString::Printf(TEXT("Difficulty: %d"), Int(0)); break;
+		case EDebugEventId::EndgameReached:           Message = TEXT("ENDGAME - No more breathers!"); break;
+		case EDebugEventId::PickupPoolExhausted:      Message = FString::Printf(TEXT("Pickup pool %d exhausted at %d, expanding in-frame"), Int(0), Int(1)); break;
+		case EDebugEventId::PickupPrewarmDone:        Message = FString::Printf(TEXT("Pickup prewarm done (DP:%d 1Up:%d EMP:%d Mag:%d)"), Int(0), Int(1), Int(2), Int(3)); break;
+		case EDebugEventId::OneUpSpawned:             Message = Int(1) ? FString::Printf(TEXT("1-UP (FREE) %s lane"), LaneName(0)) : FString::Printf(TEXT("1-UP %s lane"), LaneName(0)); break;
+		case EDebugEventId::EMPSpawned:               Message = FString::Printf(TEXT("EMP %s lane"), LaneName(0)); break;
+		case EDebugEventId::MagnetSpawned:            Message = FString::Printf(TEXT("MAGNET %s lane"), LaneName(0)); break;
+		case EDebugEventId::PickupShowcaseSpawned:    Message = Int(0) ? TEXT("Pickup Showcase: EMP | Magnet | 1-Up spawned") : TEXT("Pickup Showcase: EMP | 1-Up | 1-Up spawned"); break;
+
+		// Score
+		case EDebugEventId::InsaneCombo:              Message = FString::Printf(TEXT("INSANE 10x COMBO! +%d"), Int(0)); break;
+		case EDebugEventId::NiceCombo:                Message = FString::Printf(TEXT("NICE 6x COMBO! +%d (popup delayed %.1fs)"), Int(0), A[1]); break;
+		case EDebugEventId::NiceComboPopupShown:      Message = TEXT("NICE 6x COMBO popup shown (delay expired)"); break;
+		case EDebugEventId::OneUpScoreBonus:          Message = FString::Printf(TEXT("+%d 1-UP Bonus!"), Int(0)); break;
+		case EDebugEventId::EMPBonus:                 Message = FString::Printf(TEXT("EMP! %d obstacles +%d"), Int(0), Int(1)); break;
+		case EDebugEventId::EMPOverclockBoost:        Message = TEXT("EMP! +OVERCLOCK Boost"); break;
+		case EDebugEventId::MagnetCollected:          Message = TEXT("MAGNET collected!"); break;
+		case EDebugEventId::NewHighScore:             Message = TEXT("NEW HIGH SCORE!"); break;
+
+		// Lives
+		case EDebugEventId::LifeLost:                 Message = FString::Printf(TEXT("Damage! Lives: %d"), Int(0)); break;
+		case EDebugEventId::LifeGained:               Message = FString::Printf(TEXT("+%d Life (%d/%d)"), Int(0), Int(1), Int(2)); break;
+		case EDebugEventId::OneUpAtFullHealth:        Message = TEXT("1-UP -> Score Bonus (Full Health)"); break;
+		case EDebugEventId::GameOver:                 Message = TEXT("GAME OVER"); break;
+
+		// Overclock
+		case EDebugEventId::OverclockActivated:       Message = TEXT("OVERCLOCK ACTIVATED!"); break;
+		case EDebugEventId::OverclockEnded:           Message = TEXT("OVERCLOCK ended"); break;
+		case EDebugEventId::OverclockBonusActive:     Message = TEXT("OVERCLOCK Bonus Active!"); break;
+
+		default:                                      Message = TEXT("???"); break;
+	}
+
+	return FString::Printf(TEXT("[%s] %s"), *GetCategoryName(Event.Category), *Message);
 }
+#endif
@@ -2,6 +2,9 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Containers/Ticker.h"
+#include "Components/LineBatchComponent.h"
+#include "StateRunner_Arcade.h"
 #include "GameDebugSubsystem.generated.h"
 
 /**
@@ -18,10 +21,62 @@ enum class EDebugCategory : uint8
 	Overclock   = 1 << 3   UMETA(DisplayName = "Overclock"),     // OVERCLOCK state
 	Movement    = 1 << 4   UMETA(DisplayName = "Movement"),      // Jump, slide, lane
 	Tutorial    = 1 << 5   UMETA(DisplayName = "Tutorial"),      // Tutorial prompts
+	Performance = 1 << 6   UMETA(DisplayName = "Performance"),   // Frame time overlay
+	Collision   = 1 << 7   UMETA(DisplayName = "Collision"),     // Collision boxes, lane query, occupancy grid
 	All         = 0xFF     UMETA(DisplayName = "All")
 };
 ENUM_CLASS_FLAGS(EDebugCategory);
 
+/**
+ * Gameplay events recorded by id. The event log stores the id and up to four numeric
+ * arguments (plus an optional name); the text for each id is built in
+ * UGameDebugSubsystem::FormatEvent, and only when the event log is on screen.
+ */
+enum class EDebugEventId : uint8
+{
+	/** Preformatted message from LogEvent (Blueprint, rare events) */
+	Custom,
+
+	// Spawning
+	PatternSpawned,				// Name = pattern
+	EMPClearedObstacles,		// count
+	TutorialObstaclesSpawned,	// intro offset, intro duration, scroll speed
+	ObstaclePoolExhausted,		// type, pool size
+	ObstaclePrewarmDone,		// low wall, high barrier, full wall pool sizes
+	InstanceBatchCreated,		// batch index; Name = mesh
+	DifficultyChanged,			// level
+	EndgameReached,
+	PickupPoolExhausted,		// type, pool size
+	PickupPrewarmDone,			// data packet, 1-up, EMP, magnet pool sizes
+	OneUpSpawned,				// lane, guaranteed (0/1)
+	EMPSpawned,					// lane
+	MagnetSpawned,				// lane
+	PickupShowcaseSpawned,		// has magnet (0/1)
+
+	// Score
+	InsaneCombo,				// bonus
+	NiceCombo,					// bonus, popup delay
+	NiceComboPopupShown,
+	OneUpScoreBonus,			// bonus
+	EMPBonus,					// obstacles destroyed, bonus
+	EMPOverclockBoost,
+	MagnetCollected,
+	NewHighScore,
+
+	// Lives
+	LifeLost,					// lives left
+	LifeGained,					// amount, lives, max lives
+	OneUpAtFullHealth,
+	GameOver,
+
+	// Overclock
+	OverclockActivated,
+	OverclockEnded,
+	OverclockBonusActive,
+
+	Count
+};
+
 /**
  * Game Debug Subsystem
  * 
@@ -32,8 +87,28 @@ ENUM_CLASS_FLAGS(EDebugCategory);
  * Shows a compact on-screen debug summary with category-based filtering
  * and a scrolling event log. Toggle on/off via console or Blueprint.
  * 
- * Use LogEvent() for important gameplay events and UpdateStat() for
- * persistent stat values. The display auto-updates every tick.
+ * Use RecordEvent() for gameplay events from native code (an id plus numbers, formatted
+ * only when the event log is drawn), LogEvent() for Blueprint or one-off messages, and the
+ * Stat_ values for persistent stats. Events live in a fixed ring buffer; recording and
+ * the overlay compile out in Shipping.
+ *
+ * Frame times are recorded per run (BeginPerfRun / EndPerfRun) into histograms, overall and
+ * per (difficulty, scroll speed bracket); at game over they're written to
+ * Saved/Profiling/RunPerf/RunPerf_<date>.csv -- in every build, so cabinets can send them in
+ * (StateRunner.Perf.WriteRunCsv 0 turns it off). The Performance category adds an overlay
+ * with the histogram, percentiles, per-subsystem ms and pool counts (Debug.TogglePerf).
+ *
+ * Hitch detector: a run frame over StateRunner.Perf.HitchMs captures a snapshot of what
+ * ran that frame -- ms per EStateRunnerScope (spawners, fair layout, theme refresh, save
+ * I/O...), the EStateRunnerFrameEvent flags (pool expansion, widget construction, GC),
+ * active/pooled counts, segment, difficulty and speed. The last HitchRingCapacity snapshots
+ * are kept and written next to the perf CSV at game over (RunHitches_<date>.csv).
+ *
+ * The Collision category (Debug.ToggleCollision) draws, once per frame after actors tick and
+ * as a single line batch submit: every active obstacle and pickup collision box, the runner
+ * bounds and lane interval the last analytic collision resolve queried, and the pickup
+ * spawner's occupancy grid (red = blocked, yellow = edge bucket). Obstacle/pickup classes
+ * with bDrawDebugCollision get their boxes drawn even with the category off.
  */
 UCLASS()
 class STATERUNNER_ARCADE_API UGameDebugSubsystem : public UGameInstanceSubsystem
@@ -53,9 +128,9 @@ public:
 	UPROPERTY(BlueprintReadWrite, Category="Debug")
 	bool bDebugEnabled = false;  // Off by default for production
 
-	/** Which categories to display (bitmask). */
+	/** Which categories to display (bitmask). The Performance overlay and Collision draw start off (Debug.TogglePerf / Debug.ToggleCollision). */
 	UPROPERTY(BlueprintReadWrite, Category="Debug")
-	int32 EnabledCategories = static_cast<int32>(EDebugCategory::All);
+	int32 EnabledCategories = static_cast<int32>(EDebugCategory::All) & ~static_cast<int32>(EDebugCategory::Performance | EDebugCategory::Collision);
 
 	/** Show the compact stat summary on screen. */
 	UPROPERTY(BlueprintReadWrite, Category="Debug")
@@ -65,7 +140,7 @@ public:
 	UPROPERTY(BlueprintReadWrite, Category="Debug")
 	bool bShowEventLog = true;
 
-	/** Maximum events to keep in the log. */
+	/** Maximum events shown in the log (up to EventRingCapacity). */
 	UPROPERTY(BlueprintReadWrite, Category="Debug")
 	int32 MaxEventLogSize = 5;
 
@@ -107,12 +182,100 @@ public:
 	/** Last pattern used */
 	FString Stat_LastPattern = TEXT("None");
 
+	/** Pooled actors (active + free), all types */
+	int32 Stat_PooledObstacles = 0;
+	int32 Stat_PooledPickups = 0;
+
+	//=========================================================================
+	// PERFORMANCE (per run)
+	//=========================================================================
+
+	/** Start recording frame times for a new run (called when a runner spawns) */
+	void BeginPerfRun();
+
+	/** Stop recording and write the run's CSV (called at game over) */
+	void EndPerfRun();
+
+	/** Frame time percentile for the current run (ms, 0 before the first frame) */
+	UFUNCTION(BlueprintPure, Category="Debug|Performance")
+	float GetFrameTimePercentile(float Percentile) const { return RunFrameTimes.GetPercentile(Percentile); }
+
+	/** Where the last run's CSV went (empty if none was written) */
+	UFUNCTION(BlueprintPure, Category="Debug|Performance")
+	FString GetLastPerfCsvPath() const { return LastPerfCsvPath; }
+
+	/** Hitch snapshots held for the current run (the most recent HitchRingCapacity) */
+	UFUNCTION(BlueprintPure, Category="Debug|Performance")
+	int32 GetHitchSnapshotCount() const { return NumHitchSnapshots; }
+
+	//=========================================================================
+	// INPUT LATENCY (per run)
+	//=========================================================================
+
+	/**
+	 * Record one accepted input's latency.
+	 *
+	 * @param InputToStepMs Input event to the first movement commit that reacted
+	 * @param InputToPresentMs Input event to the end of the viewport draw showing it
+	 */
+	void RecordInputLatency(float InputToStepMs, float InputToPresentMs);
+
+	/** Drop this run's latency samples (called when a new runner spawns) */
+	void ResetInputLatency();
+
+	/**
+	 * Latency percentile for the current run.
+	 *
+	 * @param Percentile 0-100 (e.g. 50, 95, 99)
+	 * @param bToPresent True for input-to-present, false for input-to-step
+	 * @return Milliseconds, or 0 if nothing was recorded yet
+	 */
+	UFUNCTION(BlueprintPure, Category="Debug|Input Latency")
+	float GetInputLatencyPercentile(float Percentile, bool bToPresent) const;
+
+	/** Number of inputs measured this run */
+	UFUNCTION(BlueprintPure, Category="Debug|Input Latency")
+	int32 GetInputLatencySampleCount() const { return InputToStepSamples.Num(); }
+
+	/** One-line p50/p95/p99 summary (empty if nothing was recorded) */
+	FString BuildInputLatencySummary() const;
+
 	//=========================================================================
 	// PUBLIC FUNCTIONS
 	//=========================================================================
 
 	/**
-	 * Log a debug event that will appear in the event log.
+	 * Record a gameplay event for the event log. Only the id and its numeric arguments are
+	 * stored; see EDebugEventId for what each id takes. No-op while the display or the
+	 * category is off, and in Shipping.
+	 */
+	template<typename... ArgTypes>
+	FORCEINLINE void RecordEvent(EDebugCategory Category, EDebugEventId Id, ArgTypes... Args)
+	{
+		RecordNamedEvent(Category, Id, NAME_None, Args...);
+	}
+
+	/** RecordEvent for ids that also carry a name (FName or TCHAR*, only converted if recorded) */
+	template<typename NameType, typename... ArgTypes>
+	FORCEINLINE void RecordNamedEvent(EDebugCategory Category, EDebugEventId Id, const NameType& Name, ArgTypes... Args)
+	{
+#if !UE_BUILD_SHIPPING
+		static_assert(sizeof...(ArgTypes) <= MaxEventArgs, "Debug events carry at most MaxEventArgs arguments");
+		if (FDebugEvent* Event = PushEvent(Category, Id))
+		{
+			const double Values[] = { 0.0, static_cast<double>(Args)... };
+			for (int32 i = 0; i < static_cast<int32>(sizeof...(ArgTypes)); i++)
+			{
+				Event->Args[i] = Values[i + 1];
+			}
+			Event->Name = FName(Name);
+		}
+#endif
+	}
+
+	/**
+	 * Log a preformatted debug event that will appear in the event log.
+	 * Prefer RecordEvent from native code -- this builds its string even when nothing is shown.
 	 * 
 	 * @param Category Which category this event belongs to
 	 * @param Message Short message describing the event
@@ -175,14 +338,161 @@ protected:
 	// INTERNAL STATE
 	//=========================================================================
 
-	/** Recent events with timestamps */
+	/** Events kept in the ring buffer (and the most the event log can show) */
+	static constexpr int32 EventRingCapacity = 16;
+
+	/** Numeric arguments per event */
+	static constexpr int32 MaxEventArgs = 4;
+
+	/** One recorded event; fixed size, no allocations */
 	struct FDebugEvent
 	{
-		EDebugCategory Category;
-		FString Message;
-		float Timestamp;
+		double Timestamp = 0.0;
+		double Args[MaxEventArgs] = {};
+		FName Name;
+		EDebugCategory Category = EDebugCategory::None;
+		EDebugEventId Id = EDebugEventId::Custom;
+
+		/** EventText for this slot is built (always true for Custom) */
+		bool bFormatted = false;
 	};
-	TArray<FDebugEvent> RecentEvents;
+
+#if !UE_BUILD_SHIPPING
+	/** Ring buffer of recent events; NextEventSlot is where the next one goes */
+	FDebugEvent Events[EventRingCapacity];
+
+	/** Display text per slot, built the first time the slot is drawn */
+	FString EventText[EventRingCapacity];
+
+	int32 NextEventSlot = 0;
+	int32 NumEvents = 0;
+
+	/** Claim the next ring slot (overwriting the oldest); null if the event would not be shown */
+	FDebugEvent* PushEvent(EDebugCategory Category, EDebugEventId Id);
+
+	/** Build the display text for an event ("[CATEGORY] message") */
+	FString FormatEvent(const FDebugEvent& Event) const;
+
+	/** Slot of the Nth newest event (0 = newest) */
+	int32 GetEventSlot(int32 NewestIndex) const { return (NextEventSlot - 1 - NewestIndex + EventRingCapacity) % EventRingCapacity; }
+
+	/** Display text for a slot, formatted on first use */
+	const FString& GetEventText(int32 Slot);
+#endif
+
+	/**
+	 * Frame time histogram: fixed 0.25 ms bins up to 100 ms (the last bin collects anything
+	 * longer), so percentiles cost no per-frame allocation or sorting.
+	 */
+	struct FFrameTimeHistogram
+	{
+		static constexpr float BinMs = 0.25f;
+		static constexpr int32 NumBins = 400;
+
+		uint32 Bins[NumBins] = {};
+		uint32 NumFrames = 0;
+		uint32 NumHitches = 0;
+		double TotalMs = 0.0;
+		float MaxMs = 0.0f;
+
+		void Add(float FrameMs, bool bHitch);
+
+		/** Upper edge of the bin holding the percentile (ms) */
+		float GetPercentile(float Percentile) const;
+
+		/** Frames shorter than UpToMs */
+		uint32 CountBelow(float UpToMs) const;
+
+		float GetAverageMs() const { return NumFrames > 0 ? static_cast<float>(TotalMs / NumFrames) : 0.0f; }
+	};
+
+	/** Whole run */
+	FFrameTimeHistogram RunFrameTimes;
+
+	/** Per (difficulty level, scroll speed bracket) */
+	TMap<FIntPoint, FFrameTimeHistogram> BracketFrameTimes;
+
+	bool bPerfRunActive = false;
+
+	/** The first frame after BeginPerfRun carries level load / spawn time; skip it */
+	bool bSkipNextPerfFrame = false;
+
+	FDateTime PerfRunStartDate;
+	FString LastPerfCsvPath;
+
+	/** FPlatformTime::Seconds at BeginPerfRun (hitch timestamps) */
+	double PerfRunStartSeconds = 0.0;
+
+	/** Hitch snapshots kept per run (oldest overwritten) */
+	static constexpr int32 HitchRingCapacity = 32;
+
+	/** What ran during one over-budget frame */
+	struct FHitchSnapshot
+	{
+		/** Seconds into the run */
+		float RunSeconds = 0.0f;
+		float FrameMs = 0.0f;
+
+		/** Ms spent in each EStateRunnerScope that frame */
+		float ScopeMs[static_cast<int32>(EStateRunnerScope::Count)] = {};
+
+		EStateRunnerFrameEvent Events = EStateRunnerFrameEvent::None;
+
+		int32 Segment = 0;
+		int32 Difficulty = 0;
+		float ScrollSpeed = 0.0f;
+		int32 ActiveObstacles = 0;
+		int32 PooledObstacles = 0;
+		int32 ActivePickups = 0;
+		int32 PooledPickups = 0;
+	};
+
+	/** Ring of this run's hitches; NextHitchSlot is where the next one goes */
+	FHitchSnapshot Hitches[HitchRingCapacity];
+	int32 NextHitchSlot = 0;
+	int32 NumHitchSnapshots = 0;
+
+	FDelegateHandle PostGarbageCollectHandle;
+
+	/** Snapshot an over-budget frame into the ring and log a one-line attribution */
+	void CaptureHitch(float FrameMs, const float* FrameScopeMs, EStateRunnerFrameEvent FrameEvents);
+
+	/** Write the run's hitch snapshots as CSV, oldest first; returns false if the file couldn't be written */
+	bool WriteHitchCsv() const;
+
+	FTSTicker::FDelegateHandle PerfTickerHandle;
+
+	/** Per-frame: record the frame and draw the overlay */
+	bool HandlePerfTick(float DeltaTime);
+
+	/** Write the run's histograms as CSV; returns false if the file couldn't be written */
+	bool WritePerfCsv();
+
+#if !UE_BUILD_SHIPPING
+	/** Smoothed ms per EStateRunnerScope (from GStateRunnerScopeCycles) */
+	float ScopeMs[static_cast<int32>(EStateRunnerScope::Count)] = {};
+
+	/** Draw the Performance overlay (keys 80-90) */
+	void DrawPerfOverlay() const;
+
+	FDelegateHandle PostActorTickHandle;
+
+	/** Lines for this frame's collision draw, submitted in one DrawLines call (reused) */
+	TArray<FBatchedLine> CollisionLines;
+
+	/** After every actor ticked (paused too): build and submit the collision draw */
+	void HandleWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+	/** Fill CollisionLines for World's boxes, lane query and occupancy grid */
+	void BuildCollisionLines(UWorld* World, bool bDrawAll);
+
+	/** Append a box's 12 edges to CollisionLines */
+	void AddCollisionBox(const FVector& Center, const FVector& Extent, const FColor& Color);
+#endif
+
+	/** This run's input latency samples (ms), unsorted */
+	TArray<float> InputToStepSamples;
+	TArray<float> InputToPresentSamples;
 
 	/** Get category name for display */
 	FString GetCategoryName(EDebugCategory Category) const;
@@ -194,8 +504,5 @@ protected:
 	FString BuildStatSummary() const;
 
 	/** Build the event log string */
-	FString BuildEventLog() const;
-
-	/** Prune old events */
-	void PruneOldEvents();
+	FString BuildEventLog();
 };
@@ -3,6 +3,7 @@
 #include "Components/ProgressBar.h"
 #include "Components/Image.h"
 #include "Components/HorizontalBox.h"
+#include "Components/InvalidationBox.h"
 #include "Components/CanvasPanelSlot.h"
 #include "TimerManager.h"
 #include "StateRunner_ArcadeGameMode.h"
@@ -11,8 +12,18 @@
 #include "OverclockSystemComponent.h"
 #include "ObstacleSpawnerComponent.h"
 #include "WorldScrollComponent.h"
+#include "DifficultyDirectorComponent.h"
+#include "VersusModeComponent.h"
+#include "WidgetTweenSubsystem.h"
 #include "StateRunner_Arcade.h"
 
+namespace
+{
+	/** UWidgetTweenSubsystem channels for the two popups */
+	const FName TutorialPopupTween(TEXT("TutorialPopup"));
+	const FName PickupPopupTween(TEXT("PickupPopup"));
+}
+
 UGameHUDWidget::UGameHUDWidget(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -22,6 +33,9 @@ void UGameHUDWidget::NativeConstruct()
 {
 	Super::NativeConstruct();
 
+	BuildCachedTexts();
+	ConfigureInvalidationRegions();
+
 	// Initialize the HUD
 	InitializeHUD();
 }
@@ -37,6 +51,12 @@ void UGameHUDWidget::NativeDestruct()
 		World->GetTimerManager().ClearTimer(ControlsTutorialTimerHandle);
 	}
 
+	// Drop popup tweens (their completions would touch widgets that are going away)
+	if (UWidgetTweenSubsystem* Tweens = UWidgetTweenSubsystem::Get(this))
+	{
+		Tweens->StopAllTweens(this);
+	}
+
 	// Unbind from Score System events
 	if (ScoreSystem)
 	{
@@ -88,46 +108,46 @@ void UGameHUDWidget::NativeDestruct()
 	OverclockSystem = nullptr;
 	ObstacleSpawner = nullptr;
 	WorldScroll = nullptr;
+	DifficultyDirector = nullptr;
 
 	Super::NativeDestruct();
 }
 
 void UGameHUDWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
 {
+	STATERUNNER_SCOPE_CYCLE_COUNTER(HUDTick);
+
 	Super::NativeTick(MyGeometry, InDeltaTime);
 
-	// Poll OVERCLOCK meter every frame for smooth display
-	// (Events only fire when change > 0.1, which causes stuttery updates)
-	if (OverclockSystem)
-	{
-		UpdateOverclockDisplay(OverclockSystem->GetCurrentMeter(), 100.0f);
-	}
+	// Meter and speed come in through (thresholded) events; ease between them here
+	// instead of polling and re-setting the text every frame
+	TickDisplayedValues(InDeltaTime);
 
-	// Update OVERCLOCK meter color based on state
+	// Update OVERCLOCK meter color based on state (only pushed when the state changes)
 	UpdateOverclockMeterColor();
 
-	// Poll speed display every frame for smooth updates
-	// (Events only fire when change > 50 units, which causes stuttery updates)
-	if (WorldScroll)
+	// Score is computed on demand from the gameplay clock -- only push text when it changes
+	if (ScoreSystem)
 	{
-		UpdateSpeedDisplay(WorldScroll->GetCurrentScrollSpeed());
+		const int32 Score = ScoreSystem->GetCurrentScore();
+		if (Score != CachedDisplayedScore)
+		{
+			UpdateScoreDisplay(Score);
+		}
+
+		const int32 ScoreRate = ScoreSystem->GetCurrentScoreRate();
+		if (ScoreRate != CachedDisplayedScoreRate)
+		{
+			HandleScoreRateChanged(ScoreRate);
+		}
 	}
 
 	// Update difficulty display when level changes
 	if (DifficultyText)
 	{
-		// Check if we've hit max BASE speed (3500 units/sec, excluding overclock multiplier)
-		const float MaxSpeedThreshold = 3500.0f;
-		bool bAtMaxSpeed = false;
-		
-		if (WorldScroll)
-		{
-			// Calculate base speed by dividing out the overclock multiplier
-			float CurrentSpeed = WorldScroll->GetCurrentScrollSpeed();
-			float OverclockMultiplier = WorldScroll->GetOverclockMultiplier();
-			float BaseSpeed = (OverclockMultiplier > 0.0f) ? (CurrentSpeed / OverclockMultiplier) : CurrentSpeed;
-			bAtMaxSpeed = BaseSpeed >= MaxSpeedThreshold;
-		}
+		// MAX SPEED once the base speed curve has topped out (OVERCLOCK and damage slowdown don't count)
+		const bool bAtMaxSpeed = WorldScroll && DifficultyDirector
+			&& WorldScroll->GetTimeElapsed() >= DifficultyDirector->GetTimeToMaxScrollSpeed();
 		
 		if (bAtMaxSpeed)
 		{
@@ -149,26 +169,8 @@ void UGameHUDWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
 		}
 	}
 
-	// Process popup animations (grow-in and shrink-out)
-	if (bTutorialPopupShrinking)
-	{
-		UpdateTutorialShrinkAnimation(InDeltaTime);
-	}
-
-	if (bTutorialPopupGrowing)
-	{
-		UpdateTutorialGrowAnimation(InDeltaTime);
-	}
-
-	if (bPickupPopupShrinking)
-	{
-		UpdatePickupShrinkAnimation(InDeltaTime);
-	}
-
-	if (bPickupPopupGrowing)
-	{
-		UpdatePickupGrowAnimation(InDeltaTime);
-	}
+	// Popup grow/shrink itself runs on UWidgetTweenSubsystem
+	UpdatePopupVolatility();
 }
 
 // --- Initialization ---
@@ -190,7 +192,7 @@ void UGameHUDWidget::InitializeHUD()
 		UpdateScoreDisplay(ScoreSystem->GetCurrentScore());
 		if (HighScoreText)
 		{
-			HighScoreText->SetText(FText::FromString(FString::Printf(TEXT("HS: %d"), ScoreSystem->GetHighScore())));
+			HighScoreText->SetText(FText::Format(HighScoreTextFormat, AsPlainNumber(ScoreSystem->GetHighScore())));
 		}
 	}
 
@@ -246,12 +248,17 @@ void UGameHUDWidget::CacheComponentReferences()
 		return;
 	}
 
-	// Cache component references
-	ScoreSystem = GameMode->GetScoreSystemComponent();
-	LivesSystem = GameMode->GetLivesSystemComponent();
-	OverclockSystem = GameMode->GetOverclockSystemComponent();
+	// Cache component references (per-player ones are the owning player's -- a versus rival has its own)
+	if (const UVersusModeComponent* Versus = GameMode->GetVersusModeComponent())
+	{
+		const FVersusPlayerSystems PlayerSystems = Versus->GetPlayerSystems(Versus->GetPlayerSlot(GetOwningPlayer()));
+		ScoreSystem = PlayerSystems.ScoreSystem;
+		LivesSystem = PlayerSystems.LivesSystem;
+		OverclockSystem = PlayerSystems.OverclockSystem;
+	}
 	ObstacleSpawner = GameMode->GetObstacleSpawnerComponent();
 	WorldScroll = GameMode->GetWorldScrollComponent();
+	DifficultyDirector = GameMode->GetDifficultyDirectorComponent();
 
 }
 
@@ -322,15 +329,6 @@ void UGameHUDWidget::InitializeLifeIcons()
 
 void UGameHUDWidget::ShowTutorialPrompt(const FString& PromptText, float Duration)
 {
-	// Cancel any in-progress animations and reset
-	bTutorialPopupShrinking = false;
-	TutorialShrinkProgress = 0.0f;
-	bTutorialPopupGrowing = false;
-	TutorialGrowProgress = 0.0f;
-
-	// Start at scale 0 for grow-in animation
-	SetTutorialPopupScale(0.0f);
-
 	if (TutorialPromptText)
 	{
 		TutorialPromptText->SetText(FText::FromString(PromptText));
@@ -353,9 +351,8 @@ void UGameHUDWidget::ShowTutorialPrompt(const FString& PromptText, float Duratio
 		}
 	}
 
-	// Start grow-in animation
-	bTutorialPopupGrowing = true;
-	TutorialGrowProgress = 0.0f;
+	// Start grow-in animation (from scale 0)
+	StartTutorialPopupGrow();
 
 	// Set timer to START SHRINK (not immediate hide)
 	float ActualDuration = Duration > 0.0f ? Duration : TutorialPromptDuration;
@@ -369,11 +366,8 @@ void UGameHUDWidget::ShowTutorialPrompt(const FString& PromptText, float Duratio
 
 void UGameHUDWidget::HideTutorialPrompt()
 {
-	// Stop any in-progress animations
-	bTutorialPopupShrinking = false;
-	TutorialShrinkProgress = 0.0f;
-	bTutorialPopupGrowing = false;
-	TutorialGrowProgress = 0.0f;
+	// Stop any in-progress animation
+	StopPopupTween(TutorialPopupTween);
 
 	if (TutorialPromptText)
 	{
@@ -411,15 +405,6 @@ void UGameHUDWidget::ShowCountdownText(const FString& CountdownText, float Durat
 		return;
 	}
 
-	// Cancel any in-progress animations and reset
-	bTutorialPopupShrinking = false;
-	TutorialShrinkProgress = 0.0f;
-	bTutorialPopupGrowing = false;
-	TutorialGrowProgress = 0.0f;
-
-	// Start at scale 0 for grow-in animation
-	SetTutorialPopupScale(0.0f);
-
 	// Use the tutorial prompt text widget to display countdown
 	if (TutorialPromptText)
 	{
@@ -450,9 +435,8 @@ void UGameHUDWidget::ShowCountdownText(const FString& CountdownText, float Durat
 		}
 	}
 
-	// Start grow-in animation
-	bTutorialPopupGrowing = true;
-	TutorialGrowProgress = 0.0f;
+	// Start grow-in animation (from scale 0)
+	StartTutorialPopupGrow();
 
 	// Set timer to START SHRINK (not immediate hide)
 	float ActualDuration = Duration > 0.0f ? Duration : 0.9f;
@@ -483,19 +467,26 @@ void UGameHUDWidget::NotifyCountdownFinished()
 
 void UGameHUDWidget::UpdateScoreDisplay(int32 Score)
 {
+	if (Score == CachedDisplayedScore)
+	{
+		return;
+	}
+	CachedDisplayedScore = Score;
+
 	if (ScoreText)
 	{
-		ScoreText->SetText(FText::FromString(FString::Printf(TEXT("SCORE: %d"), Score)));
+		ScoreText->SetText(FText::Format(ScoreTextFormat, AsPlainNumber(Score)));
 	}
 }
 
 void UGameHUDWidget::UpdateLivesDisplay(int32 CurrentLives, int32 MaxLives)
 {
 	// Update text display
-	if (LivesText)
+	if (LivesText && CurrentLives != CachedLives)
 	{
-		LivesText->SetText(FText::FromString(FString::Printf(TEXT("x%d"), CurrentLives)));
+		LivesText->SetText(FText::Format(LivesTextFormat, AsPlainNumber(CurrentLives)));
 	}
+	CachedLives = CurrentLives;
 
 	// Update icon display
 	for (int32 i = 0; i < LifeIcons.Num(); i++)
@@ -518,24 +509,24 @@ void UGameHUDWidget::UpdateLivesDisplay(int32 CurrentLives, int32 MaxLives)
 
 void UGameHUDWidget::UpdateOverclockDisplay(float CurrentMeter, float MaxMeter)
 {
-	float Percent = MaxMeter > 0.0f ? CurrentMeter / MaxMeter : 0.0f;
+	TargetMeterPercent = FMath::Clamp(MaxMeter > 0.0f ? CurrentMeter / MaxMeter : 0.0f, 0.0f, 1.0f);
 
-	if (OverclockMeterBar)
+	// First value (or interpolation off) shows immediately; otherwise NativeTick eases toward it
+	if (DisplayedMeterPercent < 0.0f || DisplayInterpSpeed <= 0.0f)
 	{
-		OverclockMeterBar->SetPercent(Percent);
-	}
-
-	if (OverclockMeterText)
-	{
-		int32 PercentInt = FMath::RoundToInt(Percent * 100.0f);
-		OverclockMeterText->SetText(FText::FromString(FString::Printf(TEXT("%d%%"), PercentInt)));
+		DisplayedMeterPercent = TargetMeterPercent;
+		ApplyMeterDisplay(DisplayedMeterPercent);
 	}
 
 	// Update ready indicator
 	if (OverclockReadyText && OverclockSystem)
 	{
-		bool bCanActivate = OverclockSystem->CanActivateOverclock();
-		OverclockReadyText->SetVisibility(bCanActivate ? ESlateVisibility::Visible : ESlateVisibility::Collapsed);
+		const int8 ReadyVisible = OverclockSystem->CanActivateOverclock() ? 1 : 0;
+		if (ReadyVisible != CachedReadyVisible)
+		{
+			CachedReadyVisible = ReadyVisible;
+			OverclockReadyText->SetVisibility(ReadyVisible ? ESlateVisibility::Visible : ESlateVisibility::Collapsed);
+		}
 	}
 }
 
@@ -549,6 +540,7 @@ void UGameHUDWidget::UpdateOverclockActiveState(bool bIsActive)
 	// Hide ready text when active
 	if (OverclockReadyText && bIsActive)
 	{
+		CachedReadyVisible = 0;
 		OverclockReadyText->SetVisibility(ESlateVisibility::Collapsed);
 	}
 
@@ -569,13 +561,135 @@ void UGameHUDWidget::UpdateOverclockActiveState(bool bIsActive)
 
 void UGameHUDWidget::UpdateSpeedDisplay(float ScrollSpeed)
 {
-	if (SpeedText)
+	TargetScrollSpeed = FMath::Max(ScrollSpeed, 0.0f);
+
+	// First value (or interpolation off) shows immediately; otherwise NativeTick eases toward it
+	if (DisplayedScrollSpeed < 0.0f || DisplayInterpSpeed <= 0.0f)
+	{
+		DisplayedScrollSpeed = TargetScrollSpeed;
+		ApplySpeedDisplay(DisplayedScrollSpeed);
+	}
+}
+
+// --- Displayed Values ---
+
+void UGameHUDWidget::BuildCachedTexts()
+{
+	PercentTexts.Reset(101);
+	for (int32 i = 0; i <= 100; i++)
+	{
+		PercentTexts.Add(FText::FromString(FString::Printf(TEXT("%d%%"), i)));
+	}
+
+	ScoreTextFormat = FTextFormat(FText::FromString(TEXT("SCORE: {0}")));
+	ScoreRateTextFormat = FTextFormat(FText::FromString(TEXT("+{0}/sec")));
+	HighScoreTextFormat = FTextFormat(FText::FromString(TEXT("HS: {0}")));
+	LivesTextFormat = FTextFormat(FText::FromString(TEXT("x{0}")));
+}
+
+void UGameHUDWidget::ConfigureInvalidationRegions()
+{
+	for (UInvalidationBox* Box : { StaticChromeCache.Get(), StatusCache.Get(), PopupCache.Get() })
+	{
+		if (Box)
+		{
+			Box->SetCanCache(bUseInvalidationRegions);
+		}
+	}
+
+	// Repainted every frame anyway -- keep them from invalidating whatever contains them
+	for (UWidget* Volatile : { static_cast<UWidget*>(ScoreText.Get()), static_cast<UWidget*>(ScoreRateText.Get()),
+		static_cast<UWidget*>(SpeedText.Get()), static_cast<UWidget*>(OverclockMeterBar.Get()), static_cast<UWidget*>(OverclockMeterText.Get()) })
+	{
+		if (Volatile)
+		{
+			Volatile->ForceVolatile(bUseInvalidationRegions);
+		}
+	}
+
+	bPopupsAnimating = false;
+}
+
+void UGameHUDWidget::UpdatePopupVolatility()
+{
+	if (!bUseInvalidationRegions || !PopupCache)
+	{
+		return;
+	}
+
+	const UWidgetTweenSubsystem* Tweens = UWidgetTweenSubsystem::Get(this);
+	const bool bAnimating = Tweens && (Tweens->IsTweening(this, TutorialPopupTween) || Tweens->IsTweening(this, PickupPopupTween));
+	if (bAnimating == bPopupsAnimating)
 	{
-		// Display speed in "MU/s" (Memory Units per second)
-		// This is a thematic unit for a cyberpunk runner - represents data transfer rate
-		// Convert to integer for cleaner display (no decimals needed at these scales)
-		int32 SpeedInt = FMath::RoundToInt(ScrollSpeed);
-		SpeedText->SetText(FText::FromString(FString::Printf(TEXT("%d"), SpeedInt)));
+		return;
+	}
+	bPopupsAnimating = bAnimating;
+
+	for (UWidget* Popup : { TutorialPromptContainer.Get(), PickupPopupContainer.Get() })
+	{
+		if (Popup)
+		{
+			Popup->ForceVolatile(bAnimating);
+		}
+	}
+}
+
+FText UGameHUDWidget::AsPlainNumber(int32 Value)
+{
+	static const FNumberFormattingOptions NoGrouping = FNumberFormattingOptions::DefaultNoGrouping();
+	return FText::AsNumber(Value, &NoGrouping);
+}
+
+void UGameHUDWidget::TickDisplayedValues(float DeltaTime)
+{
+	if (TargetMeterPercent >= 0.0f && DisplayedMeterPercent != TargetMeterPercent)
+	{
+		DisplayedMeterPercent = FMath::FInterpTo(DisplayedMeterPercent, TargetMeterPercent, DeltaTime, DisplayInterpSpeed);
+		if (FMath::IsNearlyEqual(DisplayedMeterPercent, TargetMeterPercent, 0.0005f))
+		{
+			DisplayedMeterPercent = TargetMeterPercent;
+		}
+		ApplyMeterDisplay(DisplayedMeterPercent);
+	}
+
+	if (TargetScrollSpeed >= 0.0f && DisplayedScrollSpeed != TargetScrollSpeed)
+	{
+		DisplayedScrollSpeed = FMath::FInterpTo(DisplayedScrollSpeed, TargetScrollSpeed, DeltaTime, DisplayInterpSpeed);
+		if (FMath::IsNearlyEqual(DisplayedScrollSpeed, TargetScrollSpeed, 0.5f))
+		{
+			DisplayedScrollSpeed = TargetScrollSpeed;
+		}
+		ApplySpeedDisplay(DisplayedScrollSpeed);
+	}
+}
+
+void UGameHUDWidget::ApplyMeterDisplay(float Percent)
+{
+	// Below ~1/1000 of the bar isn't a visible pixel change
+	if (OverclockMeterBar && !FMath::IsNearlyEqual(Percent, CachedMeterBarPercent, 0.001f))
+	{
+		CachedMeterBarPercent = Percent;
+		OverclockMeterBar->SetPercent(Percent);
+	}
+
+	const int32 PercentInt = FMath::Clamp(FMath::RoundToInt(Percent * 100.0f), 0, 100);
+	if (OverclockMeterText && PercentInt != CachedMeterTextPercent)
+	{
+		CachedMeterTextPercent = PercentInt;
+		OverclockMeterText->SetText(PercentTexts.IsValidIndex(PercentInt) ? PercentTexts[PercentInt] : AsPlainNumber(PercentInt));
+	}
+}
+
+void UGameHUDWidget::ApplySpeedDisplay(float ScrollSpeed)
+{
+	// Display speed in "MU/s" (Memory Units per second)
+	// This is a thematic unit for a cyberpunk runner - represents data transfer rate
+	// Convert to integer for cleaner display (no decimals needed at these scales)
+	const int32 SpeedInt = FMath::RoundToInt(ScrollSpeed);
+	if (SpeedText && SpeedInt != CachedSpeedInt)
+	{
+		CachedSpeedInt = SpeedInt;
+		SpeedText->SetText(AsPlainNumber(SpeedInt));
 	}
 }
 
@@ -588,9 +702,15 @@ void UGameHUDWidget::HandleScoreChanged(int32 NewScore)
 
 void UGameHUDWidget::HandleScoreRateChanged(int32 NewScoreRate)
 {
+	if (NewScoreRate == CachedDisplayedScoreRate)
+	{
+		return;
+	}
+	CachedDisplayedScoreRate = NewScoreRate;
+
 	if (ScoreRateText)
 	{
-		ScoreRateText->SetText(FText::FromString(FString::Printf(TEXT("+%d/sec"), NewScoreRate)));
+		ScoreRateText->SetText(FText::Format(ScoreRateTextFormat, AsPlainNumber(NewScoreRate)));
 	}
 }
 
@@ -601,7 +721,7 @@ void UGameHUDWidget::HandleHighScoreBeaten(int32 NewHighScore, int32 OldHighScor
 	// Update high score display
 	if (HighScoreText)
 	{
-		HighScoreText->SetText(FText::FromString(FString::Printf(TEXT("HS: %d"), NewHighScore)));
+		HighScoreText->SetText(FText::Format(HighScoreTextFormat, AsPlainNumber(NewHighScore)));
 	}
 
 	// Show new high score indicator
@@ -728,30 +848,14 @@ void UGameHUDWidget::HandleScrollSpeedChanged(float NewScrollSpeed)
 
 void UGameHUDWidget::OnTutorialPopupStartShrink()
 {
-	// Stop grow animation if still in progress
-	bTutorialPopupGrowing = false;
-	TutorialGrowProgress = 0.0f;
-	
-	// Ensure we're at full scale before shrinking
-	SetTutorialPopupScale(1.0f);
-	
-	// Start the shrink animation instead of immediately hiding
-	bTutorialPopupShrinking = true;
-	TutorialShrinkProgress = 0.0f;
+	// Shrink out instead of immediately hiding
+	StartTutorialPopupShrink();
 }
 
 void UGameHUDWidget::OnPickupPopupStartShrink()
 {
-	// Stop grow animation if still in progress
-	bPickupPopupGrowing = false;
-	PickupGrowProgress = 0.0f;
-	
-	// Ensure we're at full scale before shrinking
-	SetPickupPopupScale(1.0f);
-	
-	// Start the shrink animation instead of immediately hiding
-	bPickupPopupShrinking = true;
-	PickupShrinkProgress = 0.0f;
+	// Shrink out instead of immediately hiding
+	StartPickupPopupShrink();
 }
 
 void UGameHUDWidget::OnOverclockTutorialTimerExpired()
@@ -783,25 +887,18 @@ void UGameHUDWidget::UpdateOverclockMeterColor()
 {
 	if (!OverclockMeterBar || !OverclockSystem) return;
 
-	FLinearColor TargetColor;
-
 	// Color states (all customizable in Blueprint):
 	// - Active (depleting): OverclockActiveColor
 	// - Ready (above threshold, not active): OverclockReadyColor
 	// - Charging (below threshold): OverclockChargingColor
-
-	if (OverclockSystem->IsOverclockActive())
+	const int8 ColorState = OverclockSystem->IsOverclockActive() ? 2 : (OverclockSystem->CanActivateOverclock() ? 1 : 0);
+	if (ColorState == CachedMeterColorState)
 	{
-		TargetColor = OverclockActiveColor;
-	}
-	else if (OverclockSystem->CanActivateOverclock())
-	{
-		TargetColor = OverclockReadyColor;
-	}
-	else
-	{
-		TargetColor = OverclockChargingColor;
+		return;
 	}
+	CachedMeterColorState = ColorState;
+
+	const FLinearColor TargetColor = ColorState == 2 ? OverclockActiveColor : (ColorState == 1 ? OverclockReadyColor : OverclockChargingColor);
 
 	// Apply color to the fill
 	OverclockMeterBar->SetFillColorAndOpacity(TargetColor);
@@ -809,122 +906,124 @@ void UGameHUDWidget::UpdateOverclockMeterColor()
 
 // --- Popup Animations (Grow-in and Shrink-out) ---
 
-void UGameHUDWidget::UpdateTutorialShrinkAnimation(float DeltaTime)
+FWidgetTweenParams UGameHUDWidget::MakePopupTweenParams(bool bGrow) const
 {
-	if (!bTutorialPopupShrinking)
+	FWidgetTweenParams Params;
+	Params.Property = EWidgetTweenProperty::RenderScale;
+	Params.From = bGrow ? 0.0f : 1.0f;
+	Params.To = bGrow ? 1.0f : 0.0f;
+
+	// Grow: ease-out (starts fast, decelerates). Shrink: ease-in (starts slow, accelerates)
+	Params.Duration = bGrow ? PopupGrowDuration : PopupShrinkDuration;
+	Params.Ease = bGrow ? EWidgetTweenEase::EaseOut : EWidgetTweenEase::EaseIn;
+	Params.EaseExponent = bGrow ? PopupGrowEaseExponent : PopupShrinkEaseExponent;
+	return Params;
+}
+
+void UGameHUDWidget::StartTutorialPopupGrow()
+{
+	UWidgetTweenSubsystem* Tweens = UWidgetTweenSubsystem::Get(this);
+	if (!Tweens)
 	{
+		SetTutorialPopupScale(1.0f);
 		return;
 	}
 
-	// Advance animation progress
-	TutorialShrinkProgress += DeltaTime / PopupShrinkDuration;
-
-	if (TutorialShrinkProgress >= 1.0f)
-	{
-		// Animation complete - hide and reset
-		bTutorialPopupShrinking = false;
-		TutorialShrinkProgress = 0.0f;
-		
-		// Actually hide the widgets now
-		if (TutorialPromptText)
-		{
-			TutorialPromptText->SetVisibility(ESlateVisibility::Collapsed);
-		}
-		if (TutorialPromptContainer)
-		{
-			TutorialPromptContainer->SetVisibility(ESlateVisibility::Collapsed);
-		}
-		if (TutorialBackground)
-		{
-			TutorialBackground->SetVisibility(ESlateVisibility::Collapsed);
-		}
-		
-		// Reset scale for next use
-		ResetTutorialPopupScale();
-	}
-	else
-	{
-		// Calculate scale with ease-in (starts slow, accelerates)
-		// InterpEaseIn: Alpha^Exponent gives an ease-in curve
-		float EasedProgress = FMath::Pow(TutorialShrinkProgress, PopupShrinkEaseExponent);
-		float Scale = 1.0f - EasedProgress;
-		
-		SetTutorialPopupScale(Scale);
-	}
+	UWidget* Targets[] = { TutorialPromptText.Get(), TutorialBackground.Get(), TutorialPromptContainer.Get() };
+	Tweens->StartTween(this, TutorialPopupTween, MakeArrayView(Targets), MakePopupTweenParams(true));
 }
 
-void UGameHUDWidget::UpdateTutorialGrowAnimation(float DeltaTime)
+void UGameHUDWidget::StartTutorialPopupShrink()
 {
-	if (!bTutorialPopupGrowing)
+	UWidgetTweenSubsystem* Tweens = UWidgetTweenSubsystem::Get(this);
+	if (!Tweens)
 	{
+		FinishTutorialPopupShrink();
 		return;
 	}
 
-	// Progress the animation
-	TutorialGrowProgress += DeltaTime / PopupGrowDuration;
+	// Replaces a grow still in progress; always shrinks from full scale
+	UWidget* Targets[] = { TutorialPromptText.Get(), TutorialBackground.Get(), TutorialPromptContainer.Get() };
+	Tweens->StartTween(this, TutorialPopupTween, MakeArrayView(Targets), MakePopupTweenParams(false),
+		[this]() { FinishTutorialPopupShrink(); });
+}
 
-	if (TutorialGrowProgress >= 1.0f)
+void UGameHUDWidget::FinishTutorialPopupShrink()
+{
+	// Actually hide the widgets now
+	if (TutorialPromptText)
 	{
-		// Animation complete - set to full scale
-		bTutorialPopupGrowing = false;
-		TutorialGrowProgress = 0.0f;
-		SetTutorialPopupScale(1.0f);
+		TutorialPromptText->SetVisibility(ESlateVisibility::Collapsed);
 	}
-	else
+	if (TutorialPromptContainer)
 	{
-		// Calculate scale with ease-out (starts fast, decelerates)
-		// Ease-out: 1 - (1 - progress)^exponent
-		float EasedProgress = 1.0f - FMath::Pow(1.0f - TutorialGrowProgress, PopupGrowEaseExponent);
-		float Scale = EasedProgress;  // 0.0 → 1.0
-		
-		SetTutorialPopupScale(Scale);
+		TutorialPromptContainer->SetVisibility(ESlateVisibility::Collapsed);
 	}
+	if (TutorialBackground)
+	{
+		TutorialBackground->SetVisibility(ESlateVisibility::Collapsed);
+	}
+
+	// Reset scale for next use
+	ResetTutorialPopupScale();
 }
 
-void UGameHUDWidget::UpdatePickupShrinkAnimation(float DeltaTime)
+void UGameHUDWidget::StartPickupPopupGrow()
 {
-	if (!bPickupPopupShrinking)
+	UWidgetTweenSubsystem* Tweens = UWidgetTweenSubsystem::Get(this);
+	if (!Tweens)
 	{
+		SetPickupPopupScale(1.0f);
 		return;
 	}
 
-	// Advance animation progress
-	PickupShrinkProgress += DeltaTime / PopupShrinkDuration;
+	UWidget* Targets[] = { PickupPopupText.Get(), PickupPopupBackground.Get(), PickupPopupContainer.Get() };
+	Tweens->StartTween(this, PickupPopupTween, MakeArrayView(Targets), MakePopupTweenParams(true));
+}
 
-	if (PickupShrinkProgress >= 1.0f)
+void UGameHUDWidget::StartPickupPopupShrink()
+{
+	UWidgetTweenSubsystem* Tweens = UWidgetTweenSubsystem::Get(this);
+	if (!Tweens)
 	{
-		// Animation complete - hide and reset
-		bPickupPopupShrinking = false;
-		PickupShrinkProgress = 0.0f;
-		
-		// Actually hide the widgets now
-		if (PickupPopupText)
-		{
-			PickupPopupText->SetVisibility(ESlateVisibility::Collapsed);
-		}
-		if (PickupPopupContainer)
-		{
-			PickupPopupContainer->SetVisibility(ESlateVisibility::Collapsed);
-		}
-		if (PickupPopupBackground)
-		{
-			PickupPopupBackground->SetVisibility(ESlateVisibility::Collapsed);
-		}
-		
-		// Reset scale for next use
-		ResetPickupPopupScale();
+		FinishPickupPopupShrink();
+		return;
+	}
 
-		// Popup is now fully done — process next queued popup
-		bIsPickupPopupActive = false;
-		ShowNextQueuedPopup();
+	UWidget* Targets[] = { PickupPopupText.Get(), PickupPopupBackground.Get(), PickupPopupContainer.Get() };
+	Tweens->StartTween(this, PickupPopupTween, MakeArrayView(Targets), MakePopupTweenParams(false),
+		[this]() { FinishPickupPopupShrink(); });
+}
+
+void UGameHUDWidget::FinishPickupPopupShrink()
+{
+	// Actually hide the widgets now
+	if (PickupPopupText)
+	{
+		PickupPopupText->SetVisibility(ESlateVisibility::Collapsed);
 	}
-	else
+	if (PickupPopupContainer)
 	{
-		// Calculate scale with ease-in (starts slow, accelerates)
-		float EasedProgress = FMath::Pow(PickupShrinkProgress, PopupShrinkEaseExponent);
-		float Scale = 1.0f - EasedProgress;
-		
-		SetPickupPopupScale(Scale);
+		PickupPopupContainer->SetVisibility(ESlateVisibility::Collapsed);
+	}
+	if (PickupPopupBackground)
+	{
+		PickupPopupBackground->SetVisibility(ESlateVisibility::Collapsed);
+	}
+
+	// Reset scale for next use
+	ResetPickupPopupScale();
+
+	// Popup is now fully done — process next queued popup
+	bIsPickupPopupActive = false;
+	ShowNextQueuedPopup();
+}
+
+void UGameHUDWidget::StopPopupTween(FName Channel)
+{
+	if (UWidgetTweenSubsystem* Tweens = UWidgetTweenSubsystem::Get(this))
+	{
+		Tweens->StopTween(this, Channel);
 	}
 }
 
@@ -974,34 +1073,6 @@ void UGameHUDWidget::SetPickupPopupScale(float Scale)
 	}
 }
 
-void UGameHUDWidget::UpdatePickupGrowAnimation(float DeltaTime)
-{
-	if (!bPickupPopupGrowing)
-	{
-		return;
-	}
-
-	// Progress the animation
-	PickupGrowProgress += DeltaTime / PopupGrowDuration;
-
-	if (PickupGrowProgress >= 1.0f)
-	{
-		// Animation complete - set to full scale
-		bPickupPopupGrowing = false;
-		PickupGrowProgress = 0.0f;
-		SetPickupPopupScale(1.0f);
-	}
-	else
-	{
-		// Calculate scale with ease-out (starts fast, decelerates)
-		// Ease-out: 1 - (1 - progress)^exponent
-		float EasedProgress = 1.0f - FMath::Pow(1.0f - PickupGrowProgress, PopupGrowEaseExponent);
-		float Scale = EasedProgress;  // 0.0 → 1.0
-		
-		SetPickupPopupScale(Scale);
-	}
-}
-
 void UGameHUDWidget::ResetTutorialPopupScale()
 {
 	FVector2D FullScale(1.0f, 1.0f);
@@ -1060,15 +1131,6 @@ void UGameHUDWidget::ShowPickupPopup(const FString& PopupText, float Duration)
 
 	bIsPickupPopupActive = true;
 
-	// Cancel any in-progress animations and reset
-	bPickupPopupShrinking = false;
-	PickupShrinkProgress = 0.0f;
-	bPickupPopupGrowing = false;
-	PickupGrowProgress = 0.0f;
-
-	// Start at scale 0 for grow-in animation
-	SetPickupPopupScale(0.0f);
-
 	// Use the dedicated pickup popup widgets (separate from tutorial text)
 	if (PickupPopupText)
 	{
@@ -1086,9 +1148,8 @@ void UGameHUDWidget::ShowPickupPopup(const FString& PopupText, float Duration)
 		PickupPopupBackground->SetVisibility(ESlateVisibility::Visible);
 	}
 
-	// Start grow-in animation
-	bPickupPopupGrowing = true;
-	PickupGrowProgress = 0.0f;
+	// Start grow-in animation (from scale 0; replaces anything still running)
+	StartPickupPopupGrow();
 
 	// Set timer to START SHRINK (not immediate hide)
 	if (UWorld* World = GetWorld())
@@ -1107,11 +1168,8 @@ void UGameHUDWidget::ShowPickupPopup(const FString& PopupText, float Duration)
 
 void UGameHUDWidget::HidePickupPopup()
 {
-	// Stop any in-progress animations
-	bPickupPopupShrinking = false;
-	PickupShrinkProgress = 0.0f;
-	bPickupPopupGrowing = false;
-	PickupGrowProgress = 0.0f;
+	// Stop any in-progress animation
+	StopPopupTween(PickupPopupTween);
 
 	if (PickupPopupText)
 	{
@@ -1186,10 +1244,7 @@ void UGameHUDWidget::ShowMagnetCollectedPopup()
 	{
 		// Force-hide current popup without processing queue
 		bIsPickupPopupActive = false;
-		bPickupPopupShrinking = false;
-		bPickupPopupGrowing = false;
-		PickupShrinkProgress = 0.0f;
-		PickupGrowProgress = 0.0f;
+		StopPopupTween(PickupPopupTween);
 
 		if (PickupPopupText)
 		{
@@ -1323,16 +1378,7 @@ void UGameHUDWidget::HideControlsPopup()
 	}
 
 	// Trigger shrink animation instead of immediate hide (consistent with all other popups)
-	// Stop grow animation if still in progress
-	bPickupPopupGrowing = false;
-	PickupGrowProgress = 0.0f;
-	
-	// Ensure we're at full scale before shrinking
-	SetPickupPopupScale(1.0f);
-	
-	// Start the shrink animation
-	bPickupPopupShrinking = true;
-	PickupShrinkProgress = 0.0f;
+	StartPickupPopupShrink();
 }
 
 void UGameHUDWidget::StopControlsTutorial()
@@ -1351,15 +1397,8 @@ void UGameHUDWidget::StopControlsTutorial()
 	{
 		bIsControlsPopupVisible = false;
 		
-		// Trigger the shrink animation (same as pickup popup exit)
-		// The pickup popup system already has this - just set the flags
-		bPickupPopupShrinking = true;
-		PickupShrinkProgress = 0.0f;
-		bPickupPopupGrowing = false;  // Cancel any grow animation
-		PickupGrowProgress = 0.0f;
-		
-		// Make sure we start from full scale for the shrink
-		SetPickupPopupScale(1.0f);
+		// Trigger the shrink animation (same as pickup popup exit; cancels any grow)
+		StartPickupPopupShrink();
 		
 		UE_LOG(LogStateRunner_Arcade, Log, TEXT("GameHUDWidget: Controls tutorial stopped with exit animation"));
 	}
@@ -1376,16 +1415,8 @@ void UGameHUDWidget::OnControlsTutorialTimer()
 		// Currently showing a popup - trigger shrink animation instead of immediate hide
 		bIsControlsPopupVisible = false;
 
-		// Stop grow animation if still in progress
-		bPickupPopupGrowing = false;
-		PickupGrowProgress = 0.0f;
-		
-		// Ensure we're at full scale before shrinking
-		SetPickupPopupScale(1.0f);
-		
-		// Start the shrink animation (Tick will handle the actual animation)
-		bPickupPopupShrinking = true;
-		PickupShrinkProgress = 0.0f;
+		// Start the shrink animation (cancels any grow still in progress)
+		StartPickupPopupShrink();
 
 		// Advance to next step
 		ControlsTutorialStep++;
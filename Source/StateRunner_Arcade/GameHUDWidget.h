@@ -9,11 +9,14 @@ class UTextBlock;
 class UProgressBar;
 class UImage;
 class UHorizontalBox;
+class UInvalidationBox;
 class UScoreSystemComponent;
 class ULivesSystemComponent;
 class UOverclockSystemComponent;
 class UObstacleSpawnerComponent;
 class UWorldScrollComponent;
+class UDifficultyDirectorComponent;
+struct FWidgetTweenParams;
 
 /**
  * Delegate for when countdown sequence completes ("GO!!" finished displaying).
@@ -162,6 +165,27 @@ protected:
 	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Difficulty")
 	TObjectPtr<UTextBlock> DifficultyText;
 
+	// --- Invalidation Regions ---
+	// Optional boxes to wrap parts of the tree in, so a change only repaints its own region:
+	// - StaticChromeCache: frames, labels and backgrounds that never change
+	// - StatusCache: LivesContainer/LivesText, HighScoreText, NewHighScoreText, DifficultyText, MultiplierText
+	// - PopupCache: tutorial, controls and pickup popups
+	// ScoreText, ScoreRateText, SpeedText and the OVERCLOCK meter are the volatile set -- forced
+	// volatile so their frequent changes never invalidate a cache around them. Put them outside
+	// the boxes above (or inside; they're skipped by the cache either way).
+
+	/** Wraps static HUD chrome (never invalidates after the first paint) */
+	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Invalidation")
+	TObjectPtr<UInvalidationBox> StaticChromeCache;
+
+	/** Wraps rarely changing status elements (re-caches when one of them changes) */
+	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Invalidation")
+	TObjectPtr<UInvalidationBox> StatusCache;
+
+	/** Wraps the popups (volatile only while a popup scales in or out) */
+	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Invalidation")
+	TObjectPtr<UInvalidationBox> PopupCache;
+
 	// --- Configuration ---
 
 protected:
@@ -275,6 +299,17 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Configuration")
 	FLinearColor OverclockChargingColor = FLinearColor(0.3f, 0.7f, 1.0f, 1.0f); // Light blue
 
+	/**
+	 * How fast the displayed OVERCLOCK meter and speed ease toward the last reported value.
+	 * Both arrive as thresholded events; the widget interpolates between them. 0 = snap.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Configuration", meta=(ClampMin="0.0", ClampMax="60.0"))
+	float DisplayInterpSpeed = 15.0f;
+
+	/** Cache the invalidation boxes and mark the volatile set (off = everything repaints as before) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Configuration")
+	bool bUseInvalidationRegions = true;
+
 	// --- Cached Component References ---
 
 protected:
@@ -294,6 +329,9 @@ protected:
 	UPROPERTY()
 	TObjectPtr<UWorldScrollComponent> WorldScroll;
 
+	UPROPERTY()
+	TObjectPtr<UDifficultyDirectorComponent> DifficultyDirector;
+
 	// --- Runtime State ---
 
 protected:
@@ -326,18 +364,7 @@ protected:
 	bool bIsControlsPopupVisible = false;
 
 	// --- Popup Animation State ---
-
-	/** Whether tutorial popup is currently shrinking */
-	bool bTutorialPopupShrinking = false;
-
-	/** Tutorial popup shrink animation progress (0.0 to 1.0) */
-	float TutorialShrinkProgress = 0.0f;
-
-	/** Whether tutorial popup is currently growing (scale 0.0 → 1.0) */
-	bool bTutorialPopupGrowing = false;
-
-	/** Tutorial popup grow animation progress (0.0 to 1.0) */
-	float TutorialGrowProgress = 0.0f;
+	// Grow/shrink run on UWidgetTweenSubsystem (channels TutorialPopup / PickupPopup)
 
 	/** Whether a pickup popup is currently being displayed (for queue gating) */
 	bool bIsPickupPopupActive = false;
@@ -357,17 +384,43 @@ protected:
 	/** Cached difficulty level — only update text when this changes */
 	int32 CachedDifficultyLevel = -1;
 
-	/** Whether pickup popup is currently shrinking (scale 1.0 → 0.0) */
-	bool bPickupPopupShrinking = false;
+	/** Last score / score rate pushed to the text (time-based score is polled, not broadcast) */
+	int32 CachedDisplayedScore = -1;
+	int32 CachedDisplayedScoreRate = -1;
+
+	// Displayed values -- each widget is only touched when what it renders changes
+
+	/** Meter fill (0-1) the widget eases toward / currently shows; negative = not yet set */
+	float TargetMeterPercent = -1.0f;
+	float DisplayedMeterPercent = -1.0f;
 
-	/** Pickup popup shrink animation progress (0.0 to 1.0) */
-	float PickupShrinkProgress = 0.0f;
+	/** Scroll speed the widget eases toward / currently shows; negative = not yet set */
+	float TargetScrollSpeed = -1.0f;
+	float DisplayedScrollSpeed = -1.0f;
 
-	/** Whether pickup popup is currently growing (scale 0.0 → 1.0) */
-	bool bPickupPopupGrowing = false;
+	/** Last values pushed to OverclockMeterBar / OverclockMeterText / SpeedText / LivesText */
+	float CachedMeterBarPercent = -1.0f;
+	int32 CachedMeterTextPercent = -1;
+	int32 CachedSpeedInt = -1;
+	int32 CachedLives = -1;
 
-	/** Pickup popup grow animation progress (0.0 to 1.0) */
-	float PickupGrowProgress = 0.0f;
+	/** Last OverclockReadyText visibility pushed (-1 unset, 0 collapsed, 1 visible) */
+	int8 CachedReadyVisible = -1;
+
+	/** Last meter fill color state pushed (-1 unset, 0 charging, 1 ready, 2 active) */
+	int8 CachedMeterColorState = -1;
+
+	/** Popup render-scale animations were running last tick (PopupCache volatility follows this) */
+	bool bPopupsAnimating = false;
+
+	/** "0%".."100%" built once, so the meter text never formats at runtime */
+	TArray<FText> PercentTexts;
+
+	/** Compiled once in NativeConstruct */
+	FTextFormat ScoreTextFormat;
+	FTextFormat ScoreRateTextFormat;
+	FTextFormat HighScoreTextFormat;
+	FTextFormat LivesTextFormat;
 
 	// --- Public Functions ---
 
@@ -654,17 +707,53 @@ protected:
 	/** Update OVERCLOCK meter bar color based on state */
 	void UpdateOverclockMeterColor();
 
-	/** Process tutorial popup shrink animation (called from NativeTick) */
-	void UpdateTutorialShrinkAnimation(float DeltaTime);
+	/** Build PercentTexts and the text formats */
+	void BuildCachedTexts();
+
+	/** Turn caching on for the bound invalidation boxes and force the volatile set volatile */
+	void ConfigureInvalidationRegions();
+
+	/**
+	 * Popup grow/shrink changes render scale every frame -- keep the popups volatile while it
+	 * runs, so PopupCache isn't rebuilt each frame, and cacheable again once it settles.
+	 */
+	void UpdatePopupVolatility();
+
+	/** Ease DisplayedMeterPercent / DisplayedScrollSpeed toward their targets and push what changed */
+	void TickDisplayedValues(float DeltaTime);
+
+	/** Push a meter fill to the bar and text, skipping whatever would render the same */
+	void ApplyMeterDisplay(float Percent);
+
+	/** Push a speed to SpeedText if the displayed integer changed */
+	void ApplySpeedDisplay(float ScrollSpeed);
+
+	/** Integer as text without grouping separators ("12345", not "12,345") */
+	static FText AsPlainNumber(int32 Value);
+
+	/** Tween the tutorial popup in from scale 0 (ease-out) */
+	void StartTutorialPopupGrow();
+
+	/** Tween the tutorial popup out from full scale (ease-in), then hide it */
+	void StartTutorialPopupShrink();
+
+	/** Tutorial shrink finished -- hide the widgets and restore their scale */
+	void FinishTutorialPopupShrink();
+
+	/** Tween the pickup popup in from scale 0 (ease-out) */
+	void StartPickupPopupGrow();
+
+	/** Tween the pickup popup out from full scale (ease-in), then hide it */
+	void StartPickupPopupShrink();
 
-	/** Process tutorial popup grow animation (called from NativeTick) */
-	void UpdateTutorialGrowAnimation(float DeltaTime);
+	/** Pickup shrink finished -- hide the widgets and show the next queued popup */
+	void FinishPickupPopupShrink();
 
-	/** Process pickup popup shrink animation (called from NativeTick) */
-	void UpdatePickupShrinkAnimation(float DeltaTime);
+	/** Stop whatever tween runs on a popup channel (widgets keep their current scale) */
+	void StopPopupTween(FName Channel);
 
-	/** Process pickup popup grow animation (called from NativeTick) */
-	void UpdatePickupGrowAnimation(float DeltaTime);
+	/** Grow or shrink tween settings from the Animation configuration */
+	FWidgetTweenParams MakePopupTweenParams(bool bGrow) const;
 
 	/** Apply scale to tutorial popup widgets */
 	void SetTutorialPopupScale(float Scale);
@@ -11,6 +11,10 @@
 #include "OverclockSystemComponent.h"
 #include "MusicPlayerWidget.h"
 #include "LeaderboardWidget.h"
+#include "StateRunner_ArcadePlayerController.h"
+#include "ArcadeSaveSubsystem.h"
+#include "RunSeedSubsystem.h"
+#include "VersusModeComponent.h"
 #include "StateRunner_Arcade.h"
 
 UGameOverWidget::UGameOverWidget(const FObjectInitializer& ObjectInitializer)
@@ -22,6 +26,9 @@ UGameOverWidget::UGameOverWidget(const FObjectInitializer& ObjectInitializer)
 
 void UGameOverWidget::NativeConstruct()
 {
+	// Stage one: stop the world before doing any UI work
+	BeginPresentation();
+
 	// Cache component references FIRST (before checking qualification)
 	CacheComponentReferences();
 	
@@ -131,38 +138,41 @@ void UGameOverWidget::NativeConstruct()
 		UE_LOG(LogStateRunner_Arcade, Log, TEXT("GameOverWidget: Music player set for zone navigation (Left/Right)"));
 	}
 
-	// Update score displays
+	// Score starts at 0 and counts up; result texts wait for the reveal stage
 	UpdateScoreDisplays();
-	
-	if (bIsNewHighScore)
-	{
-		OnNewHighScoreSet(FinalScore, ScoreSystem ? ScoreSystem->GetHighScore() : 0);
-	}
 
 	// Call parent (sets initial focus to index 0, which is Enter Initials if qualified)
 	Super::NativeConstruct();
 
-	// Pause the game while Game Over is shown
-	if (UWorld* World = GetWorld())
-	{
-		if (APlayerController* PC = World->GetFirstPlayerController())
-		{
-			PC->SetPause(true);
-			UE_LOG(LogStateRunner_Arcade, Log, TEXT("GameOverWidget: Game paused"));
-		}
-	}
-
-	// Input delay - track start time and check in tick (timers don't work while paused)
+	// Input delay - track start time and check in the presentation ticker (timers don't work while paused)
 	bInputEnabled = false;
 	InputDelayStartTime = FPlatformTime::Seconds();
 	UE_LOG(LogStateRunner_Arcade, Log, TEXT("GameOverWidget: Input disabled for %.1f seconds"), InputDelayDuration);
 
+	// Reveal work, drained under the frame budget once the tally lands
+	RevealSteps.Add([this]() { UpdateResultDisplays(); });
+	if (bIsNewHighScore)
+	{
+		RevealSteps.Add([this]() { OnNewHighScoreSet(FinalScore, ScoreSystem ? ScoreSystem->GetHighScore() : 0); });
+	}
+
+	// Remaining stages run one per frame from here
+	SetStage(EGameOverStage::CommitSave);
+	EnsurePresentationTicker();
+
 	UE_LOG(LogStateRunner_Arcade, Log, TEXT("GameOverWidget: Constructed - Score: %d, Qualified: %s, Initials Active: %s"),
 		FinalScore, bQualifiedForLeaderboard ? TEXT("YES") : TEXT("NO"), bInitialsEntryActive ? TEXT("YES") : TEXT("NO"));
 }
 
 void UGameOverWidget::NativeDestruct()
 {
+	if (PresentationTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(PresentationTickerHandle);
+		PresentationTickerHandle.Reset();
+	}
+	RevealSteps.Reset();
+
 	// Clear timers
 	if (UWorld* World = GetWorld())
 	{
@@ -271,12 +281,46 @@ void UGameOverWidget::CacheComponentReferences()
 
 void UGameOverWidget::UpdateScoreDisplays()
 {
-	// Update final score text
-	if (FinalScoreText)
+	// Before the reveal the tally owns the score text and the results stay hidden
+	if (Stage < EGameOverStage::Reveal)
+	{
+		SetDisplayedScore(DisplayedScore, true);
+		HideResultDisplays();
+		return;
+	}
+
+	SetDisplayedScore(FinalScore, true);
+	UpdateResultDisplays();
+}
+
+void UGameOverWidget::SetDisplayedScore(int32 Score, bool bForce)
+{
+	// Only reformat when the number changes -- the tally calls this every frame
+	if (FinalScoreText && (bForce || Score != DisplayedScore))
 	{
-		FinalScoreText->SetText(FText::FromString(FString::Printf(TEXT("%d"), FinalScore)));
+		FinalScoreText->SetText(FText::AsNumber(Score, &FNumberFormattingOptions::DefaultNoGrouping()));
 	}
+	DisplayedScore = Score;
+}
 
+void UGameOverWidget::HideResultDisplays()
+{
+	if (NewHighScoreText)
+	{
+		NewHighScoreText->SetVisibility(ESlateVisibility::Collapsed);
+	}
+	if (NewHighScoreBackdrop)
+	{
+		NewHighScoreBackdrop->SetVisibility(ESlateVisibility::Collapsed);
+	}
+	if (ScoreDifferenceText)
+	{
+		ScoreDifferenceText->SetVisibility(ESlateVisibility::Collapsed);
+	}
+}
+
+void UGameOverWidget::UpdateResultDisplays()
+{
 	// Update high score text
 	if (HighScoreText)
 	{
@@ -315,6 +359,14 @@ void UGameOverWidget::UpdateScoreDisplays()
 			ScoreDifferenceText->SetVisibility(ESlateVisibility::Visible);
 		}
 	}
+
+	if (RunSeedText)
+	{
+		if (const URunSeedSubsystem* RunSeed = URunSeedSubsystem::Get(this))
+		{
+			RunSeedText->SetText(FText::FromString(RunSeed->GetSeedDisplayString()));
+		}
+	}
 }
 
 // --- Action Functions ---
@@ -340,8 +392,10 @@ void UGameOverWidget::RestartGame()
 	{
 		// Remove widget from viewport BEFORE level transition to prevent world leak
 		RemoveFromParent();
-		
-		UGameplayStatics::OpenLevel(this, GameplayLevelName);
+
+		// A daily run restarts on the daily seed; any other run gets a fresh one
+		const URunSeedSubsystem* RunSeed = URunSeedSubsystem::Get(this);
+		UGameplayStatics::OpenLevel(this, GameplayLevelName, true, RunSeed ? RunSeed->GetRestartOptions() : FString());
 	}
 	else
 	{
@@ -400,6 +454,12 @@ void UGameOverWidget::ResetAllSystems()
 		UE_LOG(LogStateRunner_Arcade, Log, TEXT("GameOverWidget: Reset WorldScrollComponent"));
 	}
 
+	// Reset versus rivals (before Player 1's scoring restarts, which restarts theirs)
+	if (UVersusModeComponent* Versus = GameMode->GetVersusModeComponent())
+	{
+		Versus->ResetRivals();
+	}
+
 	// Reset Score
 	if (UScoreSystemComponent* Score = GameMode->GetScoreSystemComponent())
 	{
@@ -459,6 +519,222 @@ void UGameOverWidget::OnInputDelayExpired()
 	UE_LOG(LogStateRunner_Arcade, Log, TEXT("GameOverWidget: Input now enabled"));
 }
 
+void UGameOverWidget::UpdateInputDelay()
+{
+	if (!bInputEnabled && InputDelayStartTime > 0.0)
+	{
+		double ElapsedTime = FPlatformTime::Seconds() - InputDelayStartTime;
+		if (ElapsedTime >= InputDelayDuration)
+		{
+			bInputEnabled = true;
+			UE_LOG(LogStateRunner_Arcade, Log, TEXT("GameOverWidget: Input now enabled (after %.1f seconds)"), ElapsedTime);
+		}
+	}
+}
+
+// --- Presentation Pipeline ---
+
+void UGameOverWidget::BeginPresentation()
+{
+	if (PresentationTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(PresentationTickerHandle);
+		PresentationTickerHandle.Reset();
+	}
+
+	// The widget may be reused for another run
+	DisplayedScore = 0;
+	bSaveCommitted = false;
+	TallyElapsed = 0.0f;
+	RevealSteps.Reset();
+
+	SetStage(EGameOverStage::FreezeWorld);
+	RunFreezeWorld();
+}
+
+void UGameOverWidget::EnsurePresentationTicker()
+{
+	if (!PresentationTickerHandle.IsValid())
+	{
+		PresentationTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &UGameOverWidget::TickPresentation));
+	}
+}
+
+bool UGameOverWidget::TickPresentation(float DeltaTime)
+{
+	UpdateInputDelay();
+
+	// One stage transition per frame keeps the save and the UI work on separate frames
+	switch (Stage)
+	{
+		case EGameOverStage::CommitSave:
+			RunCommitSave();
+			SetStage(EGameOverStage::TallyScore);
+			break;
+
+		case EGameOverStage::TallyScore:
+			RunTallyScore(DeltaTime);
+			break;
+
+		case EGameOverStage::Reveal:
+			RunReveal();
+			break;
+
+		default:
+			break;
+	}
+
+	// Underscore blink (real time, since timers don't run while paused)
+	const bool bBlinking = bInitialsEntryActive && LastUnderscoreToggleTime > 0.0;
+	if (bBlinking)
+	{
+		double CurrentTime = FPlatformTime::Seconds();
+		double BlinkInterval = UnderscoreBlinkRate / 2.0; // Half rate for on/off cycle
+
+		if (CurrentTime - LastUnderscoreToggleTime >= BlinkInterval)
+		{
+			bUnderscoreVisible = !bUnderscoreVisible;
+			LastUnderscoreToggleTime = CurrentTime;
+			UpdateUnderscoreDisplay();
+		}
+	}
+
+	// Nothing left to animate -- stop ticking until initials entry restarts the blink
+	if (Stage == EGameOverStage::Settled && bInputEnabled && !bBlinking)
+	{
+		PresentationTickerHandle.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+void UGameOverWidget::SetStage(EGameOverStage NewStage)
+{
+	Stage = NewStage;
+	OnGameOverStageChanged(NewStage);
+}
+
+void UGameOverWidget::RunFreezeWorld()
+{
+	// Pausing stops every actor and component tick that isn't tickable-when-paused
+	// (scrolling and scoring were already stopped by the lives system)
+	if (UWorld* World = GetWorld())
+	{
+		if (APlayerController* PC = World->GetFirstPlayerController())
+		{
+			PC->SetPause(true);
+			UE_LOG(LogStateRunner_Arcade, Log, TEXT("GameOverWidget: Game paused"));
+		}
+	}
+}
+
+void UGameOverWidget::RunCommitSave()
+{
+	// The high score was recorded when the player died; write it now, off the construct frame.
+	// Flush is async -- the record is serialized here and the file write happens on a worker.
+	UArcadeSaveSubsystem* Saves = UArcadeSaveSubsystem::Get(this);
+	if (!Saves)
+	{
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("GameOverWidget: No save subsystem, results not saved"));
+		return;
+	}
+
+	TWeakObjectPtr<UGameOverWidget> WeakThis(this);
+	Saves->Flush([WeakThis](bool bSuccess)
+	{
+		if (UGameOverWidget* Widget = WeakThis.Get())
+		{
+			Widget->bSaveCommitted = bSuccess;
+		}
+
+		if (!bSuccess)
+		{
+			UE_LOG(LogStateRunner_Arcade, Warning, TEXT("GameOverWidget: Saving run results failed"));
+		}
+	});
+}
+
+void UGameOverWidget::RunTallyScore(float DeltaTime)
+{
+	TallyElapsed += DeltaTime;
+
+	if (ScoreTallyDuration <= 0.0f || TallyElapsed >= ScoreTallyDuration)
+	{
+		SetDisplayedScore(FinalScore);
+		SetStage(EGameOverStage::Reveal);
+		return;
+	}
+
+	// Ease out so the count slows as it approaches the final score
+	const float Alpha = 1.0f - FMath::Square(1.0f - TallyElapsed / ScoreTallyDuration);
+	SetDisplayedScore(FMath::FloorToInt(FinalScore * Alpha));
+}
+
+void UGameOverWidget::RunReveal()
+{
+	const double BudgetSeconds = PresentationFrameBudgetMs / 1000.0;
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Always make progress, then keep going while there's budget left this frame. Each step
+	// is popped before it runs: it can reach SkipPresentation (OnNewHighScoreSet is Blueprint)
+	// or a restart, which take or reset RevealSteps under it
+	while (RevealSteps.Num() > 0)
+	{
+		TFunction<void()> Step = MoveTemp(RevealSteps[0]);
+		RevealSteps.RemoveAt(0);
+		Step();
+
+		// Skipped or restarted from inside the step -- that path has the rest
+		if (Stage != EGameOverStage::Reveal)
+		{
+			return;
+		}
+
+		if (FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+		{
+			break;
+		}
+	}
+
+	if (RevealSteps.Num() == 0)
+	{
+		SetStage(EGameOverStage::Settled);
+	}
+}
+
+void UGameOverWidget::SkipPresentation()
+{
+	if (Stage == EGameOverStage::Settled)
+	{
+		return;
+	}
+
+	if (Stage <= EGameOverStage::CommitSave)
+	{
+		RunCommitSave();
+	}
+
+	SetDisplayedScore(FinalScore);
+	SetStage(EGameOverStage::Reveal);
+
+	// Move the steps out first so a step can't change the array being iterated
+	TArray<TFunction<void()>> Steps = MoveTemp(RevealSteps);
+	for (TFunction<void()>& Step : Steps)
+	{
+		Step();
+
+		// Restarted from inside the step
+		if (Stage != EGameOverStage::Reveal)
+		{
+			return;
+		}
+	}
+
+	SetStage(EGameOverStage::Settled);
+}
+
 // --- Button Handlers ---
 
 void UGameOverWidget::OnRestartClicked()
@@ -698,6 +974,9 @@ void UGameOverWidget::StartUnderscoreBlink()
 	bUnderscoreVisible = true;
 	LastUnderscoreToggleTime = FPlatformTime::Seconds();
 	UpdateUnderscoreDisplay();
+
+	// The presentation ticker stops once settled; blinking needs it back
+	EnsurePresentationTicker();
 }
 
 void UGameOverWidget::StopUnderscoreBlink()
@@ -749,8 +1028,8 @@ void UGameOverWidget::OpenLeaderboard()
 		return;
 	}
 
-	// Create and show leaderboard widget
-	LeaderboardWidget = CreateWidget<ULeaderboardWidget>(GetOwningPlayer(), LeaderboardWidgetClass);
+	// Show leaderboard widget (cached on the controller after the first open)
+	LeaderboardWidget = AStateRunner_ArcadePlayerController::GetOrCreateWidget<ULeaderboardWidget>(GetOwningPlayer(), LeaderboardWidgetClass);
 	if (LeaderboardWidget)
 	{
 		// Set the highlighted rank before adding to viewport
@@ -760,7 +1039,7 @@ void UGameOverWidget::OpenLeaderboard()
 		LeaderboardWidget->TakeKeyboardFocus();
 
 		// Bind to leaderboard back action to close it
-		LeaderboardWidget->OnBackPressed.AddDynamic(this, &UGameOverWidget::CloseLeaderboard);
+		LeaderboardWidget->OnBackPressed.AddUniqueDynamic(this, &UGameOverWidget::CloseLeaderboard);
 
 		// Hide game over screen while leaderboard is open
 		SetVisibility(ESlateVisibility::Collapsed);
@@ -787,36 +1066,6 @@ void UGameOverWidget::CloseLeaderboard()
 
 // --- Overrides ---
 
-void UGameOverWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
-{
-	Super::NativeTick(MyGeometry, InDeltaTime);
-	
-	// Check input delay (timers don't work while paused, so we use real time)
-	if (!bInputEnabled && InputDelayStartTime > 0.0)
-	{
-		double ElapsedTime = FPlatformTime::Seconds() - InputDelayStartTime;
-		if (ElapsedTime >= InputDelayDuration)
-		{
-			bInputEnabled = true;
-			UE_LOG(LogStateRunner_Arcade, Log, TEXT("GameOverWidget: Input now enabled (after %.1f seconds)"), ElapsedTime);
-		}
-	}
-	
-	// Underscore blink animation (using real time since timers don't work while paused)
-	if (bInitialsEntryActive && LastUnderscoreToggleTime > 0.0)
-	{
-		double CurrentTime = FPlatformTime::Seconds();
-		double BlinkInterval = UnderscoreBlinkRate / 2.0; // Half rate for on/off cycle
-		
-		if (CurrentTime - LastUnderscoreToggleTime >= BlinkInterval)
-		{
-			bUnderscoreVisible = !bUnderscoreVisible;
-			LastUnderscoreToggleTime = CurrentTime;
-			UpdateUnderscoreDisplay();
-		}
-	}
-}
-
 void UGameOverWidget::OnItemSelected_Implementation(int32 ItemIndex)
 {
 	// Button clicks are handled by OnClicked delegates
@@ -839,6 +1088,9 @@ FReply UGameOverWidget::NativeOnKeyDown(const FGeometry& InGeometry, const FKeyE
 {
 	FKey Key = InKeyEvent.GetKey();
 	
+	// The ticker may not have run since the delay ran out
+	UpdateInputDelay();
+
 	// Block all input except Escape during input delay
 	// Escape is always allowed (for canceling initials entry)
 	bool bIsEscapeKey = (Key == EKeys::Escape);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/Ticker.h"
 #include "ArcadeMenuWidget.h"
 #include "GameOverWidget.generated.h"
 
@@ -10,6 +11,28 @@ class UScoreSystemComponent;
 class UMusicPlayerWidget;
 class ULeaderboardWidget;
 
+/**
+ * Stages of the game-over presentation, run in order.
+ */
+UENUM(BlueprintType)
+enum class EGameOverStage : uint8
+{
+	/** Pause the gameplay world (set up synchronously on construct) */
+	FreezeWorld     UMETA(DisplayName = "Freeze World"),
+
+	/** Hand the run's results to the save subsystem (async write) */
+	CommitSave      UMETA(DisplayName = "Commit Save"),
+
+	/** Count the final score up */
+	TallyScore      UMETA(DisplayName = "Tally Score"),
+
+	/** Show the result texts and fire the celebration events, a few per frame */
+	Reveal          UMETA(DisplayName = "Reveal"),
+
+	/** Presentation done; the widget no longer ticks */
+	Settled         UMETA(DisplayName = "Settled")
+};
+
 /**
  * Game Over Widget for StateRunner Arcade
  * 
@@ -29,8 +52,14 @@ class ULeaderboardWidget;
  * - Arrow Up/Down: Navigate between buttons
  * - Enter: Select focused button
  * - Default focus on Restart button
+ *
+ * PRESENTATION:
+ * The end of a run is staged (see EGameOverStage) so the world freeze, the save and the UI
+ * work never land on the same frame. Stages after the freeze run from a core ticker with a
+ * per-frame time budget; the ticker removes itself once everything has settled, so an idle
+ * Game Over screen costs nothing per frame. No stage does synchronous file I/O.
  */
-UCLASS(Abstract, Blueprintable)
+UCLASS(Abstract, Blueprintable, meta=(DisableNativeTick))
 class STATERUNNER_ARCADE_API UGameOverWidget : public UArcadeMenuWidget
 {
 	GENERATED_BODY()
@@ -70,6 +99,10 @@ protected:
 	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Score")
 	TObjectPtr<UTextBlock> ScoreDifferenceText;
 
+	/** Run seed ("SEED 123456789" / "DAILY 2026-10-14") so the run can be replayed */
+	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Score")
+	TObjectPtr<UTextBlock> RunSeedText;
+
 	/** "GAME OVER" title text */
 	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Title")
 	TObjectPtr<UTextBlock> GameOverTitleText;
@@ -336,6 +369,85 @@ protected:
 	/** Called when input delay expires */
 	void OnInputDelayExpired();
 
+	/** Enable input once InputDelayDuration has passed (real time, works while paused) */
+	void UpdateInputDelay();
+
+	//=============================================================================
+	// PRESENTATION PIPELINE
+	//=============================================================================
+
+protected:
+
+	/** Seconds the final score takes to count up (0 = show it immediately) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Presentation", meta=(ClampMin="0.0", ClampMax="5.0"))
+	float ScoreTallyDuration = 1.2f;
+
+	/** Milliseconds of reveal work allowed per frame (at least one step always runs) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Presentation", meta=(ClampMin="0.1", ClampMax="16.0"))
+	float PresentationFrameBudgetMs = 2.0f;
+
+	/** Current presentation stage */
+	UPROPERTY(BlueprintReadOnly, Category="Presentation")
+	EGameOverStage Stage = EGameOverStage::FreezeWorld;
+
+	/** Score currently shown by FinalScoreText (counts up to FinalScore) */
+	UPROPERTY(BlueprintReadOnly, Category="Presentation")
+	int32 DisplayedScore = 0;
+
+	/** True once the save subsystem reports the run's results on disk */
+	UPROPERTY(BlueprintReadOnly, Category="Presentation")
+	bool bSaveCommitted = false;
+
+	/** Real seconds spent in the tally stage */
+	float TallyElapsed = 0.0f;
+
+	/** Deferred reveal work, drained under PresentationFrameBudgetMs */
+	TArray<TFunction<void()>> RevealSteps;
+
+	/** Core ticker driving the pipeline, input delay and underscore blink (reset when idle) */
+	FTSTicker::FDelegateHandle PresentationTickerHandle;
+
+	/** Reset the pipeline and run the freeze stage */
+	void BeginPresentation();
+
+	/** Start the presentation ticker if it isn't running */
+	void EnsurePresentationTicker();
+
+	/** Ticker callback; returns false (removing itself) once nothing needs a tick */
+	bool TickPresentation(float DeltaTime);
+
+	/** Enter a stage and notify Blueprint */
+	void SetStage(EGameOverStage NewStage);
+
+	/** Stage bodies */
+	void RunFreezeWorld();
+	void RunCommitSave();
+	void RunTallyScore(float DeltaTime);
+	void RunReveal();
+
+	/** Set FinalScoreText (skips the text update when the value is unchanged unless bForce) */
+	void SetDisplayedScore(int32 Score, bool bForce = false);
+
+	/** High score, difference and new-record texts */
+	void UpdateResultDisplays();
+
+	/** Hide the texts UpdateResultDisplays reveals */
+	void HideResultDisplays();
+
+public:
+
+	/** Current presentation stage */
+	UFUNCTION(BlueprintPure, Category="Presentation")
+	EGameOverStage GetGameOverStage() const { return Stage; }
+
+	/** Jump to the end of the presentation (finish the tally and run all reveal steps) */
+	UFUNCTION(BlueprintCallable, Category="Presentation")
+	void SkipPresentation();
+
+	/** Called on entering each presentation stage (stingers, animations) */
+	UFUNCTION(BlueprintImplementableEvent, Category="Events")
+	void OnGameOverStageChanged(EGameOverStage NewStage);
+
 	//=============================================================================
 	// PUBLIC FUNCTIONS
 	//=============================================================================
@@ -514,7 +626,6 @@ protected:
 	// OVERRIDES
 	//=============================================================================
 
-	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
 	virtual void OnItemSelected_Implementation(int32 ItemIndex) override;
 	virtual void OnBackAction_Implementation() override;
 	virtual FReply NativeOnKeyDown(const FGeometry& InGeometry, const FKeyEvent& InKeyEvent) override;
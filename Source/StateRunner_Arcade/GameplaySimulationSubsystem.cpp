@@ -0,0 +1,299 @@
+#include "GameplaySimulationSubsystem.h"
+#include "DisplaySettingsSubsystem.h"
+#include "StateRunner_Arcade.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+namespace
+{
+	/** Shared by every world's timeline so handles never collide (0 is the invalid handle) */
+	uint32 NextTimerId = 1;
+}
+
+// --- Subsystem Lifecycle ---
+
+bool UGameplaySimulationSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Game worlds only -- editor preview worlds have nothing to simulate
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void UGameplaySimulationSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// Fixed for the world's lifetime, so a run (and its replay) never changes rate midway
+	if (const UDisplaySettingsSubsystem* DisplaySettings = UDisplaySettingsSubsystem::Get(GetWorld()))
+	{
+		const int32 SavedRate = DisplaySettings->GetSettings().SimulationStepRate;
+		if (SavedRate > 0)
+		{
+			SimulationStepRate = static_cast<float>(SavedRate);
+		}
+	}
+}
+
+TStatId UGameplaySimulationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGameplaySimulationSubsystem, STATGROUP_Tickables);
+}
+
+void UGameplaySimulationSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	RealTime += World->DeltaRealTimeSeconds;
+	ProcessTimers(EGameplayClock::Real, RealTime);
+
+	// Pause (or menu quiescence) stops the Gameplay clock and the fixed step together
+	if (World->IsPaused() || bSuspended)
+	{
+		return;
+	}
+
+	const float GameplayDeltaTime = DeltaTime * GameplayTimeScale;
+	GameplayTime += GameplayDeltaTime;
+
+	StepSimulation(GameplayDeltaTime);
+	ProcessTimers(EGameplayClock::Gameplay, GameplayTime);
+}
+
+void UGameplaySimulationSubsystem::StepSimulation(float GameplayDeltaTime)
+{
+	if (!bEnableFixedStep || Participants.Num() == 0)
+	{
+		return;
+	}
+
+	const float StepSeconds = GetStepSeconds();
+	const int32 MaxSteps = GetMaxStepsPerFrame();
+	Accumulator += GameplayDeltaTime;
+
+	int32 Steps = 0;
+	bIsSimulating = true;
+	while (Accumulator >= StepSeconds && Steps < MaxSteps)
+	{
+		for (int32 i = 0; i < Participants.Num(); i++)
+		{
+			FParticipant& Participant = Participants[i];
+			if (Participant.Simulated && Participant.Owner.IsValid())
+			{
+				Participant.Simulated->SimulateStep(StepSeconds);
+			}
+		}
+
+		Accumulator -= StepSeconds;
+		StepCount++;
+		Steps++;
+	}
+	bIsSimulating = false;
+
+	// Hitch longer than MaxCatchUpSeconds -- drop it rather than catch up next frame too
+	if (Accumulator >= StepSeconds)
+	{
+		DroppedFrameCount++;
+		UE_LOG(LogStateRunner_Arcade, Verbose, TEXT("GameplaySimulation: dropped %.1f ms after %d steps"),
+			(Accumulator - FMath::Fmod(Accumulator, StepSeconds)) * 1000.0f, Steps);
+		Accumulator = FMath::Fmod(Accumulator, StepSeconds);
+	}
+
+	LastAlpha = Accumulator / StepSeconds;
+
+	for (int32 i = 0; i < Participants.Num(); i++)
+	{
+		FParticipant& Participant = Participants[i];
+		if (Participant.Simulated && Participant.Owner.IsValid())
+		{
+			Participant.Simulated->PostSimulate(LastAlpha, Steps);
+		}
+	}
+
+	// Compact entries cleared mid-step or whose owner was destroyed
+	Participants.RemoveAll([](const FParticipant& Participant)
+	{
+		return !Participant.Simulated || !Participant.Owner.IsValid();
+	});
+}
+
+UGameplaySimulationSubsystem* UGameplaySimulationSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	return World->GetSubsystem<UGameplaySimulationSubsystem>();
+}
+
+// --- Public Functions ---
+
+void UGameplaySimulationSubsystem::RegisterParticipant(UObject* Owner, IGameplaySimulated* Simulated, ESimulationPhase Phase)
+{
+	if (!Owner || !Simulated)
+	{
+		return;
+	}
+
+	for (const FParticipant& Participant : Participants)
+	{
+		if (Participant.Owner.Get() == Owner && Participant.Simulated)
+		{
+			return;
+		}
+	}
+
+	FParticipant NewParticipant;
+	NewParticipant.Owner = Owner;
+	NewParticipant.Simulated = Simulated;
+	NewParticipant.Phase = Phase;
+
+	// Insert after the last participant of the same or an earlier phase
+	int32 InsertIndex = Participants.Num();
+	while (InsertIndex > 0 && Participants[InsertIndex - 1].Phase > Phase)
+	{
+		InsertIndex--;
+	}
+
+	// Mid-step inserts would shift the loop -- append and let the order settle next frame
+	if (bIsSimulating)
+	{
+		InsertIndex = Participants.Num();
+	}
+
+	Participants.Insert(NewParticipant, InsertIndex);
+}
+
+void UGameplaySimulationSubsystem::UnregisterParticipant(UObject* Owner)
+{
+	for (int32 i = Participants.Num() - 1; i >= 0; i--)
+	{
+		if (Participants[i].Owner.Get() == Owner)
+		{
+			if (bIsSimulating)
+			{
+				Participants[i].Simulated = nullptr;
+			}
+			else
+			{
+				Participants.RemoveAt(i);
+			}
+		}
+	}
+}
+
+// --- Timeline ---
+
+void UGameplaySimulationSubsystem::SetTimer(FGameplayTimerHandle& InOutHandle, UObject* Owner, TFunction<void()>&& Callback,
+	float Delay, bool bLoop, EGameplayClock Clock)
+{
+	ClearTimer(InOutHandle);
+
+	if (!Owner || !Callback)
+	{
+		return;
+	}
+
+	FTimelineTimer& Timer = Timers.AddDefaulted_GetRef();
+	Timer.Id = NextTimerId++;
+	Timer.Owner = Owner;
+	Timer.Callback = MoveTemp(Callback);
+	// Floor keeps a zero-interval loop from firing forever within one frame
+	Timer.Interval = FMath::Max(Delay, 0.001f);
+	Timer.bLoop = bLoop;
+	Timer.Clock = Clock;
+	Timer.DueTime = (Clock == EGameplayClock::Real ? RealTime : GameplayTime) + Timer.Interval;
+
+	InOutHandle.Id = Timer.Id;
+}
+
+void UGameplaySimulationSubsystem::ClearTimer(FGameplayTimerHandle& InOutHandle)
+{
+	if (!InOutHandle.IsValid())
+	{
+		return;
+	}
+
+	const uint32 Id = InOutHandle.Id;
+	Timers.RemoveAllSwap([Id](const FTimelineTimer& Timer) { return Timer.Id == Id; });
+	InOutHandle.Invalidate();
+}
+
+void UGameplaySimulationSubsystem::ClearAllTimers(const UObject* Owner)
+{
+	Timers.RemoveAllSwap([Owner](const FTimelineTimer& Timer) { return Timer.Owner.Get() == Owner; });
+}
+
+bool UGameplaySimulationSubsystem::IsTimerActive(const FGameplayTimerHandle& Handle) const
+{
+	if (!Handle.IsValid())
+	{
+		return false;
+	}
+
+	return Timers.ContainsByPredicate([&Handle](const FTimelineTimer& Timer) { return Timer.Id == Handle.Id; });
+}
+
+void UGameplaySimulationSubsystem::ProcessTimers(EGameplayClock Clock, double Now)
+{
+	// Re-scan after every call: callbacks may set or clear timers (including their own)
+	while (true)
+	{
+		int32 DueIndex = INDEX_NONE;
+		for (int32 i = 0; i < Timers.Num(); i++)
+		{
+			const FTimelineTimer& Timer = Timers[i];
+			if (Timer.Clock != Clock || Timer.DueTime > Now)
+			{
+				continue;
+			}
+
+			// Earliest due first; ids break ties in the order timers were set
+			if (DueIndex == INDEX_NONE
+				|| Timer.DueTime < Timers[DueIndex].DueTime
+				|| (Timer.DueTime == Timers[DueIndex].DueTime && Timer.Id < Timers[DueIndex].Id))
+			{
+				DueIndex = i;
+			}
+		}
+
+		if (DueIndex == INDEX_NONE)
+		{
+			return;
+		}
+
+		FTimelineTimer& Timer = Timers[DueIndex];
+		if (!Timer.Owner.IsValid())
+		{
+			Timers.RemoveAtSwap(DueIndex);
+			continue;
+		}
+
+		TFunction<void()> Callback;
+		if (Timer.bLoop)
+		{
+			// Looping timers fire once per elapsed interval, like FTimerManager
+			Timer.DueTime += Timer.Interval;
+			Callback = Timer.Callback;
+		}
+		else
+		{
+			Callback = MoveTemp(Timer.Callback);
+			Timers.RemoveAtSwap(DueIndex);
+		}
+
+		Callback();
+	}
+}
@@ -0,0 +1,286 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplaySimulationSubsystem.generated.h"
+
+/**
+ * Order participants run in within one fixed step.
+ * Replayed input first, then runner motion, then the world scrolls, then anything that reads both.
+ */
+enum class ESimulationPhase : uint8
+{
+	/** Recorded input fed back in by a replay, ahead of the runner it drives */
+	Input,
+
+	/** Runner lane switch / jump / slide / rise */
+	Runner,
+
+	/** Scroll speed, damage slowdown, scroll distance */
+	Scroll,
+
+	/** Magnet pull and other pickup motion */
+	Pickups,
+
+	/** Contact resolution against the state the earlier phases produced */
+	Collision,
+
+	/** Meters and other per-step bookkeeping that reads the resolved frame (OVERCLOCK) */
+	Meters
+};
+
+/**
+ * Which clock a timeline timer counts on.
+ */
+enum class EGameplayClock : uint8
+{
+	/** Stops while paused; scaled by world time dilation and the gameplay time scale */
+	Gameplay,
+
+	/** Undilated real time; keeps running while paused (audio housekeeping) */
+	Real
+};
+
+/**
+ * Handle to a timer on UGameplaySimulationSubsystem's timeline.
+ * Ids are unique across worlds, so a stale handle (e.g. held by a game instance
+ * subsystem across a level change) can't clear someone else's timer.
+ */
+struct FGameplayTimerHandle
+{
+	uint32 Id = 0;
+
+	bool IsValid() const { return Id != 0; }
+	void Invalidate() { Id = 0; }
+};
+
+/**
+ * Something advanced by UGameplaySimulationSubsystem at a fixed rate instead of ticking.
+ * Plain C++ interface -- implementers register/unregister themselves in BeginPlay/EndPlay.
+ */
+class IGameplaySimulated
+{
+public:
+
+	virtual ~IGameplaySimulated() = default;
+
+	/**
+	 * Advance gameplay state by exactly one fixed step.
+	 *
+	 * @param StepSeconds Fixed step length (same every call)
+	 */
+	virtual void SimulateStep(float StepSeconds) = 0;
+
+	/**
+	 * Called once per frame after all steps ran, to present the simulated state.
+	 *
+	 * @param Alpha Fraction of a step left in the accumulator (0..1); render at
+	 *              Lerp(previous step, latest step, Alpha) to interpolate
+	 * @param StepsThisFrame Number of SimulateStep calls made this frame (may be 0)
+	 */
+	virtual void PostSimulate(float Alpha, int32 StepsThisFrame) {}
+};
+
+/**
+ * Gameplay Simulation Subsystem
+ *
+ * Owns the gameplay timeline -- the one clock every gameplay system reads.
+ *
+ * Fixed step: each frame the gameplay DeltaTime is added to an accumulator, which is
+ * drained in SimulationStepRate Hz steps; every registered participant runs its step in
+ * ESimulationPhase order. Hitches are capped at MaxCatchUpSeconds, and the leftover time
+ * is dropped rather than spiralling. Gameplay then integrates identically on every
+ * machine, and at scroll speeds past 3000 u/s a single hitch can no longer carry an
+ * obstacle through the runner between contact tests.
+ *
+ * Timers: score accumulation, invulnerability, combo popups and the music monitor are
+ * scheduled here rather than on the world timer manager. Due timers fire after the
+ * frame's steps, earliest first (ties in the order they were set).
+ *
+ * Pause, world time dilation and GameplayTimeScale are applied once, in Tick: the
+ * Gameplay clock and the fixed step both stop while the world is paused or suspended
+ * (menu quiescence), and only Real-clock timers keep running.
+ *
+ * Settings are read from DefaultGame.ini:
+ * [/Script/StateRunner_Arcade.GameplaySimulationSubsystem]
+ */
+UCLASS(Config=Game)
+class STATERUNNER_ARCADE_API UGameplaySimulationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	// --- Subsystem Lifecycle ---
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Ticks while paused so Real-clock timers keep running (gameplay is skipped in Tick) */
+	virtual bool IsTickableWhenPaused() const override { return true; }
+
+	/** Get the subsystem from a world context (null outside game worlds) */
+	static UGameplaySimulationSubsystem* Get(const UObject* WorldContextObject);
+
+	// --- Configuration ---
+
+protected:
+
+	/** Participants step at this rate; off = each system integrates its own DeltaTime as before */
+	UPROPERTY(Config)
+	bool bEnableFixedStep = true;
+
+	/** Steps per second (the settings menu's simulation rate overrides it, see UDisplaySettingsSubsystem) */
+	UPROPERTY(Config)
+	float SimulationStepRate = 120.0f;
+
+	/**
+	 * Most gameplay time simulated in one frame; the step count follows from the step rate
+	 * (8 steps at 120 Hz, 16 at 240 Hz). A longer hitch drops the remaining time (gameplay
+	 * slows down briefly) instead of freezing while it catches up.
+	 */
+	UPROPERTY(Config)
+	float MaxCatchUpSeconds = 1.0f / 15.0f;
+
+	// --- Runtime State ---
+
+protected:
+
+	struct FParticipant
+	{
+		TWeakObjectPtr<UObject> Owner;
+		IGameplaySimulated* Simulated = nullptr;
+		ESimulationPhase Phase = ESimulationPhase::Runner;
+	};
+
+	/** Registered participants, kept sorted by Phase (stable within a phase) */
+	TArray<FParticipant> Participants;
+
+	/** Unsimulated time carried into the next frame */
+	float Accumulator = 0.0f;
+
+	/** Total steps run since the world started */
+	int64 StepCount = 0;
+
+	/** Frames that hit the catch-up cap and dropped time */
+	int32 DroppedFrameCount = 0;
+
+	/** Last frame's interpolation alpha */
+	float LastAlpha = 0.0f;
+
+	/** True inside Tick's step loop -- unregistering then only clears the entry */
+	bool bIsSimulating = false;
+
+	struct FTimelineTimer
+	{
+		uint32 Id = 0;
+		TWeakObjectPtr<UObject> Owner;
+		TFunction<void()> Callback;
+		double DueTime = 0.0;
+		float Interval = 0.0f;
+		bool bLoop = false;
+		EGameplayClock Clock = EGameplayClock::Gameplay;
+	};
+
+	/** Pending timers (unordered; the few that exist are scanned for the earliest due) */
+	TArray<FTimelineTimer> Timers;
+
+	/** Paused-aware, dilated gameplay time */
+	double GameplayTime = 0.0;
+
+	/** Undilated time, including pauses */
+	double RealTime = 0.0;
+
+	/** Extra scale on the Gameplay clock on top of world time dilation */
+	float GameplayTimeScale = 1.0f;
+
+	/** Gameplay clock held like a pause, without pausing the world */
+	bool bSuspended = false;
+
+	// --- Public Functions ---
+
+public:
+
+	/** True if participants should register instead of ticking themselves */
+	bool IsFixedStepEnabled() const { return bEnableFixedStep; }
+
+	/** Length of one step in seconds */
+	float GetStepSeconds() const { return 1.0f / FMath::Max(SimulationStepRate, 1.0f); }
+
+	/** Most steps run in one frame: MaxCatchUpSeconds at the current step rate */
+	int32 GetMaxStepsPerFrame() const { return FMath::Max(FMath::CeilToInt(MaxCatchUpSeconds / GetStepSeconds() - UE_KINDA_SMALL_NUMBER), 1); }
+
+	/** Fraction of a step in the accumulator after the last frame's steps */
+	float GetInterpolationAlpha() const { return LastAlpha; }
+
+	/** Steps run since the world started (for deterministic timing / debug) */
+	int64 GetStepCount() const { return StepCount; }
+
+	/**
+	 * Add a participant. Registering the same owner twice is a no-op.
+	 *
+	 * @param Owner UObject whose lifetime bounds the registration
+	 * @param Simulated Interface on Owner to drive
+	 * @param Phase Where in each step it runs
+	 */
+	void RegisterParticipant(UObject* Owner, IGameplaySimulated* Simulated, ESimulationPhase Phase);
+
+	/** Remove a participant (safe to call during a step) */
+	void UnregisterParticipant(UObject* Owner);
+
+	// --- Timeline ---
+
+	/**
+	 * Schedule a callback on the timeline. Replaces the timer InOutHandle already refers to.
+	 *
+	 * @param InOutHandle Handle to fill in (also cleared first if still active)
+	 * @param Owner UObject whose lifetime bounds the timer (callback is dropped once it's gone)
+	 * @param Callback Function to run
+	 * @param Delay Seconds until the first call (and between calls when looping)
+	 * @param bLoop Keep firing every Delay seconds until cleared
+	 * @param Clock Gameplay (pauses, dilates) or Real
+	 */
+	void SetTimer(FGameplayTimerHandle& InOutHandle, UObject* Owner, TFunction<void()>&& Callback,
+		float Delay, bool bLoop = false, EGameplayClock Clock = EGameplayClock::Gameplay);
+
+	/** Cancel a timer and invalidate the handle (safe from inside a callback) */
+	void ClearTimer(FGameplayTimerHandle& InOutHandle);
+
+	/** Cancel every timer Owner set */
+	void ClearAllTimers(const UObject* Owner);
+
+	/** True if the handle refers to a timer that hasn't fired (or is looping) */
+	bool IsTimerActive(const FGameplayTimerHandle& Handle) const;
+
+	/** Gameplay clock seconds since the world started (stops while paused) */
+	double GetGameplayTime() const { return GameplayTime; }
+
+	/** Real clock seconds since the world started */
+	double GetRealTime() const { return RealTime; }
+
+	/**
+	 * Scale the Gameplay clock (fixed step and Gameplay timers) on top of world dilation.
+	 *
+	 * @param NewScale 1 = normal, 0 = frozen
+	 */
+	void SetGameplayTimeScale(float NewScale) { GameplayTimeScale = FMath::Max(NewScale, 0.0f); }
+
+	float GetGameplayTimeScale() const { return GameplayTimeScale; }
+
+	/** Hold the Gameplay clock and fixed step (menu quiescence); Real-clock timers keep running */
+	void SetSuspended(bool bInSuspended) { bSuspended = bInSuspended; }
+
+	bool IsSuspended() const { return bSuspended; }
+
+	// --- Internal Functions ---
+
+protected:
+
+	/** Drain the accumulator in fixed steps and let participants present the result */
+	void StepSimulation(float GameplayDeltaTime);
+
+	/** Fire every timer on Clock due at or before Now, earliest first */
+	void ProcessTimers(EGameplayClock Clock, double Now);
+};
@@ -0,0 +1,182 @@
+#include "HardwareTierSubsystem.h"
+#include "ThemeSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/ConfigCacheIni.h"
+#include "StateRunner_Arcade.h"
+
+// The menu's pick lives with the other per-machine settings
+// Prefixed to avoid Unity build collisions
+static const FString HardwareTier_ConfigSection = TEXT("/Script/StateRunner_Arcade.HardwareTier");
+static const FString HardwareTier_TierKey = TEXT("Tier");
+
+UHardwareTierSubsystem::UHardwareTierSubsystem()
+{
+	// Shipped defaults; DefaultGame.ini can retune any of them per tier
+	LowProfile.MemoryBudgetMB = 2048;
+	LowProfile.TextureStreamingPoolMB = 300;
+	LowProfile.MaxObstaclePoolSize = 30;
+	LowProfile.MaxPickupPoolSize = 40;
+	LowProfile.MaxResidentThemes = 1;
+	LowProfile.MaxMeshVariants = 2;
+
+	StandardProfile.MemoryBudgetMB = 4096;
+	StandardProfile.TextureStreamingPoolMB = 800;
+	StandardProfile.MaxObstaclePoolSize = 60;
+	StandardProfile.MaxPickupPoolSize = 80;
+	StandardProfile.MaxResidentThemes = 2;
+	StandardProfile.MaxMeshVariants = 4;
+
+	// High: everything resident, engine texture pool
+	HighProfile.MemoryBudgetMB = 8192;
+}
+
+// --- Subsystem Lifecycle ---
+
+void UHardwareTierSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// Theme residency cap is applied straight away
+	Collection.InitializeDependency<UThemeSubsystem>();
+
+	if (const IConsoleVariable* PoolSizeVar = IConsoleManager::Get().FindConsoleVariable(TEXT("r.Streaming.PoolSize")))
+	{
+		EngineTexturePoolMB = PoolSizeVar->GetInt();
+	}
+
+	CurrentTier = DefaultTier;
+	if (!bLockTier)
+	{
+		int32 SavedTier = INDEX_NONE;
+		if (GConfig->GetInt(*HardwareTier_ConfigSection, *HardwareTier_TierKey, SavedTier, GGameUserSettingsIni)
+			&& SavedTier >= 0 && SavedTier < static_cast<int32>(EHardwareTier::Count))
+		{
+			CurrentTier = static_cast<EHardwareTier>(SavedTier);
+		}
+	}
+
+	ApplyProfile();
+
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("HardwareTierSubsystem: Tier %s%s"), *GetTierName(CurrentTier), bLockTier ? TEXT(" (locked by config)") : TEXT(""));
+}
+
+UHardwareTierSubsystem* UHardwareTierSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<UHardwareTierSubsystem>() : nullptr;
+}
+
+// --- Tier ---
+
+void UHardwareTierSubsystem::SetTier(EHardwareTier NewTier)
+{
+	if (bLockTier || NewTier == CurrentTier || NewTier >= EHardwareTier::Count)
+	{
+		return;
+	}
+
+	CurrentTier = NewTier;
+	GConfig->SetInt(*HardwareTier_ConfigSection, *HardwareTier_TierKey, static_cast<int32>(CurrentTier), GGameUserSettingsIni);
+	GConfig->Flush(false, GGameUserSettingsIni);
+
+	ApplyProfile();
+
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("HardwareTierSubsystem: Tier changed to %s (pool caps apply from the next run)"), *GetTierName(CurrentTier));
+}
+
+const FHardwareTierProfile& UHardwareTierSubsystem::GetProfileForTier(EHardwareTier Tier) const
+{
+	switch (Tier)
+	{
+		case EHardwareTier::Low:  return LowProfile;
+		case EHardwareTier::High: return HighProfile;
+		default:                  return StandardProfile;
+	}
+}
+
+FString UHardwareTierSubsystem::GetTierName(EHardwareTier Tier)
+{
+	switch (Tier)
+	{
+		case EHardwareTier::Low:      return TEXT("Low");
+		case EHardwareTier::Standard: return TEXT("Standard");
+		case EHardwareTier::High:     return TEXT("High");
+		default:                      return TEXT("???");
+	}
+}
+
+// --- Budget Helpers ---
+
+float UHardwareTierSubsystem::GetResidentMemoryMB()
+{
+	return static_cast<float>(FPlatformMemory::GetStats().UsedPhysical) / (1024.0f * 1024.0f);
+}
+
+bool UHardwareTierSubsystem::IsOverBudget() const
+{
+	const int32 BudgetMB = GetProfile().MemoryBudgetMB;
+	return BudgetMB > 0 && GetResidentMemoryMB() > BudgetMB;
+}
+
+FString UHardwareTierSubsystem::BuildBudgetSummary() const
+{
+	const FHardwareTierProfile& Profile = GetProfile();
+	const float ResidentMB = GetResidentMemoryMB();
+
+	FString Summary = FString::Printf(TEXT("Tier:%s | Mem:%.0f"), *GetTierName(CurrentTier), ResidentMB);
+	if (Profile.MemoryBudgetMB > 0)
+	{
+		Summary += FString::Printf(TEXT("/%dMB (%.0f%%)"), Profile.MemoryBudgetMB, ResidentMB * 100.0f / Profile.MemoryBudgetMB);
+	}
+	else
+	{
+		Summary += TEXT("MB");
+	}
+
+	if (const IConsoleVariable* PoolSizeVar = IConsoleManager::Get().FindConsoleVariable(TEXT("r.Streaming.PoolSize")))
+	{
+		Summary += FString::Printf(TEXT(" | TexPool:%dMB"), PoolSizeVar->GetInt());
+	}
+
+	if (const UThemeSubsystem* ThemeSubsystem = GetGameInstance()->GetSubsystem<UThemeSubsystem>())
+	{
+		Summary += FString::Printf(TEXT(" | Themes:%d"), ThemeSubsystem->GetResidentThemeCount());
+		if (Profile.MaxResidentThemes > 0)
+		{
+			Summary += FString::Printf(TEXT("/%d"), Profile.MaxResidentThemes);
+		}
+	}
+
+	return Summary;
+}
+
+// --- Internal Functions ---
+
+void UHardwareTierSubsystem::ApplyProfile()
+{
+	const FHardwareTierProfile& Profile = GetProfile();
+
+	// Uncapped tiers get the engine's own pool size back
+	const int32 TexturePoolMB = Profile.TextureStreamingPoolMB > 0 ? Profile.TextureStreamingPoolMB : EngineTexturePoolMB;
+	if (TexturePoolMB > 0)
+	{
+		if (IConsoleVariable* PoolSizeVar = IConsoleManager::Get().FindConsoleVariable(TEXT("r.Streaming.PoolSize")))
+		{
+			PoolSizeVar->Set(TexturePoolMB, ECVF_SetByGameSetting);
+		}
+	}
+
+	if (UThemeSubsystem* ThemeSubsystem = GetGameInstance()->GetSubsystem<UThemeSubsystem>())
+	{
+		ThemeSubsystem->SetMaxResidentThemes(Profile.MaxResidentThemes);
+	}
+}
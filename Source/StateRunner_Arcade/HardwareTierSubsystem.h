@@ -0,0 +1,151 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "HardwareTierSubsystem.generated.h"
+
+/**
+ * Cabinet hardware tiers. The same build ships to all of them; the tier picks the
+ * memory budget profile.
+ */
+UENUM(BlueprintType)
+enum class EHardwareTier : uint8
+{
+	Low			UMETA(DisplayName = "Low"),
+	Standard	UMETA(DisplayName = "Standard"),
+	High		UMETA(DisplayName = "High"),
+	Count		UMETA(Hidden)
+};
+
+/**
+ * Memory budget for one hardware tier. Zero means "no cap" for every limit.
+ */
+USTRUCT(BlueprintType)
+struct FHardwareTierProfile
+{
+	GENERATED_BODY()
+
+	/** Process memory the game should stay under (MB), reported against in the debug display */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Budget")
+	int32 MemoryBudgetMB = 0;
+
+	/** r.Streaming.PoolSize (MB) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Budget")
+	int32 TextureStreamingPoolMB = 0;
+
+	/** Most pooled obstacles per obstacle type */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Budget")
+	int32 MaxObstaclePoolSize = 0;
+
+	/** Most pooled pickups per pickup type */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Budget")
+	int32 MaxPickupPoolSize = 0;
+
+	/** Theme data assets kept streamed in at once (the current theme always stays) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Budget")
+	int32 MaxResidentThemes = 0;
+
+	/** Mesh variants used per obstacle type (the first N of each MeshVariants array) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Budget")
+	int32 MaxMeshVariants = 0;
+};
+
+/**
+ * Hardware Tier Subsystem
+ *
+ * Holds the cabinet's hardware tier and its budget profile. The tier is picked in the
+ * settings menu (saved in GameUserSettings) or pinned by the operator in config, and each
+ * tier's profile can be retuned there too:
+ *
+ * [/Script/StateRunner_Arcade.HardwareTierSubsystem]
+ * DefaultTier=Low
+ * bLockTier=True
+ * LowProfile=(MemoryBudgetMB=2048,TextureStreamingPoolMB=256,MaxObstaclePoolSize=30,...)
+ *
+ * Applying a tier sets the texture streaming pool and the theme residency cap right away.
+ * Pool caps and mesh variant limits are read by the spawners when a run starts.
+ */
+UCLASS(Config=Game)
+class STATERUNNER_ARCADE_API UHardwareTierSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	UHardwareTierSubsystem();
+
+	// --- Subsystem Lifecycle ---
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	/** Get the subsystem from a world context */
+	static UHardwareTierSubsystem* Get(const UObject* WorldContextObject);
+
+	// --- Tier ---
+
+	UFUNCTION(BlueprintPure, Category="Hardware Tier")
+	EHardwareTier GetTier() const { return CurrentTier; }
+
+	/** Switch tier, save it and apply its profile (ignored while the tier is locked) */
+	UFUNCTION(BlueprintCallable, Category="Hardware Tier")
+	void SetTier(EHardwareTier NewTier);
+
+	/** True when config pins the tier (the settings menu shows it read-only) */
+	UFUNCTION(BlueprintPure, Category="Hardware Tier")
+	bool IsTierLocked() const { return bLockTier; }
+
+	/** Budget profile of the current tier */
+	const FHardwareTierProfile& GetProfile() const { return GetProfileForTier(CurrentTier); }
+
+	const FHardwareTierProfile& GetProfileForTier(EHardwareTier Tier) const;
+
+	/** Display name for a tier */
+	static FString GetTierName(EHardwareTier Tier);
+
+	// --- Budget Helpers ---
+
+	/** Clamp a pool size to a tier cap (a cap of 0 leaves it alone) */
+	static int32 ApplyCap(int32 Value, int32 Cap) { return Cap > 0 ? FMath::Min(Value, Cap) : Value; }
+
+	/** Process memory in use (MB) */
+	static float GetResidentMemoryMB();
+
+	/** One-line "memory used vs budget" summary for the debug display */
+	FString BuildBudgetSummary() const;
+
+	/** True if resident memory is over the tier's budget */
+	bool IsOverBudget() const;
+
+	// --- Configuration ---
+
+protected:
+
+	/** Tier used when none has been picked in the menu (or always, when locked) */
+	UPROPERTY(Config)
+	EHardwareTier DefaultTier = EHardwareTier::Standard;
+
+	/** Operator lock: always use DefaultTier (the menu shows it read-only) */
+	UPROPERTY(Config)
+	bool bLockTier = false;
+
+	UPROPERTY(Config)
+	FHardwareTierProfile LowProfile;
+
+	UPROPERTY(Config)
+	FHardwareTierProfile StandardProfile;
+
+	UPROPERTY(Config)
+	FHardwareTierProfile HighProfile;
+
+	// --- Internal State ---
+
+	EHardwareTier CurrentTier = EHardwareTier::Standard;
+
+	/** r.Streaming.PoolSize before any profile touched it (restored for uncapped tiers) */
+	int32 EngineTexturePoolMB = INDEX_NONE;
+
+	// --- Internal Functions ---
+
+	/** Push the current profile's engine-side settings (texture pool, theme residency) */
+	void ApplyProfile();
+};
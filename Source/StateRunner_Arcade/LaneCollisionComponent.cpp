@@ -0,0 +1,232 @@
+#include "LaneCollisionComponent.h"
+#include "StateRunner_ArcadeGameMode.h"
+#include "StateRunner_ArcadeCharacter.h"
+#include "ObstacleSpawnerComponent.h"
+#include "PickupSpawnerComponent.h"
+#include "WorldScrollComponent.h"
+#include "BaseObstacle.h"
+#include "BasePickup.h"
+#include "VersusModeComponent.h"
+#include "StateRunner_Arcade.h"
+#include "Components/BoxComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "Kismet/GameplayStatics.h"
+
+ULaneCollisionComponent::ULaneCollisionComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+
+	// After the runner (jump/slide/lane movement) and the batched scroll have both moved this frame
+	PrimaryComponentTick.TickGroup = TG_PostPhysics;
+}
+
+void ULaneCollisionComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (!IsAnalytic())
+	{
+		SetComponentTickEnabled(false);
+		return;
+	}
+
+	// Fixed-step mode: one resolve per step, so a hitch can't skip contacts
+	if (UGameplaySimulationSubsystem* Simulation = UGameplaySimulationSubsystem::Get(this))
+	{
+		if (Simulation->IsFixedStepEnabled())
+		{
+			Simulation->RegisterParticipant(this, this, ESimulationPhase::Collision);
+			SetComponentTickEnabled(false);
+		}
+	}
+}
+
+void ULaneCollisionComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UGameplaySimulationSubsystem* Simulation = UGameplaySimulationSubsystem::Get(this))
+	{
+		Simulation->UnregisterParticipant(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ULaneCollisionComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	if (!CacheReferences())
+	{
+		return;
+	}
+
+	const float SweepX = (bSweepScrollDelta && CachedWorldScroll) ? CachedWorldScroll->GetCurrentScrollSpeed() * DeltaTime : 0.0f;
+	ResolveContacts(0.0f, SweepX);
+}
+
+void ULaneCollisionComponent::SimulateStep(float StepSeconds)
+{
+	if (!CacheReferences() || !CachedWorldScroll)
+	{
+		return;
+	}
+
+	const float ScrollLead = CachedWorldScroll->GetUnappliedScrollDistance();
+	const float SweepX = bSweepScrollDelta ? CachedWorldScroll->GetLastStepScrollDistance() : 0.0f;
+	ResolveContacts(ScrollLead, SweepX);
+}
+
+// --- Contact Resolution ---
+
+void ULaneCollisionComponent::ResolveContacts(float ScrollLead, float SweepX)
+{
+	const UVersusModeComponent* Versus = UVersusModeComponent::Get(this);
+	if (!Versus || !Versus->IsPlayerOut(0))
+	{
+		ResolveRunnerContacts(*CachedRunner, ScrollLead, SweepX);
+	}
+
+	// Versus: the rivals run the same obstacles and pickups
+	if (Versus)
+	{
+		Versus->ForEachRivalRunner([this, Versus, ScrollLead, SweepX](int32 Slot, AStateRunner_ArcadeCharacter& Runner)
+		{
+			if (!Versus->IsPlayerOut(Slot))
+			{
+				ResolveRunnerContacts(Runner, ScrollLead, SweepX);
+			}
+		});
+	}
+}
+
+void ULaneCollisionComponent::ResolveRunnerContacts(AStateRunner_ArcadeCharacter& Runner, float ScrollLead, float SweepX)
+{
+	const UCapsuleComponent* Capsule = Runner.GetCapsuleComponent();
+	if (!Capsule)
+	{
+		return;
+	}
+
+	// Capsule as an AABB -- half height already shrinks while sliding, Z rises while jumping
+	// Actors only move at PostSimulate; moving the runner forward by the pending scroll is equivalent
+	const FVector RunnerCenter = Capsule->GetComponentLocation() + FVector(ScrollLead, 0.0f, 0.0f);
+	const float Radius = Capsule->GetScaledCapsuleRadius();
+	const FVector RunnerExtent(Radius, Radius, Capsule->GetScaledCapsuleHalfHeight());
+	const FBox RunnerBounds(RunnerCenter - RunnerExtent, RunnerCenter + RunnerExtent);
+
+	ResolveObstacleContacts(Runner, RunnerBounds, SweepX);
+	ResolvePickupContacts(Runner, RunnerBounds, SweepX);
+}
+
+void ULaneCollisionComponent::ResolveObstacleContacts(AStateRunner_ArcadeCharacter& Runner, const FBox& RunnerBounds, float SweepX)
+{
+	if (!CachedObstacleSpawner)
+	{
+		return;
+	}
+
+	// Lane index is keyed on actor track X; pad for box extent/offset
+	const float RunnerTrackX = CachedWorldScroll ? CachedWorldScroll->WorldToTrackX(RunnerBounds.GetCenter().X) : RunnerBounds.GetCenter().X;
+	const float HalfLength = RunnerBounds.GetExtent().X + ObstacleQueryPadding;
+	const float MinTrackX = RunnerTrackX - HalfLength;
+	const float MaxTrackX = RunnerTrackX + HalfLength + SweepX;
+
+	CandidateObstacles.Reset();
+	int32 QueriedLane = INDEX_NONE;
+	if (Runner.IsLaneSwitching())
+	{
+		// Between lanes -- the Y interval test decides which lane(s) actually touch
+		CachedObstacleSpawner->GetObstaclesInRange(MinTrackX, MaxTrackX, CandidateObstacles);
+	}
+	else
+	{
+		const ELane RunnerLane = static_cast<ELane>(Runner.GetCurrentLane());
+		CachedObstacleSpawner->GetObstaclesInLaneRange(RunnerLane, MinTrackX, MaxTrackX, CandidateObstacles);
+		QueriedLane = static_cast<int32>(RunnerLane);
+	}
+
+	// Debug display follows Player 1
+	if (&Runner == CachedRunner)
+	{
+		LastResolve.Lane = QueriedLane;
+		LastResolve.RunnerBounds = RunnerBounds;
+		LastResolve.MinTrackX = MinTrackX;
+		LastResolve.MaxTrackX = MaxTrackX;
+		LastResolve.NumCandidates = CandidateObstacles.Num();
+	}
+
+	for (ABaseObstacle* Obstacle : CandidateObstacles)
+	{
+		if (IsValid(Obstacle) && Obstacle->IsActive() && BoxTouchesRunner(Obstacle->GetCollisionBox(), RunnerBounds, SweepX))
+		{
+			Obstacle->HandlePlayerContact(&Runner);
+		}
+	}
+}
+
+void ULaneCollisionComponent::ResolvePickupContacts(AStateRunner_ArcadeCharacter& Runner, const FBox& RunnerBounds, float SweepX)
+{
+	if (!CachedPickupSpawner)
+	{
+		return;
+	}
+
+	CandidatePickups.Reset();
+	for (ABasePickup* Pickup : CachedPickupSpawner->GetActivePickups())
+	{
+		if (IsValid(Pickup) && BoxTouchesRunner(Pickup->GetCollisionBox(), RunnerBounds, SweepX))
+		{
+			CandidatePickups.Add(Pickup);
+		}
+	}
+
+	// Collection deactivates the pickup (and EMP/Magnet can touch others), so handle after the scan
+	for (ABasePickup* Pickup : CandidatePickups)
+	{
+		if (IsValid(Pickup))
+		{
+			Pickup->HandlePlayerContact(&Runner);
+		}
+	}
+}
+
+bool ULaneCollisionComponent::BoxTouchesRunner(const UBoxComponent* Box, const FBox& RunnerBounds, float SweepX)
+{
+	if (!Box)
+	{
+		return false;
+	}
+
+	const FVector BoxCenter = Box->GetComponentLocation();
+	const FVector BoxExtent = Box->GetScaledBoxExtent();
+
+	// Box was up to SweepX further ahead at the start of the frame
+	return BoxCenter.X - BoxExtent.X <= RunnerBounds.Max.X
+		&& BoxCenter.X + BoxExtent.X + SweepX >= RunnerBounds.Min.X
+		&& BoxCenter.Y - BoxExtent.Y <= RunnerBounds.Max.Y
+		&& BoxCenter.Y + BoxExtent.Y >= RunnerBounds.Min.Y
+		&& BoxCenter.Z - BoxExtent.Z <= RunnerBounds.Max.Z
+		&& BoxCenter.Z + BoxExtent.Z >= RunnerBounds.Min.Z;
+}
+
+// --- Helper Functions ---
+
+bool ULaneCollisionComponent::CacheReferences()
+{
+	if (!CachedObstacleSpawner || !CachedPickupSpawner || !CachedWorldScroll)
+	{
+		if (AStateRunner_ArcadeGameMode* GameMode = Cast<AStateRunner_ArcadeGameMode>(GetOwner()))
+		{
+			CachedObstacleSpawner = GameMode->GetObstacleSpawnerComponent();
+			CachedPickupSpawner = GameMode->GetPickupSpawnerComponent();
+			CachedWorldScroll = GameMode->GetWorldScrollComponent();
+		}
+	}
+
+	if (!CachedRunner)
+	{
+		CachedRunner = Cast<AStateRunner_ArcadeCharacter>(UGameplayStatics::GetPlayerPawn(this, 0));
+	}
+
+	return CachedRunner != nullptr;
+}
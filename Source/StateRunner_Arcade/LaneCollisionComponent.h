@@ -0,0 +1,180 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "GameplaySimulationSubsystem.h"
+#include "LaneCollisionComponent.generated.h"
+
+class AStateRunner_ArcadeCharacter;
+class UObstacleSpawnerComponent;
+class UPickupSpawnerComponent;
+class UWorldScrollComponent;
+class ABaseObstacle;
+class ABasePickup;
+class UBoxComponent;
+
+/**
+ * How runner contacts with obstacles and pickups are detected.
+ */
+UENUM(BlueprintType)
+enum class ECollisionResolveMode : uint8
+{
+	/** Each pooled actor's CollisionBox generates overlap events (original behavior) */
+	PhysicsOverlap		UMETA(DisplayName = "Physics Overlap"),
+
+	/** ULaneCollisionComponent tests the runner against the active sets once per frame; pooled actors have no collision */
+	Analytic			UMETA(DisplayName = "Analytic (Lane Intervals)")
+};
+
+/**
+ * Lane Collision Component
+ *
+ * Resolves runner contacts without the physics scene. Every frame (after movement and
+ * scrolling) the runner's capsule bounds -- which already reflect jump height and slide
+ * crouch -- are tested as X/Y/Z intervals against:
+ * - Obstacles in the runner's lane(s), via the obstacle spawner's lane-sorted index
+ * - Active pickups (linear; the magnet pulls pickups off their lanes)
+ *
+ * Contacts go through the same ABaseObstacle::HandlePlayerContact /
+ * ABasePickup::HandlePlayerContact entry points the overlap handlers use.
+ * In versus each rival runner still in is tested against the same sets after Player 1.
+ * With fixed-step simulation enabled it resolves once per step (phase Collision)
+ * instead of once per frame.
+ * Attached to GameMode.
+ */
+UCLASS(ClassGroup=(StateRunner), meta=(BlueprintSpawnableComponent))
+class STATERUNNER_ARCADE_API ULaneCollisionComponent : public UActorComponent, public IGameplaySimulated
+{
+	GENERATED_BODY()
+
+public:
+
+	ULaneCollisionComponent();
+
+protected:
+
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+public:
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	/** Fixed-step mode: resolve against this step's runner and scroll state */
+	virtual void SimulateStep(float StepSeconds) override;
+
+	// --- Configuration ---
+
+protected:
+
+	/**
+	 * Analytic: pooled actors spawn with overlap generation off and this component resolves contacts.
+	 * PhysicsOverlap: this component does nothing.
+	 * Read by pooled actors at BeginPlay, so changing it at runtime only affects newly spawned actors.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Collision")
+	ECollisionResolveMode CollisionMode = ECollisionResolveMode::Analytic;
+
+	/**
+	 * Extend each obstacle/pickup's X interval by this frame's scroll distance,
+	 * so a long frame can't carry an obstacle through the runner between tests.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Collision")
+	bool bSweepScrollDelta = true;
+
+	/**
+	 * Extra X distance added to the lane index query on each side.
+	 * Must cover the largest obstacle collision half-length plus any Blueprint offset of the box from the actor origin.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Collision", meta=(ClampMin="0.0", ClampMax="2000.0"))
+	float ObstacleQueryPadding = 250.0f;
+
+	// --- Runtime State ---
+
+protected:
+
+	/** Runner (found lazily -- pawn may not exist at BeginPlay) */
+	UPROPERTY()
+	TObjectPtr<AStateRunner_ArcadeCharacter> CachedRunner;
+
+	UPROPERTY()
+	TObjectPtr<UObstacleSpawnerComponent> CachedObstacleSpawner;
+
+	UPROPERTY()
+	TObjectPtr<UPickupSpawnerComponent> CachedPickupSpawner;
+
+	UPROPERTY()
+	TObjectPtr<UWorldScrollComponent> CachedWorldScroll;
+
+	/** Scratch lists reused every frame (contact handlers may deactivate actors, so never iterate the live sets) */
+	TArray<ABaseObstacle*> CandidateObstacles;
+	TArray<ABasePickup*> CandidatePickups;
+
+public:
+
+	/** What the last obstacle resolve tested, for the debug draw */
+	struct FResolveDebugState
+	{
+		/** Runner bounds, world space (shifted by any scroll lead) */
+		FBox RunnerBounds = FBox(ForceInit);
+
+		/** Lane index query interval, track space */
+		float MinTrackX = 0.0f;
+		float MaxTrackX = 0.0f;
+
+		/** Lane queried, or INDEX_NONE when every lane was (runner mid lane switch) */
+		int32 Lane = INDEX_NONE;
+
+		/** Obstacles the query returned */
+		int32 NumCandidates = 0;
+	};
+
+protected:
+
+	FResolveDebugState LastResolve;
+
+	// --- Public Functions ---
+
+public:
+
+	/** True if pooled actors should skip physics overlaps */
+	UFUNCTION(BlueprintPure, Category="Collision")
+	bool IsAnalytic() const { return CollisionMode == ECollisionResolveMode::Analytic; }
+
+	/** Last obstacle resolve (RunnerBounds is invalid until the first one) */
+	const FResolveDebugState& GetLastResolve() const { return LastResolve; }
+
+	// --- Internal Functions ---
+
+protected:
+
+	/**
+	 * Resolve obstacle and pickup contacts for every runner.
+	 *
+	 * @param ScrollLead Scroll distance simulated but not yet applied to actors (fixed-step only);
+	 *                   the runner bounds are shifted +X by this instead of moving every actor
+	 * @param SweepX Distance the world scrolled since the last resolve
+	 */
+	void ResolveContacts(float ScrollLead, float SweepX);
+
+	/** Build one runner's bounds and resolve its contacts (Player 1, then each versus rival still in) */
+	void ResolveRunnerContacts(AStateRunner_ArcadeCharacter& Runner, float ScrollLead, float SweepX);
+
+	/** Test the runner against nearby obstacles in the lanes it can touch */
+	void ResolveObstacleContacts(AStateRunner_ArcadeCharacter& Runner, const FBox& RunnerBounds, float SweepX);
+
+	/** Test the runner against active pickups */
+	void ResolvePickupContacts(AStateRunner_ArcadeCharacter& Runner, const FBox& RunnerBounds, float SweepX);
+
+	/**
+	 * Interval test of a collision box against the runner bounds.
+	 *
+	 * @param Box Obstacle or pickup collision box
+	 * @param RunnerBounds Runner capsule as an axis-aligned box
+	 * @param SweepX Distance the box moved toward -X relative to the runner this frame
+	 */
+	static bool BoxTouchesRunner(const UBoxComponent* Box, const FBox& RunnerBounds, float SweepX);
+
+	/** Find the runner and GameMode systems. Returns false if the runner isn't available yet. */
+	bool CacheReferences();
+};
@@ -0,0 +1,67 @@
+#include "LeaderboardRowWidget.h"
+#include "LeaderboardWidget.h"
+#include "Components/TextBlock.h"
+
+void ULeaderboardRowWidget::NativeOnInitialized()
+{
+	Super::NativeOnInitialized();
+
+	if (RankText)
+	{
+		DefaultTextColor = RankText->GetColorAndOpacity();
+	}
+}
+
+void ULeaderboardRowWidget::NativeOnListItemObjectSet(UObject* ListItemObject)
+{
+	RowItem = Cast<ULeaderboardRowItem>(ListItemObject);
+	Refresh();
+}
+
+void ULeaderboardRowWidget::Refresh()
+{
+	ULeaderboardWidget* Owner = RowItem ? RowItem->Owner.Get() : nullptr;
+	if (!Owner)
+	{
+		return;
+	}
+
+	const int32 Rank = RowItem->Index + 1;
+
+	FLeaderboardEntry Entry;
+	FLinearColor Color;
+	bool bOverrideColor = false;
+	const bool bHasEntry = Owner->GetRowDisplay(RowItem->Index, Entry, Color, bOverrideColor);
+
+	if (bHasEntry)
+	{
+		SetRowText(
+			FString::Printf(TEXT("#%d"), Rank),
+			Entry.PlayerInitials.IsEmpty() ? TEXT("---") : Entry.PlayerInitials,
+			FString::Printf(TEXT("%d"), Entry.Score),
+			Entry.GetFormattedRunTime(),
+			Entry.GetFormattedDate(),
+			bOverrideColor ? FSlateColor(Color) : DefaultTextColor);
+	}
+	else
+	{
+		SetRowText(FString::Printf(TEXT("#%d"), Rank), TEXT("---"), TEXT("---"), TEXT("---"), TEXT("---"), FSlateColor(Color));
+	}
+
+	OnRowUpdated(Rank, Entry, bHasEntry);
+}
+
+void ULeaderboardRowWidget::SetRowText(const FString& Rank, const FString& Name, const FString& Score, const FString& Time, const FString& Date, const FSlateColor& Color)
+{
+	UTextBlock* const Widgets[] = { RankText, NameText, ScoreText, TimeText, DateText };
+	const FString* const Values[] = { &Rank, &Name, &Score, &Time, &Date };
+
+	for (int32 i = 0; i < UE_ARRAY_COUNT(Widgets); i++)
+	{
+		if (Widgets[i])
+		{
+			Widgets[i]->SetText(FText::FromString(*Values[i]));
+			Widgets[i]->SetColorAndOpacity(Color);
+		}
+	}
+}
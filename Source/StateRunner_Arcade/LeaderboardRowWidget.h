@@ -0,0 +1,103 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Blueprint/UserWidget.h"
+#include "Blueprint/IUserObjectListEntry.h"
+#include "LeaderboardSaveGame.h"
+#include "LeaderboardRowWidget.generated.h"
+
+class UTextBlock;
+class ULeaderboardWidget;
+
+/**
+ * List item for one leaderboard row.
+ * Only an index -- the row widget unpacks the entry from the store when it comes into view,
+ * so a 1,000-entry board never materializes 1,000 FLeaderboardEntry copies.
+ */
+UCLASS(BlueprintType)
+class STATERUNNER_ARCADE_API ULeaderboardRowItem : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Board index this row shows (0 = rank 1) */
+	UPROPERTY(BlueprintReadOnly, Category="Leaderboard")
+	int32 Index = 0;
+
+	/** Leaderboard screen that owns the list and supplies row data */
+	TWeakObjectPtr<ULeaderboardWidget> Owner;
+};
+
+/**
+ * Leaderboard Row Widget
+ *
+ * Entry widget for ULeaderboardWidget's EntryList. The list view only constructs as many of
+ * these as fit on screen and rebinds them to new items while scrolling.
+ *
+ * USAGE:
+ * 1. Create WBP_LeaderboardRow extending this class with RankText, NameText, ScoreText,
+ *    TimeText and DateText
+ * 2. Set it as the Entry Widget Class of the EntryList list view in WBP_Leaderboard
+ */
+UCLASS(Abstract, Blueprintable)
+class STATERUNNER_ARCADE_API ULeaderboardRowWidget : public UUserWidget, public IUserObjectListEntry
+{
+	GENERATED_BODY()
+
+protected:
+
+	virtual void NativeOnInitialized() override;
+	virtual void NativeOnListItemObjectSet(UObject* ListItemObject) override;
+
+	// --- Row Widgets ---
+
+protected:
+
+	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Row")
+	TObjectPtr<UTextBlock> RankText;
+
+	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Row")
+	TObjectPtr<UTextBlock> NameText;
+
+	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Row")
+	TObjectPtr<UTextBlock> ScoreText;
+
+	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Row")
+	TObjectPtr<UTextBlock> TimeText;
+
+	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Row")
+	TObjectPtr<UTextBlock> DateText;
+
+	// --- Runtime State ---
+
+protected:
+
+	/** Item currently bound to this (recycled) widget */
+	UPROPERTY(Transient)
+	TObjectPtr<ULeaderboardRowItem> RowItem;
+
+	/** Text color from the Blueprint, restored when a recycled row stops needing a medal color */
+	FSlateColor DefaultTextColor;
+
+	// --- Public Functions ---
+
+public:
+
+	/** Re-read the bound row from the leaderboard (highlight or board contents changed) */
+	void Refresh();
+
+	// --- Blueprint Events ---
+
+public:
+
+	/** Called after the row's text is updated (bHasEntry = false for an empty slot) */
+	UFUNCTION(BlueprintImplementableEvent, Category="Events")
+	void OnRowUpdated(int32 Rank, const FLeaderboardEntry& Entry, bool bHasEntry);
+
+	// --- Internal Functions ---
+
+protected:
+
+	void SetRowText(const FString& Rank, const FString& Name, const FString& Score, const FString& Time, const FString& Date, const FSlateColor& Color);
+};
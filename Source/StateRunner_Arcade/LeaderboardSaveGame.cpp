@@ -0,0 +1,248 @@
+#include "LeaderboardSaveGame.h"
+#include "Algo/BinarySearch.h"
+
+// --- Packed Entry ---
+
+FPackedLeaderboardEntry FPackedLeaderboardEntry::Pack(const FLeaderboardEntry& Entry)
+{
+	FPackedLeaderboardEntry Packed;
+	Packed.Score = Entry.Score;
+	Packed.RunTimeMs = static_cast<uint32>(FMath::Clamp<double>(Entry.RunTimeSeconds * 1000.0, 0.0, static_cast<double>(MAX_uint32)));
+	Packed.Timestamp = static_cast<uint32>(FMath::Clamp<int64>(Entry.DateAchieved.ToUnixTimestamp(), 0, MAX_uint32));
+
+	const int32 NumChars = FMath::Min(Entry.PlayerInitials.Len(), 3);
+	for (int32 i = 0; i < NumChars; i++)
+	{
+		const TCHAR Char = FChar::ToUpper(Entry.PlayerInitials[i]);
+		const uint32 Ascii = (Char > 0 && Char < 128) ? static_cast<uint32>(Char) : static_cast<uint32>('-');
+		Packed.Initials |= Ascii << (i * 8);
+	}
+	return Packed;
+}
+
+FLeaderboardEntry FPackedLeaderboardEntry::Unpack() const
+{
+	TCHAR InitialsBuffer[4] = {};
+	int32 NumChars = 0;
+	for (int32 i = 0; i < 3; i++)
+	{
+		const TCHAR Char = static_cast<TCHAR>((Initials >> (i * 8)) & 0xFF);
+		if (Char == 0)
+		{
+			break;
+		}
+		InitialsBuffer[NumChars++] = Char;
+	}
+
+	FLeaderboardEntry Entry(Score, RunTimeMs / 1000.0f, FDateTime::FromUnixTimestamp(Timestamp));
+	if (NumChars > 0)
+	{
+		Entry.PlayerInitials = InitialsBuffer;
+	}
+	return Entry;
+}
+
+// --- Board ---
+
+int32 FLeaderboardBoard::Insert(const FPackedLeaderboardEntry& Entry, int32 Capacity)
+{
+	// First slot holding a lower score -- after any equal scores already on the board
+	const int32 Index = Algo::UpperBoundBy(Entries, Entry.Score, &FPackedLeaderboardEntry::Score, TGreater<>());
+	if (Index >= Capacity)
+	{
+		return 0;
+	}
+
+	Entries.Insert(Entry, Index);
+	if (Entries.Num() > Capacity)
+	{
+		Entries.SetNum(Capacity, EAllowShrinking::No);
+	}
+	return Index + 1;
+}
+
+int32 FLeaderboardBoard::GetRankForScore(int32 Score, int32 Capacity) const
+{
+	const int32 Index = Algo::UpperBoundBy(Entries, Score, &FPackedLeaderboardEntry::Score, TGreater<>());
+	return Index < Capacity ? Index + 1 : 0;
+}
+
+void FLeaderboardBoard::GetPage(int32 FirstIndex, int32 Count, TArray<FLeaderboardEntry>& OutEntries) const
+{
+	const int32 Start = FMath::Max(FirstIndex, 0);
+	const int32 End = FMath::Min(Start + FMath::Max(Count, 0), Entries.Num());
+	if (Start >= End)
+	{
+		return;
+	}
+
+	OutEntries.Reserve(OutEntries.Num() + (End - Start));
+	for (int32 i = Start; i < End; i++)
+	{
+		OutEntries.Add(Entries[i].Unpack());
+	}
+}
+
+// --- Periods ---
+
+int32 ULeaderboardSaveGame::GetCapacity(ELeaderboardPeriod Period)
+{
+	switch (Period)
+	{
+	case ELeaderboardPeriod::Daily:
+		return DailyCapacity;
+	case ELeaderboardPeriod::Weekly:
+		return WeeklyCapacity;
+	default:
+		return AllTimeCapacity;
+	}
+}
+
+int32 ULeaderboardSaveGame::GetPeriodKey(ELeaderboardPeriod Period, const FDateTime& Date)
+{
+	// Same day numbering as FPackedLeaderboardEntry::GetDayNumber
+	const int32 DayNumber = static_cast<int32>(FMath::Max<int64>(Date.ToUnixTimestamp(), 0) / 86400);
+
+	switch (Period)
+	{
+	case ELeaderboardPeriod::Daily:
+		return DayNumber;
+	case ELeaderboardPeriod::Weekly:
+		// EDayOfWeek starts at Monday = 0
+		return DayNumber - static_cast<int32>(Date.GetDayOfWeek());
+	default:
+		return 0;
+	}
+}
+
+void ULeaderboardSaveGame::RollPeriods(const FDateTime& Now)
+{
+	for (const ELeaderboardPeriod Period : { ELeaderboardPeriod::Daily, ELeaderboardPeriod::Weekly })
+	{
+		FLeaderboardBoard& Board = GetBoard(Period);
+		const int32 CurrentKey = GetPeriodKey(Period, Now);
+		if (Board.PeriodKey != CurrentKey)
+		{
+			Board.Entries.Reset();
+			Board.PeriodKey = CurrentKey;
+		}
+	}
+}
+
+FLeaderboardBoard& ULeaderboardSaveGame::GetBoard(ELeaderboardPeriod Period)
+{
+	return const_cast<FLeaderboardBoard&>(AsConst(*this).GetBoard(Period));
+}
+
+const FLeaderboardBoard& ULeaderboardSaveGame::GetBoard(ELeaderboardPeriod Period) const
+{
+	switch (Period)
+	{
+	case ELeaderboardPeriod::Daily:
+		return DailyBoard;
+	case ELeaderboardPeriod::Weekly:
+		return WeeklyBoard;
+	default:
+		return AllTimeBoard;
+	}
+}
+
+const FLeaderboardBoard* ULeaderboardSaveGame::FindCurrentBoard(ELeaderboardPeriod Period) const
+{
+	const FLeaderboardBoard& Board = GetBoard(Period);
+	if (Period != ELeaderboardPeriod::AllTime && Board.PeriodKey != GetPeriodKey(Period, FDateTime::Now()))
+	{
+		return nullptr;
+	}
+	return &Board;
+}
+
+// --- Submission ---
+
+int32 ULeaderboardSaveGame::AddEntry(const FLeaderboardEntry& NewEntry)
+{
+	RollPeriods(FDateTime::Now());
+
+	const FPackedLeaderboardEntry Packed = FPackedLeaderboardEntry::Pack(NewEntry);
+
+	for (const ELeaderboardPeriod Period : { ELeaderboardPeriod::Daily, ELeaderboardPeriod::Weekly })
+	{
+		FLeaderboardBoard& Board = GetBoard(Period);
+		if (GetPeriodKey(Period, NewEntry.DateAchieved) == Board.PeriodKey)
+		{
+			Board.Insert(Packed, GetCapacity(Period));
+		}
+	}
+
+	return AllTimeBoard.Insert(Packed, AllTimeCapacity);
+}
+
+void ULeaderboardSaveGame::ImportEntries(const TArray<FLeaderboardEntry>& InEntries)
+{
+	for (const FLeaderboardEntry& Entry : InEntries)
+	{
+		AddEntry(Entry);
+	}
+}
+
+void ULeaderboardSaveGame::Clear()
+{
+	AllTimeBoard.Entries.Reset();
+	DailyBoard.Entries.Reset();
+	WeeklyBoard.Entries.Reset();
+}
+
+// --- Queries ---
+
+int32 ULeaderboardSaveGame::GetNumEntries(ELeaderboardPeriod Period) const
+{
+	const FLeaderboardBoard* Board = FindCurrentBoard(Period);
+	return Board ? Board->Entries.Num() : 0;
+}
+
+void ULeaderboardSaveGame::GetEntries(ELeaderboardPeriod Period, int32 FirstIndex, int32 Count, TArray<FLeaderboardEntry>& OutEntries) const
+{
+	if (const FLeaderboardBoard* Board = FindCurrentBoard(Period))
+	{
+		Board->GetPage(FirstIndex, Count, OutEntries);
+	}
+}
+
+bool ULeaderboardSaveGame::GetEntry(ELeaderboardPeriod Period, int32 Index, FLeaderboardEntry& OutEntry) const
+{
+	const FLeaderboardBoard* Board = FindCurrentBoard(Period);
+	if (!Board || !Board->Entries.IsValidIndex(Index))
+	{
+		return false;
+	}
+
+	OutEntry = Board->Entries[Index].Unpack();
+	return true;
+}
+
+int32 ULeaderboardSaveGame::GetRankForScore(ELeaderboardPeriod Period, int32 Score) const
+{
+	const FLeaderboardBoard* Board = FindCurrentBoard(Period);
+	if (!Board)
+	{
+		// Period rolled over -- the board is effectively empty
+		return 1;
+	}
+	return Board->GetRankForScore(Score, GetCapacity(Period));
+}
+
+bool ULeaderboardSaveGame::WouldQualify(int32 Score) const
+{
+	return GetRankForScore(ELeaderboardPeriod::AllTime, Score) > 0
+		|| GetRankForScore(ELeaderboardPeriod::Weekly, Score) > 0
+		|| GetRankForScore(ELeaderboardPeriod::Daily, Score) > 0;
+}
+
+int32 ULeaderboardSaveGame::GetMinimumQualifyingScore() const
+{
+	if (AllTimeBoard.Entries.Num() < AllTimeCapacity)
+	{
+		return 0;
+	}
+	return AllTimeBoard.Entries.Last().Score + 1;
+}
@@ -0,0 +1,264 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/SaveGame.h"
+#include "LeaderboardSaveGame.generated.h"
+
+/**
+ * Single leaderboard entry with score, run time, date, and player initials.
+ * This is the readable form handed to UI and Blueprint; storage uses FPackedLeaderboardEntry.
+ */
+USTRUCT(BlueprintType)
+struct FLeaderboardEntry
+{
+	GENERATED_BODY()
+
+	/** The score achieved */
+	UPROPERTY(BlueprintReadOnly, Category="Leaderboard")
+	int32 Score = 0;
+
+	/** Run duration in seconds */
+	UPROPERTY(BlueprintReadOnly, Category="Leaderboard")
+	float RunTimeSeconds = 0.0f;
+
+	/** Date and time when the score was achieved */
+	UPROPERTY(BlueprintReadOnly, Category="Leaderboard")
+	FDateTime DateAchieved;
+
+	/** Player initials (3 characters max, e.g., "AAA") */
+	UPROPERTY(BlueprintReadOnly, Category="Leaderboard")
+	FString PlayerInitials = TEXT("---");
+
+	/** Default constructor */
+	FLeaderboardEntry()
+		: Score(0)
+		, RunTimeSeconds(0.0f)
+		, DateAchieved(FDateTime::Now())
+		, PlayerInitials(TEXT("---"))
+	{
+	}
+
+	/** Constructor with values (no initials - legacy support) */
+	FLeaderboardEntry(int32 InScore, float InRunTime, FDateTime InDate)
+		: Score(InScore)
+		, RunTimeSeconds(InRunTime)
+		, DateAchieved(InDate)
+		, PlayerInitials(TEXT("---"))
+	{
+	}
+
+	/** Constructor with values including initials */
+	FLeaderboardEntry(int32 InScore, float InRunTime, FDateTime InDate, const FString& InInitials)
+		: Score(InScore)
+		, RunTimeSeconds(InRunTime)
+		, DateAchieved(InDate)
+		, PlayerInitials(InInitials.Left(3).ToUpper())
+	{
+	}
+
+	/** Get formatted run time string (MM:SS or HH:MM:SS) */
+	FString GetFormattedRunTime() const
+	{
+		int32 TotalSeconds = FMath::FloorToInt(RunTimeSeconds);
+		int32 Hours = TotalSeconds / 3600;
+		int32 Minutes = (TotalSeconds % 3600) / 60;
+		int32 Seconds = TotalSeconds % 60;
+
+		if (Hours > 0)
+		{
+			return FString::Printf(TEXT("%d:%02d:%02d"), Hours, Minutes, Seconds);
+		}
+		return FString::Printf(TEXT("%d:%02d"), Minutes, Seconds);
+	}
+
+	/** Get formatted date string (MM/DD/YYYY) */
+	FString GetFormattedDate() const
+	{
+		return FString::Printf(TEXT("%02d/%02d/%04d"),
+			DateAchieved.GetMonth(),
+			DateAchieved.GetDay(),
+			DateAchieved.GetYear());
+	}
+
+	/** Get formatted date and time string */
+	FString GetFormattedDateTime() const
+	{
+		return FString::Printf(TEXT("%02d/%02d/%04d %02d:%02d"),
+			DateAchieved.GetMonth(),
+			DateAchieved.GetDay(),
+			DateAchieved.GetYear(),
+			DateAchieved.GetHour(),
+			DateAchieved.GetMinute());
+	}
+};
+
+/**
+ * Fixed-size stored form of a leaderboard entry (16 bytes, no heap string).
+ * A 1,000-entry board is one flat 16 KB array that sorts, shifts and copies cheaply.
+ */
+USTRUCT()
+struct FPackedLeaderboardEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 Score = 0;
+
+	/** Run duration in milliseconds */
+	UPROPERTY()
+	uint32 RunTimeMs = 0;
+
+	/** When the score was achieved, as Unix seconds of the cabinet's local clock */
+	UPROPERTY()
+	uint32 Timestamp = 0;
+
+	/** Up to three ASCII initials, first character in the low byte (0 = unused) */
+	UPROPERTY()
+	uint32 Initials = 0;
+
+	static FPackedLeaderboardEntry Pack(const FLeaderboardEntry& Entry);
+	FLeaderboardEntry Unpack() const;
+
+	/** Calendar day (days since the Unix epoch) this entry was achieved on */
+	int32 GetDayNumber() const { return static_cast<int32>(Timestamp / 86400u); }
+};
+
+static_assert(sizeof(FPackedLeaderboardEntry) == 16, "FPackedLeaderboardEntry should stay a fixed 16-byte record");
+
+/**
+ * Which board a query or submission targets.
+ */
+UENUM(BlueprintType)
+enum class ELeaderboardPeriod : uint8
+{
+	AllTime		UMETA(DisplayName = "All Time"),
+	Daily		UMETA(DisplayName = "Today"),
+	Weekly		UMETA(DisplayName = "This Week")
+};
+
+/**
+ * One sorted board of packed entries.
+ * Highest score first; equal scores keep submission order (the earlier run ranks higher).
+ */
+USTRUCT()
+struct FLeaderboardBoard
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FPackedLeaderboardEntry> Entries;
+
+	/** Day or week number the entries belong to (0 for the all-time board) */
+	UPROPERTY()
+	int32 PeriodKey = 0;
+
+	/**
+	 * Insert in sorted position (binary search) and trim to Capacity.
+	 * @return 1-based rank, or 0 if the entry didn't make the board
+	 */
+	int32 Insert(const FPackedLeaderboardEntry& Entry, int32 Capacity);
+
+	/** Rank a new run with Score would get (1-based), or 0 if it wouldn't make the board */
+	int32 GetRankForScore(int32 Score, int32 Capacity) const;
+
+	/** Append up to Count unpacked entries starting at FirstIndex */
+	void GetPage(int32 FirstIndex, int32 Count, TArray<FLeaderboardEntry>& OutEntries) const;
+};
+
+/**
+ * Save game class for leaderboard persistence.
+ * Holds the all-time board plus today's and this week's boards, each a sorted packed array.
+ * Period boards empty themselves when their day/week rolls over.
+ */
+UCLASS()
+class STATERUNNER_ARCADE_API ULeaderboardSaveGame : public USaveGame
+{
+	GENERATED_BODY()
+
+public:
+
+	// --- Capacity ---
+
+	static constexpr int32 AllTimeCapacity = 1000;
+	static constexpr int32 DailyCapacity = 100;
+	static constexpr int32 WeeklyCapacity = 250;
+
+	static int32 GetCapacity(ELeaderboardPeriod Period);
+
+	/** Day number (daily) or number of the Monday the week starts on (weekly) for a date; 0 for all-time */
+	static int32 GetPeriodKey(ELeaderboardPeriod Period, const FDateTime& Date);
+
+	// --- Storage ---
+
+	UPROPERTY()
+	FLeaderboardBoard AllTimeBoard;
+
+	UPROPERTY()
+	FLeaderboardBoard DailyBoard;
+
+	UPROPERTY()
+	FLeaderboardBoard WeeklyBoard;
+
+	/**
+	 * Pre-packed top-10 layout. Only filled when an old "Leaderboard" slot is loaded for
+	 * migration (see ImportEntries); never written by current code.
+	 */
+	UPROPERTY()
+	TArray<FLeaderboardEntry> Entries;
+
+	// --- Submission ---
+
+	/**
+	 * Add a new entry to every board it belongs to.
+	 *
+	 * @param NewEntry The entry to add
+	 * @return The all-time rank (1-AllTimeCapacity) if the entry made the board, 0 if it didn't qualify
+	 */
+	int32 AddEntry(const FLeaderboardEntry& NewEntry);
+
+	/** Insert already-recorded entries (legacy migration); period boards only take current ones */
+	void ImportEntries(const TArray<FLeaderboardEntry>& InEntries);
+
+	/** Empty every board */
+	void Clear();
+
+	/** Empty period boards whose day/week is over */
+	void RollPeriods(const FDateTime& Now);
+
+	// --- Queries ---
+
+	/** Entries on a board (stale period boards count as empty) */
+	int32 GetNumEntries(ELeaderboardPeriod Period) const;
+
+	/** Up to Count entries starting at FirstIndex (0 = rank 1), appended to OutEntries */
+	void GetEntries(ELeaderboardPeriod Period, int32 FirstIndex, int32 Count, TArray<FLeaderboardEntry>& OutEntries) const;
+
+	/** Unpack a single entry; false if Index is past the end of the board */
+	bool GetEntry(ELeaderboardPeriod Period, int32 Index, FLeaderboardEntry& OutEntry) const;
+
+	/** Rank a run with Score would get on a board, or 0 if it wouldn't place */
+	int32 GetRankForScore(ELeaderboardPeriod Period, int32 Score) const;
+
+	/**
+	 * Check if a score would place on any board.
+	 *
+	 * @param Score The score to check
+	 * @return True if the score would make the all-time, daily or weekly board
+	 */
+	bool WouldQualify(int32 Score) const;
+
+	/**
+	 * Get the minimum score needed to qualify for the all-time board.
+	 *
+	 * @return The minimum qualifying score, or 0 if the board isn't full
+	 */
+	int32 GetMinimumQualifyingScore() const;
+
+protected:
+
+	const FLeaderboardBoard& GetBoard(ELeaderboardPeriod Period) const;
+	FLeaderboardBoard& GetBoard(ELeaderboardPeriod Period);
+
+	/** The board if it holds the current period's entries, else null */
+	const FLeaderboardBoard* FindCurrentBoard(ELeaderboardPeriod Period) const;
+};
@@ -1,9 +1,12 @@
 #include "LeaderboardWidget.h"
 #include "Components/Button.h"
 #include "Components/TextBlock.h"
+#include "Components/ListView.h"
+#include "LeaderboardRowWidget.h"
 #include "Kismet/GameplayStatics.h"
 #include "StateRunner_ArcadeGameMode.h"
 #include "ScoreSystemComponent.h"
+#include "ArcadeSaveSubsystem.h"
 #include "StateRunner_Arcade.h"
 
 ULeaderboardWidget::ULeaderboardWidget(const FObjectInitializer& ObjectInitializer)
@@ -107,6 +110,25 @@ void ULeaderboardWidget::NativeDestruct()
 	Super::NativeDestruct();
 }
 
+FReply ULeaderboardWidget::NativeOnKeyDown(const FGeometry& InGeometry, const FKeyEvent& InKeyEvent)
+{
+	const FKey Key = InKeyEvent.GetKey();
+
+	// Board scrolling -- arrows stay on the buttons
+	if (Key == EKeys::PageUp || Key == EKeys::Gamepad_LeftShoulder)
+	{
+		ScrollPages(-1);
+		return FReply::Handled();
+	}
+	if (Key == EKeys::PageDown || Key == EKeys::Gamepad_RightShoulder)
+	{
+		ScrollPages(1);
+		return FReply::Handled();
+	}
+
+	return Super::NativeOnKeyDown(InGeometry, InKeyEvent);
+}
+
 //=============================================================================
 // COMPONENT REFERENCES
 //=============================================================================
@@ -126,10 +148,8 @@ void ULeaderboardWidget::CacheComponentReferences()
 // LEADERBOARD POPULATION
 //=============================================================================
 
-void ULeaderboardWidget::PopulateLeaderboard()
+const ULeaderboardSaveGame* ULeaderboardWidget::GetLeaderboardStore()
 {
-	TArray<FLeaderboardEntry> Entries;
-	
 	// Try to get from ScoreSystemComponent first (works during gameplay)
 	if (!ScoreSystem)
 	{
@@ -138,65 +158,101 @@ void ULeaderboardWidget::PopulateLeaderboard()
 
 	if (ScoreSystem)
 	{
-		// Get leaderboard data from the active score system
-		Entries = ScoreSystem->GetLeaderboard();
+		return ScoreSystem->GetLeaderboardStore();
 	}
-	else
+
+	// No ScoreSystem available (e.g., viewing from main menu) -- read the in-memory copy
+	const UArcadeSaveSubsystem* Saves = UArcadeSaveSubsystem::Get(this);
+	return Saves ? Saves->GetLeaderboard() : nullptr;
+}
+
+int32 ULeaderboardWidget::GetMaxFirstVisibleIndex() const
+{
+	return FMath::Max(DisplayedEntryCount - VisibleRows, 0);
+}
+
+bool ULeaderboardWidget::GetRankColor(int32 Rank, FLinearColor& OutColor) const
+{
+	// The run's highlight is an all-time rank
+	const int32 HighlightRank = DisplayedPeriod == ELeaderboardPeriod::AllTime ? CurrentRunRank : 0;
+
+	// Current run's rank gets highlight color (overrides medal colors for emphasis)
+	if (HighlightRank > 0 && HighlightRank == Rank)
 	{
-		// No ScoreSystem available (e.g., viewing from main menu)
-		// Load directly from save file
-		ULeaderboardSaveGame* SaveGame = Cast<ULeaderboardSaveGame>(
-			UGameplayStatics::LoadGameFromSlot(TEXT("Leaderboard"), 0));
-		
-		if (SaveGame)
-		{
-			Entries = SaveGame->Entries;
-			UE_LOG(LogStateRunner_Arcade, Log, TEXT("LeaderboardWidget: Loaded %d entries directly from save file"), Entries.Num());
-		}
-		else
-		{
-			UE_LOG(LogStateRunner_Arcade, Log, TEXT("LeaderboardWidget: No save file found - showing empty leaderboard"));
-		}
+		OutColor = HighlightColor;
+		return true;
 	}
 
-	UE_LOG(LogStateRunner_Arcade, Log, TEXT("LeaderboardWidget: Populating with %d entries"), Entries.Num());
+	// Top 3 get medal colors (HDR values for vibrancy); other ranks keep the Blueprint default
+	switch (Rank)
+	{
+	case 1:
+		OutColor = GoldColor;
+		return true;
+	case 2:
+		OutColor = SilverColor;
+		return true;
+	case 3:
+		OutColor = BronzeColor;
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool ULeaderboardWidget::GetRowDisplay(int32 Index, FLeaderboardEntry& OutEntry, FLinearColor& OutColor, bool& bOutOverrideColor)
+{
+	const ULeaderboardSaveGame* Store = GetLeaderboardStore();
+	if (!Store || !Store->GetEntry(DisplayedPeriod, Index, OutEntry))
+	{
+		OutColor = EmptyColor;
+		bOutOverrideColor = true;
+		return false;
+	}
+
+	bOutOverrideColor = GetRankColor(Index + 1, OutColor);
+	return true;
+}
+
+void ULeaderboardWidget::PopulateLeaderboard()
+{
+	const ULeaderboardSaveGame* Store = GetLeaderboardStore();
+	DisplayedEntryCount = Store ? Store->GetNumEntries(DisplayedPeriod) : 0;
+	FirstVisibleIndex = FMath::Clamp(FirstVisibleIndex, 0, GetMaxFirstVisibleIndex());
+
+	if (EntryList)
+	{
+		// Virtualized: rows unpack their own entry when they come into view
+		SyncRowItems();
+		RefreshVisibleRows();
+		EntryList->SetScrollOffset(static_cast<float>(FirstVisibleIndex));
+
+		OnLeaderboardWindowChanged(DisplayedPeriod, FirstVisibleIndex + 1, DisplayedEntryCount);
+		return;
+	}
+
+	// Only the visible window is unpacked
+	TArray<FLeaderboardEntry> Entries;
+	if (Store)
+	{
+		Store->GetEntries(DisplayedPeriod, FirstVisibleIndex, VisibleRows, Entries);
+	}
+
+	UE_LOG(LogStateRunner_Arcade, Verbose, TEXT("LeaderboardWidget: Showing ranks %d-%d of %d"),
+		FirstVisibleIndex + 1, FirstVisibleIndex + Entries.Num(), DisplayedEntryCount);
 
 	// Populate each row
-	for (int32 i = 0; i < 10; i++)
+	for (int32 i = 0; i < VisibleRows; i++)
 	{
+		const int32 Rank = FirstVisibleIndex + i + 1;
+
 		if (i < Entries.Num())
 		{
 			const FLeaderboardEntry& Entry = Entries[i];
 			
-			// Determine if this entry needs special coloring
 			// Only top 3 ranks and current run's rank get special colors
-			// Ranks 4-10 are left alone (Blueprint default white)
-			bool bNeedsSpecialColor = false;
 			FLinearColor EntryColor = FLinearColor::White;
-			
-			// Current run's rank gets highlight color (overrides medal colors for emphasis)
-			if (CurrentRunRank > 0 && CurrentRunRank == (i + 1))
-			{
-				EntryColor = HighlightColor;
-				bNeedsSpecialColor = true;
-			}
-			// Top 3 get medal colors (HDR values for vibrancy)
-			else if (i == 0)
-			{
-				EntryColor = GoldColor;   // #1 = Gold
-				bNeedsSpecialColor = true;
-			}
-			else if (i == 1)
-			{
-				EntryColor = SilverColor; // #2 = Silver
-				bNeedsSpecialColor = true;
-			}
-			else if (i == 2)
-			{
-				EntryColor = BronzeColor; // #3 = Bronze
-				bNeedsSpecialColor = true;
-			}
-			// Ranks 4-10: Don't set color, leave Blueprint default (white)
+			const bool bNeedsSpecialColor = GetRankColor(Rank, EntryColor);
 
 			// Use player initials, or "---" if empty/legacy entry
 			FString DisplayName = Entry.PlayerInitials.IsEmpty() ? TEXT("---") : Entry.PlayerInitials;
@@ -205,7 +261,7 @@ void ULeaderboardWidget::PopulateLeaderboard()
 			{
 				SetEntryText(
 					i,
-					FString::Printf(TEXT("#%d"), i + 1),
+					FString::Printf(TEXT("#%d"), Rank),
 					DisplayName,
 					FString::Printf(TEXT("%d"), Entry.Score),
 					Entry.GetFormattedRunTime(),
@@ -215,10 +271,10 @@ void ULeaderboardWidget::PopulateLeaderboard()
 			}
 			else
 			{
-				// Ranks 4-10: Set text only, don't override color
+				// Set text only, don't override color
 				SetEntryTextOnly(
 					i,
-					FString::Printf(TEXT("#%d"), i + 1),
+					FString::Printf(TEXT("#%d"), Rank),
 					DisplayName,
 					FString::Printf(TEXT("%d"), Entry.Score),
 					Entry.GetFormattedRunTime(),
@@ -229,7 +285,42 @@ void ULeaderboardWidget::PopulateLeaderboard()
 		else
 		{
 			// Empty slot
-			SetEntryText(i, FString::Printf(TEXT("#%d"), i + 1), TEXT("---"), TEXT("---"), TEXT("---"), TEXT("---"), EmptyColor);
+			SetEntryText(i, FString::Printf(TEXT("#%d"), Rank), TEXT("---"), TEXT("---"), TEXT("---"), TEXT("---"), EmptyColor);
+		}
+	}
+
+	OnLeaderboardWindowChanged(DisplayedPeriod, FirstVisibleIndex + 1, DisplayedEntryCount);
+}
+
+void ULeaderboardWidget::SyncRowItems()
+{
+	// Always at least one page so an empty board still shows its slots
+	const int32 RowCount = FMath::Max(DisplayedEntryCount, VisibleRows);
+	if (RowItems.Num() == RowCount)
+	{
+		return;
+	}
+
+	const int32 OldCount = RowItems.Num();
+	RowItems.SetNum(RowCount);
+	for (int32 i = OldCount; i < RowCount; i++)
+	{
+		ULeaderboardRowItem* Item = NewObject<ULeaderboardRowItem>(this);
+		Item->Index = i;
+		Item->Owner = this;
+		RowItems[i] = Item;
+	}
+
+	EntryList->SetListItems(RowItems);
+}
+
+void ULeaderboardWidget::RefreshVisibleRows()
+{
+	for (UUserWidget* EntryWidget : EntryList->GetDisplayedEntryWidgets())
+	{
+		if (ULeaderboardRowWidget* Row = Cast<ULeaderboardRowWidget>(EntryWidget))
+		{
+			Row->Refresh();
 		}
 	}
 }
@@ -237,10 +328,57 @@ void ULeaderboardWidget::PopulateLeaderboard()
 void ULeaderboardWidget::SetHighlightedRank(int32 Rank)
 {
 	CurrentRunRank = Rank;
+
+	// Bring the run's row into view (roughly centred past the first page)
+	if (Rank > 0)
+	{
+		DisplayedPeriod = ELeaderboardPeriod::AllTime;
+		FirstVisibleIndex = Rank > VisibleRows ? Rank - 1 - VisibleRows / 2 : 0;
+	}
+
 	// Re-populate to update colors
 	PopulateLeaderboard();
 }
 
+void ULeaderboardWidget::SetDisplayedPeriod(ELeaderboardPeriod Period)
+{
+	if (DisplayedPeriod == Period)
+	{
+		return;
+	}
+
+	DisplayedPeriod = Period;
+	FirstVisibleIndex = 0;
+	PopulateLeaderboard();
+}
+
+void ULeaderboardWidget::ScrollRows(int32 RowDelta)
+{
+	const int32 NewFirstIndex = FMath::Clamp(FirstVisibleIndex + RowDelta, 0, GetMaxFirstVisibleIndex());
+	if (NewFirstIndex == FirstVisibleIndex)
+	{
+		return;
+	}
+
+	FirstVisibleIndex = NewFirstIndex;
+
+	if (EntryList)
+	{
+		// The list rebinds recycled rows itself -- no repopulate
+		EntryList->SetScrollOffset(static_cast<float>(FirstVisibleIndex));
+		OnLeaderboardWindowChanged(DisplayedPeriod, FirstVisibleIndex + 1, DisplayedEntryCount);
+	}
+	else
+	{
+		PopulateLeaderboard();
+	}
+}
+
+void ULeaderboardWidget::ScrollPages(int32 PageDelta)
+{
+	ScrollRows(PageDelta * VisibleRows);
+}
+
 void ULeaderboardWidget::SetEntryText(int32 Index, const FString& Rank, const FString& Name, const FString& Score, const FString& Time, const FString& Date, const FLinearColor& Color)
 {
 	UTextBlock* RankWidget = nullptr;
@@ -7,17 +7,26 @@
 
 class UTextBlock;
 class UButton;
+class UListView;
 class UScoreSystemComponent;
+class ULeaderboardRowItem;
 
 /**
  * Leaderboard Widget for StateRunner Arcade
  * 
- * Displays top 10 scores with rank, score, time, and date.
- * Can be opened from the Game Over screen.
+ * Displays a 10-row window onto the all-time, daily or weekly board with rank, score,
+ * time, and date. Can be opened from the Game Over screen.
  * 
  * DISPLAYS:
- * - 10 leaderboard entries (Rank, Score, Time, Date)
- * - Highlights the current run's rank if it qualified
+ * - 10 leaderboard entries (Rank, Score, Time, Date) starting at FirstVisibleIndex;
+ *   only those rows are read from the store, however long the board is
+ * - Highlights the current run's rank if it qualified (the window scrolls to it)
+ * - With an EntryList list view bound instead, the whole board scrolls in a virtualized
+ *   list: only visible rows get a (recycled) ULeaderboardRowWidget
+ * 
+ * SCROLLING:
+ * - Page Up/Down (gamepad shoulders): move a page through the board
+ * - Blueprint: ScrollRows / ScrollPages / SetDisplayedPeriod
  * 
  * BUTTONS (keyboard navigable):
  * - Back: Returns to Game Over screen
@@ -42,6 +51,7 @@ protected:
 
 	virtual void NativeConstruct() override;
 	virtual void NativeDestruct() override;
+	virtual FReply NativeOnKeyDown(const FGeometry& InGeometry, const FKeyEvent& InKeyEvent) override;
 
 	//=============================================================================
 	// TITLE
@@ -53,6 +63,19 @@ protected:
 	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Title")
 	TObjectPtr<UTextBlock> TitleText;
 
+	//=============================================================================
+	// LEADERBOARD LIST
+	//=============================================================================
+
+protected:
+
+	/**
+	 * Virtualized list of the whole board (entry class: a ULeaderboardRowWidget Blueprint).
+	 * When bound, the fixed rows below are ignored.
+	 */
+	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Entries")
+	TObjectPtr<UListView> EntryList;
+
 	//=============================================================================
 	// LEADERBOARD ENTRY WIDGETS
 	// 10 rows, each with Rank, Name (initials), Score, Time, Date
@@ -237,6 +260,13 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Configuration")
 	FName GameplayLevelName = TEXT("SR_OfficialTrack");
 
+	/** Board shown when the widget opens */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Configuration")
+	ELeaderboardPeriod DisplayedPeriod = ELeaderboardPeriod::AllTime;
+
+	/** Number of bound entry rows (Rank1Text .. Rank10Text) */
+	static constexpr int32 VisibleRows = 10;
+
 	/** Color for #1 rank (Gold) - warm orange-gold */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Configuration|Colors")
 	FLinearColor GoldColor = FLinearColor(1.0f, 0.7f, 0.0f, 1.0f);
@@ -286,10 +316,22 @@ protected:
 
 protected:
 
-	/** Rank achieved by current run (0 = didn't qualify, 1-10 = rank) */
+	/** All-time rank achieved by current run (0 = didn't qualify) */
 	UPROPERTY(BlueprintReadOnly, Category="State")
 	int32 CurrentRunRank = 0;
 
+	/** Board index shown in the first row (0 = rank 1) */
+	UPROPERTY(BlueprintReadOnly, Category="State")
+	int32 FirstVisibleIndex = 0;
+
+	/** Entries on the displayed board at the last populate */
+	UPROPERTY(BlueprintReadOnly, Category="State")
+	int32 DisplayedEntryCount = 0;
+
+	/** One index-only item per board row for EntryList; kept across opens and only grown or trimmed */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<ULeaderboardRowItem>> RowItems;
+
 	//=============================================================================
 	// PUBLIC FUNCTIONS
 	//=============================================================================
@@ -307,11 +349,34 @@ public:
 	 * Set the rank to highlight (current run's placement).
 	 * Call this before showing the widget if you want to highlight the player's entry.
 	 * 
-	 * @param Rank Rank to highlight (1-10), or 0 for no highlight
+	 * The window scrolls so the rank is visible.
+	 * 
+	 * @param Rank All-time rank to highlight, or 0 for no highlight
 	 */
 	UFUNCTION(BlueprintCallable, Category="Leaderboard")
 	void SetHighlightedRank(int32 Rank);
 
+	/** Switch between the all-time, daily and weekly boards (back to the top) */
+	UFUNCTION(BlueprintCallable, Category="Leaderboard")
+	void SetDisplayedPeriod(ELeaderboardPeriod Period);
+
+	/** Move the window by RowDelta rows (negative = towards rank 1), clamped to the board */
+	UFUNCTION(BlueprintCallable, Category="Leaderboard")
+	void ScrollRows(int32 RowDelta);
+
+	/** Move the window a full page up (-1) or down (+1) */
+	UFUNCTION(BlueprintCallable, Category="Leaderboard")
+	void ScrollPages(int32 PageDelta);
+
+	/**
+	 * Row data for a board index on the displayed board (used by the list's row widgets).
+	 * 
+	 * @param OutColor Medal/highlight color, or EmptyColor for an empty slot
+	 * @param bOutOverrideColor False when the row should keep its Blueprint default color
+	 * @return True if the board has an entry at Index
+	 */
+	bool GetRowDisplay(int32 Index, FLeaderboardEntry& OutEntry, FLinearColor& OutColor, bool& bOutOverrideColor);
+
 	/**
 	 * Go back to the Game Over screen.
 	 */
@@ -348,6 +413,10 @@ public:
 	UFUNCTION(BlueprintImplementableEvent, Category="Events")
 	void OnBeforeQuitToMenu();
 
+	/** Called after the rows are refreshed (e.g. to show "TODAY  11-20 OF 734") */
+	UFUNCTION(BlueprintImplementableEvent, Category="Events")
+	void OnLeaderboardWindowChanged(ELeaderboardPeriod Period, int32 FirstRank, int32 TotalEntries);
+
 protected:
 
 	//=============================================================================
@@ -370,6 +439,21 @@ protected:
 	/** Cache component references */
 	void CacheComponentReferences();
 
+	/** The shared leaderboard store (score system during gameplay, save subsystem in menus) */
+	const ULeaderboardSaveGame* GetLeaderboardStore();
+
+	/** Largest FirstVisibleIndex that still fills the window */
+	int32 GetMaxFirstVisibleIndex() const;
+
+	/** Medal or highlight color for an absolute rank; false if the rank uses the default color */
+	bool GetRankColor(int32 Rank, FLinearColor& OutColor) const;
+
+	/** Size RowItems to the board and hand them to EntryList */
+	void SyncRowItems();
+
+	/** Rebind the row widgets currently on screen */
+	void RefreshVisibleRows();
+
 	/** Set entry text for a specific row with color override */
 	void SetEntryText(int32 Index, const FString& Rank, const FString& Name, const FString& Score, const FString& Time, const FString& Date, const FLinearColor& Color);
 
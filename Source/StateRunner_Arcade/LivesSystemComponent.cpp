@@ -4,6 +4,8 @@
 #include "GameDebugSubsystem.h"
 #include "StateRunner_ArcadeGameMode.h"
 #include "StateRunner_ArcadeCharacter.h"
+#include "VersusModeComponent.h"
+#include "SFXSubsystem.h"
 #include "GameFramework/PlayerController.h"
 #include "Kismet/GameplayStatics.h"
 #include "Sound/SoundBase.h"
@@ -26,6 +28,16 @@ void ULivesSystemComponent::BeginPlay()
 	CacheWorldScrollComponent();
 }
 
+void ULivesSystemComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UGameplaySimulationSubsystem* Timeline = UGameplaySimulationSubsystem::Get(this))
+	{
+		Timeline->ClearAllTimers(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 //=============================================================================
 // PUBLIC FUNCTIONS
 //=============================================================================
@@ -45,7 +57,7 @@ bool ULivesSystemComponent::TakeDamage()
 	if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
 	{
 		Debug->Stat_Lives = CurrentLives;
-		Debug->LogEvent(EDebugCategory::Lives, FString::Printf(TEXT("Damage! Lives: %d"), CurrentLives));
+		Debug->RecordEvent(EDebugCategory::Lives, EDebugEventId::LifeLost, CurrentLives);
 	}
 
 	// Broadcast events
@@ -75,9 +87,9 @@ bool ULivesSystemComponent::TakeDamage()
 void ULivesSystemComponent::ResetLives()
 {
 	// Clear any existing invulnerability
-	if (UWorld* World = GetWorld())
+	if (UGameplaySimulationSubsystem* Timeline = UGameplaySimulationSubsystem::Get(this))
 	{
-		World->GetTimerManager().ClearTimer(InvulnerabilityTimer);
+		Timeline->ClearTimer(InvulnerabilityTimer);
 	}
 
 	CurrentLives = MaxLives;
@@ -111,7 +123,7 @@ void ULivesSystemComponent::AddLives(int32 Amount)
 		if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
 		{
 			Debug->Stat_Lives = CurrentLives;
-			Debug->LogEvent(EDebugCategory::Lives, FString::Printf(TEXT("+%d Life (%d/%d)"), Amount, CurrentLives, MaxLives));
+			Debug->RecordEvent(EDebugCategory::Lives, EDebugEventId::LifeGained, Amount, CurrentLives, MaxLives);
 		}
 	}
 }
@@ -129,7 +141,7 @@ bool ULivesSystemComponent::Collect1Up()
 		// At max lives - return true to indicate score bonus should be awarded
 		if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
 		{
-			Debug->LogEvent(EDebugCategory::Lives, TEXT("1-UP -> Score Bonus (Full Health)"));
+			Debug->RecordEvent(EDebugCategory::Lives, EDebugEventId::OneUpAtFullHealth);
 		}
 		return true;
 	}
@@ -148,9 +160,9 @@ bool ULivesSystemComponent::Collect1Up()
 void ULivesSystemComponent::SetInvulnerable(bool bInvulnerable, float Duration)
 {
 	// Clear existing timer
-	if (UWorld* World = GetWorld())
+	if (UGameplaySimulationSubsystem* Timeline = UGameplaySimulationSubsystem::Get(this))
 	{
-		World->GetTimerManager().ClearTimer(InvulnerabilityTimer);
+		Timeline->ClearTimer(InvulnerabilityTimer);
 	}
 
 	bIsInvulnerable = bInvulnerable;
@@ -161,15 +173,9 @@ void ULivesSystemComponent::SetInvulnerable(bool bInvulnerable, float Duration)
 		// Use default duration if 0
 		float ActualDuration = (Duration > 0.0f) ? Duration : InvulnerabilityDuration;
 		
-		if (UWorld* World = GetWorld())
+		if (UGameplaySimulationSubsystem* Timeline = UGameplaySimulationSubsystem::Get(this))
 		{
-			World->GetTimerManager().SetTimer(
-				InvulnerabilityTimer,
-				this,
-				&ULivesSystemComponent::EndInvulnerability,
-				ActualDuration,
-				false
-			);
+			Timeline->SetTimer(InvulnerabilityTimer, this, [this]() { EndInvulnerability(); }, ActualDuration);
 		}
 	}
 
@@ -184,8 +190,9 @@ void ULivesSystemComponent::ApplyDamageEffects()
 	// Screen shake
 	ApplyScreenShake();
 
-	// Scroll slowdown
-	if (bApplyScrollSlowdown && WorldScrollComponent)
+	// Scroll slowdown (not in versus -- the scroll is shared, one player's hit would slow the other)
+	const UVersusModeComponent* Versus = UVersusModeComponent::Get(this);
+	if (bApplyScrollSlowdown && WorldScrollComponent && !(Versus && Versus->IsVersusActive()))
 	{
 		WorldScrollComponent->ApplyDamageSlowdown();
 	}
@@ -208,15 +215,16 @@ void ULivesSystemComponent::TriggerDeath()
 	bIsInvulnerable = false;
 
 	// Clear invulnerability timer
-	if (UWorld* World = GetWorld())
+	if (UGameplaySimulationSubsystem* Timeline = UGameplaySimulationSubsystem::Get(this))
 	{
-		World->GetTimerManager().ClearTimer(InvulnerabilityTimer);
+		Timeline->ClearTimer(InvulnerabilityTimer);
 	}
 
 	// Log death event
 	if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
 	{
-		Debug->LogEvent(EDebugCategory::Lives, TEXT("GAME OVER"));
+		Debug->RecordEvent(EDebugCategory::Lives, EDebugEventId::GameOver);
+		Debug->EndPerfRun();
 	}
 
 	// Play death sound using SpawnSound2D with "tick while paused" so it plays through the pause
@@ -240,22 +248,26 @@ void ULivesSystemComponent::TriggerDeath()
 		}
 	}
 
-	// Stop scrolling and scoring, then save high score
-	if (UWorld* World = GetWorld())
+	// Stop this player's scoring and save high score
+	if (UScoreSystemComponent* ScoreComp = UVersusModeComponent::FindPlayerSystems(this).ScoreSystem)
 	{
-		if (AStateRunner_ArcadeGameMode* GameMode = Cast<AStateRunner_ArcadeGameMode>(World->GetAuthGameMode()))
-		{
-			if (UWorldScrollComponent* ScrollComp = GameMode->GetWorldScrollComponent())
-			{
-				ScrollComp->SetScrollingEnabled(false);
-			}
-
-			if (UScoreSystemComponent* ScoreComp = GameMode->GetScoreSystemComponent())
-			{
-				ScoreComp->StopScoring();
-				ScoreComp->CheckAndSaveHighScore();
-			}
-		}
+		ScoreComp->StopScoring();
+		ScoreComp->CheckAndSaveHighScore();
+	}
+
+	// Versus: the runner is out, but the track keeps going until the last one is (the match
+	// end stops scrolling and broadcasts every player's OnPlayerDied)
+	UVersusModeComponent* Versus = UVersusModeComponent::Get(this);
+	if (Versus && Versus->IsVersusActive())
+	{
+		Versus->HandlePlayerKnockedOut(this);
+		return;
+	}
+
+	// Stop scrolling
+	if (WorldScrollComponent)
+	{
+		WorldScrollComponent->SetScrollingEnabled(false);
 	}
 
 	// Broadcast death event (for UI, etc.)
@@ -281,16 +293,10 @@ void ULivesSystemComponent::ApplyScreenShake()
 		return;
 	}
 
-	// Get player character and call its camera shake function
-	if (UWorld* World = GetWorld())
+	// Get this player's character and call its camera shake function
+	if (AStateRunner_ArcadeCharacter* Character = UVersusModeComponent::FindPlayerSystems(this).Runner)
 	{
-		if (APlayerController* PC = World->GetFirstPlayerController())
-		{
-			if (AStateRunner_ArcadeCharacter* Character = Cast<AStateRunner_ArcadeCharacter>(PC->GetPawn()))
-			{
-				Character->PlayDamageCameraShake(DamageShakeIntensity);
-			}
-		}
+		Character->PlayDamageCameraShake(DamageShakeIntensity);
 	}
 }
 
@@ -304,16 +310,10 @@ void ULivesSystemComponent::PlayLifeSound(USoundBase* Sound)
 	// Try to get player location for 3D sound, fallback to 2D if not available
 	FVector SoundLocation = FVector::ZeroVector;
 	
-	if (UWorld* World = GetWorld())
+	if (const AStateRunner_ArcadeCharacter* Character = UVersusModeComponent::FindPlayerSystems(this).Runner)
 	{
-		if (APlayerController* PC = World->GetFirstPlayerController())
-		{
-			if (APawn* Pawn = PC->GetPawn())
-			{
-				SoundLocation = Pawn->GetActorLocation();
-			}
-		}
+		SoundLocation = Character->GetActorLocation();
 	}
 
-	UGameplayStatics::PlaySoundAtLocation(this, Sound, SoundLocation, LivesSoundVolume);
+	USFXSubsystem::PlaySFXAtLocation(this, ESFXCategory::Lives, Sound, SoundLocation, LivesSoundVolume);
 }
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "GameplaySimulationSubsystem.h"
 #include "LivesSystemComponent.generated.h"
 
 class UWorldScrollComponent;
@@ -37,7 +38,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnInvulnerabilityChanged, bool, bIs
  * - Lose 1 life on obstacle collision
  * - Invulnerability period after damage (prevents chain deaths)
  * - Screen shake on damage
- * - Scroll slowdown on damage (via WorldScrollComponent)
+ * - Scroll slowdown on damage (via WorldScrollComponent; not in versus, where the scroll is shared)
  */
 UCLASS(ClassGroup=(StateRunner), meta=(BlueprintSpawnableComponent))
 class STATERUNNER_ARCADE_API ULivesSystemComponent : public UActorComponent
@@ -51,6 +52,7 @@ public:
 protected:
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	//=============================================================================
 	// LIVES CONFIGURATION
@@ -140,9 +142,9 @@ protected:
 	bool bIsDead = false;
 
 	/**
-	 * Timer handle for invulnerability.
+	 * Gameplay timeline timer for invulnerability.
 	 */
-	FTimerHandle InvulnerabilityTimer;
+	FGameplayTimerHandle InvulnerabilityTimer;
 
 	/**
 	 * Cached reference to WorldScrollComponent.
@@ -7,6 +7,7 @@
 #include "LeaderboardWidget.h"
 #include "ThemeSelectorWidget.h"
 #include "ThemeSubsystem.h"
+#include "StateRunner_ArcadePlayerController.h"
 #include "StateRunner_Arcade.h"
 
 UMainMenuWidget::UMainMenuWidget(const FObjectInitializer& ObjectInitializer)
@@ -127,6 +128,8 @@ void UMainMenuWidget::NativeConstruct()
 	// Call parent (this sets initial focus)
 	Super::NativeConstruct();
 
+	RestartAttractModeTimer();
+
 	UE_LOG(LogStateRunner_Arcade, Log, TEXT("MainMenuWidget: Constructed with %d focusable items"), GetFocusableItemCount());
 }
 
@@ -206,6 +209,7 @@ void UMainMenuWidget::NativeDestruct()
 	if (UWorld* World = GetWorld())
 	{
 		World->GetTimerManager().ClearTimer(ThemeNotificationTimerHandle);
+		World->GetTimerManager().ClearTimer(AttractModeTimerHandle);
 	}
 
 	Super::NativeDestruct();
@@ -219,6 +223,8 @@ FReply UMainMenuWidget::NativeOnKeyDown(const FGeometry& InGeometry, const FKeyE
 {
 	const FKey Key = InKeyEvent.GetKey();
 
+	RestartAttractModeTimer();
+
 	// Check if this is a navigation key that should activate keyboard navigation mode
 	bool bIsNavigationKey = (Key == EKeys::Up || Key == EKeys::Gamepad_DPad_Up ||
 							 Key == EKeys::Down || Key == EKeys::Gamepad_DPad_Down ||
@@ -702,12 +708,12 @@ void UMainMenuWidget::OpenSettings()
 		return;
 	}
 
-	SettingsWidget = CreateWidget<UArcadeMenuWidget>(GetOwningPlayer(), SettingsWidgetClass);
+	SettingsWidget = AStateRunner_ArcadePlayerController::GetOrCreateWidget<UArcadeMenuWidget>(GetOwningPlayer(), SettingsWidgetClass);
 	if (SettingsWidget)
 	{
 		SettingsWidget->AddToViewport(10);
 		SettingsWidget->TakeKeyboardFocus();
-		SettingsWidget->OnBackPressed.AddDynamic(this, &UMainMenuWidget::CloseSettings);
+		SettingsWidget->OnBackPressed.AddUniqueDynamic(this, &UMainMenuWidget::CloseSettings);
 		SetVisibility(ESlateVisibility::Collapsed);
 	}
 }
@@ -743,12 +749,12 @@ void UMainMenuWidget::OpenControls()
 		return;
 	}
 
-	ControlsWidget = CreateWidget<UArcadeMenuWidget>(GetOwningPlayer(), ControlsWidgetClass);
+	ControlsWidget = AStateRunner_ArcadePlayerController::GetOrCreateWidget<UArcadeMenuWidget>(GetOwningPlayer(), ControlsWidgetClass);
 	if (ControlsWidget)
 	{
 		ControlsWidget->AddToViewport(10);
 		ControlsWidget->TakeKeyboardFocus();
-		ControlsWidget->OnBackPressed.AddDynamic(this, &UMainMenuWidget::CloseControls);
+		ControlsWidget->OnBackPressed.AddUniqueDynamic(this, &UMainMenuWidget::CloseControls);
 		SetVisibility(ESlateVisibility::Collapsed);
 	}
 }
@@ -777,12 +783,12 @@ void UMainMenuWidget::OpenCredits()
 		return;
 	}
 
-	CreditsWidget = CreateWidget<UArcadeMenuWidget>(GetOwningPlayer(), CreditsWidgetClass);
+	CreditsWidget = AStateRunner_ArcadePlayerController::GetOrCreateWidget<UArcadeMenuWidget>(GetOwningPlayer(), CreditsWidgetClass);
 	if (CreditsWidget)
 	{
 		CreditsWidget->AddToViewport(10);
 		CreditsWidget->TakeKeyboardFocus();
-		CreditsWidget->OnBackPressed.AddDynamic(this, &UMainMenuWidget::CloseCredits);
+		CreditsWidget->OnBackPressed.AddUniqueDynamic(this, &UMainMenuWidget::CloseCredits);
 		SetVisibility(ESlateVisibility::Collapsed);
 	}
 }
@@ -811,13 +817,13 @@ void UMainMenuWidget::OpenLeaderboard()
 		return;
 	}
 
-	LeaderboardWidget = CreateWidget<ULeaderboardWidget>(GetOwningPlayer(), LeaderboardWidgetClass);
+	LeaderboardWidget = AStateRunner_ArcadePlayerController::GetOrCreateWidget<ULeaderboardWidget>(GetOwningPlayer(), LeaderboardWidgetClass);
 	if (LeaderboardWidget)
 	{
 		LeaderboardWidget->bViewOnlyMode = true;
 		LeaderboardWidget->AddToViewport(10);
 		LeaderboardWidget->TakeKeyboardFocus();
-		LeaderboardWidget->OnBackPressed.AddDynamic(this, &UMainMenuWidget::CloseLeaderboard);
+		LeaderboardWidget->OnBackPressed.AddUniqueDynamic(this, &UMainMenuWidget::CloseLeaderboard);
 		SetVisibility(ESlateVisibility::Collapsed);
 	}
 }
@@ -847,13 +853,13 @@ void UMainMenuWidget::OpenThemeSelector()
 		return;
 	}
 
-	ThemeSelectorWidget = CreateWidget<UThemeSelectorWidget>(GetOwningPlayer(), ThemeSelectorWidgetClass);
+	ThemeSelectorWidget = AStateRunner_ArcadePlayerController::GetOrCreateWidget<UThemeSelectorWidget>(GetOwningPlayer(), ThemeSelectorWidgetClass);
 	if (ThemeSelectorWidget)
 	{
 		ThemeSelectorWidget->AddToViewport(10);
 		ThemeSelectorWidget->TakeKeyboardFocus();
-		ThemeSelectorWidget->OnBackPressed.AddDynamic(this, &UMainMenuWidget::CloseThemeSelector);
-		ThemeSelectorWidget->OnThemeApplied.AddDynamic(this, &UMainMenuWidget::ShowThemeNotification);
+		ThemeSelectorWidget->OnBackPressed.AddUniqueDynamic(this, &UMainMenuWidget::CloseThemeSelector);
+		ThemeSelectorWidget->OnThemeApplied.AddUniqueDynamic(this, &UMainMenuWidget::ShowThemeNotification);
 		SetVisibility(ESlateVisibility::Collapsed);
 	}
 }
@@ -926,6 +932,42 @@ void UMainMenuWidget::HideThemeNotification()
 	}
 }
 
+//=============================================================================
+// ATTRACT MODE
+//=============================================================================
+
+void UMainMenuWidget::RestartAttractModeTimer()
+{
+	UWorld* World = GetWorld();
+	if (!World || AttractModeIdleSeconds <= 0.0f || GameplayLevelName.IsNone())
+	{
+		return;
+	}
+
+	World->GetTimerManager().SetTimer(
+		AttractModeTimerHandle,
+		this,
+		&UMainMenuWidget::StartAttractMode,
+		AttractModeIdleSeconds,
+		false
+	);
+}
+
+void UMainMenuWidget::StartAttractMode()
+{
+	// A popup (settings, leaderboard, ...) has the keys -- its presses don't reach us, so wait another round
+	if (!HasAnyUserFocus() && !HasFocusedDescendants())
+	{
+		RestartAttractModeTimer();
+		return;
+	}
+
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("MainMenuWidget: Idle for %.0f s - starting attract mode"), AttractModeIdleSeconds);
+
+	RemoveFromParent();
+	UGameplayStatics::OpenLevel(this, GameplayLevelName, true, TEXT("Autopilot=Attract"));
+}
+
 //=============================================================================
 // OVERRIDES
 //=============================================================================
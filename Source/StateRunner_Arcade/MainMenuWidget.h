@@ -180,6 +180,21 @@ protected:
 	/** Hide the theme notification */
 	void HideThemeNotification();
 
+	//=============================================================================
+	// ATTRACT MODE
+	//=============================================================================
+
+protected:
+
+	/** Fires after AttractModeIdleSeconds without a key press */
+	FTimerHandle AttractModeTimerHandle;
+
+	/** (Re)start the idle countdown */
+	void RestartAttractModeTimer();
+
+	/** Idle long enough -- open the gameplay level with the autopilot playing */
+	void StartAttractMode();
+
 	//=============================================================================
 	// MUSIC PLAYER (embedded widget)
 	//=============================================================================
@@ -282,6 +297,13 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Configuration")
 	FName GameplayLevelName = TEXT("SR_OfficialTrack");
 
+	/**
+	 * Seconds without input before the gameplay level opens in attract mode (autopilot demo).
+	 * 0 disables attract mode.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Configuration", meta=(ClampMin="0.0"))
+	float AttractModeIdleSeconds = 0.0f;
+
 	/**
 	 * Settings widget class to spawn when Settings is pressed.
 	 * Set in Blueprint to the WBP_Settings class.
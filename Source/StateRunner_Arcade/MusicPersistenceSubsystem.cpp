@@ -6,9 +6,11 @@
 #include "Engine/World.h"
 #include "Engine/GameInstance.h"
 #include "Engine/Engine.h"
-#include "Engine/StreamableManager.h"
 #include "TimerManager.h"
 #include "StateRunner_Arcade.h"
+#include "ArcadeSaveSubsystem.h"
+#include "AssetPreloadSubsystem.h"
+#include "RunSeedSubsystem.h"
 #include "Misc/FileHelper.h"
 #include "HAL/PlatformFileManager.h"
 
@@ -34,20 +36,6 @@ static void WriteMusicDebugLog(const FString& Message)
 #endif
 }
 
-// --- Default Track Paths ---
-// Using FSoftObjectPath for proper shipping build support
-
-static const FSoftObjectPath DefaultTrackPaths[] = {
-	FSoftObjectPath(TEXT("/Game/_DEVELOPER/Audio/Music/Rush.Rush")),                 // Index 0
-	FSoftObjectPath(TEXT("/Game/_DEVELOPER/Audio/Music/ByteChaser.ByteChaser")),     // Index 1
-	FSoftObjectPath(TEXT("/Game/_DEVELOPER/Audio/Music/Circuit.Circuit")),           // Index 2
-	FSoftObjectPath(TEXT("/Game/_DEVELOPER/Audio/Music/StateRunner.StateRunner")),   // Index 3
-	FSoftObjectPath(TEXT("/Game/_DEVELOPER/Audio/Music/Velocity.Velocity")),         // Index 4
-};
-
-// Sound Class path for music routing
-static const FSoftObjectPath Music_SoundClassPath(TEXT("/Game/_DEVELOPER/Audio/SoundClasses/SClass_Music.SClass_Music"));
-
 // --- Lifecycle ---
 
 void UMusicPersistenceSubsystem::Initialize(FSubsystemCollectionBase& Collection)
@@ -56,19 +44,33 @@ void UMusicPersistenceSubsystem::Initialize(FSubsystemCollectionBase& Collection
 
 	UE_LOG(LogStateRunner_Arcade, Log, TEXT("MusicPersistenceSubsystem: Initializing..."));
 
-	// Load Music Sound Class for volume routing using synchronous load
-	if (Music_SoundClassPath.IsValid())
-	{
-		MusicSoundClass = Cast<USoundClass>(Music_SoundClassPath.TryLoad());
-	}
-	
-	if (!MusicSoundClass)
+	// Shuffle draws from the run seed's music stream
+	Collection.InitializeDependency<URunSeedSubsystem>();
+
+	// Restore the saved shuffle preference
+	if (const UArcadeSaveSubsystem* Saves = Collection.InitializeDependency<UArcadeSaveSubsystem>())
 	{
-		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("MusicPersistenceSubsystem: Failed to load MusicSoundClass from %s"), *Music_SoundClassPath.ToString());
+		bShuffleEnabled = Saves->IsShuffleEnabled();
 	}
-	else
+
+	// Music Sound Class for volume routing, streamed in by the boot preload
+	if (UAssetPreloadSubsystem* Preload = Collection.InitializeDependency<UAssetPreloadSubsystem>())
 	{
-		UE_LOG(LogStateRunner_Arcade, Log, TEXT("MusicPersistenceSubsystem: Loaded MusicSoundClass: %s"), *MusicSoundClass->GetName());
+		TWeakObjectPtr<UMusicPersistenceSubsystem> WeakThis(this);
+		TWeakObjectPtr<UAssetPreloadSubsystem> WeakPreload(Preload);
+		Preload->WhenPreloaded([WeakThis, WeakPreload]()
+		{
+			if (!WeakThis.IsValid() || !WeakPreload.IsValid())
+			{
+				return;
+			}
+
+			WeakThis->MusicSoundClass = WeakPreload->Get<USoundClass>(EPreloadAsset::MusicSoundClass);
+			if (WeakThis->MusicSoundClass)
+			{
+				UE_LOG(LogStateRunner_Arcade, Log, TEXT("MusicPersistenceSubsystem: Got MusicSoundClass: %s"), *WeakThis->MusicSoundClass->GetName());
+			}
+		});
 	}
 
 	// NOTE: We no longer auto-load tracks here. Tracks are provided by Blueprint via SetMusicTracks().
@@ -80,16 +82,16 @@ void UMusicPersistenceSubsystem::Initialize(FSubsystemCollectionBase& Collection
 
 void UMusicPersistenceSubsystem::Deinitialize()
 {
-	// Stop the playback monitor
-	StopPlaybackMonitor();
-
 	// Stop and clean up audio
-	if (MusicAudioComponent)
+	StopPlayback();
+	for (TObjectPtr<UAudioComponent>& Deck : Decks)
 	{
-		MusicAudioComponent->OnAudioFinished.RemoveAll(this);
-		MusicAudioComponent->Stop();
-		MusicAudioComponent->DestroyComponent();
-		MusicAudioComponent = nullptr;
+		if (Deck && Deck->IsValidLowLevel())
+		{
+			Deck->OnAudioFinishedNative.RemoveAll(this);
+			Deck->DestroyComponent();
+		}
+		Deck = nullptr;
 	}
 
 	Super::Deinitialize();
@@ -103,33 +105,13 @@ void UMusicPersistenceSubsystem::LoadDefaultTracks()
 {
 	MusicTracks.Empty();
 
-	const int32 NumTracks = UE_ARRAY_COUNT(DefaultTrackPaths);
-	
-	for (int32 i = 0; i < NumTracks; i++)
+	// Already resident -- the default tracks are part of the boot preload manifest
+	if (const UAssetPreloadSubsystem* Preload = GetGameInstance()->GetSubsystem<UAssetPreloadSubsystem>())
 	{
-		const FSoftObjectPath& Path = DefaultTrackPaths[i];
-		
-		if (!Path.IsValid())
-		{
-			UE_LOG(LogStateRunner_Arcade, Warning, TEXT("MusicPersistenceSubsystem: Invalid path at index %d"), i);
-			continue;
-		}
-		
-		// Use TryLoad for synchronous loading - works in shipping builds
-		USoundBase* Sound = Cast<USoundBase>(Path.TryLoad());
-		
-		if (Sound)
-		{
-			MusicTracks.Add(Sound);
-			UE_LOG(LogStateRunner_Arcade, Log, TEXT("MusicPersistenceSubsystem: Loaded track %d: %s"), i, *Sound->GetName());
-		}
-		else
-		{
-			UE_LOG(LogStateRunner_Arcade, Error, TEXT("MusicPersistenceSubsystem: FAILED to load track %d from path: %s"), i, *Path.ToString());
-		}
+		MusicTracks = Preload->GetDefaultMusicTracks();
 	}
 
-	UE_LOG(LogStateRunner_Arcade, Log, TEXT("MusicPersistenceSubsystem: Loaded %d/%d tracks"), MusicTracks.Num(), NumTracks);
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("MusicPersistenceSubsystem: Loaded %d default tracks"), MusicTracks.Num());
 	
 	// Extra diagnostic for shipping builds
 	if (MusicTracks.Num() == 0)
@@ -143,23 +125,13 @@ void UMusicPersistenceSubsystem::SetMusicTracks(const TArray<USoundBase*>& InTra
 	UE_LOG(LogStateRunner_Arcade, Warning, TEXT("MusicPersistenceSubsystem: SetMusicTracks called with %d tracks"), InTracks.Num());
 	WriteMusicDebugLog(FString::Printf(TEXT("SetMusicTracks called with %d tracks"), InTracks.Num()));
 	
-	// Stop current playback and monitor while we swap tracks
-	StopPlaybackMonitor();
-	if (MusicAudioComponent && MusicAudioComponent->IsValidLowLevel())
-	{
-		MusicAudioComponent->OnAudioFinished.RemoveAll(this);
-		MusicAudioComponent->Stop();
-		MusicAudioComponent->DestroyComponent();
-		MusicAudioComponent = nullptr;
-	}
-	
-	MusicTracks.Empty();
+	TArray<TObjectPtr<USoundBase>> NewTracks;
 	int32 NullCount = 0;
 	for (USoundBase* Track : InTracks)
 	{
 		if (Track)
 		{
-			MusicTracks.Add(Track);
+			NewTracks.Add(Track);
 			FString TrackInfo = FString::Printf(TEXT("Added track: %s (Class: %s)"), *Track->GetName(), *Track->GetClass()->GetName());
 			UE_LOG(LogStateRunner_Arcade, Warning, TEXT("MusicPersistenceSubsystem: %s"), *TrackInfo);
 			WriteMusicDebugLog(TrackInfo);
@@ -172,6 +144,17 @@ void UMusicPersistenceSubsystem::SetMusicTracks(const TArray<USoundBase*>& InTra
 		}
 	}
 
+	// The decks survive level loads, so a level setting the same playlist again just keeps playing
+	if (NewTracks == MusicTracks && IsPlaying())
+	{
+		UE_LOG(LogStateRunner_Arcade, Log, TEXT("MusicPersistenceSubsystem: Same tracks already playing, continuing track %d"), CurrentTrackIndex);
+		return;
+	}
+
+	// Stop current playback while we swap tracks
+	StopPlayback();
+	MusicTracks = MoveTemp(NewTracks);
+
 	FString Summary = FString::Printf(TEXT("Set %d music tracks from Blueprint (%d were null)"), MusicTracks.Num(), NullCount);
 	UE_LOG(LogStateRunner_Arcade, Warning, TEXT("MusicPersistenceSubsystem: %s"), *Summary);
 	WriteMusicDebugLog(Summary);
@@ -181,7 +164,6 @@ void UMusicPersistenceSubsystem::SetMusicTracks(const TArray<USoundBase*>& InTra
 	if (MusicTracks.Num() > 0)
 	{
 		bMusicHasStarted = false; // Reset so PlayCurrentTrack works correctly
-		bTransitioningTracks = false;
 		CurrentTrackIndex = 0; // Start from first track
 		
 		// Small delay to ensure audio system is ready
@@ -211,209 +193,297 @@ void UMusicPersistenceSubsystem::SetMusicTracks(const TArray<USoundBase*>& InTra
 	}
 }
 
-// --- Audio Component Management ---
+// --- Deck Management ---
 
-void UMusicPersistenceSubsystem::EnsureAudioComponent()
+UAudioComponent* UMusicPersistenceSubsystem::EnsureDeck(int32 DeckIndex, USoundBase* Sound)
 {
-	// If we already have a valid, playing audio component, keep it
-	if (MusicAudioComponent && MusicAudioComponent->IsValidLowLevel())
+	STATERUNNER_LLM_SCOPE(Music);
+
+	if (!Sound)
 	{
-		return;
+		return nullptr;
 	}
 
-	UE_LOG(LogStateRunner_Arcade, Log, TEXT("MusicPersistenceSubsystem: Creating new audio component"));
+	TObjectPtr<UAudioComponent>& Deck = Decks[DeckIndex];
+	if (Deck && Deck->IsValidLowLevel())
+	{
+		Deck->SetSound(Sound);
+		return Deck;
+	}
 
 	// Get a world context - try multiple sources
 	UWorld* World = nullptr;
-	
 	if (UGameInstance* GI = GetGameInstance())
 	{
 		World = GI->GetWorld();
 	}
-	
 	if (!World)
 	{
-		// Try to get any valid world
 		World = GEngine->GetCurrentPlayWorld();
 	}
 
 	if (!World)
 	{
 		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("MusicPersistenceSubsystem: No valid world for audio component"));
-		return;
+		return nullptr;
 	}
 
-	// Create audio component using CreateSound2D for reliability
-	if (MusicTracks.IsValidIndex(CurrentTrackIndex) && MusicTracks[CurrentTrackIndex])
+	// Created once per session: persists across level transitions, we manage its lifecycle
+	constexpr bool bPersistAcrossLevelTransition = true;
+	constexpr bool bAutoDestroy = false;
+	Deck = UGameplayStatics::CreateSound2D(World, Sound, 1.0f, 1.0f, 0.0f, nullptr, bPersistAcrossLevelTransition, bAutoDestroy);
+	if (!Deck)
 	{
-		MusicAudioComponent = UGameplayStatics::CreateSound2D(World, MusicTracks[CurrentTrackIndex], 1.0f, 1.0f, 0.0f, nullptr, false, false);
-		
-		if (MusicAudioComponent)
+		UE_LOG(LogStateRunner_Arcade, Error, TEXT("MusicPersistenceSubsystem: Failed to create audio deck %d"), DeckIndex);
+		WriteMusicDebugLog(FString::Printf(TEXT("ERROR: Failed to create audio deck %d"), DeckIndex));
+		return nullptr;
+	}
+
+	// Set the Sound Class override to ensure proper volume routing
+	// (music started before the preload finished resolves the class here)
+	if (!MusicSoundClass)
+	{
+		if (UAssetPreloadSubsystem* Preload = GetGameInstance()->GetSubsystem<UAssetPreloadSubsystem>())
 		{
-			MusicAudioComponent->bIsUISound = true;
-			MusicAudioComponent->bAutoDestroy = false;
-			
-			// Bind completion event
-			MusicAudioComponent->OnAudioFinished.AddDynamic(this, &UMusicPersistenceSubsystem::OnAudioFinished);
-			
-			UE_LOG(LogStateRunner_Arcade, Log, TEXT("MusicPersistenceSubsystem: Audio component created successfully"));
+			MusicSoundClass = Preload->Get<USoundClass>(EPreloadAsset::MusicSoundClass);
 		}
 	}
+	if (MusicSoundClass)
+	{
+		Deck->SoundClassOverride = MusicSoundClass;
+	}
+
+	// CRITICAL: Mark as UI sound so music plays even when game is paused
+	Deck->bIsUISound = true;
+
+	Deck->OnAudioFinishedNative.AddUObject(this, &UMusicPersistenceSubsystem::HandleDeckFinished);
+
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("MusicPersistenceSubsystem: Audio deck %d created"), DeckIndex);
+	return Deck;
 }
 
-// --- Playback Control ---
+void UMusicPersistenceSubsystem::StartTrackOnDeck(int32 DeckIndex, int32 TrackIndex, float FadeInSeconds)
+{
+	USoundBase* Track = MusicTracks.IsValidIndex(TrackIndex) ? MusicTracks[TrackIndex].Get() : nullptr;
+	UAudioComponent* Deck = EnsureDeck(DeckIndex, Track);
+	if (!Deck)
+	{
+		UE_LOG(LogStateRunner_Arcade, Error, TEXT("MusicPersistenceSubsystem: Failed to start track %d"), TrackIndex);
+		return;
+	}
 
-void UMusicPersistenceSubsystem::PlayCurrentTrack()
+	ActiveDeck = DeckIndex;
+	CurrentTrackIndex = TrackIndex;
+	bPlaybackActive = true;
+
+	// Deck is active before it starts, so a synchronous failure is handled as the current track's
+	if (FadeInSeconds > 0.0f)
+	{
+		Deck->FadeIn(FadeInSeconds, 1.0f);
+	}
+	else
+	{
+		Deck->Play();
+	}
+
+	bMusicHasStarted = true;
+	
+	// Record start time to detect false OnAudioFinished triggers
+	CurrentTrackStartTime = FPlatformTime::Seconds();
+
+	FString TrackName = GetCurrentTrackName();
+	FString PlayStatus = FString::Printf(TEXT("Now playing track %d: %s on deck %d (IsPlaying=%s)"),
+		CurrentTrackIndex, *TrackName, DeckIndex, Deck->IsPlaying() ? TEXT("YES") : TEXT("NO"));
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("MusicPersistenceSubsystem: %s"), *PlayStatus);
+	WriteMusicDebugLog(PlayStatus);
+
+	PrepareNextTrack();
+
+	// Broadcast track change
+	OnTrackChanged.Broadcast(TrackName);
+}
+
+void UMusicPersistenceSubsystem::CrossfadeToNextTrack(float FadeSeconds)
 {
-	if (!MusicTracks.IsValidIndex(CurrentTrackIndex))
+	if (MusicTracks.Num() == 0)
 	{
-		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("MusicPersistenceSubsystem: Invalid track index %d"), CurrentTrackIndex);
 		return;
 	}
 
-	USoundBase* TrackToPlay = MusicTracks[CurrentTrackIndex];
-	if (!TrackToPlay)
+	const int32 TrackIndex = MusicTracks.IsValidIndex(NextTrackIndex) ? NextTrackIndex : GetNextTrackIndex();
+	const int32 OutgoingDeck = ActiveDeck;
+
+	// Hand over first, so the outgoing deck's completion event (end of its fade) is ignored
+	StartTrackOnDeck(1 - OutgoingDeck, TrackIndex, FadeSeconds);
+
+	if (ActiveDeck == OutgoingDeck)
 	{
-		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("MusicPersistenceSubsystem: Track at index %d is null"), CurrentTrackIndex);
+		// Incoming deck failed to start; leave the current track alone
 		return;
 	}
 
-	// Guard: Don't restart if we're already playing this exact track
-	if (MusicAudioComponent && MusicAudioComponent->IsValidLowLevel() && MusicAudioComponent->IsPlaying())
+	if (UAudioComponent* Outgoing = Decks[OutgoingDeck])
 	{
-		if (MusicAudioComponent->Sound == TrackToPlay)
+		if (Outgoing->IsPlaying() && FadeSeconds > 0.0f)
+		{
+			Outgoing->FadeOut(FadeSeconds, 0.0f);
+		}
+		else
 		{
-			UE_LOG(LogStateRunner_Arcade, Log, TEXT("MusicPersistenceSubsystem: Track %d already playing, skipping restart"), CurrentTrackIndex);
-			return;
+			Outgoing->Stop();
 		}
 	}
+}
+
+void UMusicPersistenceSubsystem::PrepareNextTrack()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(CrossfadeTickerHandle);
+	CrossfadeTickerHandle.Reset();
+
+	NextTrackIndex = GetNextTrackIndex();
 
-	// Stop and cleanup current audio component if any
-	if (MusicAudioComponent)
+	// Get the next track's first chunk streamed in now, so the crossfade starts without a gap
+	if (MusicTracks.IsValidIndex(NextTrackIndex) && MusicTracks[NextTrackIndex])
 	{
-		MusicAudioComponent->OnAudioFinished.RemoveAll(this);
-		MusicAudioComponent->Stop();
-		MusicAudioComponent->DestroyComponent();
-		MusicAudioComponent = nullptr;
+		UGameplayStatics::PrimeSound(MusicTracks[NextTrackIndex]);
 	}
 
-	// Get world for spawning
-	UWorld* World = nullptr;
-	if (UGameInstance* GI = GetGameInstance())
+	// Arm the crossfade. Music plays through pause (UI sound), so wall-clock time tracks it.
+	const USoundBase* Current = MusicTracks.IsValidIndex(CurrentTrackIndex) ? MusicTracks[CurrentTrackIndex].Get() : nullptr;
+	const float Duration = Current ? Current->GetDuration() : 0.0f;
+	if (Duration < INDEFINITELY_LOOPING_DURATION && Duration > CrossfadeSeconds * 2.0f)
 	{
-		World = GI->GetWorld();
+		CrossfadeTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &UMusicPersistenceSubsystem::HandleCrossfadeDue),
+			Duration - CrossfadeSeconds);
 	}
-	if (!World)
+	// Otherwise the active deck's completion event starts the next track
+}
+
+bool UMusicPersistenceSubsystem::HandleCrossfadeDue(float DeltaTime)
+{
+	CrossfadeTickerHandle.Reset();
+
+	if (IsPlaying())
 	{
-		World = GEngine->GetCurrentPlayWorld();
+		UE_LOG(LogStateRunner_Arcade, Log, TEXT("MusicPersistenceSubsystem: Track %d ending, crossfading to %d"), CurrentTrackIndex, NextTrackIndex);
+		CrossfadeToNextTrack(CrossfadeSeconds);
 	}
 
-	if (!World)
+	// One-shot
+	return false;
+}
+
+bool UMusicPersistenceSubsystem::HandleRetryDue(float DeltaTime)
+{
+	RetryTickerHandle.Reset();
+
+	if (!IsPlaying() && MusicTracks.Num() > 0)
 	{
-		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("MusicPersistenceSubsystem: No world available for PlayCurrentTrack"));
-		WriteMusicDebugLog(TEXT("ERROR: No world available for PlayCurrentTrack"));
-		return;
+		UE_LOG(LogStateRunner_Arcade, Log, TEXT("MusicPersistenceSubsystem: Retrying track %d"), CurrentTrackIndex);
+		StartTrackOnDeck(ActiveDeck, CurrentTrackIndex, 0.0f);
 	}
 
-	WriteMusicDebugLog(FString::Printf(TEXT("PlayCurrentTrack: Attempting to play track %d: %s"), CurrentTrackIndex, *TrackToPlay->GetName()));
+	return false;
+}
 
-	// Use CreateSound2D which creates without auto-playing, then configure and play manually
-	// This gives us full control and works more reliably across PIE and shipping
-	MusicAudioComponent = UGameplayStatics::CreateSound2D(World, TrackToPlay, 1.0f, 1.0f, 0.0f, nullptr, false, false);
-	
-	if (MusicAudioComponent)
+void UMusicPersistenceSubsystem::StopPlayback()
+{
+	// Set first: stopping the active deck raises its completion event
+	bPlaybackActive = false;
+
+	FTSTicker::GetCoreTicker().RemoveTicker(CrossfadeTickerHandle);
+	FTSTicker::GetCoreTicker().RemoveTicker(RetryTickerHandle);
+	CrossfadeTickerHandle.Reset();
+	RetryTickerHandle.Reset();
+
+	for (UAudioComponent* Deck : Decks)
 	{
-		WriteMusicDebugLog(TEXT("PlayCurrentTrack: Audio component created successfully"));
-		
-		// Set the Sound Class override to ensure proper volume routing
-		if (MusicSoundClass)
+		if (Deck && Deck->IsValidLowLevel())
 		{
-			MusicAudioComponent->SoundClassOverride = MusicSoundClass;
-			WriteMusicDebugLog(FString::Printf(TEXT("PlayCurrentTrack: Set SoundClass to %s"), *MusicSoundClass->GetName()));
+			Deck->Stop();
 		}
-		
-		// CRITICAL: Mark as UI sound so music plays even when game is paused
-		MusicAudioComponent->bIsUISound = true;
-		
-		// Don't auto-destroy - we manage lifecycle
-		MusicAudioComponent->bAutoDestroy = false;
-		
-		// Bind completion event for auto-advance
-		MusicAudioComponent->OnAudioFinished.AddDynamic(this, &UMusicPersistenceSubsystem::OnAudioFinished);
-		
-		// Actually start playing - CreateSound2D doesn't auto-play
-		MusicAudioComponent->Play();
+	}
+	NextTrackIndex = INDEX_NONE;
+}
 
-		bMusicHasStarted = true;
-		bTransitioningTracks = false;
-		
-		// Record start time to detect false OnAudioFinished triggers
-		CurrentTrackStartTime = FPlatformTime::Seconds();
+// --- Playback Control ---
 
-		FString TrackName = GetCurrentTrackName();
-		bool bIsActuallyPlaying = MusicAudioComponent->IsPlaying();
-		
-		FString PlayStatus = FString::Printf(TEXT("PlayCurrentTrack: Now playing track %d: %s (IsPlaying=%s, Sound=%s)"), 
-			CurrentTrackIndex, *TrackName, bIsActuallyPlaying ? TEXT("YES") : TEXT("NO"),
-			MusicAudioComponent->Sound ? *MusicAudioComponent->Sound->GetName() : TEXT("NULL"));
-		UE_LOG(LogStateRunner_Arcade, Log, TEXT("MusicPersistenceSubsystem: %s"), *PlayStatus);
-		WriteMusicDebugLog(PlayStatus);
+void UMusicPersistenceSubsystem::PlayCurrentTrack()
+{
+	if (!MusicTracks.IsValidIndex(CurrentTrackIndex))
+	{
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("MusicPersistenceSubsystem: Invalid track index %d"), CurrentTrackIndex);
+		return;
+	}
 
-		// Start the fallback playback monitor
-		StartPlaybackMonitor();
+	USoundBase* TrackToPlay = MusicTracks[CurrentTrackIndex];
+	if (!TrackToPlay)
+	{
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("MusicPersistenceSubsystem: Track at index %d is null"), CurrentTrackIndex);
+		return;
+	}
 
-		// Broadcast track change
-		OnTrackChanged.Broadcast(TrackName);
+	// Guard: Don't restart if we're already playing this exact track
+	const UAudioComponent* Active = Decks[ActiveDeck];
+	if (IsPlaying() && Active->Sound == TrackToPlay)
+	{
+		UE_LOG(LogStateRunner_Arcade, Log, TEXT("MusicPersistenceSubsystem: Track %d already playing, skipping restart"), CurrentTrackIndex);
+		return;
+	}
+
+	WriteMusicDebugLog(FString::Printf(TEXT("PlayCurrentTrack: Attempting to play track %d: %s"), CurrentTrackIndex, *TrackToPlay->GetName()));
+
+	// Something else is playing: short crossfade onto the requested track, else start it cold
+	if (IsPlaying())
+	{
+		NextTrackIndex = CurrentTrackIndex;
+		CrossfadeToNextTrack(SkipFadeSeconds);
 	}
 	else
 	{
-		UE_LOG(LogStateRunner_Arcade, Error, TEXT("MusicPersistenceSubsystem: Failed to create audio component for track %d"), CurrentTrackIndex);
-		WriteMusicDebugLog(FString::Printf(TEXT("ERROR: Failed to create audio component for track %d"), CurrentTrackIndex));
-		bTransitioningTracks = false;
+		StartTrackOnDeck(ActiveDeck, CurrentTrackIndex, 0.0f);
 	}
 }
 
 void UMusicPersistenceSubsystem::SkipTrack()
 {
 	UE_LOG(LogStateRunner_Arcade, Log, TEXT("MusicPersistenceSubsystem: Skip requested"));
-	
-	// Temporarily ignore OnAudioFinished callbacks during track change
-	// to avoid infinite loops when volume is 0% (audio fires "finished" immediately)
-	bIgnoreAudioFinished = true;
-	
-	AdvanceTrackIndex();
-	PlayCurrentTrack();
-	
-	// Clear the flag after a short delay to allow the audio system to settle
-	UWorld* World = nullptr;
-	if (UGameInstance* GI = GetGameInstance())
-	{
-		World = GI->GetWorld();
-	}
-	if (World)
-	{
-		FTimerHandle TempHandle;
-		World->GetTimerManager().SetTimer(TempHandle, [this]()
-		{
-			bIgnoreAudioFinished = false;
-		}, 0.2f, false);
-	}
-	else
+
+	if (!IsPlaying())
 	{
-		// Fallback: just clear it immediately if no world
-		bIgnoreAudioFinished = false;
+		AdvanceTrackIndex();
+		PlayCurrentTrack();
+		return;
 	}
+
+	// The primed next track is already chosen; the outgoing deck's finish is ignored, so no
+	// temporary bIgnoreAudioFinished window is needed
+	CrossfadeToNextTrack(SkipFadeSeconds);
 }
 
 void UMusicPersistenceSubsystem::ToggleShuffle()
 {
 	bShuffleEnabled = !bShuffleEnabled;
+
+	if (UArcadeSaveSubsystem* Saves = GetGameInstance()->GetSubsystem<UArcadeSaveSubsystem>())
+	{
+		Saves->SetShuffleEnabled(bShuffleEnabled);
+	}
+
+	// Re-pick (and prime) the upcoming track under the new mode
+	if (IsPlaying())
+	{
+		PrepareNextTrack();
+	}
+
 	UE_LOG(LogStateRunner_Arcade, Log, TEXT("MusicPersistenceSubsystem: Shuffle %s"), bShuffleEnabled ? TEXT("ENABLED") : TEXT("DISABLED"));
 }
 
 bool UMusicPersistenceSubsystem::IsPlaying() const
 {
-	return MusicAudioComponent && MusicAudioComponent->IsValidLowLevel() && MusicAudioComponent->IsPlaying();
+	const UAudioComponent* Active = Decks[ActiveDeck];
+	return Active && Active->IsValidLowLevel() && Active->IsPlaying();
 }
 
 void UMusicPersistenceSubsystem::EnsureMusicPlaying()
@@ -426,18 +496,9 @@ void UMusicPersistenceSubsystem::EnsureMusicPlaying()
 	}
 	
 	// If we have tracks (regardless of bMusicHasStarted), restart playback
-	// This handles level transition where audio component was destroyed but tracks remain
 	if (MusicTracks.Num() > 0)
 	{
 		UE_LOG(LogStateRunner_Arcade, Log, TEXT("MusicPersistenceSubsystem: EnsureMusicPlaying - restarting playback with %d tracks"), MusicTracks.Num());
-		bTransitioningTracks = false; // Clear any stuck transition state
-		
-		// Clean up stale audio component reference if it's no longer valid
-		if (MusicAudioComponent && !MusicAudioComponent->IsValidLowLevel())
-		{
-			MusicAudioComponent = nullptr;
-		}
-		
 		PlayCurrentTrack();
 	}
 	else
@@ -457,11 +518,11 @@ FString UMusicPersistenceSubsystem::GetCurrentTrackName() const
 
 // --- Internal ---
 
-void UMusicPersistenceSubsystem::AdvanceTrackIndex()
+int32 UMusicPersistenceSubsystem::GetNextTrackIndex() const
 {
 	if (MusicTracks.Num() == 0)
 	{
-		return;
+		return INDEX_NONE;
 	}
 
 	if (bShuffleEnabled)
@@ -469,188 +530,83 @@ void UMusicPersistenceSubsystem::AdvanceTrackIndex()
 		// Random track (avoid same track if possible)
 		if (MusicTracks.Num() > 1)
 		{
+			const FRandomStream& ShuffleRandom = URunSeedSubsystem::GetStreamFor(this, ERunRandomStream::Music);
+
 			int32 NewIndex;
 			do
 			{
-				NewIndex = FMath::RandRange(0, MusicTracks.Num() - 1);
+				NewIndex = ShuffleRandom.RandRange(0, MusicTracks.Num() - 1);
 			} while (NewIndex == CurrentTrackIndex);
-			CurrentTrackIndex = NewIndex;
+			return NewIndex;
 		}
-	}
-	else
-	{
-		// Sequential
-		CurrentTrackIndex = (CurrentTrackIndex + 1) % MusicTracks.Num();
+		return CurrentTrackIndex;
 	}
 
+	// Sequential
+	return (CurrentTrackIndex + 1) % MusicTracks.Num();
 }
 
-void UMusicPersistenceSubsystem::SetIgnoreAudioFinished(bool bIgnore)
-{
-	bIgnoreAudioFinished = bIgnore;
-}
-
-void UMusicPersistenceSubsystem::OnAudioFinished()
+void UMusicPersistenceSubsystem::AdvanceTrackIndex()
 {
-	// If volume adjustment is in progress, ignore this callback
-	// (SetSoundMixClassOverride can trigger false "finished" events)
-	if (bIgnoreAudioFinished)
-	{
-		UE_LOG(LogStateRunner_Arcade, Log, TEXT("MusicPersistenceSubsystem: OnAudioFinished ignored (bIgnoreAudioFinished=true)"));
-		return;
-	}
-
-	// Prevent re-entry during track transition
-	if (bTransitioningTracks)
-	{
-		UE_LOG(LogStateRunner_Arcade, Log, TEXT("MusicPersistenceSubsystem: OnAudioFinished ignored (already transitioning)"));
-		return;
-	}
-	
-	// Check if track played for a reasonable amount of time
-	// In shipping builds, OnAudioFinished can fire immediately if audio fails to play
-	double PlaybackDuration = FPlatformTime::Seconds() - CurrentTrackStartTime;
-	if (PlaybackDuration < MinPlaybackTimeBeforeFinish)
-	{
-		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("MusicPersistenceSubsystem: OnAudioFinished fired after only %.2f seconds - likely audio playback failure, ignoring"), PlaybackDuration);
-		return;
-	}
-
-	// Check if we have a valid world - if not, we're in a level transition
-	// Just advance the index and let the fallback monitor restart playback later
-	UWorld* World = nullptr;
-	if (UGameInstance* GI = GetGameInstance())
-	{
-		World = GI->GetWorld();
-	}
-	if (!World)
-	{
-		World = GEngine->GetCurrentPlayWorld();
-	}
-	
-	if (!World)
+	if (MusicTracks.Num() == 0)
 	{
-		// Level transition - audio component died but track didn't naturally finish
-		// Don't advance track, just clear the reference and let monitor restart the SAME track
-		UE_LOG(LogStateRunner_Arcade, Log, TEXT("MusicPersistenceSubsystem: Audio stopped during level transition - will resume track %d"), CurrentTrackIndex);
-		MusicAudioComponent = nullptr;
 		return;
 	}
 
-	UE_LOG(LogStateRunner_Arcade, Log, TEXT("MusicPersistenceSubsystem: Track %d finished, advancing to next"), CurrentTrackIndex);
-	
-	// Mark that we're transitioning to prevent re-entry
-	bTransitioningTracks = true;
-	
-	// Stop the playback monitor during transition
-	StopPlaybackMonitor();
-	
-	AdvanceTrackIndex();
-	PlayCurrentTrack();
+	CurrentTrackIndex = MusicTracks.IsValidIndex(NextTrackIndex) ? NextTrackIndex : GetNextTrackIndex();
+	NextTrackIndex = INDEX_NONE;
 }
 
-// --- Playback Monitor (Fallback) ---
-
-void UMusicPersistenceSubsystem::StartPlaybackMonitor()
+void UMusicPersistenceSubsystem::SetIgnoreAudioFinished(bool bIgnore)
 {
-	StopPlaybackMonitor(); // Clear any existing timer
-	
-	UWorld* World = nullptr;
-	if (UGameInstance* GI = GetGameInstance())
-	{
-		World = GI->GetWorld();
-	}
-	
-	if (World)
+	bIgnoreAudioFinished = bIgnore;
+
+	// A finish swallowed during the volume change may have been real -- recover now
+	if (!bIgnore && bFinishedWhileIgnored)
 	{
-		// Check frequently (0.25s) for quick recovery after level transitions
-		// Using lambda because UGameInstanceSubsystem isn't a valid direct timer target
-		FTimerDelegate TimerDelegate = FTimerDelegate::CreateWeakLambda(this, [this]()
+		bFinishedWhileIgnored = false;
+		if (!IsPlaying() && bMusicHasStarted)
 		{
-			CheckPlaybackStatus();
-		});
-		
-		constexpr float CheckInterval = 0.25f;
-		constexpr bool bLoop = true;
-		constexpr float InitialDelay = 0.0f; // Start checking immediately
-		
-		World->GetTimerManager().SetTimer(
-			PlaybackMonitorHandle,
-			TimerDelegate,
-			CheckInterval,
-			bLoop,
-			InitialDelay
-		);
+			UE_LOG(LogStateRunner_Arcade, Log, TEXT("MusicPersistenceSubsystem: Playback stopped during volume change - resuming track %d"), CurrentTrackIndex);
+			StartTrackOnDeck(ActiveDeck, CurrentTrackIndex, 0.0f);
+		}
 	}
 }
 
-void UMusicPersistenceSubsystem::StopPlaybackMonitor()
+void UMusicPersistenceSubsystem::HandleDeckFinished(UAudioComponent* Deck)
 {
-	UWorld* World = nullptr;
-	if (UGameInstance* GI = GetGameInstance())
+	// The outgoing deck finishing is just the end of its fade-out (or we stopped on purpose)
+	if (!bPlaybackActive || Deck != Decks[ActiveDeck])
 	{
-		World = GI->GetWorld();
-	}
-	
-	if (World && PlaybackMonitorHandle.IsValid())
-	{
-		World->GetTimerManager().ClearTimer(PlaybackMonitorHandle);
+		return;
 	}
-	PlaybackMonitorHandle.Invalidate();
-}
 
-void UMusicPersistenceSubsystem::CheckPlaybackStatus()
-{
-	// Skip check if we're ignoring callbacks
+	// If volume adjustment is in progress, decide once it's done
+	// (SetSoundMixClassOverride can trigger false "finished" events)
 	if (bIgnoreAudioFinished)
 	{
+		UE_LOG(LogStateRunner_Arcade, Log, TEXT("MusicPersistenceSubsystem: OnAudioFinished deferred (bIgnoreAudioFinished=true)"));
+		bFinishedWhileIgnored = true;
 		return;
 	}
-	
-	// Don't try to restart if we have no tracks loaded
-	if (MusicTracks.Num() == 0)
-	{
-		return;
-	}
-	
-	// If we're stuck in transitioning state for too long, clear it
-	if (bTransitioningTracks)
-	{
-		// The transition state should be brief - if we're still here after a check, something went wrong
-		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("MusicPersistenceSubsystem: Clearing stuck transition state"));
-		bTransitioningTracks = false;
-	}
-	
-	// Check if audio component exists and is valid
-	bool bNeedsRestart = false;
-	
-	if (!MusicAudioComponent || !MusicAudioComponent->IsValidLowLevel())
-	{
-		UE_LOG(LogStateRunner_Arcade, Log, TEXT("MusicPersistenceSubsystem: Monitor detected invalid audio component - will restart"));
-		bNeedsRestart = true;
-	}
-	else if (!MusicAudioComponent->IsPlaying())
-	{
-		// Audio component exists but not playing - track may have ended without callback
-		UE_LOG(LogStateRunner_Arcade, Log, TEXT("MusicPersistenceSubsystem: Monitor detected playback stopped - will restart"));
-		bNeedsRestart = true;
-	}
-	
-	if (bNeedsRestart && bMusicHasStarted)
+
+	// In shipping builds, OnAudioFinished can fire immediately if audio fails to play.
+	// Don't advance (that would spin through the playlist) -- retry the same track once shortly after.
+	const double PlaybackDuration = FPlatformTime::Seconds() - CurrentTrackStartTime;
+	if (PlaybackDuration < MinPlaybackTimeBeforeFinish)
 	{
-		// Throttle restart attempts to prevent rapid-fire restarts (which cause UI flashing)
-		double CurrentTime = FPlatformTime::Seconds();
-		if (CurrentTime - LastRestartAttemptTime < MinRestartInterval)
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("MusicPersistenceSubsystem: OnAudioFinished fired after only %.2f seconds - likely audio playback failure, retrying"), PlaybackDuration);
+		if (!RetryTickerHandle.IsValid())
 		{
-			return; // Too soon since last restart attempt
+			RetryTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+				FTickerDelegate::CreateUObject(this, &UMusicPersistenceSubsystem::HandleRetryDue), MinRestartInterval);
 		}
-		LastRestartAttemptTime = CurrentTime;
-		
-		// Don't advance track - just restart the current one
-		// Track only advances when OnAudioFinished fires with a valid world (natural end)
-		UE_LOG(LogStateRunner_Arcade, Log, TEXT("MusicPersistenceSubsystem: Monitor restarting track %d"), CurrentTrackIndex);
-		PlayCurrentTrack();
+		return;
 	}
+
+	// Reached the end without the crossfade (track shorter than the fade) -- start the next now
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("MusicPersistenceSubsystem: Track %d finished, advancing to next"), CurrentTrackIndex);
+	CrossfadeToNextTrack(0.0f);
 }
 
 // --- Static Helper ---
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Containers/Ticker.h"
 #include "MusicPersistenceSubsystem.generated.h"
 
 class UAudioComponent;
@@ -18,7 +19,14 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnMusicTrackChanged, const FString&
  * 
  * Handles persistent music playback across level loads.
  * Since this is a GameInstanceSubsystem, it persists for the entire game session.
- * Uses SpawnSound2D to create an audio component that survives level transitions.
+ * 
+ * Playback runs on two persistent audio components ("decks") created once with
+ * bPersistAcrossLevelTransition, so level loads don't interrupt the music:
+ * - When a track starts, the next one is picked (sequential or shuffle) and primed
+ * - One one-shot ticker fires CrossfadeSeconds before the end and crossfades onto the other deck
+ * - A deck's completion event only matters for the active deck (track shorter than the
+ *   crossfade, or a playback failure); the outgoing deck finishing is the fade ending
+ * No timers poll playback state.
  * 
  * This completely replaces BP_MusicManager - all music logic lives here.
  */
@@ -132,9 +140,24 @@ protected:
 	// INTERNAL STATE
 	//=============================================================================
 
-	/** The currently playing audio component (persists across levels) */
+	/** The two persistent audio components; Decks[ActiveDeck] is the one playing the current track */
 	UPROPERTY()
-	TObjectPtr<UAudioComponent> MusicAudioComponent;
+	TObjectPtr<UAudioComponent> Decks[2];
+
+	/** Index into Decks of the current track's deck */
+	int32 ActiveDeck = 0;
+
+	/** Set while a track is meant to be playing (cleared by StopPlayback) */
+	bool bPlaybackActive = false;
+
+	/** Track picked (and primed) to play after the current one */
+	int32 NextTrackIndex = INDEX_NONE;
+
+	/** Crossfade length at the natural end of a track */
+	static constexpr float CrossfadeSeconds = 2.0f;
+
+	/** Crossfade length when skipping or restarting */
+	static constexpr float SkipFadeSeconds = 0.3f;
 
 	/** Music Sound Class for volume control routing */
 	UPROPERTY()
@@ -159,17 +182,17 @@ protected:
 	/** Flag to ignore OnAudioFinished during volume adjustments */
 	bool bIgnoreAudioFinished = false;
 
-	/** Timer handle for fallback playback monitoring */
-	FTimerHandle PlaybackMonitorHandle;
+	/** The active deck reported finished while bIgnoreAudioFinished was set (checked when it clears) */
+	bool bFinishedWhileIgnored = false;
 
-	/** Flag to track if we're in the process of transitioning tracks */
-	bool bTransitioningTracks = false;
+	/** One-shot ticker that starts the end-of-track crossfade */
+	FTSTicker::FDelegateHandle CrossfadeTickerHandle;
 
-	/** Timestamp of last restart attempt to prevent rapid-fire restarts */
-	double LastRestartAttemptTime = 0.0;
+	/** One-shot ticker that retries a track that failed to play */
+	FTSTicker::FDelegateHandle RetryTickerHandle;
 	
-	/** Minimum time between restart attempts (seconds) */
-	static constexpr double MinRestartInterval = 1.0;
+	/** Delay before retrying a track that failed to play (seconds) */
+	static constexpr float MinRestartInterval = 1.0f;
 
 	/** Timestamp when current track started playing */
 	double CurrentTrackStartTime = 0.0;
@@ -186,25 +209,36 @@ protected:
 	// INTERNAL FUNCTIONS
 	//=============================================================================
 
+	/** Pick the track after the current one (considering shuffle) */
+	int32 GetNextTrackIndex() const;
+
 	/** Advance to the next track index (considering shuffle) */
 	void AdvanceTrackIndex();
 
-	/** Called when a track finishes playing */
-	UFUNCTION()
-	void OnAudioFinished();
+	/** Completion event from either deck */
+	void HandleDeckFinished(UAudioComponent* Deck);
 
-	/** Create/recreate the audio component */
-	void EnsureAudioComponent();
+	/** Create the deck if needed (persistent, UI sound, music class) and give it Sound */
+	UAudioComponent* EnsureDeck(int32 DeckIndex, USoundBase* Sound);
 
-	/** Load default tracks from asset paths */
-	void LoadDefaultTracks();
+	/** Start a track on a deck and make it the active one */
+	void StartTrackOnDeck(int32 DeckIndex, int32 TrackIndex, float FadeInSeconds);
+
+	/** Fade the active deck out and the next track in on the other deck */
+	void CrossfadeToNextTrack(float FadeSeconds);
 
-	/** Fallback monitor that checks if playback has stopped unexpectedly */
-	void CheckPlaybackStatus();
+	/** Pick and prime the next track and arm the end-of-track crossfade */
+	void PrepareNextTrack();
 
-	/** Start the playback monitor timer */
-	void StartPlaybackMonitor();
+	/** Crossfade ticker callback (one-shot) */
+	bool HandleCrossfadeDue(float DeltaTime);
 
-	/** Stop the playback monitor timer */
-	void StopPlaybackMonitor();
+	/** Retry ticker callback (one-shot) */
+	bool HandleRetryDue(float DeltaTime);
+
+	/** Stop both decks and clear the tickers */
+	void StopPlayback();
+
+	/** Take the default tracks from the boot preload manifest */
+	void LoadDefaultTracks();
 };
@@ -0,0 +1,609 @@
+#include "ObstacleLayoutGenerator.h"
+#include "SpawnTypeTraits.h"
+#include "StateRunner_Arcade.h"
+
+FObstacleLayoutGenerator::FObstacleLayoutGenerator(const FObstacleLayoutSettings& InSettings, const UObstaclePatternLibrary* InPatternLibrary, int32 Seed)
+	: Settings(InSettings)
+	, PatternLibrary(InPatternLibrary)
+	, LayoutRandom(Seed)
+{
+	RecentPatternMask.Init(false, PatternLibrary ? PatternLibrary->Patterns.Num() : 0);
+}
+
+// --- Layout Generation ---
+
+FObstacleSegmentLayout FObstacleLayoutGenerator::BuildSegmentLayout(const FObstacleSegmentPlan& Plan)
+{
+	FObstacleSegmentLayout Layout;
+	Layout.Plan = Plan;
+	LayoutDifficultyLevel = Plan.DifficultyLevel;
+
+	TArray<FObstacleSpawnData>& ObstacleLayout = Layout.Obstacles;
+	
+	bool bUsePattern = LayoutRandom.FRand() < Settings.PredefinedPatternChance;
+	
+	if (bUsePattern && GenerateFromPattern(ObstacleLayout, Layout.PatternName))
+	{
+		// Find pattern bounds and fill gaps with extra obstacles
+		float PatternMinX = 1.0f;
+		float PatternMaxX = 0.0f;
+		for (const FObstacleSpawnData& Data : ObstacleLayout)
+		{
+			PatternMinX = FMath::Min(PatternMinX, Data.RelativeXOffset);
+			PatternMaxX = FMath::Max(PatternMaxX, Data.RelativeXOffset);
+		}
+		
+		AddFillerObstacles(ObstacleLayout, PatternMinX, PatternMaxX);
+	}
+	else
+	{
+		int32 ObstacleCount = CalculateObstacleCount(Plan.BaseObstacleCount);
+		GenerateProcedural(ObstacleLayout, ObstacleCount);
+	}
+
+	// Inject 3-lane FullWall blockage for fairness testing
+	if (Settings.bDebugForce3LaneBlockage)
+	{
+		const float BlockageX = 0.50f;
+		for (ELane Lane : { ELane::Left, ELane::Center, ELane::Right })
+		{
+			FObstacleSpawnData BlockData;
+			BlockData.Lane = Lane;
+			BlockData.ObstacleType = EObstacleType::FullWall;
+			BlockData.RelativeXOffset = BlockageX;
+			BlockData.ZOffset = 0.0f;
+			ObstacleLayout.Add(BlockData);
+		}
+
+		UE_LOG(LogStateRunner_Arcade, Warning,
+			TEXT("Injected 3-lane FullWall blockage at X=0.50 — EnsureFairLayout should remove one"));
+	}
+
+	// Make sure at least one lane is passable
+	EnsureFairLayout(ObstacleLayout);
+
+	// For breather segments, shift obstacles forward to create a gap at the start
+	const float BreatherGapOffset = Plan.bIsBreather ? Plan.BreatherGapFraction : 0.0f;
+	if (BreatherGapOffset > 0.0f)
+	{
+		float CompressionFactor = 1.0f - BreatherGapOffset;
+		for (FObstacleSpawnData& Data : ObstacleLayout)
+		{
+			Data.RelativeXOffset = BreatherGapOffset + (Data.RelativeXOffset * CompressionFactor);
+		}
+	}
+
+	return Layout;
+}
+
+void FObstacleLayoutGenerator::GenerateProcedural(TArray<FObstacleSpawnData>& OutObstacles, int32 ObstacleCount)
+{
+	OutObstacles.Reserve(ObstacleCount);
+
+	// Even distribution across the segment with a bit of jitter.
+	// Difficulty ramps by adding more obstacles, not by tightening spacing.
+	const float MinXSpacing = Settings.MinObstacleSpacing;
+	
+	float SpawnRange = Settings.MaxSpawnOffset - Settings.MinSpawnOffset;
+	
+	// Space obstacles evenly with gaps at start and end
+	float EvenSpacing = SpawnRange / (ObstacleCount + 1);
+	
+	// Cap count if spacing gets too tight
+	if (EvenSpacing < MinXSpacing)
+	{
+		int32 MaxObstaclesThatFit = FMath::FloorToInt(SpawnRange / MinXSpacing);
+		ObstacleCount = FMath::Max(1, MaxObstaclesThatFit);
+		EvenSpacing = SpawnRange / (ObstacleCount + 1);
+	}
+	
+	// Track positions per lane to avoid same-lane stacking
+	TMap<ELane, TArray<float>> UsedXOffsetsPerLane;
+	UsedXOffsetsPerLane.Add(ELane::Left, TArray<float>());
+	UsedXOffsetsPerLane.Add(ELane::Center, TArray<float>());
+	UsedXOffsetsPerLane.Add(ELane::Right, TArray<float>());
+
+	for (int32 i = 0; i < ObstacleCount; i++)
+	{
+		FObstacleSpawnData SpawnData;
+
+		SpawnData.ObstacleType = GetRandomObstacleType();
+		SpawnData.Lane = GetRandomLane();
+
+		// Even base position + small jitter for variety
+		float BaseOffset = Settings.MinSpawnOffset + (EvenSpacing * (i + 1));
+		float Jitter = LayoutRandom.FRandRange(-EvenSpacing * 0.20f, EvenSpacing * 0.20f);
+		float XOffset = FMath::Clamp(BaseOffset + Jitter, Settings.MinSpawnOffset, Settings.MaxSpawnOffset);
+		
+		// Resolve same-lane conflicts
+		TArray<float>& LaneUsedOffsets = UsedXOffsetsPerLane[SpawnData.Lane];
+		int32 Attempts = 0;
+		const int32 MaxAttempts = 10;
+		
+		while (Attempts < MaxAttempts && LaneUsedOffsets.ContainsByPredicate(
+			[XOffset, MinXSpacing](float Used) { return FMath::Abs(Used - XOffset) < MinXSpacing; }))
+		{
+			// Try a different lane
+			SpawnData.Lane = GetRandomLane();
+			TArray<float>& NewLaneOffsets = UsedXOffsetsPerLane[SpawnData.Lane];
+			
+			if (!NewLaneOffsets.ContainsByPredicate(
+				[XOffset, MinXSpacing](float Used) { return FMath::Abs(Used - XOffset) < MinXSpacing; }))
+			{
+				break;
+			}
+			Attempts++;
+		}
+
+		SpawnData.RelativeXOffset = XOffset;
+		UsedXOffsetsPerLane[SpawnData.Lane].Add(XOffset);
+		SpawnData.ZOffset = 0.0f;
+
+		OutObstacles.Add(SpawnData);
+	}
+}
+
+int32 FObstacleLayoutGenerator::CalculateObstacleCount(int32 BaseObstacleCount)
+{
+	// Ramps with difficulty, capped at max
+	int32 RandomVariance = LayoutRandom.RandRange(-1, 1);
+	int32 FinalCount = FMath::Clamp(BaseObstacleCount + RandomVariance, Settings.MinObstaclesPerSegment, Settings.MaxObstaclesPerSegment);
+
+	return FinalCount;
+}
+
+void FObstacleLayoutGenerator::AddFillerObstacles(TArray<FObstacleSpawnData>& OutObstacles, float PatternMinX, float PatternMaxX)
+{
+	// More filler at higher difficulty
+	int32 TotalFillerCount = Settings.FillerObstacleCount;
+	
+	if (LayoutDifficultyLevel >= Settings.DifficultyToDisableBreathers)
+	{
+		int32 ExtraDifficulty = LayoutDifficultyLevel - Settings.DifficultyToDisableBreathers;
+		TotalFillerCount += ExtraDifficulty * Settings.FillerPerDifficulty;
+	}
+	
+	if (TotalFillerCount <= 0)
+	{
+		return;
+	}
+
+	// Filler zones: before and after the pattern
+	const float GapBuffer = 0.08f;
+	
+	float BeforeGapStart = Settings.MinSpawnOffset;
+	float BeforeGapEnd = FMath::Max(Settings.MinSpawnOffset, PatternMinX - GapBuffer);
+	float BeforeGapSize = BeforeGapEnd - BeforeGapStart;
+	
+	float AfterGapStart = FMath::Min(Settings.MaxSpawnOffset, PatternMaxX + GapBuffer);
+	float AfterGapEnd = Settings.MaxSpawnOffset;
+	float AfterGapSize = AfterGapEnd - AfterGapStart;
+	
+	float TotalGapSize = BeforeGapSize + AfterGapSize;
+	
+	if (TotalGapSize < 0.1f)
+	{
+		return;
+	}
+	
+	// Distribute proportionally
+	int32 BeforeCount = (BeforeGapSize > 0.05f) ? FMath::RoundToInt(TotalFillerCount * (BeforeGapSize / TotalGapSize)) : 0;
+	int32 AfterCount = TotalFillerCount - BeforeCount;
+	
+	if (BeforeGapSize > 0.1f && BeforeCount == 0 && AfterCount > 1)
+	{
+		BeforeCount = 1;
+		AfterCount--;
+	}
+	if (AfterGapSize > 0.1f && AfterCount == 0 && BeforeCount > 1)
+	{
+		AfterCount = 1;
+		BeforeCount--;
+	}
+	
+	if (BeforeCount > 0 && BeforeGapSize > 0.05f)
+	{
+		float Spacing = BeforeGapSize / (BeforeCount + 1);
+		for (int32 i = 0; i < BeforeCount; i++)
+		{
+			FObstacleSpawnData Filler;
+			Filler.RelativeXOffset = BeforeGapStart + Spacing * (i + 1);
+			Filler.Lane = static_cast<ELane>(LayoutRandom.RandRange(0, 2));
+			Filler.ObstacleType = GetRandomObstacleType();
+			Filler.ZOffset = 0.0f;
+			OutObstacles.Add(Filler);
+		}
+	}
+	
+	if (AfterCount > 0 && AfterGapSize > 0.05f)
+	{
+		float Spacing = AfterGapSize / (AfterCount + 1);
+		for (int32 i = 0; i < AfterCount; i++)
+		{
+			FObstacleSpawnData Filler;
+			Filler.RelativeXOffset = AfterGapStart + Spacing * (i + 1);
+			Filler.Lane = static_cast<ELane>(LayoutRandom.RandRange(0, 2));
+			Filler.ObstacleType = GetRandomObstacleType();
+			Filler.ZOffset = 0.0f;
+			OutObstacles.Add(Filler);
+		}
+	}
+}
+
+void FObstacleLayoutGenerator::EnsureFairLayout(TArray<FObstacleSpawnData>& Obstacles) const
+{
+	STATERUNNER_SCOPE_CYCLE_COUNTER(EnsureFairLayout);
+
+	if (Obstacles.Num() == 0)
+	{
+		return;
+	}
+
+	// Sort by X once -- the sweep takes obstacles in this order
+	Obstacles.Sort([](const FObstacleSpawnData& A, const FObstacleSpawnData& B)
+	{
+		return A.RelativeXOffset < B.RelativeXOffset;
+	});
+
+	// One sweep in X order, enforcing both rules as each obstacle is accepted:
+	//
+	// - Type-aware spacing: an obstacle closer to an accepted one in its lane than
+	//   GetRequiredSpacingForTypes is pushed forward and revisited, or (no room ahead)
+	//   re-typed to break a jump/slide combo, or dropped. Only accepted obstacles within
+	//   GetMaxRequiredSpacing can constrain it, so each lane keeps just that short window.
+	//
+	// - Open lane: a FullWall blocks its lane completely. FullWalls within FullWallRowThreshold
+	//   of the previous one (transitively) form a row; the one that would close the row's last
+	//   open lane is dropped.
+	//
+	// Pushed obstacles go back into a min-heap on X, so acceptance stays in X order.
+	// Pushes only move forward (by at least the 0.02 margin), so the pass is bounded.
+
+	auto ByX = [&Obstacles](int32 A, int32 B)
+	{
+		const float AX = Obstacles[A].RelativeXOffset;
+		const float BX = Obstacles[B].RelativeXOffset;
+		return AX < BX || (AX == BX && A < B);
+	};
+
+	TArray<int32, TInlineAllocator<32>> Pending;
+	Pending.Reserve(Obstacles.Num());
+	for (int32 i = 0; i < Obstacles.Num(); i++)
+	{
+		Pending.Add(i);
+	}
+	Pending.Heapify(ByX);
+
+	const float MaxRequiredSpacing = GetMaxRequiredSpacing();
+	TArray<int32, TInlineAllocator<8>> LaneWindows[3];
+
+	// X at which an obstacle of Type clears everything in a lane window
+	auto GetRequiredX = [this, &Obstacles](const TArray<int32, TInlineAllocator<8>>& Window, EObstacleType Type)
+	{
+		float RequiredX = TNumericLimits<float>::Lowest();
+		for (int32 PrevIdx : Window)
+		{
+			const FObstacleSpawnData& Prev = Obstacles[PrevIdx];
+			RequiredX = FMath::Max(RequiredX, Prev.RelativeXOffset + GetRequiredSpacingForTypes(Prev.ObstacleType, Type));
+		}
+		return RequiredX;
+	};
+
+	constexpr uint8 AllLanesMask = 0x7;
+	uint8 RowLanesMask = 0;
+	int32 RowSize = 0;
+	float RowLastX = TNumericLimits<float>::Lowest();
+
+	TArray<int32, TInlineAllocator<32>> Accepted;
+	Accepted.Reserve(Obstacles.Num());
+
+	while (Pending.Num() > 0)
+	{
+		int32 Index;
+		Pending.HeapPop(Index, ByX, EAllowShrinking::No);
+		FObstacleSpawnData& Data = Obstacles[Index];
+		const int32 LaneIndex = static_cast<int32>(Data.Lane);
+		TArray<int32, TInlineAllocator<8>>& Window = LaneWindows[LaneIndex];
+
+		// X only grows in pop order, so anything this far back can't constrain later obstacles either
+		while (Window.Num() > 0 && Data.RelativeXOffset - Obstacles[Window[0]].RelativeXOffset >= MaxRequiredSpacing)
+		{
+			Window.RemoveAt(0, 1, EAllowShrinking::No);
+		}
+
+		// --- Type-aware spacing ---
+		if (Settings.bEnableTypeAwareSpacing)
+		{
+			const float RequiredX = GetRequiredX(Window, Data.ObstacleType);
+			if (Data.RelativeXOffset < RequiredX)
+			{
+				// Push forward and revisit once everything before the new X is settled
+				const float PushedX = RequiredX + 0.02f;
+				if (PushedX <= Settings.MaxSpawnOffset)
+				{
+					Data.RelativeXOffset = PushedX;
+					Pending.HeapPush(Index, ByX);
+					continue;
+				}
+
+				// No room ahead: slide->jump becomes slide->slide, jump->slide becomes jump->jump
+				const EObstacleType PreviousType = Obstacles[Window.Last()].ObstacleType;
+				const bool bIsJumpSlideCombo = ObstacleSpacingExtras[(int32)PreviousType][(int32)Data.ObstacleType] != EObstacleSpacingExtra::None;
+
+				if (!bIsJumpSlideCombo || Data.RelativeXOffset < GetRequiredX(Window, PreviousType))
+				{
+					// Last resort: drop it
+					continue;
+				}
+
+				Data.ObstacleType = PreviousType;
+			}
+		}
+
+		// --- Open lane ---
+		if (GetObstacleTypeTraits(Data.ObstacleType).bBlocksLane)
+		{
+			if (Data.RelativeXOffset - RowLastX > FullWallRowThreshold)
+			{
+				RowLanesMask = 0;
+				RowSize = 0;
+			}
+
+			const uint8 LaneBit = static_cast<uint8>(1 << LaneIndex);
+			if ((RowLanesMask | LaneBit) == AllLanesMask)
+			{
+				UE_LOG(LogStateRunner_Arcade, Warning,
+					TEXT("EnsureFairLayout: FullWall cluster blocks ALL 3 lanes! Removing %s lane FullWall at X=%.2f (cluster size: %d)"),
+					Data.Lane == ELane::Left ? TEXT("Left") : (Data.Lane == ELane::Center ? TEXT("Center") : TEXT("Right")),
+					Data.RelativeXOffset,
+					RowSize + 1);
+				continue;
+			}
+
+			RowLanesMask |= LaneBit;
+			RowLastX = Data.RelativeXOffset;
+			RowSize++;
+		}
+
+		Window.Add(Index);
+		Accepted.Add(Index);
+	}
+
+	// Accepted is in X order
+	TArray<FObstacleSpawnData> FairObstacles;
+	FairObstacles.Reserve(Accepted.Num());
+	for (int32 Index : Accepted)
+	{
+		FairObstacles.Add(Obstacles[Index]);
+	}
+	Obstacles = MoveTemp(FairObstacles);
+}
+
+float FObstacleLayoutGenerator::GetRequiredSpacingForTypes(EObstacleType FirstType, EObstacleType SecondType) const
+{
+	// Slide then jump: player is in slide animation and can't immediately jump.
+	// Jump then slide: player needs time to land and initiate slide.
+	const float ExtraSpacing[(int32)EObstacleSpacingExtra::Count] = { 0.0f, Settings.SlideToJumpExtraSpacing, Settings.JumpToSlideExtraSpacing };
+	const EObstacleSpacingExtra Extra = ObstacleSpacingExtras[(int32)FirstType][(int32)SecondType];
+	return Settings.MinObstacleSpacing + ExtraSpacing[(int32)Extra];
+}
+
+void FObstacleLayoutGenerator::FindTypeSpacingViolations(const TArray<FObstacleSpawnData>& Obstacles, TArray<TPair<int32, int32>>& OutViolations) const
+{
+	OutViolations.Reset();
+
+	// Same sweep as EnsureFairLayout: in X order, each obstacle is only checked against
+	// the earlier ones in its lane still within GetMaxRequiredSpacing
+	TArray<int32, TInlineAllocator<32>> Order;
+	Order.Reserve(Obstacles.Num());
+	for (int32 i = 0; i < Obstacles.Num(); i++)
+	{
+		Order.Add(i);
+	}
+	Order.Sort([&Obstacles](int32 A, int32 B)
+	{
+		const float AX = Obstacles[A].RelativeXOffset;
+		const float BX = Obstacles[B].RelativeXOffset;
+		return AX < BX || (AX == BX && A < B);
+	});
+
+	const float MaxRequiredSpacing = GetMaxRequiredSpacing();
+	TArray<int32, TInlineAllocator<8>> LaneWindows[3];
+
+	for (int32 SecondIdx : Order)
+	{
+		const FObstacleSpawnData& Second = Obstacles[SecondIdx];
+		TArray<int32, TInlineAllocator<8>>& Window = LaneWindows[static_cast<int32>(Second.Lane)];
+
+		while (Window.Num() > 0 && Second.RelativeXOffset - Obstacles[Window[0]].RelativeXOffset >= MaxRequiredSpacing)
+		{
+			Window.RemoveAt(0, 1, EAllowShrinking::No);
+		}
+
+		for (int32 FirstIdx : Window)
+		{
+			const FObstacleSpawnData& First = Obstacles[FirstIdx];
+			const float RequiredSpacing = GetRequiredSpacingForTypes(First.ObstacleType, Second.ObstacleType);
+			if (Second.RelativeXOffset - First.RelativeXOffset < RequiredSpacing)
+			{
+				OutViolations.Add(TPair<int32, int32>(FirstIdx, SecondIdx));
+			}
+		}
+
+		Window.Add(SecondIdx);
+	}
+}
+
+// --- Pattern Selection ---
+
+bool FObstacleLayoutGenerator::GenerateFromPattern(TArray<FObstacleSpawnData>& OutObstacles, FString& OutPatternName)
+{
+	int32 PatternIndex = INDEX_NONE;
+	const FObstaclePattern* SelectedPattern = SelectPattern(PatternIndex);
+	
+	if (!SelectedPattern || SelectedPattern->Obstacles.Num() == 0)
+	{
+		return false;
+	}
+
+	OutObstacles = SelectedPattern->Obstacles;
+
+	// Track pattern usage for variety
+	if (Settings.bEnablePatternVariety && PatternIndex != INDEX_NONE)
+	{
+		int32 VarietyCount = Settings.MinPatternVarietyCount;
+		if (VarietyCount == 0)
+		{
+			const int32 AvailableCount = PatternLibrary->GetNumAvailable(LayoutDifficultyLevel);
+			VarietyCount = FMath::Max(1, AvailableCount - 1);
+		}
+		
+		RecordPatternUse(PatternIndex, VarietyCount);
+	}
+
+	// Debug stats are published on the game thread when the layout is consumed
+	OutPatternName = SelectedPattern->PatternName;
+
+	return true;
+}
+
+const FObstaclePattern* FObstacleLayoutGenerator::SelectPattern(int32& OutPatternIndex)
+{
+	OutPatternIndex = INDEX_NONE;
+
+	const FObstaclePatternAliasTable* Table = PatternLibrary ? PatternLibrary->GetSelectionTable(LayoutDifficultyLevel) : nullptr;
+	if (!Table)
+	{
+		return nullptr;
+	}
+
+	const TArray<FObstaclePattern>& Patterns = PatternLibrary->Patterns;
+
+	// O(1) weighted draw; reject recent patterns a bounded number of times
+	const int32 Attempts = Settings.bEnablePatternVariety ? MaxPatternSelectionAttempts : 1;
+	for (int32 Attempt = 0; Attempt < Attempts; Attempt++)
+	{
+		const int32 Candidate = Table->Sample(LayoutRandom);
+		if (!Settings.bEnablePatternVariety || !IsPatternRecentlyUsed(Candidate))
+		{
+			OutPatternIndex = Candidate;
+			return &Patterns[Candidate];
+		}
+	}
+
+	// Unlucky streak or a window covering nearly every candidate -- weighted pick
+	// among the non-recent ones, resetting the window if that's all of them
+	float TotalWeight = 0.0f;
+	for (int32 PatternIndex : Table->PatternIndices)
+	{
+		if (!IsPatternRecentlyUsed(PatternIndex))
+		{
+			TotalWeight += Patterns[PatternIndex].SelectionWeight;
+		}
+	}
+
+	if (TotalWeight <= 0.0f)
+	{
+		ResetPatternVariety();
+		OutPatternIndex = Table->Sample(LayoutRandom);
+		return &Patterns[OutPatternIndex];
+	}
+
+	float RandomValue = LayoutRandom.FRand() * TotalWeight;
+	for (int32 PatternIndex : Table->PatternIndices)
+	{
+		if (IsPatternRecentlyUsed(PatternIndex))
+		{
+			continue;
+		}
+
+		OutPatternIndex = PatternIndex;
+		RandomValue -= Patterns[PatternIndex].SelectionWeight;
+		if (RandomValue <= 0.0f)
+		{
+			break;
+		}
+	}
+
+	return &Patterns[OutPatternIndex];
+}
+
+bool FObstacleLayoutGenerator::IsPatternRecentlyUsed(int32 PatternIndex) const
+{
+	return RecentPatternMask.IsValidIndex(PatternIndex) && RecentPatternMask[PatternIndex];
+}
+
+void FObstacleLayoutGenerator::RecordPatternUse(int32 PatternIndex, int32 WindowSize)
+{
+	if (!RecentPatternMask.IsValidIndex(PatternIndex))
+	{
+		return;
+	}
+
+	WindowSize = FMath::Clamp(WindowSize, 0, MaxPatternVarietyWindow);
+
+	// Evict oldest entries until there's room for this one
+	while (RecentPatternRingCount > 0 && RecentPatternRingCount >= WindowSize)
+	{
+		const int32 Oldest = (RecentPatternRingHead - RecentPatternRingCount + MaxPatternVarietyWindow) % MaxPatternVarietyWindow;
+		RecentPatternMask[RecentPatternRing[Oldest]] = false;
+		RecentPatternRingCount--;
+	}
+
+	if (WindowSize == 0)
+	{
+		return;
+	}
+
+	RecentPatternRing[RecentPatternRingHead] = PatternIndex;
+	RecentPatternRingHead = (RecentPatternRingHead + 1) % MaxPatternVarietyWindow;
+	RecentPatternRingCount++;
+	RecentPatternMask[PatternIndex] = true;
+}
+
+void FObstacleLayoutGenerator::ResetPatternVariety()
+{
+	for (int32 i = 0; i < RecentPatternRingCount; i++)
+	{
+		const int32 Slot = (RecentPatternRingHead - 1 - i + MaxPatternVarietyWindow) % MaxPatternVarietyWindow;
+		if (RecentPatternMask.IsValidIndex(RecentPatternRing[Slot]))
+		{
+			RecentPatternMask[RecentPatternRing[Slot]] = false;
+		}
+	}
+
+	RecentPatternRingHead = 0;
+	RecentPatternRingCount = 0;
+}
+
+// --- Helpers ---
+
+ELane FObstacleLayoutGenerator::GetRandomLane()
+{
+	int32 RandomValue = LayoutRandom.RandRange(0, 2);
+	switch (RandomValue)
+	{
+		case 0:		return ELane::Left;
+		case 1:		return ELane::Center;
+		default:	return ELane::Right;
+	}
+}
+
+EObstacleType FObstacleLayoutGenerator::GetRandomObstacleType()
+{
+	// 40% LowWall (jump), 40% HighBarrier (slide), 20% FullWall (lane change)
+	int32 RandomValue = LayoutRandom.RandRange(0, 9);
+	
+	if (RandomValue < 4)
+	{
+		return EObstacleType::LowWall;
+	}
+	else if (RandomValue < 8)
+	{
+		return EObstacleType::HighBarrier;
+	}
+	else
+	{
+		return EObstacleType::FullWall;
+	}
+}
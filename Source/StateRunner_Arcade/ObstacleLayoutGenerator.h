@@ -0,0 +1,242 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ObstaclePatternLibrary.h"
+#include "Math/RandomStream.h"
+
+/**
+ * Obstacle Layout Generator
+ *
+ * Builds the obstacle layout for one segment -- pattern or procedural generation, filler,
+ * EnsureFairLayout and the breather shift -- for UObstacleSpawnerComponent.
+ *
+ * A plain value type holding everything generation reads or writes: the spawner settings
+ * (copied), the layout RNG, the pattern variety window and the difficulty of the layout
+ * being built. Nothing is shared with the component, so a copy can build on a worker.
+ *
+ * Every layout depends on the draws made before it. The spawner keeps the generator as of
+ * the last segment it consumed; each look-ahead task builds from a copy of the one its
+ * predecessor finished with, so a seed gives the same layouts with or without look-ahead.
+ */
+
+/**
+ * Game-thread decisions for one upcoming segment, handed to layout generation.
+ * Mirrors the SegmentsSpawned / SegmentsSinceEmpty / difficulty progression.
+ */
+struct FObstacleSegmentPlan
+{
+	/** SegmentsSpawned value once this segment is consumed */
+	int32 SegmentNumber = 0;
+
+	/** Difficulty the segment is generated at */
+	int32 DifficultyLevel = 0;
+
+	/** Whether the segment starts with a breather gap */
+	bool bIsBreather = false;
+
+	/** Obstacle count for DifficultyLevel, from the difficulty director (before the +-1 variance) */
+	int32 BaseObstacleCount = 0;
+
+	/** Breather gap for DifficultyLevel, from the difficulty director (only applied to breathers) */
+	float BreatherGapFraction = 0.0f;
+};
+
+/**
+ * Obstacle layout for one segment. Pure data -- built off the game thread
+ * in look-ahead mode, then placed from the pools when the segment spawns.
+ */
+struct FObstacleSegmentLayout
+{
+	/** Plan this layout was generated from */
+	FObstacleSegmentPlan Plan;
+
+	/** Final, fair, breather-shifted obstacles */
+	TArray<FObstacleSpawnData> Obstacles;
+
+	/** Pattern used, empty for procedural layouts */
+	FString PatternName;
+
+	/** Seconds from queuing the layout task to the layout being ready (0 when built synchronously) */
+	float LatencySeconds = 0.0f;
+};
+
+/** UObstacleSpawnerComponent settings layout generation reads (see the properties of the same name) */
+struct FObstacleLayoutSettings
+{
+	float PredefinedPatternChance = 0.0f;
+	bool bEnablePatternVariety = false;
+	int32 MinPatternVarietyCount = 0;
+
+	int32 MinObstaclesPerSegment = 0;
+	int32 MaxObstaclesPerSegment = 0;
+	int32 FillerObstacleCount = 0;
+	int32 FillerPerDifficulty = 0;
+	int32 DifficultyToDisableBreathers = 0;
+
+	float MinSpawnOffset = 0.0f;
+	float MaxSpawnOffset = 1.0f;
+	float MinObstacleSpacing = 0.0f;
+	float SlideToJumpExtraSpacing = 0.0f;
+	float JumpToSlideExtraSpacing = 0.0f;
+	bool bEnableTypeAwareSpacing = false;
+
+	bool bDebugForce3LaneBlockage = false;
+};
+
+class FObstacleLayoutGenerator
+{
+public:
+
+	FObstacleLayoutGenerator() = default;
+
+	/**
+	 * @param InSettings Spawner settings to generate with
+	 * @param InPatternLibrary Library patterns are selected from -- read from workers, so it must
+	 *        outlive every copy of the generator and not change while layouts are building
+	 * @param Seed Layout RNG seed
+	 */
+	FObstacleLayoutGenerator(const FObstacleLayoutSettings& InSettings, const UObstaclePatternLibrary* InPatternLibrary, int32 Seed);
+
+	/**
+	 * Build the complete layout for one segment: pattern/procedural, filler,
+	 * fairness, type spacing and breather shift. Advances the RNG and variety window.
+	 *
+	 * @param Plan Game-thread decisions for the segment
+	 * @return Finished layout, offsets relative to the segment
+	 */
+	FObstacleSegmentLayout BuildSegmentLayout(const FObstacleSegmentPlan& Plan);
+
+	/** Empty the variety window */
+	void ResetPatternVariety();
+
+	/**
+	 * Validate obstacle layout for type-aware spacing violations.
+	 * Returns pairs of obstacle indices that are too close and need fixing.
+	 *
+	 * @param Obstacles Array of obstacles to validate
+	 * @param OutViolations Output: Array of pairs (first index, second index) for violations
+	 */
+	void FindTypeSpacingViolations(const TArray<FObstacleSpawnData>& Obstacles, TArray<TPair<int32, int32>>& OutViolations) const;
+
+	/** Settings this generator was created with */
+	const FObstacleLayoutSettings& GetSettings() const { return Settings; }
+
+	/** FullWalls this close in X (transitively) count as one row for EnsureFairLayout (~750 units at 6250 segment length) */
+	static constexpr float FullWallRowThreshold = 0.12f;
+
+	/** Largest variety window; MinPatternVarietyCount is clamped to this */
+	static constexpr int32 MaxPatternVarietyWindow = 20;
+
+	/** Alias-table draws before falling back to a scan of the non-recent patterns */
+	static constexpr int32 MaxPatternSelectionAttempts = 8;
+
+private:
+
+	/**
+	 * Generate obstacle layout for a segment using predefined pattern.
+	 * Selects a pattern based on difficulty and weight.
+	 *
+	 * @param OutObstacles Array to fill with obstacle spawn data
+	 * @return True if a valid pattern was selected
+	 */
+	bool GenerateFromPattern(TArray<FObstacleSpawnData>& OutObstacles, FString& OutPatternName);
+
+	/**
+	 * Generate obstacle layout procedurally.
+	 * Creates random obstacles while ensuring fairness.
+	 *
+	 * @param OutObstacles Array to fill with obstacle spawn data
+	 * @param ObstacleCount Number of obstacles to generate
+	 */
+	void GenerateProcedural(TArray<FObstacleSpawnData>& OutObstacles, int32 ObstacleCount);
+
+	/**
+	 * Calculate number of obstacles for the layout being built.
+	 *
+	 * @param BaseObstacleCount The plan's count for its difficulty
+	 * @return Number of obstacles to spawn
+	 */
+	int32 CalculateObstacleCount(int32 BaseObstacleCount);
+
+	/**
+	 * Add filler obstacles to fill gaps around a pattern.
+	 * Places obstacles in the empty space before/after the pattern cluster.
+	 *
+	 * @param OutObstacles Array to add filler obstacles to
+	 * @param PatternMinX Minimum X offset of the pattern (0.0-1.0)
+	 * @param PatternMaxX Maximum X offset of the pattern (0.0-1.0)
+	 */
+	void AddFillerObstacles(TArray<FObstacleSpawnData>& OutObstacles, float PatternMinX, float PatternMaxX);
+
+	/**
+	 * Ensure obstacle layout is fair: type-aware spacing holds in every lane and no FullWall
+	 * row blocks all 3 lanes. Sorts by X once and fixes both in a single sweep (pushing,
+	 * re-typing or dropping obstacles), so cost stays O(n log n) at high obstacle caps.
+	 *
+	 * @param Obstacles Array of obstacles to validate/fix (left sorted by X)
+	 */
+	void EnsureFairLayout(TArray<FObstacleSpawnData>& Obstacles) const;
+
+	/**
+	 * Check if two obstacle types require extra spacing when in sequence (same lane).
+	 * Returns the total minimum spacing required between the two obstacles.
+	 *
+	 * @param FirstType The obstacle encountered first (closer to segment start)
+	 * @param SecondType The obstacle encountered second (further into segment)
+	 * @return Minimum relative X spacing required (base spacing + any extra for type combo)
+	 */
+	float GetRequiredSpacingForTypes(EObstacleType FirstType, EObstacleType SecondType) const;
+
+	/** Widest spacing GetRequiredSpacingForTypes can ask for (how far back a lane window reaches) */
+	float GetMaxRequiredSpacing() const { return Settings.MinObstacleSpacing + FMath::Max(Settings.SlideToJumpExtraSpacing, Settings.JumpToSlideExtraSpacing); }
+
+	/**
+	 * Select a random pattern based on difficulty and weights.
+	 * Draws from the library's alias table for the difficulty level, rejecting
+	 * recently used patterns when variety is enabled.
+	 *
+	 * @param OutPatternIndex Index of selected pattern (for variety tracking)
+	 * @return Pointer to selected pattern, or nullptr if none available
+	 */
+	const FObstaclePattern* SelectPattern(int32& OutPatternIndex);
+
+	/** True if the pattern is in the variety window */
+	bool IsPatternRecentlyUsed(int32 PatternIndex) const;
+
+	/**
+	 * Push a pattern into the variety window, evicting the oldest entries past WindowSize.
+	 *
+	 * @param PatternIndex Index of the pattern just used
+	 * @param WindowSize Number of recent patterns to keep (clamped to MaxPatternVarietyWindow)
+	 */
+	void RecordPatternUse(int32 PatternIndex, int32 WindowSize);
+
+	/** Random lane from the layout RNG */
+	ELane GetRandomLane();
+
+	/** Random obstacle type from the layout RNG (40% LowWall, 40% HighBarrier, 20% FullWall) */
+	EObstacleType GetRandomObstacleType();
+
+	/** Spawner settings, fixed for the generator's lifetime */
+	FObstacleLayoutSettings Settings;
+
+	/** Library patterns are selected from (owned by the spawner) */
+	const UObstaclePatternLibrary* PatternLibrary = nullptr;
+
+	/** RNG for layout generation, seeded from the run's ObstacleLayout stream */
+	FRandomStream LayoutRandom;
+
+	/** Difficulty of the layout being built (the plan's, not necessarily the spawner's current one) */
+	int32 LayoutDifficultyLevel = 0;
+
+	/**
+	 * Ring buffer of recently used pattern indices (for variety tracking).
+	 * Used to avoid repeating patterns when bEnablePatternVariety is true.
+	 */
+	int32 RecentPatternRing[MaxPatternVarietyWindow] = {};
+	int32 RecentPatternRingHead = 0;
+	int32 RecentPatternRingCount = 0;
+
+	/** Bit per library pattern, set while it's in RecentPatternRing */
+	TBitArray<> RecentPatternMask;
+};
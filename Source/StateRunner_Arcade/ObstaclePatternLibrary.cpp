@@ -0,0 +1,173 @@
+#include "ObstaclePatternLibrary.h"
+#include "StateRunner_Arcade.h"
+#include "UObject/ObjectSaveContext.h"
+
+void UObstaclePatternLibrary::RebuildSelectionTables()
+{
+	SelectionTables.Reset();
+
+	// One table per level up to the highest unlock; later levels reuse the last
+	int32 MaxUnlockLevel = INDEX_NONE;
+	for (const FObstaclePattern& Pattern : Patterns)
+	{
+		if (Pattern.Obstacles.Num() > 0 && Pattern.SelectionWeight > 0.0f)
+		{
+			MaxUnlockLevel = FMath::Max(MaxUnlockLevel, Pattern.MinDifficultyLevel);
+		}
+	}
+
+	if (MaxUnlockLevel == INDEX_NONE)
+	{
+		return;
+	}
+
+	SelectionTables.SetNum(MaxUnlockLevel + 1);
+
+	TArray<float> Scaled;
+	TArray<int32> Small;
+	TArray<int32> Large;
+
+	for (int32 Level = 0; Level <= MaxUnlockLevel; Level++)
+	{
+		FObstaclePatternAliasTable& Table = SelectionTables[Level];
+
+		float TotalWeight = 0.0f;
+		for (int32 i = 0; i < Patterns.Num(); i++)
+		{
+			const FObstaclePattern& Pattern = Patterns[i];
+			if (Pattern.MinDifficultyLevel <= Level && Pattern.Obstacles.Num() > 0 && Pattern.SelectionWeight > 0.0f)
+			{
+				Table.PatternIndices.Add(i);
+				TotalWeight += Pattern.SelectionWeight;
+			}
+		}
+
+		const int32 Count = Table.PatternIndices.Num();
+		if (Count == 0)
+		{
+			continue;
+		}
+
+		// Vose: scale weights so the average column is exactly 1, then pair
+		// each under-full column with an over-full one
+		Scaled.SetNumUninitialized(Count);
+		Table.Probabilities.SetNumUninitialized(Count);
+		Table.Aliases.SetNumUninitialized(Count);
+		Small.Reset();
+		Large.Reset();
+
+		for (int32 Column = 0; Column < Count; Column++)
+		{
+			Scaled[Column] = Patterns[Table.PatternIndices[Column]].SelectionWeight * Count / TotalWeight;
+			(Scaled[Column] < 1.0f ? Small : Large).Add(Column);
+		}
+
+		while (Small.Num() > 0 && Large.Num() > 0)
+		{
+			const int32 Under = Small.Pop(EAllowShrinking::No);
+			const int32 Over = Large.Pop(EAllowShrinking::No);
+
+			Table.Probabilities[Under] = Scaled[Under];
+			Table.Aliases[Under] = Over;
+
+			Scaled[Over] = (Scaled[Over] + Scaled[Under]) - 1.0f;
+			(Scaled[Over] < 1.0f ? Small : Large).Add(Over);
+		}
+
+		// Leftovers are full columns (float error can leave a few in either list)
+		for (int32 Column : Large)
+		{
+			Table.Probabilities[Column] = 1.0f;
+			Table.Aliases[Column] = Column;
+		}
+		for (int32 Column : Small)
+		{
+			Table.Probabilities[Column] = 1.0f;
+			Table.Aliases[Column] = Column;
+		}
+	}
+
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("ObstaclePatternLibrary %s: %d patterns, %d selection tables"),
+		*GetName(), Patterns.Num(), SelectionTables.Num());
+}
+
+const FObstaclePatternAliasTable* UObstaclePatternLibrary::GetSelectionTable(int32 DifficultyLevel) const
+{
+	if (SelectionTables.Num() == 0)
+	{
+		return nullptr;
+	}
+
+	const FObstaclePatternAliasTable& Table = SelectionTables[FMath::Clamp(DifficultyLevel, 0, SelectionTables.Num() - 1)];
+	return Table.Num() > 0 ? &Table : nullptr;
+}
+
+int32 UObstaclePatternLibrary::GetNumAvailable(int32 DifficultyLevel) const
+{
+	const FObstaclePatternAliasTable* Table = GetSelectionTable(DifficultyLevel);
+	return Table ? Table->Num() : 0;
+}
+
+bool UObstaclePatternLibrary::AreSelectionTablesStale() const
+{
+	bool bAnySelectable = false;
+	for (const FObstaclePattern& Pattern : Patterns)
+	{
+		if (Pattern.Obstacles.Num() > 0 && Pattern.SelectionWeight > 0.0f)
+		{
+			bAnySelectable = true;
+			break;
+		}
+	}
+
+	if (bAnySelectable != (SelectionTables.Num() > 0))
+	{
+		return true;
+	}
+
+	for (const FObstaclePatternAliasTable& Table : SelectionTables)
+	{
+		if (Table.Probabilities.Num() != Table.Num() || Table.Aliases.Num() != Table.Num())
+		{
+			return true;
+		}
+
+		for (int32 PatternIndex : Table.PatternIndices)
+		{
+			if (!Patterns.IsValidIndex(PatternIndex))
+			{
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+void UObstaclePatternLibrary::PostLoad()
+{
+	Super::PostLoad();
+
+	// Assets saved before the tables existed, or edited outside the editor
+	if (AreSelectionTablesStale())
+	{
+		RebuildSelectionTables();
+	}
+}
+
+void UObstaclePatternLibrary::PreSave(FObjectPreSaveContext SaveContext)
+{
+	Super::PreSave(SaveContext);
+
+	// Cooked builds ship with tables built here
+	RebuildSelectionTables();
+}
+
+#if WITH_EDITOR
+void UObstaclePatternLibrary::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	RebuildSelectionTables();
+}
+#endif
@@ -0,0 +1,182 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "BaseObstacle.h"
+#include "Math/RandomStream.h"
+#include "ObstaclePatternLibrary.generated.h"
+
+/**
+ * Spawn data for a single obstacle within a segment.
+ * Used by patterns and procedural generation.
+ */
+USTRUCT(BlueprintType)
+struct FObstacleSpawnData
+{
+	GENERATED_BODY()
+
+	/** Type of obstacle to spawn */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Obstacle")
+	EObstacleType ObstacleType = EObstacleType::LowWall;
+
+	/** Which lane to spawn in */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Obstacle")
+	ELane Lane = ELane::Center;
+
+	/**
+	 * X offset within segment (0.0 = segment start, 1.0 = segment end).
+	 * Actual position: SegmentStartX + (RelativeXOffset * SegmentLength)
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Obstacle", meta=(ClampMin="0.0", ClampMax="1.0"))
+	float RelativeXOffset = 0.5f;
+
+	/** Optional Z position offset (for elevated obstacles) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Obstacle")
+	float ZOffset = 0.0f;
+};
+
+/**
+ * Predefined obstacle pattern for a track segment.
+ * Stores a set of obstacles that form a fair, tested configuration.
+ */
+USTRUCT(BlueprintType)
+struct FObstaclePattern
+{
+	GENERATED_BODY()
+
+	/** Display name for debugging */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Pattern")
+	FString PatternName = TEXT("Unnamed Pattern");
+
+	/** Array of obstacles in this pattern */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Pattern")
+	TArray<FObstacleSpawnData> Obstacles;
+
+	/** Minimum difficulty level to use this pattern (0 = always available) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Pattern", meta=(ClampMin="0"))
+	int32 MinDifficultyLevel = 0;
+
+	/** Weight for random selection (higher = more likely) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Pattern", meta=(ClampMin="0.1"))
+	float SelectionWeight = 1.0f;
+};
+
+/**
+ * Walker/Vose alias table over the patterns available at one difficulty level.
+ * Sampling is one column pick plus one coin flip, independent of pattern count.
+ */
+USTRUCT()
+struct FObstaclePatternAliasTable
+{
+	GENERATED_BODY()
+
+	/** Pattern index (into UObstaclePatternLibrary::Patterns) for each column */
+	UPROPERTY()
+	TArray<int32> PatternIndices;
+
+	/** Chance of keeping the column's own pattern rather than its alias */
+	UPROPERTY()
+	TArray<float> Probabilities;
+
+	/** Column to use when the coin flip fails */
+	UPROPERTY()
+	TArray<int32> Aliases;
+
+	int32 Num() const { return PatternIndices.Num(); }
+
+	/**
+	 * Draw a pattern index with probability proportional to its SelectionWeight.
+	 *
+	 * @param Random Stream to draw from
+	 * @return Index into the library's Patterns, or INDEX_NONE if the table is empty
+	 */
+	int32 Sample(const FRandomStream& Random) const
+	{
+		if (PatternIndices.Num() == 0)
+		{
+			return INDEX_NONE;
+		}
+
+		const int32 Column = Random.RandRange(0, PatternIndices.Num() - 1);
+		return Random.FRand() < Probabilities[Column] ? PatternIndices[Column] : PatternIndices[Aliases[Column]];
+	}
+};
+
+/**
+ * Obstacle Pattern Library
+ *
+ * Cookable set of hand-authored obstacle patterns. Alongside the patterns it stores
+ * one alias table per difficulty level (level N holds every pattern with
+ * MinDifficultyLevel <= N), rebuilt whenever the asset is edited or saved, so
+ * runtime selection never filters or sums weights.
+ *
+ * Usage:
+ * 1. Create an ObstaclePatternLibrary in the Content Browser (Miscellaneous → Data Asset)
+ * 2. Author patterns
+ * 3. Assign it to the ObstacleSpawnerComponent's PatternLibrary
+ */
+UCLASS(BlueprintType)
+class STATERUNNER_ARCADE_API UObstaclePatternLibrary : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+
+	//=============================================================================
+	// PATTERNS
+	//=============================================================================
+
+	/**
+	 * Hand-authored patterns.
+	 * Patterns with no obstacles are kept in the list but never selected.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Patterns")
+	TArray<FObstaclePattern> Patterns;
+
+	//=============================================================================
+	// SELECTION TABLES
+	//=============================================================================
+
+	/**
+	 * Rebuild the per-difficulty alias tables from Patterns.
+	 * Runs automatically on edit, save and (if stale) load.
+	 */
+	void RebuildSelectionTables();
+
+	/**
+	 * Alias table for a difficulty level. Levels past the highest MinDifficultyLevel
+	 * share the last table.
+	 *
+	 * @param DifficultyLevel Current difficulty level
+	 * @return Table, or nullptr if no pattern is available yet
+	 */
+	const FObstaclePatternAliasTable* GetSelectionTable(int32 DifficultyLevel) const;
+
+	/** Number of selectable patterns at a difficulty level */
+	int32 GetNumAvailable(int32 DifficultyLevel) const;
+
+	//=============================================================================
+	// DATA ASSET OVERRIDES
+	//=============================================================================
+
+	virtual void PostLoad() override;
+	virtual void PreSave(FObjectPreSaveContext SaveContext) override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	virtual FPrimaryAssetId GetPrimaryAssetId() const override
+	{
+		return FPrimaryAssetId(TEXT("ObstaclePatternLibrary"), GetFName());
+	}
+
+protected:
+
+	/** Indexed by difficulty level, clamped to the last entry */
+	UPROPERTY(VisibleAnywhere, Category="Selection Tables")
+	TArray<FObstaclePatternAliasTable> SelectionTables;
+
+	/** True if SelectionTables no longer match Patterns */
+	bool AreSelectionTablesStale() const;
+};
@@ -1,10 +1,21 @@
 #include "ObstacleSpawnerComponent.h"
 #include "BaseObstacle.h"
 #include "StateRunner_ArcadeGameMode.h"
+#include "WorldScrollComponent.h"
 #include "GameDebugSubsystem.h"
+#include "DifficultyDirectorComponent.h"
+#include "HardwareTierSubsystem.h"
+#include "RunSeedSubsystem.h"
 #include "StateRunner_Arcade.h"
 #include "Engine/World.h"
+#include "TimerManager.h"
+#include "Components/InstancedStaticMeshComponent.h"
 #include "Engine/Engine.h"
+#include "GameFramework/GameUserSettings.h"
+#include "Algo/BinarySearch.h"
+
+/** Distance past the player the last tutorial set must be before the tutorial counts as done */
+static constexpr double ObstacleSpawner_TutorialPassedMargin = 500.0;
 
 UObstacleSpawnerComponent::UObstacleSpawnerComponent()
 {
@@ -18,6 +29,29 @@ void UObstacleSpawnerComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
+	DifficultyDirector = UDifficultyDirectorComponent::Get(this);
+
+	// Tutorial prompts are rescheduled on speed changes rather than polled every frame
+	if (AStateRunner_ArcadeGameMode* GameMode = Cast<AStateRunner_ArcadeGameMode>(GetOwner()))
+	{
+		WorldScroll = GameMode->GetWorldScrollComponent();
+	}
+	if (WorldScroll)
+	{
+		WorldScroll->OnScrollSpeedChanged.AddDynamic(this, &UObstacleSpawnerComponent::HandleScrollSpeedChanged);
+	}
+
+	// Instances only pay off while obstacles stand still (decided before the pools spawn)
+	if (bUseInstancedRendering && (!WorldScroll || WorldScroll->GetScrollMode() != EScrollMode::MoveRunner))
+	{
+		bUseInstancedRendering = false;
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("ObstacleSpawner: Instanced rendering needs MoveRunner scroll mode - using per-actor meshes"));
+	}
+
+	InitializePatternLibrary();
+	LayoutGenerator = CreateLayoutGenerator(URunSeedSubsystem::GetStreamFor(this, ERunRandomStream::ObstacleLayout).GetInitialSeed());
+	LoadPoolHistory();
+	InitializePrewarmQueue();
 	InitializePools();
 
 	// Apply blockage test settings (skip tutorial, set late-game difficulty)
@@ -28,31 +62,56 @@ void UObstacleSpawnerComponent::BeginPlay()
 
 		// Difficulty 15 is past all functional thresholds
 		SegmentsSpawned = 105;
-		CurrentDifficultyLevel = SegmentsSpawned / SegmentsPerDifficultyIncrease;
+		CurrentDifficultyLevel = DifficultyDirector->GetDifficultyForSegment(SegmentsSpawned);
 
 		UE_LOG(LogStateRunner_Arcade, Warning,
 			TEXT("Blockage test active — Tutorial: SKIPPED, Difficulty: %d, Segments: %d"),
 			CurrentDifficultyLevel, SegmentsSpawned);
 	}
 
+	// Blockage test starts at late-game difficulty, so size for it now
+	UpdatePredictivePrewarm();
+
 	// Log init summary
-	int32 TotalPoolSize = LowWallPool.Num() + HighBarrierPool.Num() + FullWallPool.Num();
+	int32 TotalPoolSize = GetTotalPooledCount();
 	if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
 	{
 		FString InitInfo = FString::Printf(
-			TEXT("Pools: %d total (LW:%d HB:%d FW:%d)\nPatterns: %d | Tutorial: %s\nDifficulty: %d-%d obs, +%d/level"),
-			TotalPoolSize, LowWallPool.Num(), HighBarrierPool.Num(), FullWallPool.Num(),
-			PredefinedPatterns.Num(), bEnableTutorial ? TEXT("ON") : TEXT("OFF"),
-			MinObstaclesPerSegment, MaxObstaclesPerSegment, ObstaclesPerDifficultyLevel
+			TEXT("Pools: %d total (LW:%d HB:%d FW:%d)%s\nPatterns: %d | Tutorial: %s\nDifficulty: %d-%d obs, %d at level 0"),
+			TotalPoolSize, GetPoolForType(EObstacleType::LowWall).Num(), GetPoolForType(EObstacleType::HighBarrier).Num(), GetPoolForType(EObstacleType::FullWall).Num(),
+			PrewarmQueue.HasWork() ? TEXT(" prewarming...") : TEXT(""),
+			GetPatternCount(), bEnableTutorial ? TEXT("ON") : TEXT("OFF"),
+			MinObstaclesPerSegment, MaxObstaclesPerSegment, DifficultyDirector->GetBaseObstacleCount(0)
 		);
 		Debug->LogInit(TEXT("ObstacleSpawner"), InitInfo);
 	}
 }
 
+void UObstacleSpawnerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// Layout tasks read the pattern library
+	FlushLayoutLookAhead();
+	SavePoolHistory();
+
+	if (UGameplaySimulationSubsystem* Timeline = UGameplaySimulationSubsystem::Get(this))
+	{
+		Timeline->ClearAllTimers(this);
+	}
+
+	if (WorldScroll)
+	{
+		WorldScroll->OnScrollSpeedChanged.RemoveDynamic(this, &UObstacleSpawnerComponent::HandleScrollSpeedChanged);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 // --- Public Functions ---
 
 void UObstacleSpawnerComponent::SpawnObstaclesForSegment(float SegmentStartX, float SegmentEndX, bool bIsTutorialSegment)
 {
+	STATERUNNER_SCOPE_CYCLE_COUNTER(SpawnObstacles);
+
 	if (bIsTutorialSegment)
 	{
 		return;
@@ -76,70 +135,32 @@ void UObstacleSpawnerComponent::SpawnObstaclesForSegment(float SegmentStartX, fl
 	UpdateDifficulty();
 
 	// Check for breather segment
-	bool bIsBreatherSegment = ShouldBeBreatherSegment();
-	float BreatherGapOffset = 0.0f;
-	
+	const bool bIsBreatherSegment = ShouldBeBreatherSegment(CurrentDifficultyLevel, SegmentsSinceEmpty);
 	if (bIsBreatherSegment)
 	{
 		SegmentsSinceEmpty = 0;
-		BreatherGapOffset = GetEffectiveBreatherGapFraction();
 	}
 
-	// Generate obstacle layout
-	TArray<FObstacleSpawnData> ObstacleLayout;
-	
-	bool bUsePattern = FMath::FRand() < PredefinedPatternChance;
-	
-	if (bUsePattern && GenerateFromPattern(ObstacleLayout))
-	{
-		// Find pattern bounds and fill gaps with extra obstacles
-		float PatternMinX = 1.0f;
-		float PatternMaxX = 0.0f;
-		for (const FObstacleSpawnData& Data : ObstacleLayout)
-		{
-			PatternMinX = FMath::Min(PatternMinX, Data.RelativeXOffset);
-			PatternMaxX = FMath::Max(PatternMaxX, Data.RelativeXOffset);
-		}
-		
-		AddFillerObstacles(ObstacleLayout, PatternMinX, PatternMaxX);
-	}
-	else
+	// Use the layout generated ahead of time, or build it now
+	FObstacleSegmentLayout Layout;
+	if (!TakeLookAheadLayout(SegmentsSpawned, Layout))
 	{
-		int32 ObstacleCount = CalculateObstacleCount();
-		GenerateProcedural(ObstacleLayout, ObstacleCount);
+		Layout = LayoutGenerator.BuildSegmentLayout(MakeSegmentPlan(SegmentsSpawned, CurrentDifficultyLevel, bIsBreatherSegment));
 	}
 
-	// Inject 3-lane FullWall blockage for fairness testing
-	if (bDebugForce3LaneBlockage)
+	if (!Layout.PatternName.IsEmpty())
 	{
-		const float BlockageX = 0.50f;
-		for (ELane Lane : { ELane::Left, ELane::Center, ELane::Right })
-		{
-			FObstacleSpawnData BlockData;
-			BlockData.Lane = Lane;
-			BlockData.ObstacleType = EObstacleType::FullWall;
-			BlockData.RelativeXOffset = BlockageX;
-			BlockData.ZOffset = 0.0f;
-			ObstacleLayout.Add(BlockData);
-		}
-
-		UE_LOG(LogStateRunner_Arcade, Warning,
-			TEXT("Injected 3-lane FullWall blockage at X=0.50 — EnsureFairLayout should remove one"));
-	}
-
-	// Make sure at least one lane is passable
-	EnsureFairLayout(ObstacleLayout);
+		LastPatternName = Layout.PatternName;
 
-	// For breather segments, shift obstacles forward to create a gap at the start
-	if (bIsBreatherSegment && BreatherGapOffset > 0.0f)
-	{
-		float CompressionFactor = 1.0f - BreatherGapOffset;
-		for (FObstacleSpawnData& Data : ObstacleLayout)
+		if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
 		{
-			Data.RelativeXOffset = BreatherGapOffset + (Data.RelativeXOffset * CompressionFactor);
+			Debug->Stat_LastPattern = Layout.PatternName;
+			Debug->RecordNamedEvent(EDebugCategory::Spawning, EDebugEventId::PatternSpawned, *Layout.PatternName);
 		}
 	}
 
+	const TArray<FObstacleSpawnData>& ObstacleLayout = Layout.Obstacles;
+
 	float ActualSegmentLength = SegmentEndX - SegmentStartX;
 
 	// Spawn all obstacles
@@ -160,7 +181,8 @@ void UObstacleSpawnerComponent::SpawnObstaclesForSegment(float SegmentStartX, fl
 		float WorldZ = ObstacleSpawnZ + SpawnData.ZOffset;
 
 		Obstacle->Activate(FVector(WorldX, WorldY, WorldZ), SpawnData.Lane, SpawnData.ObstacleType);
-		ActiveObstacles.Add(Obstacle);
+		AcquireObstacleInstance(Obstacle);
+		TrackActiveObstacle(Obstacle);
 		OnObstacleSpawned.Broadcast(Obstacle, SpawnData);
 	}
 
@@ -170,12 +192,21 @@ void UObstacleSpawnerComponent::SpawnObstaclesForSegment(float SegmentStartX, fl
 		Debug->Stat_SegmentsSpawned = SegmentsSpawned;
 		Debug->Stat_DifficultyLevel = CurrentDifficultyLevel;
 	}
+	UpdatePoolStats();
+
+	// Grow pools ahead of the next segment rather than on exhaustion
+	UpdatePredictivePrewarm();
+
+	// Start generating the next layouts while this segment scrolls in
+	RefillLayoutLookAhead();
 }
 
 void UObstacleSpawnerComponent::ClearAllObstacles()
 {
 	// Used for game reset/restart, not EMP
-	for (ABaseObstacle* Obstacle : ActiveObstacles)
+	// Deactivate() swap-removes from ActiveObstacles, so iterate a snapshot
+	const TArray<TObjectPtr<ABaseObstacle>> ObstaclesToClear = ActiveObstacles.GetArray();
+	for (ABaseObstacle* Obstacle : ObstaclesToClear)
 	{
 		if (Obstacle && Obstacle->IsActive())
 		{
@@ -184,7 +215,11 @@ void UObstacleSpawnerComponent::ClearAllObstacles()
 		}
 	}
 
-	ActiveObstacles.Empty();
+	ActiveObstacles.Reset();
+	for (TArray<TObjectPtr<ABaseObstacle>>& Lane : LaneIndex)
+	{
+		Lane.Reset();
+	}
 }
 
 int32 UObstacleSpawnerComponent::DeactivateAllActiveObstacles()
@@ -194,28 +229,21 @@ int32 UObstacleSpawnerComponent::DeactivateAllActiveObstacles()
 	const float ClearMaxX = PlayerXPosition + EMPClearRange;
 	
 	int32 DeactivatedCount = 0;
-	TArray<ABaseObstacle*> ObstaclesToCheck = ActiveObstacles;
+	TArray<ABaseObstacle*> ObstaclesToClear;
+	GetObstaclesInRange(ClearMinX, ClearMaxX, ObstaclesToClear);
 	
-	for (ABaseObstacle* Obstacle : ObstaclesToCheck)
+	for (ABaseObstacle* Obstacle : ObstaclesToClear)
 	{
 		if (Obstacle && Obstacle->IsActive())
 		{
-			const float ObstacleX = Obstacle->GetActorLocation().X;
-			if (ObstacleX >= ClearMinX && ObstacleX <= ClearMaxX)
-			{
-				Obstacle->Deactivate();
-				DeactivatedCount++;
-			}
+			Obstacle->Deactivate();
+			DeactivatedCount++;
 		}
 	}
 	
-	ActiveObstacles.RemoveAll([](ABaseObstacle* Obstacle) {
-		return !Obstacle || !Obstacle->IsActive();
-	});
-	
 	if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
 	{
-		Debug->LogEvent(EDebugCategory::Spawning, FString::Printf(TEXT("EMP cleared %d obstacles"), DeactivatedCount));
+		Debug->RecordEvent(EDebugCategory::Spawning, EDebugEventId::EMPClearedObstacles, DeactivatedCount);
 		Debug->Stat_ActiveObstacles = ActiveObstacles.Num();
 	}
 	
@@ -224,21 +252,26 @@ int32 UObstacleSpawnerComponent::DeactivateAllActiveObstacles()
 
 void UObstacleSpawnerComponent::ResetDifficulty()
 {
+	// Queued layouts were planned for the old progression
+	FlushLayoutLookAhead();
+
 	CurrentDifficultyLevel = 0;
 	SegmentsSpawned = 0;
 	SegmentsSinceEmpty = 0;
 	TutorialSegmentsSkipped = 0;
 	bHasSpawnedTutorialObstacles = false;
-	RecentlyUsedPatternIndices.Empty();
+	LayoutGenerator.ResetPatternVariety();
 	LastPatternName = TEXT("");
 }
 
 TArray<FString> UObstacleSpawnerComponent::GetAllPatternNames() const
 {
+	const TArray<FObstaclePattern>& Patterns = ActivePatternLibrary ? ActivePatternLibrary->Patterns : PredefinedPatterns;
+
 	TArray<FString> Names;
-	Names.Reserve(PredefinedPatterns.Num());
+	Names.Reserve(Patterns.Num());
 	
-	for (const FObstaclePattern& Pattern : PredefinedPatterns)
+	for (const FObstaclePattern& Pattern : Patterns)
 	{
 		Names.Add(Pattern.PatternName);
 	}
@@ -270,6 +303,7 @@ void UObstacleSpawnerComponent::SpawnTutorialObstacles()
 	}
 	TutorialObstacles.Empty();
 	ShownTutorialPrompts.Empty();
+	TutorialSetDistances.Reset();
 
 	// Push tutorial obstacles forward to leave room for the intro pickup segment
 	const float IntroOffset = GetIntroSegmentOffset();
@@ -280,14 +314,17 @@ void UObstacleSpawnerComponent::SpawnTutorialObstacles()
 
 	if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
 	{
-		Debug->LogEvent(EDebugCategory::Spawning, FString::Printf(
-			TEXT("Tutorial obstacles spawned with intro offset: %.0f units (%.1fs at %.0f u/s)"),
-			IntroOffset, IntroSegmentDuration, BaseScrollSpeed));
+		Debug->RecordEvent(EDebugCategory::Spawning, EDebugEventId::TutorialObstaclesSpawned, IntroOffset, IntroSegmentDuration, BaseScrollSpeed);
 	}
+
+	// Schedule the first prompt
+	CheckTutorialPrompts();
 }
 
 void UObstacleSpawnerComponent::SpawnTutorialObstacleSet(float WorldX, ETutorialObstacleType TutorialType)
 {
+	const int32 NumTutorialObstacles = TutorialObstacles.Num();
+
 	switch (TutorialType)
 	{
 		case ETutorialObstacleType::LaneSwitch:
@@ -296,8 +333,9 @@ void UObstacleSpawnerComponent::SpawnTutorialObstacleSet(float WorldX, ETutorial
 			if (Obstacle)
 			{
 				Obstacle->Activate(FVector(WorldX, CenterLaneY, ObstacleSpawnZ), ELane::Center, EObstacleType::FullWall);
+				AcquireObstacleInstance(Obstacle);
 				TutorialObstacles.Add(Obstacle);
-				ActiveObstacles.Add(Obstacle);
+				TrackActiveObstacle(Obstacle);
 			}
 			break;
 		}
@@ -310,8 +348,9 @@ void UObstacleSpawnerComponent::SpawnTutorialObstacleSet(float WorldX, ETutorial
 				if (Obstacle)
 				{
 					Obstacle->Activate(FVector(WorldX, GetLaneYPosition(Lane), ObstacleSpawnZ), Lane, EObstacleType::LowWall);
+					AcquireObstacleInstance(Obstacle);
 					TutorialObstacles.Add(Obstacle);
-					ActiveObstacles.Add(Obstacle);
+					TrackActiveObstacle(Obstacle);
 				}
 			}
 			break;
@@ -328,117 +367,114 @@ void UObstacleSpawnerComponent::SpawnTutorialObstacleSet(float WorldX, ETutorial
 					float LaneY = GetLaneYPosition(Lane);
 					FVector SpawnLocation(WorldX, LaneY, ObstacleSpawnZ);
 					Obstacle->Activate(SpawnLocation, Lane, EObstacleType::HighBarrier);
+					AcquireObstacleInstance(Obstacle);
 					TutorialObstacles.Add(Obstacle);
-					ActiveObstacles.Add(Obstacle);
+					TrackActiveObstacle(Obstacle);
 				}
 			}
 			break;
 		}
 	}
+
+	// Run distance at which the set reaches the player (WorldX is track space, like PlayerXPosition)
+	if (TutorialObstacles.Num() > NumTutorialObstacles)
+	{
+		const double ScrolledAtSpawn = WorldScroll ? WorldScroll->GetPresentedScrollDistance() : 0.0;
+		TutorialSetDistances.Emplace(TutorialType, ScrolledAtSpawn + (WorldX - PlayerXPosition));
+	}
 }
 
-void UObstacleSpawnerComponent::CheckTutorialPrompts(float CurrentScrollSpeed, float PlayerX)
+void UObstacleSpawnerComponent::CheckTutorialPrompts()
 {
-	if (!bEnableTutorial || bTutorialComplete || CurrentScrollSpeed <= 0.0f)
+	UGameplaySimulationSubsystem* Timeline = UGameplaySimulationSubsystem::Get(this);
+	if (Timeline)
+	{
+		Timeline->ClearTimer(TutorialPromptTimer);
+	}
+
+	if (!bEnableTutorial || bTutorialComplete || !WorldScroll || TutorialSetDistances.Num() == 0)
 	{
 		return;
 	}
 
-	// How far ahead to look based on lead time
-	float PromptDistance = CurrentScrollSpeed * TutorialPromptLeadTime;
+	const double Scrolled = WorldScroll->GetPresentedScrollDistance();
+	const float ScrollSpeed = WorldScroll->GetCurrentScrollSpeed();
 
-	// Obstacle 1: Lane Switch (FullWall, center)
-	if (!ShownTutorialPrompts.Contains(ETutorialObstacleType::LaneSwitch))
+	// How far ahead to prompt based on lead time
+	const double PromptDistance = ScrollSpeed * TutorialPromptLeadTime;
+
+	// Fire every prompt that's due, and find how much further until the next event
+	double DistanceToNextEvent = MAX_dbl;
+	double LastSetDistance = -MAX_dbl;
+	for (const TPair<ETutorialObstacleType, double>& Set : TutorialSetDistances)
 	{
-		for (ABaseObstacle* Obstacle : TutorialObstacles)
+		LastSetDistance = FMath::Max(LastSetDistance, Set.Value);
+		if (ShownTutorialPrompts.Contains(Set.Key))
 		{
-			if (Obstacle && Obstacle->IsActive())
-			{
-				float ObstacleX = Obstacle->GetActorLocation().X;
-				if (Obstacle->GetObstacleType() == EObstacleType::FullWall && 
-				    Obstacle->GetCurrentLane() == ELane::Center)
-				{
-					float DistanceToPlayer = ObstacleX - PlayerX;
-					if (DistanceToPlayer <= PromptDistance && DistanceToPlayer > 0)
-					{
-						ShownTutorialPrompts.Add(ETutorialObstacleType::LaneSwitch);
-						OnTutorialPrompt.Broadcast(ETutorialObstacleType::LaneSwitch);
-						break;
-					}
-				}
-			}
+			continue;
 		}
-	}
 
-	// Obstacle 2: Jump (LowWall)
-	if (!ShownTutorialPrompts.Contains(ETutorialObstacleType::Jump))
-	{
-		for (ABaseObstacle* Obstacle : TutorialObstacles)
+		const double DistanceToPlayer = Set.Value - Scrolled;
+		if (DistanceToPlayer > PromptDistance)
 		{
-			if (Obstacle && Obstacle->IsActive() && 
-			    Obstacle->GetObstacleType() == EObstacleType::LowWall)
-			{
-				float ObstacleX = Obstacle->GetActorLocation().X;
-				float DistanceToPlayer = ObstacleX - PlayerX;
-				if (DistanceToPlayer <= PromptDistance && DistanceToPlayer > 0)
-				{
-					ShownTutorialPrompts.Add(ETutorialObstacleType::Jump);
-					OnTutorialPrompt.Broadcast(ETutorialObstacleType::Jump);
-					break;
-				}
-			}
+			DistanceToNextEvent = FMath::Min(DistanceToNextEvent, DistanceToPlayer - PromptDistance);
+			continue;
 		}
-	}
 
-	// Obstacle 3: Slide (HighBarrier)
-	if (!ShownTutorialPrompts.Contains(ETutorialObstacleType::Slide))
-	{
-		for (ABaseObstacle* Obstacle : TutorialObstacles)
+		// A set already passed (or cleared by an EMP) is done without a prompt
+		ShownTutorialPrompts.Add(Set.Key);
+		if (DistanceToPlayer > 0.0 && IsTutorialSetActive(Set.Key))
 		{
-			if (Obstacle && Obstacle->IsActive() && 
-			    Obstacle->GetObstacleType() == EObstacleType::HighBarrier)
-			{
-				float ObstacleX = Obstacle->GetActorLocation().X;
-				float DistanceToPlayer = ObstacleX - PlayerX;
-				if (DistanceToPlayer <= PromptDistance && DistanceToPlayer > 0)
-				{
-					ShownTutorialPrompts.Add(ETutorialObstacleType::Slide);
-					OnTutorialPrompt.Broadcast(ETutorialObstacleType::Slide);
-					break;
-				}
-			}
+			OnTutorialPrompt.Broadcast(Set.Key);
 		}
 	}
 
-	// Check if all tutorial obstacles have been passed
-	if (ShownTutorialPrompts.Num() >= 3)
+	// Every set prompted: the tutorial ends once the last one is behind the player
+	if (ShownTutorialPrompts.Num() >= TutorialSetDistances.Num())
 	{
-		bool bAllPassed = true;
-		int32 ActiveTutorialCount = 0;
-		int32 PassedTutorialCount = 0;
-		
-		for (ABaseObstacle* Obstacle : TutorialObstacles)
-		{
-			if (Obstacle && Obstacle->IsActive())
-			{
-				ActiveTutorialCount++;
-				float ObstacleX = Obstacle->GetActorLocation().X;
-				if (ObstacleX > PlayerX - 500.0f)
-				{
-					bAllPassed = false;
-				}
-				else
-				{
-					PassedTutorialCount++;
-				}
-			}
-		}
-
-		if (bAllPassed)
+		const double DistanceToEnd = LastSetDistance + ObstacleSpawner_TutorialPassedMargin - Scrolled;
+		if (DistanceToEnd <= 0.0)
 		{
+			UE_LOG(LogStateRunner_Arcade, Log, TEXT("ObstacleSpawner: Tutorial complete (%d sets passed)"), TutorialSetDistances.Num());
 			CompleteTutorial();
+			return;
 		}
+		DistanceToNextEvent = FMath::Min(DistanceToNextEvent, DistanceToEnd);
 	}
+
+	// Not scrolling: the next speed change reschedules
+	if (!Timeline || ScrollSpeed <= 0.0f || DistanceToNextEvent == MAX_dbl)
+	{
+		return;
+	}
+
+	// Small pad so float rounding lands past the trigger; a miss (speed drifted) just reschedules
+	Timeline->SetTimer(TutorialPromptTimer, this, [this]() { CheckTutorialPrompts(); },
+		static_cast<float>(DistanceToNextEvent / ScrollSpeed) + 0.001f);
+}
+
+void UObstacleSpawnerComponent::HandleScrollSpeedChanged(float NewScrollSpeed)
+{
+	if (bEnableTutorial && !bTutorialComplete && TutorialSetDistances.Num() > 0)
+	{
+		CheckTutorialPrompts();
+	}
+}
+
+bool UObstacleSpawnerComponent::IsTutorialSetActive(ETutorialObstacleType TutorialType) const
+{
+	EObstacleType ObstacleType = EObstacleType::FullWall;
+	switch (TutorialType)
+	{
+		case ETutorialObstacleType::LaneSwitch: ObstacleType = EObstacleType::FullWall; break;
+		case ETutorialObstacleType::Jump:       ObstacleType = EObstacleType::LowWall; break;
+		case ETutorialObstacleType::Slide:      ObstacleType = EObstacleType::HighBarrier; break;
+	}
+
+	return TutorialObstacles.ContainsByPredicate([ObstacleType](const ABaseObstacle* Obstacle)
+	{
+		return Obstacle && Obstacle->IsActive() && Obstacle->GetObstacleType() == ObstacleType;
+	});
 }
 
 void UObstacleSpawnerComponent::CompleteTutorial()
@@ -450,14 +486,25 @@ void UObstacleSpawnerComponent::CompleteTutorial()
 
 	bTutorialComplete = true;
 	OnTutorialComplete.Broadcast();
+
+	// Procedural segments start next -- have their layouts ready
+	RefillLayoutLookAhead();
 }
 
 void UObstacleSpawnerComponent::ResetTutorial()
 {
+	FlushLayoutLookAhead();
+
 	bTutorialComplete = false;
 	bHasSpawnedTutorialObstacles = false;
 	TutorialSegmentsSkipped = 0;
 	ShownTutorialPrompts.Empty();
+	TutorialSetDistances.Reset();
+
+	if (UGameplaySimulationSubsystem* Timeline = UGameplaySimulationSubsystem::Get(this))
+	{
+		Timeline->ClearTimer(TutorialPromptTimer);
+	}
 	
 	for (ABaseObstacle* Obstacle : TutorialObstacles)
 	{
@@ -469,566 +516,332 @@ void UObstacleSpawnerComponent::ResetTutorial()
 	TutorialObstacles.Empty();
 }
 
-// --- Pattern Functions ---
+// --- Layout Generation ---
 
-bool UObstacleSpawnerComponent::GenerateFromPattern(TArray<FObstacleSpawnData>& OutObstacles)
+FObstacleLayoutGenerator UObstacleSpawnerComponent::CreateLayoutGenerator(int32 Seed)
 {
-	int32 PatternIndex = INDEX_NONE;
-	const FObstaclePattern* SelectedPattern = SelectPattern(PatternIndex);
-	
-	if (!SelectedPattern || SelectedPattern->Obstacles.Num() == 0)
-	{
-		return false;
-	}
-
-	OutObstacles = SelectedPattern->Obstacles;
-
-	// Track pattern usage for variety
-	if (bEnablePatternVariety && PatternIndex != INDEX_NONE)
-	{
-		RecentlyUsedPatternIndices.Add(PatternIndex);
-		
-		int32 VarietyCount = MinPatternVarietyCount;
-		if (VarietyCount == 0)
-		{
-			int32 AvailableCount = 0;
-			for (const FObstaclePattern& Pattern : PredefinedPatterns)
-			{
-				if (Pattern.MinDifficultyLevel <= CurrentDifficultyLevel && Pattern.Obstacles.Num() > 0)
-				{
-					AvailableCount++;
-				}
-			}
-			VarietyCount = FMath::Max(1, AvailableCount - 1);
-		}
-		
-		while (RecentlyUsedPatternIndices.Num() > VarietyCount)
-		{
-			RecentlyUsedPatternIndices.RemoveAt(0);
-		}
-	}
+	// Headless callers never ran BeginPlay
+	if (!ActivePatternLibrary)
+	{
+		InitializePatternLibrary();
+	}
+
+	FObstacleLayoutSettings Settings;
+	Settings.PredefinedPatternChance = PredefinedPatternChance;
+	Settings.bEnablePatternVariety = bEnablePatternVariety;
+	Settings.MinPatternVarietyCount = MinPatternVarietyCount;
+	Settings.MinObstaclesPerSegment = MinObstaclesPerSegment;
+	Settings.MaxObstaclesPerSegment = MaxObstaclesPerSegment;
+	Settings.FillerObstacleCount = FillerObstacleCount;
+	Settings.FillerPerDifficulty = FillerPerDifficulty;
+	Settings.DifficultyToDisableBreathers = DifficultyToDisableBreathers;
+	Settings.MinSpawnOffset = MinSpawnOffset;
+	Settings.MaxSpawnOffset = MaxSpawnOffset;
+	Settings.MinObstacleSpacing = MinObstacleSpacing;
+	Settings.SlideToJumpExtraSpacing = SlideToJumpExtraSpacing;
+	Settings.JumpToSlideExtraSpacing = JumpToSlideExtraSpacing;
+	Settings.bEnableTypeAwareSpacing = bEnableTypeAwareSpacing;
+	Settings.bDebugForce3LaneBlockage = bDebugForce3LaneBlockage;
+
+	return FObstacleLayoutGenerator(Settings, ActivePatternLibrary, Seed);
+}
 
-	LastPatternName = SelectedPattern->PatternName;
+FObstacleSegmentPlan UObstacleSpawnerComponent::MakeSegmentPlan(int32 SegmentNumber, int32 DifficultyLevel, bool bIsBreather) const
+{
+	FObstacleSegmentPlan Plan;
+	Plan.SegmentNumber = SegmentNumber;
+	Plan.DifficultyLevel = DifficultyLevel;
+	Plan.bIsBreather = bIsBreather;
 
-	if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
-	{
-		Debug->Stat_LastPattern = SelectedPattern->PatternName;
-		Debug->LogEvent(EDebugCategory::Spawning, FString::Printf(TEXT("Pattern: %s"), *SelectedPattern->PatternName));
-	}
+	// Read here so layout generation never touches the director
+	Plan.BaseObstacleCount = DifficultyDirector->GetBaseObstacleCount(DifficultyLevel);
+	Plan.BreatherGapFraction = DifficultyDirector->GetBreatherGapFraction(DifficultyLevel);
 
-	return true;
+	return Plan;
 }
 
-void UObstacleSpawnerComponent::GenerateProcedural(TArray<FObstacleSpawnData>& OutObstacles, int32 ObstacleCount)
+FObstacleSegmentPlan UObstacleSpawnerComponent::PlanNextSegment()
 {
-	OutObstacles.Reserve(ObstacleCount);
+	// Same progression SpawnObstaclesForSegment applies when the segment is consumed
+	PlannedSegmentsSpawned++;
+	PlannedSegmentsSinceEmpty++;
 
-	// Even distribution across the segment with a bit of jitter.
-	// Difficulty ramps by adding more obstacles, not by tightening spacing.
-	const float MinXSpacing = MinObstacleSpacing;
-	
-	float SpawnRange = MaxSpawnOffset - MinSpawnOffset;
-	
-	// Space obstacles evenly with gaps at start and end
-	float EvenSpacing = SpawnRange / (ObstacleCount + 1);
-	
-	// Cap count if spacing gets too tight
-	if (EvenSpacing < MinXSpacing)
-	{
-		int32 MaxObstaclesThatFit = FMath::FloorToInt(SpawnRange / MinXSpacing);
-		ObstacleCount = FMath::Max(1, MaxObstaclesThatFit);
-		EvenSpacing = SpawnRange / (ObstacleCount + 1);
-	}
-	
-	// Track positions per lane to avoid same-lane stacking
-	TMap<ELane, TArray<float>> UsedXOffsetsPerLane;
-	UsedXOffsetsPerLane.Add(ELane::Left, TArray<float>());
-	UsedXOffsetsPerLane.Add(ELane::Center, TArray<float>());
-	UsedXOffsetsPerLane.Add(ELane::Right, TArray<float>());
+	const int32 DifficultyLevel = DifficultyDirector->GetDifficultyForSegment(PlannedSegmentsSpawned);
+	const bool bIsBreather = ShouldBeBreatherSegment(DifficultyLevel, PlannedSegmentsSinceEmpty);
 
-	for (int32 i = 0; i < ObstacleCount; i++)
+	if (bIsBreather)
 	{
-		FObstacleSpawnData SpawnData;
-
-		SpawnData.ObstacleType = GetRandomObstacleType();
-		SpawnData.Lane = GetRandomLane();
-
-		// Even base position + small jitter for variety
-		float BaseOffset = MinSpawnOffset + (EvenSpacing * (i + 1));
-		float Jitter = FMath::FRandRange(-EvenSpacing * 0.20f, EvenSpacing * 0.20f);
-		float XOffset = FMath::Clamp(BaseOffset + Jitter, MinSpawnOffset, MaxSpawnOffset);
-		
-		// Resolve same-lane conflicts
-		TArray<float>& LaneUsedOffsets = UsedXOffsetsPerLane[SpawnData.Lane];
-		int32 Attempts = 0;
-		const int32 MaxAttempts = 10;
-		
-		while (Attempts < MaxAttempts && LaneUsedOffsets.ContainsByPredicate(
-			[XOffset, MinXSpacing](float Used) { return FMath::Abs(Used - XOffset) < MinXSpacing; }))
-		{
-			// Try a different lane
-			SpawnData.Lane = GetRandomLane();
-			TArray<float>& NewLaneOffsets = UsedXOffsetsPerLane[SpawnData.Lane];
-			
-			if (!NewLaneOffsets.ContainsByPredicate(
-				[XOffset, MinXSpacing](float Used) { return FMath::Abs(Used - XOffset) < MinXSpacing; }))
-			{
-				break;
-			}
-			Attempts++;
-		}
-
-		SpawnData.RelativeXOffset = XOffset;
-		UsedXOffsetsPerLane[SpawnData.Lane].Add(XOffset);
-		SpawnData.ZOffset = 0.0f;
-
-		OutObstacles.Add(SpawnData);
+		PlannedSegmentsSinceEmpty = 0;
 	}
+
+	return MakeSegmentPlan(PlannedSegmentsSpawned, DifficultyLevel, bIsBreather);
 }
 
-int32 UObstacleSpawnerComponent::CalculateObstacleCount() const
+/** Look-ahead task body: build one layout from a copy of the generator state before it */
+static FObstacleLayoutStep ObstacleSpawner_BuildLayoutStep(const FObstacleLayoutGenerator& Before, const FObstacleSegmentPlan& Plan, double QueuedSeconds)
 {
-	// Ramps with difficulty, capped at max
-	int32 BaseCount = MinObstaclesPerSegment + (CurrentDifficultyLevel * ObstaclesPerDifficultyLevel);
-	int32 RandomVariance = FMath::RandRange(-1, 1);
-	int32 FinalCount = FMath::Clamp(BaseCount + RandomVariance, MinObstaclesPerSegment, MaxObstaclesPerSegment);
-
-	return FinalCount;
+	FObstacleLayoutStep Step;
+	Step.Generator = Before;
+	Step.Layout = Step.Generator.BuildSegmentLayout(Plan);
+	Step.Layout.LatencySeconds = static_cast<float>(FPlatformTime::Seconds() - QueuedSeconds);
+	return Step;
 }
 
-void UObstacleSpawnerComponent::EnsureFairLayout(TArray<FObstacleSpawnData>& Obstacles)
+void UObstacleSpawnerComponent::RefillLayoutLookAhead()
 {
-	if (Obstacles.Num() < 3)
+	if (!bAsyncLayoutGeneration || (bEnableTutorial && !bTutorialComplete))
 	{
-		if (bEnableTypeAwareSpacing)
-		{
-			FixTypeSpacingViolations(Obstacles);
-		}
 		return;
 	}
 
-	// Sort by X for consistent processing
-	Obstacles.Sort([](const FObstacleSpawnData& A, const FObstacleSpawnData& B)
+	if (PendingLayouts.Num() == 0)
 	{
-		return A.RelativeXOffset < B.RelativeXOffset;
-	});
-
-	// --- Pass 1: Remove impassable FullWall clusters ---
-	//
-	// A FullWall blocks a lane completely. If FullWalls cover all 3 lanes
-	// within close proximity, the player can't pass without taking a hit.
-	//
-	// We use BFS to find connected components: two FullWalls are "connected"
-	// if they're within RowThreshold X distance (transitively). This catches
-	// chained clusters the old fixed-anchor approach missed.
-
-	const float RowThreshold = 0.12f; // ~750 units at 6250 segment length
-
-	TArray<int32> IndicesToRemove;
-
-	// Collect all FullWall indices
-	TArray<int32> FullWallIndices;
-	for (int32 i = 0; i < Obstacles.Num(); i++)
-	{
-		if (Obstacles[i].ObstacleType == EObstacleType::FullWall)
-		{
-			FullWallIndices.Add(i);
-		}
+		PlannedSegmentsSpawned = SegmentsSpawned;
+		PlannedSegmentsSinceEmpty = SegmentsSinceEmpty;
 	}
 
-	// BFS to find connected FullWall clusters
-	TSet<int32> Visited;
-
-	for (int32 StartIdx : FullWallIndices)
+	while (PendingLayouts.Num() < LayoutLookAheadSegments)
 	{
-		if (Visited.Contains(StartIdx))
-		{
-			continue;
-		}
+		const FObstacleSegmentPlan Plan = PlanNextSegment();
+		const double QueuedSeconds = FPlatformTime::Seconds();
 
-		TArray<int32> Cluster;
-		TArray<int32> Queue;
-		Queue.Add(StartIdx);
-
-		while (Queue.Num() > 0)
+		// Each task starts from the generator its predecessor finished with (the first from
+		// LayoutGenerator), so the layouts match building them one by one on the game thread
+		if (PendingLayouts.Num() > 0)
 		{
-			int32 Current = Queue[0];
-			Queue.RemoveAt(0);
-
-			if (Visited.Contains(Current))
-			{
-				continue;
-			}
-			Visited.Add(Current);
-			Cluster.Add(Current);
-
-			for (int32 OtherIdx : FullWallIndices)
+			UE::Tasks::TTask<FObstacleLayoutStep> Previous = PendingLayouts.Last();
+			PendingLayouts.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION, [Previous, Plan, QueuedSeconds]() mutable
 			{
-				if (!Visited.Contains(OtherIdx))
-				{
-					float XDiff = FMath::Abs(Obstacles[OtherIdx].RelativeXOffset - Obstacles[Current].RelativeXOffset);
-					if (XDiff <= RowThreshold)
-					{
-						Queue.Add(OtherIdx);
-					}
-				}
-			}
+				return ObstacleSpawner_BuildLayoutStep(Previous.GetResult().Generator, Plan, QueuedSeconds);
+			}, UE::Tasks::Prerequisites(Previous)));
 		}
-
-		// Check if this cluster covers all 3 lanes
-		bool bHasLeft = false;
-		bool bHasCenter = false;
-		bool bHasRight = false;
-
-		for (int32 Idx : Cluster)
+		else
 		{
-			switch (Obstacles[Idx].Lane)
+			PendingLayouts.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION, [Generator = LayoutGenerator, Plan, QueuedSeconds]()
 			{
-				case ELane::Left:   bHasLeft = true; break;
-				case ELane::Center: bHasCenter = true; break;
-				case ELane::Right:  bHasRight = true; break;
-			}
-		}
-
-		if (bHasLeft && bHasCenter && bHasRight)
-		{
-			// All 3 lanes blocked -- remove one to open a path
-			int32 RemoveIdx = Cluster[FMath::RandRange(0, Cluster.Num() - 1)];
-			IndicesToRemove.AddUnique(RemoveIdx);
-
-			UE_LOG(LogStateRunner_Arcade, Warning,
-				TEXT("EnsureFairLayout: FullWall cluster blocks ALL 3 lanes! Removing %s lane FullWall at X=%.2f (cluster size: %d)"),
-				Obstacles[RemoveIdx].Lane == ELane::Left ? TEXT("Left") :
-					(Obstacles[RemoveIdx].Lane == ELane::Center ? TEXT("Center") : TEXT("Right")),
-				Obstacles[RemoveIdx].RelativeXOffset,
-				Cluster.Num());
+				return ObstacleSpawner_BuildLayoutStep(Generator, Plan, QueuedSeconds);
+			}));
 		}
 	}
+}
 
-	// Remove in reverse order to preserve indices
-	IndicesToRemove.Sort([](int32 A, int32 B) { return A > B; });
-	for (int32 Idx : IndicesToRemove)
-	{
-		Obstacles.RemoveAt(Idx);
-	}
-
-	// --- Pass 2: Type-aware spacing (prevents unfair sequences) ---
-	if (bEnableTypeAwareSpacing)
+void UObstacleSpawnerComponent::FlushLayoutLookAhead()
+{
+	for (UE::Tasks::TTask<FObstacleLayoutStep>& Task : PendingLayouts)
 	{
-		FixTypeSpacingViolations(Obstacles);
+		Task.Wait();
 	}
+	PendingLayouts.Reset();
 }
 
-float UObstacleSpawnerComponent::GetRequiredSpacingForTypes(EObstacleType FirstType, EObstacleType SecondType) const
+bool UObstacleSpawnerComponent::TakeLookAheadLayout(int32 SegmentNumber, FObstacleSegmentLayout& OutLayout)
 {
-	float RequiredSpacing = MinObstacleSpacing;
-	
-	// Slide then jump: player is in slide animation and can't immediately jump
-	if (FirstType == EObstacleType::HighBarrier && SecondType == EObstacleType::LowWall)
+	if (PendingLayouts.Num() == 0)
 	{
-		RequiredSpacing += SlideToJumpExtraSpacing;
+		return false;
 	}
-	// Jump then slide: player needs time to land and initiate slide
-	else if (FirstType == EObstacleType::LowWall && SecondType == EObstacleType::HighBarrier)
+
+	// Normally already finished -- blocks only if generation fell a full segment behind
+	FObstacleLayoutStep& Ready = PendingLayouts[0].GetResult();
+	if (Ready.Layout.Plan.SegmentNumber != SegmentNumber)
 	{
-		RequiredSpacing += JumpToSlideExtraSpacing;
+		// The queued layouts drew from copies, so LayoutGenerator is still as of the last
+		// consumed segment and the rebuilt layout is the one a run without look-ahead gets
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("Layout look-ahead out of step (have %d, need %d) - regenerating"),
+			Ready.Layout.Plan.SegmentNumber, SegmentNumber);
+		FlushLayoutLookAhead();
+		return false;
 	}
-	
-	return RequiredSpacing;
+
+	// Segment managers size their look-ahead from this
+	LayoutLatencySeconds = LayoutLatencySeconds > 0.0f ? FMath::Lerp(LayoutLatencySeconds, Ready.Layout.LatencySeconds, 0.1f) : Ready.Layout.LatencySeconds;
+
+	// Copied, not moved: the next task may still be copying it
+	LayoutGenerator = Ready.Generator;
+	OutLayout = MoveTemp(Ready.Layout);
+	PendingLayouts.RemoveAt(0);
+	return true;
 }
 
-void UObstacleSpawnerComponent::FindTypeSpacingViolations(const TArray<FObstacleSpawnData>& Obstacles, TArray<TPair<int32, int32>>& OutViolations) const
+// --- Pattern Functions ---
+
+void UObstacleSpawnerComponent::InitializePatternLibrary()
 {
-	OutViolations.Empty();
-	
-	// Check same-lane pairs for type-combo spacing issues
-	for (int32 i = 0; i < Obstacles.Num(); i++)
+	ActivePatternLibrary = PatternLibrary;
+
+	// No cooked library -- build a transient one from the inline patterns
+	if (!ActivePatternLibrary)
 	{
-		for (int32 j = i + 1; j < Obstacles.Num(); j++)
-		{
-			if (Obstacles[i].Lane != Obstacles[j].Lane)
-			{
-				continue;
-			}
-			
-			int32 FirstIdx = (Obstacles[i].RelativeXOffset <= Obstacles[j].RelativeXOffset) ? i : j;
-			int32 SecondIdx = (FirstIdx == i) ? j : i;
-			
-			const FObstacleSpawnData& First = Obstacles[FirstIdx];
-			const FObstacleSpawnData& Second = Obstacles[SecondIdx];
-			
-			float RequiredSpacing = GetRequiredSpacingForTypes(First.ObstacleType, Second.ObstacleType);
-			float ActualSpacing = Second.RelativeXOffset - First.RelativeXOffset;
-			
-			if (ActualSpacing < RequiredSpacing)
-			{
-				OutViolations.Add(TPair<int32, int32>(FirstIdx, SecondIdx));
-			}
-		}
+		ActivePatternLibrary = NewObject<UObstaclePatternLibrary>(this, TEXT("InlinePatternLibrary"), RF_Transient);
+		ActivePatternLibrary->Patterns = PredefinedPatterns;
+		ActivePatternLibrary->RebuildSelectionTables();
 	}
 }
 
-void UObstacleSpawnerComponent::FixTypeSpacingViolations(TArray<FObstacleSpawnData>& Obstacles)
+// --- Pooling Functions ---
+
+void UObstacleSpawnerComponent::InitializePools()
 {
-	TArray<TPair<int32, int32>> Violations;
-	FindTypeSpacingViolations(Obstacles, Violations);
-	
-	if (Violations.Num() == 0)
+	if (!LowWallClass)
 	{
-		return;
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("ObstacleSpawnerComponent: No LowWallClass set! Assign BP_JumpHurdle."));
 	}
-	
-	TSet<int32> ModifiedIndices;
-	TArray<int32> IndicesToRemove;
-	
-	for (const TPair<int32, int32>& Violation : Violations)
+	if (!HighBarrierClass)
 	{
-		int32 FirstIdx = Violation.Key;
-		int32 SecondIdx = Violation.Value;
-		
-		if (ModifiedIndices.Contains(FirstIdx) || ModifiedIndices.Contains(SecondIdx) ||
-			IndicesToRemove.Contains(FirstIdx) || IndicesToRemove.Contains(SecondIdx))
-		{
-			continue;
-		}
-		
-		FObstacleSpawnData& First = Obstacles[FirstIdx];
-		FObstacleSpawnData& Second = Obstacles[SecondIdx];
-		
-		float RequiredSpacing = GetRequiredSpacingForTypes(First.ObstacleType, Second.ObstacleType);
-		float ActualSpacing = Second.RelativeXOffset - First.RelativeXOffset;
-		float SpacingDeficit = RequiredSpacing - ActualSpacing;
-		
-		// Try pushing the second obstacle forward
-		float NewSecondX = Second.RelativeXOffset + SpacingDeficit + 0.02f;
-		
-		if (NewSecondX <= MaxSpawnOffset)
-		{
-			Second.RelativeXOffset = NewSecondX;
-			ModifiedIndices.Add(SecondIdx);
-			continue;
-		}
-		
-		// Try pulling the first obstacle backward
-		float NewFirstX = First.RelativeXOffset - SpacingDeficit - 0.02f;
-		
-		if (NewFirstX >= MinSpawnOffset)
-		{
-			First.RelativeXOffset = NewFirstX;
-			ModifiedIndices.Add(FirstIdx);
-			continue;
-		}
-		
-		// Change the second obstacle's type to break the bad combo
-		// slide->jump becomes slide->slide, jump->slide becomes jump->jump
-		if (First.ObstacleType == EObstacleType::HighBarrier && Second.ObstacleType == EObstacleType::LowWall)
-		{
-			Second.ObstacleType = EObstacleType::HighBarrier;
-			ModifiedIndices.Add(SecondIdx);
-			continue;
-		}
-		else if (First.ObstacleType == EObstacleType::LowWall && Second.ObstacleType == EObstacleType::HighBarrier)
-		{
-			Second.ObstacleType = EObstacleType::LowWall;
-			ModifiedIndices.Add(SecondIdx);
-			continue;
-		}
-		
-		// Last resort: remove the second obstacle
-		IndicesToRemove.AddUnique(SecondIdx);
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("ObstacleSpawnerComponent: No HighBarrierClass set! Assign BP_SlideHurdle."));
 	}
-	
-	if (IndicesToRemove.Num() > 0)
+	if (!FullWallClass)
 	{
-		IndicesToRemove.Sort([](int32 A, int32 B) { return A > B; });
-		for (int32 Idx : IndicesToRemove)
-		{
-			Obstacles.RemoveAt(Idx);
-		}
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("ObstacleSpawnerComponent: No FullWallClass set! Assign BP_SlabObstacle."));
 	}
-}
-
-const FObstaclePattern* UObstacleSpawnerComponent::SelectPattern(int32& OutPatternIndex)
-{
-	struct FPatternCandidate
-	{
-		const FObstaclePattern* Pattern;
-		int32 Index;
-		float Weight;
-	};
-	
-	TArray<FPatternCandidate> ValidPatterns;
-	float TotalWeight = 0.0f;
 
-	for (int32 i = 0; i < PredefinedPatterns.Num(); i++)
+	// Tier budget for this run (0 = uncapped); a tier change in the menu applies from the next run
+	if (const UHardwareTierSubsystem* HardwareTier = UHardwareTierSubsystem::Get(this))
 	{
-		const FObstaclePattern& Pattern = PredefinedPatterns[i];
-		
-		if (Pattern.MinDifficultyLevel <= CurrentDifficultyLevel && Pattern.Obstacles.Num() > 0)
-		{
-			bool bRecentlyUsed = bEnablePatternVariety && RecentlyUsedPatternIndices.Contains(i);
-			
-			if (!bRecentlyUsed)
-			{
-				FPatternCandidate Candidate;
-				Candidate.Pattern = &Pattern;
-				Candidate.Index = i;
-				Candidate.Weight = Pattern.SelectionWeight;
-				
-				ValidPatterns.Add(Candidate);
-				TotalWeight += Pattern.SelectionWeight;
-			}
-		}
+		PoolSizeCap = HardwareTier->GetProfile().MaxObstaclePoolSize;
+		MeshVariantCap = HardwareTier->GetProfile().MaxMeshVariants;
 	}
 
-	// If variety system filtered everything, reset and try again
-	if (ValidPatterns.Num() == 0)
+	for (EObstacleType Type : AllObstacleTypes)
 	{
-		UObstacleSpawnerComponent* MutableThis = const_cast<UObstacleSpawnerComponent*>(this);
-		MutableThis->RecentlyUsedPatternIndices.Empty();
-		
-		for (int32 i = 0; i < PredefinedPatterns.Num(); i++)
-		{
-			const FObstaclePattern& Pattern = PredefinedPatterns[i];
-			
-			if (Pattern.MinDifficultyLevel <= CurrentDifficultyLevel && Pattern.Obstacles.Num() > 0)
-			{
-				FPatternCandidate Candidate;
-				Candidate.Pattern = &Pattern;
-				Candidate.Index = i;
-				Candidate.Weight = Pattern.SelectionWeight;
-				
-				ValidPatterns.Add(Candidate);
-				TotalWeight += Pattern.SelectionWeight;
-			}
-		}
+		InitializePoolForType(Type);
 	}
+}
 
-	if (ValidPatterns.Num() == 0 || TotalWeight <= 0.0f)
+void UObstacleSpawnerComponent::InitializePoolForType(EObstacleType Type)
+{
+	TSubclassOf<ABaseObstacle> ClassToSpawn = GetClassForType(Type);
+	if (!ClassToSpawn)
 	{
-		OutPatternIndex = INDEX_NONE;
-		return nullptr;
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("Cannot initialize pool for type %d - no class assigned!"), (int32)Type);
+		return;
 	}
 
-	// Weighted random selection
-	float RandomValue = FMath::FRand() * TotalWeight;
-	float AccumulatedWeight = 0.0f;
+	const ABaseObstacle* Defaults = ClassToSpawn->GetDefaultObject<ABaseObstacle>();
+	VariantCounts[(int32)Type] = Defaults ? UHardwareTierSubsystem::ApplyCap(Defaults->GetMeshVariants().Num(), MeshVariantCap) : 0;
 
-	for (const FPatternCandidate& Candidate : ValidPatterns)
-	{
-		AccumulatedWeight += Candidate.Weight;
-		if (RandomValue <= AccumulatedWeight)
-		{
-			OutPatternIndex = Candidate.Index;
-			return Candidate.Pattern;
-		}
-	}
-
-	OutPatternIndex = ValidPatterns.Last().Index;
-	return ValidPatterns.Last().Pattern;
-}
+	TActorPool<ABaseObstacle>& Pool = GetPoolForType(Type);
+	const int32 PoolSize = UHardwareTierSubsystem::ApplyCap(GetInitialPoolSize(Type), PoolSizeCap);
+	Pool.Reserve(PoolSize);
 
-// --- Pooling Functions ---
+	// Time-sliced: spawn just enough to start, the scheduler fills the rest over the intro
+	const int32 SyncCount = bTimeSlicedPrewarm ? FMath::Min(PrewarmBootstrapCount, PoolSize) : PoolSize;
 
-void UObstacleSpawnerComponent::InitializePools()
-{
-	if (!LowWallClass)
+	for (int32 i = 0; i < SyncCount; i++)
 	{
-		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("ObstacleSpawnerComponent: No LowWallClass set! Assign BP_JumpHurdle."));
-	}
-	if (!HighBarrierClass)
-	{
-		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("ObstacleSpawnerComponent: No HighBarrierClass set! Assign BP_SlideHurdle."));
+		ABaseObstacle* Obstacle = SpawnObstacleActor(Type);
+		if (Obstacle)
+		{
+			Pool.Add(Obstacle, Obstacle->GetBoundVariantIndex());
+		}
 	}
-	if (!FullWallClass)
+
+	RequestPrewarm(Type, PoolSize);
+}
+
+int32 UObstacleSpawnerComponent::GetInitialPoolSize(EObstacleType Type) const
+{
+	const int32 RecordedPeak = RecordedPoolPeaks[(int32)Type];
+	if (!bAdaptivePoolSizing || RecordedPeak <= 0)
 	{
-		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("ObstacleSpawnerComponent: No FullWallClass set! Assign BP_SlabObstacle."));
+		return InitialPoolSizePerType;
 	}
 
-	InitializePoolForType(EObstacleType::LowWall);
-	InitializePoolForType(EObstacleType::HighBarrier);
-	InitializePoolForType(EObstacleType::FullWall);
+	// 200 matches the InitialPoolSizePerType clamp
+	return FMath::Clamp(FMath::CeilToInt(RecordedPeak * AdaptivePoolMargin), AdaptiveMinPoolSize, 200);
 }
 
-void UObstacleSpawnerComponent::InitializePoolForType(EObstacleType Type)
+void UObstacleSpawnerComponent::LoadPoolHistory()
 {
-	TSubclassOf<ABaseObstacle> ClassToSpawn = GetClassForType(Type);
-	if (!ClassToSpawn)
+	if (!bAdaptivePoolSizing)
 	{
-		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("Cannot initialize pool for type %d - no class assigned!"), (int32)Type);
 		return;
 	}
 
-	TArray<TObjectPtr<ABaseObstacle>>& Pool = GetPoolForType(Type);
-	Pool.Reserve(InitialPoolSizePerType);
+	FPoolHistory::Load<EObstacleType>(RecordedPoolPeaks);
+
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("ObstacleSpawner: Recorded pool peaks LW:%d HB:%d FW:%d"),
+		RecordedPoolPeaks[0], RecordedPoolPeaks[1], RecordedPoolPeaks[2]);
+}
 
-	for (int32 i = 0; i < InitialPoolSizePerType; i++)
+void UObstacleSpawnerComponent::SavePoolHistory() const
+{
+	// Nothing ever spawned (quit during countdown) -- don't decay history for an empty session
+	if (!bAdaptivePoolSizing || ActiveObstacles.GetHighWaterMark() == 0)
 	{
-		ABaseObstacle* Obstacle = SpawnObstacleActor(Type);
-		if (Obstacle)
-		{
-			Pool.Add(Obstacle);
-		}
+		return;
 	}
+
+	FPoolHistory::Save<EObstacleType>(RecordedPoolPeaks, [this](int32 TypeIndex)
+	{
+		return GetPoolForType((EObstacleType)TypeIndex).GetHighWaterMark();
+	}, PoolHistoryDecay);
+
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("ObstacleSpawner: Saved session pool peaks LW:%d HB:%d FW:%d"),
+		GetPoolHighWaterMark(EObstacleType::LowWall), GetPoolHighWaterMark(EObstacleType::HighBarrier), GetPoolHighWaterMark(EObstacleType::FullWall));
 }
 
 ABaseObstacle* UObstacleSpawnerComponent::GetObstacleFromPool(EObstacleType Type)
 {
-	TArray<TObjectPtr<ABaseObstacle>>& Pool = GetPoolForType(Type);
+	TActorPool<ABaseObstacle>& Pool = GetPoolForType(Type);
 
-	for (ABaseObstacle* Obstacle : Pool)
+	// O(1) pop from the picked variant's free stack (already built with that mesh)
+	const int32 VariantCount = VariantCounts[(int32)Type];
+	const int32 Variant = VariantCount > 1 ? URunSeedSubsystem::GetStreamFor(this, ERunRandomStream::ObstacleVisuals).RandRange(0, VariantCount - 1) : 0;
+	if (ABaseObstacle* Obstacle = Pool.Acquire(Variant))
 	{
-		if (Obstacle && !Obstacle->IsActive())
-		{
-			return Obstacle;
-		}
+		return Obstacle;
 	}
 
-	// Pool exhausted, expand
+	// Pool exhausted -- prewarm fell behind demand, expand synchronously
+	if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
+	{
+		Debug->RecordEvent(EDebugCategory::Spawning, EDebugEventId::ObstaclePoolExhausted, (int32)Type, Pool.Num());
+	}
 	ExpandPool(Type);
 
-	for (ABaseObstacle* Obstacle : Pool)
+	if (ABaseObstacle* Obstacle = Pool.Acquire(Variant))
 	{
-		if (Obstacle && !Obstacle->IsActive())
-		{
-			return Obstacle;
-		}
+		return Obstacle;
+	}
+
+	if (PoolSizeCap > 0 && Pool.Num() >= PoolSizeCap)
+	{
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("Obstacle pool %d at its hardware tier cap (%d), skipping spawn"), (int32)Type, PoolSizeCap);
+		return nullptr;
 	}
 
 	UE_LOG(LogStateRunner_Arcade, Warning, TEXT("Failed to get obstacle from pool even after expansion!"));
 	return nullptr;
 }
 
-TArray<TObjectPtr<ABaseObstacle>>& UObstacleSpawnerComponent::GetPoolForType(EObstacleType Type)
+int32 UObstacleSpawnerComponent::GetTotalPooledCount() const
 {
-	switch (Type)
+	int32 Total = 0;
+	for (const TActorPool<ABaseObstacle>& Pool : ObstaclePools)
 	{
-		case EObstacleType::LowWall:
-			return LowWallPool;
-		case EObstacleType::HighBarrier:
-			return HighBarrierPool;
-		case EObstacleType::FullWall:
-		default:
-			return FullWallPool;
+		Total += Pool.Num();
 	}
+	return Total;
 }
 
 TSubclassOf<ABaseObstacle> UObstacleSpawnerComponent::GetClassForType(EObstacleType Type) const
 {
-	switch (Type)
+	// Designer-set class per type, indexed by EObstacleType
+	static constexpr TSubclassOf<ABaseObstacle> UObstacleSpawnerComponent::* ClassByType[NumObstacleTypes] =
 	{
-		case EObstacleType::LowWall:
-			return LowWallClass;
-		case EObstacleType::HighBarrier:
-			return HighBarrierClass;
-		case EObstacleType::FullWall:
-		default:
-			return FullWallClass;
-	}
+		&UObstacleSpawnerComponent::LowWallClass,
+		&UObstacleSpawnerComponent::HighBarrierClass,
+		&UObstacleSpawnerComponent::FullWallClass
+	};
+	return this->*ClassByType[static_cast<int32>(Type)];
 }
 
 void UObstacleSpawnerComponent::ExpandPool(EObstacleType Type)
 {
+	STATERUNNER_LLM_SCOPE(ObstaclePool);
+	STATERUNNER_FRAME_EVENT(ObstaclePoolExpanded);
+
 	TSubclassOf<ABaseObstacle> ClassToSpawn = GetClassForType(Type);
 	if (!ClassToSpawn)
 	{
@@ -1036,22 +849,29 @@ void UObstacleSpawnerComponent::ExpandPool(EObstacleType Type)
 		return;
 	}
 
-	TArray<TObjectPtr<ABaseObstacle>>& Pool = GetPoolForType(Type);
+	TActorPool<ABaseObstacle>& Pool = GetPoolForType(Type);
 	int32 OldSize = Pool.Num();
-	Pool.Reserve(OldSize + PoolExpansionSize);
+	const int32 ExpansionSize = PoolSizeCap > 0 ? FMath::Min(PoolExpansionSize, PoolSizeCap - OldSize) : PoolExpansionSize;
+	if (ExpansionSize <= 0)
+	{
+		return;
+	}
+	Pool.Reserve(OldSize + ExpansionSize);
 
-	for (int32 i = 0; i < PoolExpansionSize; i++)
+	for (int32 i = 0; i < ExpansionSize; i++)
 	{
 		ABaseObstacle* Obstacle = SpawnObstacleActor(Type);
 		if (Obstacle)
 		{
-			Pool.Add(Obstacle);
+			Pool.Add(Obstacle, Obstacle->GetBoundVariantIndex());
 		}
 	}
 }
 
 ABaseObstacle* UObstacleSpawnerComponent::SpawnObstacleActor(EObstacleType Type)
 {
+	STATERUNNER_LLM_SCOPE(ObstaclePool);
+
 	UWorld* World = GetWorld();
 	if (!World)
 	{
@@ -1075,180 +895,411 @@ ABaseObstacle* UObstacleSpawnerComponent::SpawnObstacleActor(EObstacleType Type)
 	
 	if (Obstacle)
 	{
+		Obstacle->SetOwningSpawner(this);
+		if (bUseInstancedRendering)
+		{
+			Obstacle->EnableInstancedRendering();
+		}
+
+		// Mesh/material setup happens once here, never on reactivation
+		const int32 VariantCount = VariantCounts[(int32)Type];
+		Obstacle->BindMeshVariant(VariantCount > 0 ? GetPoolForType(Type).Num() % VariantCount : INDEX_NONE);
+
 		Obstacle->Deactivate();
 	}
 
 	return Obstacle;
 }
 
-// --- Helper Functions ---
-
-float UObstacleSpawnerComponent::GetLaneYPosition(ELane Lane) const
+void UObstacleSpawnerComponent::ReturnObstacleToPool(ABaseObstacle* Obstacle)
 {
-	switch (Lane)
+	if (!Obstacle)
 	{
-		case ELane::Left:	return LeftLaneY;
-		case ELane::Center:	return CenterLaneY;
-		case ELane::Right:	return RightLaneY;
-		default:			return CenterLaneY;
+		return;
+	}
+
+	ReleaseObstacleInstance(Obstacle);
+	if (ActiveObstacles.Contains(Obstacle))
+	{
+		UnindexObstacle(Obstacle);
+		ActiveObstacles.Remove(Obstacle);
+	}
+
+	// Pool is keyed by type; fall back to the others in case a Blueprint changed ObstacleType
+	TActorPool<ABaseObstacle>& TypedPool = GetPoolForType(Obstacle->GetObstacleType());
+	if (TypedPool.Owns(Obstacle))
+	{
+		TypedPool.Release(Obstacle);
+		return;
+	}
+
+	for (TActorPool<ABaseObstacle>& Pool : ObstaclePools)
+	{
+		if (Pool.Owns(Obstacle))
+		{
+			Pool.Release(Obstacle);
+			return;
+		}
 	}
 }
 
-ELane UObstacleSpawnerComponent::GetRandomLane() const
+void UObstacleSpawnerComponent::UpdatePoolStats() const
 {
-	int32 RandomValue = FMath::RandRange(0, 2);
-	switch (RandomValue)
+	SIZE_T PoolMemory = ActiveObstacles.GetAllocatedSize();
+	for (const TActorPool<ABaseObstacle>& Pool : ObstaclePools)
+	{
+		PoolMemory += Pool.GetAllocatedSize();
+	}
+
+	SET_DWORD_STAT(STAT_StateRunner_PooledObstacles, GetTotalPooledCount());
+	SET_DWORD_STAT(STAT_StateRunner_ActiveObstacles, ActiveObstacles.Num());
+	SET_MEMORY_STAT(STAT_StateRunner_ObstaclePoolMemory, PoolMemory);
+
+	if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
 	{
-		case 0:		return ELane::Left;
-		case 1:		return ELane::Center;
-		default:	return ELane::Right;
+		Debug->Stat_PooledObstacles = GetTotalPooledCount();
+		Debug->Stat_ActiveObstacles = ActiveObstacles.Num();
 	}
 }
 
-EObstacleType UObstacleSpawnerComponent::GetRandomObstacleType() const
+void UObstacleSpawnerComponent::RequestPrewarm(EObstacleType Type, int32 TargetSize)
 {
-	// 40% LowWall (jump), 40% HighBarrier (slide), 20% FullWall (lane change)
-	int32 RandomValue = FMath::RandRange(0, 9);
-	
-	if (RandomValue < 4)
+	PrewarmQueue.Request((int32)Type, UHardwareTierSubsystem::ApplyCap(TargetSize, PoolSizeCap));
+}
+
+void UObstacleSpawnerComponent::InitializePrewarmQueue()
+{
+	PrewarmQueue.Initialize(this, PrewarmFrameBudgetMs,
+		[this](int32 TypeIndex) -> TActorPool<ABaseObstacle>&
+		{
+			return GetPoolForType((EObstacleType)TypeIndex);
+		},
+		[this](int32 TypeIndex) -> ABaseObstacle*
+		{
+			ABaseObstacle* Actor = SpawnObstacleActor((EObstacleType)TypeIndex);
+			if (Actor)
+			{
+				GetPoolForType((EObstacleType)TypeIndex).Add(Actor, Actor->GetBoundVariantIndex());
+			}
+			return Actor;
+		},
+		[this](bool bFinished, int32 NumSpawned)
+		{
+			UpdatePoolStats();
+
+			if (bFinished && NumSpawned > 0)
+			{
+				if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
+				{
+					Debug->RecordEvent(EDebugCategory::Spawning, EDebugEventId::ObstaclePrewarmDone,
+						GetPoolForType(EObstacleType::LowWall).Num(), GetPoolForType(EObstacleType::HighBarrier).Num(), GetPoolForType(EObstacleType::FullWall).Num());
+				}
+			}
+		});
+}
+
+void UObstacleSpawnerComponent::UpdatePredictivePrewarm()
+{
+	// Obstacle count for the next difficulty level at max variance
+	const int32 NextLevel = CurrentDifficultyLevel + 1;
+	const int32 PredictedPerSegment = FMath::Clamp(
+		DifficultyDirector->GetBaseObstacleCount(NextLevel) + 1,
+		MinObstaclesPerSegment, MaxObstaclesPerSegment);
+	const int32 Headroom = FMath::CeilToInt(PredictedPerSegment * PrewarmHeadroomSegments);
+
+	// Patterns can put a whole segment in one type, so each pool gets the full headroom
+	for (EObstacleType Type : AllObstacleTypes)
 	{
-		return EObstacleType::LowWall;
+		RequestPrewarm(Type, GetPoolForType(Type).GetNumInUse() + Headroom);
 	}
-	else if (RandomValue < 8)
+}
+
+// --- Spatial Index ---
+
+void UObstacleSpawnerComponent::TrackActiveObstacle(ABaseObstacle* Obstacle)
+{
+	if (!Obstacle || ActiveObstacles.Contains(Obstacle))
 	{
-		return EObstacleType::HighBarrier;
+		return;
 	}
-	else
+
+	ActiveObstacles.Add(Obstacle);
+	IndexObstacle(Obstacle);
+}
+
+int32 UObstacleSpawnerComponent::LowerBoundInLane(int32 LaneIdx, float TrackX) const
+{
+	const TArray<TObjectPtr<ABaseObstacle>>& Lane = LaneIndex[LaneIdx];
+	return Algo::LowerBoundBy(Lane, TrackX, [](const TObjectPtr<ABaseObstacle>& Obstacle)
+	{
+		return Obstacle->GetTrackX();
+	});
+}
+
+void UObstacleSpawnerComponent::IndexObstacle(ABaseObstacle* Obstacle)
+{
+	const int32 LaneIdx = (int32)Obstacle->GetCurrentLane();
+	TArray<TObjectPtr<ABaseObstacle>>& Lane = LaneIndex[LaneIdx];
+
+	// Segments spawn ahead of everything already on track, so this is almost always an append
+	const float TrackX = Obstacle->GetTrackX();
+	if (Lane.Num() == 0 || Lane.Last()->GetTrackX() <= TrackX)
 	{
-		return EObstacleType::FullWall;
+		Lane.Add(Obstacle);
+		return;
 	}
+
+	Lane.Insert(Obstacle, LowerBoundInLane(LaneIdx, TrackX));
 }
 
-void UObstacleSpawnerComponent::UpdateDifficulty()
+void UObstacleSpawnerComponent::UnindexObstacle(ABaseObstacle* Obstacle)
 {
-	int32 NewDifficulty = SegmentsSpawned / SegmentsPerDifficultyIncrease;
-	
-	if (NewDifficulty != CurrentDifficultyLevel)
+	const int32 LaneIdx = (int32)Obstacle->GetCurrentLane();
+	TArray<TObjectPtr<ABaseObstacle>>& Lane = LaneIndex[LaneIdx];
+
+	// Despawns come off the front, EMP clears near the front
+	if (Lane.Num() > 0 && Lane[0] == Obstacle)
 	{
-		int32 OldDifficulty = CurrentDifficultyLevel;
-		CurrentDifficultyLevel = NewDifficulty;
-		
-		if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
+		Lane.RemoveAt(0, 1, EAllowShrinking::No);
+		return;
+	}
+
+	// Walk forward from the lower bound past any obstacles sharing the same X
+	for (int32 i = LowerBoundInLane(LaneIdx, Obstacle->GetTrackX()); i < Lane.Num(); i++)
+	{
+		if (Lane[i] == Obstacle)
 		{
-			Debug->Stat_DifficultyLevel = CurrentDifficultyLevel;
-			Debug->LogEvent(EDebugCategory::Spawning, FString::Printf(TEXT("Difficulty: %d"), CurrentDifficultyLevel));
-			
-			if (OldDifficulty < DifficultyToDisableBreathers && CurrentDifficultyLevel >= DifficultyToDisableBreathers)
-			{
-				Debug->LogEvent(EDebugCategory::Spawning, TEXT("ENDGAME - No more breathers!"));
-			}
+			Lane.RemoveAt(i, 1, EAllowShrinking::No);
+			return;
 		}
 	}
+
+	// Shouldn't happen -- fall back to a linear search so the index never holds a stale entry
+	Lane.RemoveSingle(Obstacle);
 }
 
-bool UObstacleSpawnerComponent::ShouldBeBreatherSegment()
+void UObstacleSpawnerComponent::GetObstaclesInLaneRange(ELane Lane, float MinTrackX, float MaxTrackX, TArray<ABaseObstacle*>& OutObstacles) const
 {
-	if (EmptySegmentInterval <= 0)
+	const int32 LaneIdx = (int32)Lane;
+	const TArray<TObjectPtr<ABaseObstacle>>& LaneObstacles = LaneIndex[LaneIdx];
+
+	for (int32 i = LowerBoundInLane(LaneIdx, MinTrackX); i < LaneObstacles.Num(); i++)
 	{
-		return false;
+		ABaseObstacle* Obstacle = LaneObstacles[i];
+		if (Obstacle->GetTrackX() > MaxTrackX)
+		{
+			break;
+		}
+		OutObstacles.Add(Obstacle);
 	}
-	
-	// No breathers at high difficulty -- constant action
-	if (CurrentDifficultyLevel >= DifficultyToDisableBreathers)
+}
+
+void UObstacleSpawnerComponent::GetObstaclesInRange(float MinTrackX, float MaxTrackX, TArray<ABaseObstacle*>& OutObstacles) const
+{
+	for (ELane Lane : { ELane::Left, ELane::Center, ELane::Right })
 	{
-		return false;
+		GetObstaclesInLaneRange(Lane, MinTrackX, MaxTrackX, OutObstacles);
 	}
-	
-	return SegmentsSinceEmpty >= EmptySegmentInterval;
 }
 
-float UObstacleSpawnerComponent::GetEffectiveBreatherGapFraction() const
+void UObstacleSpawnerComponent::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
 {
-	// Gap shrinks as difficulty increases
-	float EffectiveGap = BreatherGapFraction - (CurrentDifficultyLevel * BreatherGapShrinkPerLevel);
-	EffectiveGap = FMath::Max(EffectiveGap, MinBreatherGapFraction);
-	
-	return EffectiveGap;
+	UObstacleSpawnerComponent* This = CastChecked<UObstacleSpawnerComponent>(InThis);
+	for (TActorPool<ABaseObstacle>& Pool : This->ObstaclePools)
+	{
+		Pool.AddReferencedObjects(Collector);
+	}
+	This->ActiveObstacles.AddReferencedObjects(Collector);
+	for (TArray<TObjectPtr<ABaseObstacle>>& Lane : This->LaneIndex)
+	{
+		Collector.AddReferencedObjects(Lane);
+	}
+
+	Super::AddReferencedObjects(InThis, Collector);
 }
 
-void UObstacleSpawnerComponent::AddFillerObstacles(TArray<FObstacleSpawnData>& OutObstacles, float PatternMinX, float PatternMaxX)
+// --- Instanced Rendering ---
+
+int32 UObstacleSpawnerComponent::FindOrCreateInstanceBatch(UStaticMesh* Mesh)
 {
-	// More filler at higher difficulty
-	int32 TotalFillerCount = FillerObstacleCount;
-	
-	if (CurrentDifficultyLevel >= DifficultyToDisableBreathers)
+	if (!Mesh)
 	{
-		int32 ExtraDifficulty = CurrentDifficultyLevel - DifficultyToDisableBreathers;
-		TotalFillerCount += ExtraDifficulty * FillerPerDifficulty;
+		return INDEX_NONE;
 	}
-	
-	if (TotalFillerCount <= 0)
+
+	if (const int32* Existing = InstancedBatchByMesh.Find(Mesh))
+	{
+		return *Existing;
+	}
+
+	AActor* Owner = GetOwner();
+	if (!Owner)
+	{
+		return INDEX_NONE;
+	}
+
+	// Plain ISM -- no cluster tree to rebuild when slots are rewritten
+	UInstancedStaticMeshComponent* ISM = NewObject<UInstancedStaticMeshComponent>(Owner);
+	ISM->SetStaticMesh(Mesh);
+	ISM->SetMobility(EComponentMobility::Movable);
+	ISM->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	ISM->SetCastShadow(bInstancedCastShadows);
+	ISM->RegisterComponent();
+	ISM->SetWorldTransform(FTransform::Identity);
+	Owner->AddInstanceComponent(ISM);
+
+	const int32 BatchIndex = InstancedBatches.AddDefaulted();
+	InstancedBatches[BatchIndex].Component = ISM;
+	InstancedBatchByMesh.Add(Mesh, BatchIndex);
+
+	if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
+	{
+		Debug->RecordNamedEvent(EDebugCategory::Spawning, EDebugEventId::InstanceBatchCreated, Mesh->GetFName(), BatchIndex);
+	}
+
+	return BatchIndex;
+}
+
+void UObstacleSpawnerComponent::AcquireObstacleInstance(ABaseObstacle* Obstacle)
+{
+	if (!bUseInstancedRendering || !Obstacle || !Obstacle->IsUsingInstancedRendering())
 	{
 		return;
 	}
 
-	// Filler zones: before and after the pattern
-	const float GapBuffer = 0.08f;
-	
-	float BeforeGapStart = MinSpawnOffset;
-	float BeforeGapEnd = FMath::Max(MinSpawnOffset, PatternMinX - GapBuffer);
-	float BeforeGapSize = BeforeGapEnd - BeforeGapStart;
-	
-	float AfterGapStart = FMath::Min(MaxSpawnOffset, PatternMaxX + GapBuffer);
-	float AfterGapEnd = MaxSpawnOffset;
-	float AfterGapSize = AfterGapEnd - AfterGapStart;
-	
-	float TotalGapSize = BeforeGapSize + AfterGapSize;
-	
-	if (TotalGapSize < 0.1f)
+	const int32 BatchIndex = FindOrCreateInstanceBatch(Obstacle->GetInstancedMesh());
+	if (BatchIndex == INDEX_NONE)
 	{
 		return;
 	}
-	
-	// Distribute proportionally
-	int32 BeforeCount = (BeforeGapSize > 0.05f) ? FMath::RoundToInt(TotalFillerCount * (BeforeGapSize / TotalGapSize)) : 0;
-	int32 AfterCount = TotalFillerCount - BeforeCount;
-	
-	if (BeforeGapSize > 0.1f && BeforeCount == 0 && AfterCount > 1)
+
+	FInstancedObstacleBatch& Batch = InstancedBatches[BatchIndex];
+	const FTransform InstanceTransform = Obstacle->GetInstanceWorldTransform();
+
+	int32 SlotIndex;
+	if (Batch.FreeSlots.Num() > 0)
 	{
-		BeforeCount = 1;
-		AfterCount--;
+		SlotIndex = Batch.FreeSlots.Pop(EAllowShrinking::No);
+		Batch.SlotOwners[SlotIndex] = Obstacle;
+		Batch.SlotTransforms[SlotIndex] = InstanceTransform;
 	}
-	if (AfterGapSize > 0.1f && AfterCount == 0 && BeforeCount > 1)
+	else
 	{
-		AfterCount = 1;
-		BeforeCount--;
+		SlotIndex = Batch.Component->AddInstance(InstanceTransform, true);
+		Batch.SlotOwners.Add(Obstacle);
+		Batch.SlotTransforms.Add(InstanceTransform);
 	}
-	
-	if (BeforeCount > 0 && BeforeGapSize > 0.05f)
+
+	Batch.ActiveCount++;
+	Batch.bDirty = true;
+	Obstacle->SetInstanceSlot(BatchIndex, SlotIndex);
+}
+
+void UObstacleSpawnerComponent::ReleaseObstacleInstance(ABaseObstacle* Obstacle)
+{
+	if (!Obstacle || !InstancedBatches.IsValidIndex(Obstacle->GetInstanceBatchIndex()))
+	{
+		return;
+	}
+
+	FInstancedObstacleBatch& Batch = InstancedBatches[Obstacle->GetInstanceBatchIndex()];
+	const int32 SlotIndex = Obstacle->GetInstanceSlotIndex();
+
+	if (Batch.SlotOwners.IsValidIndex(SlotIndex) && Batch.SlotOwners[SlotIndex] == Obstacle)
 	{
-		float Spacing = BeforeGapSize / (BeforeCount + 1);
-		for (int32 i = 0; i < BeforeCount; i++)
+		// Park at zero scale below the track -- the slot is reused by the next activation
+		Batch.SlotOwners[SlotIndex] = nullptr;
+		Batch.SlotTransforms[SlotIndex] = FTransform(FRotator::ZeroRotator, FVector(0.0f, 0.0f, -10000.0f), FVector::ZeroVector);
+		Batch.FreeSlots.Add(SlotIndex);
+		Batch.ActiveCount--;
+		Batch.bDirty = true;
+	}
+
+	Obstacle->SetInstanceSlot(INDEX_NONE, INDEX_NONE);
+}
+
+void UObstacleSpawnerComponent::SyncInstancedObstacleTransforms(bool bPositionsMoved)
+{
+	for (FInstancedObstacleBatch& Batch : InstancedBatches)
+	{
+		if (!Batch.Component)
+		{
+			continue;
+		}
+
+		const bool bNeedsMove = bPositionsMoved && Batch.ActiveCount > 0;
+		if (!bNeedsMove && !Batch.bDirty)
+		{
+			continue;
+		}
+
+		if (bNeedsMove)
 		{
-			FObstacleSpawnData Filler;
-			Filler.RelativeXOffset = BeforeGapStart + Spacing * (i + 1);
-			Filler.Lane = static_cast<ELane>(FMath::RandRange(0, 2));
-			Filler.ObstacleType = GetRandomObstacleType();
-			Filler.ZOffset = 0.0f;
-			OutObstacles.Add(Filler);
+			for (int32 i = 0; i < Batch.SlotOwners.Num(); ++i)
+			{
+				if (const ABaseObstacle* Owner = Batch.SlotOwners[i])
+				{
+					Batch.SlotTransforms[i] = Owner->GetInstanceWorldTransform();
+				}
+			}
 		}
+
+		Batch.Component->BatchUpdateInstancesTransforms(0, Batch.SlotTransforms, true, true, false);
+		Batch.bDirty = false;
+	}
+}
+
+// --- Helper Functions ---
+
+float UObstacleSpawnerComponent::GetLaneYPosition(ELane Lane) const
+{
+	switch (Lane)
+	{
+		case ELane::Left:	return LeftLaneY;
+		case ELane::Center:	return CenterLaneY;
+		case ELane::Right:	return RightLaneY;
+		default:			return CenterLaneY;
 	}
+}
+
+void UObstacleSpawnerComponent::UpdateDifficulty()
+{
+	int32 NewDifficulty = DifficultyDirector->GetDifficultyForSegment(SegmentsSpawned);
 	
-	if (AfterCount > 0 && AfterGapSize > 0.05f)
+	if (NewDifficulty != CurrentDifficultyLevel)
 	{
-		float Spacing = AfterGapSize / (AfterCount + 1);
-		for (int32 i = 0; i < AfterCount; i++)
+		int32 OldDifficulty = CurrentDifficultyLevel;
+		CurrentDifficultyLevel = NewDifficulty;
+		
+		if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
 		{
-			FObstacleSpawnData Filler;
-			Filler.RelativeXOffset = AfterGapStart + Spacing * (i + 1);
-			Filler.Lane = static_cast<ELane>(FMath::RandRange(0, 2));
-			Filler.ObstacleType = GetRandomObstacleType();
-			Filler.ZOffset = 0.0f;
-			OutObstacles.Add(Filler);
+			Debug->Stat_DifficultyLevel = CurrentDifficultyLevel;
+			Debug->RecordEvent(EDebugCategory::Spawning, EDebugEventId::DifficultyChanged, CurrentDifficultyLevel);
+			
+			if (OldDifficulty < DifficultyToDisableBreathers && CurrentDifficultyLevel >= DifficultyToDisableBreathers)
+			{
+				Debug->RecordEvent(EDebugCategory::Spawning, EDebugEventId::EndgameReached);
+			}
 		}
 	}
 }
 
+bool UObstacleSpawnerComponent::ShouldBeBreatherSegment(int32 DifficultyLevel, int32 SinceEmpty) const
+{
+	if (EmptySegmentInterval <= 0)
+	{
+		return false;
+	}
+	
+	// No breathers at high difficulty -- constant action
+	if (DifficultyLevel >= DifficultyToDisableBreathers)
+	{
+		return false;
+	}
+	
+	return SinceEmpty >= EmptySegmentInterval;
+}
+
 void UObstacleSpawnerComponent::CreateDefaultPatterns()
 {
 	// --- Difficulty 0 Patterns (Early game) ---
@@ -1989,3 +2040,37 @@ void UObstacleSpawnerComponent::CreateDefaultPatterns()
 		PredefinedPatterns.Add(Pattern);
 	}
 }
+
+// --- Deprecated Settings ---
+
+#if WITH_EDITORONLY_DATA
+void UObstacleSpawnerComponent::MigrateDeprecatedDifficulty(UDifficultyDirectorComponent& Director) const
+{
+	// Each ramp only moves if it was tuned (old defaults = never tuned, or already migrated and resaved)
+	const UObstacleSpawnerComponent* Defaults = GetDefault<UObstacleSpawnerComponent>();
+
+	if (SegmentsPerDifficultyIncrease_DEPRECATED != Defaults->SegmentsPerDifficultyIncrease_DEPRECATED)
+	{
+		Director.SetSegmentsPerDifficultyLevel(SegmentsPerDifficultyIncrease_DEPRECATED);
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("ObstacleSpawner: Moved a difficulty level every %d segments to the difficulty director's DifficultyCurve - resave %s"),
+			SegmentsPerDifficultyIncrease_DEPRECATED, *GetPathName());
+	}
+
+	if (ObstaclesPerDifficultyLevel_DEPRECATED != Defaults->ObstaclesPerDifficultyLevel_DEPRECATED)
+	{
+		// The old count started at MinObstaclesPerSegment
+		Director.SetLinearObstacleCountRamp(MinObstaclesPerSegment, ObstaclesPerDifficultyLevel_DEPRECATED);
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("ObstacleSpawner: Moved obstacle count %d +%d/level to the difficulty director's ObstacleCountCurve - resave %s"),
+			MinObstaclesPerSegment, ObstaclesPerDifficultyLevel_DEPRECATED, *GetPathName());
+	}
+
+	if (BreatherGapFraction_DEPRECATED != Defaults->BreatherGapFraction_DEPRECATED
+		|| BreatherGapShrinkPerLevel_DEPRECATED != Defaults->BreatherGapShrinkPerLevel_DEPRECATED
+		|| MinBreatherGapFraction_DEPRECATED != Defaults->MinBreatherGapFraction_DEPRECATED)
+	{
+		Director.SetLinearBreatherGapRamp(BreatherGapFraction_DEPRECATED, BreatherGapShrinkPerLevel_DEPRECATED, MinBreatherGapFraction_DEPRECATED);
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("ObstacleSpawner: Moved breather gap %.2f -%.2f/level (min %.2f) to the difficulty director's BreatherGapCurve - resave %s"),
+			BreatherGapFraction_DEPRECATED, BreatherGapShrinkPerLevel_DEPRECATED, MinBreatherGapFraction_DEPRECATED, *GetPathName());
+	}
+}
+#endif
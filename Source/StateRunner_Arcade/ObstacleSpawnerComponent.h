@@ -3,64 +3,18 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "BaseObstacle.h"
+#include "SpawnTypeTraits.h"
+#include "ActorPool.h"
+#include "ObstaclePatternLibrary.h"
+#include "ObstacleLayoutGenerator.h"
+#include "GameplaySimulationSubsystem.h"
+#include "Tasks/Task.h"
 #include "ObstacleSpawnerComponent.generated.h"
 
 class ABaseObstacle;
-
-/**
- * Spawn data for a single obstacle within a segment.
- * Used by patterns and procedural generation.
- */
-USTRUCT(BlueprintType)
-struct FObstacleSpawnData
-{
-	GENERATED_BODY()
-
-	/** Type of obstacle to spawn */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Obstacle")
-	EObstacleType ObstacleType = EObstacleType::LowWall;
-
-	/** Which lane to spawn in */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Obstacle")
-	ELane Lane = ELane::Center;
-
-	/** 
-	 * X offset within segment (0.0 = segment start, 1.0 = segment end).
-	 * Actual position: SegmentStartX + (RelativeXOffset * SegmentLength)
-	 */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Obstacle", meta=(ClampMin="0.0", ClampMax="1.0"))
-	float RelativeXOffset = 0.5f;
-
-	/** Optional Z position offset (for elevated obstacles) */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Obstacle")
-	float ZOffset = 0.0f;
-};
-
-/**
- * Predefined obstacle pattern for a track segment.
- * Stores a set of obstacles that form a fair, tested configuration.
- */
-USTRUCT(BlueprintType)
-struct FObstaclePattern
-{
-	GENERATED_BODY()
-
-	/** Display name for debugging */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Pattern")
-	FString PatternName = TEXT("Unnamed Pattern");
-
-	/** Array of obstacles in this pattern */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Pattern")
-	TArray<FObstacleSpawnData> Obstacles;
-
-	/** Minimum difficulty level to use this pattern (0 = always available) */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Pattern", meta=(ClampMin="0"))
-	int32 MinDifficultyLevel = 0;
-
-	/** Weight for random selection (higher = more likely) */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Pattern", meta=(ClampMin="0.1"))
-	float SelectionWeight = 1.0f;
-};
+class UInstancedStaticMeshComponent;
+class UDifficultyDirectorComponent;
+class UWorldScrollComponent;
 
 /**
  * Tutorial obstacle type enum for clarity.
@@ -99,6 +53,47 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnTutorialPrompt, ETutorialObstacle
  */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnTutorialComplete);
 
+/**
+ * One instanced mesh per distinct obstacle mesh (instanced rendering mode).
+ * Instance slots are never removed -- released slots are parked at zero scale and reused,
+ * so indices stay stable for the obstacles holding them.
+ */
+USTRUCT()
+struct FInstancedObstacleBatch
+{
+	GENERATED_BODY()
+
+	/** Component drawing every instance of this mesh */
+	UPROPERTY()
+	TObjectPtr<UInstancedStaticMeshComponent> Component = nullptr;
+
+	/** Obstacle using each instance slot (null = parked) */
+	UPROPERTY()
+	TArray<TObjectPtr<ABaseObstacle>> SlotOwners;
+
+	/** Cached world transform per slot, pushed in one batch update */
+	TArray<FTransform> SlotTransforms;
+
+	/** Parked slots ready for reuse */
+	TArray<int32> FreeSlots;
+
+	/** Number of slots currently owned by an active obstacle */
+	int32 ActiveCount = 0;
+
+	/** Set when a slot was acquired/released and the batch needs a push */
+	bool bDirty = false;
+};
+
+/**
+ * Result of a look-ahead layout task: the layout, and the generator as it was after building
+ * it. The next task starts from a copy; it becomes the spawner's LayoutGenerator once taken.
+ */
+struct FObstacleLayoutStep
+{
+	FObstacleSegmentLayout Layout;
+	FObstacleLayoutGenerator Generator;
+};
+
 /**
  * Handles obstacle spawning, pooling, and pattern generation.
  * Lives on the GameMode. Supports both predefined patterns and
@@ -119,6 +114,9 @@ protected:
 	/** Called when the game starts */
 	virtual void BeginPlay() override;
 
+	/** Records pool peaks for adaptive sizing */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	// --- Tutorial Configuration ---
 
 protected:
@@ -214,6 +212,22 @@ protected:
 	UPROPERTY()
 	TArray<TObjectPtr<ABaseObstacle>> TutorialObstacles;
 
+	/**
+	 * Run distance (WorldScroll's presented scroll distance) at which each spawned tutorial
+	 * set reaches the player. Worked out once at spawn; prompts are scheduled from these.
+	 */
+	TArray<TPair<ETutorialObstacleType, double>> TutorialSetDistances;
+
+	/**
+	 * Fires at the next tutorial prompt or the end of the tutorial (rescheduled whenever
+	 * the scroll speed changes), so the tutorial needs no per-frame polling.
+	 */
+	FGameplayTimerHandle TutorialPromptTimer;
+
+	/** Speed and run distance source for the tutorial prompt schedule */
+	UPROPERTY()
+	TObjectPtr<UWorldScrollComponent> WorldScroll;
+
 	// --- Obstacle Configuration ---
 
 protected:
@@ -252,6 +266,82 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Obstacle Config|Pooling", meta=(ClampMin="5", ClampMax="50"))
 	int32 PoolExpansionSize = 10;
 
+	/**
+	 * Spread the initial pool fill across frames instead of spawning it all in BeginPlay.
+	 * Only PrewarmBootstrapCount actors per type are spawned up front; the rest
+	 * trickle in during the countdown/intro at PrewarmFrameBudgetMs per frame.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Obstacle Config|Pooling")
+	bool bTimeSlicedPrewarm = true;
+
+	/** Obstacles per type spawned synchronously in BeginPlay when time-slicing */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Obstacle Config|Pooling", meta=(ClampMin="0", ClampMax="50", EditCondition="bTimeSlicedPrewarm"))
+	int32 PrewarmBootstrapCount = 6;
+
+	/**
+	 * Milliseconds per frame the prewarm scheduler may spend spawning pool actors.
+	 * At least one actor is spawned per frame while work remains.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Obstacle Config|Pooling", meta=(ClampMin="0.1", ClampMax="8.0"))
+	float PrewarmFrameBudgetMs = 1.0f;
+
+	/**
+	 * Free obstacles to keep ready per type, in segments' worth of predicted demand.
+	 * Pools grow ahead of the next difficulty level instead of on exhaustion.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Obstacle Config|Pooling", meta=(ClampMin="0.5", ClampMax="6.0"))
+	float PrewarmHeadroomSegments = 2.0f;
+
+	/**
+	 * Size each pool from peak usage recorded in earlier sessions instead of the fixed size.
+	 * Peaks are saved to GameUserSettings on EndPlay, so hot types start big enough to avoid
+	 * ExpandPool() and rarely used types stop wasting memory.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Obstacle Config|Pooling")
+	bool bAdaptivePoolSizing = true;
+
+	/** Multiplier on the recorded peak when sizing a pool from history */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Obstacle Config|Pooling", meta=(ClampMin="1.0", ClampMax="3.0", EditCondition="bAdaptivePoolSizing"))
+	float AdaptivePoolMargin = 1.25f;
+
+	/** Smallest pool adaptive sizing will create for a type with history */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Obstacle Config|Pooling", meta=(ClampMin="1", ClampMax="50", EditCondition="bAdaptivePoolSizing"))
+	int32 AdaptiveMinPoolSize = 8;
+
+	/**
+	 * Fraction of the stored peak kept each session before merging in the new peak.
+	 * Below 1.0 lets a pool shrink again when its type falls out of use.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Obstacle Config|Pooling", meta=(ClampMin="0.5", ClampMax="1.0", EditCondition="bAdaptivePoolSizing"))
+	float PoolHistoryDecay = 0.9f;
+
+	/**
+	 * Draw obstacles through one instanced mesh per distinct mesh variant instead of a
+	 * UStaticMeshComponent per actor. Obstacle actors stay for collision/logic, but their own
+	 * mesh is hidden. Cuts draw calls on dense segments.
+	 *
+	 * MoveRunner scroll mode only: obstacles stand still there, so instances are written on
+	 * spawn, despawn and origin rebase. Under MoveWorld every instance would be rewritten
+	 * every frame on top of the actor moves, so the per-actor meshes are kept instead.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Obstacle Config|Rendering")
+	bool bUseInstancedRendering = false;
+
+	/** Cast shadows from instanced obstacles */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Obstacle Config|Rendering", meta=(EditCondition="bUseInstancedRendering"))
+	bool bInstancedCastShadows = true;
+
+	/**
+	 * Generate segment layouts on a background task ahead of time.
+	 * The game thread only pulls actors from the pools when a segment spawns.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Obstacle Config|Generation")
+	bool bAsyncLayoutGeneration = true;
+
+	/** Number of segment layouts to keep generated ahead */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Obstacle Config|Generation", meta=(ClampMin="1", ClampMax="4", EditCondition="bAsyncLayoutGeneration"))
+	int32 LayoutLookAheadSegments = 2;
+
 	// --- Lane Configuration ---
 
 protected:
@@ -355,12 +445,15 @@ protected:
 
 protected:
 
-	/** Min obstacles per segment at the start. Increases with difficulty. */
+	/**
+	 * Fewest obstacles per segment. The count per level (and how fast levels come) is the
+	 * GameMode's DifficultyDirectorComponent's ObstacleCountCurve/DifficultyCurve.
+	 */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Difficulty", meta=(ClampMin="1", ClampMax="15"))
 	int32 MinObstaclesPerSegment = 3;
 
 	/** Max obstacles per segment. Caps endgame density. */
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Difficulty", meta=(ClampMin="5", ClampMax="35"))
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Difficulty", meta=(ClampMin="5", ClampMax="64"))
 	int32 MaxObstaclesPerSegment = 16;
 
 	/**
@@ -397,24 +490,6 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Difficulty", meta=(ClampMin="1", ClampMax="8"))
 	int32 DifficultyToDisableBreathers = 6;
 
-	/**
-	 * Fraction of segment that's empty during breather segments at Difficulty 0.
-	 * Shrinks as difficulty increases (see BreatherGapShrinkPerLevel).
-	 */
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Difficulty", meta=(ClampMin="0.1", ClampMax="0.6"))
-	float BreatherGapFraction = 0.25f;
-
-	/**
-	 * How much the breather gap shrinks per difficulty level.
-	 * Gap = BreatherGapFraction - (DifficultyLevel * this value).
-	 */
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Difficulty", meta=(ClampMin="0.0", ClampMax="0.1"))
-	float BreatherGapShrinkPerLevel = 0.04f;
-
-	/** Floor for breather gap - won't shrink below this regardless of difficulty */
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Difficulty", meta=(ClampMin="0.05", ClampMax="0.3"))
-	float MinBreatherGapFraction = 0.1f;
-
 	/**
 	 * Base number of filler obstacles to add in gaps around patterns.
 	 * These obstacles fill the empty space before/after a pattern cluster.
@@ -429,18 +504,25 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Difficulty", meta=(ClampMin="0", ClampMax="3"))
 	int32 FillerPerDifficulty = 1;
 
-	/** Segments between difficulty increases. Should match PickupSpawner's value. */
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Difficulty", meta=(ClampMin="1", ClampMax="15"))
-	int32 SegmentsPerDifficultyIncrease = 7;
+#if WITH_EDITORONLY_DATA
+	/** Old level ramp (a level every N segments), moved into the director's DifficultyCurve on load */
+	UPROPERTY()
+	int32 SegmentsPerDifficultyIncrease_DEPRECATED = 7;
 
-	/**
-	 * Obstacles added per difficulty level increase.
-	 * Controls how aggressive the difficulty ramp is.
-	 * 
-	 * 1 = gentle ramp, 2 = moderate, 3+ = aggressive.
-	 */
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Difficulty", meta=(ClampMin="1", ClampMax="5"))
-	int32 ObstaclesPerDifficultyLevel = 1;
+	/** Old count ramp (MinObstaclesPerSegment + this per level), moved into ObstacleCountCurve on load */
+	UPROPERTY()
+	int32 ObstaclesPerDifficultyLevel_DEPRECATED = 1;
+
+	/** Old breather gap ramp (Fraction - ShrinkPerLevel per level, floored at Min), moved into BreatherGapCurve on load */
+	UPROPERTY()
+	float BreatherGapFraction_DEPRECATED = 0.25f;
+
+	UPROPERTY()
+	float BreatherGapShrinkPerLevel_DEPRECATED = 0.04f;
+
+	UPROPERTY()
+	float MinBreatherGapFraction_DEPRECATED = 0.1f;
+#endif
 
 	/** Chance to use a predefined pattern vs procedural generation (0.0 to 1.0) */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Difficulty", meta=(ClampMin="0.0", ClampMax="1.0"))
@@ -457,7 +539,8 @@ protected:
 	/**
 	 * Minimum number of different patterns to use before allowing repeats.
 	 * Only applies when bEnablePatternVariety is true.
-	 * Set to 0 to use all available patterns before repeating.
+	 * Set to 0 to use as many of the available patterns as the variety window
+	 * (FObstacleLayoutGenerator::MaxPatternVarietyWindow) holds before repeating.
 	 */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Difficulty", meta=(ClampMin="0", ClampMax="20"))
 	int32 MinPatternVarietyCount = 0;
@@ -466,10 +549,18 @@ protected:
 
 protected:
 
+	/**
+	 * Cooked pattern library with precomputed selection tables.
+	 * Preferred over PredefinedPatterns when set.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Patterns")
+	TObjectPtr<UObstaclePatternLibrary> PatternLibrary;
+
 	/**
 	 * Array of predefined obstacle patterns.
 	 * These are manually designed, tested patterns that guarantee fairness.
 	 * Can be edited in Blueprint for easy pattern creation.
+	 * Only used when PatternLibrary is not set -- a transient library is built from them at BeginPlay.
 	 */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category="Patterns")
 	TArray<FObstaclePattern> PredefinedPatterns;
@@ -479,28 +570,48 @@ protected:
 protected:
 
 	/**
-	 * Object pool for LowWall obstacles (jump).
+	 * Object pool per obstacle type, indexed by EObstacleType.
+	 * Pools/active list are not UPROPERTYs -- see AddReferencedObjects().
 	 */
-	UPROPERTY()
-	TArray<TObjectPtr<ABaseObstacle>> LowWallPool;
+	TActorPool<ABaseObstacle> ObstaclePools[NumObstacleTypes];
 
 	/**
-	 * Object pool for HighBarrier obstacles (slide).
+	 * Track currently active obstacles (for debugging/management).
+	 * Obstacles remove themselves on Deactivate() via ReturnObstacleToPool().
 	 */
-	UPROPERTY()
-	TArray<TObjectPtr<ABaseObstacle>> HighBarrierPool;
+	TActiveActorList<ABaseObstacle> ActiveObstacles;
 
 	/**
-	 * Object pool for FullWall obstacles (lane change).
+	 * Active obstacles per lane (indexed by ELane), sorted by X ascending.
+	 * Everything scrolls at one speed, so the order never changes after insertion.
+	 * Maintained alongside ActiveObstacles; reported to GC in AddReferencedObjects().
 	 */
-	UPROPERTY()
-	TArray<TObjectPtr<ABaseObstacle>> FullWallPool;
+	TArray<TObjectPtr<ABaseObstacle>> LaneIndex[3];
+
+	/** Time-sliced pool growth, indexed by EObstacleType */
+	TPrewarmQueue<ABaseObstacle, NumObstacleTypes> PrewarmQueue;
+
+	/** Peak in-use count per type from earlier sessions (0 = no history), indexed by EObstacleType */
+	int32 RecordedPoolPeaks[NumObstacleTypes] = {};
 
 	/**
-	 * Track currently active obstacles (for debugging/management).
+	 * Mesh variants per type (from the class defaults), indexed by EObstacleType.
+	 * Each pooled obstacle is bound to one variant at spawn (round-robin) and pooled in that
+	 * variant's bucket, so a random variant pick is a free-list pop rather than a mesh swap.
 	 */
+	int32 VariantCounts[NumObstacleTypes] = {};
+
+	/** Hardware tier caps read at InitializePools (0 = uncapped) -- pool size per type and variants per type */
+	int32 PoolSizeCap = 0;
+	int32 MeshVariantCap = 0;
+
+	/** Instance batches (instanced rendering mode only) */
 	UPROPERTY()
-	TArray<TObjectPtr<ABaseObstacle>> ActiveObstacles;
+	TArray<FInstancedObstacleBatch> InstancedBatches;
+
+	/** Lookup from mesh to its index in InstancedBatches */
+	UPROPERTY()
+	TMap<TObjectPtr<UStaticMesh>, int32> InstancedBatchByMesh;
 
 	/**
 	 * Number of segments to skip at the start (for tutorial area).
@@ -522,16 +633,35 @@ protected:
 	 */
 	bool bHasSpawnedTutorialObstacles = false;
 
-	/**
-	 * Indices of recently used patterns (for variety tracking).
-	 * Used to avoid repeating patterns when bEnablePatternVariety is true.
-	 */
+	/** Library patterns are selected from (PatternLibrary, or one built from PredefinedPatterns) */
 	UPROPERTY()
-	TArray<int32> RecentlyUsedPatternIndices;
+	TObjectPtr<UObstaclePatternLibrary> ActivePatternLibrary;
 
 	/** Last pattern name used (for debug logging). */
 	FString LastPatternName;
 
+	/**
+	 * Layout generation state (settings, RNG, pattern variety) as of the last consumed segment.
+	 * Look-ahead tasks only ever build from copies of it, so discarding them loses no draws.
+	 */
+	FObstacleLayoutGenerator LayoutGenerator;
+
+	/**
+	 * Look-ahead layout tasks, oldest first. Each is chained on the previous one and
+	 * builds from a copy of the generator its result carries.
+	 */
+	TArray<UE::Tasks::TTask<FObstacleLayoutStep>> PendingLayouts;
+
+	/** SegmentsSpawned / SegmentsSinceEmpty as of the last planned segment */
+	int32 PlannedSegmentsSpawned = 0;
+	int32 PlannedSegmentsSinceEmpty = 0;
+
+	/** Smoothed queue-to-ready time of the look-ahead layout tasks */
+	float LayoutLatencySeconds = 0.0f;
+
+	/** Difficulty, obstacle count and breather gap lookups, owned by the GameMode (read into each segment's plan) */
+	const UDifficultyDirectorComponent* DifficultyDirector = nullptr;
+
 	// --- Debug Configuration ---
 
 public:
@@ -575,6 +705,14 @@ public:
 
 public:
 
+#if WITH_EDITORONLY_DATA
+	/**
+	 * Carry ramp settings saved before the difficulty director existed over to its curves.
+	 * Called from the GameMode's PostLoad; does nothing while the settings hold their old defaults.
+	 */
+	void MigrateDeprecatedDifficulty(UDifficultyDirectorComponent& Director) const;
+#endif
+
 	/**
 	 * Spawn all obstacles for a track segment.
 	 * Called by track spawning system when a new segment is created.
@@ -609,6 +747,40 @@ public:
 	UFUNCTION(BlueprintPure, Category="Spawning")
 	int32 GetActiveObstacleCount() const { return ActiveObstacles.Num(); }
 
+	/** Currently active obstacles (unordered; copy before iterating if the loop can deactivate) */
+	const TArray<TObjectPtr<ABaseObstacle>>& GetActiveObstacles() const { return ActiveObstacles.GetArray(); }
+
+	/** Length of a track segment (segment managers step by this) */
+	float GetSegmentLength() const { return SegmentLength; }
+
+	/** Runner's track-space X */
+	float GetPlayerXPosition() const { return PlayerXPosition; }
+
+	/**
+	 * Smoothed time from queuing a look-ahead layout to it being ready (0 without async
+	 * generation). A segment spawned less than this after its layout was queued blocks on it.
+	 */
+	float GetLayoutLatencySeconds() const { return bAsyncLayoutGeneration ? LayoutLatencySeconds : 0.0f; }
+
+	/**
+	 * A layout generator with this component's settings and patterns and a fresh variety window.
+	 * Settings are copied -- later property changes don't reach it. Works without BeginPlay,
+	 * so SpawnerBenchmark generates through it headlessly (feeding it plans it builds itself).
+	 *
+	 * @param Seed Layout RNG seed
+	 */
+	FObstacleLayoutGenerator CreateLayoutGenerator(int32 Seed);
+
+	/**
+	 * Check if a segment should be a breather segment.
+	 * Breather segments have a gap at the start before obstacles spawn.
+	 * 
+	 * @param DifficultyLevel Difficulty of the segment
+	 * @param SinceEmpty Segments since the last breather, including this one
+	 * @return True if this segment should be a breather (partial gap)
+	 */
+	bool ShouldBeBreatherSegment(int32 DifficultyLevel, int32 SinceEmpty) const;
+
 	/**
 	 * Get current difficulty level.
 	 */
@@ -626,7 +798,11 @@ public:
 	 * Get total number of predefined patterns.
 	 */
 	UFUNCTION(BlueprintPure, Category="Patterns")
-	int32 GetPatternCount() const { return PredefinedPatterns.Num(); }
+	int32 GetPatternCount() const
+	{
+		const UObstaclePatternLibrary* Library = ActivePatternLibrary ? ActivePatternLibrary.Get() : PatternLibrary.Get();
+		return Library ? Library->Patterns.Num() : PredefinedPatterns.Num();
+	}
 
 	/**
 	 * Get names of all predefined patterns (for debug/display).
@@ -647,6 +823,132 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Patterns")
 	void LogAllPatterns() const;
 
+	// --- Pool Functions ---
+
+public:
+
+	/** Report pooled obstacles to GC (pools are plain C++ containers) */
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+
+	/**
+	 * Return an obstacle to its pool. Called from ABaseObstacle::Deactivate().
+	 * O(1): swap-removes from ActiveObstacles and pushes the pool slot back on the free stack.
+	 * 
+	 * @param Obstacle Obstacle being deactivated
+	 */
+	void ReturnObstacleToPool(ABaseObstacle* Obstacle);
+
+	/** Peak simultaneous in-use count for a type's pool */
+	UFUNCTION(BlueprintPure, Category="Obstacle Spawner|Pooling")
+	int32 GetPoolHighWaterMark(EObstacleType Type) const { return GetPoolForType(Type).GetHighWaterMark(); }
+
+	/** Peak simultaneous active obstacles across all types */
+	UFUNCTION(BlueprintPure, Category="Obstacle Spawner|Pooling")
+	int32 GetActiveHighWaterMark() const { return ActiveObstacles.GetHighWaterMark(); }
+
+	// --- Spatial Query Functions ---
+
+	/**
+	 * Append active obstacles whose track X is in [MinTrackX, MaxTrackX], all lanes.
+	 * Binary search per lane over the X-ordered lane index -- no world scan.
+	 * 
+	 * @param MinTrackX Range start (track space)
+	 * @param MaxTrackX Range end (track space)
+	 * @param OutObstacles Appended to, grouped by lane, ascending X within each lane
+	 */
+	void GetObstaclesInRange(float MinTrackX, float MaxTrackX, TArray<ABaseObstacle*>& OutObstacles) const;
+
+	/**
+	 * Append active obstacles in one lane whose track X is in [MinTrackX, MaxTrackX].
+	 * 
+	 * @param Lane Lane to search
+	 * @param MinTrackX Range start (track space)
+	 * @param MaxTrackX Range end (track space)
+	 * @param OutObstacles Appended to, ascending X
+	 */
+	void GetObstaclesInLaneRange(ELane Lane, float MinTrackX, float MaxTrackX, TArray<ABaseObstacle*>& OutObstacles) const;
+
+	/** Whether the prewarm scheduler still has pool actors left to spawn */
+	UFUNCTION(BlueprintPure, Category="Obstacle Spawner|Pooling")
+	bool IsPrewarming() const { return PrewarmQueue.HasWork(); }
+
+protected:
+
+	/**
+	 * Raise a pool's prewarm target and make sure the scheduler is running.
+	 * Never shrinks a target.
+	 * 
+	 * @param Type Pool to grow
+	 * @param TargetSize Total pool size (active + free) to work toward
+	 */
+	void RequestPrewarm(EObstacleType Type, int32 TargetSize);
+
+	/**
+	 * Set prewarm targets from predicted demand at the next difficulty level:
+	 * in-use count plus PrewarmHeadroomSegments segments of obstacles per type.
+	 */
+	void UpdatePredictivePrewarm();
+
+	/** Bind PrewarmQueue to this spawner's pools (before the first RequestPrewarm) */
+	void InitializePrewarmQueue();
+
+	/** Push pool sizes, active count and pool memory to the StateRunner stats group and debug overlay */
+	void UpdatePoolStats() const;
+
+	/** Add a just-activated obstacle to ActiveObstacles and the lane index */
+	void TrackActiveObstacle(ABaseObstacle* Obstacle);
+
+	/** Insert into the lane index at its sorted X position */
+	void IndexObstacle(ABaseObstacle* Obstacle);
+
+	/** Remove from the lane index (obstacle must still be at its active location) */
+	void UnindexObstacle(ABaseObstacle* Obstacle);
+
+	/** First index in a lane whose track X is >= TrackX */
+	int32 LowerBoundInLane(int32 LaneIdx, float TrackX) const;
+
+	/**
+	 * Initial pool size for a type: recorded peak * AdaptivePoolMargin when history exists,
+	 * otherwise InitialPoolSizePerType.
+	 */
+	int32 GetInitialPoolSize(EObstacleType Type) const;
+
+	/** Read recorded pool peaks from GameUserSettings */
+	void LoadPoolHistory();
+
+	/** Merge this session's high-water marks into the recorded peaks and save them */
+	void SavePoolHistory() const;
+
+	// --- Instanced Rendering Functions ---
+
+public:
+
+	/** Whether obstacles are drawn through shared instance batches */
+	bool IsUsingInstancedRendering() const { return bUseInstancedRendering; }
+
+	/**
+	 * Give an activated obstacle an instance slot for its chosen mesh.
+	 * No-op unless bUseInstancedRendering is set.
+	 * 
+	 * @param Obstacle Obstacle that was just activated
+	 */
+	void AcquireObstacleInstance(ABaseObstacle* Obstacle);
+
+	/**
+	 * Park an obstacle's instance slot for reuse. Called from ABaseObstacle::Deactivate().
+	 * 
+	 * @param Obstacle Obstacle being returned to the pool
+	 */
+	void ReleaseObstacleInstance(ABaseObstacle* Obstacle);
+
+	/**
+	 * Push instance transforms for batches whose slots changed, in one call per mesh.
+	 * Called by UWorldScrollComponent after the batched scroll pass.
+	 * 
+	 * @param bPositionsMoved True if obstacles moved this frame (origin rebase)
+	 */
+	void SyncInstancedObstacleTransforms(bool bPositionsMoved);
+
 	// --- Tutorial Functions ---
 
 public:
@@ -707,16 +1009,22 @@ public:
 	void ResetTutorial();
 
 	/**
-	 * Checks tutorial obstacle positions and fires UI prompt events when player approaches.
-	 * 
-	 * @param CurrentScrollSpeed Current world scroll speed
-	 * @param PlayerX Player's X position (typically -5000)
+	 * Fires the UI prompt for every tutorial set now within TutorialPromptLeadTime of the
+	 * player (and completes the tutorial once the last set is passed), then schedules the
+	 * next one on the gameplay timeline. Runs from that timer and on scroll speed changes.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Tutorial")
-	void CheckTutorialPrompts(float CurrentScrollSpeed, float PlayerX = -5000.0f);
+	void CheckTutorialPrompts();
 
 protected:
 
+	/** WorldScroll speed changed (ramp, OVERCLOCK, damage slowdown) -- reschedule the next prompt */
+	UFUNCTION()
+	void HandleScrollSpeedChanged(float NewScrollSpeed);
+
+	/** True if any obstacle of a tutorial set is still on the track */
+	bool IsTutorialSetActive(ETutorialObstacleType TutorialType) const;
+
 	/**
 	 * Spawn a single tutorial obstacle configuration.
 	 * 
@@ -725,51 +1033,48 @@ protected:
 	 */
 	void SpawnTutorialObstacleSet(float WorldX, ETutorialObstacleType TutorialType);
 
-	// --- Pattern Functions ---
+	// --- Layout Generation ---
 
 protected:
 
 	/**
-	 * Generate obstacle layout for a segment using predefined pattern.
-	 * Selects a pattern based on difficulty and weight.
-	 * 
-	 * @param OutObstacles Array to fill with obstacle spawn data
-	 * @return True if a valid pattern was selected
+	 * Plan a segment, reading the director's obstacle count and breather gap for its level.
+	 *
+	 * @param SegmentNumber SegmentsSpawned once the segment is consumed
+	 * @param DifficultyLevel Difficulty the segment is generated at
+	 * @param bIsBreather Whether the segment starts with a breather gap
+	 * @return Plan for layout generation
 	 */
-	bool GenerateFromPattern(TArray<FObstacleSpawnData>& OutObstacles);
+	FObstacleSegmentPlan MakeSegmentPlan(int32 SegmentNumber, int32 DifficultyLevel, bool bIsBreather) const;
 
 	/**
-	 * Generate obstacle layout procedurally.
-	 * Creates random obstacles while ensuring fairness.
+	 * Advance the planned segment counters by one segment.
 	 * 
-	 * @param OutObstacles Array to fill with obstacle spawn data
-	 * @param ObstacleCount Number of obstacles to generate
+	 * @return Plan for that segment
 	 */
-	void GenerateProcedural(TArray<FObstacleSpawnData>& OutObstacles, int32 ObstacleCount);
+	FObstacleSegmentPlan PlanNextSegment();
 
-	/**
-	 * Calculate number of obstacles for current difficulty.
-	 * 
-	 * @return Number of obstacles to spawn
-	 */
-	int32 CalculateObstacleCount() const;
+	/** Queue layout tasks until LayoutLookAheadSegments are pending */
+	void RefillLayoutLookAhead();
+
+	/** Wait for and discard every pending layout task (they read the pattern library) */
+	void FlushLayoutLookAhead();
 
 	/**
-	 * Ensure obstacle layout is fair (at least one clear path exists).
-	 * Removes obstacles to create a path if necessary.
+	 * Take the layout generated for the segment now spawning, and the generator state after it.
 	 * 
-	 * @param Obstacles Array of obstacles to validate/fix
+	 * @param SegmentNumber SegmentsSpawned for the segment now spawning
+	 * @param OutLayout The layout, if one was queued for this segment
+	 * @return False if the look-ahead was empty or out of step (flushed in that case;
+	 *         LayoutGenerator is untouched, so the segment is rebuilt from the same state)
 	 */
-	void EnsureFairLayout(TArray<FObstacleSpawnData>& Obstacles);
+	bool TakeLookAheadLayout(int32 SegmentNumber, FObstacleSegmentLayout& OutLayout);
 
 	/**
-	 * Select a random pattern based on difficulty and weights.
-	 * Respects variety settings to avoid repeating patterns.
-	 * 
-	 * @param OutPatternIndex Index of selected pattern (for variety tracking)
-	 * @return Pointer to selected pattern, or nullptr if none available
+	 * Pick the library to select from.
+	 * Called in BeginPlay.
 	 */
-	const FObstaclePattern* SelectPattern(int32& OutPatternIndex);
+	void InitializePatternLibrary();
 
 	// --- Pooling Functions ---
 
@@ -790,6 +1095,7 @@ protected:
 
 	/**
 	 * Get an obstacle from the appropriate pool (or create new if pool empty).
+	 * Picks a random mesh variant and pops from its bucket (any bucket if that one is empty).
 	 * 
 	 * @param Type The type of obstacle needed
 	 * @return Obstacle ready for activation
@@ -802,16 +1108,25 @@ protected:
 	 * @param Type The obstacle type
 	 * @return Reference to the pool array
 	 */
-	TArray<TObjectPtr<ABaseObstacle>>& GetPoolForType(EObstacleType Type);
+	TActorPool<ABaseObstacle>& GetPoolForType(EObstacleType Type) { return ObstaclePools[static_cast<int32>(Type)]; }
+	const TActorPool<ABaseObstacle>& GetPoolForType(EObstacleType Type) const { return ObstaclePools[static_cast<int32>(Type)]; }
+
+	/** Actors across every type's pool */
+	int32 GetTotalPooledCount() const;
+
+public:
 
 	/**
 	 * Get the Blueprint class for a specific obstacle type.
+	 * Public for UShaderPrecacheComponent, which precaches every class's meshes.
 	 * 
 	 * @param Type The obstacle type
 	 * @return The TSubclassOf for spawning
 	 */
 	TSubclassOf<ABaseObstacle> GetClassForType(EObstacleType Type) const;
 
+protected:
+
 	/**
 	 * Expand the pool for a specific type by PoolExpansionSize.
 	 * 
@@ -819,8 +1134,17 @@ protected:
 	 */
 	void ExpandPool(EObstacleType Type);
 
+	/**
+	 * Find the instance batch for a mesh, creating its ISM on first use.
+	 * 
+	 * @param Mesh Mesh to draw
+	 * @return Index into InstancedBatches, or INDEX_NONE on failure
+	 */
+	int32 FindOrCreateInstanceBatch(UStaticMesh* Mesh);
+
 	/**
 	 * Spawn a new obstacle actor of a specific type (used for pool initialization/expansion).
+	 * Binds the next variant in round-robin order; add it to the pool in that variant's bucket.
 	 * 
 	 * @param Type The obstacle type to spawn
 	 * @return Newly spawned obstacle (deactivated)
@@ -839,81 +1163,14 @@ protected:
 	 */
 	float GetLaneYPosition(ELane Lane) const;
 
-	/**
-	 * Get random lane.
-	 * 
-	 * @return Random lane enum value
-	 */
-	ELane GetRandomLane() const;
-
-	/**
-	 * Get random obstacle type.
-	 * 
-	 * @return Random obstacle type enum value
-	 */
-	EObstacleType GetRandomObstacleType() const;
-
 	/**
 	 * Update difficulty based on segments spawned.
 	 */
 	void UpdateDifficulty();
 
-	/**
-	 * Check if current segment should be a breather segment.
-	 * Breather segments have a gap at the start before obstacles spawn.
-	 * 
-	 * @return True if this segment should be a breather (partial gap)
-	 */
-	bool ShouldBeBreatherSegment();
-
-	/**
-	 * Calculate the effective breather gap fraction for current difficulty.
-	 * Gap shrinks as difficulty increases, making breathers shorter at higher speeds.
-	 * 
-	 * @return Gap fraction (0.0-1.0) - portion of segment that's empty at start
-	 */
-	float GetEffectiveBreatherGapFraction() const;
-
-	/**
-	 * Add filler obstacles to fill gaps around a pattern.
-	 * Places obstacles in the empty space before/after the pattern cluster.
-	 * 
-	 * @param OutObstacles Array to add filler obstacles to
-	 * @param PatternMinX Minimum X offset of the pattern (0.0-1.0)
-	 * @param PatternMaxX Maximum X offset of the pattern (0.0-1.0)
-	 */
-	void AddFillerObstacles(TArray<FObstacleSpawnData>& OutObstacles, float PatternMinX, float PatternMaxX);
-
 	/**
 	 * Create default patterns if none are configured.
-	 * Called in BeginPlay if PredefinedPatterns is empty.
+	 * Called from the constructor so they appear as editable Blueprint defaults.
 	 */
 	void CreateDefaultPatterns();
-
-	/**
-	 * Check if two obstacle types require extra spacing when in sequence (same lane).
-	 * Returns the total minimum spacing required between the two obstacles.
-	 * 
-	 * @param FirstType The obstacle encountered first (closer to segment start)
-	 * @param SecondType The obstacle encountered second (further into segment)
-	 * @return Minimum relative X spacing required (base spacing + any extra for type combo)
-	 */
-	float GetRequiredSpacingForTypes(EObstacleType FirstType, EObstacleType SecondType) const;
-
-	/**
-	 * Validate obstacle layout for type-aware spacing violations.
-	 * Returns pairs of obstacle indices that are too close and need fixing.
-	 * 
-	 * @param Obstacles Array of obstacles to validate
-	 * @param OutViolations Output: Array of pairs (first index, second index) for violations
-	 */
-	void FindTypeSpacingViolations(const TArray<FObstacleSpawnData>& Obstacles, TArray<TPair<int32, int32>>& OutViolations) const;
-
-	/**
-	 * Fix type-aware spacing violations by adjusting obstacle positions or types.
-	 * Called as part of EnsureFairLayout when bEnableTypeAwareSpacing is true.
-	 * 
-	 * @param Obstacles Array of obstacles to fix (modified in place)
-	 */
-	void FixTypeSpacingViolations(TArray<FObstacleSpawnData>& Obstacles);
 };
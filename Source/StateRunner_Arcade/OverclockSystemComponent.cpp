@@ -5,6 +5,8 @@
 #include "StateRunner_Arcade.h"
 #include "StateRunner_ArcadeGameMode.h"
 #include "StateRunner_ArcadeCharacter.h"
+#include "VersusModeComponent.h"
+#include "SFXSubsystem.h"
 #include "GameFramework/PlayerController.h"
 #include "Kismet/GameplayStatics.h"
 #include "Sound/SoundBase.h"
@@ -14,7 +16,7 @@
 UOverclockSystemComponent::UOverclockSystemComponent()
 {
 	PrimaryComponentTick.bCanEverTick = true;
-	PrimaryComponentTick.bStartWithTickEnabled = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false; // Enabled in BeginPlay only without fixed-step simulation
 }
 
 void UOverclockSystemComponent::BeginPlay()
@@ -26,12 +28,48 @@ void UOverclockSystemComponent::BeginPlay()
 	CurrentMeter = 0.0f;
 	bIsOverclockActive = false;
 	bIsKeyHeld = false;
+
+	UGameplaySimulationSubsystem* Simulation = UGameplaySimulationSubsystem::Get(this);
+	if (Simulation && Simulation->IsFixedStepEnabled())
+	{
+		Simulation->RegisterParticipant(this, this, ESimulationPhase::Meters);
+	}
+	else
+	{
+		SetComponentTickEnabled(true);
+	}
+}
+
+void UOverclockSystemComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UGameplaySimulationSubsystem* Simulation = UGameplaySimulationSubsystem::Get(this))
+	{
+		Simulation->UnregisterParticipant(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void UOverclockSystemComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
+	AdvanceOverclock(DeltaTime);
+}
+
+void UOverclockSystemComponent::SimulateStep(float StepSeconds)
+{
+	AdvanceOverclock(StepSeconds);
+}
+
+void UOverclockSystemComponent::AdvanceOverclock(float DeltaTime)
+{
+	// Meter is frozen outside a run (menus, countdown, game over)
+	if (!WorldScrollComponent || !WorldScrollComponent->IsScrollingEnabled())
+	{
+		return;
+	}
+
 	// Update meter (passive fill or active drain)
 	UpdateMeter(DeltaTime);
 
@@ -76,6 +114,7 @@ void UOverclockSystemComponent::AddPickupBonus()
 
 	if (CurrentMeter != OldMeter)
 	{
+		LastBroadcastMeter = CurrentMeter;
 		OnOverclockMeterChanged.Broadcast(CurrentMeter, MaxMeter);
 		UE_LOG(LogStateRunner_Arcade, Verbose, TEXT("OVERCLOCK meter +%.1f (now %.1f/%.1f)"), PickupMeterBonus, CurrentMeter, MaxMeter);
 	}
@@ -92,6 +131,7 @@ void UOverclockSystemComponent::ResetOverclock()
 	CurrentMeter = 0.0f;
 	bIsKeyHeld = false;
 
+	LastBroadcastMeter = CurrentMeter;
 	OnOverclockMeterChanged.Broadcast(CurrentMeter, MaxMeter);
 }
 
@@ -109,10 +149,7 @@ void UOverclockSystemComponent::ActivateOverclock()
 	bIsOverclockActive = true;
 
 	// Apply speed multiplier
-	if (WorldScrollComponent)
-	{
-		WorldScrollComponent->SetOverclockMultiplier(SpeedMultiplier, true);
-	}
+	ApplyScrollMultiplier();
 
 	// Activate bonus scoring
 	if (ScoreSystemComponent)
@@ -121,15 +158,9 @@ void UOverclockSystemComponent::ActivateOverclock()
 	}
 
 	// Trigger camera zoom in for intensity effect
-	if (UWorld* World = GetWorld())
+	if (AStateRunner_ArcadeCharacter* Character = UVersusModeComponent::FindPlayerSystems(this).Runner)
 	{
-		if (APlayerController* PC = World->GetFirstPlayerController())
-		{
-			if (AStateRunner_ArcadeCharacter* Character = Cast<AStateRunner_ArcadeCharacter>(PC->GetPawn()))
-			{
-				Character->SetOverclockZoom(true);
-			}
-		}
+		Character->SetOverclockZoom(true);
 	}
 
 	// Play activation sound and start loop
@@ -143,7 +174,7 @@ void UOverclockSystemComponent::ActivateOverclock()
 	{
 		Debug->Stat_OverclockActive = true;
 		Debug->Stat_OverclockPercent = GetMeterPercent() * 100.0f;
-		Debug->LogEvent(EDebugCategory::Overclock, TEXT("OVERCLOCK ACTIVATED!"));
+		Debug->RecordEvent(EDebugCategory::Overclock, EDebugEventId::OverclockActivated);
 	}
 }
 
@@ -157,10 +188,7 @@ void UOverclockSystemComponent::DeactivateOverclock()
 	bIsOverclockActive = false;
 
 	// Remove speed multiplier
-	if (WorldScrollComponent)
-	{
-		WorldScrollComponent->SetOverclockMultiplier(1.0f, false);
-	}
+	ApplyScrollMultiplier();
 
 	// Deactivate bonus scoring
 	if (ScoreSystemComponent)
@@ -169,15 +197,9 @@ void UOverclockSystemComponent::DeactivateOverclock()
 	}
 
 	// Trigger camera zoom out to normal
-	if (UWorld* World = GetWorld())
+	if (AStateRunner_ArcadeCharacter* Character = UVersusModeComponent::FindPlayerSystems(this).Runner)
 	{
-		if (APlayerController* PC = World->GetFirstPlayerController())
-		{
-			if (AStateRunner_ArcadeCharacter* Character = Cast<AStateRunner_ArcadeCharacter>(PC->GetPawn()))
-			{
-				Character->SetOverclockZoom(false);
-			}
-		}
+		Character->SetOverclockZoom(false);
 	}
 
 	// Stop loop and play deactivation sound
@@ -190,13 +212,15 @@ void UOverclockSystemComponent::DeactivateOverclock()
 	if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
 	{
 		Debug->Stat_OverclockActive = false;
-		Debug->LogEvent(EDebugCategory::Overclock, TEXT("OVERCLOCK ended"));
+		Debug->RecordEvent(EDebugCategory::Overclock, EDebugEventId::OverclockEnded);
 	}
 }
 
 void UOverclockSystemComponent::UpdateMeter(float DeltaTime)
 {
-	float OldMeter = CurrentMeter;
+	// Compare against the last broadcast value: a single 120 Hz step of passive
+	// fill is below the threshold, so per-call deltas would never broadcast
+	const float OldMeter = LastBroadcastMeter;
 
 	if (bIsOverclockActive)
 	{
@@ -210,8 +234,9 @@ void UOverclockSystemComponent::UpdateMeter(float DeltaTime)
 	}
 
 	// Broadcast change if significant
-	if (FMath::Abs(CurrentMeter - OldMeter) > 0.1f)
+	if (FMath::Abs(CurrentMeter - OldMeter) > 0.1f || (CurrentMeter <= 0.0f && OldMeter > 0.0f))
 	{
+		LastBroadcastMeter = CurrentMeter;
 		OnOverclockMeterChanged.Broadcast(CurrentMeter, MaxMeter);
 		
 		// Update debug subsystem stats
@@ -229,9 +254,27 @@ void UOverclockSystemComponent::CacheComponents()
 		if (AStateRunner_ArcadeGameMode* GameMode = Cast<AStateRunner_ArcadeGameMode>(World->GetAuthGameMode()))
 		{
 			WorldScrollComponent = GameMode->GetWorldScrollComponent();
-			ScoreSystemComponent = GameMode->GetScoreSystemComponent();
 		}
 	}
+
+	// This player's score (a versus rival has its own)
+	ScoreSystemComponent = UVersusModeComponent::FindPlayerSystems(this).ScoreSystem;
+}
+
+void UOverclockSystemComponent::ApplyScrollMultiplier()
+{
+	// Versus: the scroll is shared, so it runs at the fastest OVERCLOCK active on any runner
+	UVersusModeComponent* Versus = UVersusModeComponent::Get(this);
+	if (Versus && Versus->IsVersusActive())
+	{
+		Versus->UpdateSharedOverclock();
+		return;
+	}
+
+	if (WorldScrollComponent)
+	{
+		WorldScrollComponent->SetOverclockMultiplier(bIsOverclockActive ? SpeedMultiplier : 1.0f, bIsOverclockActive);
+	}
 }
 
 //=============================================================================
@@ -248,19 +291,14 @@ void UOverclockSystemComponent::PlayOverclockSound(USoundBase* Sound)
 	// Try to get player location for 3D sound
 	FVector SoundLocation = FVector::ZeroVector;
 	
-	if (UWorld* World = GetWorld())
+	if (const AStateRunner_ArcadeCharacter* Character = UVersusModeComponent::FindPlayerSystems(this).Runner)
 	{
-		if (APlayerController* PC = World->GetFirstPlayerController())
-		{
-			if (APawn* Pawn = PC->GetPawn())
-			{
-				SoundLocation = Pawn->GetActorLocation();
-			}
-		}
+		SoundLocation = Character->GetActorLocation();
 	}
 
-	UGameplayStatics::PlaySoundAtLocation(
+	USFXSubsystem::PlaySFXAtLocation(
 		this,
+		ESFXCategory::Overclock,
 		Sound,
 		SoundLocation,
 		OverclockSoundVolume
@@ -277,34 +315,34 @@ void UOverclockSystemComponent::StartOverclockLoop()
 	// Stop any existing loop
 	StopOverclockLoop();
 
-	// Spawn a new looping audio component
-	if (UWorld* World = GetWorld())
+	// Reserve a pooled voice for the loop (spawned directly where there's no SFX subsystem)
+	if (AStateRunner_ArcadeCharacter* Pawn = UVersusModeComponent::FindPlayerSystems(this).Runner)
 	{
-		if (APlayerController* PC = World->GetFirstPlayerController())
+		if (USFXSubsystem* SFX = USFXSubsystem::Get(this))
 		{
-			if (APawn* Pawn = PC->GetPawn())
-			{
-				ActiveLoopAudio = UGameplayStatics::SpawnSoundAttached(
-					OverclockLoopSound,
-					Pawn->GetRootComponent(),
-					NAME_None,
-					FVector::ZeroVector,
-					EAttachLocation::KeepRelativeOffset,
-					false,  // Don't stop when attached-to is destroyed (we manage it)
-					OverclockSoundVolume,
-					1.0f,   // Pitch
-					0.0f,   // Start time
-					nullptr,
-					nullptr,
-					true    // Auto-destroy when finished (shouldn't happen for loops)
-				);
-
-				if (ActiveLoopAudio)
-				{
-					// Fade in
-					ActiveLoopAudio->FadeIn(LoopSoundFadeDuration);
-				}
-			}
+			ActiveLoopAudio = SFX->PlaySFXAttached(ESFXCategory::Overclock, OverclockLoopSound, Pawn->GetRootComponent(), OverclockSoundVolume, LoopSoundFadeDuration);
+			return;
+		}
+
+		ActiveLoopAudio = UGameplayStatics::SpawnSoundAttached(
+			OverclockLoopSound,
+			Pawn->GetRootComponent(),
+			NAME_None,
+			FVector::ZeroVector,
+			EAttachLocation::KeepRelativeOffset,
+			false,  // Don't stop when attached-to is destroyed (we manage it)
+			OverclockSoundVolume,
+			1.0f,   // Pitch
+			0.0f,   // Start time
+			nullptr,
+			nullptr,
+			true    // Auto-destroy when finished (shouldn't happen for loops)
+		);
+
+		if (ActiveLoopAudio)
+		{
+			// Fade in
+			ActiveLoopAudio->FadeIn(LoopSoundFadeDuration);
 		}
 	}
 }
@@ -313,8 +351,15 @@ void UOverclockSystemComponent::StopOverclockLoop()
 {
 	if (ActiveLoopAudio)
 	{
-		// Fade out and stop
-		ActiveLoopAudio->FadeOut(LoopSoundFadeDuration, 0.0f);
+		// Fade out and stop (and hand a pooled voice back)
+		if (USFXSubsystem* SFX = USFXSubsystem::Get(this))
+		{
+			SFX->ReleaseVoice(ActiveLoopAudio, LoopSoundFadeDuration);
+		}
+		else
+		{
+			ActiveLoopAudio->FadeOut(LoopSoundFadeDuration, 0.0f);
+		}
 		ActiveLoopAudio = nullptr;
 	}
 }
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "GameplaySimulationSubsystem.h"
 #include "OverclockSystemComponent.generated.h"
 
 class UWorldScrollComponent;
@@ -33,9 +34,14 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnOverclockMeterChanged, float, Cu
  * INTEGRATION:
  * - WorldScrollComponent: Speed multiplier
  * - ScoreSystemComponent: Bonus score rate
+ * - GameplaySimulationSubsystem: meter steps in phase Meters (TickComponent only
+ *   runs when fixed-step simulation is off)
+ *
+ * The meter only moves while the world is scrolling, so menus and the pre-run
+ * countdown cost nothing.
  */
 UCLASS(ClassGroup=(StateRunner), meta=(BlueprintSpawnableComponent))
-class STATERUNNER_ARCADE_API UOverclockSystemComponent : public UActorComponent
+class STATERUNNER_ARCADE_API UOverclockSystemComponent : public UActorComponent, public IGameplaySimulated
 {
 	GENERATED_BODY()
 
@@ -46,11 +52,16 @@ public:
 protected:
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
 
+	/** Fallback when fixed-step simulation is off */
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
+	/** Fixed-step mode: fill/drain the meter */
+	virtual void SimulateStep(float StepSeconds) override;
+
 	//=============================================================================
 	// OVERCLOCK CONFIGURATION
 	//=============================================================================
@@ -147,6 +158,9 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Category="OVERCLOCK")
 	float CurrentMeter = 0.0f;
 
+	/** Meter value at the last OnOverclockMeterChanged from UpdateMeter */
+	float LastBroadcastMeter = 0.0f;
+
 	/**
 	 * Whether OVERCLOCK is currently active.
 	 */
@@ -227,6 +241,9 @@ public:
 	UFUNCTION(BlueprintPure, Category="OVERCLOCK")
 	bool IsOverclockActive() const { return bIsOverclockActive; }
 
+	/** Scroll speed multiplier while active */
+	float GetSpeedMultiplier() const { return SpeedMultiplier; }
+
 	/** Check if OVERCLOCK can be activated (meter above threshold). */
 	UFUNCTION(BlueprintPure, Category="OVERCLOCK")
 	bool CanActivateOverclock() const { return CurrentMeter >= ActivationThreshold && !bIsOverclockActive; }
@@ -250,6 +267,12 @@ protected:
 	/** Update meter (fill or drain) */
 	void UpdateMeter(float DeltaTime);
 
+	/** Advance the meter and end OVERCLOCK once it's empty (tick or fixed step) */
+	void AdvanceOverclock(float DeltaTime);
+
+	/** Push the current multiplier to the world scroll (the shared max of all runners in versus) */
+	void ApplyScrollMultiplier();
+
 	/** Cache component references */
 	void CacheComponents();
 };
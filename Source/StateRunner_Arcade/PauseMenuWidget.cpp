@@ -5,6 +5,7 @@
 #include "GameFramework/PlayerController.h"
 #include "MusicPlayerWidget.h"
 #include "ThemeSelectorWidget.h"
+#include "StateRunner_ArcadePlayerController.h"
 #include "StateRunner_Arcade.h"
 
 UPauseMenuWidget::UPauseMenuWidget(const FObjectInitializer& ObjectInitializer)
@@ -172,15 +173,15 @@ void UPauseMenuWidget::OpenSettings()
 		return;
 	}
 
-	// Create and show settings widget
-	SettingsWidget = CreateWidget<UArcadeMenuWidget>(GetOwningPlayer(), SettingsWidgetClass);
+	// Show settings widget (cached on the controller after the first open)
+	SettingsWidget = AStateRunner_ArcadePlayerController::GetOrCreateWidget<UArcadeMenuWidget>(GetOwningPlayer(), SettingsWidgetClass);
 	if (SettingsWidget)
 	{
 		SettingsWidget->AddToViewport(20); // Above pause menu
 		SettingsWidget->TakeKeyboardFocus();
 
 		// Bind to settings back action to close it
-		SettingsWidget->OnBackPressed.AddDynamic(this, &UPauseMenuWidget::CloseSettings);
+		SettingsWidget->OnBackPressed.AddUniqueDynamic(this, &UPauseMenuWidget::CloseSettings);
 
 		// Hide pause menu while settings is open
 		SetVisibility(ESlateVisibility::Collapsed);
@@ -247,15 +248,15 @@ void UPauseMenuWidget::OpenThemeSelector()
 		return;
 	}
 
-	// Create and show theme selector widget
-	ThemeSelectorWidget = CreateWidget<UThemeSelectorWidget>(GetOwningPlayer(), ThemeSelectorWidgetClass);
+	// Show theme selector widget (cached on the controller after the first open)
+	ThemeSelectorWidget = AStateRunner_ArcadePlayerController::GetOrCreateWidget<UThemeSelectorWidget>(GetOwningPlayer(), ThemeSelectorWidgetClass);
 	if (ThemeSelectorWidget)
 	{
 		ThemeSelectorWidget->AddToViewport(20); // Above pause menu
 		ThemeSelectorWidget->TakeKeyboardFocus();
 
 		// Bind to back action to close it
-		ThemeSelectorWidget->OnBackPressed.AddDynamic(this, &UPauseMenuWidget::CloseThemeSelector);
+		ThemeSelectorWidget->OnBackPressed.AddUniqueDynamic(this, &UPauseMenuWidget::CloseThemeSelector);
 
 		// Hide pause menu while theme selector is open
 		SetVisibility(ESlateVisibility::Collapsed);
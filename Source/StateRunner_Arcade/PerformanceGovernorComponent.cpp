@@ -0,0 +1,345 @@
+#include "PerformanceGovernorComponent.h"
+#include "WorldScrollComponent.h"
+#include "OverclockSystemComponent.h"
+#include "PickupSpawnerComponent.h"
+#include "DisplaySettingsSubsystem.h"
+#include "StateRunner_ArcadeGameMode.h"
+#include "StateRunner_Arcade.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ConfigCacheIni.h"
+
+// The menu's pick lives with the other per-machine settings
+// Prefixed to avoid Unity build collisions
+static const FString PerformanceGovernor_ConfigSection = TEXT("/Script/StateRunner_Arcade.PerformanceGovernor");
+static const FString PerformanceGovernor_PresetKey = TEXT("Preset");
+
+/** Stepping back down once the pressure is off is quicker than stepping down under it */
+static constexpr float PerformanceGovernor_RestoreStepSeconds = 0.25f;
+
+static IConsoleVariable* PerformanceGovernor_FindVar(const TCHAR* Name)
+{
+	return IConsoleManager::Get().FindConsoleVariable(Name);
+}
+
+// --- Component Lifecycle ---
+
+UPerformanceGovernorComponent::UPerformanceGovernorComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+
+	// Samples the frame that just finished, after everything else ticked
+	PrimaryComponentTick.TickGroup = TG_PostUpdateWork;
+
+	// Quality: effects and distant detail only, resolution barely moves
+	QualityProfile.bReducePostProcess = false;
+	QualityProfile.MinScreenPercentage = 90.0f;
+
+	BalancedProfile.bReducePostProcess = true;
+	BalancedProfile.MinScreenPercentage = 75.0f;
+
+	// Performance: aims under the frame so spikes have margin
+	PerformanceProfile.TargetFrameMs = 15.5f;
+	PerformanceProfile.bReducePostProcess = true;
+	PerformanceProfile.MinScreenPercentage = 60.0f;
+}
+
+UPerformanceGovernorComponent* UPerformanceGovernorComponent::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	AStateRunner_ArcadeGameMode* GameMode = World ? Cast<AStateRunner_ArcadeGameMode>(World->GetAuthGameMode()) : nullptr;
+	return GameMode ? GameMode->GetPerformanceGovernorComponent() : nullptr;
+}
+
+void UPerformanceGovernorComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (AStateRunner_ArcadeGameMode* GameMode = Cast<AStateRunner_ArcadeGameMode>(GetOwner()))
+	{
+		WorldScroll = GameMode->GetWorldScrollComponent();
+		OverclockSystem = GameMode->GetOverclockSystemComponent();
+		PickupSpawner = GameMode->GetPickupSpawnerComponent();
+	}
+
+	if (OverclockSystem)
+	{
+		OverclockSystem->OnOverclockStateChanged.AddDynamic(this, &UPerformanceGovernorComponent::HandleOverclockStateChanged);
+	}
+
+	Preset = LoadSavedPreset();
+	BuildLadder();
+
+	SetComponentTickInterval(SampleInterval);
+	SetComponentTickEnabled(Preset != EPerformanceGovernorPreset::Off);
+
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("PerformanceGovernor: Preset %s, %d steps, target %.2f ms (OVERCLOCK or speed >= %.0f)"),
+		*GetPresetName(Preset), Ladder.Num(), GetProfile().TargetFrameMs, HighSpeedThreshold);
+}
+
+void UPerformanceGovernorComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// Never leave the engine settings lowered behind us
+	SetLevel(0);
+
+	if (OverclockSystem)
+	{
+		OverclockSystem->OnOverclockStateChanged.RemoveDynamic(this, &UPerformanceGovernorComponent::HandleOverclockStateChanged);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UPerformanceGovernorComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	SampleFrameTime();
+	UpdateLevel(DeltaTime);
+}
+
+// --- Events ---
+
+void UPerformanceGovernorComponent::HandleOverclockStateChanged(bool bIsActive)
+{
+	if (bIsActive)
+	{
+		TimeSinceLevelChange = FMath::Max(TimeSinceLevelChange, StepUpHoldSeconds);
+	}
+}
+
+// --- Public Functions ---
+
+void UPerformanceGovernorComponent::SetPreset(EPerformanceGovernorPreset NewPreset)
+{
+	if (NewPreset == Preset || NewPreset >= EPerformanceGovernorPreset::Count)
+	{
+		return;
+	}
+
+	SavePreset(NewPreset);
+
+	// Undo the old ladder before it's replaced
+	SetLevel(0);
+	Preset = NewPreset;
+	BuildLadder();
+	SetComponentTickEnabled(Preset != EPerformanceGovernorPreset::Off);
+
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("PerformanceGovernor: Preset changed to %s (%d steps)"), *GetPresetName(Preset), Ladder.Num());
+}
+
+bool UPerformanceGovernorComponent::IsUnderPressure() const
+{
+	return (OverclockSystem && OverclockSystem->IsOverclockActive())
+		|| (WorldScroll && WorldScroll->GetCurrentScrollSpeed() >= HighSpeedThreshold);
+}
+
+EPerformanceGovernorPreset UPerformanceGovernorComponent::LoadSavedPreset()
+{
+	int32 SavedPreset = INDEX_NONE;
+	if (GConfig->GetInt(*PerformanceGovernor_ConfigSection, *PerformanceGovernor_PresetKey, SavedPreset, GGameUserSettingsIni)
+		&& SavedPreset >= 0 && SavedPreset < static_cast<int32>(EPerformanceGovernorPreset::Count))
+	{
+		return static_cast<EPerformanceGovernorPreset>(SavedPreset);
+	}
+
+	return EPerformanceGovernorPreset::Balanced;
+}
+
+void UPerformanceGovernorComponent::SavePreset(EPerformanceGovernorPreset NewPreset)
+{
+	GConfig->SetInt(*PerformanceGovernor_ConfigSection, *PerformanceGovernor_PresetKey, static_cast<int32>(NewPreset), GGameUserSettingsIni);
+	GConfig->Flush(false, GGameUserSettingsIni);
+}
+
+FString UPerformanceGovernorComponent::GetPresetName(EPerformanceGovernorPreset InPreset)
+{
+	switch (InPreset)
+	{
+		case EPerformanceGovernorPreset::Off:         return TEXT("Off");
+		case EPerformanceGovernorPreset::Quality:     return TEXT("Quality");
+		case EPerformanceGovernorPreset::Balanced:    return TEXT("Balanced");
+		case EPerformanceGovernorPreset::Performance: return TEXT("Performance");
+		default:                                      return TEXT("???");
+	}
+}
+
+// --- Internal Functions ---
+
+const FPerformanceGovernorProfile& UPerformanceGovernorComponent::GetProfile() const
+{
+	switch (Preset)
+	{
+		case EPerformanceGovernorPreset::Quality:     return QualityProfile;
+		case EPerformanceGovernorPreset::Performance: return PerformanceProfile;
+		default:                                      return BalancedProfile;
+	}
+}
+
+void UPerformanceGovernorComponent::BuildLadder()
+{
+	Ladder.Reset();
+	if (Preset == EPerformanceGovernorPreset::Off)
+	{
+		return;
+	}
+
+	// Cheapest-looking rungs first; resolution is the big GPU lever, so it goes last
+	const FPerformanceGovernorProfile& Profile = GetProfile();
+	if (Profile.bReducePickupEffects)
+	{
+		Ladder.Add(EGovernorStep::PickupEffects);
+	}
+	if (Profile.bReduceDistantDetail)
+	{
+		Ladder.Add(EGovernorStep::DistantDetail);
+	}
+	if (Profile.bReducePostProcess)
+	{
+		Ladder.Add(EGovernorStep::PostProcess);
+	}
+
+	const int32 ResolutionSteps = FMath::CeilToInt((100.0f - Profile.MinScreenPercentage) / ScreenPercentageStep);
+	for (int32 i = 0; i < ResolutionSteps; i++)
+	{
+		Ladder.Add(EGovernorStep::Resolution);
+	}
+}
+
+void UPerformanceGovernorComponent::SampleFrameTime()
+{
+	float GameThreadMs, GPUMs;
+	UDisplaySettingsSubsystem::GetLastFrameTimings(GameThreadMs, GPUMs);
+
+	if (!bHasSamples)
+	{
+		SmoothedGameThreadMs = GameThreadMs;
+		SmoothedGPUMs = GPUMs;
+		bHasSamples = true;
+		return;
+	}
+
+	SmoothedGameThreadMs = FMath::Lerp(SmoothedGameThreadMs, GameThreadMs, SampleSmoothing);
+	SmoothedGPUMs = FMath::Lerp(SmoothedGPUMs, GPUMs, SampleSmoothing);
+}
+
+void UPerformanceGovernorComponent::UpdateLevel(float DeltaTime)
+{
+	TimeSinceLevelChange += DeltaTime;
+
+	const float TargetMs = GetProfile().TargetFrameMs;
+	const float FrameMs = FMath::Max(SmoothedGameThreadMs, SmoothedGPUMs);
+	const bool bUnderPressure = IsUnderPressure();
+
+	if (bUnderPressure && FrameMs > TargetMs)
+	{
+		TimeWithHeadroom = 0.0f;
+		if (CurrentLevel < Ladder.Num() && TimeSinceLevelChange >= StepUpHoldSeconds)
+		{
+			SetLevel(CurrentLevel + 1);
+		}
+		return;
+	}
+
+	if (CurrentLevel == 0)
+	{
+		return;
+	}
+
+	// Between the headroom line and the target: hold
+	if (bUnderPressure && FrameMs >= TargetMs * HeadroomFraction)
+	{
+		TimeWithHeadroom = 0.0f;
+		return;
+	}
+
+	TimeWithHeadroom += DeltaTime;
+	const float HoldSeconds = bUnderPressure ? StepDownHoldSeconds : PerformanceGovernor_RestoreStepSeconds;
+	if (TimeWithHeadroom >= HoldSeconds)
+	{
+		SetLevel(CurrentLevel - 1);
+	}
+}
+
+void UPerformanceGovernorComponent::SetLevel(int32 NewLevel)
+{
+	NewLevel = FMath::Clamp(NewLevel, 0, Ladder.Num());
+	if (NewLevel == CurrentLevel)
+	{
+		return;
+	}
+
+	IConsoleVariable* ScreenPercentageVar = PerformanceGovernor_FindVar(TEXT("r.ScreenPercentage"));
+	IConsoleVariable* LODDistanceScaleVar = PerformanceGovernor_FindVar(TEXT("r.StaticMeshLODDistanceScale"));
+	IConsoleVariable* PostProcessQualityVar = PerformanceGovernor_FindVar(TEXT("sg.PostProcessQuality"));
+
+	if (CurrentLevel == 0)
+	{
+		Baseline.ScreenPercentage = ScreenPercentageVar ? ScreenPercentageVar->GetFloat() : 100.0f;
+		Baseline.LODDistanceScale = LODDistanceScaleVar ? LODDistanceScaleVar->GetFloat() : 1.0f;
+		Baseline.PostProcessQuality = PostProcessQualityVar ? PostProcessQualityVar->GetInt() : 3;
+	}
+
+	// Only touch what changed: an sg.* write re-applies its whole scalability group
+	const auto StepChanged = [this, NewLevel](EGovernorStep Step)
+	{
+		return CountSteps(Step, NewLevel) != CountSteps(Step, CurrentLevel);
+	};
+
+	if (StepChanged(EGovernorStep::PickupEffects) && PickupSpawner)
+	{
+		PickupSpawner->SetPickupEffectsReduced(CountSteps(EGovernorStep::PickupEffects, NewLevel) > 0);
+	}
+
+	if (StepChanged(EGovernorStep::DistantDetail) && LODDistanceScaleVar)
+	{
+		const bool bReduced = CountSteps(EGovernorStep::DistantDetail, NewLevel) > 0;
+		LODDistanceScaleVar->Set(bReduced ? Baseline.LODDistanceScale * DistantDetailLODScale : Baseline.LODDistanceScale, ECVF_SetByGameSetting);
+	}
+
+	if (StepChanged(EGovernorStep::PostProcess) && PostProcessQualityVar)
+	{
+		const int32 Quality = FMath::Max(Baseline.PostProcessQuality - CountSteps(EGovernorStep::PostProcess, NewLevel), 0);
+		PostProcessQualityVar->Set(Quality, ECVF_SetByGameSetting);
+	}
+
+	if (StepChanged(EGovernorStep::Resolution) && ScreenPercentageVar)
+	{
+		const int32 ResolutionSteps = CountSteps(EGovernorStep::Resolution, NewLevel);
+		if (ResolutionSteps == 0)
+		{
+			ScreenPercentageVar->Set(Baseline.ScreenPercentage, ECVF_SetByGameSetting);
+		}
+		else
+		{
+			// A baseline of 0 or less means the engine default (100); never step above where we started
+			const float StartPercentage = Baseline.ScreenPercentage > 0.0f ? Baseline.ScreenPercentage : 100.0f;
+			const float Percentage = FMath::Max(StartPercentage - ResolutionSteps * ScreenPercentageStep, GetProfile().MinScreenPercentage);
+			ScreenPercentageVar->Set(FMath::Min(Percentage, StartPercentage), ECVF_SetByGameSetting);
+		}
+	}
+
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("PerformanceGovernor: Level %d -> %d of %d (GT %.1f ms, GPU %.1f ms, target %.1f ms)"),
+		CurrentLevel, NewLevel, Ladder.Num(), SmoothedGameThreadMs, SmoothedGPUMs, GetProfile().TargetFrameMs);
+
+	CurrentLevel = NewLevel;
+	TimeSinceLevelChange = 0.0f;
+	TimeWithHeadroom = 0.0f;
+}
+
+int32 UPerformanceGovernorComponent::CountSteps(EGovernorStep Step, int32 Level) const
+{
+	int32 Count = 0;
+	for (int32 i = 0; i < Level && i < Ladder.Num(); i++)
+	{
+		Count += Ladder[i] == Step ? 1 : 0;
+	}
+	return Count;
+}
@@ -0,0 +1,244 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "PerformanceGovernorComponent.generated.h"
+
+class UWorldScrollComponent;
+class UOverclockSystemComponent;
+class UPickupSpawnerComponent;
+
+/**
+ * How hard the performance governor may trade quality for frame time.
+ * Picked in the settings menu, saved in GameUserSettings.
+ */
+UENUM(BlueprintType)
+enum class EPerformanceGovernorPreset : uint8
+{
+	Off			UMETA(DisplayName = "Off"),
+	Quality		UMETA(DisplayName = "Quality"),
+	Balanced	UMETA(DisplayName = "Balanced"),
+	Performance	UMETA(DisplayName = "Performance"),
+	Count		UMETA(Hidden)
+};
+
+/**
+ * What one preset is allowed to scale, and the frame time it holds.
+ */
+USTRUCT(BlueprintType)
+struct FPerformanceGovernorProfile
+{
+	GENERATED_BODY()
+
+	/** Frame time to hold (ms), checked against the slower of game thread and GPU */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Governor", meta=(ClampMin="4.0"))
+	float TargetFrameMs = 16.67f;
+
+	/** Turn pickup spin and bob off */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Governor")
+	bool bReducePickupEffects = true;
+
+	/** Scale r.StaticMeshLODDistanceScale so far obstacles drop LODs sooner */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Governor")
+	bool bReduceDistantDetail = true;
+
+	/** Drop sg.PostProcessQuality one level */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Governor")
+	bool bReducePostProcess = false;
+
+	/** Lowest r.ScreenPercentage the governor steps down to (100 = resolution untouched) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Governor", meta=(ClampMin="25.0", ClampMax="100.0"))
+	float MinScreenPercentage = 100.0f;
+};
+
+/**
+ * Performance Governor Component
+ *
+ * Frame-time spikes cluster around OVERCLOCK: the camera zooms, scroll speed jumps and the
+ * pickup density goes up together. While OVERCLOCK is active or the scroll speed is past
+ * HighSpeedThreshold, this samples game thread and GPU frame time and walks a quality ladder
+ * one step at a time while the smoothed frame time stays over the preset's target:
+ *
+ *   pickup spin/bob off -> distant detail (LOD distance) -> post-process tier -> resolution steps
+ *
+ * Rungs the preset doesn't allow are left out. Once the pressure is gone (or there is plenty
+ * of headroom) it steps back down, and the engine settings it touched are restored to what
+ * they were when it first stepped up. The same happens at EndPlay.
+ *
+ * Settings are written at ECVF_SetByGameSetting, like the hardware tier's, so the settings
+ * menu keeps working while the governor has them lowered. Attached to GameMode.
+ */
+UCLASS(ClassGroup=(StateRunner), meta=(BlueprintSpawnableComponent))
+class STATERUNNER_ARCADE_API UPerformanceGovernorComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+
+	UPerformanceGovernorComponent();
+
+	/** Get the running GameMode's governor (null outside a run) */
+	static UPerformanceGovernorComponent* Get(const UObject* WorldContextObject);
+
+protected:
+
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+public:
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	// --- Configuration ---
+
+protected:
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Governor|Presets")
+	FPerformanceGovernorProfile QualityProfile;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Governor|Presets")
+	FPerformanceGovernorProfile BalancedProfile;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Governor|Presets")
+	FPerformanceGovernorProfile PerformanceProfile;
+
+	/** Scroll speed (OVERCLOCK included) from which the governor is active without OVERCLOCK */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Governor", meta=(ClampMin="0.0"))
+	float HighSpeedThreshold = 2750.0f;
+
+	/** Seconds between frame time samples (also the tick interval) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Governor", meta=(ClampMin="0.02", ClampMax="1.0"))
+	float SampleInterval = 0.1f;
+
+	/** Weight of each new sample in the smoothed frame time */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Governor", meta=(ClampMin="0.05", ClampMax="1.0"))
+	float SampleSmoothing = 0.3f;
+
+	/** Seconds to hold a step before going up another (lets the new setting show in the timings) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Governor", meta=(ClampMin="0.0"))
+	float StepUpHoldSeconds = 0.5f;
+
+	/** Seconds of headroom (or no pressure) before stepping back down one */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Governor", meta=(ClampMin="0.0"))
+	float StepDownHoldSeconds = 1.5f;
+
+	/** Under pressure, step down when the smoothed frame time is below this fraction of the target */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Governor", meta=(ClampMin="0.1", ClampMax="0.95"))
+	float HeadroomFraction = 0.7f;
+
+	/** r.ScreenPercentage taken off per resolution step */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Governor", meta=(ClampMin="1.0", ClampMax="50.0"))
+	float ScreenPercentageStep = 10.0f;
+
+	/** r.StaticMeshLODDistanceScale multiplier on the distant detail step */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Governor", meta=(ClampMin="1.0", ClampMax="8.0"))
+	float DistantDetailLODScale = 2.0f;
+
+	// --- Runtime State ---
+
+protected:
+
+	/** One rung of the quality ladder */
+	enum class EGovernorStep : uint8
+	{
+		PickupEffects,
+		DistantDetail,
+		PostProcess,
+		Resolution
+	};
+
+	/** Engine settings as they were before the governor stepped up */
+	struct FBaselineSettings
+	{
+		float ScreenPercentage = 100.0f;
+		float LODDistanceScale = 1.0f;
+		int32 PostProcessQuality = 3;
+	};
+
+	UPROPERTY()
+	TObjectPtr<UWorldScrollComponent> WorldScroll;
+
+	UPROPERTY()
+	TObjectPtr<UOverclockSystemComponent> OverclockSystem;
+
+	UPROPERTY()
+	TObjectPtr<UPickupSpawnerComponent> PickupSpawner;
+
+	EPerformanceGovernorPreset Preset = EPerformanceGovernorPreset::Balanced;
+
+	/** Rungs the current preset allows, lowest first (Resolution repeats once per step) */
+	TArray<EGovernorStep> Ladder;
+
+	/** Rungs applied (0 = full quality) */
+	int32 CurrentLevel = 0;
+
+	/** Captured when stepping up from level 0, written back at level 0 */
+	FBaselineSettings Baseline;
+
+	float SmoothedGameThreadMs = 0.0f;
+	float SmoothedGPUMs = 0.0f;
+	bool bHasSamples = false;
+
+	/** Seconds since the level last changed */
+	float TimeSinceLevelChange = 0.0f;
+
+	/** Seconds the frame time has been under the headroom line (or the pressure off) */
+	float TimeWithHeadroom = 0.0f;
+
+	// --- Events ---
+
+protected:
+
+	/** OVERCLOCK's spike lands on activation, so the next over-budget sample steps up straight away */
+	UFUNCTION()
+	void HandleOverclockStateChanged(bool bIsActive);
+
+	// --- Public Functions ---
+
+public:
+
+	UFUNCTION(BlueprintPure, Category="Governor")
+	EPerformanceGovernorPreset GetPreset() const { return Preset; }
+
+	/** Switch preset, save it, and restore full quality (the new ladder starts from the bottom) */
+	UFUNCTION(BlueprintCallable, Category="Governor")
+	void SetPreset(EPerformanceGovernorPreset NewPreset);
+
+	/** Rungs currently applied (0 = full quality) */
+	UFUNCTION(BlueprintPure, Category="Governor")
+	int32 GetCurrentLevel() const { return CurrentLevel; }
+
+	/** True while OVERCLOCK or high speed lets the governor step up */
+	UFUNCTION(BlueprintPure, Category="Governor")
+	bool IsUnderPressure() const;
+
+	/** Preset saved in GameUserSettings (Balanced if none) */
+	static EPerformanceGovernorPreset LoadSavedPreset();
+
+	/** Save a preset without a run (the settings menu outside gameplay) */
+	static void SavePreset(EPerformanceGovernorPreset NewPreset);
+
+	/** Display name for a preset */
+	static FString GetPresetName(EPerformanceGovernorPreset InPreset);
+
+	// --- Internal Functions ---
+
+protected:
+
+	const FPerformanceGovernorProfile& GetProfile() const;
+
+	/** Rebuild the ladder from the current preset's profile */
+	void BuildLadder();
+
+	/** Fold this frame's game thread and GPU time into the smoothed values */
+	void SampleFrameTime();
+
+	/** Step up, step down, or hold */
+	void UpdateLevel(float DeltaTime);
+
+	/** Apply the first NewLevel rungs and undo the rest */
+	void SetLevel(int32 NewLevel);
+
+	/** Number of rungs of one kind in the first Level rungs */
+	int32 CountSteps(EGovernorStep Step, int32 Level) const;
+};
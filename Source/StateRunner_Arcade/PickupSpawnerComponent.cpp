@@ -5,11 +5,17 @@
 #include "StateRunner_ArcadeGameMode.h"
 #include "WorldScrollComponent.h"
 #include "GameDebugSubsystem.h"
+#include "DifficultyDirectorComponent.h"
+#include "HardwareTierSubsystem.h"
+#include "RunSeedSubsystem.h"
 #include "StateRunner_Arcade.h"
 #include "StateRunner_ArcadeCharacter.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/World.h"
+#include "TimerManager.h"
 #include "Engine/Engine.h"
+#include "GameFramework/GameUserSettings.h"
+#include "Algo/BinarySearch.h"
 
 UPickupSpawnerComponent::UPickupSpawnerComponent()
 {
@@ -24,6 +30,8 @@ void UPickupSpawnerComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
+	LayoutRandom.Initialize(URunSeedSubsystem::GetStreamFor(this, ERunRandomStream::PickupLayout).GetInitialSeed());
+
 	// Validate pickup class is set
 	TSubclassOf<ABasePickup> DataPacketClassToUse = GetClassForType(EPickupType::DataPacket);
 	if (!DataPacketClassToUse)
@@ -60,28 +68,61 @@ void UPickupSpawnerComponent::BeginPlay()
 		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("PickupSpawner: MagnetClass is NOT SET! Magnets will not spawn. Assign BP_Pickup_Magnet in GameMode Blueprint."));
 	}
 
+	LoadPoolHistory();
+	InitializePrewarmQueue();
 	InitializePools();
 
+	// Offset tables for every procedural pattern, so a segment's pattern is a scaled copy
+	BuildPatternTemplates();
+
+	// Fixed-step mode: the magnet pull integrates at the simulation rate
+	if (UGameplaySimulationSubsystem* Simulation = UGameplaySimulationSubsystem::Get(this))
+	{
+		if (Simulation->IsFixedStepEnabled())
+		{
+			Simulation->RegisterParticipant(this, this, ESimulationPhase::Pickups);
+			bSimulationDriven = true;
+		}
+	}
+
 	// Log init summary to debug subsystem
 	if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
 	{
 		FString InitInfo = FString::Printf(
-			TEXT("Pools: DP:%d 1Up:%d EMP:%d\nPatterns: %d"),
-			DataPacketPool.Num(), OneUpPool.Num(), EMPPool.Num(), PredefinedPatterns.Num()
+			TEXT("Pools: DP:%d 1Up:%d EMP:%d%s\nPatterns: %d (%d templates)"),
+			GetPoolForType(EPickupType::DataPacket).Num(), GetPoolForType(EPickupType::OneUp).Num(), GetPoolForType(EPickupType::EMP).Num(),
+			PrewarmQueue.HasWork() ? TEXT(" prewarming...") : TEXT(""), PredefinedPatterns.Num(), PatternTemplates.Num()
 		);
 		Debug->LogInit(TEXT("PickupSpawner"), InitInfo);
 	}
 }
 
+void UPickupSpawnerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	SavePoolHistory();
+
+	if (UGameplaySimulationSubsystem* Simulation = UGameplaySimulationSubsystem::Get(this))
+	{
+		Simulation->UnregisterParticipant(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 // --- Public Functions ---
 
 void UPickupSpawnerComponent::SpawnPickupsForSegment(float SegmentStartX, float SegmentEndX)
 {
+	STATERUNNER_SCOPE_CYCLE_COUNTER(SpawnPickups);
+
 	SegmentsSpawned++;
 	
 	// Update density level
 	UpdateDensity();
 
+	// Grow pools ahead of demand rather than on exhaustion
+	UpdatePredictivePrewarm();
+
 	// Spawn all pickup types after tutorial for testing
 	if (bDebugSpawnAllPickupTypes && !bDebugPickupsSpawned)
 	{
@@ -107,9 +148,11 @@ void UPickupSpawnerComponent::SpawnPickupsForSegment(float SegmentStartX, float
 	CacheObstaclePositions(SegmentStartX, SegmentEndX);
 
 	// Generate layout - try pattern first, fall back to random
-	TArray<FPickupSpawnData> PickupLayout;
+	// (into the reused scratch array, so a segment doesn't allocate)
+	TArray<FPickupSpawnData>& PickupLayout = PickupLayoutScratch;
+	PickupLayout.Reset();
 	
-	bool bUsePattern = FMath::FRand() < PatternChance;
+	bool bUsePattern = LayoutRandom.FRand() < PatternChance;
 	
 	if (bUsePattern && GenerateFromPattern(PickupLayout))
 	{
@@ -118,6 +161,7 @@ void UPickupSpawnerComponent::SpawnPickupsForSegment(float SegmentStartX, float
 	else
 	{
 		// Fall back to procedural generation
+		PickupLayout.Reset();
 		int32 PickupCount = CalculatePickupCount();
 		GeneratePickupLayout(PickupLayout, PickupCount);
 	}
@@ -133,7 +177,7 @@ void UPickupSpawnerComponent::SpawnPickupsForSegment(float SegmentStartX, float
 		ABasePickup* Pickup = GetPickupFromPool(EPickupType::DataPacket);
 		if (!Pickup)
 		{
-			UE_LOG(LogStateRunner_Arcade, Warning, TEXT("Failed to get Data Packet from pool! Pool size: %d"), DataPacketPool.Num());
+			UE_LOG(LogStateRunner_Arcade, Warning, TEXT("Failed to get Data Packet from pool! Pool size: %d"), GetPoolForType(EPickupType::DataPacket).Num());
 			continue;
 		}
 
@@ -147,7 +191,7 @@ void UPickupSpawnerComponent::SpawnPickupsForSegment(float SegmentStartX, float
 		if (FindSafeSpawnPosition(DesiredLocation, SpawnData.Lane, SafeLocation))
 		{
 			Pickup->Activate(SafeLocation, SpawnData.Lane);
-			ActivePickups.Add(Pickup);
+			AddActivePickup(Pickup);
 			OnPickupSpawned.Broadcast(Pickup, SpawnData);
 			PickupsSpawned++;
 		}
@@ -187,11 +231,15 @@ void UPickupSpawnerComponent::SpawnPickupsForSegment(float SegmentStartX, float
 			SpawnMagnet(SegmentStartX, SegmentEndX);
 		}
 	}
+
+	UpdatePoolStats();
 }
 
 void UPickupSpawnerComponent::ClearAllPickups()
 {
-	for (ABasePickup* Pickup : ActivePickups)
+	// Deactivate() swap-removes from ActivePickups, so iterate a snapshot
+	const TArray<TObjectPtr<ABasePickup>> PickupsToClear = ActivePickups.GetArray();
+	for (ABasePickup* Pickup : PickupsToClear)
 	{
 		if (Pickup && Pickup->IsActive())
 		{
@@ -199,7 +247,8 @@ void UPickupSpawnerComponent::ClearAllPickups()
 		}
 	}
 
-	ActivePickups.Empty();
+	ActivePickups.Reset();
+	PickupXIndex.Reset();
 }
 
 void UPickupSpawnerComponent::ResetSpawner()
@@ -220,18 +269,10 @@ void UPickupSpawnerComponent::ResetSpawner()
 	if (bIsMagnetActive)
 	{
 		OnMagnetStateChanged.Broadcast(false);
-		if (UWorld* World = GetWorld())
-		{
-			if (APlayerController* PC = World->GetFirstPlayerController())
-			{
-				if (AStateRunner_ArcadeCharacter* Character = Cast<AStateRunner_ArcadeCharacter>(PC->GetPawn()))
-				{
-					Character->SetMagnetEffectActive(false);
-				}
-			}
-		}
+		SetMagnetRunnerEffect(false);
 	}
 	bIsMagnetActive = false;
+	MagnetRunner.Reset();
 	MagnetTimeRemaining = 0.0f;
 	SetComponentTickEnabled(false);
 }
@@ -242,7 +283,7 @@ void UPickupSpawnerComponent::GeneratePickupLayout(TArray<FPickupSpawnData>& Out
 {
 	OutPickups.Reserve(PickupCount);
 
-	TArray<float> UsedXOffsets;
+	TArray<float, TInlineAllocator<16>> UsedXOffsets;
 
 	for (int32 i = 0; i < PickupCount; i++)
 	{
@@ -258,7 +299,7 @@ void UPickupSpawnerComponent::GeneratePickupLayout(TArray<FPickupSpawnData>& Out
 
 		do
 		{
-			XOffset = FMath::FRandRange(GetEffectiveMinSpawnOffset(), GetEffectiveMaxSpawnOffset());
+			XOffset = LayoutRandom.FRandRange(GetEffectiveMinSpawnOffset(), GetEffectiveMaxSpawnOffset());
 			Attempts++;
 		}
 		while (Attempts < MaxAttempts && UsedXOffsets.ContainsByPredicate(
@@ -285,7 +326,7 @@ int32 UPickupSpawnerComponent::CalculatePickupCount() const
 		BaseCount += HighDensityBonusPickups;
 	}
 	
-	int32 RandomVariance = FMath::RandRange(-1, 1);
+	int32 RandomVariance = LayoutRandom.RandRange(-1, 1);
 	return FMath::Clamp(BaseCount + RandomVariance, MinPickupsPerSegment, MaxPickupsPerSegment);
 }
 
@@ -314,10 +355,16 @@ void UPickupSpawnerComponent::GetAerialPatternBounds(float& OutStartX, float& Ou
 
 void UPickupSpawnerComponent::InitializePools()
 {
-	InitializePoolForType(EPickupType::DataPacket);
-	InitializePoolForType(EPickupType::OneUp);
-	InitializePoolForType(EPickupType::EMP);
-	InitializePoolForType(EPickupType::Magnet);
+	// Tier budget for this run (0 = uncapped); a tier change in the menu applies from the next run
+	if (const UHardwareTierSubsystem* HardwareTier = UHardwareTierSubsystem::Get(this))
+	{
+		PoolSizeCap = HardwareTier->GetProfile().MaxPickupPoolSize;
+	}
+
+	for (EPickupType Type : AllPickupTypes)
+	{
+		InitializePoolForType(Type);
+	}
 }
 
 void UPickupSpawnerComponent::InitializePoolForType(EPickupType Type)
@@ -327,27 +374,22 @@ void UPickupSpawnerComponent::InitializePoolForType(EPickupType Type)
 	if (!ClassToUse)
 	{
 		// EMP and Magnet classes are optional
-		if (Type != EPickupType::EMP && Type != EPickupType::Magnet)
+		if (!GetPickupTypeTraits(Type).bOptionalClass)
 		{
 			UE_LOG(LogStateRunner_Arcade, Warning, TEXT("PickupSpawnerComponent: No class set for pickup type %d!"), (int32)Type);
 		}
 		return;
 	}
 
-	TArray<TObjectPtr<ABasePickup>>& Pool = GetPoolForType(Type);
-	
-	int32 PoolSize;
-	switch (Type)
-	{
-		case EPickupType::OneUp: PoolSize = OneUpPoolSize; break;
-		case EPickupType::EMP: PoolSize = EMPPoolSize; break;
-		case EPickupType::Magnet: PoolSize = MagnetPoolSize; break;
-		default: PoolSize = InitialPoolSize; break;
-	}
+	TActorPool<ABasePickup>& Pool = GetPoolForType(Type);
 	
+	const int32 PoolSize = UHardwareTierSubsystem::ApplyCap(GetInitialPoolSize(Type), PoolSizeCap);
 	Pool.Reserve(PoolSize);
 
-	for (int32 i = 0; i < PoolSize; i++)
+	// Time-sliced: spawn just enough to start, the scheduler fills the rest over the intro
+	const int32 SyncCount = bTimeSlicedPrewarm ? FMath::Min(PrewarmBootstrapCount, PoolSize) : PoolSize;
+
+	for (int32 i = 0; i < SyncCount; i++)
 	{
 		ABasePickup* Pickup = SpawnPickupActor(Type);
 		if (Pickup)
@@ -355,88 +397,143 @@ void UPickupSpawnerComponent::InitializePoolForType(EPickupType Type)
 			Pool.Add(Pickup);
 		}
 	}
+
+	RequestPrewarm(Type, PoolSize);
+}
+
+int32 UPickupSpawnerComponent::GetInitialPoolSize(EPickupType Type) const
+{
+	const int32 RecordedPeak = RecordedPoolPeaks[(int32)Type];
+	if (bAdaptivePoolSizing && RecordedPeak > 0)
+	{
+		// 200 matches the InitialPoolSize clamp
+		return FMath::Clamp(FMath::CeilToInt(RecordedPeak * AdaptivePoolMargin), AdaptiveMinPoolSize, 200);
+	}
+
+	// Designer-set size per type, indexed by EPickupType
+	static constexpr int32 UPickupSpawnerComponent::* PoolSizeByType[NumPickupTypes] =
+	{
+		&UPickupSpawnerComponent::InitialPoolSize,
+		&UPickupSpawnerComponent::OneUpPoolSize,
+		&UPickupSpawnerComponent::EMPPoolSize,
+		&UPickupSpawnerComponent::MagnetPoolSize
+	};
+	return this->*PoolSizeByType[static_cast<int32>(Type)];
+}
+
+void UPickupSpawnerComponent::LoadPoolHistory()
+{
+	if (!bAdaptivePoolSizing)
+	{
+		return;
+	}
+
+	FPoolHistory::Load<EPickupType>(RecordedPoolPeaks);
+
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("PickupSpawner: Recorded pool peaks DP:%d 1Up:%d EMP:%d Mag:%d"),
+		RecordedPoolPeaks[0], RecordedPoolPeaks[1], RecordedPoolPeaks[2], RecordedPoolPeaks[3]);
+}
+
+void UPickupSpawnerComponent::SavePoolHistory() const
+{
+	// Nothing ever spawned (quit during countdown) -- don't decay history for an empty session
+	if (!bAdaptivePoolSizing || ActivePickups.GetHighWaterMark() == 0)
+	{
+		return;
+	}
+
+	FPoolHistory::Save<EPickupType>(RecordedPoolPeaks, [this](int32 TypeIndex)
+	{
+		return GetPoolForType((EPickupType)TypeIndex).GetHighWaterMark();
+	}, PoolHistoryDecay);
+
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("PickupSpawner: Saved session pool peaks DP:%d 1Up:%d EMP:%d Mag:%d"),
+		GetPoolHighWaterMark(EPickupType::DataPacket), GetPoolHighWaterMark(EPickupType::OneUp),
+		GetPoolHighWaterMark(EPickupType::EMP), GetPoolHighWaterMark(EPickupType::Magnet));
 }
 
 ABasePickup* UPickupSpawnerComponent::GetPickupFromPool(EPickupType Type)
 {
-	TArray<TObjectPtr<ABasePickup>>& Pool = GetPoolForType(Type);
+	TActorPool<ABasePickup>& Pool = GetPoolForType(Type);
 	
-	// Find inactive pickup
-	for (ABasePickup* Pickup : Pool)
+	// O(1) pop from the free stack
+	if (ABasePickup* Pickup = Pool.Acquire())
 	{
-		if (Pickup && !Pickup->IsActive())
-		{
-			return Pickup;
-		}
+		return Pickup;
 	}
 
-	// Pool exhausted, expand it
+	// Pool exhausted -- prewarm fell behind demand, expand synchronously
+	if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
+	{
+		Debug->RecordEvent(EDebugCategory::Spawning, EDebugEventId::PickupPoolExhausted, (int32)Type, Pool.Num());
+	}
 	ExpandPool(Type);
 
 	// Try again
-	for (ABasePickup* Pickup : Pool)
+	if (ABasePickup* Pickup = Pool.Acquire())
 	{
-		if (Pickup && !Pickup->IsActive())
-		{
-			return Pickup;
-		}
+		return Pickup;
+	}
+
+	if (PoolSizeCap > 0 && Pool.Num() >= PoolSizeCap)
+	{
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("Pickup pool %d at its hardware tier cap (%d), skipping spawn"), (int32)Type, PoolSizeCap);
+		return nullptr;
 	}
 
 	UE_LOG(LogStateRunner_Arcade, Warning, TEXT("Failed to get pickup from pool after expansion!"));
 	return nullptr;
 }
 
-TArray<TObjectPtr<ABasePickup>>& UPickupSpawnerComponent::GetPoolForType(EPickupType Type)
+int32 UPickupSpawnerComponent::GetTotalPooledCount() const
 {
-	switch (Type)
+	int32 Total = 0;
+	for (const TActorPool<ABasePickup>& Pool : PickupPools)
 	{
-		case EPickupType::OneUp:
-			return OneUpPool;
-		case EPickupType::EMP:
-			return EMPPool;
-		case EPickupType::Magnet:
-			return MagnetPool;
-		case EPickupType::DataPacket:
-		default:
-			return DataPacketPool;
+		Total += Pool.Num();
 	}
+	return Total;
 }
 
 TSubclassOf<ABasePickup> UPickupSpawnerComponent::GetClassForType(EPickupType Type) const
 {
-	switch (Type)
+	// Designer-set class per type, indexed by EPickupType
+	static constexpr TSubclassOf<ABasePickup> UPickupSpawnerComponent::* ClassByType[NumPickupTypes] =
 	{
-		case EPickupType::OneUp:
-			return OneUpClass;
-		case EPickupType::EMP:
-			return EMPClass;
-		case EPickupType::Magnet:
-			return MagnetClass;
-		case EPickupType::DataPacket:
-		default:
-			if (DataPacketClass)
-			{
-				return DataPacketClass;
-			}
-			return PickupClass; // Backward compatibility
+		&UPickupSpawnerComponent::DataPacketClass,
+		&UPickupSpawnerComponent::OneUpClass,
+		&UPickupSpawnerComponent::EMPClass,
+		&UPickupSpawnerComponent::MagnetClass
+	};
+
+	const TSubclassOf<ABasePickup>& TypeClass = this->*ClassByType[static_cast<int32>(Type)];
+	if (!TypeClass && Type == EPickupType::DataPacket)
+	{
+		return PickupClass; // Backward compatibility
 	}
+	return TypeClass;
 }
 
 void UPickupSpawnerComponent::ExpandPool(EPickupType Type)
 {
-	TArray<TObjectPtr<ABasePickup>>& Pool = GetPoolForType(Type);
+	STATERUNNER_LLM_SCOPE(PickupPool);
+	STATERUNNER_FRAME_EVENT(PickupPoolExpanded);
+
+	TActorPool<ABasePickup>& Pool = GetPoolForType(Type);
 	
 	// Rare pickups get smaller expansion
-	int32 ExpansionSize;
-	switch (Type)
-	{
-		case EPickupType::OneUp: ExpansionSize = 3; break;
-		case EPickupType::EMP: ExpansionSize = 2; break;
-		case EPickupType::Magnet: ExpansionSize = 2; break;
-		default: ExpansionSize = PoolExpansionSize; break;
-	}
+	const int32 TypeExpansionSize = GetPickupTypeTraits(Type).PoolExpansionSize;
+	int32 ExpansionSize = TypeExpansionSize > 0 ? TypeExpansionSize : PoolExpansionSize;
 	
 	int32 OldSize = Pool.Num();
+	if (PoolSizeCap > 0)
+	{
+		ExpansionSize = FMath::Min(ExpansionSize, PoolSizeCap - OldSize);
+	}
+	if (ExpansionSize <= 0)
+	{
+		return;
+	}
 	Pool.Reserve(OldSize + ExpansionSize);
 
 	for (int32 i = 0; i < ExpansionSize; i++)
@@ -451,6 +548,8 @@ void UPickupSpawnerComponent::ExpandPool(EPickupType Type)
 
 ABasePickup* UPickupSpawnerComponent::SpawnPickupActor(EPickupType Type)
 {
+	STATERUNNER_LLM_SCOPE(PickupPool);
+
 	UWorld* World = GetWorld();
 	if (!World)
 	{
@@ -473,12 +572,167 @@ ABasePickup* UPickupSpawnerComponent::SpawnPickupActor(EPickupType Type)
 
 	if (Pickup)
 	{
+		Pickup->SetOwningSpawner(this);
+		Pickup->SetEffectsReduced(bPickupEffectsReduced);
 		Pickup->Deactivate();
 	}
 
 	return Pickup;
 }
 
+void UPickupSpawnerComponent::ReturnPickupToPool(ABasePickup* Pickup)
+{
+	if (!Pickup)
+	{
+		return;
+	}
+
+	ActivePickups.Remove(Pickup);
+
+	// Already parked off-track, so its X can't find it -- despawns and collections sit at the front
+	if (PickupXIndex.Num() > 0 && PickupXIndex[0] == Pickup)
+	{
+		PickupXIndex.RemoveAt(0, 1, EAllowShrinking::No);
+	}
+	else
+	{
+		PickupXIndex.RemoveSingle(Pickup);
+	}
+
+	// Pool is keyed by type; fall back to the others in case a Blueprint changed PickupType
+	TActorPool<ABasePickup>& TypedPool = GetPoolForType(Pickup->GetPickupType());
+	if (TypedPool.Owns(Pickup))
+	{
+		TypedPool.Release(Pickup);
+		return;
+	}
+
+	for (TActorPool<ABasePickup>& Pool : PickupPools)
+	{
+		if (Pool.Owns(Pickup))
+		{
+			Pool.Release(Pickup);
+			return;
+		}
+	}
+}
+
+void UPickupSpawnerComponent::UpdatePoolStats() const
+{
+	SIZE_T PoolMemory = ActivePickups.GetAllocatedSize();
+	for (const TActorPool<ABasePickup>& Pool : PickupPools)
+	{
+		PoolMemory += Pool.GetAllocatedSize();
+	}
+
+	SET_DWORD_STAT(STAT_StateRunner_PooledPickups, GetTotalPooledCount());
+	SET_DWORD_STAT(STAT_StateRunner_ActivePickups, ActivePickups.Num());
+	SET_MEMORY_STAT(STAT_StateRunner_PickupPoolMemory, PoolMemory);
+
+	if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
+	{
+		Debug->Stat_PooledPickups = GetTotalPooledCount();
+		Debug->Stat_ActivePickups = ActivePickups.Num();
+	}
+}
+
+void UPickupSpawnerComponent::RequestPrewarm(EPickupType Type, int32 TargetSize)
+{
+	PrewarmQueue.Request((int32)Type, UHardwareTierSubsystem::ApplyCap(TargetSize, PoolSizeCap));
+}
+
+void UPickupSpawnerComponent::InitializePrewarmQueue()
+{
+	PrewarmQueue.Initialize(this, PrewarmFrameBudgetMs,
+		[this](int32 TypeIndex) -> TActorPool<ABasePickup>&
+		{
+			return GetPoolForType((EPickupType)TypeIndex);
+		},
+		[this](int32 TypeIndex) -> ABasePickup*
+		{
+			ABasePickup* Actor = SpawnPickupActor((EPickupType)TypeIndex);
+			if (Actor)
+			{
+				GetPoolForType((EPickupType)TypeIndex).Add(Actor);
+			}
+			return Actor;
+		},
+		[this](bool bFinished, int32 NumSpawned)
+		{
+			UpdatePoolStats();
+
+			if (bFinished && NumSpawned > 0)
+			{
+				if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
+				{
+					Debug->RecordEvent(EDebugCategory::Spawning, EDebugEventId::PickupPrewarmDone,
+						GetPoolForType(EPickupType::DataPacket).Num(), GetPoolForType(EPickupType::OneUp).Num(), GetPoolForType(EPickupType::EMP).Num(), GetPoolForType(EPickupType::Magnet).Num());
+				}
+			}
+		});
+}
+
+void UPickupSpawnerComponent::UpdatePredictivePrewarm()
+{
+	// Data Packet count for the next density level at max variance
+	const int32 NextLevel = CurrentDensityLevel + 1;
+	int32 PredictedPerSegment = MinPickupsPerSegment + NextLevel + 1;
+	if (NextLevel >= HighDensityDifficultyThreshold)
+	{
+		PredictedPerSegment += HighDensityBonusPickups;
+	}
+	PredictedPerSegment = FMath::Clamp(PredictedPerSegment, MinPickupsPerSegment, MaxPickupsPerSegment);
+
+	const int32 Headroom = FMath::CeilToInt(PredictedPerSegment * PrewarmHeadroomSegments);
+	// Data Packets get the headroom; rare types spawn at most one per segment -- keep a spare ready
+	for (EPickupType Type : AllPickupTypes)
+	{
+		const int32 InUse = GetPoolForType(Type).GetNumInUse();
+		if (!GetPickupTypeTraits(Type).bRare)
+		{
+			RequestPrewarm(Type, InUse + Headroom);
+		}
+		else if (GetClassForType(Type))
+		{
+			RequestPrewarm(Type, InUse + 1);
+		}
+	}
+}
+
+void UPickupSpawnerComponent::SetPickupEffectsReduced(bool bReduced)
+{
+	if (bReduced == bPickupEffectsReduced)
+	{
+		return;
+	}
+
+	// Pooled ones too, so the next activation already comes up still
+	bPickupEffectsReduced = bReduced;
+	for (const TActorPool<ABasePickup>& Pool : PickupPools)
+	{
+		for (ABasePickup* Pickup : Pool.GetItems())
+		{
+			if (IsValid(Pickup))
+			{
+				Pickup->SetEffectsReduced(bReduced);
+			}
+		}
+	}
+}
+
+void UPickupSpawnerComponent::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+	UPickupSpawnerComponent* This = CastChecked<UPickupSpawnerComponent>(InThis);
+	for (TActorPool<ABasePickup>& Pool : This->PickupPools)
+	{
+		Pool.AddReferencedObjects(Collector);
+	}
+	This->ActivePickups.AddReferencedObjects(Collector);
+	Collector.AddReferencedObjects(This->PickupXIndex);
+
+	Super::AddReferencedObjects(InThis, Collector);
+}
+
 bool UPickupSpawnerComponent::ShouldSpawn1Up() const
 {
 	if (!OneUpClass)
@@ -505,7 +759,7 @@ bool UPickupSpawnerComponent::ShouldSpawn1Up() const
 	}
 	
 	// Random chance
-	float Roll = FMath::FRand();
+	float Roll = LayoutRandom.FRand();
 	bool bSpawn = Roll < OneUpSpawnChance;
 	return bSpawn;
 }
@@ -586,7 +840,7 @@ void UPickupSpawnerComponent::Spawn1Up(float SegmentStartX, float SegmentEndX, b
 			
 			for (int32 Attempt = 0; Attempt < AttemptsPerLane && !bFoundSafeSpot; Attempt++)
 			{
-				float RelativeX = FMath::FRandRange(0.25f, 0.75f);
+				float RelativeX = LayoutRandom.FRandRange(0.25f, 0.75f);
 				
 				float WorldX = SegmentStartX + (RelativeX * SegmentLength);
 				float WorldY = GetLaneYPosition(TryLane);
@@ -609,7 +863,7 @@ void UPickupSpawnerComponent::Spawn1Up(float SegmentStartX, float SegmentEndX, b
 			{
 				if (bFoundSafeSpot) break;
 				
-				float EdgeX = SegmentStartX + (FMath::RandBool() ? 0.15f : 0.85f) * SegmentLength;
+				float EdgeX = SegmentStartX + (LayoutRandom.RandRange(0, 1) == 1 ? 0.15f : 0.85f) * SegmentLength;
 				FVector EdgeLocation(EdgeX, GetLaneYPosition(EdgeLane), PickupSpawnZ + OneUpZOffset);
 				
 				if (FindSafeSpawnPosition(EdgeLocation, EdgeLane, SafeLocation))
@@ -625,7 +879,7 @@ void UPickupSpawnerComponent::Spawn1Up(float SegmentStartX, float SegmentEndX, b
 	if (bFoundSafeSpot)
 	{
 		OneUp->Activate(SafeLocation, FinalLane);
-		ActivePickups.Add(OneUp);
+		AddActivePickup(OneUp);
 
 		bHasSpawnedFirst1Up = true;
 		Last1UpLane = FinalLane;
@@ -639,14 +893,7 @@ void UPickupSpawnerComponent::Spawn1Up(float SegmentStartX, float SegmentEndX, b
 
 		if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
 		{
-			if (bIsGuaranteed)
-			{
-				Debug->LogEvent(EDebugCategory::Spawning, FString::Printf(TEXT("1-UP (FREE) %s lane"), LaneName));
-			}
-			else
-			{
-				Debug->LogEvent(EDebugCategory::Spawning, FString::Printf(TEXT("1-UP %s lane"), LaneName));
-			}
+			Debug->RecordEvent(EDebugCategory::Spawning, EDebugEventId::OneUpSpawned, static_cast<int32>(FinalLane), bIsGuaranteed ? 1 : 0);
 		}
 	}
 	else
@@ -681,7 +928,7 @@ bool UPickupSpawnerComponent::ShouldSpawnEMP() const
 		EffectiveChance += EMPHighDensityBonusChance;
 	}
 	
-	float Roll = FMath::FRand();
+	float Roll = LayoutRandom.FRand();
 	bool bSpawn = Roll < EffectiveChance;
 	return bSpawn;
 }
@@ -702,11 +949,11 @@ void UPickupSpawnerComponent::SpawnEMP(float SegmentStartX, float SegmentEndX, i
 	
 	// Weighted lane selection: 60% center, 20% left, 20% right
 	TArray<ELane> LanePriority;
-	float LaneRoll = FMath::FRand();
+	float LaneRoll = LayoutRandom.FRand();
 	if (LaneRoll < 0.6f)
 	{
 		LanePriority.Add(ELane::Center);
-		if (FMath::RandBool())
+		if (LayoutRandom.RandRange(0, 1) == 1)
 		{
 			LanePriority.Add(ELane::Left);
 			LanePriority.Add(ELane::Right);
@@ -765,7 +1012,7 @@ void UPickupSpawnerComponent::SpawnEMP(float SegmentStartX, float SegmentEndX, i
 			
 			for (int32 Attempt = 0; Attempt < 8 && !bFoundSafeSpot; Attempt++)
 			{
-				float WorldX = FMath::FRandRange(SpawnMinX, SpawnMaxX);
+				float WorldX = LayoutRandom.FRandRange(SpawnMinX, SpawnMaxX);
 				float WorldY = GetLaneYPosition(TryLane);
 				float WorldZ = PickupSpawnZ + EMPZOffset; // Configurable - higher = requires jump
 
@@ -789,7 +1036,7 @@ void UPickupSpawnerComponent::SpawnEMP(float SegmentStartX, float SegmentEndX, i
 			
 			for (int32 Attempt = 0; Attempt < 5 && !bFoundSafeSpot; Attempt++)
 			{
-				float RelativeX = FMath::FRandRange(0.25f, 0.75f);
+				float RelativeX = LayoutRandom.FRandRange(0.25f, 0.75f);
 				
 				float WorldX = SegmentStartX + (RelativeX * SegmentLength);
 				float WorldY = GetLaneYPosition(TryLane);
@@ -810,7 +1057,7 @@ void UPickupSpawnerComponent::SpawnEMP(float SegmentStartX, float SegmentEndX, i
 	if (!bFoundSafeSpot)
 	{
 		ELane RandomLane = LanePriority[0];
-		float RandomX = SegmentStartX + (FMath::FRandRange(0.3f, 0.7f) * SegmentLength);
+		float RandomX = SegmentStartX + (LayoutRandom.FRandRange(0.3f, 0.7f) * SegmentLength);
 		SafeLocation = FVector(RandomX, GetLaneYPosition(RandomLane), PickupSpawnZ + EMPZOffset);
 		bFoundSafeSpot = true;
 		FinalLane = RandomLane;
@@ -820,7 +1067,7 @@ void UPickupSpawnerComponent::SpawnEMP(float SegmentStartX, float SegmentEndX, i
 	if (bFoundSafeSpot)
 	{
 		EMP->Activate(SafeLocation, FinalLane);
-		ActivePickups.Add(EMP);
+		AddActivePickup(EMP);
 		LastEMPSpawnSegment = SegmentsSpawned;
 
 		const TCHAR* LaneName = (FinalLane == ELane::Center) ? TEXT("Center") : 
@@ -831,7 +1078,7 @@ void UPickupSpawnerComponent::SpawnEMP(float SegmentStartX, float SegmentEndX, i
 
 		if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
 		{
-			Debug->LogEvent(EDebugCategory::Spawning, FString::Printf(TEXT("EMP %s lane"), LaneName));
+			Debug->RecordEvent(EDebugCategory::Spawning, EDebugEventId::EMPSpawned, static_cast<int32>(FinalLane));
 		}
 	}
 	else
@@ -861,7 +1108,7 @@ bool UPickupSpawnerComponent::ShouldSpawnMagnet() const
 		return false;
 	}
 	
-	float Roll = FMath::FRand();
+	float Roll = LayoutRandom.FRand();
 	bool bSpawn = Roll < MagnetSpawnChance;
 	return bSpawn;
 }
@@ -884,7 +1131,7 @@ void UPickupSpawnerComponent::SpawnMagnet(float SegmentStartX, float SegmentEndX
 	TArray<ELane> Lanes = { ELane::Left, ELane::Center, ELane::Right };
 	for (int32 i = Lanes.Num() - 1; i > 0; --i)
 	{
-		int32 j = FMath::RandRange(0, i);
+		int32 j = LayoutRandom.RandRange(0, i);
 		Lanes.Swap(i, j);
 	}
 
@@ -894,7 +1141,7 @@ void UPickupSpawnerComponent::SpawnMagnet(float SegmentStartX, float SegmentEndX
 		
 		for (int32 Attempt = 0; Attempt < 8 && !bFoundSafeSpot; Attempt++)
 		{
-			float RelativeX = FMath::FRandRange(0.2f, 0.8f);
+			float RelativeX = LayoutRandom.FRandRange(0.2f, 0.8f);
 			float WorldX = SegmentStartX + (RelativeX * SegmentLength);
 			float WorldY = GetLaneYPosition(TryLane);
 			float WorldZ = PickupSpawnZ + MagnetZOffset;
@@ -913,7 +1160,7 @@ void UPickupSpawnerComponent::SpawnMagnet(float SegmentStartX, float SegmentEndX
 	if (!bFoundSafeSpot)
 	{
 		ELane RandomLane = Lanes[0];
-		float RandomX = SegmentStartX + (FMath::FRandRange(0.3f, 0.7f) * SegmentLength);
+		float RandomX = SegmentStartX + (LayoutRandom.FRandRange(0.3f, 0.7f) * SegmentLength);
 		SafeLocation = FVector(RandomX, GetLaneYPosition(RandomLane), PickupSpawnZ + MagnetZOffset);
 		bFoundSafeSpot = true;
 		FinalLane = RandomLane;
@@ -923,7 +1170,7 @@ void UPickupSpawnerComponent::SpawnMagnet(float SegmentStartX, float SegmentEndX
 	if (bFoundSafeSpot)
 	{
 		Magnet->Activate(SafeLocation, FinalLane);
-		ActivePickups.Add(Magnet);
+		AddActivePickup(Magnet);
 		LastMagnetSpawnSegment = SegmentsSpawned;
 
 		const TCHAR* LaneName = (FinalLane == ELane::Center) ? TEXT("Center") : 
@@ -934,7 +1181,7 @@ void UPickupSpawnerComponent::SpawnMagnet(float SegmentStartX, float SegmentEndX
 
 		if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
 		{
-			Debug->LogEvent(EDebugCategory::Spawning, FString::Printf(TEXT("MAGNET %s lane"), LaneName));
+			Debug->RecordEvent(EDebugCategory::Spawning, EDebugEventId::MagnetSpawned, static_cast<int32>(FinalLane));
 		}
 	}
 	else
@@ -943,13 +1190,27 @@ void UPickupSpawnerComponent::SpawnMagnet(float SegmentStartX, float SegmentEndX
 	}
 }
 
-void UPickupSpawnerComponent::ActivateMagnet()
+void UPickupSpawnerComponent::ActivateMagnet(APawn* Runner)
 {
+	// A second runner's Magnet takes the pull (and the VFX) over
+	if (!Runner)
+	{
+		Runner = UGameplayStatics::GetPlayerPawn(this, 0);
+	}
+	if (bIsMagnetActive && MagnetRunner.Get() != Runner)
+	{
+		SetMagnetRunnerEffect(false);
+	}
+	MagnetRunner = Runner;
+
 	bIsMagnetActive = true;
 	MagnetTimeRemaining = MagnetDuration;
 	
-	// Enable tick for the duration of the magnet effect
-	SetComponentTickEnabled(true);
+	// Enable tick for the duration of the magnet effect (fixed-step mode steps it instead)
+	if (!bSimulationDriven)
+	{
+		SetComponentTickEnabled(true);
+	}
 	
 	UE_LOG(LogStateRunner_Arcade, Log, TEXT("MAGNET activated! Duration: %.1fs, PullSpeed: %.0f, Range: %.0f"),
 		MagnetDuration, MagnetPullSpeed, MagnetPullRange);
@@ -958,15 +1219,14 @@ void UPickupSpawnerComponent::ActivateMagnet()
 	OnMagnetStateChanged.Broadcast(true);
 
 	// Turn on magnet VFX on the player
-	if (UWorld* World = GetWorld())
+	SetMagnetRunnerEffect(true);
+}
+
+void UPickupSpawnerComponent::SetMagnetRunnerEffect(bool bActive)
+{
+	if (AStateRunner_ArcadeCharacter* Character = Cast<AStateRunner_ArcadeCharacter>(MagnetRunner.Get()))
 	{
-		if (APlayerController* PC = World->GetFirstPlayerController())
-		{
-			if (AStateRunner_ArcadeCharacter* Character = Cast<AStateRunner_ArcadeCharacter>(PC->GetPawn()))
-			{
-				Character->SetMagnetEffectActive(true);
-			}
-		}
+		Character->SetMagnetEffectActive(bActive);
 	}
 }
 
@@ -979,7 +1239,22 @@ void UPickupSpawnerComponent::TickComponent(float DeltaTime, ELevelTick TickType
 		SetComponentTickEnabled(false);
 		return;
 	}
-	
+
+	TickMagnet(DeltaTime);
+}
+
+void UPickupSpawnerComponent::SimulateStep(float StepSeconds)
+{
+	if (bIsMagnetActive)
+	{
+		TickMagnet(StepSeconds);
+	}
+}
+
+void UPickupSpawnerComponent::TickMagnet(float DeltaTime)
+{
+	STATERUNNER_SCOPE_CYCLE_COUNTER(MagnetTick);
+
 	// Count down magnet timer
 	MagnetTimeRemaining -= DeltaTime;
 	if (MagnetTimeRemaining <= 0.0f)
@@ -991,123 +1266,191 @@ void UPickupSpawnerComponent::TickComponent(float DeltaTime, ELevelTick TickType
 
 		// Broadcast state change and deactivate player VFX
 		OnMagnetStateChanged.Broadcast(false);
-		if (UWorld* World = GetWorld())
-		{
-			if (APlayerController* PC = World->GetFirstPlayerController())
-			{
-				if (AStateRunner_ArcadeCharacter* Character = Cast<AStateRunner_ArcadeCharacter>(PC->GetPawn()))
-				{
-					Character->SetMagnetEffectActive(false);
-				}
-			}
-		}
+		SetMagnetRunnerEffect(false);
+		MagnetRunner.Reset();
 		return;
 	}
 	
-	// Get player position for targeting
-	APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(this, 0);
+	// Player and scroll state are read once per update, not per pickup
+	APawn* PlayerPawn = MagnetRunner.Get();
 	if (!PlayerPawn) return;
 	
 	const FVector PlayerLoc = PlayerPawn->GetActorLocation();
-	
-	// Pull all active pickups toward the player (except other Magnets).
-	// No dead zones -- pickups in any direction get pulled.
-	// Overlap collision handles collection when they arrive.
-	for (ABasePickup* Pickup : ActivePickups)
+
+	UWorldScrollComponent* WorldScroll = nullptr;
+	if (AStateRunner_ArcadeGameMode* GM = Cast<AStateRunner_ArcadeGameMode>(GetOwner()))
 	{
-		if (!Pickup || !Pickup->IsActive()) continue;
-		if (Pickup->GetPickupType() == EPickupType::Magnet) continue;
-		
-		FVector PickupLoc = Pickup->GetActorLocation();
-		float XDist = PickupLoc.X - PlayerLoc.X;
-		float YDiff = PlayerLoc.Y - PickupLoc.Y;
-		
-		// Range check (symmetric -- behind the player counts too)
-		if (FMath::Abs(XDist) > MagnetPullRange) continue;
-		
-		float Distance2D = FMath::Sqrt(XDist * XDist + YDiff * YDiff);
-		float ZDiff = PlayerLoc.Z - PickupLoc.Z;
-		float Distance3D = FMath::Sqrt(XDist * XDist + YDiff * YDiff + ZDiff * ZDiff);
-		
-		// Two-phase pull:
-		// FAR (>500u): FInterpTo for smooth vacuum feel (percentage-based, decelerates)
-		// CLOSE (<=500u): Constant-velocity pull to guarantee arrival
-		//
-		// FInterpTo is asymptotic and slows as the gap shrinks. At high scroll speeds
-		// (OVERCLOCK at ~8000+ u/s) the world scroll can outrun the weakening interp.
-		// Constant-velocity at close range always wins.
-		
-		const float ConstantPullThreshold = 500.0f;
-		
-		if (Distance3D <= ConstantPullThreshold)
+		WorldScroll = GM->GetWorldScrollComponent();
+	}
+	const float ActualScrollSpeed = WorldScroll ? WorldScroll->GetCurrentScrollSpeed() : 0.0f;
+	const float PlayerTrackX = WorldScroll ? WorldScroll->WorldToTrackX(PlayerLoc.X) : PlayerLoc.X;
+
+	// Gather pickups in range (symmetric -- behind the player counts too) straight from the X index.
+	// Other Magnets are never pulled.
+	MagnetTargets.Reset();
+	MagnetPosX.Reset();
+	MagnetPosY.Reset();
+	MagnetPosZ.Reset();
+
+	for (int32 i = LowerBoundPickupX(PlayerTrackX - MagnetPullRange); i < PickupXIndex.Num(); i++)
+	{
+		ABasePickup* Pickup = PickupXIndex[i];
+		if (Pickup->GetTrackX() > PlayerTrackX + MagnetPullRange)
 		{
-			// Close range: constant-velocity pull that outruns scroll speed
-			float ActualScrollSpeed = 0.0f;
-			if (AStateRunner_ArcadeGameMode* GM = Cast<AStateRunner_ArcadeGameMode>(GetOwner()))
-			{
-				if (UWorldScrollComponent* WSC = GM->GetWorldScrollComponent())
-				{
-					ActualScrollSpeed = WSC->GetCurrentScrollSpeed();
-				}
-			}
-			// Pull at 2x scroll speed (min 4000 u/s fallback)
-			float ConstantSpeed = FMath::Max(ActualScrollSpeed * 2.0f, 4000.0f);
-			FVector NewLoc = FMath::VInterpConstantTo(PickupLoc, PlayerLoc, DeltaTime, ConstantSpeed);
-			Pickup->SetActorLocation(NewLoc);
+			break;
 		}
-		else
+		if (!Pickup->IsActive() || Pickup->GetPickupType() == EPickupType::Magnet)
 		{
-			// Far range: FInterpTo for smooth vacuum pull
-			float BaseInterpSpeed = MagnetPullSpeed / 100.0f;
-			float ProximityBoost = FMath::GetMappedRangeValueClamped(
-				FVector2D(0.0f, MagnetPullRange),
-				FVector2D(3.0f, 1.0f),
-				Distance2D
-			);
-			float InterpSpeed = BaseInterpSpeed * ProximityBoost;
-			
-			// Pull X toward player from any direction
-			PickupLoc.X = FMath::FInterpTo(PickupLoc.X, PlayerLoc.X, DeltaTime, InterpSpeed);
-			
-			// Pull Y (lateral)
-			if (FMath::Abs(YDiff) > 1.0f)
-			{
-				PickupLoc.Y = FMath::FInterpTo(PickupLoc.Y, PlayerLoc.Y, DeltaTime, InterpSpeed);
-			}
-			
-			// Pull Z so bobbing/elevated pickups reach the capsule
-			if (FMath::Abs(ZDiff) > 1.0f)
-			{
-				PickupLoc.Z = FMath::FInterpTo(PickupLoc.Z, PlayerLoc.Z, DeltaTime, InterpSpeed);
-			}
-			
-			Pickup->SetActorLocation(PickupLoc);
+			continue;
 		}
+
+		const FVector PickupLoc = Pickup->GetActorLocation();
+		MagnetTargets.Add(Pickup);
+		MagnetPosX.Add(PickupLoc.X);
+		MagnetPosY.Add(PickupLoc.Y);
+		MagnetPosZ.Add(PickupLoc.Z);
 	}
-}
 
-void UPickupSpawnerComponent::UpdateDensity()
-{
-#if !UE_BUILD_SHIPPING
-	if (bDebugDensityOverride)
+	const int32 NumTargets = MagnetTargets.Num();
+	if (NumTargets == 0)
 	{
 		return;
 	}
-#endif
 
-	int32 NewDensity = SegmentsSpawned / SegmentsPerDensityIncrease;
-	
-	if (NewDensity != CurrentDensityLevel)
+	// Two-phase pull:
+	// FAR (>500u): FInterpTo for smooth vacuum feel (percentage-based, decelerates)
+	// CLOSE (<=500u): Constant-velocity pull to guarantee arrival
+	//
+	// FInterpTo is asymptotic and slows as the gap shrinks. At high scroll speeds
+	// (OVERCLOCK at ~8000+ u/s) the world scroll can outrun the weakening interp.
+	// Constant-velocity at close range always wins.
+	const float ConstantPullThreshold = 500.0f;
+	const float ConstantPullThresholdSq = ConstantPullThreshold * ConstantPullThreshold;
+
+	// Close range: pull at 2x scroll speed (min 4000 u/s fallback)
+	const float ConstantStep = FMath::Max(ActualScrollSpeed * 2.0f, 4000.0f) * DeltaTime;
+
+	// Far range: interp speed boosted up to 3x as the pickup gets closer
+	const float BaseInterpSpeed = MagnetPullSpeed / 100.0f;
+	const float InvPullRange = 1.0f / MagnetPullRange;
+
+	float* RESTRICT PosX = MagnetPosX.GetData();
+	float* RESTRICT PosY = MagnetPosY.GetData();
+	float* RESTRICT PosZ = MagnetPosZ.GetData();
+
+	// Branch-free over the SoA buffers so the compiler can vectorize it
+	for (int32 i = 0; i < NumTargets; i++)
 	{
-		CurrentDensityLevel = NewDensity;
+		const float DX = PlayerLoc.X - PosX[i];
+		const float DY = PlayerLoc.Y - PosY[i];
+		const float DZ = PlayerLoc.Z - PosZ[i];
+		const float Distance2DSq = DX * DX + DY * DY;
+		const float Distance3DSq = Distance2DSq + DZ * DZ;
+
+		// Close: move ConstantStep along the 3D gap, or snap if that overshoots (VInterpConstantTo)
+		const float Distance3D = FMath::Sqrt(Distance3DSq);
+		const float CloseAlpha = Distance3D > ConstantStep ? ConstantStep / Distance3D : 1.0f;
+
+		// Far: FInterpTo alpha with a proximity boost mapped 3x (at the player) -> 1x (at range)
+		const float ProximityBoost = FMath::Lerp(3.0f, 1.0f, FMath::Min(FMath::Sqrt(Distance2DSq) * InvPullRange, 1.0f));
+		const float FarAlpha = FMath::Clamp(DeltaTime * BaseInterpSpeed * ProximityBoost, 0.0f, 1.0f);
+
+		const bool bClose = Distance3DSq <= ConstantPullThresholdSq;
+		const float AlphaX = bClose ? CloseAlpha : FarAlpha;
+
+		// Far range leaves Y/Z alone inside 1u so bobbing/lane-centred pickups don't jitter
+		const float AlphaY = bClose ? CloseAlpha : (FMath::Abs(DY) > 1.0f ? FarAlpha : 0.0f);
+		const float AlphaZ = bClose ? CloseAlpha : (FMath::Abs(DZ) > 1.0f ? FarAlpha : 0.0f);
+
+		PosX[i] += DX * AlphaX;
+		PosY[i] += DY * AlphaY;
+		PosZ[i] += DZ * AlphaZ;
+	}
+
+	// Write back in one pass. With physics overlaps a move can collect the pickup,
+	// which only removes it from ActivePickups/PickupXIndex -- never from these buffers.
+	for (int32 i = 0; i < NumTargets; i++)
+	{
+		ABasePickup* Pickup = MagnetTargets[i];
+		if (IsValid(Pickup) && Pickup->IsActive())
+		{
+			Pickup->SetActorLocation(FVector(PosX[i], PosY[i], PosZ[i]));
+		}
 	}
+
+	ResortPickupXIndex();
 }
 
-void UPickupSpawnerComponent::DebugIncreaseDifficulty()
+void UPickupSpawnerComponent::AddActivePickup(ABasePickup* Pickup)
 {
-#if !UE_BUILD_SHIPPING
-	bDebugDensityOverride = true;
-	CurrentDensityLevel++;
+	if (!Pickup || ActivePickups.Contains(Pickup))
+	{
+		return;
+	}
+
+	ActivePickups.Add(Pickup);
+
+	// Segments spawn ahead of everything already on track, so this is almost always an append
+	const float TrackX = Pickup->GetTrackX();
+	if (PickupXIndex.Num() == 0 || PickupXIndex.Last()->GetTrackX() <= TrackX)
+	{
+		PickupXIndex.Add(Pickup);
+		return;
+	}
+
+	PickupXIndex.Insert(Pickup, LowerBoundPickupX(TrackX));
+}
+
+int32 UPickupSpawnerComponent::LowerBoundPickupX(float TrackX) const
+{
+	return Algo::LowerBoundBy(PickupXIndex, TrackX, [](const TObjectPtr<ABasePickup>& Pickup)
+	{
+		return Pickup->GetTrackX();
+	});
+}
+
+void UPickupSpawnerComponent::ResortPickupXIndex()
+{
+	// Pulled pickups only move toward the player, so at most a few neighbours swap
+	for (int32 i = 1; i < PickupXIndex.Num(); i++)
+	{
+		const float TrackX = PickupXIndex[i]->GetTrackX();
+		int32 j = i;
+		while (j > 0 && PickupXIndex[j - 1]->GetTrackX() > TrackX)
+		{
+			j--;
+		}
+		if (j != i)
+		{
+			TObjectPtr<ABasePickup> Moved = PickupXIndex[i];
+			PickupXIndex.RemoveAt(i, 1, EAllowShrinking::No);
+			PickupXIndex.Insert(Moved, j);
+		}
+	}
+}
+
+void UPickupSpawnerComponent::UpdateDensity()
+{
+#if !UE_BUILD_SHIPPING
+	if (bDebugDensityOverride)
+	{
+		return;
+	}
+#endif
+
+	int32 NewDensity = UDifficultyDirectorComponent::Get(this)->GetPickupDensityForSegment(SegmentsSpawned);
+	
+	if (NewDensity != CurrentDensityLevel)
+	{
+		CurrentDensityLevel = NewDensity;
+	}
+}
+
+void UPickupSpawnerComponent::DebugIncreaseDifficulty()
+{
+#if !UE_BUILD_SHIPPING
+	bDebugDensityOverride = true;
+	CurrentDensityLevel++;
 	
 	bool bOneUpCanSpawn = (CurrentDensityLevel >= OneUpMinDifficulty) && OneUpClass != nullptr;
 	bool bEMPCanSpawn = (CurrentDensityLevel >= EMPMinDifficulty) && EMPClass != nullptr;
@@ -1141,7 +1484,7 @@ float UPickupSpawnerComponent::GetLaneYPosition(ELane Lane) const
 
 ELane UPickupSpawnerComponent::GetRandomLane() const
 {
-	int32 RandomValue = FMath::RandRange(0, 2);
+	int32 RandomValue = LayoutRandom.RandRange(0, 2);
 	switch (RandomValue)
 	{
 		case 0:		return ELane::Left;
@@ -1157,7 +1500,7 @@ ELane UPickupSpawnerComponent::GetRandomSideLane() const
 	// Players cannot see the "stair step" of ascending/descending aerial patterns
 	// when they're coming straight at the centered camera perspective.
 	// Left and right lanes show visible vertical offset differences.
-	return FMath::RandBool() ? ELane::Left : ELane::Right;
+	return (LayoutRandom.RandRange(0, 1) == 1) ? ELane::Left : ELane::Right;
 }
 
 // --- Obstacle Avoidance ---
@@ -1189,35 +1532,173 @@ void UPickupSpawnerComponent::CacheObstaclePositions(float SegmentStartX, float
 	// Include obstacles slightly outside segment bounds
 	const float SearchMargin = 500.0f;
 	
-	TArray<AActor*> FoundObstacles;
-	UGameplayStatics::GetAllActorsOfClass(World, ABaseObstacle::StaticClass(), FoundObstacles);
+	// Lane-indexed range query on the obstacle spawner (track space, active only)
+	TArray<ABaseObstacle*> FoundObstacles;
+	ObstacleSpawner->GetObstaclesInRange(SegmentStartX - SearchMargin, SegmentEndX + SearchMargin, FoundObstacles);
+	
+	CachedObstaclePositions.Reserve(FoundObstacles.Num());
+	CachedObstacleTypes.Reserve(FoundObstacles.Num());
 	
-	for (AActor* Actor : FoundObstacles)
+	for (ABaseObstacle* Obstacle : FoundObstacles)
 	{
-		ABaseObstacle* Obstacle = Cast<ABaseObstacle>(Actor);
-		if (Obstacle && Obstacle->IsActive())
+		// Track space, to match the candidate spawn positions
+		FVector ObstaclePos = Obstacle->GetActorLocation();
+		ObstaclePos.X = Obstacle->GetTrackX();
+		CachedObstaclePositions.Add(ObstaclePos);
+		
+		EObstacleType ObsType = Obstacle->GetObstacleType();
+		CachedObstacleTypes.Add(ObsType);
+		
+		// FullWalls and HighBarriers require dodging
+		if (ObsType == EObstacleType::FullWall || ObsType == EObstacleType::HighBarrier)
 		{
-			FVector ObstaclePos = Obstacle->GetActorLocation();
-			
-			if (ObstaclePos.X >= (SegmentStartX - SearchMargin) && 
-				ObstaclePos.X <= (SegmentEndX + SearchMargin))
+			bSegmentHasBlockingObstacles = true;
+		}
+	}
+
+	BuildOccupancyGrid(SegmentStartX - SearchMargin, SegmentEndX + SearchMargin);
+
+	const UWorldScrollComponent* WorldScroll = GameMode->GetWorldScrollComponent();
+	OccupancyScrollDistance = WorldScroll ? WorldScroll->GetPresentedScrollDistance() : 0.0;
+}
+
+int32 UPickupSpawnerComponent::GetOccupancyLane(float Y) const
+{
+	// Pickups and obstacles both sit on lane centers; anything else takes the exact path
+	const float LaneTolerance = 10.0f;
+
+	for (ELane Lane : { ELane::Left, ELane::Center, ELane::Right })
+	{
+		if (FMath::Abs(Y - GetLaneYPosition(Lane)) <= LaneTolerance)
+		{
+			return (int32)Lane;
+		}
+	}
+	return INDEX_NONE;
+}
+
+void UPickupSpawnerComponent::BuildOccupancyGrid(float MinX, float MaxX)
+{
+	bOccupancyGridValid = false;
+	for (int32 LaneIdx = 0; LaneIdx < 3; LaneIdx++)
+	{
+		CachedObstacleXByLane[LaneIdx].Reset();
+	}
+
+	// The grid only models the same-lane rule. That's exact as long as lanes are further
+	// apart than both the same-lane Y threshold (200) and the cross-lane keep-out radius.
+	const float LaneMargin = 20.0f;
+	const float MinLaneGap = FMath::Min(
+		FMath::Abs(CenterLaneY - LeftLaneY),
+		FMath::Abs(RightLaneY - CenterLaneY)) - LaneMargin;
+	if (MinLaneGap < 200.0f || MinLaneGap < MinDistanceFromObstacle * 0.6f || OccupancyBucketSize <= 0.0f)
+	{
+		return;
+	}
+
+	for (const FVector& ObstaclePos : CachedObstaclePositions)
+	{
+		const int32 LaneIdx = GetOccupancyLane(ObstaclePos.Y);
+		if (LaneIdx == INDEX_NONE)
+		{
+			return;
+		}
+		CachedObstacleXByLane[LaneIdx].Add(ObstaclePos.X);
+	}
+
+	OccupancyOriginX = MinX;
+	OccupancyBucketCount = FMath::Max(1, FMath::CeilToInt((MaxX - MinX) / OccupancyBucketSize));
+
+	for (int32 LaneIdx = 0; LaneIdx < 3; LaneIdx++)
+	{
+		OccupancyBlocked[LaneIdx].Init(false, OccupancyBucketCount);
+		OccupancyEdge[LaneIdx].Init(false, OccupancyBucketCount);
+
+		for (float ObstacleX : CachedObstacleXByLane[LaneIdx])
+		{
+			// Keep-out is the open interval (X - D, X + D)
+			const float KeepOutMin = ObstacleX - MinDistanceFromObstacle;
+			const float KeepOutMax = ObstacleX + MinDistanceFromObstacle;
+
+			const int32 FirstBucket = FMath::Max(0, FMath::FloorToInt((KeepOutMin - OccupancyOriginX) / OccupancyBucketSize));
+			const int32 LastBucket = FMath::Min(OccupancyBucketCount - 1, FMath::FloorToInt((KeepOutMax - OccupancyOriginX) / OccupancyBucketSize));
+
+			for (int32 Bucket = FirstBucket; Bucket <= LastBucket; Bucket++)
 			{
-				CachedObstaclePositions.Add(ObstaclePos);
-				
-				EObstacleType ObsType = Obstacle->GetObstacleType();
-				CachedObstacleTypes.Add(ObsType);
-				
-				// FullWalls and HighBarriers require dodging
-				if (ObsType == EObstacleType::FullWall || ObsType == EObstacleType::HighBarrier)
+				const float BucketMin = OccupancyOriginX + Bucket * OccupancyBucketSize;
+				const float BucketMax = BucketMin + OccupancyBucketSize;
+
+				if (BucketMin > KeepOutMin && BucketMax < KeepOutMax)
 				{
-					bSegmentHasBlockingObstacles = true;
+					OccupancyBlocked[LaneIdx][Bucket] = true;
+				}
+				else
+				{
+					OccupancyEdge[LaneIdx][Bucket] = true;
 				}
 			}
 		}
 	}
+
+	bOccupancyGridValid = true;
+}
+
+bool UPickupSpawnerComponent::GetOccupancyGridView(FOccupancyGridView& OutView) const
+{
+	if (!bOccupancyGridValid)
+	{
+		return false;
+	}
+
+	OutView.Blocked = OccupancyBlocked;
+	OutView.Edge = OccupancyEdge;
+	for (ELane Lane : { ELane::Left, ELane::Center, ELane::Right })
+	{
+		OutView.LaneY[(int32)Lane] = GetLaneYPosition(Lane);
+	}
+	OutView.OriginX = OccupancyOriginX;
+	OutView.BucketSize = OccupancyBucketSize;
+	OutView.BucketCount = OccupancyBucketCount;
+	OutView.ScrollDistance = OccupancyScrollDistance;
+	return true;
 }
 
 bool UPickupSpawnerComponent::IsPositionSafeFromObstacles(const FVector& WorldPosition) const
+{
+	if (!bOccupancyGridValid)
+	{
+		return IsPositionSafeFromObstaclesExact(WorldPosition);
+	}
+
+	const int32 LaneIdx = GetOccupancyLane(WorldPosition.Y);
+	const int32 Bucket = FMath::FloorToInt((WorldPosition.X - OccupancyOriginX) / OccupancyBucketSize);
+	if (LaneIdx == INDEX_NONE || Bucket < 0 || Bucket >= OccupancyBucketCount)
+	{
+		return IsPositionSafeFromObstaclesExact(WorldPosition);
+	}
+
+	if (OccupancyBlocked[LaneIdx][Bucket])
+	{
+		return false;
+	}
+
+	if (!OccupancyEdge[LaneIdx][Bucket])
+	{
+		return true;
+	}
+
+	// Edge bucket: exact same-lane test against this lane's obstacles only
+	for (float ObstacleX : CachedObstacleXByLane[LaneIdx])
+	{
+		if (FMath::Abs(WorldPosition.X - ObstacleX) < MinDistanceFromObstacle)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool UPickupSpawnerComponent::IsPositionSafeFromObstaclesExact(const FVector& WorldPosition) const
 {
 	for (const FVector& ObstaclePos : CachedObstaclePositions)
 	{
@@ -1288,6 +1769,343 @@ bool UPickupSpawnerComponent::FindSafeSpawnPosition(const FVector& DesiredPositi
 	return false;
 }
 
+// --- Pattern Template Helpers ---
+
+/** Template variant bit for a pattern's second option: direction, or JumpArc's high jump */
+static constexpr uint8 PickupSpawner_VariantFlag = 0x80;
+
+/**
+ * Template variant from a lane and an optional flag.
+ * Prefixed to avoid Unity build collisions.
+ */
+static uint8 PickupSpawner_MakeVariant(ELane Lane, bool bFlag = false)
+{
+	return static_cast<uint8>(Lane) | (bFlag ? PickupSpawner_VariantFlag : 0);
+}
+
+static uint32 PickupSpawner_MakeTemplateKey(EPickupPatternType PatternType, int32 Count, uint8 Variant)
+{
+	return static_cast<uint32>(PatternType)
+		| (static_cast<uint32>(FMath::Clamp(Count, 0, 0xFFFF)) << 8)
+		| (static_cast<uint32>(Variant) << 24);
+}
+
+static ELane PickupSpawner_LaneFromIndex(int32 LaneIndex)
+{
+	switch (LaneIndex)
+	{
+		case 0: return ELane::Left;
+		case 1: return ELane::Center;
+		default: return ELane::Right;
+	}
+}
+
+/**
+ * Every variant a predefined pattern can roll, and the count its template is keyed by.
+ * Random and Cluster are rolled per pickup and have no template (no variants).
+ */
+static int32 PickupSpawner_GetTemplateVariants(EPickupPatternType PatternType, int32 PickupCount, TArray<uint8, TInlineAllocator<4>>& OutVariants)
+{
+	const uint8 Left = PickupSpawner_MakeVariant(ELane::Left);
+	const uint8 Right = PickupSpawner_MakeVariant(ELane::Right);
+	const uint8 Flagged = PickupSpawner_MakeVariant(ELane::Left, true);
+
+	switch (PatternType)
+	{
+		case EPickupPatternType::Trail:
+			OutVariants = { Left, PickupSpawner_MakeVariant(ELane::Center), Right };
+			return PickupCount;
+
+		case EPickupPatternType::VerticalArc:
+		case EPickupPatternType::Ascending:
+		case EPickupPatternType::Descending:
+		case EPickupPatternType::SkyTrail:
+			OutVariants = { Left, Right };
+			return PickupCount;
+
+		case EPickupPatternType::JumpArc:
+			OutVariants = { Left, Right, PickupSpawner_MakeVariant(ELane::Left, true), PickupSpawner_MakeVariant(ELane::Right, true) };
+			return PickupCount;
+
+		case EPickupPatternType::Arc:
+		case EPickupPatternType::Diagonal:
+		case EPickupPatternType::Staircase:
+		case EPickupPatternType::Rainbow:
+			OutVariants = { Left, Flagged };
+			return PickupCount;
+
+		case EPickupPatternType::Zigzag:
+		case EPickupPatternType::Wave:
+		case EPickupPatternType::Scatter:
+		case EPickupPatternType::Helix:
+			OutVariants = { 0 };
+			return PickupCount;
+
+		// Fixed shapes, keyed without a count
+		case EPickupPatternType::Diamond:
+		case EPickupPatternType::TripleLine:
+			OutVariants = { 0 };
+			return 0;
+
+		case EPickupPatternType::Tower:
+			OutVariants = { Left, Right };
+			return 0;
+
+		// Keyed by bound count (3 pickups' worth of count per bound, at least 2)
+		case EPickupPatternType::BouncingArcs:
+			OutVariants = { Left, Flagged };
+			return FMath::Max(2, PickupCount / 3);
+
+		default:
+			OutVariants.Reset();
+			return PickupCount;
+	}
+}
+
+/**
+ * Build a pattern's normalized offset table.
+ * Span patterns store RelativeXOffset as 0-1 along the pattern's span (ground or aerial
+ * bounds, applied per segment); centered patterns (Diamond, TripleLine, Tower) store the
+ * offset from their center X.
+ */
+static void PickupSpawner_BuildPatternTemplate(EPickupPatternType PatternType, int32 Count, uint8 Variant, TArray<FPickupSpawnData>& OutTemplate)
+{
+	const ELane Lane = static_cast<ELane>(Variant & ~PickupSpawner_VariantFlag);
+	const bool bFlag = (Variant & PickupSpawner_VariantFlag) != 0;
+	const float Step = 1.0f / FMath::Max(1, Count - 1);
+
+	const EPickupHeight RisingHeights[] = {
+		EPickupHeight::Ground,
+		EPickupHeight::LowAir,
+		EPickupHeight::MidAir,
+		EPickupHeight::HighAir,
+		EPickupHeight::Apex
+	};
+	const int32 NumHeights = UE_ARRAY_COUNT(RisingHeights);
+
+	auto AddPickup = [&OutTemplate](ELane PickupLane, float X, EPickupHeight Height = EPickupHeight::Ground, float ZOffset = 0.0f)
+	{
+		FPickupSpawnData& Data = OutTemplate.AddDefaulted_GetRef();
+		Data.Lane = PickupLane;
+		Data.RelativeXOffset = X;
+		Data.HeightLevel = Height;
+		Data.ZOffset = ZOffset;
+	};
+
+	OutTemplate.Reserve(FMath::Max(Count, 5));
+
+	switch (PatternType)
+	{
+		// --- Ground Patterns ---
+
+		case EPickupPatternType::Trail:
+			// Line of pickups in a single lane
+			for (int32 i = 0; i < Count; i++)
+			{
+				AddPickup(Lane, i * Step);
+			}
+			break;
+
+		case EPickupPatternType::Arc:
+			// Parabolic curve across lanes (L-C-R-C-L), flag = left to right
+			for (int32 i = 0; i < Count; i++)
+			{
+				const float t = i * Step;
+				const int32 LaneIndex = FMath::RoundToInt(4.0f * t * (1.0f - t) * 2.0f);
+				AddPickup(PickupSpawner_LaneFromIndex(bFlag ? LaneIndex : 2 - LaneIndex), t);
+			}
+			break;
+
+		case EPickupPatternType::Zigzag:
+		{
+			// Zigzag: L-C-R-C-L-C-R...
+			const ELane ZigzagSequence[] = { ELane::Left, ELane::Center, ELane::Right, ELane::Center };
+			for (int32 i = 0; i < Count; i++)
+			{
+				AddPickup(ZigzagSequence[i % 4], i * Step);
+			}
+			break;
+		}
+
+		case EPickupPatternType::Diamond:
+		{
+			// Diamond shape: 5 pickups
+			//      C
+			//    L   R
+			//      C
+			//      C
+			const float Spacing = 0.08f;
+			AddPickup(ELane::Center, -Spacing * 1.5f);
+			AddPickup(ELane::Left, 0.0f);
+			AddPickup(ELane::Right, 0.0f);
+			AddPickup(ELane::Center, Spacing);
+			AddPickup(ELane::Center, Spacing * 2.5f);
+			break;
+		}
+
+		case EPickupPatternType::Wave:
+			// Sine wave across lanes
+			for (int32 i = 0; i < Count; i++)
+			{
+				const float t = i * Step;
+				const float SineValue = FMath::Sin(t * 2.0f * PI);
+				const int32 LaneIndex = FMath::Clamp(FMath::RoundToInt((SineValue + 1.0f) * 0.5f * 2.0f), 0, 2);
+				AddPickup(PickupSpawner_LaneFromIndex(LaneIndex), t);
+			}
+			break;
+
+		case EPickupPatternType::Diagonal:
+			// Diagonal line from one corner to the other, flag = left to right
+			for (int32 i = 0; i < Count; i++)
+			{
+				const float t = i * Step;
+				const int32 LaneIndex = FMath::RoundToInt(t * 2.0f);
+				AddPickup(PickupSpawner_LaneFromIndex(bFlag ? LaneIndex : 2 - LaneIndex), t);
+			}
+			break;
+
+		case EPickupPatternType::TripleLine:
+			// All three lanes at the same X - reward wall
+			AddPickup(ELane::Left, 0.0f);
+			AddPickup(ELane::Center, 0.0f);
+			AddPickup(ELane::Right, 0.0f);
+			break;
+
+		case EPickupPatternType::Scatter:
+		{
+			// Golden ratio spacing for visual interest, clamped to the span
+			const float GoldenRatio = 1.618033988749895f;
+			const float BaseSpacing = 1.0f / FMath::Max(1, Count);
+			float CurrentX = 0.0f;
+			for (int32 i = 0; i < Count; i++)
+			{
+				CurrentX += BaseSpacing + BaseSpacing * 0.3f * FMath::Sin(i * GoldenRatio);
+				AddPickup(PickupSpawner_LaneFromIndex(static_cast<int32>(i * GoldenRatio) % 3), FMath::Clamp(CurrentX, 0.0f, 1.0f));
+			}
+			break;
+		}
+
+		// --- Aerial Patterns ---
+		// Only Left/Right lanes: players can't read height changes on pickups coming
+		// straight at the camera down the center lane.
+
+		case EPickupPatternType::VerticalArc:
+			// Vertical arc: ground -> apex -> ground in one lane
+			// Collect the whole arc with a well-timed jump
+			for (int32 i = 0; i < Count; i++)
+			{
+				const float t = i * Step;
+				const float ParabolicValue = 4.0f * t * (1.0f - t);
+				AddPickup(Lane, t, RisingHeights[FMath::Clamp(FMath::FloorToInt(ParabolicValue * NumHeights), 0, NumHeights - 1)]);
+			}
+			break;
+
+		case EPickupPatternType::Ascending:
+			// Ground to apex, rewards sustained jump hold
+			for (int32 i = 0; i < Count; i++)
+			{
+				const float t = i * Step;
+				AddPickup(Lane, t, RisingHeights[FMath::Clamp(FMath::RoundToInt(t * (NumHeights - 1)), 0, NumHeights - 1)]);
+			}
+			break;
+
+		case EPickupPatternType::Descending:
+			// Apex to ground, catch during fall
+			for (int32 i = 0; i < Count; i++)
+			{
+				const float t = i * Step;
+				AddPickup(Lane, t, RisingHeights[NumHeights - 1 - FMath::Clamp(FMath::RoundToInt(t * (NumHeights - 1)), 0, NumHeights - 1)]);
+			}
+			break;
+
+		case EPickupPatternType::Helix:
+		{
+			// 3D corkscrew: alternating side lanes + height oscillation
+			const EPickupHeight HeightSequence[] = {
+				EPickupHeight::Ground,
+				EPickupHeight::LowAir,
+				EPickupHeight::MidAir,
+				EPickupHeight::HighAir,
+				EPickupHeight::MidAir,
+				EPickupHeight::LowAir
+			};
+			for (int32 i = 0; i < Count; i++)
+			{
+				AddPickup((i % 2 == 0) ? ELane::Left : ELane::Right, i * Step, HeightSequence[i % 6]);
+			}
+			break;
+		}
+
+		case EPickupPatternType::JumpArc:
+		{
+			// Follows natural parabolic jump trajectory, flag = max jump height
+			const float PeakHeight = bFlag ? 350.0f : 200.0f;
+			for (int32 i = 0; i < Count; i++)
+			{
+				const float t = i * Step;
+				AddPickup(Lane, t, EPickupHeight::Ground, 4.0f * PeakHeight * t * (1.0f - t));
+			}
+			break;
+		}
+
+		case EPickupPatternType::Staircase:
+			// Alternating side lanes, each step higher (flag = starts on the left)
+			for (int32 i = 0; i < Count; i++)
+			{
+				const bool bOnStartSide = (i % 2 == 0);
+				const ELane StepLane = (bOnStartSide == bFlag) ? ELane::Left : ELane::Right;
+				AddPickup(StepLane, i * Step, RisingHeights[FMath::Min(i, NumHeights - 1)]);
+			}
+			break;
+
+		case EPickupPatternType::SkyTrail:
+			// High altitude line, requires sustained max jump
+			for (int32 i = 0; i < Count; i++)
+			{
+				AddPickup(Lane, i * Step, EPickupHeight::HighAir);
+			}
+			break;
+
+		case EPickupPatternType::Tower:
+			// Vertical stack at same X, one pickup per height level
+			for (int32 i = 0; i < NumHeights; i++)
+			{
+				AddPickup(Lane, 0.0f, RisingHeights[i]);
+			}
+			break;
+
+		case EPickupPatternType::Rainbow:
+			// Crosses sides at the midpoint with height peaking there (flag = left to right)
+			for (int32 i = 0; i < Count; i++)
+			{
+				const float t = i * Step;
+				const float ParabolicValue = 4.0f * t * (1.0f - t);
+				const ELane RainbowLane = ((t < 0.5f) == bFlag) ? ELane::Left : ELane::Right;
+				AddPickup(RainbowLane, t, RisingHeights[FMath::Clamp(FMath::FloorToInt(ParabolicValue * 4.0f) + 1, 1, NumHeights - 1)]);
+			}
+			break;
+
+		case EPickupPatternType::BouncingArcs:
+		{
+			// Count = bounds; each bound is low then high across the sides, alternating
+			// direction (flag = first bound goes left to right)
+			const int32 TotalPickups = Count * 2;
+			bool bLeftToRight = bFlag;
+			for (int32 Bound = 0; Bound < Count; Bound++)
+			{
+				const float BoundStartX = static_cast<float>(Bound * 2) / TotalPickups;
+				AddPickup(bLeftToRight ? ELane::Left : ELane::Right, BoundStartX, EPickupHeight::LowAir);
+				AddPickup(bLeftToRight ? ELane::Right : ELane::Left, BoundStartX + 1.0f / TotalPickups, EPickupHeight::HighAir);
+				bLeftToRight = !bLeftToRight;
+			}
+			break;
+		}
+
+		default:
+			break;
+	}
+}
+
 // --- Pattern Functions ---
 
 bool UPickupSpawnerComponent::GenerateFromPattern(TArray<FPickupSpawnData>& OutPickups)
@@ -1302,7 +2120,7 @@ bool UPickupSpawnerComponent::GenerateFromPattern(TArray<FPickupSpawnData>& OutP
 	// If the pattern has manually placed pickups, use those directly
 	if (SelectedPattern->Pickups.Num() > 0)
 	{
-		OutPickups = SelectedPattern->Pickups;
+		OutPickups.Append(SelectedPattern->Pickups);
 		return true;
 	}
 
@@ -1322,7 +2140,7 @@ void UPickupSpawnerComponent::GeneratePatternPickups(TArray<FPickupSpawnData>& O
 			break;
 			
 		case EPickupPatternType::Arc:
-			GenerateArcPattern(OutPickups, PickupCount, FMath::RandBool());
+			GenerateArcPattern(OutPickups, PickupCount, LayoutRandom.RandRange(0, 1) == 1);
 			break;
 			
 		case EPickupPatternType::Zigzag:
@@ -1330,11 +2148,11 @@ void UPickupSpawnerComponent::GeneratePatternPickups(TArray<FPickupSpawnData>& O
 			break;
 			
 		case EPickupPatternType::Cluster:
-			GenerateClusterPattern(OutPickups, PickupCount, FMath::FRandRange(0.3f, 0.7f));
+			GenerateClusterPattern(OutPickups, PickupCount, LayoutRandom.FRandRange(0.3f, 0.7f));
 			break;
 			
 		case EPickupPatternType::Diamond:
-			GenerateDiamondPattern(OutPickups, FMath::FRandRange(0.3f, 0.7f));
+			GenerateDiamondPattern(OutPickups, LayoutRandom.FRandRange(0.3f, 0.7f));
 			break;
 			
 		case EPickupPatternType::Wave:
@@ -1342,11 +2160,11 @@ void UPickupSpawnerComponent::GeneratePatternPickups(TArray<FPickupSpawnData>& O
 			break;
 			
 		case EPickupPatternType::Diagonal:
-			GenerateDiagonalPattern(OutPickups, PickupCount, FMath::RandBool());
+			GenerateDiagonalPattern(OutPickups, PickupCount, LayoutRandom.RandRange(0, 1) == 1);
 			break;
 			
 		case EPickupPatternType::TripleLine:
-			GenerateTripleLinePattern(OutPickups, FMath::FRandRange(0.3f, 0.7f));
+			GenerateTripleLinePattern(OutPickups, LayoutRandom.FRandRange(0.3f, 0.7f));
 			break;
 			
 		case EPickupPatternType::Scatter:
@@ -1374,11 +2192,11 @@ void UPickupSpawnerComponent::GeneratePatternPickups(TArray<FPickupSpawnData>& O
 			break;
 			
 		case EPickupPatternType::JumpArc:
-			GenerateJumpArcPattern(OutPickups, PickupCount, GetRandomSideLane(), FMath::RandBool());
+			GenerateJumpArcPattern(OutPickups, PickupCount, GetRandomSideLane(), LayoutRandom.RandRange(0, 1) == 1);
 			break;
 			
 		case EPickupPatternType::Staircase:
-			GenerateStaircasePattern(OutPickups, PickupCount, FMath::RandBool());
+			GenerateStaircasePattern(OutPickups, PickupCount, LayoutRandom.RandRange(0, 1) == 1);
 			break;
 			
 		case EPickupPatternType::SkyTrail:
@@ -1386,11 +2204,11 @@ void UPickupSpawnerComponent::GeneratePatternPickups(TArray<FPickupSpawnData>& O
 			break;
 			
 		case EPickupPatternType::Tower:
-			GenerateTowerPattern(OutPickups, FMath::FRandRange(0.3f, 0.7f), GetRandomSideLane());
+			GenerateTowerPattern(OutPickups, LayoutRandom.FRandRange(0.3f, 0.7f), GetRandomSideLane());
 			break;
 			
 		case EPickupPatternType::Rainbow:
-			GenerateRainbowPattern(OutPickups, PickupCount, FMath::RandBool());
+			GenerateRainbowPattern(OutPickups, PickupCount, LayoutRandom.RandRange(0, 1) == 1);
 			break;
 			
 		case EPickupPatternType::BouncingArcs:
@@ -1406,84 +2224,23 @@ void UPickupSpawnerComponent::GeneratePatternPickups(TArray<FPickupSpawnData>& O
 
 void UPickupSpawnerComponent::GenerateTrailPattern(TArray<FPickupSpawnData>& OutPickups, int32 Count, ELane Lane)
 {
-	// Line of pickups in a single lane
-	OutPickups.Reserve(Count);
-	
-	float StartX = GetEffectiveMinSpawnOffset();
-	float EndX = GetEffectiveMaxSpawnOffset();
-	float Spacing = (EndX - StartX) / FMath::Max(1, Count - 1);
-	
-	for (int32 i = 0; i < Count; i++)
-	{
-		FPickupSpawnData Data;
-		Data.Lane = Lane;
-		Data.RelativeXOffset = StartX + (i * Spacing);
-		Data.ZOffset = 0.0f;
-		OutPickups.Add(Data);
-	}
+	AppendGroundPattern(OutPickups, EPickupPatternType::Trail, Count, PickupSpawner_MakeVariant(Lane));
 }
 
 void UPickupSpawnerComponent::GenerateArcPattern(TArray<FPickupSpawnData>& OutPickups, int32 Count, bool bLeftToRight)
 {
-	// Parabolic curve across lanes (L-C-R-C-L)
-	OutPickups.Reserve(Count);
-	
-	float StartX = GetEffectiveMinSpawnOffset();
-	float EndX = GetEffectiveMaxSpawnOffset();
-	float Spacing = (EndX - StartX) / FMath::Max(1, Count - 1);
-	
-	for (int32 i = 0; i < Count; i++)
-	{
-		FPickupSpawnData Data;
-		
-		float t = (float)i / FMath::Max(1, Count - 1);
-		float ParabolicValue = 4.0f * t * (1.0f - t);
-		
-		int32 LaneIndex = FMath::RoundToInt(ParabolicValue * 2.0f);
-		if (!bLeftToRight)
-		{
-			LaneIndex = 2 - LaneIndex;
-		}
-		
-		switch (LaneIndex)
-		{
-			case 0: Data.Lane = ELane::Left; break;
-			case 1: Data.Lane = ELane::Center; break;
-			default: Data.Lane = ELane::Right; break;
-		}
-		
-		Data.RelativeXOffset = StartX + (i * Spacing);
-		Data.ZOffset = 0.0f;
-		OutPickups.Add(Data);
-	}
+	AppendGroundPattern(OutPickups, EPickupPatternType::Arc, Count, PickupSpawner_MakeVariant(ELane::Left, bLeftToRight));
 }
 
-void UPickupSpawnerComponent::GenerateZigzagPattern(TArray<FPickupSpawnData>& OutPickups, int32 Count)
-{
-	// Zigzag: L-C-R-C-L-C-R...
-	OutPickups.Reserve(Count);
-	
-	float StartX = GetEffectiveMinSpawnOffset();
-	float EndX = GetEffectiveMaxSpawnOffset();
-	float Spacing = (EndX - StartX) / FMath::Max(1, Count - 1);
-	
-	const ELane ZigzagSequence[] = { ELane::Left, ELane::Center, ELane::Right, ELane::Center };
-	const int32 SequenceLength = 4;
-	
-	for (int32 i = 0; i < Count; i++)
-	{
-		FPickupSpawnData Data;
-		Data.Lane = ZigzagSequence[i % SequenceLength];
-		Data.RelativeXOffset = StartX + (i * Spacing);
-		Data.ZOffset = 0.0f;
-		OutPickups.Add(Data);
-	}
+void UPickupSpawnerComponent::GenerateZigzagPattern(TArray<FPickupSpawnData>& OutPickups, int32 Count)
+{
+	AppendGroundPattern(OutPickups, EPickupPatternType::Zigzag, Count, 0);
 }
 
 void UPickupSpawnerComponent::GenerateClusterPattern(TArray<FPickupSpawnData>& OutPickups, int32 Count, float CenterX)
 {
-	// Tight cluster around a center point
-	OutPickups.Reserve(Count);
+	// Tight cluster around a center point (random per pickup, so not templated)
+	OutPickups.Reserve(OutPickups.Num() + Count);
 	
 	const float ClusterRadius = 0.15f;
 	const ELane Lanes[] = { ELane::Left, ELane::Center, ELane::Right };
@@ -1498,10 +2255,10 @@ void UPickupSpawnerComponent::GenerateClusterPattern(TArray<FPickupSpawnData>& O
 		}
 		else
 		{
-			Data.Lane = Lanes[FMath::RandRange(0, 2)];
+			Data.Lane = Lanes[LayoutRandom.RandRange(0, 2)];
 		}
 		
-		float RandomOffset = FMath::FRandRange(-ClusterRadius, ClusterRadius);
+		float RandomOffset = LayoutRandom.FRandRange(-ClusterRadius, ClusterRadius);
 		Data.RelativeXOffset = FMath::Clamp(CenterX + RandomOffset, GetEffectiveMinSpawnOffset(), GetEffectiveMaxSpawnOffset());
 		Data.ZOffset = 0.0f;
 		OutPickups.Add(Data);
@@ -1510,507 +2267,158 @@ void UPickupSpawnerComponent::GenerateClusterPattern(TArray<FPickupSpawnData>& O
 
 void UPickupSpawnerComponent::GenerateDiamondPattern(TArray<FPickupSpawnData>& OutPickups, float CenterX)
 {
-	// Diamond shape: 5 pickups
-	//      C
-	//    L   R
-	//      C
-	//      C
-	
-	const float Spacing = 0.08f;
-	const float EffectiveMin = GetEffectiveMinSpawnOffset();
-	const float EffectiveMax = GetEffectiveMaxSpawnOffset();
-	
-	FPickupSpawnData Top;
-	Top.Lane = ELane::Center;
-	Top.RelativeXOffset = FMath::Clamp(CenterX - Spacing * 1.5f, EffectiveMin, EffectiveMax);
-	OutPickups.Add(Top);
-	
-	FPickupSpawnData Left;
-	Left.Lane = ELane::Left;
-	Left.RelativeXOffset = FMath::Clamp(CenterX, EffectiveMin, EffectiveMax);
-	OutPickups.Add(Left);
-	
-	FPickupSpawnData Right;
-	Right.Lane = ELane::Right;
-	Right.RelativeXOffset = FMath::Clamp(CenterX, EffectiveMin, EffectiveMax);
-	OutPickups.Add(Right);
-	
-	FPickupSpawnData Center;
-	Center.Lane = ELane::Center;
-	Center.RelativeXOffset = FMath::Clamp(CenterX + Spacing, EffectiveMin, EffectiveMax);
-	OutPickups.Add(Center);
-	
-	FPickupSpawnData Bottom;
-	Bottom.Lane = ELane::Center;
-	Bottom.RelativeXOffset = FMath::Clamp(CenterX + Spacing * 2.5f, EffectiveMin, EffectiveMax);
-	OutPickups.Add(Bottom);
+	AppendPatternAroundCenter(OutPickups, GetPatternTemplate(EPickupPatternType::Diamond, 0, 0),
+		CenterX, GetEffectiveMinSpawnOffset(), GetEffectiveMaxSpawnOffset());
 }
 
 void UPickupSpawnerComponent::GenerateWavePattern(TArray<FPickupSpawnData>& OutPickups, int32 Count)
 {
-	// Sine wave across lanes
-	OutPickups.Reserve(Count);
-	
-	float StartX = GetEffectiveMinSpawnOffset();
-	float EndX = GetEffectiveMaxSpawnOffset();
-	float Spacing = (EndX - StartX) / FMath::Max(1, Count - 1);
-	
-	const float Frequency = 2.0f * PI;
-	
-	for (int32 i = 0; i < Count; i++)
-	{
-		FPickupSpawnData Data;
-		
-		float t = (float)i / FMath::Max(1, Count - 1);
-		float SineValue = FMath::Sin(t * Frequency);
-		
-		int32 LaneIndex = FMath::RoundToInt((SineValue + 1.0f) * 0.5f * 2.0f);
-		LaneIndex = FMath::Clamp(LaneIndex, 0, 2);
-		
-		switch (LaneIndex)
-		{
-			case 0: Data.Lane = ELane::Left; break;
-			case 1: Data.Lane = ELane::Center; break;
-			default: Data.Lane = ELane::Right; break;
-		}
-		
-		Data.RelativeXOffset = StartX + (i * Spacing);
-		Data.ZOffset = 0.0f;
-		OutPickups.Add(Data);
-	}
+	AppendGroundPattern(OutPickups, EPickupPatternType::Wave, Count, 0);
 }
 
 void UPickupSpawnerComponent::GenerateDiagonalPattern(TArray<FPickupSpawnData>& OutPickups, int32 Count, bool bLeftToRight)
 {
-	// Diagonal line from one corner to the other
-	OutPickups.Reserve(Count);
-	
-	float StartX = GetEffectiveMinSpawnOffset();
-	float EndX = GetEffectiveMaxSpawnOffset();
-	float Spacing = (EndX - StartX) / FMath::Max(1, Count - 1);
-	
-	for (int32 i = 0; i < Count; i++)
-	{
-		FPickupSpawnData Data;
-		
-		float t = (float)i / FMath::Max(1, Count - 1);
-		int32 LaneIndex = FMath::RoundToInt(t * 2.0f);
-		
-		if (!bLeftToRight)
-		{
-			LaneIndex = 2 - LaneIndex;
-		}
-		
-		switch (LaneIndex)
-		{
-			case 0: Data.Lane = ELane::Left; break;
-			case 1: Data.Lane = ELane::Center; break;
-			default: Data.Lane = ELane::Right; break;
-		}
-		
-		Data.RelativeXOffset = StartX + (i * Spacing);
-		Data.ZOffset = 0.0f;
-		OutPickups.Add(Data);
-	}
+	AppendGroundPattern(OutPickups, EPickupPatternType::Diagonal, Count, PickupSpawner_MakeVariant(ELane::Left, bLeftToRight));
 }
 
 void UPickupSpawnerComponent::GenerateTripleLinePattern(TArray<FPickupSpawnData>& OutPickups, float XPosition)
 {
-	// All three lanes at the same X - reward wall
-	const float EffectiveMin = GetEffectiveMinSpawnOffset();
-	const float EffectiveMax = GetEffectiveMaxSpawnOffset();
-	
-	for (ELane Lane : { ELane::Left, ELane::Center, ELane::Right })
-	{
-		FPickupSpawnData Data;
-		Data.Lane = Lane;
-		Data.RelativeXOffset = FMath::Clamp(XPosition, EffectiveMin, EffectiveMax);
-		Data.ZOffset = 0.0f;
-		OutPickups.Add(Data);
-	}
+	AppendPatternAroundCenter(OutPickups, GetPatternTemplate(EPickupPatternType::TripleLine, 0, 0),
+		XPosition, GetEffectiveMinSpawnOffset(), GetEffectiveMaxSpawnOffset());
 }
 
 void UPickupSpawnerComponent::GenerateScatterPattern(TArray<FPickupSpawnData>& OutPickups, int32 Count)
 {
-	// Golden ratio spacing for visual interest
-	OutPickups.Reserve(Count);
-	
-	const float GoldenRatio = 1.618033988749895f;
-	const float EffectiveMin = GetEffectiveMinSpawnOffset();
-	const float EffectiveMax = GetEffectiveMaxSpawnOffset();
-	float CurrentX = EffectiveMin;
-	
-	for (int32 i = 0; i < Count; i++)
-	{
-		FPickupSpawnData Data;
-		
-		int32 LaneIndex = (int32)(i * GoldenRatio) % 3;
-		switch (LaneIndex)
-		{
-			case 0: Data.Lane = ELane::Left; break;
-			case 1: Data.Lane = ELane::Center; break;
-			default: Data.Lane = ELane::Right; break;
-		}
-		
-		float BaseSpacing = (EffectiveMax - EffectiveMin) / Count;
-		float Variation = BaseSpacing * 0.3f * FMath::Sin(i * GoldenRatio);
-		CurrentX += BaseSpacing + Variation;
-		
-		Data.RelativeXOffset = FMath::Clamp(CurrentX, EffectiveMin, EffectiveMax);
-		Data.ZOffset = 0.0f;
-		OutPickups.Add(Data);
-	}
+	AppendGroundPattern(OutPickups, EPickupPatternType::Scatter, Count, 0);
 }
 
 // --- Aerial Pattern Generators ---
+// Center lane is never used (see GeneratePatternPickups), so the lane variants are Left/Right
 
 void UPickupSpawnerComponent::GenerateVerticalArcPattern(TArray<FPickupSpawnData>& OutPickups, int32 Count, ELane Lane)
 {
-	// Vertical arc: ground -> apex -> ground in one lane
-	// Collect the whole arc with a well-timed jump
-	OutPickups.Reserve(Count);
-	
-	float StartX, EndX;
-	GetAerialPatternBounds(StartX, EndX);
-	float Spacing = (EndX - StartX) / FMath::Max(1, Count - 1);
-	
-	const TArray<EPickupHeight> ArcHeights = {
-		EPickupHeight::Ground,
-		EPickupHeight::LowAir,
-		EPickupHeight::MidAir,
-		EPickupHeight::HighAir,
-		EPickupHeight::Apex,
-		EPickupHeight::HighAir,
-		EPickupHeight::MidAir,
-		EPickupHeight::LowAir,
-		EPickupHeight::Ground
-	};
-	
-	for (int32 i = 0; i < Count; i++)
-	{
-		FPickupSpawnData Data;
-		Data.Lane = Lane;
-		Data.RelativeXOffset = StartX + (i * Spacing);
-		
-		float t = (float)i / FMath::Max(1, Count - 1);
-		float ParabolicValue = 4.0f * t * (1.0f - t);
-		
-		if (ParabolicValue < 0.2f)
-			Data.HeightLevel = EPickupHeight::Ground;
-		else if (ParabolicValue < 0.4f)
-			Data.HeightLevel = EPickupHeight::LowAir;
-		else if (ParabolicValue < 0.6f)
-			Data.HeightLevel = EPickupHeight::MidAir;
-		else if (ParabolicValue < 0.8f)
-			Data.HeightLevel = EPickupHeight::HighAir;
-		else
-			Data.HeightLevel = EPickupHeight::Apex;
-		
-		OutPickups.Add(Data);
-	}
+	AppendAerialPattern(OutPickups, EPickupPatternType::VerticalArc, Count, PickupSpawner_MakeVariant(Lane));
 }
 
 void UPickupSpawnerComponent::GenerateAscendingPattern(TArray<FPickupSpawnData>& OutPickups, int32 Count, ELane Lane)
 {
-	// Ground to apex, rewards sustained jump hold
-	OutPickups.Reserve(Count);
-	
-	float StartX, EndX;
-	GetAerialPatternBounds(StartX, EndX);
-	float Spacing = (EndX - StartX) / FMath::Max(1, Count - 1);
-	
-	const EPickupHeight Heights[] = {
-		EPickupHeight::Ground,
-		EPickupHeight::LowAir,
-		EPickupHeight::MidAir,
-		EPickupHeight::HighAir,
-		EPickupHeight::Apex
-	};
-	const int32 NumHeights = 5;
-	
-	for (int32 i = 0; i < Count; i++)
-	{
-		FPickupSpawnData Data;
-		Data.Lane = Lane;
-		Data.RelativeXOffset = StartX + (i * Spacing);
-		
-		float t = (float)i / FMath::Max(1, Count - 1);
-		int32 HeightIndex = FMath::Clamp(FMath::RoundToInt(t * (NumHeights - 1)), 0, NumHeights - 1);
-		Data.HeightLevel = Heights[HeightIndex];
-		
-		OutPickups.Add(Data);
-	}
+	AppendAerialPattern(OutPickups, EPickupPatternType::Ascending, Count, PickupSpawner_MakeVariant(Lane));
 }
 
 void UPickupSpawnerComponent::GenerateDescendingPattern(TArray<FPickupSpawnData>& OutPickups, int32 Count, ELane Lane)
 {
-	// Apex to ground, catch during fall
-	OutPickups.Reserve(Count);
-	
-	float StartX, EndX;
-	GetAerialPatternBounds(StartX, EndX);
-	float Spacing = (EndX - StartX) / FMath::Max(1, Count - 1);
-	
-	const EPickupHeight Heights[] = {
-		EPickupHeight::Apex,
-		EPickupHeight::HighAir,
-		EPickupHeight::MidAir,
-		EPickupHeight::LowAir,
-		EPickupHeight::Ground
-	};
-	const int32 NumHeights = 5;
-	
-	for (int32 i = 0; i < Count; i++)
-	{
-		FPickupSpawnData Data;
-		Data.Lane = Lane;
-		Data.RelativeXOffset = StartX + (i * Spacing);
-		
-		float t = (float)i / FMath::Max(1, Count - 1);
-		int32 HeightIndex = FMath::Clamp(FMath::RoundToInt(t * (NumHeights - 1)), 0, NumHeights - 1);
-		Data.HeightLevel = Heights[HeightIndex];
-		
-		OutPickups.Add(Data);
-	}
+	AppendAerialPattern(OutPickups, EPickupPatternType::Descending, Count, PickupSpawner_MakeVariant(Lane));
 }
 
 void UPickupSpawnerComponent::GenerateHelixPattern(TArray<FPickupSpawnData>& OutPickups, int32 Count)
 {
-	// 3D corkscrew: zigzag lanes + height oscillation
-	// NOTE: Uses only Left and Right lanes (no Center) to avoid depth perception issues
-	// where players can't see height changes in pickups coming straight at the camera.
-	OutPickups.Reserve(Count);
-	
-	float StartX, EndX;
-	GetAerialPatternBounds(StartX, EndX);
-	float Spacing = (EndX - StartX) / FMath::Max(1, Count - 1);
-	
-	// Alternates between Left and Right lanes only - Center excluded for depth perception
-	const ELane LaneSequence[] = { ELane::Left, ELane::Right };
-	const EPickupHeight HeightSequence[] = { 
-		EPickupHeight::Ground, 
-		EPickupHeight::LowAir, 
-		EPickupHeight::MidAir, 
-		EPickupHeight::HighAir,
-		EPickupHeight::MidAir,
-		EPickupHeight::LowAir
-	};
-	
-	for (int32 i = 0; i < Count; i++)
-	{
-		FPickupSpawnData Data;
-		Data.Lane = LaneSequence[i % 2];
-		Data.RelativeXOffset = StartX + (i * Spacing);
-		Data.HeightLevel = HeightSequence[i % 6];
-		
-		OutPickups.Add(Data);
-	}
+	AppendAerialPattern(OutPickups, EPickupPatternType::Helix, Count, 0);
 }
 
 void UPickupSpawnerComponent::GenerateJumpArcPattern(TArray<FPickupSpawnData>& OutPickups, int32 Count, ELane Lane, bool bHighJump)
 {
-	// Follows natural parabolic jump trajectory
-	OutPickups.Reserve(Count);
-	
-	float StartX, EndX;
-	GetAerialPatternBounds(StartX, EndX);
-	float Spacing = (EndX - StartX) / FMath::Max(1, Count - 1);
-	
-	float PeakHeight = bHighJump ? 350.0f : 200.0f;
-	
-	for (int32 i = 0; i < Count; i++)
-	{
-		FPickupSpawnData Data;
-		Data.Lane = Lane;
-		Data.RelativeXOffset = StartX + (i * Spacing);
-		
-		float t = (float)i / FMath::Max(1, Count - 1);
-		float HeightValue = 4.0f * PeakHeight * t * (1.0f - t);
-		
-		Data.HeightLevel = EPickupHeight::Ground;
-		Data.ZOffset = HeightValue;
-		
-		OutPickups.Add(Data);
-	}
+	AppendAerialPattern(OutPickups, EPickupPatternType::JumpArc, Count, PickupSpawner_MakeVariant(Lane, bHighJump));
 }
 
 void UPickupSpawnerComponent::GenerateStaircasePattern(TArray<FPickupSpawnData>& OutPickups, int32 Count, bool bLeftToRight)
 {
-	// Ascending diagonally across lanes, each step changes lane + height
-	// NOTE: Only uses Left and Right lanes (no Center) to avoid depth perception issues.
-	OutPickups.Reserve(Count);
-	
-	float StartX, EndX;
-	GetAerialPatternBounds(StartX, EndX);
-	float Spacing = (EndX - StartX) / FMath::Max(1, Count - 1);
-	
-	// Only alternate between Left and Right - Center excluded for depth perception
-	const ELane LanesLR[] = { ELane::Left, ELane::Right };
-	const ELane LanesRL[] = { ELane::Right, ELane::Left };
-	const ELane* Lanes = bLeftToRight ? LanesLR : LanesRL;
-	
-	const EPickupHeight Heights[] = {
-		EPickupHeight::Ground,
-		EPickupHeight::LowAir,
-		EPickupHeight::MidAir,
-		EPickupHeight::HighAir,
-		EPickupHeight::Apex
-	};
-	
-	for (int32 i = 0; i < Count; i++)
-	{
-		FPickupSpawnData Data;
-		Data.Lane = Lanes[i % 2];
-		Data.RelativeXOffset = StartX + (i * Spacing);
-		
-		int32 HeightIndex = FMath::Min(i, 4);
-		Data.HeightLevel = Heights[HeightIndex];
-		
-		OutPickups.Add(Data);
-	}
+	AppendAerialPattern(OutPickups, EPickupPatternType::Staircase, Count, PickupSpawner_MakeVariant(ELane::Left, bLeftToRight));
 }
 
 void UPickupSpawnerComponent::GenerateSkyTrailPattern(TArray<FPickupSpawnData>& OutPickups, int32 Count, ELane Lane)
 {
-	// High altitude line, requires sustained max jump
-	OutPickups.Reserve(Count);
-	
-	float StartX, EndX;
-	GetAerialPatternBounds(StartX, EndX);
-	float Spacing = (EndX - StartX) / FMath::Max(1, Count - 1);
-	
-	for (int32 i = 0; i < Count; i++)
-	{
-		FPickupSpawnData Data;
-		Data.Lane = Lane;
-		Data.RelativeXOffset = StartX + (i * Spacing);
-		Data.HeightLevel = EPickupHeight::HighAir;
-		
-		OutPickups.Add(Data);
-	}
+	AppendAerialPattern(OutPickups, EPickupPatternType::SkyTrail, Count, PickupSpawner_MakeVariant(Lane));
 }
 
 void UPickupSpawnerComponent::GenerateTowerPattern(TArray<FPickupSpawnData>& OutPickups, float CenterX, ELane Lane)
 {
-	// Vertical stack at same X, one pickup per height level
-	const EPickupHeight Heights[] = {
-		EPickupHeight::Ground,
-		EPickupHeight::LowAir,
-		EPickupHeight::MidAir,
-		EPickupHeight::HighAir,
-		EPickupHeight::Apex
-	};
-	
 	float AerialStartX, AerialEndX;
 	GetAerialPatternBounds(AerialStartX, AerialEndX);
-	float SafeCenterX = FMath::Clamp(CenterX, AerialStartX, AerialEndX);
-	
-	for (int32 i = 0; i < 5; i++)
-	{
-		FPickupSpawnData Data;
-		Data.Lane = Lane;
-		Data.RelativeXOffset = SafeCenterX;
-		Data.HeightLevel = Heights[i];
-		
-		OutPickups.Add(Data);
-	}
+	AppendPatternAroundCenter(OutPickups, GetPatternTemplate(EPickupPatternType::Tower, 0, PickupSpawner_MakeVariant(Lane)),
+		CenterX, AerialStartX, AerialEndX);
 }
 
 void UPickupSpawnerComponent::GenerateRainbowPattern(TArray<FPickupSpawnData>& OutPickups, int32 Count, bool bLeftToRight)
 {
-	// 3D arc across lanes AND height
-	// NOTE: Only uses Left and Right lanes (no Center) to avoid depth perception issues.
-	// The arc goes L→R or R→L with height peaking in the middle of the X traverse.
-	OutPickups.Reserve(Count);
-	
-	float StartX, EndX;
-	GetAerialPatternBounds(StartX, EndX);
-	float Spacing = (EndX - StartX) / FMath::Max(1, Count - 1);
-	
-	for (int32 i = 0; i < Count; i++)
+	AppendAerialPattern(OutPickups, EPickupPatternType::Rainbow, Count, PickupSpawner_MakeVariant(ELane::Left, bLeftToRight));
+}
+
+void UPickupSpawnerComponent::GenerateBouncingArcsPattern(TArray<FPickupSpawnData>& OutPickups, int32 NumBounds)
+{
+	// Template count is the bound count; the starting direction is rolled per segment
+	const bool bLeftToRight = LayoutRandom.RandRange(0, 1) == 1;
+	AppendAerialPattern(OutPickups, EPickupPatternType::BouncingArcs, FMath::Max(2, NumBounds), PickupSpawner_MakeVariant(ELane::Left, bLeftToRight));
+}
+
+// --- Pattern Templates ---
+
+void UPickupSpawnerComponent::BuildPatternTemplates()
+{
+	PatternTemplates.Reset();
+
+	for (const FPickupPattern& Pattern : PredefinedPatterns)
 	{
-		FPickupSpawnData Data;
-		Data.RelativeXOffset = StartX + (i * Spacing);
-		
-		float t = (float)i / FMath::Max(1, Count - 1);
-		float ParabolicValue = 4.0f * t * (1.0f - t);
-		
-		// Only use Left and Right lanes - transition at midpoint
-		if (bLeftToRight)
+		// Hand-placed patterns are used as authored
+		if (Pattern.Pickups.Num() > 0)
 		{
-			Data.Lane = (t < 0.5f) ? ELane::Left : ELane::Right;
+			continue;
 		}
-		else
+
+		TArray<uint8, TInlineAllocator<4>> Variants;
+		const int32 TemplateCount = PickupSpawner_GetTemplateVariants(Pattern.PatternType, Pattern.PickupCount, Variants);
+		for (uint8 Variant : Variants)
 		{
-			Data.Lane = (t < 0.5f) ? ELane::Right : ELane::Left;
+			GetPatternTemplate(Pattern.PatternType, TemplateCount, Variant);
 		}
-		
-		// Height follows parabolic arc
-		if (ParabolicValue < 0.25f)
-			Data.HeightLevel = EPickupHeight::LowAir;
-		else if (ParabolicValue < 0.5f)
-			Data.HeightLevel = EPickupHeight::MidAir;
-		else if (ParabolicValue < 0.75f)
-			Data.HeightLevel = EPickupHeight::HighAir;
-		else
-			Data.HeightLevel = EPickupHeight::Apex;
-		
-		OutPickups.Add(Data);
 	}
+
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("PickupSpawner: Built %d pattern templates for %d patterns"), PatternTemplates.Num(), PredefinedPatterns.Num());
 }
 
-void UPickupSpawnerComponent::GenerateBouncingArcsPattern(TArray<FPickupSpawnData>& OutPickups, int32 NumBounds)
+const TArray<FPickupSpawnData>& UPickupSpawnerComponent::GetPatternTemplate(EPickupPatternType PatternType, int32 Count, uint8 Variant)
+{
+	const uint32 Key = PickupSpawner_MakeTemplateKey(PatternType, Count, Variant);
+	if (const TArray<FPickupSpawnData>* Template = PatternTemplates.Find(Key))
+	{
+		return *Template;
+	}
+
+	// A pattern added at runtime (or a count the predefined list doesn't use): build it once
+	TArray<FPickupSpawnData>& Template = PatternTemplates.Add(Key);
+	PickupSpawner_BuildPatternTemplate(PatternType, Count, Variant, Template);
+	return Template;
+}
+
+void UPickupSpawnerComponent::AppendGroundPattern(TArray<FPickupSpawnData>& OutPickups, EPickupPatternType PatternType, int32 Count, uint8 Variant)
+{
+	AppendPatternAlongSpan(OutPickups, GetPatternTemplate(PatternType, Count, Variant), GetEffectiveMinSpawnOffset(), GetEffectiveMaxSpawnOffset());
+}
+
+void UPickupSpawnerComponent::AppendAerialPattern(TArray<FPickupSpawnData>& OutPickups, EPickupPatternType PatternType, int32 Count, uint8 Variant)
 {
-	// Alternating L->R and R->L aerial arcs, creates a bouncing ball effect
-	// NOTE: Only uses Left and Right lanes (no Center) to avoid depth perception issues.
-	// Each bound = 2 pickups (L/R or R/L) at jump arc heights
-	
-	NumBounds = FMath::Max(2, NumBounds);
-	int32 TotalPickups = NumBounds * 2;
-	OutPickups.Reserve(TotalPickups);
-	
 	float StartX, EndX;
 	GetAerialPatternBounds(StartX, EndX);
-	
-	float TotalRange = EndX - StartX;
-	float BoundWidth = TotalRange / NumBounds;
-	float PickupSpacing = BoundWidth / 2.0f;
-	
-	// Low -> High per bound (apex reached at lane transition)
-	const EPickupHeight ArcHeights[] = {
-		EPickupHeight::LowAir,
-		EPickupHeight::HighAir
-	};
-	
-	float CurrentX = StartX;
-	bool bLeftToRight = FMath::RandBool();
-	
-	for (int32 Bound = 0; Bound < NumBounds; Bound++)
+	AppendPatternAlongSpan(OutPickups, GetPatternTemplate(PatternType, Count, Variant), StartX, EndX);
+}
+
+void UPickupSpawnerComponent::AppendPatternAlongSpan(TArray<FPickupSpawnData>& OutPickups, const TArray<FPickupSpawnData>& Template, float StartX, float EndX)
+{
+	const float Span = EndX - StartX;
+	OutPickups.Reserve(OutPickups.Num() + Template.Num());
+	for (const FPickupSpawnData& Entry : Template)
 	{
-		ELane Lanes[2];
-		if (bLeftToRight)
-		{
-			Lanes[0] = ELane::Left;
-			Lanes[1] = ELane::Right;
-		}
-		else
-		{
-			Lanes[0] = ELane::Right;
-			Lanes[1] = ELane::Left;
-		}
-		
-		for (int32 i = 0; i < 2; i++)
-		{
-			FPickupSpawnData Data;
-			Data.Lane = Lanes[i];
-			Data.RelativeXOffset = FMath::Clamp(CurrentX, StartX, EndX);
-			Data.HeightLevel = ArcHeights[i];
-			
-			OutPickups.Add(Data);
-			CurrentX += PickupSpacing;
-		}
-		
-		bLeftToRight = !bLeftToRight;
+		FPickupSpawnData& Data = OutPickups.Add_GetRef(Entry);
+		Data.RelativeXOffset = StartX + Entry.RelativeXOffset * Span;
+	}
+}
+
+void UPickupSpawnerComponent::AppendPatternAroundCenter(TArray<FPickupSpawnData>& OutPickups, const TArray<FPickupSpawnData>& Template, float CenterX, float MinX, float MaxX)
+{
+	OutPickups.Reserve(OutPickups.Num() + Template.Num());
+	for (const FPickupSpawnData& Entry : Template)
+	{
+		FPickupSpawnData& Data = OutPickups.Add_GetRef(Entry);
+		Data.RelativeXOffset = FMath::Clamp(CenterX + Entry.RelativeXOffset, MinX, MaxX);
 	}
 }
 
@@ -2063,7 +2471,7 @@ const FPickupPattern* UPickupSpawnerComponent::SelectPattern() const
 	}
 
 	// Weighted random selection
-	float RandomValue = FMath::FRand() * TotalWeight;
+	float RandomValue = LayoutRandom.FRand() * TotalWeight;
 	float AccumulatedWeight = 0.0f;
 
 	for (const FPickupPattern* Pattern : ValidPatterns)
@@ -2511,7 +2919,7 @@ bool UPickupSpawnerComponent::TrySpawnDebugPickupRow(float SegmentStartX, float
 	
 	FVector EMPPos(SpawnX, GetLaneYPosition(ELane::Left), EMPSpawnZ);
 	EMP->Activate(EMPPos, ELane::Left);
-	ActivePickups.Add(EMP);
+	AddActivePickup(EMP);
 	UE_LOG(LogStateRunner_Arcade, Log, TEXT("Pickup Showcase: EMP LEFT spawned at (%.0f, %.0f, %.0f)"), 
 		EMPPos.X, EMPPos.Y, EMPPos.Z);
 
@@ -2523,7 +2931,7 @@ bool UPickupSpawnerComponent::TrySpawnDebugPickupRow(float SegmentStartX, float
 		{
 			FVector MagnetPos(SpawnX, GetLaneYPosition(ELane::Center), MagnetSpawnZ);
 			MagnetPickup->Activate(MagnetPos, ELane::Center);
-			ActivePickups.Add(MagnetPickup);
+			AddActivePickup(MagnetPickup);
 			UE_LOG(LogStateRunner_Arcade, Log, TEXT("Pickup Showcase: Magnet CENTER spawned at (%.0f, %.0f, %.0f)"), 
 				MagnetPos.X, MagnetPos.Y, MagnetPos.Z);
 		}
@@ -2542,7 +2950,7 @@ bool UPickupSpawnerComponent::TrySpawnDebugPickupRow(float SegmentStartX, float
 		{
 			FVector OneUpCenterPos(SpawnX, GetLaneYPosition(ELane::Center), OneUpSpawnZ);
 			OneUpCenter->Activate(OneUpCenterPos, ELane::Center);
-			ActivePickups.Add(OneUpCenter);
+			AddActivePickup(OneUpCenter);
 			UE_LOG(LogStateRunner_Arcade, Log, TEXT("Pickup Showcase: 1-Up CENTER (fallback) spawned at (%.0f, %.0f, %.0f)"), 
 				OneUpCenterPos.X, OneUpCenterPos.Y, OneUpCenterPos.Z);
 		}
@@ -2559,7 +2967,7 @@ bool UPickupSpawnerComponent::TrySpawnDebugPickupRow(float SegmentStartX, float
 	
 	FVector OneUpRightPos(SpawnX, GetLaneYPosition(ELane::Right), OneUpSpawnZ);
 	OneUpRight->Activate(OneUpRightPos, ELane::Right);
-	ActivePickups.Add(OneUpRight);
+	AddActivePickup(OneUpRight);
 	UE_LOG(LogStateRunner_Arcade, Log, TEXT("Pickup Showcase: 1-Up RIGHT spawned at (%.0f, %.0f, %.0f)"), 
 		OneUpRightPos.X, OneUpRightPos.Y, OneUpRightPos.Z);
 
@@ -2567,10 +2975,26 @@ bool UPickupSpawnerComponent::TrySpawnDebugPickupRow(float SegmentStartX, float
 
 	if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
 	{
-		Debug->LogEvent(EDebugCategory::Spawning, 
-			MagnetClass ? TEXT("Pickup Showcase: EMP | Magnet | 1-Up spawned") 
-			            : TEXT("Pickup Showcase: EMP | 1-Up | 1-Up spawned"));
+		Debug->RecordEvent(EDebugCategory::Spawning, EDebugEventId::PickupShowcaseSpawned, MagnetClass ? 1 : 0);
 	}
 
 	return true;
 }
+
+// --- Deprecated Settings ---
+
+#if WITH_EDITORONLY_DATA
+void UPickupSpawnerComponent::MigrateDeprecatedDifficulty(UDifficultyDirectorComponent& Director) const
+{
+	// Old default = never tuned, or already migrated and resaved
+	if (SegmentsPerDensityIncrease_DEPRECATED == GetDefault<UPickupSpawnerComponent>()->SegmentsPerDensityIncrease_DEPRECATED)
+	{
+		return;
+	}
+
+	Director.SetSegmentsPerDensityLevel(SegmentsPerDensityIncrease_DEPRECATED);
+
+	UE_LOG(LogStateRunner_Arcade, Warning, TEXT("PickupSpawner: Moved a density level every %d segments to the difficulty director's PickupDensityCurve - resave %s"),
+		SegmentsPerDensityIncrease_DEPRECATED, *GetPathName());
+}
+#endif
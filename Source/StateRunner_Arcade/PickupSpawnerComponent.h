@@ -4,8 +4,13 @@
 #include "Components/ActorComponent.h"
 #include "BaseObstacle.h" // For ELane enum
 #include "BasePickup.h"   // For EPickupType enum
+#include "SpawnTypeTraits.h"
+#include "ActorPool.h"
+#include "GameplaySimulationSubsystem.h"
 #include "PickupSpawnerComponent.generated.h"
 
+class UDifficultyDirectorComponent;
+
 /**
  * Height level for pickup spawning.
  * Maps to Z-offsets based on how high the player can jump.
@@ -200,7 +205,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnMagnetStateChanged, bool, bIsActi
  * with density scaling up as difficulty increases.
  */
 UCLASS(ClassGroup=(StateRunner), meta=(BlueprintSpawnableComponent))
-class STATERUNNER_ARCADE_API UPickupSpawnerComponent : public UActorComponent
+class STATERUNNER_ARCADE_API UPickupSpawnerComponent : public UActorComponent, public IGameplaySimulated
 {
 	GENERATED_BODY()
 
@@ -212,9 +217,15 @@ protected:
 
 	virtual void BeginPlay() override;
 
+	/** Records pool peaks for adaptive sizing */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	/** Tick is only active during magnet effect — pulls DataPackets toward player */
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
+	/** Fixed-step mode: magnet pull runs here instead of in TickComponent */
+	virtual void SimulateStep(float StepSeconds) override;
+
 	// --- Pickup Configuration ---
 
 protected:
@@ -247,6 +258,58 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Pickup Config|Pooling", meta=(ClampMin="5", ClampMax="50"))
 	int32 PoolExpansionSize = 10;
 
+	/**
+	 * Spread the initial pool fill across frames instead of spawning it all in BeginPlay.
+	 * Only PrewarmBootstrapCount pickups per type are spawned up front; the rest
+	 * trickle in during the countdown/intro at PrewarmFrameBudgetMs per frame.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Pickup Config|Pooling")
+	bool bTimeSlicedPrewarm = true;
+
+	/**
+	 * Pickups per type spawned synchronously in BeginPlay when time-slicing.
+	 * Data Packets spawn from the first segment, so this should cover a couple of segments.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Pickup Config|Pooling", meta=(ClampMin="0", ClampMax="50", EditCondition="bTimeSlicedPrewarm"))
+	int32 PrewarmBootstrapCount = 20;
+
+	/**
+	 * Milliseconds per frame the prewarm scheduler may spend spawning pool actors.
+	 * At least one actor is spawned per frame while work remains.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Pickup Config|Pooling", meta=(ClampMin="0.1", ClampMax="8.0"))
+	float PrewarmFrameBudgetMs = 1.0f;
+
+	/**
+	 * Free Data Packets to keep ready, in segments' worth of predicted demand.
+	 * The pool grows ahead of the next density level instead of on exhaustion.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Pickup Config|Pooling", meta=(ClampMin="0.5", ClampMax="6.0"))
+	float PrewarmHeadroomSegments = 2.0f;
+
+	/**
+	 * Size each pool from peak usage recorded in earlier sessions instead of the fixed size.
+	 * Peaks are saved to GameUserSettings on EndPlay, so hot types start big enough to avoid
+	 * ExpandPool() and rarely used types stop wasting memory.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Pickup Config|Pooling")
+	bool bAdaptivePoolSizing = true;
+
+	/** Multiplier on the recorded peak when sizing a pool from history */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Pickup Config|Pooling", meta=(ClampMin="1.0", ClampMax="3.0", EditCondition="bAdaptivePoolSizing"))
+	float AdaptivePoolMargin = 1.25f;
+
+	/** Smallest pool adaptive sizing will create for a type with history */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Pickup Config|Pooling", meta=(ClampMin="1", ClampMax="50", EditCondition="bAdaptivePoolSizing"))
+	int32 AdaptiveMinPoolSize = 2;
+
+	/**
+	 * Fraction of the stored peak kept each session before merging in the new peak.
+	 * Below 1.0 lets a pool shrink again when its type falls out of use.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Pickup Config|Pooling", meta=(ClampMin="0.5", ClampMax="1.0", EditCondition="bAdaptivePoolSizing"))
+	float PoolHistoryDecay = 0.9f;
+
 	// --- Lane Configuration ---
 
 protected:
@@ -279,7 +342,7 @@ protected:
 	int32 MaxPickupsPerSegment = 10;
 
 	/**
-	 * Current pickup density (increases with difficulty).
+	 * Current pickup density (the GameMode's DifficultyDirectorComponent's PickupDensityCurve).
 	 * 0 = minimum, higher = more pickups
 	 */
 	UPROPERTY(BlueprintReadOnly, Category="Spawning")
@@ -344,9 +407,18 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Spawning|Obstacle Avoidance", meta=(ClampMin="3", ClampMax="20"))
 	int32 MaxObstacleAvoidanceAttempts = 10;
 
-	/** Segments between density increases. Should match ObstacleSpawner for sync. */
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Density", meta=(ClampMin="1", ClampMax="15"))
-	int32 SegmentsPerDensityIncrease = 7;
+	/**
+	 * X resolution of the per-segment obstacle occupancy grid.
+	 * Smaller buckets mean fewer exact fallback checks at keep-out edges, more bits per segment.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Spawning|Obstacle Avoidance", meta=(ClampMin="5.0", ClampMax="100.0"))
+	float OccupancyBucketSize = 25.0f;
+
+#if WITH_EDITORONLY_DATA
+	/** Old density ramp (a level every N segments), moved into the director's PickupDensityCurve on load */
+	UPROPERTY()
+	int32 SegmentsPerDensityIncrease_DEPRECATED = 7;
+#endif
 
 	// --- 1-Up Configuration ---
 
@@ -537,25 +609,58 @@ protected:
 
 protected:
 
-	/** Pool for Data Packet pickups */
-	UPROPERTY()
-	TArray<TObjectPtr<ABasePickup>> DataPacketPool;
+	/**
+	 * Object pool per pickup type, indexed by EPickupType.
+	 * Pools/active list are not UPROPERTYs -- see AddReferencedObjects().
+	 */
+	TActorPool<ABasePickup> PickupPools[NumPickupTypes];
 
-	/** Pool for 1-Up pickups */
-	UPROPERTY()
-	TArray<TObjectPtr<ABasePickup>> OneUpPool;
+	/**
+	 * All currently active pickups.
+	 * Pickups remove themselves on Deactivate() via ReturnPickupToPool().
+	 */
+	TActiveActorList<ABasePickup> ActivePickups;
 
-	/** Pool for EMP pickups */
-	UPROPERTY()
-	TArray<TObjectPtr<ABasePickup>> EMPPool;
+	/**
+	 * Active pickups sorted by track X ascending (all lanes), for range queries.
+	 * Scrolling keeps the order; the magnet re-sorts the few it moves.
+	 * Maintained alongside ActivePickups; reported to GC in AddReferencedObjects().
+	 */
+	TArray<TObjectPtr<ABasePickup>> PickupXIndex;
 
-	/** Pool for Magnet pickups */
-	UPROPERTY()
-	TArray<TObjectPtr<ABasePickup>> MagnetPool;
+	/** RNG for placement, patterns and type rolls -- seeded from the run's PickupLayout stream */
+	FRandomStream LayoutRandom;
 
-	/** All currently active pickups */
-	UPROPERTY()
-	TArray<TObjectPtr<ABasePickup>> ActivePickups;
+	/**
+	 * Normalized offset tables for the procedural patterns, keyed by pattern type, count and
+	 * lane/direction variant. Built in BeginPlay for every predefined pattern (a miss is built
+	 * on first use); generating a segment's pattern is then a scaled copy of one of these.
+	 */
+	TMap<uint32, TArray<FPickupSpawnData>> PatternTemplates;
+
+	/** Segment layout, reused by SpawnPickupsForSegment */
+	TArray<FPickupSpawnData> PickupLayoutScratch;
+
+	/**
+	 * Magnet scratch buffers, reused every update: pickups in pull range and their
+	 * positions as separate X/Y/Z arrays, so the pull math is a flat loop over floats.
+	 */
+	TArray<ABasePickup*> MagnetTargets;
+	TArray<float> MagnetPosX;
+	TArray<float> MagnetPosY;
+	TArray<float> MagnetPosZ;
+
+	/** Time-sliced pool growth, indexed by EPickupType */
+	TPrewarmQueue<ABasePickup, NumPickupTypes> PrewarmQueue;
+
+	/** Peak in-use count per type from earlier sessions (0 = no history), indexed by EPickupType */
+	int32 RecordedPoolPeaks[NumPickupTypes] = {};
+
+	/** Hardware tier cap on each type's pool, read at InitializePools (0 = uncapped) */
+	int32 PoolSizeCap = 0;
+
+	/** Spin and bob off on every pooled pickup (performance governor) */
+	bool bPickupEffectsReduced = false;
 
 	/** Segments spawned counter */
 	int32 SegmentsSpawned = 0;
@@ -595,6 +700,12 @@ protected:
 	/** Remaining time on the magnet effect */
 	float MagnetTimeRemaining = 0.0f;
 
+	/** Runner the active magnet pulls toward (and whose VFX is on) */
+	TWeakObjectPtr<APawn> MagnetRunner;
+
+	/** True when UGameplaySimulationSubsystem steps the magnet (tick stays off) */
+	bool bSimulationDriven = false;
+
 	/**
 	 * Cached obstacle positions for current segment (used for avoidance).
 	 * Populated before spawning pickups for a segment.
@@ -614,6 +725,33 @@ protected:
 	 */
 	bool bSegmentHasBlockingObstacles = false;
 
+	/**
+	 * Obstacle occupancy grid for the current segment, one bitset per lane (indexed by ELane).
+	 * Blocked: every X in the bucket is inside an obstacle's keep-out -- unsafe, no further checks.
+	 * Edge: the bucket is partly inside -- exact test against that lane's obstacles only.
+	 * Built once per CacheObstaclePositions().
+	 */
+	TBitArray<> OccupancyBlocked[3];
+	TBitArray<> OccupancyEdge[3];
+
+	/** Cached obstacle X positions per lane, for exact tests in Edge buckets */
+	TArray<float> CachedObstacleXByLane[3];
+
+	/** Track X of bucket 0 */
+	float OccupancyOriginX = 0.0f;
+
+	/** Buckets per lane */
+	int32 OccupancyBucketCount = 0;
+
+	/**
+	 * False if the grid can't reproduce the distance rule exactly (off-lane obstacle,
+	 * lanes close enough for the cross-lane check to matter) -- queries use the exact path.
+	 */
+	bool bOccupancyGridValid = false;
+
+	/** World scroll's presented distance when the grid was built (the grid is a track-space snapshot) */
+	double OccupancyScrollDistance = 0.0;
+
 	// --- Events ---
 
 public:
@@ -629,6 +767,14 @@ public:
 
 public:
 
+#if WITH_EDITORONLY_DATA
+	/**
+	 * Carry ramp settings saved before the difficulty director existed over to its curves.
+	 * Called from the GameMode's PostLoad; does nothing while the settings hold their old defaults.
+	 */
+	void MigrateDeprecatedDifficulty(UDifficultyDirectorComponent& Director) const;
+#endif
+
 	/**
 	 * Spawn pickups for a track segment.
 	 * 
@@ -680,9 +826,12 @@ public:
 	 * within MagnetPullRange ahead of the player are pulled toward the player's lane.
 	 * Collecting a second Magnet while active resets the timer (does NOT stack).
 	 * Broadcasts OnMagnetStateChanged and activates player VFX.
+	 *
+	 * @param Runner Runner that collected it, who the pull follows (Player 1's if null). In
+	 *               versus a rival's Magnet takes an active pull over.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Magnet")
-	void ActivateMagnet();
+	void ActivateMagnet(APawn* Runner = nullptr);
 
 	/**
 	 * Check if the magnet pull effect is currently active.
@@ -703,10 +852,117 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Spawning")
 	void ResetSpawner();
 
+	// --- Pool Functions ---
+
+public:
+
+	/** Report pooled pickups to GC (pools are plain C++ containers) */
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+
+	/**
+	 * Return a pickup to its pool. Called from ABasePickup::Deactivate().
+	 * O(1): swap-removes from ActivePickups and pushes the pool slot back on the free stack.
+	 * 
+	 * @param Pickup Pickup being deactivated
+	 */
+	void ReturnPickupToPool(ABasePickup* Pickup);
+
+	/** Peak simultaneous in-use count for a type's pool */
+	UFUNCTION(BlueprintPure, Category="Pickup Spawner|Pooling")
+	int32 GetPoolHighWaterMark(EPickupType Type) const { return GetPoolForType(Type).GetHighWaterMark(); }
+
+	/** Currently active pickups (unordered; copy before iterating if the loop can deactivate) */
+	const TArray<TObjectPtr<ABasePickup>>& GetActivePickups() const { return ActivePickups.GetArray(); }
+
+	/** Turn pickup spin and bob off or back on, for every pooled pickup and any spawned later */
+	void SetPickupEffectsReduced(bool bReduced);
+
+	/** Read-only view of the current segment's occupancy grid, for the debug draw */
+	struct FOccupancyGridView
+	{
+		/** Per lane (ELane order) */
+		const TBitArray<>* Blocked = nullptr;
+		const TBitArray<>* Edge = nullptr;
+		float LaneY[3] = {};
+
+		/** Track X of bucket 0 when the grid was built */
+		float OriginX = 0.0f;
+		float BucketSize = 0.0f;
+		int32 BucketCount = 0;
+
+		/** UWorldScrollComponent::GetPresentedScrollDistance at build time */
+		double ScrollDistance = 0.0;
+	};
+
+	/**
+	 * Get the occupancy grid the last segment's pickups were placed against.
+	 *
+	 * @return False if there's no grid (not built yet, or the lane layout forces the exact path)
+	 */
+	bool GetOccupancyGridView(FOccupancyGridView& OutView) const;
+
+	/** Peak simultaneous active pickups across all types */
+	UFUNCTION(BlueprintPure, Category="Pickup Spawner|Pooling")
+	int32 GetActiveHighWaterMark() const { return ActivePickups.GetHighWaterMark(); }
+
+	/** Whether the prewarm scheduler still has pool actors left to spawn */
+	UFUNCTION(BlueprintPure, Category="Pickup Spawner|Pooling")
+	bool IsPrewarming() const { return PrewarmQueue.HasWork(); }
+
+protected:
+
+	/**
+	 * Raise a pool's prewarm target and make sure the scheduler is running.
+	 * Never shrinks a target.
+	 * 
+	 * @param Type Pool to grow
+	 * @param TargetSize Total pool size (active + free) to work toward
+	 */
+	void RequestPrewarm(EPickupType Type, int32 TargetSize);
+
+	/**
+	 * Set prewarm targets from predicted demand at the next density level.
+	 * Data Packets get PrewarmHeadroomSegments segments of headroom; rare types keep one spare.
+	 */
+	void UpdatePredictivePrewarm();
+
+	/** Bind PrewarmQueue to this spawner's pools (before the first RequestPrewarm) */
+	void InitializePrewarmQueue();
+
+	/** Push pool sizes, active count and pool memory to the StateRunner stats group and debug overlay */
+	void UpdatePoolStats() const;
+
+	/**
+	 * Initial pool size for a type: recorded peak * AdaptivePoolMargin when history exists,
+	 * otherwise the configured size (InitialPoolSize / OneUpPoolSize / EMPPoolSize / MagnetPoolSize).
+	 */
+	int32 GetInitialPoolSize(EPickupType Type) const;
+
+	/** Read recorded pool peaks from GameUserSettings */
+	void LoadPoolHistory();
+
+	/** Merge this session's high-water marks into the recorded peaks and save them */
+	void SavePoolHistory() const;
+
 	// --- Protected Functions ---
 
 protected:
 
+	/** Count down the magnet timer and pull pickups toward the player (tick or fixed step) */
+	void TickMagnet(float DeltaTime);
+
+	/** Turn the magnet VFX on MagnetRunner on or off */
+	void SetMagnetRunnerEffect(bool bActive);
+
+	/** Add to ActivePickups and the X index (after Activate placed it) */
+	void AddActivePickup(ABasePickup* Pickup);
+
+	/** First PickupXIndex entry whose track X is >= TrackX */
+	int32 LowerBoundPickupX(float TrackX) const;
+
+	/** Restore PickupXIndex order after the magnet moved pickups (insertion sort; nearly sorted) */
+	void ResortPickupXIndex();
+
 	/** Generate pickup layout for a segment */
 	void GeneratePickupLayout(TArray<FPickupSpawnData>& OutPickups, int32 PickupCount);
 
@@ -738,12 +994,20 @@ protected:
 	/** Get pickup from pool by type */
 	ABasePickup* GetPickupFromPool(EPickupType Type);
 
-	/** Get pool array for a specific type */
-	TArray<TObjectPtr<ABasePickup>>& GetPoolForType(EPickupType Type);
+	/** Get pool for a specific type */
+	TActorPool<ABasePickup>& GetPoolForType(EPickupType Type) { return PickupPools[static_cast<int32>(Type)]; }
+	const TActorPool<ABasePickup>& GetPoolForType(EPickupType Type) const { return PickupPools[static_cast<int32>(Type)]; }
+
+	/** Actors across every type's pool */
+	int32 GetTotalPooledCount() const;
+
+public:
 
-	/** Get class for a specific pickup type */
+	/** Get class for a specific pickup type (public for UShaderPrecacheComponent) */
 	TSubclassOf<ABasePickup> GetClassForType(EPickupType Type) const;
 
+protected:
+
 	/** Expand pool for a specific type */
 	void ExpandPool(EPickupType Type);
 
@@ -799,6 +1063,24 @@ protected:
 	 */
 	bool IsPositionSafeFromObstacles(const FVector& WorldPosition) const;
 
+	/** Distance test against every cached obstacle (grid fallback) */
+	bool IsPositionSafeFromObstaclesExact(const FVector& WorldPosition) const;
+
+	/**
+	 * Rasterize the cached obstacles into the lane x X-bucket occupancy grid.
+	 * 
+	 * @param MinX Track X of the grid start
+	 * @param MaxX Track X of the grid end
+	 */
+	void BuildOccupancyGrid(float MinX, float MaxX);
+
+	/**
+	 * Lane whose Y a position sits on.
+	 * 
+	 * @return Lane index, or INDEX_NONE if the position is between lanes
+	 */
+	int32 GetOccupancyLane(float Y) const;
+
 	/**
 	 * Find a safe spawn position near the desired position.
 	 * Tries to offset the position if the original is too close to obstacles.
@@ -1008,6 +1290,29 @@ protected:
 	 */
 	void GenerateBouncingArcsPattern(TArray<FPickupSpawnData>& OutPickups, int32 NumBounds);
 
+	// --- Pattern Templates ---
+
+	/** Build the templates for every variant the predefined patterns can roll */
+	void BuildPatternTemplates();
+
+	/**
+	 * Cached template for a pattern variant, built on a miss.
+	 * Span patterns hold 0-1 X offsets along the pattern span; Diamond, TripleLine and Tower
+	 * hold offsets from their center X.
+	 */
+	const TArray<FPickupSpawnData>& GetPatternTemplate(EPickupPatternType PatternType, int32 Count, uint8 Variant);
+
+	/** Append a span template stretched over the ground spawn range */
+	void AppendGroundPattern(TArray<FPickupSpawnData>& OutPickups, EPickupPatternType PatternType, int32 Count, uint8 Variant);
+
+	/** Append a span template stretched over the aerial bounds (landing room kept at the end) */
+	void AppendAerialPattern(TArray<FPickupSpawnData>& OutPickups, EPickupPatternType PatternType, int32 Count, uint8 Variant);
+
+	static void AppendPatternAlongSpan(TArray<FPickupSpawnData>& OutPickups, const TArray<FPickupSpawnData>& Template, float StartX, float EndX);
+
+	/** Append a centered template around CenterX, each pickup clamped to [MinX, MaxX] */
+	static void AppendPatternAroundCenter(TArray<FPickupSpawnData>& OutPickups, const TArray<FPickupSpawnData>& Template, float CenterX, float MinX, float MaxX);
+
 	/**
 	 * Select a random pattern based on difficulty and weights.
 	 * Filters out aerial patterns if segment has blocking obstacles.
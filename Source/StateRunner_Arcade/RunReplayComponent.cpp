@@ -0,0 +1,547 @@
+#include "RunReplayComponent.h"
+#include "StateRunner_ArcadeGameMode.h"
+#include "StateRunner_ArcadeCharacter.h"
+#include "AutopilotComponent.h"
+#include "VersusModeComponent.h"
+#include "ScoreSystemComponent.h"
+#include "LivesSystemComponent.h"
+#include "LeaderboardSaveGame.h"
+#include "ArcadeSaveSubsystem.h"
+#include "RunSeedSubsystem.h"
+#include "HAL/FileManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "StateRunner_Arcade.h"
+
+// Prefixed to avoid Unity build collisions
+static uint32 RunReplay_ZigZag(int32 Value)
+{
+	return (static_cast<uint32>(Value) << 1) ^ static_cast<uint32>(Value >> 31);
+}
+
+static int32 RunReplay_UnZigZag(uint32 Value)
+{
+	return static_cast<int32>(Value >> 1) ^ -static_cast<int32>(Value & 1);
+}
+
+static const TCHAR* RunReplay_Extension = TEXT(".srreplay");
+
+// --- FRunReplay ---
+
+void FRunReplay::Reset()
+{
+	Seed = 0;
+	StepRate = 0;
+	SampleSteps = 0;
+	LastStep = 0;
+	Score = 0;
+	Events.Reset();
+	Trajectory.Reset();
+}
+
+void FRunReplay::Serialize(FArchive& Ar)
+{
+	uint32 Magic = FileMagic;
+	uint16 Version = CurrentVersion;
+	Ar << Magic << Version;
+	if (Ar.IsLoading() && (Magic != FileMagic || Version > CurrentVersion))
+	{
+		Ar.SetError();
+		return;
+	}
+
+	Ar << Seed << StepRate << SampleSteps << LastStep << Score;
+
+	// Events: step delta, input and press/release packed into one varint
+	uint32 NumEvents = Events.Num();
+	Ar.SerializeIntPacked(NumEvents);
+	if (Ar.IsLoading())
+	{
+		// Every event takes at least a byte -- a larger count is a corrupt file
+		if (NumEvents > static_cast<uint32>(Ar.TotalSize() - Ar.Tell()))
+		{
+			Ar.SetError();
+			return;
+		}
+		Events.SetNum(NumEvents);
+	}
+
+	uint32 PreviousStep = 0;
+	for (FInputEvent& Event : Events)
+	{
+		uint32 Packed = ((Event.Step - PreviousStep) << 4) | (static_cast<uint32>(Event.Input) << 1) | (Event.bPressed ? 1 : 0);
+		Ar.SerializeIntPacked(Packed);
+		if (Ar.IsLoading())
+		{
+			Event.Step = PreviousStep + (Packed >> 4);
+			Event.Input = static_cast<ERunReplayInput>(FMath::Min<uint32>((Packed >> 1) & 7, static_cast<uint32>(ERunReplayInput::Count) - 1));
+			Event.bPressed = (Packed & 1) != 0;
+		}
+		PreviousStep = Event.Step;
+	}
+
+	// Trajectory: step delta, then zigzag Y and Z deltas
+	uint32 NumSamples = Trajectory.Num();
+	Ar.SerializeIntPacked(NumSamples);
+	if (Ar.IsLoading())
+	{
+		if (NumSamples > static_cast<uint32>(Ar.TotalSize() - Ar.Tell()))
+		{
+			Ar.SetError();
+			return;
+		}
+		Trajectory.SetNum(NumSamples);
+	}
+
+	FTrajectorySample Previous;
+	for (FTrajectorySample& Sample : Trajectory)
+	{
+		uint32 StepDelta = Sample.Step - Previous.Step;
+		uint32 DeltaY = RunReplay_ZigZag(Sample.Y - Previous.Y);
+		uint32 DeltaZ = RunReplay_ZigZag(Sample.Z - Previous.Z);
+		Ar.SerializeIntPacked(StepDelta);
+		Ar.SerializeIntPacked(DeltaY);
+		Ar.SerializeIntPacked(DeltaZ);
+		if (Ar.IsLoading())
+		{
+			Sample.Step = Previous.Step + StepDelta;
+			Sample.Y = Previous.Y + RunReplay_UnZigZag(DeltaY);
+			Sample.Z = Previous.Z + RunReplay_UnZigZag(DeltaZ);
+		}
+		Previous = Sample;
+	}
+}
+
+bool FRunReplay::SaveToFile(const FString& Path)
+{
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+	Serialize(Writer);
+	return FFileHelper::SaveArrayToFile(Bytes, *Path);
+}
+
+bool FRunReplay::LoadFromFile(const FString& Path)
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *Path, FILEREAD_Silent))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+	Serialize(Reader);
+	if (Reader.IsError())
+	{
+		Reset();
+		return false;
+	}
+	return true;
+}
+
+bool FRunReplay::SampleTrajectory(double Step, int32& InOutCursor, FVector2D& OutYZ) const
+{
+	if (Trajectory.Num() == 0 || Step > LastStep)
+	{
+		return false;
+	}
+
+	InOutCursor = FMath::Clamp(InOutCursor, 0, Trajectory.Num() - 1);
+	while (InOutCursor + 1 < Trajectory.Num() && Trajectory[InOutCursor + 1].Step <= Step)
+	{
+		InOutCursor++;
+	}
+
+	const FTrajectorySample& From = Trajectory[InOutCursor];
+	if (InOutCursor + 1 >= Trajectory.Num() || Step <= From.Step)
+	{
+		OutYZ = FVector2D(From.Y, From.Z);
+		return true;
+	}
+
+	// Samples are only written on movement, so a long gap is the runner holding still until
+	// the sample before To -- only the last interval moves
+	const FTrajectorySample& To = Trajectory[InOutCursor + 1];
+	const double MoveStart = FMath::Max(static_cast<double>(From.Step), static_cast<double>(To.Step) - FMath::Max<int32>(SampleSteps, 1));
+	const float Alpha = static_cast<float>(FMath::Clamp((Step - MoveStart) / FMath::Max(To.Step - MoveStart, 1.0), 0.0, 1.0));
+	OutYZ = FVector2D(FMath::Lerp<float>(From.Y, To.Y, Alpha), FMath::Lerp<float>(From.Z, To.Z, Alpha));
+	return true;
+}
+
+// --- Component ---
+
+URunReplayComponent::URunReplayComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+void URunReplayComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	const AStateRunner_ArcadeGameMode* GameMode = Cast<AStateRunner_ArcadeGameMode>(GetOwner());
+	const UAutopilotComponent* Autopilot = GameMode ? GameMode->GetAutopilotComponent() : nullptr;
+	if (Autopilot && Autopilot->IsActive())
+	{
+		return;
+	}
+
+	UGameplaySimulationSubsystem* Simulation = UGameplaySimulationSubsystem::Get(this);
+	if (!Simulation || !Simulation->IsFixedStepEnabled())
+	{
+		// Without fixed steps there's no frame-rate independent clock to stamp inputs with
+		if (bPlayingBack || bRecordRuns)
+		{
+			UE_LOG(LogStateRunner_Arcade, Warning, TEXT("RunReplay: Fixed-step simulation is off, runs aren't recorded or replayed"));
+		}
+		bPlayingBack = false;
+		return;
+	}
+
+	StartStep = Simulation->GetStepCount();
+	bRecording = bRecordRuns && !bPlayingBack;
+
+	if (bRecording)
+	{
+		Replay.Reset();
+		if (const URunSeedSubsystem* RunSeed = URunSeedSubsystem::Get(this))
+		{
+			Replay.Seed = RunSeed->GetRunSeed();
+		}
+		Replay.StepRate = static_cast<uint16>(FMath::RoundToInt(1.0f / Simulation->GetStepSeconds()));
+		Replay.SampleSteps = static_cast<uint16>(TrajectorySampleSteps);
+	}
+	else if (bPlayingBack && Replay.StepRate != FMath::RoundToInt(1.0f / Simulation->GetStepSeconds()))
+	{
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("RunReplay: Replay was recorded at %d Hz, simulation runs at %.0f Hz -- playback will diverge"),
+			Replay.StepRate, 1.0f / Simulation->GetStepSeconds());
+	}
+
+	if (!GhostSource.IsEmpty() && GhostActorClass)
+	{
+		if (!LoadReplaySource(GhostSource, GhostReplay))
+		{
+			UE_LOG(LogStateRunner_Arcade, Log, TEXT("RunReplay: No replay for ghost %s"), *GhostSource);
+			GhostReplay.Reset();
+		}
+	}
+
+	if (bRecording || bPlayingBack || GhostReplay.Trajectory.Num() > 0)
+	{
+		Simulation->RegisterParticipant(this, this, ESimulationPhase::Input);
+	}
+
+	if (ULivesSystemComponent* Lives = GameMode ? GameMode->GetLivesSystemComponent() : nullptr)
+	{
+		Lives->OnPlayerDied.AddDynamic(this, &URunReplayComponent::HandlePlayerDied);
+	}
+}
+
+void URunReplayComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UGameplaySimulationSubsystem* Simulation = UGameplaySimulationSubsystem::Get(this))
+	{
+		Simulation->UnregisterParticipant(this);
+	}
+
+	const AStateRunner_ArcadeGameMode* GameMode = Cast<AStateRunner_ArcadeGameMode>(GetOwner());
+	if (ULivesSystemComponent* Lives = GameMode ? GameMode->GetLivesSystemComponent() : nullptr)
+	{
+		Lives->OnPlayerDied.RemoveDynamic(this, &URunReplayComponent::HandlePlayerDied);
+	}
+
+	if (GhostActor)
+	{
+		GhostActor->Destroy();
+		GhostActor = nullptr;
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void URunReplayComponent::SimulateStep(float StepSeconds)
+{
+	if (!CacheReferences())
+	{
+		return;
+	}
+
+	const uint32 Step = GetRunStep();
+
+	// Events recorded before step N were handled before step N ran -- same here
+	while (bPlayingBack && PlaybackCursor < Replay.Events.Num() && Replay.Events[PlaybackCursor].Step <= Step)
+	{
+		const FRunReplay::FInputEvent& Event = Replay.Events[PlaybackCursor++];
+		CachedRunner->ApplyReplayInput(Event.Input, Event.bPressed);
+	}
+
+	if (bRecording && TrajectorySampleSteps > 0 && Step % TrajectorySampleSteps == 0)
+	{
+		const FVector Location = CachedRunner->GetActorLocation();
+		const int32 Y = FMath::RoundToInt(Location.Y);
+		const int32 Z = FMath::RoundToInt(Location.Z);
+		if (Y != LastSampleY || Z != LastSampleZ)
+		{
+			Replay.Trajectory.Add({ Step, Y, Z });
+			LastSampleY = Y;
+			LastSampleZ = Z;
+		}
+	}
+
+	if (!GhostActor && GhostReplay.Trajectory.Num() > 0)
+	{
+		SpawnGhost();
+	}
+}
+
+void URunReplayComponent::PostSimulate(float Alpha, int32 StepsThisFrame)
+{
+	if (!GhostActor || !CachedRunner)
+	{
+		return;
+	}
+
+	FVector2D GhostYZ;
+	if (!GhostReplay.SampleTrajectory(GetRunStep() + Alpha, GhostCursor, GhostYZ))
+	{
+		// The ghost's run ended here
+		GhostActor->SetActorHiddenInGame(true);
+		return;
+	}
+
+	GhostActor->SetActorLocation(FVector(CachedRunner->GetActorLocation().X, GhostYZ.X, GhostYZ.Y));
+}
+
+// --- Public Functions ---
+
+void URunReplayComponent::ApplyLaunchOptions(const FString& Options)
+{
+	const AStateRunner_ArcadeGameMode* GameMode = Cast<AStateRunner_ArcadeGameMode>(GetOwner());
+	const UAutopilotComponent* Autopilot = GameMode ? GameMode->GetAutopilotComponent() : nullptr;
+	if (Autopilot && Autopilot->IsActive())
+	{
+		return;
+	}
+
+	// A versus match records one runner's inputs against a track two are playing -- not a replay
+	const UVersusModeComponent* Versus = GameMode ? GameMode->GetVersusModeComponent() : nullptr;
+	if (Versus && Versus->IsVersusActive())
+	{
+		bRecordRuns = false;
+		return;
+	}
+
+	GhostSource = UGameplayStatics::ParseOption(Options, TEXT("Ghost"));
+	if (GhostSource.IsEmpty() && bShowBestRunGhost)
+	{
+		GhostSource = TEXT("Top1");
+	}
+
+	PlaybackSource = UGameplayStatics::ParseOption(Options, TEXT("Replay"));
+	if (PlaybackSource.IsEmpty())
+	{
+		FParse::Value(FCommandLine::Get(), TEXT("Replay="), PlaybackSource);
+	}
+	if (PlaybackSource.IsEmpty())
+	{
+		return;
+	}
+
+	if (!LoadReplaySource(PlaybackSource, Replay))
+	{
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("RunReplay: Could not load replay %s"), *PlaybackSource);
+		return;
+	}
+
+	bPlayingBack = true;
+	PlaybackCursor = 0;
+
+	// Same seed, same track -- and the global RNG for the little that still uses it
+	if (URunSeedSubsystem* RunSeed = URunSeedSubsystem::Get(this))
+	{
+		RunSeed->SetNextRunSeed(Replay.Seed);
+	}
+	FMath::RandInit(Replay.Seed);
+	FMath::SRandInit(Replay.Seed);
+
+	// One step per frame: frame N of the playback is frame N of every other playback
+	if (FParse::Param(FCommandLine::Get(), TEXT("ReplayFixedFrames")) && Replay.StepRate > 0)
+	{
+		FApp::SetUseFixedTimeStep(true);
+		FApp::SetFixedDeltaTime(1.0 / Replay.StepRate);
+	}
+
+	UE_LOG(LogStateRunner_Arcade, Display, TEXT("RunReplay: Playing %s (seed %d, %d inputs, %u steps, score %d)"),
+		*PlaybackSource, Replay.Seed, Replay.Events.Num(), Replay.LastStep, Replay.Score);
+}
+
+bool URunReplayComponent::HandlePlayerInput(ERunReplayInput Input, bool bPressed)
+{
+	if (bPlayingBack)
+	{
+		return true;
+	}
+
+	if (bRecording)
+	{
+		Replay.Events.Add({ GetRunStep(), Input, bPressed });
+	}
+	return false;
+}
+
+void URunReplayComponent::StoreLeaderboardReplay(const FLeaderboardEntry& Entry, int32 AllTimeRank, const ULeaderboardSaveGame* Leaderboard)
+{
+	// Only a run recorded to the end is worth keeping
+	if (bRecording || Replay.LastStep == 0 || !Leaderboard)
+	{
+		return;
+	}
+
+	if (AllTimeRank > 0 && AllTimeRank <= LeaderboardReplayCount)
+	{
+		const FString Path = GetLeaderboardReplayPath(Entry);
+		if (!Replay.SaveToFile(Path))
+		{
+			UE_LOG(LogStateRunner_Arcade, Warning, TEXT("RunReplay: Could not write %s"), *Path);
+		}
+	}
+
+	// Drop replays of runs that fell out of the kept ranks
+	TSet<FString> Kept;
+	for (int32 Index = 0; Index < LeaderboardReplayCount; Index++)
+	{
+		FLeaderboardEntry Ranked;
+		if (!Leaderboard->GetEntry(ELeaderboardPeriod::AllTime, Index, Ranked))
+		{
+			break;
+		}
+		Kept.Add(FPaths::GetCleanFilename(GetLeaderboardReplayPath(Ranked)));
+	}
+
+	const FString Directory = FPaths::GetPath(GetLeaderboardReplayPath(Entry));
+	TArray<FString> Files;
+	IFileManager::Get().FindFiles(Files, *FPaths::Combine(Directory, FString(TEXT("*")) + RunReplay_Extension), true, false);
+	for (const FString& File : Files)
+	{
+		if (!Kept.Contains(File))
+		{
+			IFileManager::Get().Delete(*FPaths::Combine(Directory, File));
+		}
+	}
+}
+
+FString URunReplayComponent::GetLeaderboardReplayPath(const FLeaderboardEntry& Entry)
+{
+	// Score and timestamp identify an entry as stored (the packed board has no id)
+	const FPackedLeaderboardEntry Packed = FPackedLeaderboardEntry::Pack(Entry);
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Replays"), TEXT("Leaderboard"),
+		FString::Printf(TEXT("S%d_T%u%s"), Packed.Score, Packed.Timestamp, RunReplay_Extension));
+}
+
+FString URunReplayComponent::GetLastRunReplayPath()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Replays"), FString(TEXT("LastRun")) + RunReplay_Extension);
+}
+
+// --- Internal Functions ---
+
+bool URunReplayComponent::CacheReferences()
+{
+	if (!CachedRunner)
+	{
+		CachedRunner = Cast<AStateRunner_ArcadeCharacter>(UGameplayStatics::GetPlayerPawn(this, 0));
+	}
+	return CachedRunner != nullptr;
+}
+
+uint32 URunReplayComponent::GetRunStep() const
+{
+	const UGameplaySimulationSubsystem* Simulation = UGameplaySimulationSubsystem::Get(this);
+	return Simulation ? static_cast<uint32>(Simulation->GetStepCount() - StartStep) : 0;
+}
+
+bool URunReplayComponent::LoadReplaySource(const FString& Source, FRunReplay& OutReplay) const
+{
+	FString Path = Source;
+
+	if (Source.Equals(TEXT("Last"), ESearchCase::IgnoreCase))
+	{
+		Path = GetLastRunReplayPath();
+	}
+	else if (Source.StartsWith(TEXT("Top"), ESearchCase::IgnoreCase) && Source.Mid(3).IsNumeric())
+	{
+		const UArcadeSaveSubsystem* Saves = UArcadeSaveSubsystem::Get(this);
+		const ULeaderboardSaveGame* Leaderboard = Saves ? Saves->GetLeaderboard() : nullptr;
+		FLeaderboardEntry Entry;
+		if (!Leaderboard || !Leaderboard->GetEntry(ELeaderboardPeriod::AllTime, FCString::Atoi(*Source.Mid(3)) - 1, Entry))
+		{
+			return false;
+		}
+		Path = GetLeaderboardReplayPath(Entry);
+	}
+
+	return OutReplay.LoadFromFile(Path);
+}
+
+void URunReplayComponent::SpawnGhost()
+{
+	UWorld* World = GetWorld();
+	if (!World || !GhostActorClass)
+	{
+		return;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	GhostActor = World->SpawnActor<AActor>(GhostActorClass, CachedRunner->GetActorTransform(), SpawnParams);
+	if (GhostActor)
+	{
+		GhostActor->SetActorEnableCollision(false);
+	}
+}
+
+void URunReplayComponent::HandlePlayerDied()
+{
+	const AStateRunner_ArcadeGameMode* GameMode = Cast<AStateRunner_ArcadeGameMode>(GetOwner());
+	const UScoreSystemComponent* ScoreSystem = GameMode ? GameMode->GetScoreSystemComponent() : nullptr;
+	const int32 FinalScore = ScoreSystem ? ScoreSystem->GetCurrentScore() : 0;
+
+	// Playback stays flagged through game over so the run never reaches the leaderboard
+	if (bPlayingBack)
+	{
+		if (FinalScore == Replay.Score && GetRunStep() == Replay.LastStep)
+		{
+			UE_LOG(LogStateRunner_Arcade, Display, TEXT("RunReplay: Playback reproduced the run (score %d, step %u)"), FinalScore, Replay.LastStep);
+		}
+		else
+		{
+			UE_LOG(LogStateRunner_Arcade, Warning, TEXT("RunReplay: Playback diverged -- score %d at step %u, recorded %d at step %u"),
+				FinalScore, GetRunStep(), Replay.Score, Replay.LastStep);
+		}
+		return;
+	}
+
+	if (!bRecording)
+	{
+		return;
+	}
+
+	bRecording = false;
+	Replay.LastStep = GetRunStep();
+	Replay.Score = FinalScore;
+
+	const FString Path = GetLastRunReplayPath();
+	if (Replay.SaveToFile(Path))
+	{
+		UE_LOG(LogStateRunner_Arcade, Log, TEXT("RunReplay: %d inputs, %d samples written to %s"), Replay.Events.Num(), Replay.Trajectory.Num(), *Path);
+	}
+	else
+	{
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("RunReplay: Could not write %s"), *Path);
+	}
+}
@@ -0,0 +1,254 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "GameplaySimulationSubsystem.h"
+#include "RunReplayComponent.generated.h"
+
+class AStateRunner_ArcadeCharacter;
+class ULeaderboardSaveGame;
+struct FLeaderboardEntry;
+
+/**
+ * Player inputs a replay records (each as a press and a release).
+ * Fast fall isn't separate -- it's a Slide press while airborne, and replays as one.
+ */
+enum class ERunReplayInput : uint8
+{
+	LaneLeft,
+	LaneRight,
+	Jump,
+	Slide,
+	Overclock,
+
+	Count
+};
+
+/**
+ * One recorded run: its seed, every press/release, and a sparse runner trajectory for
+ * ghosts. Times are fixed simulation steps since the run started.
+ *
+ * On disk (Serialize) events and samples are delta-coded varints: an event is usually
+ * one or two bytes and a trajectory sample is only written when the runner moved, so a
+ * ten minute run is a few KB.
+ */
+struct FRunReplay
+{
+	/** "SRRP" */
+	static constexpr uint32 FileMagic = 0x50525253;
+	static constexpr uint16 CurrentVersion = 1;
+
+	struct FInputEvent
+	{
+		uint32 Step = 0;
+		ERunReplayInput Input = ERunReplayInput::Jump;
+		bool bPressed = false;
+	};
+
+	struct FTrajectorySample
+	{
+		uint32 Step = 0;
+
+		/** Runner lane offset and height, whole units */
+		int32 Y = 0;
+		int32 Z = 0;
+	};
+
+	int32 Seed = 0;
+
+	/** Simulation rate the steps count at (a replay only plays back at the same rate) */
+	uint16 StepRate = 0;
+
+	/** Steps between trajectory samples when it was recorded */
+	uint16 SampleSteps = 0;
+
+	/** Step the run ended on */
+	uint32 LastStep = 0;
+
+	/** Final score, to check a playback reproduced the run */
+	int32 Score = 0;
+
+	TArray<FInputEvent> Events;
+	TArray<FTrajectorySample> Trajectory;
+
+	void Reset();
+
+	/** Compact binary form (sets an archive error on a bad header) */
+	void Serialize(FArchive& Ar);
+
+	bool SaveToFile(const FString& Path);
+	bool LoadFromFile(const FString& Path);
+
+	/**
+	 * Runner Y/Z at a (fractional) step, interpolated between samples.
+	 *
+	 * @param InOutCursor Sample index to start searching from; advanced as Step grows
+	 * @return False past the end of the trajectory
+	 */
+	bool SampleTrajectory(double Step, int32& InOutCursor, FVector2D& OutYZ) const;
+};
+
+/**
+ * Run Replay Component
+ *
+ * Records every run as a compact replay (FRunReplay) and plays one back through
+ * AStateRunner_ArcadeCharacter's own input handlers.
+ *
+ * Recording: the runner reports each press/release here (ConsumePlayerInput) and a
+ * trajectory sample is taken every TrajectorySampleSteps. Inputs are stamped with the
+ * fixed step they land before, so recording needs fixed-step simulation. At game over the
+ * run is written to Saved/Replays/LastRun.srreplay, and a run that places in the all-time
+ * top LeaderboardReplayCount keeps its replay under Saved/Replays/Leaderboard.
+ *
+ * Playback ("?Replay=" on the level URL or "-Replay=" on the command line; a file path,
+ * "Last" or "TopN" for an all-time rank): the replay's seed is queued before the run seed
+ * is picked, player input is ignored, and each event is fed to the runner at its step
+ * in the Input phase -- ahead of the runner, as live input would be. "-ReplayFixedFrames"
+ * also locks every frame to exactly one step, so the run repeats frame-for-frame (timers,
+ * scoring and all) under a profiler. At game over the final score is checked against the
+ * recorded one.
+ *
+ * Ghost ("?Ghost=TopN", or bShowBestRunGhost): spawns GhostActorClass and moves it along
+ * that leaderboard replay's trajectory, beside the runner.
+ *
+ * Autopilot and versus runs are neither recorded nor replayable. Attached to GameMode.
+ */
+UCLASS(ClassGroup=(StateRunner), meta=(BlueprintSpawnableComponent))
+class STATERUNNER_ARCADE_API URunReplayComponent : public UActorComponent, public IGameplaySimulated
+{
+	GENERATED_BODY()
+
+public:
+
+	URunReplayComponent();
+
+protected:
+
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+public:
+
+	/** Feed due playback events to the runner; take a trajectory sample when recording */
+	virtual void SimulateStep(float StepSeconds) override;
+
+	/** Move the ghost to the interpolated trajectory point */
+	virtual void PostSimulate(float Alpha, int32 StepsThisFrame) override;
+
+	// --- Configuration ---
+
+protected:
+
+	/** Record runs at all (LastRun and leaderboard replays) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Replay")
+	bool bRecordRuns = true;
+
+	/** Steps between trajectory samples (12 = 10 Hz at the default 120 Hz step) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Replay", meta=(ClampMin="1", ClampMax="120"))
+	int32 TrajectorySampleSteps = 12;
+
+	/** All-time ranks that keep their replay */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Replay", meta=(ClampMin="0", ClampMax="100"))
+	int32 LeaderboardReplayCount = 10;
+
+	/** Race the all-time best run's ghost when no ?Ghost= option is given */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Replay|Ghost")
+	bool bShowBestRunGhost = false;
+
+	/** Actor spawned as the ghost runner (e.g. a translucent runner mesh); none = no ghost */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Replay|Ghost")
+	TSubclassOf<AActor> GhostActorClass;
+
+	// --- Runtime State ---
+
+protected:
+
+	/** Run being recorded (or the one being played back) */
+	FRunReplay Replay;
+
+	/** Ghost trajectory source */
+	FRunReplay GhostReplay;
+
+	bool bRecording = false;
+	bool bPlayingBack = false;
+
+	/** Simulation step count when this run started (replay steps are relative to it) */
+	int64 StartStep = 0;
+
+	/** Next playback event */
+	int32 PlaybackCursor = 0;
+
+	/** Trajectory sample the ghost is between */
+	int32 GhostCursor = 0;
+
+	/** Last sample written, to skip samples where the runner didn't move */
+	int32 LastSampleY = MAX_int32;
+	int32 LastSampleZ = MAX_int32;
+
+	/** Where the replay to play back / ghost to race was asked for */
+	FString PlaybackSource;
+	FString GhostSource;
+
+	UPROPERTY()
+	TObjectPtr<AActor> GhostActor;
+
+	UPROPERTY()
+	TObjectPtr<AStateRunner_ArcadeCharacter> CachedRunner;
+
+	// --- Public Functions ---
+
+public:
+
+	/**
+	 * Read ?Replay= / -Replay= / ?Ghost= and queue a replay's seed. Called by the GameMode
+	 * after the autopilot's launch options and before the run seed is picked.
+	 *
+	 * @param Options The GameMode's OptionsString
+	 */
+	void ApplyLaunchOptions(const FString& Options);
+
+	/**
+	 * A real player press/release arrived.
+	 *
+	 * @return True while a replay plays back (the runner should ignore it); otherwise it's recorded
+	 */
+	bool HandlePlayerInput(ERunReplayInput Input, bool bPressed);
+
+	/**
+	 * A run just made the leaderboard: keep its replay if the rank is within
+	 * LeaderboardReplayCount, and drop replays of runs pushed out of that range.
+	 */
+	void StoreLeaderboardReplay(const FLeaderboardEntry& Entry, int32 AllTimeRank, const ULeaderboardSaveGame* Leaderboard);
+
+	UFUNCTION(BlueprintPure, Category="Replay")
+	bool IsPlayingBack() const { return bPlayingBack; }
+
+	UFUNCTION(BlueprintPure, Category="Replay")
+	bool IsRecording() const { return bRecording; }
+
+	/** Replay file for a leaderboard entry (whether or not one was kept) */
+	static FString GetLeaderboardReplayPath(const FLeaderboardEntry& Entry);
+
+	/** Replay of the last finished run */
+	static FString GetLastRunReplayPath();
+
+	// --- Internal Functions ---
+
+protected:
+
+	/** Find the runner. Returns false if it isn't available yet. */
+	bool CacheReferences();
+
+	/** Steps since the run started */
+	uint32 GetRunStep() const;
+
+	/** Resolve "Last", "TopN" or a file path and load it */
+	bool LoadReplaySource(const FString& Source, FRunReplay& OutReplay) const;
+
+	/** Spawn the ghost actor once the runner exists */
+	void SpawnGhost();
+
+	/** Lives system death -- close the recording (or verify the playback) */
+	UFUNCTION()
+	void HandlePlayerDied();
+};
@@ -0,0 +1,148 @@
+#include "RunSeedSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Kismet/GameplayStatics.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/Parse.h"
+#include "StateRunner_Arcade.h"
+
+/**
+ * SplitMix64 finalizer. Neighbouring inputs (run seed N and N + 1, stream 0 and 1) come out
+ * uncorrelated, which a plain HashCombine doesn't guarantee.
+ * Prefixed to avoid Unity build collisions.
+ */
+static int32 RunSeed_Mix(uint64 Value)
+{
+	Value += 0x9E3779B97F4A7C15ull;
+	Value = (Value ^ (Value >> 30)) * 0xBF58476D1CE4E5B9ull;
+	Value = (Value ^ (Value >> 27)) * 0x94D049BB133111EBull;
+	Value ^= Value >> 31;
+	return static_cast<int32>(Value & MAX_int32);
+}
+
+// --- Subsystem Lifecycle ---
+
+void URunSeedSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// Menus shuffle music before any run has started
+	RunSeed = RunSeed_Mix(FPlatformTime::Cycles64());
+	SeedStreams();
+}
+
+URunSeedSubsystem* URunSeedSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<URunSeedSubsystem>() : nullptr;
+}
+
+FRandomStream& URunSeedSubsystem::GetStreamFor(const UObject* WorldContextObject, ERunRandomStream Stream)
+{
+	if (URunSeedSubsystem* RunSeed = Get(WorldContextObject))
+	{
+		return RunSeed->GetStream(Stream);
+	}
+
+	static FRandomStream FallbackStream(0);
+	return FallbackStream;
+}
+
+// --- Run ---
+
+void URunSeedSubsystem::BeginRun(const FString& Options)
+{
+	bDailyRun = false;
+	DailyDate.Reset();
+
+	bool bHasSeed = false;
+	if (PendingSeed.IsSet())
+	{
+		RunSeed = PendingSeed.GetValue();
+		PendingSeed.Reset();
+		bHasSeed = true;
+	}
+
+	if (!bHasSeed)
+	{
+		const FString SeedOption = UGameplayStatics::ParseOption(Options, TEXT("Seed"));
+		if (SeedOption.Equals(TEXT("Daily"), ESearchCase::IgnoreCase))
+		{
+			bDailyRun = true;
+		}
+		else if (SeedOption.IsNumeric())
+		{
+			RunSeed = FCString::Atoi(*SeedOption);
+			bHasSeed = true;
+		}
+	}
+
+	if (!bHasSeed && !bDailyRun)
+	{
+		if (FParse::Value(FCommandLine::Get(), TEXT("RunSeed="), RunSeed))
+		{
+			bHasSeed = true;
+		}
+		else
+		{
+			bDailyRun = bDailySeedByDefault || FParse::Param(FCommandLine::Get(), TEXT("DailySeed"));
+		}
+	}
+
+	if (bDailyRun)
+	{
+		const FDateTime Today = FDateTime::UtcNow().GetDate();
+		RunSeed = GetDailySeed(Today);
+		DailyDate = FString::Printf(TEXT("%04d-%02d-%02d"), Today.GetYear(), Today.GetMonth(), Today.GetDay());
+	}
+	else if (!bHasSeed)
+	{
+		RunSeed = RunSeed_Mix(FPlatformTime::Cycles64() ^ (static_cast<uint64>(RunSeed) << 32));
+	}
+
+	SeedStreams();
+
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("RunSeed: Run seed %d%s"), RunSeed, bDailyRun ? *FString::Printf(TEXT(" (daily %s)"), *DailyDate) : TEXT(""));
+}
+
+void URunSeedSubsystem::SetNextRunSeed(int32 Seed)
+{
+	PendingSeed = Seed;
+}
+
+FString URunSeedSubsystem::GetSeedDisplayString() const
+{
+	if (bDailyRun)
+	{
+		return FString::Printf(TEXT("DAILY %s"), *DailyDate);
+	}
+	return FString::Printf(TEXT("SEED %d"), RunSeed);
+}
+
+FString URunSeedSubsystem::GetRestartOptions() const
+{
+	return bDailyRun ? TEXT("Seed=Daily") : FString();
+}
+
+// --- Internal Functions ---
+
+void URunSeedSubsystem::SeedStreams()
+{
+	for (int32 Index = 0; Index < static_cast<int32>(ERunRandomStream::Count); Index++)
+	{
+		Streams[Index].Initialize(RunSeed_Mix((static_cast<uint64>(static_cast<uint32>(RunSeed)) << 8) | static_cast<uint64>(Index)));
+	}
+}
+
+int32 URunSeedSubsystem::GetDailySeed(const FDateTime& Date)
+{
+	return RunSeed_Mix(static_cast<uint64>(Date.GetYear() * 10000 + Date.GetMonth() * 100 + Date.GetDay()));
+}
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "RunSeedSubsystem.generated.h"
+
+/**
+ * Independent random streams handed out per run. Each one is seeded from the run seed
+ * and its own id, so adding draws to one system never shifts another system's sequence.
+ */
+UENUM(BlueprintType)
+enum class ERunRandomStream : uint8
+{
+	/** Obstacle segment layouts (seeds the spawner's layout generator) */
+	ObstacleLayout		UMETA(DisplayName = "Obstacle Layout"),
+
+	/** Obstacle mesh variant / yaw flip picks */
+	ObstacleVisuals		UMETA(DisplayName = "Obstacle Visuals"),
+
+	/** Pickup placement, patterns and type rolls */
+	PickupLayout		UMETA(DisplayName = "Pickup Layout"),
+
+	/** Pickup mesh variants, spin and bob phase */
+	PickupVisuals		UMETA(DisplayName = "Pickup Visuals"),
+
+	/** Music shuffle */
+	Music				UMETA(DisplayName = "Music"),
+
+	Count				UMETA(Hidden)
+};
+
+/**
+ * Run Seed Subsystem
+ *
+ * Owns the seed of the current run and one FRandomStream per ERunRandomStream. The
+ * GameMode starts a run before its components' BeginPlay, so the spawners pick up the
+ * new streams when they initialize. Replaying a seed regenerates the run's obstacles,
+ * pickups and mesh variants exactly (given the same inputs), which is what profiling a
+ * specific layout needs.
+ *
+ * The seed of a run comes from, in order:
+ * - SetNextRunSeed (the autopilot benchmark's -AutopilotSeed)
+ * - ?Seed=N or ?Seed=Daily on the level URL
+ * - -RunSeed=N or -DailySeed on the command line
+ * - bDailySeedByDefault in config (operator "daily seed" cabinet)
+ * - otherwise a fresh random seed
+ *
+ * The daily seed is derived from the UTC date, so every cabinet plays the same track on
+ * the same day. The game over screen shows the seed (GetSeedDisplayString).
+ *
+ * [/Script/StateRunner_Arcade.RunSeedSubsystem]
+ * bDailySeedByDefault=True
+ */
+UCLASS(Config=Game)
+class STATERUNNER_ARCADE_API URunSeedSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	// --- Subsystem Lifecycle ---
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	/** Get the subsystem from a world context */
+	static URunSeedSubsystem* Get(const UObject* WorldContextObject);
+
+	/**
+	 * Stream for a world context's game instance. Falls back to an unseeded shared stream
+	 * where there is no game instance (editor previews), so callers never need a null check.
+	 */
+	static FRandomStream& GetStreamFor(const UObject* WorldContextObject, ERunRandomStream Stream);
+
+	// --- Run ---
+
+	/**
+	 * Pick this run's seed and reseed every stream. Called by the GameMode before its
+	 * components' BeginPlay.
+	 *
+	 * @param Options The GameMode's OptionsString
+	 */
+	void BeginRun(const FString& Options);
+
+	/** Force the seed of the next BeginRun (consumed by it) */
+	void SetNextRunSeed(int32 Seed);
+
+	UFUNCTION(BlueprintPure, Category="Run Seed")
+	int32 GetRunSeed() const { return RunSeed; }
+
+	/** True if this run plays today's daily seed */
+	UFUNCTION(BlueprintPure, Category="Run Seed")
+	bool IsDailyRun() const { return bDailyRun; }
+
+	/** "SEED 123456789" or "DAILY 2026-10-14" for the game over screen */
+	UFUNCTION(BlueprintPure, Category="Run Seed")
+	FString GetSeedDisplayString() const;
+
+	/** Level URL options that replay the same kind of run ("Seed=Daily" for a daily run, else empty) */
+	FString GetRestartOptions() const;
+
+	// --- Streams ---
+
+	FRandomStream& GetStream(ERunRandomStream Stream) { return Streams[static_cast<int32>(Stream)]; }
+
+	/** Initial seed of a stream this run (for copies that live off the game thread) */
+	int32 GetStreamSeed(ERunRandomStream Stream) const { return Streams[static_cast<int32>(Stream)].GetInitialSeed(); }
+
+	// --- Configuration ---
+
+protected:
+
+	/** Every run without an explicit seed plays the daily seed */
+	UPROPERTY(Config)
+	bool bDailySeedByDefault = false;
+
+	// --- Internal State ---
+
+	int32 RunSeed = 0;
+	bool bDailyRun = false;
+
+	/** UTC date the daily seed was taken from ("2026-10-14") */
+	FString DailyDate;
+
+	/** Seed queued by SetNextRunSeed */
+	TOptional<int32> PendingSeed;
+
+	FRandomStream Streams[static_cast<int32>(ERunRandomStream::Count)];
+
+	// --- Internal Functions ---
+
+	/** Reseed every stream from RunSeed */
+	void SeedStreams();
+
+	/** Seed for a UTC date */
+	static int32 GetDailySeed(const FDateTime& Date);
+};
@@ -0,0 +1,280 @@
+#include "SFXSubsystem.h"
+#include "Components/AudioComponent.h"
+#include "Kismet/GameplayStatics.h"
+#include "Sound/SoundBase.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "StateRunner_Arcade.h"
+
+// --- Category Limits ---
+// Prefixed to avoid Unity build collisions
+
+struct FSFXCategoryConfig
+{
+	/** Voices preallocated for the category (its concurrency limit) */
+	int32 MaxVoices;
+
+	/** Full category: restart the oldest one-shot (true) or drop the new sound (false) */
+	bool bStealOldest;
+};
+
+/** Indexed by ESFXCategory */
+static const FSFXCategoryConfig SFX_CategoryConfig[] = {
+	{ 6, true },   // Pickup -- the newest collection is the one that matters
+	{ 4, true },   // Player
+	{ 3, false },  // Overclock -- loop + activation/deactivation; never cut a transition short
+	{ 2, false },  // Lives
+};
+static_assert(UE_ARRAY_COUNT(SFX_CategoryConfig) == static_cast<int32>(ESFXCategory::Count), "SFX_CategoryConfig must have one entry per ESFXCategory");
+
+// --- Subsystem Lifecycle ---
+
+bool USFXSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Game worlds only -- editor preview worlds play their sounds directly
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void USFXSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	CreateVoices();
+}
+
+void USFXSubsystem::Deinitialize()
+{
+	for (FSFXVoice& Voice : Voices)
+	{
+		if (Voice.Component)
+		{
+			Voice.Component->Stop();
+			Voice.Component->DestroyComponent();
+		}
+	}
+	Voices.Empty();
+
+	Super::Deinitialize();
+}
+
+USFXSubsystem* USFXSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	return World->GetSubsystem<USFXSubsystem>();
+}
+
+// --- Playback ---
+
+UAudioComponent* USFXSubsystem::PlaySFX(ESFXCategory Category, USoundBase* Sound, const FVector& Location, float VolumeMultiplier, float PitchMultiplier)
+{
+	if (!Sound)
+	{
+		return nullptr;
+	}
+
+	const int32 VoiceIndex = AcquireVoice(Category);
+	if (VoiceIndex == INDEX_NONE)
+	{
+		return nullptr;
+	}
+
+	UAudioComponent* Component = Voices[VoiceIndex].Component;
+	Component->SetWorldLocation(Location);
+	StartVoice(VoiceIndex, Sound, VolumeMultiplier, PitchMultiplier, 0.0f);
+	return Component;
+}
+
+UAudioComponent* USFXSubsystem::PlaySFXAttached(ESFXCategory Category, USoundBase* Sound, USceneComponent* AttachTo, float VolumeMultiplier, float FadeInDuration)
+{
+	if (!Sound || !AttachTo)
+	{
+		return nullptr;
+	}
+
+	const int32 VoiceIndex = AcquireVoice(Category);
+	if (VoiceIndex == INDEX_NONE)
+	{
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("SFXSubsystem: No free voice for looping sound %s"), *Sound->GetName());
+		return nullptr;
+	}
+
+	FSFXVoice& Voice = Voices[VoiceIndex];
+	Voice.bReserved = true;
+	Voice.Component->AttachToComponent(AttachTo, FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+	StartVoice(VoiceIndex, Sound, VolumeMultiplier, 1.0f, FadeInDuration);
+	return Voice.Component;
+}
+
+void USFXSubsystem::ReleaseVoice(UAudioComponent* Voice, float FadeOutDuration)
+{
+	if (!Voice)
+	{
+		return;
+	}
+
+	FSFXVoice* Pooled = Voices.FindByPredicate([Voice](const FSFXVoice& Candidate) { return Candidate.Component == Voice; });
+	if (!Pooled)
+	{
+		// Not ours (played through the fallback) -- just stop it
+		Voice->FadeOut(FadeOutDuration, 0.0f);
+		return;
+	}
+
+	// Keeps its last world position while it fades; the next PlaySFX moves it anyway
+	Voice->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+	if (FadeOutDuration > 0.0f)
+	{
+		Voice->FadeOut(FadeOutDuration, 0.0f);
+	}
+	else
+	{
+		Voice->Stop();
+	}
+	Pooled->bReserved = false;
+}
+
+void USFXSubsystem::PlaySFXAtLocation(const UObject* WorldContextObject, ESFXCategory Category, USoundBase* Sound, const FVector& Location, float VolumeMultiplier, float PitchMultiplier)
+{
+	if (!Sound)
+	{
+		return;
+	}
+
+	if (USFXSubsystem* SFX = Get(WorldContextObject))
+	{
+		SFX->PlaySFX(Category, Sound, Location, VolumeMultiplier, PitchMultiplier);
+		return;
+	}
+
+	UGameplayStatics::PlaySoundAtLocation(WorldContextObject, Sound, Location, VolumeMultiplier, PitchMultiplier);
+}
+
+// --- Stats ---
+
+int32 USFXSubsystem::GetActiveVoiceCount(ESFXCategory Category) const
+{
+	const int32 CategoryIndex = static_cast<int32>(Category);
+	int32 Count = 0;
+	for (int32 i = CategoryStart[CategoryIndex]; i < CategoryStart[CategoryIndex + 1]; i++)
+	{
+		if (Voices[i].Component && Voices[i].Component->IsPlaying())
+		{
+			Count++;
+		}
+	}
+	return Count;
+}
+
+// --- Internal Functions ---
+
+void USFXSubsystem::CreateVoices()
+{
+	STATERUNNER_LLM_SCOPE(SFX);
+
+	UWorld* World = GetWorld();
+	if (!World || Voices.Num() > 0)
+	{
+		return;
+	}
+
+	for (int32 CategoryIndex = 0; CategoryIndex < static_cast<int32>(ESFXCategory::Count); CategoryIndex++)
+	{
+		CategoryStart[CategoryIndex] = Voices.Num();
+
+		for (int32 i = 0; i < SFX_CategoryConfig[CategoryIndex].MaxVoices; i++)
+		{
+			UAudioComponent* Component = NewObject<UAudioComponent>(World);
+			Component->bAutoActivate = false;
+			Component->bAutoDestroy = false;
+			Component->RegisterComponentWithWorld(World);
+
+			FSFXVoice& Voice = Voices.AddDefaulted_GetRef();
+			Voice.Component = Component;
+		}
+	}
+	CategoryStart[static_cast<int32>(ESFXCategory::Count)] = Voices.Num();
+
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("SFXSubsystem: %d voices preallocated"), Voices.Num());
+}
+
+int32 USFXSubsystem::AcquireVoice(ESFXCategory Category)
+{
+	// A sound before world BeginPlay -- build the pool now
+	if (Voices.Num() == 0)
+	{
+		CreateVoices();
+	}
+
+	const int32 CategoryIndex = static_cast<int32>(Category);
+	if (CategoryIndex >= static_cast<int32>(ESFXCategory::Count))
+	{
+		return INDEX_NONE;
+	}
+
+	int32 OldestIndex = INDEX_NONE;
+	for (int32 i = CategoryStart[CategoryIndex]; i < CategoryStart[CategoryIndex + 1]; i++)
+	{
+		const FSFXVoice& Voice = Voices[i];
+		if (!Voice.Component || Voice.bReserved)
+		{
+			continue;
+		}
+		if (!Voice.Component->IsPlaying())
+		{
+			return i;
+		}
+		if (OldestIndex == INDEX_NONE || Voice.StartTime < Voices[OldestIndex].StartTime)
+		{
+			OldestIndex = i;
+		}
+	}
+
+	if (OldestIndex != INDEX_NONE && SFX_CategoryConfig[CategoryIndex].bStealOldest)
+	{
+		StealCount++;
+		return OldestIndex;
+	}
+
+	RejectCount++;
+	return INDEX_NONE;
+}
+
+void USFXSubsystem::StartVoice(int32 VoiceIndex, USoundBase* Sound, float VolumeMultiplier, float PitchMultiplier, float FadeInDuration)
+{
+	FSFXVoice& Voice = Voices[VoiceIndex];
+	UAudioComponent* Component = Voice.Component;
+
+	// Same sound on the same voice is the common case (collection streaks); skip the re-point
+	if (Component->Sound != Sound)
+	{
+		// SetSound restarts a playing voice itself; stop first so Play below is the only start
+		Component->Stop();
+		Component->SetSound(Sound);
+	}
+	Component->SetVolumeMultiplier(VolumeMultiplier);
+	Component->SetPitchMultiplier(PitchMultiplier);
+
+	// Play restarts a voice that is still sounding (the stolen case)
+	if (FadeInDuration > 0.0f)
+	{
+		Component->FadeIn(FadeInDuration);
+	}
+	else
+	{
+		Component->Play();
+	}
+
+	const UWorld* World = GetWorld();
+	Voice.StartTime = World ? World->GetRealTimeSeconds() : 0.0;
+}
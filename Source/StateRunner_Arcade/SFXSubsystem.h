@@ -0,0 +1,137 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SFXSubsystem.generated.h"
+
+class UAudioComponent;
+class USceneComponent;
+class USoundBase;
+
+/**
+ * Voice categories. Each has its own preallocated voices and stealing rule.
+ * Limits live in one table in SFXSubsystem.cpp -- add an entry there with each value here.
+ */
+enum class ESFXCategory : uint8
+{
+	/** Collection sounds (a magnet sweep can collect a whole pattern in a few frames) */
+	Pickup,
+
+	/** Lane change, jump, slide, landing */
+	Player,
+
+	/** Activation / deactivation one-shots and the active loop */
+	Overclock,
+
+	/** Life gained / lost */
+	Lives,
+
+	Count
+};
+
+/**
+ * One pooled voice.
+ */
+USTRUCT()
+struct FSFXVoice
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<UAudioComponent> Component = nullptr;
+
+	/** World real time the voice last started (oldest is stolen first) */
+	double StartTime = 0.0;
+
+	/** Held by a looping caller until ReleaseVoice -- never stolen */
+	bool bReserved = false;
+};
+
+/**
+ * SFX Subsystem
+ *
+ * Plays gameplay one-shots through a fixed set of audio components created at world
+ * BeginPlay, instead of spawning a new component per sound. Each category has a voice
+ * limit: when every voice is busy the category either steals its oldest one-shot or drops
+ * the new sound. A magnet vacuuming a 20-pickup pattern then costs the Pickup voices'
+ * worth of audio rather than 20 spawns, and the streak pitch is simply set on whichever
+ * voice is reused.
+ *
+ * Looping sounds (the Overclock loop) reserve a voice with PlaySFXAttached and hand it back
+ * with ReleaseVoice; reserved voices are never stolen.
+ *
+ * Callers go through the static PlaySFXAtLocation so they still get a sound (through
+ * UGameplayStatics) in worlds without the subsystem.
+ */
+UCLASS()
+class STATERUNNER_ARCADE_API USFXSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	// --- Subsystem Lifecycle ---
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	/** Get the subsystem from a world context (null outside game worlds) */
+	static USFXSubsystem* Get(const UObject* WorldContextObject);
+
+	// --- Playback ---
+
+	/**
+	 * Play a one-shot on a pooled voice of Category.
+	 * @return The voice used, or null if the category rejected it
+	 */
+	UAudioComponent* PlaySFX(ESFXCategory Category, USoundBase* Sound, const FVector& Location, float VolumeMultiplier = 1.0f, float PitchMultiplier = 1.0f);
+
+	/**
+	 * Reserve a voice of Category, attach it to AttachTo and start Sound (for loops).
+	 * The voice stays reserved until ReleaseVoice.
+	 */
+	UAudioComponent* PlaySFXAttached(ESFXCategory Category, USoundBase* Sound, USceneComponent* AttachTo, float VolumeMultiplier = 1.0f, float FadeInDuration = 0.0f);
+
+	/** Fade out a voice from PlaySFXAttached and return it to its pool */
+	void ReleaseVoice(UAudioComponent* Voice, float FadeOutDuration = 0.0f);
+
+	/** PlaySFX through the world's subsystem, or UGameplayStatics if there isn't one */
+	static void PlaySFXAtLocation(const UObject* WorldContextObject, ESFXCategory Category, USoundBase* Sound, const FVector& Location, float VolumeMultiplier = 1.0f, float PitchMultiplier = 1.0f);
+
+	// --- Stats ---
+
+	/** Voices of Category currently playing */
+	int32 GetActiveVoiceCount(ESFXCategory Category) const;
+
+	/** Voices stolen since BeginPlay */
+	int32 GetStealCount() const { return StealCount; }
+
+	/** Sounds dropped by a full category since BeginPlay */
+	int32 GetRejectCount() const { return RejectCount; }
+
+protected:
+
+	// --- Internal State ---
+
+	/** Every voice, grouped by category (see CategoryStart) */
+	UPROPERTY()
+	TArray<FSFXVoice> Voices;
+
+	/** Index of each category's first voice in Voices; CategoryStart[Count] = Voices.Num() */
+	int32 CategoryStart[static_cast<int32>(ESFXCategory::Count) + 1] = {};
+
+	int32 StealCount = 0;
+	int32 RejectCount = 0;
+
+	// --- Internal Functions ---
+
+	/** Create every category's voices */
+	void CreateVoices();
+
+	/** Free voice of Category, else the one its stealing rule gives up (INDEX_NONE = reject) */
+	int32 AcquireVoice(ESFXCategory Category);
+
+	/** Point a voice at Sound and start it */
+	void StartVoice(int32 VoiceIndex, USoundBase* Sound, float VolumeMultiplier, float PitchMultiplier, float FadeInDuration);
+};
@@ -1,9 +1,17 @@
 #include "ScoreSystemComponent.h"
 #include "GameDebugSubsystem.h"
+#include "ArcadeSaveSubsystem.h"
+#include "AutopilotComponent.h"
+#include "RunReplayComponent.h"
+#include "VersusModeComponent.h"
+#include "StateRunner_ArcadeGameMode.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/Engine.h"
 #include "StateRunner_Arcade.h"
 
+/** Rate steps GetSecondsUntilTimeScore walks before settling for a lower bound (~65k covers any int32 score) */
+static constexpr int32 ScoreSystem_MaxRateStepsWalked = 100000;
+
 UScoreSystemComponent::UScoreSystemComponent()
 {
 	PrimaryComponentTick.bCanEverTick = false;
@@ -13,14 +21,21 @@ void UScoreSystemComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// Initialize score rate
-	CurrentScoreRate = BaseScoreRate;
-
 	// Load high score and leaderboard
 	LoadHighScore();
 	LoadLeaderboard();
 }
 
+void UScoreSystemComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UGameplaySimulationSubsystem* Timeline = UGameplaySimulationSubsystem::Get(this))
+	{
+		Timeline->ClearAllTimers(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 // --- Public Functions ---
 
 void UScoreSystemComponent::StartScoring()
@@ -30,47 +45,49 @@ void UScoreSystemComponent::StartScoring()
 		return;
 	}
 
+	UGameplaySimulationSubsystem* Timeline = UGameplaySimulationSubsystem::Get(this);
+
+	// Carry over anything from an earlier scoring interval (0 after ResetScore)
+	BonusScore = GetCurrentScore();
+
 	bIsScoringActive = true;
-	TimeElapsed = 0.0f;
-	FractionalScore = 0.0f;
-	CurrentScoreRate = BaseScoreRate;
+	ScoringStartElapsed = FMath::Max(DebugInitialTimeElapsed, 0.0f);
+	TimeElapsed = ScoringStartElapsed;
+	ScoringClockStart = Timeline ? Timeline->GetGameplayTime() : 0.0;
+	OverclockSeconds = 0.0;
+	OverclockStartElapsed = ScoringStartElapsed;
 
 	// DEBUG: Apply initial score/time overrides if set
 	if (DebugInitialScore > 0)
 	{
-		CurrentScore = DebugInitialScore;
-		OnScoreChanged.Broadcast(CurrentScore);
+		BonusScore = DebugInitialScore;
+		OnScoreChanged.Broadcast(GetCurrentScore());
 		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("Score initialized to %d"), DebugInitialScore);
 	}
 	if (DebugInitialTimeElapsed > 0.0f)
 	{
-		TimeElapsed = DebugInitialTimeElapsed;
-		CurrentScoreRate = CalculateScoreRate();
-		OnScoreRateChanged.Broadcast(CurrentScoreRate);
-		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("Time set to %.1fs, Score rate: %d pts/s"), DebugInitialTimeElapsed, CurrentScoreRate);
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("Time set to %.1fs, Score rate: %d pts/s"), DebugInitialTimeElapsed, GetCurrentScoreRate());
 	}
+	OnScoreRateChanged.Broadcast(GetCurrentScoreRate());
 
-	// Start score accumulation timer
-	if (UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().SetTimer(
-			ScoreAccumulationTimer,
-			this,
-			&UScoreSystemComponent::AccumulateScore,
-			ScoreAccumulationInterval,
-			true
-		);
+	CheckHighScoreBeaten();
 
-		// Start score rate update timer
-		World->GetTimerManager().SetTimer(
-			ScoreRateUpdateTimer,
-			this,
-			&UScoreSystemComponent::UpdateScoreRate,
-			ScoreRateStepInterval,
-			true
-		);
+	// Debug overlay refresh (score is computed on demand, so nothing else needs a timer)
+	if (Timeline)
+	{
+		const UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this);
+		if (Debug && Debug->bDebugEnabled)
+		{
+			Timeline->SetTimer(DebugDisplayTimer, this, [this]() { RefreshDebugStats(); },
+				ScoreAccumulationInterval, true);
+		}
 	}
 
+	// Versus: the game flow starts Player 1's scoring, the rivals start with it
+	if (UVersusModeComponent* Versus = UVersusModeComponent::Get(this))
+	{
+		Versus->HandleScoringStarted(this);
+	}
 }
 
 void UScoreSystemComponent::StopScoring()
@@ -80,14 +97,23 @@ void UScoreSystemComponent::StopScoring()
 		return;
 	}
 
+	// Freeze the scoring clock (and any running OVERCLOCK interval) at this instant
+	TimeElapsed = GetTimeElapsed();
+	if (bIsOverclockActive)
+	{
+		OverclockSeconds += TimeElapsed - OverclockStartElapsed;
+		OverclockStartElapsed = TimeElapsed;
+	}
 	bIsScoringActive = false;
 
 	// Stop timers
-	if (UWorld* World = GetWorld())
+	if (UGameplaySimulationSubsystem* Timeline = UGameplaySimulationSubsystem::Get(this))
 	{
-		World->GetTimerManager().ClearTimer(ScoreAccumulationTimer);
-		World->GetTimerManager().ClearTimer(ScoreRateUpdateTimer);
+		Timeline->ClearTimer(HighScoreCrossingTimer);
+		Timeline->ClearTimer(DebugDisplayTimer);
 	}
+
+	RefreshDebugStats();
 }
 
 void UScoreSystemComponent::AddScore(int32 Points)
@@ -97,36 +123,44 @@ void UScoreSystemComponent::AddScore(int32 Points)
 		return;
 	}
 
-	int32 OldScore = CurrentScore;
-	CurrentScore += Points;
+	BonusScore += Points;
 
-	OnScoreChanged.Broadcast(CurrentScore);
+	const int32 Score = GetCurrentScore();
+	OnScoreChanged.Broadcast(Score);
 
-	// Check for high score
-	if (!bHasBeatenHighScoreThisSession && CurrentScore > SessionStartHighScore && SessionStartHighScore > 0)
-	{
-		bHasBeatenHighScoreThisSession = true;
-		OnHighScoreBeaten.Broadcast(CurrentScore, SessionStartHighScore);
-		
-		if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
-		{
-			Debug->LogEvent(EDebugCategory::Score, TEXT("NEW HIGH SCORE!"));
-		}
-	}
+	// Check for high score (a bonus moves the time-based crossing earlier too)
+	CheckHighScoreBeaten();
 
 	// Update in-memory high score
-	if (CurrentScore > HighScore)
+	if (Score > HighScore)
 	{
-		HighScore = CurrentScore;
+		HighScore = Score;
 	}
 
 	// Update debug subsystem stats
 	if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
 	{
-		Debug->Stat_Score = CurrentScore;
+		Debug->Stat_Score = Score;
 	}
 }
 
+int32 UScoreSystemComponent::GetCurrentScore() const
+{
+	return BonusScore + FMath::Max(FMath::FloorToInt(GetTimeScore()), 0);
+}
+
+float UScoreSystemComponent::GetTimeElapsed() const
+{
+	if (!bIsScoringActive)
+	{
+		return TimeElapsed;
+	}
+
+	const UGameplaySimulationSubsystem* Timeline = UGameplaySimulationSubsystem::Get(this);
+	const double Now = Timeline ? Timeline->GetGameplayTime() : ScoringClockStart;
+	return ScoringStartElapsed + static_cast<float>(Now - ScoringClockStart);
+}
+
 void UScoreSystemComponent::AddPickupBonus()
 {
 	AddScore(PickupScoreValue);
@@ -134,7 +168,8 @@ void UScoreSystemComponent::AddPickupBonus()
 	
 	// Combo Tracking: Record timestamp and check for combos
 	// NICE (6x) and INSANE (10x) now have SEPARATE time windows
-	float CurrentTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
+	const UGameplaySimulationSubsystem* GameplayClock = UGameplaySimulationSubsystem::Get(this);
+	float CurrentTime = GameplayClock ? static_cast<float>(GameplayClock->GetGameplayTime()) : 0.0f;
 	
 	// Add this pickup's timestamp
 	RecentDataPacketTimestamps.Add(CurrentTime);
@@ -173,9 +208,9 @@ void UScoreSystemComponent::AddPickupBonus()
 		// Cancel any pending NICE combo popup - INSANE takes priority
 		if (bNiceComboDelayPending)
 		{
-			if (UWorld* World = GetWorld())
+			if (UGameplaySimulationSubsystem* Timeline = UGameplaySimulationSubsystem::Get(this))
 			{
-				World->GetTimerManager().ClearTimer(NiceComboDelayTimer);
+				Timeline->ClearTimer(NiceComboDelayTimer);
 			}
 			bNiceComboDelayPending = false;
 			PendingNiceComboBonusValue = 0;
@@ -190,7 +225,7 @@ void UScoreSystemComponent::AddPickupBonus()
 		
 		if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
 		{
-			Debug->LogEvent(EDebugCategory::Score, FString::Printf(TEXT("INSANE 10x COMBO! +%d"), InsaneComboBonusValue));
+			Debug->RecordEvent(EDebugCategory::Score, EDebugEventId::InsaneCombo, InsaneComboBonusValue);
 		}
 	}
 	// Check for NICE! combo (6x) - uses shorter window, only if not already awarded this streak
@@ -208,20 +243,15 @@ void UScoreSystemComponent::AddPickupBonus()
 			PendingNiceComboBonusValue = NiceComboBonusValue;
 			
 			// Start delay timer - if INSANE isn't achieved within this time, show NICE popup
-			if (UWorld* World = GetWorld())
+			if (UGameplaySimulationSubsystem* Timeline = UGameplaySimulationSubsystem::Get(this))
 			{
-				World->GetTimerManager().SetTimer(
-					NiceComboDelayTimer,
-					this,
-					&UScoreSystemComponent::OnNiceComboDelayExpired,
-					ComboPopupDelaySeconds,
-					false
-				);
+				Timeline->SetTimer(NiceComboDelayTimer, this, [this]() { OnNiceComboDelayExpired(); },
+					ComboPopupDelaySeconds);
 			}
 			
 			if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
 			{
-				Debug->LogEvent(EDebugCategory::Score, FString::Printf(TEXT("NICE 6x COMBO! +%d (popup delayed %.1fs)"), NiceComboBonusValue, ComboPopupDelaySeconds));
+				Debug->RecordEvent(EDebugCategory::Score, EDebugEventId::NiceCombo, NiceComboBonusValue, ComboPopupDelaySeconds);
 			}
 		}
 	}
@@ -236,7 +266,7 @@ void UScoreSystemComponent::OnNiceComboDelayExpired()
 		
 		if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
 		{
-			Debug->LogEvent(EDebugCategory::Score, FString::Printf(TEXT("NICE 6x COMBO popup shown (delay expired)")));
+			Debug->RecordEvent(EDebugCategory::Score, EDebugEventId::NiceComboPopupShown);
 		}
 		
 		bNiceComboDelayPending = false;
@@ -253,7 +283,7 @@ void UScoreSystemComponent::Add1UpBonus(bool bWasAtMaxLives)
 		
 		if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
 		{
-			Debug->LogEvent(EDebugCategory::Score, FString::Printf(TEXT("+%d 1-UP Bonus!"), OneUpBonusValue));
+			Debug->RecordEvent(EDebugCategory::Score, EDebugEventId::OneUpScoreBonus, OneUpBonusValue);
 		}
 	}
 	
@@ -279,11 +309,11 @@ void UScoreSystemComponent::AddEMPBonus(int32 ObstaclesDestroyed)
 	{
 		if (ObstaclesDestroyed > 0)
 		{
-			Debug->LogEvent(EDebugCategory::Score, FString::Printf(TEXT("EMP! %d obstacles +%d"), ObstaclesDestroyed, TotalBonus));
+			Debug->RecordEvent(EDebugCategory::Score, EDebugEventId::EMPBonus, ObstaclesDestroyed, TotalBonus);
 		}
 		else
 		{
-			Debug->LogEvent(EDebugCategory::Score, TEXT("EMP! +OVERCLOCK Boost"));
+			Debug->RecordEvent(EDebugCategory::Score, EDebugEventId::EMPOverclockBoost);
 		}
 	}
 }
@@ -296,7 +326,7 @@ void UScoreSystemComponent::NotifyMagnetCollected()
 	
 	if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
 	{
-		Debug->LogEvent(EDebugCategory::Score, TEXT("MAGNET collected!"));
+		Debug->RecordEvent(EDebugCategory::Score, EDebugEventId::MagnetCollected);
 	}
 }
 
@@ -304,10 +334,11 @@ void UScoreSystemComponent::ResetScore()
 {
 	StopScoring();
 	
-	CurrentScore = 0;
-	CurrentScoreRate = BaseScoreRate;
+	BonusScore = 0;
 	TimeElapsed = 0.0f;
-	FractionalScore = 0.0f;
+	ScoringStartElapsed = 0.0f;
+	OverclockSeconds = 0.0;
+	OverclockStartElapsed = 0.0;
 	bIsOverclockActive = false;
 	bHasBeatenHighScoreThisSession = false;
 	bWasNewHighScoreThisSession = false;
@@ -317,15 +348,21 @@ void UScoreSystemComponent::ResetScore()
 	bNiceComboAwarded = false;  // Reset NICE combo flag
 	LeaderboardRankThisRun = 0;  // Clear leaderboard rank
 
-	OnScoreChanged.Broadcast(CurrentScore);
-	OnScoreRateChanged.Broadcast(CurrentScoreRate);
+	OnScoreChanged.Broadcast(GetCurrentScore());
+	OnScoreRateChanged.Broadcast(GetCurrentScoreRate());
 }
 
 bool UScoreSystemComponent::CheckAndSaveHighScore()
 {
-	if (CurrentScore > SessionStartHighScore)
+	if (IsAutopilotRun())
+	{
+		return false;
+	}
+
+	const int32 Score = GetCurrentScore();
+	if (Score > SessionStartHighScore)
 	{
-		HighScore = CurrentScore;
+		HighScore = Score;
 		bWasNewHighScoreThisSession = true;
 		SaveHighScore();
 		return true;
@@ -342,14 +379,27 @@ void UScoreSystemComponent::SetOverclockActive(bool bActive)
 {
 	if (bIsOverclockActive != bActive)
 	{
+		// Open or close an OVERCLOCK interval for the closed-form bonus
+		const float Elapsed = GetTimeElapsed();
+		if (bActive)
+		{
+			OverclockStartElapsed = Elapsed;
+		}
+		else
+		{
+			OverclockSeconds += Elapsed - OverclockStartElapsed;
+		}
 		bIsOverclockActive = bActive;
+
+		// Slope changed -- move the high score crossing
+		CheckHighScoreBeaten();
 		
 		if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
 		{
 			Debug->Stat_OverclockActive = bActive;
 			if (bActive)
 			{
-				Debug->LogEvent(EDebugCategory::Overclock, TEXT("OVERCLOCK Bonus Active!"));
+				Debug->RecordEvent(EDebugCategory::Overclock, EDebugEventId::OverclockBonusActive);
 			}
 		}
 	}
@@ -363,7 +413,8 @@ float UScoreSystemComponent::GetCurrentPickupPitchMultiplier() const
 	// Uses RecentDataPacketTimestamps from AddPickupBonus().
 	// Must be called AFTER AddPickupBonus() so the current pickup is counted.
 	
-	float CurrentTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
+	const UGameplaySimulationSubsystem* GameplayClock = UGameplaySimulationSubsystem::Get(this);
+	float CurrentTime = GameplayClock ? static_cast<float>(GameplayClock->GetGameplayTime()) : 0.0f;
 	float WindowStart = CurrentTime - NiceComboTimeWindow;
 	
 	int32 StreakCount = 0;
@@ -390,106 +441,165 @@ float UScoreSystemComponent::GetCurrentPickupPitchMultiplier() const
 
 // --- Protected Functions ---
 
-void UScoreSystemComponent::AccumulateScore()
+void UScoreSystemComponent::CheckHighScoreBeaten()
 {
-	if (!bIsScoringActive)
+	UGameplaySimulationSubsystem* Timeline = UGameplaySimulationSubsystem::Get(this);
+	if (Timeline)
 	{
-		return;
+		Timeline->ClearTimer(HighScoreCrossingTimer);
 	}
 
-	// Track previous time for periodic display check
-	float PreviousTime = TimeElapsed;
-	
-	// Update time elapsed
-	TimeElapsed += ScoreAccumulationInterval;
-
-	// Calculate score to add this tick
-	float ScoreToAdd = CurrentScoreRate * ScoreAccumulationInterval;
-
-	// Add OVERCLOCK bonus if active
-	if (bIsOverclockActive)
+	if (bHasBeatenHighScoreThisSession || SessionStartHighScore <= 0)
 	{
-		ScoreToAdd += OverclockBonusRate * ScoreAccumulationInterval;
+		return;
 	}
 
-	// Accumulate fractional score
-	FractionalScore += ScoreToAdd;
-
-	// Add whole points
-	int32 WholePoints = FMath::FloorToInt(FractionalScore);
-	if (WholePoints > 0)
-	{
-		FractionalScore -= WholePoints;
-		AddScore(WholePoints);
-	}
-	
-	// Update debug subsystem with current stats (for the compact display)
-	if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
+	const int32 Score = GetCurrentScore();
+	if (Score > SessionStartHighScore)
 	{
-		Debug->Stat_Score = CurrentScore;
-		Debug->UpdateDisplay();
+		bHasBeatenHighScoreThisSession = true;
+		OnHighScoreBeaten.Broadcast(Score, SessionStartHighScore);
+
+		if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
+		{
+			Debug->RecordEvent(EDebugCategory::Score, EDebugEventId::NewHighScore);
+		}
+		return;
 	}
-}
 
-void UScoreSystemComponent::UpdateScoreRate()
-{
-	if (!bIsScoringActive)
+	if (!bIsScoringActive || !Timeline)
 	{
 		return;
 	}
 
-	int32 NewRate = CalculateScoreRate();
-	
-	if (NewRate != CurrentScoreRate)
+	// Time score needed for BonusScore + floor(TimeScore) > SessionStartHighScore
+	const double TargetTimeScore = static_cast<double>(SessionStartHighScore + 1 - BonusScore);
+	const double Seconds = GetSecondsUntilTimeScore(TargetTimeScore);
+
+	// Small pad so float rounding lands past the crossing; a miss just reschedules
+	Timeline->SetTimer(HighScoreCrossingTimer, this, [this]() { CheckHighScoreBeaten(); },
+		static_cast<float>(FMath::Max(Seconds, 0.0) + 0.001));
+}
+
+void UScoreSystemComponent::RefreshDebugStats()
+{
+	if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
 	{
-		CurrentScoreRate = NewRate;
-		OnScoreRateChanged.Broadcast(CurrentScoreRate);
+		Debug->Stat_Score = GetCurrentScore();
+		Debug->UpdateDisplay();
 	}
 }
 
 void UScoreSystemComponent::LoadHighScore()
 {
-	if (UHighScoreSaveGame* SaveGame = Cast<UHighScoreSaveGame>(
-		UGameplayStatics::LoadGameFromSlot(TEXT("HighScore"), 0)))
-	{
-		HighScore = SaveGame->HighScore;
-		SessionStartHighScore = HighScore;
-	}
-	else
-	{
-		HighScore = 0;
-		SessionStartHighScore = 0;
-	}
-	
+	// Held in memory by the save subsystem -- no disk access here
+	UArcadeSaveSubsystem* Saves = UArcadeSaveSubsystem::Get(this);
+	HighScore = Saves ? Saves->GetHighScore() : 0;
+	SessionStartHighScore = HighScore;
 	bHasBeatenHighScoreThisSession = false;
 }
 
 void UScoreSystemComponent::SaveHighScore()
 {
-	UHighScoreSaveGame* SaveGame = Cast<UHighScoreSaveGame>(
-		UGameplayStatics::CreateSaveGameObject(UHighScoreSaveGame::StaticClass()));
-	
-	if (SaveGame)
+	if (UArcadeSaveSubsystem* Saves = UArcadeSaveSubsystem::Get(this))
 	{
-		SaveGame->HighScore = HighScore;
-		UGameplayStatics::SaveGameToSlot(SaveGame, TEXT("HighScore"), 0);
+		Saves->SetHighScore(HighScore);
 	}
 }
 
-int32 UScoreSystemComponent::CalculateScoreRate() const
+int32 UScoreSystemComponent::CalculateScoreRate(float Elapsed) const
 {
 	// Stepped increase: +5 every 5 seconds
-	// Formula: BaseRate + (floor(TimeElapsed / StepInterval) * Increase)
-	int32 Steps = FMath::FloorToInt(TimeElapsed / ScoreRateStepInterval);
+	// Formula: BaseRate + (floor(Elapsed / StepInterval) * Increase)
+	int32 Steps = FMath::FloorToInt(Elapsed / ScoreRateStepInterval);
 	return BaseScoreRate + (Steps * ScoreRateIncrease);
 }
 
+double UScoreSystemComponent::IntegrateScoreRate(double Elapsed) const
+{
+	// Step function integral: n full steps contribute Inc * Step * (0 + 1 + ... + n-1),
+	// the partial step contributes Inc * n * (Elapsed - n * Step)
+	const double Step = ScoreRateStepInterval;
+	const double FullSteps = FMath::FloorToDouble(Elapsed / Step);
+	const double Partial = Elapsed - FullSteps * Step;
+
+	return BaseScoreRate * Elapsed
+		+ ScoreRateIncrease * (Step * FullSteps * (FullSteps - 1.0) * 0.5 + FullSteps * Partial);
+}
+
+double UScoreSystemComponent::GetOverclockSeconds(double Elapsed) const
+{
+	return bIsOverclockActive ? OverclockSeconds + (Elapsed - OverclockStartElapsed) : OverclockSeconds;
+}
+
+double UScoreSystemComponent::GetTimeScore() const
+{
+	const double Elapsed = GetTimeElapsed();
+	return IntegrateScoreRate(Elapsed) - IntegrateScoreRate(ScoringStartElapsed)
+		+ static_cast<double>(OverclockBonusRate) * GetOverclockSeconds(Elapsed);
+}
+
+double UScoreSystemComponent::GetSecondsUntilTimeScore(double TargetTimeScore) const
+{
+	double Remaining = TargetTimeScore - GetTimeScore();
+	if (Remaining <= 0.0)
+	{
+		return -1.0;
+	}
+
+	const double Step = ScoreRateStepInterval;
+	const double Bonus = bIsOverclockActive ? OverclockBonusRate : 0.0;
+
+	// No steps to walk -- the rate never changes
+	if (Step <= 0.0)
+	{
+		const double Rate = BaseScoreRate + Bonus;
+		return Rate > 0.0 ? Remaining / Rate : -1.0;
+	}
+
+	// Walk rate steps forward from now; rate only grows, so this ends quickly. Steps are
+	// counted by index (as in IntegrateScoreRate), so a step end that rounds onto the
+	// current time still moves the walk on
+	double StepStart = GetTimeElapsed();
+	int64 StepIndex = static_cast<int64>(FMath::FloorToDouble(StepStart / Step));
+	double Seconds = 0.0;
+
+	for (int32 Iteration = 0; Iteration < ScoreSystem_MaxRateStepsWalked; Iteration++, StepIndex++)
+	{
+		const double Rate = BaseScoreRate + static_cast<double>(StepIndex) * ScoreRateIncrease + Bonus;
+		const double StepEnd = static_cast<double>(StepIndex + 1) * Step;
+		const double StepSeconds = FMath::Max(StepEnd - StepStart, 0.0);
+		const double SegmentPoints = Rate * StepSeconds;
+
+		if (Rate <= 0.0)
+		{
+			return -1.0;
+		}
+		if (SegmentPoints >= Remaining)
+		{
+			return Seconds + Remaining / Rate;
+		}
+
+		Remaining -= SegmentPoints;
+		Seconds += StepSeconds;
+		StepStart = StepEnd;
+	}
+
+	// Too far off to matter -- the crossing check reschedules when this lower bound comes up
+	return Seconds;
+}
+
 // --- Leaderboard Functions ---
 
 int32 UScoreSystemComponent::SubmitToLeaderboard()
 {
+	if (IsAutopilotRun())
+	{
+		return 0;
+	}
+
 	// Create entry for this run
-	FLeaderboardEntry NewEntry(CurrentScore, TimeElapsed, FDateTime::Now());
+	FLeaderboardEntry NewEntry(GetCurrentScore(), GetTimeElapsed(), FDateTime::Now());
 	
 	// Ensure leaderboard is loaded
 	if (!CachedLeaderboard)
@@ -501,17 +611,18 @@ int32 UScoreSystemComponent::SubmitToLeaderboard()
 	{
 		// Add to leaderboard and get rank
 		LeaderboardRankThisRun = CachedLeaderboard->AddEntry(NewEntry);
+
+		// Save even without an all-time rank -- the run may still have placed today or this week
+		SaveLeaderboard();
+		StoreRunReplay(NewEntry);
 		
 		if (LeaderboardRankThisRun > 0)
 		{
-			// Made the leaderboard! Save it.
-			SaveLeaderboard();
-			
 			if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
 			{
 				Debug->LogEvent(EDebugCategory::Score, 
 					FString::Printf(TEXT("LEADERBOARD #%d! Score: %d, Time: %s"), 
-						LeaderboardRankThisRun, CurrentScore, *NewEntry.GetFormattedRunTime()));
+						LeaderboardRankThisRun, NewEntry.Score, *NewEntry.GetFormattedRunTime()));
 			}
 		}
 	}
@@ -521,8 +632,13 @@ int32 UScoreSystemComponent::SubmitToLeaderboard()
 
 int32 UScoreSystemComponent::SubmitToLeaderboardWithInitials(const FString& Initials)
 {
+	if (IsAutopilotRun())
+	{
+		return 0;
+	}
+
 	// Create entry for this run with initials
-	FLeaderboardEntry NewEntry(CurrentScore, TimeElapsed, FDateTime::Now(), Initials);
+	FLeaderboardEntry NewEntry(GetCurrentScore(), GetTimeElapsed(), FDateTime::Now(), Initials);
 	
 	// Ensure leaderboard is loaded
 	if (!CachedLeaderboard)
@@ -534,17 +650,18 @@ int32 UScoreSystemComponent::SubmitToLeaderboardWithInitials(const FString& Init
 	{
 		// Add to leaderboard and get rank
 		LeaderboardRankThisRun = CachedLeaderboard->AddEntry(NewEntry);
+
+		// Save even without an all-time rank -- the run may still have placed today or this week
+		SaveLeaderboard();
+		StoreRunReplay(NewEntry);
 		
 		if (LeaderboardRankThisRun > 0)
 		{
-			// Made the leaderboard! Save it.
-			SaveLeaderboard();
-			
 			if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
 			{
 				Debug->LogEvent(EDebugCategory::Score, 
 					FString::Printf(TEXT("LEADERBOARD #%d! %s - Score: %d, Time: %s"), 
-						LeaderboardRankThisRun, *NewEntry.PlayerInitials, CurrentScore, *NewEntry.GetFormattedRunTime()));
+						LeaderboardRankThisRun, *NewEntry.PlayerInitials, NewEntry.Score, *NewEntry.GetFormattedRunTime()));
 			}
 		}
 	}
@@ -554,47 +671,43 @@ int32 UScoreSystemComponent::SubmitToLeaderboardWithInitials(const FString& Init
 
 TArray<FLeaderboardEntry> UScoreSystemComponent::GetLeaderboard() const
 {
+	return GetLeaderboardPage(ELeaderboardPeriod::AllTime, 0, ULeaderboardSaveGame::AllTimeCapacity);
+}
+
+TArray<FLeaderboardEntry> UScoreSystemComponent::GetLeaderboardPage(ELeaderboardPeriod Period, int32 FirstIndex, int32 Count) const
+{
+	TArray<FLeaderboardEntry> Page;
 	if (CachedLeaderboard)
 	{
-		return CachedLeaderboard->Entries;
+		CachedLeaderboard->GetEntries(Period, FirstIndex, Count, Page);
 	}
-	return TArray<FLeaderboardEntry>();
+	return Page;
+}
+
+int32 UScoreSystemComponent::GetLeaderboardEntryCount(ELeaderboardPeriod Period) const
+{
+	return CachedLeaderboard ? CachedLeaderboard->GetNumEntries(Period) : 0;
 }
 
 bool UScoreSystemComponent::WouldQualifyForLeaderboard() const
 {
 	if (CachedLeaderboard)
 	{
-		return CachedLeaderboard->WouldQualify(CurrentScore);
+		return CachedLeaderboard->WouldQualify(GetCurrentScore());
 	}
 	return true; // If no leaderboard loaded, assume it would qualify
 }
 
 int32 UScoreSystemComponent::GetCurrentLeaderboardRank() const
 {
+	const int32 CurrentScore = GetCurrentScore();
 	if (!CachedLeaderboard || CurrentScore <= 0)
 	{
 		return 0;
 	}
 	
-	// Find where current score would rank
-	int32 Rank = 1;
-	for (const FLeaderboardEntry& Entry : CachedLeaderboard->Entries)
-	{
-		if (CurrentScore > Entry.Score)
-		{
-			return Rank;
-		}
-		Rank++;
-	}
-	
-	// Would be at the end
-	if (Rank <= ULeaderboardSaveGame::MaxEntries)
-	{
-		return Rank;
-	}
-	
-	return 0; // Wouldn't qualify
+	// Binary search -- ties rank below the existing entries
+	return CachedLeaderboard->GetRankForScore(ELeaderboardPeriod::AllTime, CurrentScore);
 }
 
 int32 UScoreSystemComponent::GetMinimumLeaderboardScore() const
@@ -610,7 +723,7 @@ void UScoreSystemComponent::ClearLeaderboard()
 {
 	if (CachedLeaderboard)
 	{
-		CachedLeaderboard->Entries.Empty();
+		CachedLeaderboard->Clear();
 		SaveLeaderboard();
 		
 		UE_LOG(LogStateRunner_Arcade, Log, TEXT("Leaderboard cleared"));
@@ -619,28 +732,43 @@ void UScoreSystemComponent::ClearLeaderboard()
 
 void UScoreSystemComponent::LoadLeaderboard()
 {
-	CachedLeaderboard = Cast<ULeaderboardSaveGame>(
-		UGameplayStatics::LoadGameFromSlot(TEXT("Leaderboard"), 0));
-	
+	// Share the save subsystem's authoritative leaderboard (loaded once per session)
+	if (UArcadeSaveSubsystem* Saves = UArcadeSaveSubsystem::Get(this))
+	{
+		CachedLeaderboard = Saves->GetLeaderboard();
+	}
+
 	if (!CachedLeaderboard)
 	{
-		// Create new leaderboard if none exists
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("ScoreSystem: No save subsystem - leaderboard won't persist"));
 		CachedLeaderboard = Cast<ULeaderboardSaveGame>(
 			UGameplayStatics::CreateSaveGameObject(ULeaderboardSaveGame::StaticClass()));
-		
-		UE_LOG(LogStateRunner_Arcade, Log, TEXT("Created new leaderboard save"));
 	}
-	else
+}
+
+void UScoreSystemComponent::SaveLeaderboard()
+{
+	// Game over is a safe point -- write the whole record now, in the background
+	if (UArcadeSaveSubsystem* Saves = UArcadeSaveSubsystem::Get(this))
 	{
-		UE_LOG(LogStateRunner_Arcade, Log, TEXT("Loaded leaderboard with %d entries"), CachedLeaderboard->Entries.Num());
+		Saves->MarkLeaderboardChanged();
+		Saves->Flush();
 	}
 }
 
-void UScoreSystemComponent::SaveLeaderboard()
+void UScoreSystemComponent::StoreRunReplay(const FLeaderboardEntry& Entry) const
 {
-	if (CachedLeaderboard)
+	const AStateRunner_ArcadeGameMode* GameMode = Cast<AStateRunner_ArcadeGameMode>(GetOwner());
+	if (URunReplayComponent* Replay = GameMode ? GameMode->GetRunReplayComponent() : nullptr)
 	{
-		UGameplayStatics::SaveGameToSlot(CachedLeaderboard, TEXT("Leaderboard"), 0);
-		UE_LOG(LogStateRunner_Arcade, Log, TEXT("Saved leaderboard with %d entries"), CachedLeaderboard->Entries.Num());
+		Replay->StoreLeaderboardReplay(Entry, LeaderboardRankThisRun, CachedLeaderboard);
 	}
 }
+
+bool UScoreSystemComponent::IsAutopilotRun() const
+{
+	const AStateRunner_ArcadeGameMode* GameMode = Cast<AStateRunner_ArcadeGameMode>(GetOwner());
+	const UAutopilotComponent* Autopilot = GameMode ? GameMode->GetAutopilotComponent() : nullptr;
+	const URunReplayComponent* Replay = GameMode ? GameMode->GetRunReplayComponent() : nullptr;
+	return (Autopilot && Autopilot->IsActive()) || (Replay && Replay->IsPlayingBack());
+}
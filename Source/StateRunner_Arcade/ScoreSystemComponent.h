@@ -3,6 +3,8 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "GameFramework/SaveGame.h"
+#include "GameplaySimulationSubsystem.h"
+#include "LeaderboardSaveGame.h"
 #include "ScoreSystemComponent.generated.h"
 
 /**
@@ -18,180 +20,6 @@ public:
 	int32 HighScore = 0;
 };
 
-/**
- * Single leaderboard entry with score, run time, date, and player initials.
- */
-USTRUCT(BlueprintType)
-struct FLeaderboardEntry
-{
-	GENERATED_BODY()
-
-	/** The score achieved */
-	UPROPERTY(BlueprintReadOnly, Category="Leaderboard")
-	int32 Score = 0;
-
-	/** Run duration in seconds */
-	UPROPERTY(BlueprintReadOnly, Category="Leaderboard")
-	float RunTimeSeconds = 0.0f;
-
-	/** Date and time when the score was achieved */
-	UPROPERTY(BlueprintReadOnly, Category="Leaderboard")
-	FDateTime DateAchieved;
-
-	/** Player initials (3 characters max, e.g., "AAA") */
-	UPROPERTY(BlueprintReadOnly, Category="Leaderboard")
-	FString PlayerInitials = TEXT("---");
-
-	/** Default constructor */
-	FLeaderboardEntry()
-		: Score(0)
-		, RunTimeSeconds(0.0f)
-		, DateAchieved(FDateTime::Now())
-		, PlayerInitials(TEXT("---"))
-	{
-	}
-
-	/** Constructor with values (no initials - legacy support) */
-	FLeaderboardEntry(int32 InScore, float InRunTime, FDateTime InDate)
-		: Score(InScore)
-		, RunTimeSeconds(InRunTime)
-		, DateAchieved(InDate)
-		, PlayerInitials(TEXT("---"))
-	{
-	}
-
-	/** Constructor with values including initials */
-	FLeaderboardEntry(int32 InScore, float InRunTime, FDateTime InDate, const FString& InInitials)
-		: Score(InScore)
-		, RunTimeSeconds(InRunTime)
-		, DateAchieved(InDate)
-		, PlayerInitials(InInitials.Left(3).ToUpper())
-	{
-	}
-
-	/** Get formatted run time string (MM:SS or HH:MM:SS) */
-	FString GetFormattedRunTime() const
-	{
-		int32 TotalSeconds = FMath::FloorToInt(RunTimeSeconds);
-		int32 Hours = TotalSeconds / 3600;
-		int32 Minutes = (TotalSeconds % 3600) / 60;
-		int32 Seconds = TotalSeconds % 60;
-
-		if (Hours > 0)
-		{
-			return FString::Printf(TEXT("%d:%02d:%02d"), Hours, Minutes, Seconds);
-		}
-		return FString::Printf(TEXT("%d:%02d"), Minutes, Seconds);
-	}
-
-	/** Get formatted date string (MM/DD/YYYY) */
-	FString GetFormattedDate() const
-	{
-		return FString::Printf(TEXT("%02d/%02d/%04d"), 
-			DateAchieved.GetMonth(), 
-			DateAchieved.GetDay(), 
-			DateAchieved.GetYear());
-	}
-
-	/** Get formatted date and time string */
-	FString GetFormattedDateTime() const
-	{
-		return FString::Printf(TEXT("%02d/%02d/%04d %02d:%02d"), 
-			DateAchieved.GetMonth(), 
-			DateAchieved.GetDay(), 
-			DateAchieved.GetYear(),
-			DateAchieved.GetHour(),
-			DateAchieved.GetMinute());
-	}
-};
-
-/**
- * Save game class for leaderboard persistence.
- * Stores top 10 scores with run time and date information.
- */
-UCLASS()
-class STATERUNNER_ARCADE_API ULeaderboardSaveGame : public USaveGame
-{
-	GENERATED_BODY()
-
-public:
-	/** Array of leaderboard entries, sorted by score (highest first) */
-	UPROPERTY()
-	TArray<FLeaderboardEntry> Entries;
-
-	/** Maximum number of entries to keep */
-	static constexpr int32 MaxEntries = 10;
-
-	/**
-	 * Add a new entry to the leaderboard.
-	 * Entries are automatically sorted and trimmed to MaxEntries.
-	 * 
-	 * @param NewEntry The entry to add
-	 * @return The rank (1-10) if the entry made the leaderboard, 0 if it didn't qualify
-	 */
-	int32 AddEntry(const FLeaderboardEntry& NewEntry)
-	{
-		// Add the new entry
-		Entries.Add(NewEntry);
-
-		// Sort by score (highest first)
-		Entries.Sort([](const FLeaderboardEntry& A, const FLeaderboardEntry& B)
-		{
-			return A.Score > B.Score;
-		});
-
-		// Find the rank of the new entry
-		int32 Rank = 0;
-		for (int32 i = 0; i < Entries.Num() && i < MaxEntries; i++)
-		{
-			if (Entries[i].Score == NewEntry.Score && 
-				FMath::IsNearlyEqual(Entries[i].RunTimeSeconds, NewEntry.RunTimeSeconds, 0.1f))
-			{
-				Rank = i + 1;
-				break;
-			}
-		}
-
-		// Trim to max entries
-		while (Entries.Num() > MaxEntries)
-		{
-			Entries.RemoveAt(Entries.Num() - 1);
-		}
-
-		// Return 0 if the entry didn't make the cut
-		return (Rank > 0 && Rank <= MaxEntries) ? Rank : 0;
-	}
-
-	/**
-	 * Check if a score would qualify for the leaderboard.
-	 * 
-	 * @param Score The score to check
-	 * @return True if the score would make the top 10
-	 */
-	bool WouldQualify(int32 Score) const
-	{
-		if (Entries.Num() < MaxEntries)
-		{
-			return true;
-		}
-		return Score > Entries.Last().Score;
-	}
-
-	/**
-	 * Get the minimum score needed to qualify for the leaderboard.
-	 * 
-	 * @return The minimum qualifying score, or 0 if leaderboard isn't full
-	 */
-	int32 GetMinimumQualifyingScore() const
-	{
-		if (Entries.Num() < MaxEntries)
-		{
-			return 0;
-		}
-		return Entries.Last().Score + 1;
-	}
-};
-
 /**
  * Delegate broadcast when score changes.
  */
@@ -234,9 +62,15 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnInsaneCombo, int32, BonusPoints);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnNiceCombo, int32, BonusPoints);
 
 /**
- * Handles score tracking, time-based accumulation, combos, and high score persistence.
+ * Handles score tracking, time-based scoring, combos, and high score persistence.
  * Score rate ramps up over time, and pickups/combos award bonus points.
  * High scores are saved locally via USaveGame.
+ *
+ * The time-based part of the score is never accumulated: the rate is a step function
+ * of scoring time, so GetCurrentScore() integrates it in closed form from the gameplay
+ * clock (plus OverclockBonusRate * seconds spent in OVERCLOCK). Only event bonuses are
+ * stored. OnScoreChanged fires for bonuses; readers that want the running score
+ * (HUD) poll GetCurrentScore(), which is cheap and exactly reproducible.
  */
 UCLASS(ClassGroup=(StateRunner), meta=(BlueprintSpawnableComponent))
 class STATERUNNER_ARCADE_API UScoreSystemComponent : public UActorComponent
@@ -250,6 +84,7 @@ public:
 protected:
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	// --- Score Configuration ---
 
@@ -270,8 +105,8 @@ protected:
 	float ScoreRateStepInterval = 4.0f;
 
 	/**
-	 * Score accumulation interval (seconds).
-	 * Score is added this often for smooth display.
+	 * Debug stat display refresh interval (seconds), while the debug overlay is enabled.
+	 * Score itself is computed on demand and doesn't depend on this.
 	 */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Score Config", meta=(ClampMin="0.05", ClampMax="1.0"))
 	float ScoreAccumulationInterval = 0.1f;
@@ -361,16 +196,11 @@ protected:
 protected:
 
 	/**
-	 * Current score.
+	 * Points from events (pickups, combos, EMP, 1-Up), DebugInitialScore, and any
+	 * earlier scoring interval. The running time-based score is added on top in GetCurrentScore().
 	 */
 	UPROPERTY(BlueprintReadOnly, Category="Score")
-	int32 CurrentScore = 0;
-
-	/**
-	 * Current score rate (points per second).
-	 */
-	UPROPERTY(BlueprintReadOnly, Category="Score")
-	int32 CurrentScoreRate = 0;
+	int32 BonusScore = 0;
 
 	/**
 	 * High score (loaded from save).
@@ -379,11 +209,23 @@ protected:
 	int32 HighScore = 0;
 
 	/**
-	 * Time elapsed since scoring started.
+	 * Scoring time when scoring last stopped (live value comes from GetTimeElapsed()).
 	 */
 	UPROPERTY(BlueprintReadOnly, Category="Score")
 	float TimeElapsed = 0.0f;
 
+	/** Scoring time at StartScoring (DebugInitialTimeElapsed, else 0) -- the integral's lower bound */
+	float ScoringStartElapsed = 0.0f;
+
+	/** Gameplay clock time at StartScoring */
+	double ScoringClockStart = 0.0;
+
+	/** OVERCLOCK seconds in finished activations */
+	double OverclockSeconds = 0.0;
+
+	/** Scoring time the current OVERCLOCK activation began */
+	double OverclockStartElapsed = 0.0;
+
 	/**
 	 * Whether scoring is currently active.
 	 */
@@ -413,15 +255,13 @@ protected:
 	int32 SessionStartHighScore = 0;
 
 	/**
-	 * Timer handles.
+	 * Fires when the time-based score will cross the session high score (rescheduled
+	 * whenever the slope or bonus changes), so OnHighScoreBeaten needs no polling.
 	 */
-	FTimerHandle ScoreAccumulationTimer;
-	FTimerHandle ScoreRateUpdateTimer;
+	FGameplayTimerHandle HighScoreCrossingTimer;
 
-	/**
-	 * Fractional score accumulator (for smooth scoring).
-	 */
-	float FractionalScore = 0.0f;
+	/** Refreshes the debug stat display while the debug overlay is on */
+	FGameplayTimerHandle DebugDisplayTimer;
 
 	/**
 	 * Count of Data Packets collected this session.
@@ -456,7 +296,7 @@ protected:
 	float ComboPopupDelaySeconds = 1.0f;
 
 	/** Timer handle for delayed NICE combo popup */
-	FTimerHandle NiceComboDelayTimer;
+	FGameplayTimerHandle NiceComboDelayTimer;
 
 	/** Bonus value stored when NICE combo is pending (in case we need to show it after delay) */
 	int32 PendingNiceComboBonusValue = 0;
@@ -595,16 +435,22 @@ public:
 	float GetCurrentPickupPitchMultiplier() const;
 
 	/**
-	 * Get current score.
+	 * Get current score (bonuses plus the closed-form time score at this instant).
+	 */
+	UFUNCTION(BlueprintPure, Category="Score")
+	int32 GetCurrentScore() const;
+
+	/**
+	 * Get current score rate (points per second, excluding the OVERCLOCK bonus).
 	 */
 	UFUNCTION(BlueprintPure, Category="Score")
-	int32 GetCurrentScore() const { return CurrentScore; }
+	int32 GetCurrentScoreRate() const { return CalculateScoreRate(GetTimeElapsed()); }
 
 	/**
-	 * Get current score rate.
+	 * Scoring time now (frozen while scoring is stopped).
 	 */
 	UFUNCTION(BlueprintPure, Category="Score")
-	int32 GetCurrentScoreRate() const { return CurrentScoreRate; }
+	float GetTimeElapsed() const;
 
 	/**
 	 * Get high score.
@@ -641,7 +487,7 @@ public:
 	 * Submit the current run to the leaderboard (without initials).
 	 * Should be called at game end (after CheckAndSaveHighScore).
 	 * 
-	 * @return The rank achieved (1-10), or 0 if didn't qualify for leaderboard
+	 * @return The all-time rank achieved (1-1000), or 0 if didn't qualify for the all-time board
 	 */
 	UFUNCTION(BlueprintCallable, Category="Leaderboard")
 	int32 SubmitToLeaderboard();
@@ -651,32 +497,50 @@ public:
 	 * Should be called after player enters their initials on game over screen.
 	 * 
 	 * @param Initials Player's 3-letter initials (will be uppercased and truncated to 3 chars)
-	 * @return The rank achieved (1-10), or 0 if didn't qualify for leaderboard
+	 * @return The all-time rank achieved (1-1000), or 0 if didn't qualify for the all-time board
 	 */
 	UFUNCTION(BlueprintCallable, Category="Leaderboard")
 	int32 SubmitToLeaderboardWithInitials(const FString& Initials);
 
 	/**
-	 * Get the current leaderboard entries.
+	 * Get every all-time leaderboard entry (up to 1000 -- UI should page with GetLeaderboardPage).
 	 * 
 	 * @return Array of leaderboard entries (sorted by score, highest first)
 	 */
 	UFUNCTION(BlueprintCallable, Category="Leaderboard")
 	TArray<FLeaderboardEntry> GetLeaderboard() const;
 
+	/**
+	 * Get one window of a board.
+	 * 
+	 * @param Period Which board (all-time, today, this week)
+	 * @param FirstIndex Index of the first entry (0 = rank 1)
+	 * @param Count Maximum number of entries to return
+	 * @return Entries FirstIndex .. FirstIndex + Count - 1 (fewer at the end of the board)
+	 */
+	UFUNCTION(BlueprintCallable, Category="Leaderboard")
+	TArray<FLeaderboardEntry> GetLeaderboardPage(ELeaderboardPeriod Period, int32 FirstIndex, int32 Count) const;
+
+	/** Number of entries on a board */
+	UFUNCTION(BlueprintPure, Category="Leaderboard")
+	int32 GetLeaderboardEntryCount(ELeaderboardPeriod Period) const;
+
+	/** The shared leaderboard store (null until loaded) */
+	const ULeaderboardSaveGame* GetLeaderboardStore() const { return CachedLeaderboard; }
+
 	/**
 	 * Check if the current score would qualify for the leaderboard.
 	 * Can be called during gameplay to show "NEW RECORD!" etc.
 	 * 
-	 * @return True if current score would make top 10
+	 * @return True if current score would place on the all-time, daily or weekly board
 	 */
 	UFUNCTION(BlueprintPure, Category="Leaderboard")
 	bool WouldQualifyForLeaderboard() const;
 
 	/**
-	 * Get the rank the current score would achieve on the leaderboard.
+	 * Get the rank the current score would achieve on the all-time leaderboard.
 	 * 
-	 * @return Rank (1-10) or 0 if wouldn't qualify
+	 * @return Rank (1-1000) or 0 if wouldn't qualify
 	 */
 	UFUNCTION(BlueprintPure, Category="Leaderboard")
 	int32 GetCurrentLeaderboardRank() const;
@@ -713,14 +577,6 @@ public:
 
 protected:
 
-	/** Called by timer to accumulate score */
-	UFUNCTION()
-	void AccumulateScore();
-
-	/** Called by timer to update score rate */
-	UFUNCTION()
-	void UpdateScoreRate();
-
 	/** Called when NICE combo delay expires - shows popup if INSANE wasn't achieved */
 	UFUNCTION()
 	void OnNiceComboDelayExpired();
@@ -737,14 +593,41 @@ protected:
 	/** Save leaderboard to save */
 	void SaveLeaderboard();
 
-	/** Calculate current score rate based on time elapsed */
-	int32 CalculateScoreRate() const;
+	/** The autopilot or a replay is playing this run -- it never reaches the high score or leaderboard */
+	bool IsAutopilotRun() const;
+
+	/** Hand the finished run's replay to the replay component, which keeps it if the rank is high enough */
+	void StoreRunReplay(const FLeaderboardEntry& Entry) const;
+
+	/** Score rate at a scoring time: BaseRate + floor(Elapsed / StepInterval) * Increase */
+	int32 CalculateScoreRate(float Elapsed) const;
+
+	/** Time-based points from scoring time 0 to Elapsed (integral of CalculateScoreRate) */
+	double IntegrateScoreRate(double Elapsed) const;
+
+	/** OVERCLOCK seconds up to scoring time Elapsed */
+	double GetOverclockSeconds(double Elapsed) const;
+
+	/** Exact time-based score (rate integral since StartScoring + OVERCLOCK bonus) */
+	double GetTimeScore() const;
+
+	/**
+	 * Scoring seconds until the time-based score reaches TargetTimeScore at the current
+	 * slope (OVERCLOCK counted only if active now). Negative if already reached.
+	 */
+	double GetSecondsUntilTimeScore(double TargetTimeScore) const;
+
+	/** Broadcast OnHighScoreBeaten if the score has passed the session high score, else reschedule the crossing timer */
+	void CheckHighScoreBeaten();
+
+	/** Push the current score to the debug stat display */
+	void RefreshDebugStats();
 
 	// --- Leaderboard State ---
 
 protected:
 
-	/** Cached leaderboard data (loaded on BeginPlay) */
+	/** The save subsystem's authoritative leaderboard (shared, not a copy -- bound on BeginPlay) */
 	UPROPERTY()
 	TObjectPtr<ULeaderboardSaveGame> CachedLeaderboard;
 
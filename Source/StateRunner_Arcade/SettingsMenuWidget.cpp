@@ -1,46 +1,35 @@
 #include "SettingsMenuWidget.h"
-#include "MusicPersistenceSubsystem.h"
+#include "ArcadeSaveSubsystem.h"
+#include "AudioSettingsSubsystem.h"
+#include "HardwareTierSubsystem.h"
+#include "PerformanceGovernorComponent.h"
+#include "DisplaySettingsSubsystem.h"
 #include "Components/Button.h"
 #include "Components/Slider.h"
 #include "Components/TextBlock.h"
 #include "GameFramework/GameUserSettings.h"
 #include "Kismet/GameplayStatics.h"
-#include "Sound/SoundMix.h"
-#include "Sound/SoundClass.h"
 #include "StateRunner_Arcade.h"
 
-// Config section for audio settings
-static const FString AudioConfigSection = TEXT("/Script/StateRunner_Arcade.AudioSettings");
-static const FString MasterVolumeKey = TEXT("MasterVolume");
-static const FString MusicVolumeKey = TEXT("MusicVolume");
-static const FString SFXVolumeKey = TEXT("SFXVolume");
-
 // Config section for graphics settings initialization tracking
 static const FString GraphicsConfigSection = TEXT("/Script/StateRunner_Arcade.GraphicsSettings");
 static const FString SettingsInitializedKey = TEXT("bSettingsInitialized");
 
-// Audio asset paths - MUST match AudioSettingsSubsystem paths exactly!
-// Prefixed with "Settings_" to avoid collision with MusicPersistenceSubsystem
-static const TCHAR* Settings_SoundMixPath = TEXT("/Game/_DEVELOPER/Audio/SoundClasses/SM_GameVolume.SM_GameVolume");
-static const TCHAR* Settings_MasterSoundClassPath = TEXT("/Game/_DEVELOPER/Audio/SoundClasses/SClass_Master.SClass_Master");
-static const TCHAR* Settings_MusicSoundClassPath = TEXT("/Game/_DEVELOPER/Audio/SoundClasses/SClass_Music.SClass_Music");
-static const TCHAR* Settings_SFXSoundClassPath = TEXT("/Game/_DEVELOPER/Audio/SoundClasses/SClass_SFX.SClass_SFX");
-
 USettingsMenuWidget::USettingsMenuWidget(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
 	// Default focus on first setting
 	DefaultFocusIndex = INDEX_QUALITY_PRESET;
 
+	// The frame stats readout must measure the chosen frame rate cap, not the menu cap
+	bCapsFrameRate = false;
+
 	// Initialize preset names
 	InitializePresetNames();
 }
 
 void USettingsMenuWidget::NativeConstruct()
 {
-	// Load audio assets programmatically to ensure they match AudioSettingsSubsystem
-	LoadAudioAssets();
-
 	// Initialize resolutions before registering widgets
 	InitializeResolutions();
 
@@ -105,6 +94,44 @@ void USettingsMenuWidget::NativeConstruct()
 		FullscreenButton->OnClicked.AddDynamic(this, &USettingsMenuWidget::OnFullscreenClicked);
 	}
 
+	if (HardwareTierButton)
+	{
+		RegisterFocusableItem(HardwareTierButton, EArcadeFocusType::Selector, HardwareTierLabel, HardwareTierValue);
+		// Bind click to cycle forward (for mouse users)
+		HardwareTierButton->OnClicked.AddDynamic(this, &USettingsMenuWidget::OnHardwareTierClicked);
+	}
+
+	if (PerformanceGovernorButton)
+	{
+		RegisterFocusableItem(PerformanceGovernorButton, EArcadeFocusType::Selector, PerformanceGovernorLabel, PerformanceGovernorValue);
+		// Bind click to cycle forward (for mouse users)
+		PerformanceGovernorButton->OnClicked.AddDynamic(this, &USettingsMenuWidget::OnPerformanceGovernorClicked);
+	}
+
+	if (FrameRateLimitButton)
+	{
+		RegisterFocusableItem(FrameRateLimitButton, EArcadeFocusType::Selector, FrameRateLimitLabel, FrameRateLimitValue);
+		FrameRateLimitButton->OnClicked.AddDynamic(this, &USettingsMenuWidget::OnFrameRateLimitClicked);
+	}
+
+	if (VSyncButton)
+	{
+		RegisterFocusableItem(VSyncButton, EArcadeFocusType::Selector, VSyncLabel, VSyncValue);
+		VSyncButton->OnClicked.AddDynamic(this, &USettingsMenuWidget::OnVSyncClicked);
+	}
+
+	if (LowLatencyButton)
+	{
+		RegisterFocusableItem(LowLatencyButton, EArcadeFocusType::Selector, LowLatencyLabel, LowLatencyValue);
+		LowLatencyButton->OnClicked.AddDynamic(this, &USettingsMenuWidget::OnLowLatencyClicked);
+	}
+
+	if (SimulationRateButton)
+	{
+		RegisterFocusableItem(SimulationRateButton, EArcadeFocusType::Selector, SimulationRateLabel, SimulationRateValue);
+		SimulationRateButton->OnClicked.AddDynamic(this, &USettingsMenuWidget::OnSimulationRateClicked);
+	}
+
 	// 3. Back button (bottom)
 	if (BackButton)
 	{
@@ -119,16 +146,13 @@ void USettingsMenuWidget::NativeConstruct()
 	UpdateQualityPresetDisplay();
 	UpdateResolutionDisplay();
 	UpdateFullscreenDisplay();
+	UpdateHardwareTierDisplay();
+	UpdatePerformanceGovernorDisplay();
+	UpdateDisplaySettingsDisplay();
 
 	// Call parent (sets initial focus)
 	Super::NativeConstruct();
 
-	// Push the sound mix if configured
-	if (VolumeSoundMix)
-	{
-		UGameplayStatics::PushSoundMixModifier(this, VolumeSoundMix);
-	}
-
 	UE_LOG(LogStateRunner_Arcade, Log, TEXT("SettingsMenuWidget: Constructed with %d focusable items"), GetFocusableItemCount());
 }
 
@@ -163,6 +187,30 @@ void USettingsMenuWidget::NativeDestruct()
 	{
 		FullscreenButton->OnClicked.RemoveDynamic(this, &USettingsMenuWidget::OnFullscreenClicked);
 	}
+	if (HardwareTierButton)
+	{
+		HardwareTierButton->OnClicked.RemoveDynamic(this, &USettingsMenuWidget::OnHardwareTierClicked);
+	}
+	if (PerformanceGovernorButton)
+	{
+		PerformanceGovernorButton->OnClicked.RemoveDynamic(this, &USettingsMenuWidget::OnPerformanceGovernorClicked);
+	}
+	if (FrameRateLimitButton)
+	{
+		FrameRateLimitButton->OnClicked.RemoveDynamic(this, &USettingsMenuWidget::OnFrameRateLimitClicked);
+	}
+	if (VSyncButton)
+	{
+		VSyncButton->OnClicked.RemoveDynamic(this, &USettingsMenuWidget::OnVSyncClicked);
+	}
+	if (LowLatencyButton)
+	{
+		LowLatencyButton->OnClicked.RemoveDynamic(this, &USettingsMenuWidget::OnLowLatencyClicked);
+	}
+	if (SimulationRateButton)
+	{
+		SimulationRateButton->OnClicked.RemoveDynamic(this, &USettingsMenuWidget::OnSimulationRateClicked);
+	}
 	if (BackButton)
 	{
 		BackButton->OnClicked.RemoveDynamic(this, &USettingsMenuWidget::OnBackButtonClicked);
@@ -171,6 +219,26 @@ void USettingsMenuWidget::NativeDestruct()
 	Super::NativeDestruct();
 }
 
+void USettingsMenuWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+{
+	Super::NativeTick(MyGeometry, InDeltaTime);
+
+	if (!FrameStatsText)
+	{
+		return;
+	}
+
+	// Averaged over the refresh window so the readout is legible
+	FrameStatsAccumulatedSeconds += InDeltaTime;
+	FrameStatsFrameCount++;
+	if (FrameStatsAccumulatedSeconds >= FrameStatsRefreshInterval)
+	{
+		UpdateFrameStatsDisplay();
+		FrameStatsAccumulatedSeconds = 0.0f;
+		FrameStatsFrameCount = 0;
+	}
+}
+
 //=============================================================================
 // INITIALIZATION
 //=============================================================================
@@ -246,69 +314,107 @@ void USettingsMenuWidget::InitializePresetNames()
 	FullscreenModeNames.Add(TEXT("Windowed"));
 }
 
-void USettingsMenuWidget::LoadAudioAssets()
+//=============================================================================
+// DISPLAY UPDATES
+//=============================================================================
+
+void USettingsMenuWidget::UpdateQualityPresetDisplay()
 {
-	// Load audio assets programmatically to ensure consistency with AudioSettingsSubsystem
-	// This overwrites any Blueprint-configured values to guarantee matching assets
-	
-	VolumeSoundMix = LoadObject<USoundMix>(nullptr, Settings_SoundMixPath);
-	if (!VolumeSoundMix)
+	if (QualityPresetValue && QualityPresetNames.IsValidIndex(CurrentQualityPresetIndex))
 	{
-		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("SettingsMenuWidget: Failed to load SoundMix from %s"), Settings_SoundMixPath);
+		QualityPresetValue->SetText(FText::FromString(FString::Printf(TEXT("< %s >"), *QualityPresetNames[CurrentQualityPresetIndex])));
 	}
+}
 
-	MasterSoundClass = LoadObject<USoundClass>(nullptr, Settings_MasterSoundClassPath);
-	if (!MasterSoundClass)
+void USettingsMenuWidget::UpdateResolutionDisplay()
+{
+	if (ResolutionValue && AvailableResolutions.IsValidIndex(CurrentResolutionIndex))
 	{
-		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("SettingsMenuWidget: Failed to load MasterSoundClass from %s"), Settings_MasterSoundClassPath);
+		const FIntPoint& Res = AvailableResolutions[CurrentResolutionIndex];
+		ResolutionValue->SetText(FText::FromString(FString::Printf(TEXT("< %dx%d >"), Res.X, Res.Y)));
 	}
+}
 
-	MusicSoundClass = LoadObject<USoundClass>(nullptr, Settings_MusicSoundClassPath);
-	if (!MusicSoundClass)
+void USettingsMenuWidget::UpdateFullscreenDisplay()
+{
+	if (FullscreenValue && FullscreenModeNames.IsValidIndex(CurrentFullscreenIndex))
 	{
-		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("SettingsMenuWidget: Failed to load MusicSoundClass from %s"), Settings_MusicSoundClassPath);
+		FullscreenValue->SetText(FText::FromString(FString::Printf(TEXT("< %s >"), *FullscreenModeNames[CurrentFullscreenIndex])));
 	}
+}
 
-	SFXSoundClass = LoadObject<USoundClass>(nullptr, Settings_SFXSoundClassPath);
-	if (!SFXSoundClass)
+void USettingsMenuWidget::UpdateHardwareTierDisplay()
+{
+	UGameInstance* GI = UGameplayStatics::GetGameInstance(this);
+	const UHardwareTierSubsystem* HardwareTier = GI ? GI->GetSubsystem<UHardwareTierSubsystem>() : nullptr;
+	if (!HardwareTierValue || !HardwareTier)
 	{
-		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("SettingsMenuWidget: Failed to load SFXSoundClass from %s"), Settings_SFXSoundClassPath);
+		return;
 	}
 
-	UE_LOG(LogStateRunner_Arcade, Log, TEXT("SettingsMenuWidget: Audio assets loaded - SoundMix: %s, Master: %s, Music: %s, SFX: %s"),
-		VolumeSoundMix ? TEXT("OK") : TEXT("MISSING"),
-		MasterSoundClass ? TEXT("OK") : TEXT("MISSING"),
-		MusicSoundClass ? TEXT("OK") : TEXT("MISSING"),
-		SFXSoundClass ? TEXT("OK") : TEXT("MISSING"));
+	const FString TierName = UHardwareTierSubsystem::GetTierName(HardwareTier->GetTier());
+	HardwareTierValue->SetText(FText::FromString(HardwareTier->IsTierLocked()
+		? FString::Printf(TEXT("%s (locked)"), *TierName)
+		: FString::Printf(TEXT("< %s >"), *TierName)));
 }
 
-//=============================================================================
-// DISPLAY UPDATES
-//=============================================================================
-
-void USettingsMenuWidget::UpdateQualityPresetDisplay()
+void USettingsMenuWidget::UpdatePerformanceGovernorDisplay()
 {
-	if (QualityPresetValue && QualityPresetNames.IsValidIndex(CurrentQualityPresetIndex))
+	if (!PerformanceGovernorValue)
 	{
-		QualityPresetValue->SetText(FText::FromString(FString::Printf(TEXT("< %s >"), *QualityPresetNames[CurrentQualityPresetIndex])));
+		return;
 	}
+
+	// In a run the live component is the source of truth; in the menus it's the saved pick
+	const UPerformanceGovernorComponent* Governor = UPerformanceGovernorComponent::Get(this);
+	const EPerformanceGovernorPreset Preset = Governor ? Governor->GetPreset() : UPerformanceGovernorComponent::LoadSavedPreset();
+	PerformanceGovernorValue->SetText(FText::FromString(FString::Printf(TEXT("< %s >"), *UPerformanceGovernorComponent::GetPresetName(Preset))));
 }
 
-void USettingsMenuWidget::UpdateResolutionDisplay()
+void USettingsMenuWidget::UpdateDisplaySettingsDisplay()
 {
-	if (ResolutionValue && AvailableResolutions.IsValidIndex(CurrentResolutionIndex))
+	const UDisplaySettingsSubsystem* DisplaySettings = UDisplaySettingsSubsystem::Get(this);
+	if (!DisplaySettings)
 	{
-		const FIntPoint& Res = AvailableResolutions[CurrentResolutionIndex];
-		ResolutionValue->SetText(FText::FromString(FString::Printf(TEXT("< %dx%d >"), Res.X, Res.Y)));
+		return;
+	}
+
+	const FDisplaySettings& Settings = DisplaySettings->GetSettings();
+	if (FrameRateLimitValue)
+	{
+		FrameRateLimitValue->SetText(FText::FromString(Settings.FrameRateLimit > 0
+			? FString::Printf(TEXT("< %d Hz >"), Settings.FrameRateLimit)
+			: FString(TEXT("< Uncapped >"))));
+	}
+	if (VSyncValue)
+	{
+		VSyncValue->SetText(FText::FromString(Settings.bVSyncEnabled ? TEXT("< On >") : TEXT("< Off >")));
+	}
+	if (LowLatencyValue)
+	{
+		LowLatencyValue->SetText(FText::FromString(Settings.bLowLatencyMode ? TEXT("< On >") : TEXT("< Off >")));
+	}
+	if (SimulationRateValue)
+	{
+		SimulationRateValue->SetText(FText::FromString(Settings.SimulationStepRate > 0
+			? FString::Printf(TEXT("< %d Hz >"), Settings.SimulationStepRate)
+			: FString(TEXT("< Default >"))));
 	}
 }
 
-void USettingsMenuWidget::UpdateFullscreenDisplay()
+void USettingsMenuWidget::UpdateFrameStatsDisplay()
 {
-	if (FullscreenValue && FullscreenModeNames.IsValidIndex(CurrentFullscreenIndex))
+	if (!FrameStatsText || FrameStatsFrameCount == 0)
 	{
-		FullscreenValue->SetText(FText::FromString(FString::Printf(TEXT("< %s >"), *FullscreenModeNames[CurrentFullscreenIndex])));
+		return;
 	}
+
+	const float FrameMs = FrameStatsAccumulatedSeconds * 1000.0f / FrameStatsFrameCount;
+	float GameThreadMs, GPUMs;
+	UDisplaySettingsSubsystem::GetLastFrameTimings(GameThreadMs, GPUMs);
+
+	FrameStatsText->SetText(FText::FromString(FString::Printf(TEXT("%.0f FPS | %.2f ms (Game %.2f / GPU %.2f)"),
+		FrameMs > 0.0f ? 1000.0f / FrameMs : 0.0f, FrameMs, GameThreadMs, GPUMs)));
 }
 
 void USettingsMenuWidget::UpdateVolumeDisplay(UTextBlock* ValueText, float Volume)
@@ -358,6 +464,98 @@ void USettingsMenuWidget::CycleFullscreenMode(int32 Direction)
 	UE_LOG(LogStateRunner_Arcade, Log, TEXT("SettingsMenuWidget: Fullscreen mode changed to %s"), *FullscreenModeNames[CurrentFullscreenIndex]);
 }
 
+void USettingsMenuWidget::CycleHardwareTier(int32 Direction)
+{
+	UGameInstance* GI = UGameplayStatics::GetGameInstance(this);
+	UHardwareTierSubsystem* HardwareTier = GI ? GI->GetSubsystem<UHardwareTierSubsystem>() : nullptr;
+	if (!HardwareTier || HardwareTier->IsTierLocked())
+	{
+		return;
+	}
+
+	// Saved by the subsystem straight away; pool caps take effect from the next run
+	const int32 TierCount = static_cast<int32>(EHardwareTier::Count);
+	const int32 NewTier = (static_cast<int32>(HardwareTier->GetTier()) + Direction + TierCount) % TierCount;
+	HardwareTier->SetTier(static_cast<EHardwareTier>(NewTier));
+	UpdateHardwareTierDisplay();
+	OnSettingChanged(INDEX_HARDWARE_TIER);
+}
+
+void USettingsMenuWidget::CyclePerformanceGovernor(int32 Direction)
+{
+	UPerformanceGovernorComponent* Governor = UPerformanceGovernorComponent::Get(this);
+	const EPerformanceGovernorPreset Current = Governor ? Governor->GetPreset() : UPerformanceGovernorComponent::LoadSavedPreset();
+
+	const int32 PresetCount = static_cast<int32>(EPerformanceGovernorPreset::Count);
+	const EPerformanceGovernorPreset NewPreset = static_cast<EPerformanceGovernorPreset>((static_cast<int32>(Current) + Direction + PresetCount) % PresetCount);
+
+	// Saved either way; a run in progress switches ladders straight away
+	if (Governor)
+	{
+		Governor->SetPreset(NewPreset);
+	}
+	else
+	{
+		UPerformanceGovernorComponent::SavePreset(NewPreset);
+	}
+
+	UpdatePerformanceGovernorDisplay();
+	OnSettingChanged(INDEX_PERFORMANCE_GOVERNOR);
+
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("SettingsMenuWidget: Performance governor changed to %s"), *UPerformanceGovernorComponent::GetPresetName(NewPreset));
+}
+
+void USettingsMenuWidget::CycleFrameRateLimit(int32 Direction)
+{
+	UDisplaySettingsSubsystem* DisplaySettings = UDisplaySettingsSubsystem::Get(this);
+	if (!DisplaySettings)
+	{
+		return;
+	}
+
+	const TArray<int32>& Options = UDisplaySettingsSubsystem::GetFrameRateOptions();
+	const int32 CurrentIndex = FMath::Max(Options.IndexOfByKey(DisplaySettings->GetSettings().FrameRateLimit), 0);
+	DisplaySettings->SetFrameRateLimit(Options[(CurrentIndex + Direction + Options.Num()) % Options.Num()]);
+	UpdateDisplaySettingsDisplay();
+	OnSettingChanged(INDEX_FRAME_RATE_LIMIT);
+}
+
+void USettingsMenuWidget::ToggleVSync()
+{
+	if (UDisplaySettingsSubsystem* DisplaySettings = UDisplaySettingsSubsystem::Get(this))
+	{
+		DisplaySettings->SetVSyncEnabled(!DisplaySettings->GetSettings().bVSyncEnabled);
+		UpdateDisplaySettingsDisplay();
+		OnSettingChanged(INDEX_VSYNC);
+	}
+}
+
+void USettingsMenuWidget::ToggleLowLatency()
+{
+	if (UDisplaySettingsSubsystem* DisplaySettings = UDisplaySettingsSubsystem::Get(this))
+	{
+		DisplaySettings->SetLowLatencyMode(!DisplaySettings->GetSettings().bLowLatencyMode);
+		UpdateDisplaySettingsDisplay();
+		OnSettingChanged(INDEX_LOW_LATENCY);
+	}
+}
+
+void USettingsMenuWidget::CycleSimulationRate(int32 Direction)
+{
+	UDisplaySettingsSubsystem* DisplaySettings = UDisplaySettingsSubsystem::Get(this);
+	if (!DisplaySettings)
+	{
+		return;
+	}
+
+	// Read when the next world starts, so a run in progress keeps its rate
+	const TArray<int32>& Options = UDisplaySettingsSubsystem::GetSimulationRateOptions();
+	const int32 CurrentIndex = FMath::Max(Options.IndexOfByKey(DisplaySettings->GetSettings().SimulationStepRate), 0);
+	DisplaySettings->SetSimulationStepRate(Options[(CurrentIndex + Direction + Options.Num()) % Options.Num()]);
+	UpdateDisplaySettingsDisplay();
+	OnSettingChanged(INDEX_SIMULATION_RATE);
+}
+
 //=============================================================================
 // SETTINGS APPLICATION
 //=============================================================================
@@ -427,58 +625,28 @@ void USettingsMenuWidget::ApplyGraphicsSettings()
 
 void USettingsMenuWidget::ApplyAudioSettings()
 {
-	// Apply volume through sound mix
+	// Apply volume through the subsystem's sound mix
 	if (MasterVolumeSlider)
 	{
-		ApplyVolumeToSoundClass(MasterSoundClass, MasterVolumeSlider->GetValue());
+		PreviewVolume(EAudioVolumeChannel::Master, MasterVolumeSlider->GetValue());
 	}
 	if (MusicVolumeSlider)
 	{
-		ApplyVolumeToSoundClass(MusicSoundClass, MusicVolumeSlider->GetValue());
+		PreviewVolume(EAudioVolumeChannel::Music, MusicVolumeSlider->GetValue());
 	}
 	if (SFXVolumeSlider)
 	{
-		ApplyVolumeToSoundClass(SFXSoundClass, SFXVolumeSlider->GetValue());
+		PreviewVolume(EAudioVolumeChannel::SFX, SFXVolumeSlider->GetValue());
 	}
 }
 
-void USettingsMenuWidget::ApplyVolumeToSoundClass(USoundClass* SoundClass, float Volume)
+void USettingsMenuWidget::PreviewVolume(EAudioVolumeChannel Channel, float Volume)
 {
-	if (!SoundClass)
+	// Slider ticks coalesce into one mix update per frame; nothing is saved until SaveSettings
+	UGameInstance* GI = UGameplayStatics::GetGameInstance(this);
+	if (UAudioSettingsSubsystem* AudioSettings = GI ? GI->GetSubsystem<UAudioSettingsSubsystem>() : nullptr)
 	{
-		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("SettingsMenuWidget: ApplyVolumeToSoundClass - SoundClass is NULL"));
-		return;
-	}
-	if (!VolumeSoundMix)
-	{
-		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("SettingsMenuWidget: ApplyVolumeToSoundClass - VolumeSoundMix is NULL"));
-		return;
-	}
-
-	// Tell music subsystem to ignore OnAudioFinished during volume adjustment
-	UMusicPersistenceSubsystem* MusicSubsystem = UMusicPersistenceSubsystem::GetMusicPersistenceSubsystem(this);
-	if (MusicSubsystem)
-	{
-		MusicSubsystem->SetIgnoreAudioFinished(true);
-	}
-
-	UE_LOG(LogStateRunner_Arcade, Log, TEXT("SettingsMenuWidget: Applying volume %f to SoundClass %s"), Volume, *SoundClass->GetName());
-	UGameplayStatics::SetSoundMixClassOverride(this, VolumeSoundMix, SoundClass, Volume, 1.0f, 0.0f, true);
-
-	// Re-enable OnAudioFinished after a brief delay
-	if (MusicSubsystem)
-	{
-		if (UWorld* World = GetWorld())
-		{
-			FTimerHandle ReenableHandle;
-			World->GetTimerManager().SetTimer(ReenableHandle, [MusicSubsystem]()
-			{
-				if (MusicSubsystem && MusicSubsystem->IsValidLowLevel())
-				{
-					MusicSubsystem->SetIgnoreAudioFinished(false);
-				}
-			}, 0.1f, false);
-		}
+		AudioSettings->PreviewVolume(Channel, Volume);
 	}
 }
 
@@ -488,16 +656,15 @@ void USettingsMenuWidget::ApplyVolumeToSoundClass(USoundClass* SoundClass, float
 
 void USettingsMenuWidget::LoadSettings()
 {
-	// Load audio settings from config
-	// Default volumes for first-time users (before any settings are saved)
-	// MUST match AudioSettingsSubsystem defaults!
-	float MasterVol = 0.85f;  // 85%
-	float MusicVol = 0.5f;    // 50%
-	float SFXVol = 1.0f;      // 100%
+	// Load audio settings from the save record (defaults for first-time users)
+	float MasterVol = UAudioSettingsSubsystem::DefaultMasterVolume;
+	float MusicVol = UAudioSettingsSubsystem::DefaultMusicVolume;
+	float SFXVol = UAudioSettingsSubsystem::DefaultSFXVolume;
 
-	GConfig->GetFloat(*AudioConfigSection, *MasterVolumeKey, MasterVol, GGameUserSettingsIni);
-	GConfig->GetFloat(*AudioConfigSection, *MusicVolumeKey, MusicVol, GGameUserSettingsIni);
-	GConfig->GetFloat(*AudioConfigSection, *SFXVolumeKey, SFXVol, GGameUserSettingsIni);
+	if (const UArcadeSaveSubsystem* Saves = UArcadeSaveSubsystem::Get(this))
+	{
+		Saves->GetVolumes(MasterVol, MusicVol, SFXVol);
+	}
 
 	// Apply to sliders
 	if (MasterVolumeSlider)
@@ -574,22 +741,19 @@ void USettingsMenuWidget::LoadSettings()
 
 void USettingsMenuWidget::SaveSettings()
 {
-	// Save audio settings to config
-	if (MasterVolumeSlider)
-	{
-		GConfig->SetFloat(*AudioConfigSection, *MasterVolumeKey, MasterVolumeSlider->GetValue(), GGameUserSettingsIni);
-	}
-	if (MusicVolumeSlider)
+	// Commit the previewed volumes -- closing the menu is a safe point, so the save flushes
+	UGameInstance* GI = UGameplayStatics::GetGameInstance(this);
+	if (UAudioSettingsSubsystem* AudioSettings = GI ? GI->GetSubsystem<UAudioSettingsSubsystem>() : nullptr)
 	{
-		GConfig->SetFloat(*AudioConfigSection, *MusicVolumeKey, MusicVolumeSlider->GetValue(), GGameUserSettingsIni);
+		AudioSettings->CommitVolumes();
 	}
-	if (SFXVolumeSlider)
+
+	// Display settings are already in the record; write them now too (no-op if nothing changed)
+	if (UArcadeSaveSubsystem* Saves = UArcadeSaveSubsystem::Get(this))
 	{
-		GConfig->SetFloat(*AudioConfigSection, *SFXVolumeKey, SFXVolumeSlider->GetValue(), GGameUserSettingsIni);
+		Saves->Flush();
 	}
 
-	GConfig->Flush(false, GGameUserSettingsIni);
-
 	// Graphics settings are saved automatically by UGameUserSettings
 	UGameUserSettings* Settings = GEngine->GetGameUserSettings();
 	if (Settings)
@@ -626,7 +790,7 @@ void USettingsMenuWidget::SetMasterVolume(float Volume)
 	{
 		MasterVolumeSlider->SetValue(Volume);
 	}
-	ApplyVolumeToSoundClass(MasterSoundClass, Volume);
+	PreviewVolume(EAudioVolumeChannel::Master, Volume);
 	UpdateVolumeDisplay(MasterVolumeValue, Volume);
 }
 
@@ -637,7 +801,7 @@ void USettingsMenuWidget::SetMusicVolume(float Volume)
 	{
 		MusicVolumeSlider->SetValue(Volume);
 	}
-	ApplyVolumeToSoundClass(MusicSoundClass, Volume);
+	PreviewVolume(EAudioVolumeChannel::Music, Volume);
 	UpdateVolumeDisplay(MusicVolumeValue, Volume);
 }
 
@@ -648,7 +812,7 @@ void USettingsMenuWidget::SetSFXVolume(float Volume)
 	{
 		SFXVolumeSlider->SetValue(Volume);
 	}
-	ApplyVolumeToSoundClass(SFXSoundClass, Volume);
+	PreviewVolume(EAudioVolumeChannel::SFX, Volume);
 	UpdateVolumeDisplay(SFXVolumeValue, Volume);
 }
 
@@ -658,23 +822,21 @@ void USettingsMenuWidget::SetSFXVolume(float Volume)
 
 void USettingsMenuWidget::OnMasterVolumeChanged(float Value)
 {
-	UE_LOG(LogStateRunner_Arcade, Log, TEXT("SettingsMenuWidget: OnMasterVolumeChanged - Value: %f"), Value);
-	ApplyVolumeToSoundClass(MasterSoundClass, Value);
+	PreviewVolume(EAudioVolumeChannel::Master, Value);
 	UpdateVolumeDisplay(MasterVolumeValue, Value);
 	OnSettingChanged(INDEX_MASTER_VOLUME);
 }
 
 void USettingsMenuWidget::OnMusicVolumeChanged(float Value)
 {
-	UE_LOG(LogStateRunner_Arcade, Log, TEXT("SettingsMenuWidget: OnMusicVolumeChanged - Value: %f"), Value);
-	ApplyVolumeToSoundClass(MusicSoundClass, Value);
+	PreviewVolume(EAudioVolumeChannel::Music, Value);
 	UpdateVolumeDisplay(MusicVolumeValue, Value);
 	OnSettingChanged(INDEX_MUSIC_VOLUME);
 }
 
 void USettingsMenuWidget::OnSFXVolumeChanged(float Value)
 {
-	ApplyVolumeToSoundClass(SFXSoundClass, Value);
+	PreviewVolume(EAudioVolumeChannel::SFX, Value);
 	UpdateVolumeDisplay(SFXVolumeValue, Value);
 	OnSettingChanged(INDEX_SFX_VOLUME);
 }
@@ -703,6 +865,38 @@ void USettingsMenuWidget::OnFullscreenClicked()
 	CycleFullscreenMode(1);
 }
 
+void USettingsMenuWidget::OnHardwareTierClicked()
+{
+	// Mouse click cycles forward through hardware tiers
+	CycleHardwareTier(1);
+}
+
+void USettingsMenuWidget::OnPerformanceGovernorClicked()
+{
+	// Mouse click cycles forward through governor presets
+	CyclePerformanceGovernor(1);
+}
+
+void USettingsMenuWidget::OnFrameRateLimitClicked()
+{
+	CycleFrameRateLimit(1);
+}
+
+void USettingsMenuWidget::OnVSyncClicked()
+{
+	ToggleVSync();
+}
+
+void USettingsMenuWidget::OnLowLatencyClicked()
+{
+	ToggleLowLatency();
+}
+
+void USettingsMenuWidget::OnSimulationRateClicked()
+{
+	CycleSimulationRate(1);
+}
+
 //=============================================================================
 // OVERRIDES
 //=============================================================================
@@ -720,6 +914,24 @@ void USettingsMenuWidget::OnSelectorOptionChanged_Implementation(int32 ItemIndex
 	case INDEX_FULLSCREEN:
 		CycleFullscreenMode(Delta);
 		break;
+	case INDEX_HARDWARE_TIER:
+		CycleHardwareTier(Delta);
+		break;
+	case INDEX_PERFORMANCE_GOVERNOR:
+		CyclePerformanceGovernor(Delta);
+		break;
+	case INDEX_FRAME_RATE_LIMIT:
+		CycleFrameRateLimit(Delta);
+		break;
+	case INDEX_VSYNC:
+		ToggleVSync();
+		break;
+	case INDEX_LOW_LATENCY:
+		ToggleLowLatency();
+		break;
+	case INDEX_SIMULATION_RATE:
+		CycleSimulationRate(Delta);
+		break;
 	}
 }
 
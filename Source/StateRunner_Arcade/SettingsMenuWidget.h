@@ -7,8 +7,7 @@
 class UButton;
 class USlider;
 class UTextBlock;
-class USoundMix;
-class USoundClass;
+enum class EAudioVolumeChannel : uint8;
 
 /**
  * Graphics quality preset options for StateRunner settings.
@@ -44,6 +43,15 @@ enum class EFullscreenSetting : uint8
  * - Quality Preset: Low/Medium/High/Epic/Cinematic (cycles with Left/Right)
  * - Resolution: 720p/1080p/1440p/4K (cycles with Left/Right)
  * - Fullscreen Mode: Fullscreen/Windowed Fullscreen/Windowed (cycles with Left/Right)
+ * - Hardware Tier: Low/Standard/High memory budget (read-only when locked by config)
+ * - Performance Governor: Off/Quality/Balanced/Performance (quality scaling under OVERCLOCK)
+ *
+ * DISPLAY SETTINGS (see UDisplaySettingsSubsystem, saved in the ArcadeSave record):
+ * - Frame Rate Limit: 60/120/144 Hz/Uncapped
+ * - VSync: On/Off
+ * - Low Latency: On/Off
+ * - Simulation Rate: Default/60/120/240 Hz (from the next run)
+ * - Frame stats: live frame rate, frame time, game thread and GPU time
  * 
  * AUDIO SETTINGS:
  * - Master Volume: 0-100% slider
@@ -73,6 +81,7 @@ protected:
 
 	virtual void NativeConstruct() override;
 	virtual void NativeDestruct() override;
+	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
 
 	//=============================================================================
 	// GRAPHICS WIDGETS
@@ -92,6 +101,14 @@ protected:
 	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Graphics")
 	TObjectPtr<UTextBlock> FullscreenValue;
 
+	/** Hardware tier selector - displays current tier (see UHardwareTierSubsystem) */
+	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Graphics")
+	TObjectPtr<UTextBlock> HardwareTierValue;
+
+	/** Performance governor selector - displays current preset (see UPerformanceGovernorComponent) */
+	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Graphics")
+	TObjectPtr<UTextBlock> PerformanceGovernorValue;
+
 	/** Invisible buttons used as focusable anchors for selectors */
 	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Graphics")
 	TObjectPtr<UButton> QualityPresetButton;
@@ -102,6 +119,54 @@ protected:
 	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Graphics")
 	TObjectPtr<UButton> FullscreenButton;
 
+	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Graphics")
+	TObjectPtr<UButton> HardwareTierButton;
+
+	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Graphics")
+	TObjectPtr<UButton> PerformanceGovernorButton;
+
+	//=============================================================================
+	// DISPLAY WIDGETS
+	//=============================================================================
+
+protected:
+
+	/** Frame rate limit selector - displays current cap */
+	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Display")
+	TObjectPtr<UTextBlock> FrameRateLimitValue;
+
+	/** VSync selector - displays On/Off */
+	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Display")
+	TObjectPtr<UTextBlock> VSyncValue;
+
+	/** Low latency selector - displays On/Off */
+	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Display")
+	TObjectPtr<UTextBlock> LowLatencyValue;
+
+	/** Simulation rate selector - displays current fixed step rate */
+	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Display")
+	TObjectPtr<UTextBlock> SimulationRateValue;
+
+	/** Live frame stats readout (not focusable) */
+	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Display")
+	TObjectPtr<UTextBlock> FrameStatsText;
+
+	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Display")
+	TObjectPtr<UButton> FrameRateLimitButton;
+
+	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Display")
+	TObjectPtr<UButton> VSyncButton;
+
+	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Display")
+	TObjectPtr<UButton> LowLatencyButton;
+
+	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Display")
+	TObjectPtr<UButton> SimulationRateButton;
+
+	/** Seconds between FrameStatsText refreshes */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Display", meta=(ClampMin="0.05"))
+	float FrameStatsRefreshInterval = 0.25f;
+
 	//=============================================================================
 	// AUDIO WIDGETS
 	//=============================================================================
@@ -158,6 +223,24 @@ protected:
 	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Labels")
 	TObjectPtr<UTextBlock> FullscreenLabel;
 
+	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Labels")
+	TObjectPtr<UTextBlock> HardwareTierLabel;
+
+	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Labels")
+	TObjectPtr<UTextBlock> PerformanceGovernorLabel;
+
+	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Labels")
+	TObjectPtr<UTextBlock> FrameRateLimitLabel;
+
+	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Labels")
+	TObjectPtr<UTextBlock> VSyncLabel;
+
+	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Labels")
+	TObjectPtr<UTextBlock> LowLatencyLabel;
+
+	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Labels")
+	TObjectPtr<UTextBlock> SimulationRateLabel;
+
 	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Labels")
 	TObjectPtr<UTextBlock> MasterVolumeLabel;
 
@@ -183,39 +266,13 @@ public:
 	static const int32 INDEX_QUALITY_PRESET = 3;
 	static const int32 INDEX_RESOLUTION = 4;
 	static const int32 INDEX_FULLSCREEN = 5;
-	static const int32 INDEX_BACK = 6;
-
-	//=============================================================================
-	// AUDIO CONFIGURATION
-	//=============================================================================
-
-protected:
-
-	/**
-	 * Sound Mix asset for volume control.
-	 * Create this in Editor: Right-click → Sounds → Sound Mix
-	 */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Audio Config")
-	TObjectPtr<USoundMix> VolumeSoundMix;
-
-	/**
-	 * Sound Class for master volume.
-	 * This should be the root sound class that all others inherit from.
-	 */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Audio Config")
-	TObjectPtr<USoundClass> MasterSoundClass;
-
-	/**
-	 * Sound Class for music.
-	 */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Audio Config")
-	TObjectPtr<USoundClass> MusicSoundClass;
-
-	/**
-	 * Sound Class for SFX.
-	 */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Audio Config")
-	TObjectPtr<USoundClass> SFXSoundClass;
+	static const int32 INDEX_HARDWARE_TIER = 6;
+	static const int32 INDEX_PERFORMANCE_GOVERNOR = 7;
+	static const int32 INDEX_FRAME_RATE_LIMIT = 8;
+	static const int32 INDEX_VSYNC = 9;
+	static const int32 INDEX_LOW_LATENCY = 10;
+	static const int32 INDEX_SIMULATION_RATE = 11;
+	static const int32 INDEX_BACK = 12;
 
 	//=============================================================================
 	// RUNTIME STATE
@@ -245,6 +302,10 @@ protected:
 	/** Fullscreen mode names for display */
 	TArray<FString> FullscreenModeNames;
 
+	/** Frame time accumulated since FrameStatsText was last refreshed */
+	float FrameStatsAccumulatedSeconds = 0.0f;
+	int32 FrameStatsFrameCount = 0;
+
 	//=============================================================================
 	// PUBLIC FUNCTIONS
 	//=============================================================================
@@ -336,9 +397,6 @@ protected:
 	/** Initialize quality preset names */
 	void InitializePresetNames();
 
-	/** Load audio assets programmatically (ensures consistency with AudioSettingsSubsystem) */
-	void LoadAudioAssets();
-
 	/** Update display text for quality preset */
 	void UpdateQualityPresetDisplay();
 
@@ -348,6 +406,18 @@ protected:
 	/** Update display text for fullscreen mode */
 	void UpdateFullscreenDisplay();
 
+	/** Update display text for hardware tier */
+	void UpdateHardwareTierDisplay();
+
+	/** Update display text for performance governor preset */
+	void UpdatePerformanceGovernorDisplay();
+
+	/** Update display text for the frame rate limit, VSync, low latency and simulation rate */
+	void UpdateDisplaySettingsDisplay();
+
+	/** Refresh the live frame stats readout */
+	void UpdateFrameStatsDisplay();
+
 	/** Update display text for volume slider */
 	void UpdateVolumeDisplay(UTextBlock* ValueText, float Volume);
 
@@ -360,8 +430,26 @@ protected:
 	/** Cycle fullscreen mode (direction: -1 = previous, +1 = next) */
 	void CycleFullscreenMode(int32 Direction);
 
-	/** Apply volume to a sound class via the sound mix */
-	void ApplyVolumeToSoundClass(USoundClass* SoundClass, float Volume);
+	/** Cycle hardware tier (direction: -1 = previous, +1 = next); no-op while locked */
+	void CycleHardwareTier(int32 Direction);
+
+	/** Cycle performance governor preset (direction: -1 = previous, +1 = next); applies to a run in progress */
+	void CyclePerformanceGovernor(int32 Direction);
+
+	/** Cycle frame rate limit (direction: -1 = previous, +1 = next) */
+	void CycleFrameRateLimit(int32 Direction);
+
+	/** Toggle VSync (either direction flips it) */
+	void ToggleVSync();
+
+	/** Toggle low latency mode (either direction flips it) */
+	void ToggleLowLatency();
+
+	/** Cycle simulation rate (direction: -1 = previous, +1 = next); applies from the next run */
+	void CycleSimulationRate(int32 Direction);
+
+	/** Preview a slider value through AudioSettingsSubsystem (applied next frame, saved on close) */
+	void PreviewVolume(EAudioVolumeChannel Channel, float Volume);
 
 	//=============================================================================
 	// SLIDER CALLBACKS
@@ -395,6 +483,30 @@ protected:
 	UFUNCTION()
 	void OnFullscreenClicked();
 
+	/** Called when Hardware Tier selector is clicked (cycles forward) */
+	UFUNCTION()
+	void OnHardwareTierClicked();
+
+	/** Called when Performance Governor selector is clicked (cycles forward) */
+	UFUNCTION()
+	void OnPerformanceGovernorClicked();
+
+	/** Called when Frame Rate Limit selector is clicked (cycles forward) */
+	UFUNCTION()
+	void OnFrameRateLimitClicked();
+
+	/** Called when VSync selector is clicked (toggles) */
+	UFUNCTION()
+	void OnVSyncClicked();
+
+	/** Called when Low Latency selector is clicked (toggles) */
+	UFUNCTION()
+	void OnLowLatencyClicked();
+
+	/** Called when Simulation Rate selector is clicked (cycles forward) */
+	UFUNCTION()
+	void OnSimulationRateClicked();
+
 	//=============================================================================
 	// OVERRIDES
 	//=============================================================================
@@ -0,0 +1,320 @@
+#include "ShaderPrecacheComponent.h"
+#include "StateRunner_ArcadeGameMode.h"
+#include "ObstacleSpawnerComponent.h"
+#include "PickupSpawnerComponent.h"
+#include "BaseObstacle.h"
+#include "BasePickup.h"
+#include "SpawnTypeTraits.h"
+#include "ThemeSubsystem.h"
+#include "ThemeDataAsset.h"
+#include "HardwareTierSubsystem.h"
+#include "Components/StaticMeshComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/GameInstance.h"
+#include "Materials/MaterialInterface.h"
+#include "PSOPrecache.h"
+#include "HAL/PlatformTime.h"
+#include "StateRunner_Arcade.h"
+
+UShaderPrecacheComponent::UShaderPrecacheComponent()
+{
+	// Ticks only while a pass is running; not gameplay, so a pause doesn't hold it up
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+	PrimaryComponentTick.bTickEvenWhenPaused = true;
+}
+
+void UShaderPrecacheComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (bPrecacheOnBeginPlay)
+	{
+		StartPrecache();
+	}
+}
+
+void UShaderPrecacheComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	for (UStaticMeshComponent* Component : PrecacheComponents)
+	{
+		if (Component)
+		{
+			Component->DestroyComponent();
+		}
+	}
+	PrecacheComponents.Empty();
+	Entries.Empty();
+	bPrecaching = false;
+
+	Super::EndPlay(EndPlayReason);
+}
+
+// --- Public Functions ---
+
+void UShaderPrecacheComponent::StartPrecache()
+{
+	if (bPrecaching)
+	{
+		return;
+	}
+
+	GatherEntries();
+	if (Entries.Num() == 0)
+	{
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("ShaderPrecacheComponent: Nothing to precache"));
+		OnPrecacheComplete.Broadcast();
+		return;
+	}
+
+	NextEntry = 0;
+	bPrecaching = true;
+	PrecacheStartTime = FPlatformTime::Seconds();
+	SetComponentTickEnabled(true);
+
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("ShaderPrecacheComponent: Precaching %d mesh/material combinations"), Entries.Num());
+}
+
+void UShaderPrecacheComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	if (!bPrecaching)
+	{
+		SetComponentTickEnabled(false);
+		return;
+	}
+
+	// Registration does the (game thread) PSO request work, so spread it across frames
+	const double BudgetEnd = FPlatformTime::Seconds() + PrecacheFrameBudgetMs / 1000.0;
+	while (Entries.IsValidIndex(NextEntry))
+	{
+		RegisterEntry(Entries[NextEntry++]);
+		if (FPlatformTime::Seconds() >= BudgetEnd)
+		{
+			break;
+		}
+	}
+
+	if (Entries.IsValidIndex(NextEntry))
+	{
+		return;
+	}
+
+	// Everything registered -- wait out the compiles running in the background
+	const bool bTimedOut = (FPlatformTime::Seconds() - PrecacheStartTime) >= PrecacheTimeoutSeconds;
+	if (bTimedOut || !HasOutstandingCompiles())
+	{
+		FinishPrecache(bTimedOut);
+	}
+}
+
+// --- Internal Functions ---
+
+void UShaderPrecacheComponent::GatherEntries()
+{
+	Entries.Reset();
+
+	const AStateRunner_ArcadeGameMode* GameMode = Cast<AStateRunner_ArcadeGameMode>(GetOwner());
+	if (!GameMode)
+	{
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("ShaderPrecacheComponent: Owner is not the StateRunner game mode"));
+		return;
+	}
+
+	// Obstacles: default mesh + every variant the tier uses, per type (instance batches use their own vertex factory)
+	if (const UObstacleSpawnerComponent* ObstacleSpawner = GameMode->GetObstacleSpawnerComponent())
+	{
+		const bool bInstanced = ObstacleSpawner->IsUsingInstancedRendering();
+		const UHardwareTierSubsystem* HardwareTier = UHardwareTierSubsystem::Get(this);
+		const int32 MeshVariantCap = HardwareTier ? HardwareTier->GetProfile().MaxMeshVariants : 0;
+		for (EObstacleType Type : AllObstacleTypes)
+		{
+			const TSubclassOf<ABaseObstacle> ObstacleClass = ObstacleSpawner->GetClassForType(Type);
+			const ABaseObstacle* Defaults = ObstacleClass ? ObstacleClass->GetDefaultObject<ABaseObstacle>() : nullptr;
+			if (!Defaults)
+			{
+				continue;
+			}
+
+			const TArray<FMeshVariantData>& Variants = Defaults->GetMeshVariants();
+			const int32 VariantCount = UHardwareTierSubsystem::ApplyCap(Variants.Num(), MeshVariantCap);
+
+			TArray<UStaticMesh*> VariantMeshes;
+			for (int32 i = 0; i < VariantCount; i++)
+			{
+				VariantMeshes.Add(Variants[i].Mesh);
+			}
+			AddMeshes(Defaults->GetObstacleMesh(), VariantMeshes, bInstanced);
+		}
+	}
+
+	// Pickups: every type, including the rare ones (first EMP / Magnet) that otherwise hitch mid-run
+	if (const UPickupSpawnerComponent* PickupSpawner = GameMode->GetPickupSpawnerComponent())
+	{
+		for (EPickupType Type : AllPickupTypes)
+		{
+			const TSubclassOf<ABasePickup> PickupClass = PickupSpawner->GetClassForType(Type);
+			const ABasePickup* Defaults = PickupClass ? PickupClass->GetDefaultObject<ABasePickup>() : nullptr;
+			if (!Defaults)
+			{
+				continue;
+			}
+
+			TArray<UStaticMesh*> VariantMeshes;
+			for (const FPickupMeshVariantData& Variant : Defaults->GetMeshVariants())
+			{
+				VariantMeshes.Add(Variant.Mesh);
+			}
+			AddMeshes(Defaults->GetPickupMesh(), VariantMeshes, false);
+		}
+	}
+
+	// Theme: per-mesh mode swaps the laser slots to the theme's own material. Circuit colors are
+	// instance parameters (same shaders), and collection mode changes no materials at all.
+	const UGameInstance* GameInstance = GetWorld() ? GetWorld()->GetGameInstance() : nullptr;
+	const UThemeSubsystem* ThemeSubsystem = GameInstance ? GameInstance->GetSubsystem<UThemeSubsystem>() : nullptr;
+	if (ThemeSubsystem && !ThemeSubsystem->IsUsingParameterCollection() && Entries.Num() > 0)
+	{
+		const UThemeDataAsset* ThemeData = ThemeSubsystem->GetCurrentThemeData();
+		if (ThemeData && ThemeData->LaserPointerMaterial)
+		{
+			// Any local-vertex-factory mesh will do; the material is what needs compiling
+			UStaticMesh* CarrierMesh = nullptr;
+			for (const FShaderPrecacheEntry& Entry : Entries)
+			{
+				if (!Entry.bInstanced)
+				{
+					CarrierMesh = Entry.Mesh;
+					break;
+				}
+			}
+
+			if (CarrierMesh)
+			{
+				TArray<TObjectPtr<UMaterialInterface>> LaserMaterials;
+				LaserMaterials.Init(ThemeData->LaserPointerMaterial, FMath::Max(CarrierMesh->GetStaticMaterials().Num(), 1));
+				AddEntry(CarrierMesh, LaserMaterials, false);
+			}
+		}
+	}
+}
+
+void UShaderPrecacheComponent::AddMeshes(const UStaticMeshComponent* DefaultComponent, const TArray<UStaticMesh*>& VariantMeshes, bool bInstanced)
+{
+	// Instance batches draw the mesh's own materials; pooled actors keep the Blueprint overrides
+	static const TArray<TObjectPtr<UMaterialInterface>> NoOverrides;
+	const TArray<TObjectPtr<UMaterialInterface>>& Overrides = (DefaultComponent && !bInstanced) ? DefaultComponent->OverrideMaterials : NoOverrides;
+
+	if (DefaultComponent)
+	{
+		AddEntry(DefaultComponent->GetStaticMesh(), Overrides, bInstanced);
+	}
+	for (UStaticMesh* Mesh : VariantMeshes)
+	{
+		AddEntry(Mesh, Overrides, bInstanced);
+	}
+}
+
+void UShaderPrecacheComponent::AddEntry(UStaticMesh* Mesh, const TArray<TObjectPtr<UMaterialInterface>>& Materials, bool bInstanced)
+{
+	if (!Mesh)
+	{
+		return;
+	}
+
+	const bool bDuplicate = Entries.ContainsByPredicate([Mesh, &Materials, bInstanced](const FShaderPrecacheEntry& Entry)
+	{
+		return Entry.Mesh == Mesh && Entry.bInstanced == bInstanced && Entry.Materials == Materials;
+	});
+	if (bDuplicate)
+	{
+		return;
+	}
+
+	FShaderPrecacheEntry& Entry = Entries.AddDefaulted_GetRef();
+	Entry.Mesh = Mesh;
+	Entry.Materials = Materials;
+	Entry.bInstanced = bInstanced;
+}
+
+void UShaderPrecacheComponent::RegisterEntry(const FShaderPrecacheEntry& Entry)
+{
+	AActor* Owner = GetOwner();
+	if (!Owner || !Entry.Mesh)
+	{
+		return;
+	}
+
+	UStaticMeshComponent* Component = nullptr;
+	if (Entry.bInstanced)
+	{
+		UInstancedStaticMeshComponent* ISM = NewObject<UInstancedStaticMeshComponent>(Owner);
+		ISM->AddInstance(FTransform::Identity);
+		Component = ISM;
+	}
+	else
+	{
+		Component = NewObject<UStaticMeshComponent>(Owner);
+	}
+
+	Component->SetStaticMesh(Entry.Mesh);
+	for (int32 Slot = 0; Slot < Entry.Materials.Num(); Slot++)
+	{
+		if (Entry.Materials[Slot])
+		{
+			Component->SetMaterial(Slot, Entry.Materials[Slot]);
+		}
+	}
+
+	Component->SetMobility(EComponentMobility::Movable);
+	Component->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Component->SetCastShadow(false);
+	Component->SetWorldLocation(PrecacheLocation);
+
+	// Registration requests the PSOs for every material/vertex factory/pass on this primitive
+	Component->RegisterComponent();
+	PrecacheComponents.Add(Component);
+}
+
+bool UShaderPrecacheComponent::HasOutstandingCompiles() const
+{
+#if UE_WITH_PSO_PRECACHING
+	for (const UStaticMeshComponent* Component : PrecacheComponents)
+	{
+		if (Component && Component->IsPSOPrecaching())
+		{
+			return true;
+		}
+	}
+#endif
+	return false;
+}
+
+void UShaderPrecacheComponent::FinishPrecache(bool bTimedOut)
+{
+	for (UStaticMeshComponent* Component : PrecacheComponents)
+	{
+		if (Component)
+		{
+			Component->DestroyComponent();
+		}
+	}
+	PrecacheComponents.Empty();
+
+	bPrecaching = false;
+	SetComponentTickEnabled(false);
+
+	const double ElapsedMs = (FPlatformTime::Seconds() - PrecacheStartTime) * 1000.0;
+	if (bTimedOut)
+	{
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("ShaderPrecacheComponent: Timed out after %.0f ms with compiles still in flight"), ElapsedMs);
+	}
+	else
+	{
+		UE_LOG(LogStateRunner_Arcade, Log, TEXT("ShaderPrecacheComponent: %d combinations precached in %.0f ms"), Entries.Num(), ElapsedMs);
+	}
+
+	OnPrecacheComplete.Broadcast();
+}
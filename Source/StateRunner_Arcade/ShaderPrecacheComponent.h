@@ -0,0 +1,146 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "ShaderPrecacheComponent.generated.h"
+
+class UStaticMesh;
+class UStaticMeshComponent;
+class UMaterialInterface;
+
+/** Broadcast once every precache primitive has finished compiling (or timed out) */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnShaderPrecacheComplete);
+
+/**
+ * One mesh/material combination to get compiled before the run.
+ */
+struct FShaderPrecacheEntry
+{
+	TObjectPtr<UStaticMesh> Mesh = nullptr;
+
+	/** Per-slot overrides (null = the mesh's own material) */
+	TArray<TObjectPtr<UMaterialInterface>> Materials;
+
+	/** Drawn through an instance batch (different vertex factory) */
+	bool bInstanced = false;
+};
+
+/**
+ * Shader Precache Component
+ *
+ * Gets every pipeline the run will need compiled during the countdown/intro instead of the
+ * first time something shows up on screen (first mesh variant of a type, first EMP or
+ * Magnet pickup, the theme's laser material).
+ *
+ * At BeginPlay it gathers every obstacle mesh variant and pickup mesh from the spawners'
+ * classes (with their Blueprint material overrides), plus the current theme's laser material
+ * in per-mesh theme mode. Those are registered a few per frame as primitives parked far below
+ * the track, where they're never drawn. Registering a primitive kicks off engine PSO
+ * precaching for its material/vertex factory combinations; the component waits for those
+ * compiles (or PrecacheTimeoutSeconds) and then destroys the primitives.
+ *
+ * The countdown Blueprint can hold on IsPrecaching / OnPrecacheComplete if wanted.
+ * Attached to GameMode.
+ */
+UCLASS(ClassGroup=(StateRunner), meta=(BlueprintSpawnableComponent))
+class STATERUNNER_ARCADE_API UShaderPrecacheComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+
+	UShaderPrecacheComponent();
+
+protected:
+
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+public:
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	// --- Configuration ---
+
+protected:
+
+	/** Run the precache pass at BeginPlay */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Precache")
+	bool bPrecacheOnBeginPlay = true;
+
+	/** Game-thread time per frame spent registering precache primitives */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Precache", meta=(ClampMin="0.1", ClampMax="8.0"))
+	float PrecacheFrameBudgetMs = 1.0f;
+
+	/** Give up waiting on outstanding compiles after this long (real seconds) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Precache", meta=(ClampMin="1.0"))
+	float PrecacheTimeoutSeconds = 10.0f;
+
+	/** Where precache primitives are parked (below the track, never in view) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Precache")
+	FVector PrecacheLocation = FVector(0.0f, 0.0f, -100000.0f);
+
+	// --- Events ---
+
+public:
+
+	UPROPERTY(BlueprintAssignable, Category="Events")
+	FOnShaderPrecacheComplete OnPrecacheComplete;
+
+	// --- Public Functions ---
+
+public:
+
+	/** Gather and start precaching (no-op if a pass is already running) */
+	UFUNCTION(BlueprintCallable, Category="Precache")
+	void StartPrecache();
+
+	/** True while precache primitives are registering or compiling */
+	UFUNCTION(BlueprintPure, Category="Precache")
+	bool IsPrecaching() const { return bPrecaching; }
+
+	/** Number of mesh/material combinations the last pass covered */
+	UFUNCTION(BlueprintPure, Category="Precache")
+	int32 GetPrecacheEntryCount() const { return Entries.Num(); }
+
+	// --- Internal State ---
+
+protected:
+
+	/** Everything this pass registers */
+	TArray<FShaderPrecacheEntry> Entries;
+
+	/** Next entry to register */
+	int32 NextEntry = 0;
+
+	/** Registered precache primitives, destroyed when the pass ends */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UStaticMeshComponent>> PrecacheComponents;
+
+	bool bPrecaching = false;
+
+	/** FPlatformTime::Seconds() when the pass started */
+	double PrecacheStartTime = 0.0;
+
+	// --- Internal Functions ---
+
+protected:
+
+	/** Build Entries from the spawners and the theme subsystem */
+	void GatherEntries();
+
+	/** Add one mesh (and its overrides), skipping duplicates */
+	void AddEntry(UStaticMesh* Mesh, const TArray<TObjectPtr<UMaterialInterface>>& Materials, bool bInstanced);
+
+	/** Add a class default mesh component's mesh and every variant mesh with its overrides */
+	void AddMeshes(const UStaticMeshComponent* DefaultComponent, const TArray<UStaticMesh*>& VariantMeshes, bool bInstanced);
+
+	/** Register one entry as a parked primitive */
+	void RegisterEntry(const FShaderPrecacheEntry& Entry);
+
+	/** True while any registered primitive still has compiles in flight */
+	bool HasOutstandingCompiles() const;
+
+	/** Destroy the primitives and broadcast completion */
+	void FinishPrecache(bool bTimedOut);
+};
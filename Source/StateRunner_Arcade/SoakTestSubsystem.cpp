@@ -0,0 +1,261 @@
+#include "SoakTestSubsystem.h"
+#include "StateRunner_Arcade.h"
+#include "BaseObstacle.h"
+#include "BasePickup.h"
+#include "Components/AudioComponent.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformMisc.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectIterator.h"
+
+/**
+ * Sampled metrics, in CSV column order: one LLM tag per EStateRunnerMemoryTag, then the
+ * object counts, then process memory.
+ * Prefixed to avoid Unity build collisions.
+ */
+static const TCHAR* const SoakTest_MetricNames[] =
+{
+	TEXT("ThemeBytes"),
+	TEXT("MusicBytes"),
+	TEXT("SFXBytes"),
+	TEXT("ObstaclePoolBytes"),
+	TEXT("PickupPoolBytes"),
+	TEXT("MaterialInstances"),
+	TEXT("AudioComponents"),
+	TEXT("Obstacles"),
+	TEXT("Pickups"),
+	TEXT("UObjects"),
+	TEXT("ProcessBytes")
+};
+
+static constexpr int32 SoakTest_NumMetrics = UE_ARRAY_COUNT(SoakTest_MetricNames);
+static constexpr int32 SoakTest_NumTagMetrics = static_cast<int32>(EStateRunnerMemoryTag::Count);
+static constexpr int32 SoakTest_ProcessMetric = SoakTest_NumMetrics - 1;
+
+/** LLM tag names, in EStateRunnerMemoryTag order */
+static const TCHAR* const SoakTest_TagNames[] =
+{
+	TEXT("StateRunner/Theme"),
+	TEXT("StateRunner/Music"),
+	TEXT("StateRunner/SFX"),
+	TEXT("StateRunner/ObstaclePool"),
+	TEXT("StateRunner/PickupPool")
+};
+
+static_assert(UE_ARRAY_COUNT(SoakTest_TagNames) == SoakTest_NumTagMetrics, "One LLM tag name per EStateRunnerMemoryTag");
+
+/** Live objects of a class (CDOs and archetypes aren't leaks) */
+template<typename T>
+static int64 SoakTest_CountObjects()
+{
+	int64 Count = 0;
+	for (TObjectIterator<T> It; It; ++It)
+	{
+		if (!It->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+		{
+			Count++;
+		}
+	}
+	return Count;
+}
+
+// --- Subsystem Lifecycle ---
+
+USoakTestSubsystem* USoakTestSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<USoakTestSubsystem>() : nullptr;
+}
+
+// --- Public Functions ---
+
+void USoakTestSubsystem::BeginSoak(float Hours)
+{
+	if (bSoaking)
+	{
+		return;
+	}
+
+	if (Hours <= 0.0f)
+	{
+		Hours = DefaultSoakHours;
+		FParse::Value(FCommandLine::Get(), TEXT("SoakHours="), Hours);
+	}
+
+	bSoaking = true;
+	StartSeconds = FPlatformTime::Seconds();
+	DurationSeconds = FMath::Max(Hours, 0.0f) * 3600.0;
+	Samples.Reset();
+
+	CsvPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Profiling"), TEXT("Soak"),
+		FString::Printf(TEXT("Soak_%s.csv"), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S"))));
+
+	FString Header = TEXT("Run,Minutes");
+	for (const TCHAR* Name : SoakTest_MetricNames)
+	{
+		Header += TEXT(",");
+		Header += Name;
+	}
+	Header += TEXT("\n");
+	FFileHelper::SaveStringToFile(Header, *CsvPath);
+
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+	const bool bTagsTracked = FLowLevelMemTracker::IsEnabled();
+#else
+	const bool bTagsTracked = false;
+#endif
+
+	UE_LOG(LogStateRunner_Arcade, Display, TEXT("SoakTest: Started, %.1f h, CSV: %s%s"), Hours, *CsvPath,
+		bTagsTracked ? TEXT("") : TEXT(" (no -llm: per-system bytes read 0, object counts still checked)"));
+}
+
+void USoakTestSubsystem::RecordRunStart()
+{
+	if (!bSoaking)
+	{
+		return;
+	}
+
+	TArray<int64>& Values = Samples.AddDefaulted_GetRef();
+	TakeSample(Values);
+
+	const int32 Run = Samples.Num() - 1;
+	const double Minutes = (FPlatformTime::Seconds() - StartSeconds) / 60.0;
+
+	FString Row = FString::Printf(TEXT("%d,%.1f"), Run, Minutes);
+	FString Summary;
+	for (int32 i = 0; i < SoakTest_NumMetrics; i++)
+	{
+		Row += FString::Printf(TEXT(",%lld"), Values[i]);
+
+		// Bytes as KB in the log line; the CSV keeps them exact
+		const bool bBytes = i < SoakTest_NumTagMetrics || i == SoakTest_ProcessMetric;
+		Summary += FString::Printf(bBytes ? TEXT(" %s=%lldK") : TEXT(" %s=%lld"),
+			SoakTest_MetricNames[i], bBytes ? Values[i] / 1024 : Values[i]);
+	}
+	Row += TEXT("\n");
+	FFileHelper::SaveStringToFile(Row, *CsvPath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append);
+
+	UE_LOG(LogStateRunner_Arcade, Display, TEXT("SoakTest: Run %d at %.1f min:%s"), Run, Minutes, *Summary);
+
+	const int32 GrowingMetric = FindMonotonicGrowth();
+	if (GrowingMetric != INDEX_NONE)
+	{
+		FString History;
+		for (int32 i = Samples.Num() - GrowthWindow - 1; i < Samples.Num(); i++)
+		{
+			History += FString::Printf(TEXT(" %lld"), Samples[i][GrowingMetric]);
+		}
+
+		UE_LOG(LogStateRunner_Arcade, Error, TEXT("SoakTest: LEAK -- %s grew at each of the last %d restarts:%s"),
+			SoakTest_MetricNames[GrowingMetric], GrowthWindow, *History);
+		FinishSoak(1, FString::Printf(TEXT("%s kept growing"), SoakTest_MetricNames[GrowingMetric]));
+		return;
+	}
+
+	if (FPlatformTime::Seconds() - StartSeconds >= DurationSeconds)
+	{
+		FinishSoak(0, TEXT("time limit reached, no steady growth"));
+	}
+}
+
+// --- Internal Functions ---
+
+void USoakTestSubsystem::TakeSample(TArray<int64>& OutValues) const
+{
+	OutValues.SetNumZeroed(SoakTest_NumMetrics);
+
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+	if (FLowLevelMemTracker::IsEnabled())
+	{
+		for (int32 i = 0; i < SoakTest_NumTagMetrics; i++)
+		{
+			OutValues[i] = FLowLevelMemTracker::Get().GetTagAmountForTracker(ELLMTracker::Default, FName(SoakTest_TagNames[i]), ELLMTagSet::None);
+		}
+	}
+#endif
+
+	int32 Metric = SoakTest_NumTagMetrics;
+	OutValues[Metric++] = SoakTest_CountObjects<UMaterialInstanceDynamic>();
+	OutValues[Metric++] = SoakTest_CountObjects<UAudioComponent>();
+	OutValues[Metric++] = SoakTest_CountObjects<ABaseObstacle>();
+	OutValues[Metric++] = SoakTest_CountObjects<ABasePickup>();
+	OutValues[Metric++] = GUObjectArray.GetObjectArrayNumMinusAvailable();
+	OutValues[Metric++] = static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical);
+
+	check(Metric == SoakTest_NumMetrics);
+}
+
+int32 USoakTestSubsystem::FindMonotonicGrowth() const
+{
+	// Warm-up samples don't count, and the window needs GrowthWindow steps (so one more sample)
+	const int32 Window = FMath::Max(GrowthWindow, 2);
+	const int32 First = Samples.Num() - Window - 1;
+	if (First < WarmupRuns)
+	{
+		return INDEX_NONE;
+	}
+
+	for (int32 MetricIndex = 0; MetricIndex < SoakTest_NumMetrics; MetricIndex++)
+	{
+		bool bAlwaysGrew = true;
+		for (int32 i = First + 1; i < Samples.Num() && bAlwaysGrew; i++)
+		{
+			bAlwaysGrew = Samples[i][MetricIndex] > Samples[i - 1][MetricIndex];
+		}
+
+		// A handful of bytes or objects per restart is noise (log buffers, name table), not a leak
+		if (bAlwaysGrew && Samples.Last()[MetricIndex] - Samples[First][MetricIndex] >= GetGrowthThreshold(MetricIndex))
+		{
+			return MetricIndex;
+		}
+	}
+
+	return INDEX_NONE;
+}
+
+int64 USoakTestSubsystem::GetGrowthThreshold(int32 MetricIndex) const
+{
+	if (MetricIndex < SoakTest_NumTagMetrics)
+	{
+		return MinTagGrowthBytes;
+	}
+	if (MetricIndex == SoakTest_ProcessMetric)
+	{
+		return MinProcessGrowthBytes;
+	}
+	return MinObjectGrowth;
+}
+
+void USoakTestSubsystem::FinishSoak(int32 ExitCode, const FString& Reason)
+{
+	bSoaking = false;
+
+	const double Hours = (FPlatformTime::Seconds() - StartSeconds) / 3600.0;
+	if (ExitCode == 0)
+	{
+		UE_LOG(LogStateRunner_Arcade, Display, TEXT("SoakTest: PASSED after %d runs, %.2f h (%s), CSV: %s"), Samples.Num(), Hours, *Reason, *CsvPath);
+	}
+	else
+	{
+		UE_LOG(LogStateRunner_Arcade, Error, TEXT("SoakTest: FAILED after %d runs, %.2f h (%s), CSV: %s"), Samples.Num(), Hours, *Reason, *CsvPath);
+	}
+
+	// Exit code for the cabinet test harness; a normal quit always returns 0
+	FPlatformMisc::RequestExitWithStatus(false, static_cast<uint8>(ExitCode));
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "SoakTestSubsystem.generated.h"
+
+/**
+ * Soak Test Subsystem
+ *
+ * Long-run leak check for cabinets that stay up for days. The autopilot's Soak mode
+ * ("-Soak", optionally "-SoakHours=N") plays the gameplay level and restarts it over and
+ * over. At the start of every run, after the level transition has collected the previous
+ * world, this subsystem takes a sample of:
+ * - LLM bytes per StateRunner memory tag (Theme, Music, SFX, ObstaclePool, PickupPool),
+ *   when the game runs with -llm
+ * - live objects behind those tags (dynamic material instances, audio components,
+ *   obstacles, pickups) and all UObjects
+ * - process used physical memory
+ *
+ * Every sample is logged and appended to Saved/Profiling/Soak/Soak_<date>.csv. After
+ * WarmupRuns, a metric that grew at each of the last GrowthWindow restarts, by at least its
+ * threshold in total, fails the soak: the metric and its history are logged as errors and
+ * the process exits with code 1. Reaching the time limit exits with code 0.
+ *
+ * [/Script/StateRunner_Arcade.SoakTestSubsystem]
+ * GrowthWindow=12
+ */
+UCLASS(Config=Game)
+class STATERUNNER_ARCADE_API USoakTestSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Get the subsystem from a world context */
+	static USoakTestSubsystem* Get(const UObject* WorldContextObject);
+
+	// --- Configuration ---
+
+protected:
+
+	/** Soak length when -SoakHours isn't given */
+	UPROPERTY(Config)
+	float DefaultSoakHours = 8.0f;
+
+	/** Runs sampled but not checked (pools, shader and streaming caches still filling) */
+	UPROPERTY(Config)
+	int32 WarmupRuns = 3;
+
+	/** Consecutive restarts a metric has to grow across to count as a leak */
+	UPROPERTY(Config)
+	int32 GrowthWindow = 8;
+
+	/** Smallest total growth over the window that fails the soak, per LLM tag */
+	UPROPERTY(Config)
+	int64 MinTagGrowthBytes = 1024 * 1024;
+
+	/** Smallest total growth over the window that fails the soak, per object count */
+	UPROPERTY(Config)
+	int32 MinObjectGrowth = 16;
+
+	/** Smallest total growth over the window that fails the soak, process memory */
+	UPROPERTY(Config)
+	int64 MinProcessGrowthBytes = 64 * 1024 * 1024;
+
+	// --- Runtime State ---
+
+protected:
+
+	bool bSoaking = false;
+
+	/** FPlatformTime::Seconds when the soak started */
+	double StartSeconds = 0.0;
+
+	double DurationSeconds = 0.0;
+
+	/** One row of metric values per run, in SoakTest_Metrics order */
+	TArray<TArray<int64>> Samples;
+
+	FString CsvPath;
+
+	// --- Public Functions ---
+
+public:
+
+	/**
+	 * Start a soak session (no-op if one is running, so every restarted run can call it).
+	 *
+	 * @param Hours Session length; <= 0 uses -SoakHours or DefaultSoakHours
+	 */
+	void BeginSoak(float Hours = 0.0f);
+
+	bool IsSoaking() const { return bSoaking; }
+
+	/**
+	 * A soak run is starting: sample, log, append to the CSV and check for growth.
+	 * Exits the process on a leak (code 1) or when the time is up (code 0).
+	 */
+	void RecordRunStart();
+
+	// --- Internal Functions ---
+
+protected:
+
+	/** Current value of every metric */
+	void TakeSample(TArray<int64>& OutValues) const;
+
+	/** Index of the first metric that grew across the window, or INDEX_NONE */
+	int32 FindMonotonicGrowth() const;
+
+	/** Smallest window growth that counts for a metric */
+	int64 GetGrowthThreshold(int32 MetricIndex) const;
+
+	/** Close the session and exit the process */
+	void FinishSoak(int32 ExitCode, const FString& Reason);
+};
@@ -0,0 +1,132 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BasePickup.h" // EPickupType (and EObstacleType via BaseObstacle.h)
+
+/**
+ * Spawn Type Traits
+ *
+ * Compile-time tables of what each EObstacleType / EPickupType is, indexed by the enum value.
+ * Type-specific code reads a row (and sizes per-type arrays with the counts below) instead of
+ * switching on the type, so hot loops index rather than branch.
+ *
+ * Values a designer tunes -- collision extents, pool sizes, spacing amounts, Blueprint
+ * classes -- stay UPROPERTYs on their owning class. Those classes keep per-type member
+ * tables next to the code that reads them; the rows here only hold the fixed facts.
+ *
+ * ADDING A TYPE: add the enum value, bump the count, add a row to each table in this file,
+ * then add the new type's properties and an entry to each owner's member table. The
+ * static_asserts catch a count that doesn't match the enum.
+ */
+
+// --- Obstacles ---
+
+/** Number of EObstacleType values (per-type arrays are sized with this) */
+constexpr int32 NumObstacleTypes = 3;
+static_assert(static_cast<int32>(EObstacleType::FullWall) + 1 == NumObstacleTypes, "NumObstacleTypes out of date with EObstacleType");
+
+/** Every obstacle type, in enum order */
+constexpr EObstacleType AllObstacleTypes[NumObstacleTypes] =
+{
+	EObstacleType::LowWall,
+	EObstacleType::HighBarrier,
+	EObstacleType::FullWall
+};
+
+/**
+ * Extra same-lane spacing a type pair needs on top of MinObstacleSpacing.
+ * Names which UObstacleSpawnerComponent property holds the amount.
+ */
+enum class EObstacleSpacingExtra : uint8
+{
+	None,
+	SlideToJump,
+	JumpToSlide,
+	Count
+};
+
+struct FObstacleTypeTraits
+{
+	/** Name for logs and debug display */
+	const TCHAR* DebugName;
+
+	/** Collision debug draw colour */
+	FColor DebugColor;
+
+	/** Blocks its lane completely (only a lane change avoids it) -- counted by the open-lane rule */
+	bool bBlocksLane;
+};
+
+constexpr FObstacleTypeTraits ObstacleTypeTraits[NumObstacleTypes] =
+{
+	/* LowWall */		{ TEXT("LowWall (JUMP)"),		FColor(243, 156, 18),	false },
+	/* HighBarrier */	{ TEXT("HighBarrier (SLIDE)"),	FColor(169, 7, 228),	false },
+	/* FullWall */		{ TEXT("FullWall (DODGE)"),		FColor(255, 0, 0),		true }
+};
+
+/** Spacing matrix, [first type][second type] in the same lane */
+constexpr EObstacleSpacingExtra ObstacleSpacingExtras[NumObstacleTypes][NumObstacleTypes] =
+{
+	/* LowWall -> */		{ EObstacleSpacingExtra::None,			EObstacleSpacingExtra::JumpToSlide,	EObstacleSpacingExtra::None },
+	/* HighBarrier -> */	{ EObstacleSpacingExtra::SlideToJump,	EObstacleSpacingExtra::None,		EObstacleSpacingExtra::None },
+	/* FullWall -> */		{ EObstacleSpacingExtra::None,			EObstacleSpacingExtra::None,		EObstacleSpacingExtra::None }
+};
+
+FORCEINLINE const FObstacleTypeTraits& GetObstacleTypeTraits(EObstacleType Type)
+{
+	checkSlow(static_cast<int32>(Type) < NumObstacleTypes);
+	return ObstacleTypeTraits[static_cast<int32>(Type)];
+}
+
+// --- Pickups ---
+
+/** Number of EPickupType values (per-type arrays are sized with this) */
+constexpr int32 NumPickupTypes = 4;
+static_assert(static_cast<int32>(EPickupType::Magnet) + 1 == NumPickupTypes, "NumPickupTypes out of date with EPickupType");
+
+/** Every pickup type, in enum order */
+constexpr EPickupType AllPickupTypes[NumPickupTypes] =
+{
+	EPickupType::DataPacket,
+	EPickupType::OneUp,
+	EPickupType::EMP,
+	EPickupType::Magnet
+};
+
+struct FPickupTypeTraits
+{
+	/** Name for logs and debug display */
+	const TCHAR* DebugName;
+
+	/** Collision debug draw colour */
+	FColor DebugColor;
+
+	/** OVERCLOCK meter charges on collection (one UOverclockSystemComponent::AddPickupBonus each) */
+	int32 OverclockCharges;
+
+	/** Collection plays CollectionSound (the 1-Up plays its own bonus sound instead) */
+	bool bPlaysCollectionSound;
+
+	/** Rare power-up: at most one per segment, so the pool is kept one spare ahead of use */
+	bool bRare;
+
+	/** Blueprint class may be left unset (the type just never spawns) */
+	bool bOptionalClass;
+
+	/** Actors added per pool expansion (0 = UPickupSpawnerComponent::PoolExpansionSize) */
+	int32 PoolExpansionSize;
+};
+
+constexpr FPickupTypeTraits PickupTypeTraits[NumPickupTypes] =
+{
+	/* DataPacket */	{ TEXT("DataPacket"),	FColor(255, 255, 255),	1,	true,	false,	false,	0 },
+	/* OneUp */			{ TEXT("1-Up"),			FColor(255, 255, 0),	0,	false,	true,	false,	3 },
+	/* EMP */			{ TEXT("EMP"),			FColor(0, 255, 255),	3,	true,	true,	true,	2 },
+	/* Magnet */		{ TEXT("Magnet"),		FColor(255, 255, 255),	0,	true,	true,	true,	2 }
+};
+
+FORCEINLINE const FPickupTypeTraits& GetPickupTypeTraits(EPickupType Type)
+{
+	checkSlow(static_cast<int32>(Type) < NumPickupTypes);
+	return PickupTypeTraits[static_cast<int32>(Type)];
+}
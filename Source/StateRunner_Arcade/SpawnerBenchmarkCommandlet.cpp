@@ -0,0 +1,329 @@
+#include "SpawnerBenchmarkCommandlet.h"
+#include "StateRunner_ArcadeGameMode.h"
+#include "ObstacleSpawnerComponent.h"
+#include "DifficultyDirectorComponent.h"
+#include "HAL/MemoryBase.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/Parse.h"
+#include "UObject/Package.h"
+#include "StateRunner_Arcade.h"
+
+// --- Allocation Counting ---
+// Prefixed to avoid Unity build collisions
+
+/**
+ * Forwards everything to the real allocator, counting game-thread allocations.
+ * Installed over GMalloc only while layouts are generated; memory it hands out
+ * belongs to the inner allocator, so frees after it's removed are fine.
+ */
+class FSpawnerBenchmark_MallocCounter final : public FMalloc
+{
+public:
+
+	explicit FSpawnerBenchmark_MallocCounter(FMalloc* InInner) : Inner(InInner) {}
+
+	virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+	{
+		Record(Count);
+		return Inner->Malloc(Count, Alignment);
+	}
+
+	virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+	{
+		if (Count > 0)
+		{
+			Record(Count);
+		}
+		return Inner->Realloc(Original, Count, Alignment);
+	}
+
+	virtual void Free(void* Original) override { Inner->Free(Original); }
+	virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+	virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+	virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+	virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+	virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+	virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+	virtual const TCHAR* GetDescriptiveName() override { return Inner->GetDescriptiveName(); }
+
+	uint64 NumAllocations = 0;
+	uint64 NumBytes = 0;
+
+private:
+
+	void Record(SIZE_T Count)
+	{
+		// Layouts are generated on the game thread; other threads' traffic isn't ours
+		if (IsInGameThread())
+		{
+			NumAllocations++;
+			NumBytes += Count;
+		}
+	}
+
+	FMalloc* Inner;
+};
+
+/** Totals for one difficulty (or the whole run) */
+struct FSpawnerBenchmark_Result
+{
+	int32 Segments = 0;
+	int32 PatternSegments = 0;
+	int32 BreatherSegments = 0;
+	int64 Obstacles = 0;
+	int32 BlockedRows = 0;
+	int32 SpacingViolations = 0;
+	uint64 Allocations = 0;
+	uint64 AllocatedBytes = 0;
+	double Seconds = 0.0;
+
+	void Accumulate(const FSpawnerBenchmark_Result& Other)
+	{
+		Segments += Other.Segments;
+		PatternSegments += Other.PatternSegments;
+		BreatherSegments += Other.BreatherSegments;
+		Obstacles += Other.Obstacles;
+		BlockedRows += Other.BlockedRows;
+		SpacingViolations += Other.SpacingViolations;
+		Allocations += Other.Allocations;
+		AllocatedBytes += Other.AllocatedBytes;
+		Seconds += Other.Seconds;
+	}
+
+	FString ToString() const
+	{
+		const double SafeSegments = FMath::Max(Segments, 1);
+		return FString::Printf(TEXT("%9d segs  %6.1f%% pattern  %5.1f%% breather  %5.2f obst/seg  %10.0f segs/s  %6.2f allocs/seg  %8.1f B/seg  blocked %d  spacing %d"),
+			Segments,
+			100.0 * PatternSegments / SafeSegments,
+			100.0 * BreatherSegments / SafeSegments,
+			Obstacles / SafeSegments,
+			Seconds > 0.0 ? Segments / Seconds : 0.0,
+			Allocations / SafeSegments,
+			AllocatedBytes / SafeSegments,
+			BlockedRows,
+			SpacingViolations);
+	}
+};
+
+/** Failures printed in full per check before only being counted */
+static constexpr int32 SpawnerBenchmark_MaxReportedFailures = 10;
+
+USpawnerBenchmarkCommandlet::USpawnerBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 USpawnerBenchmarkCommandlet::Main(const FString& Params)
+{
+	int32 TotalSegments = 2000000;
+	int32 MaxDifficulty = 20;
+	int32 Seed = 1234;
+	FParse::Value(*Params, TEXT("Segments="), TotalSegments);
+	FParse::Value(*Params, TEXT("MaxDifficulty="), MaxDifficulty);
+	FParse::Value(*Params, TEXT("Seed="), Seed);
+	const bool bForce3Lane = FParse::Param(*Params, TEXT("Force3Lane"));
+
+	MaxDifficulty = FMath::Max(MaxDifficulty, 0);
+	const int32 SegmentsPerDifficulty = FMath::Max(TotalSegments / (MaxDifficulty + 1), 1);
+
+	// --- Spawner Setup ---
+
+	FString GameModePath;
+	if (!FParse::Value(*Params, TEXT("GameMode="), GameModePath))
+	{
+		GConfig->GetString(TEXT("/Script/EngineSettings.GameMapsSettings"), TEXT("GlobalDefaultGameMode"), GameModePath, GEngineIni);
+	}
+
+	UClass* GameModeClass = GameModePath.IsEmpty() ? nullptr : LoadClass<AStateRunner_ArcadeGameMode>(nullptr, *GameModePath);
+	if (!GameModeClass)
+	{
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("SpawnerBenchmark: '%s' is not a StateRunner game mode, using the native defaults"), *GameModePath);
+		GameModeClass = AStateRunner_ArcadeGameMode::StaticClass();
+	}
+
+	const AStateRunner_ArcadeGameMode* GameModeDefaults = GameModeClass->GetDefaultObject<AStateRunner_ArcadeGameMode>();
+	const UObstacleSpawnerComponent* SpawnerTemplate = GameModeDefaults->GetObstacleSpawnerComponent();
+	if (!SpawnerTemplate)
+	{
+		UE_LOG(LogStateRunner_Arcade, Error, TEXT("SpawnerBenchmark: %s has no obstacle spawner"), *GameModeClass->GetName());
+		return 1;
+	}
+
+	// Copy of the Blueprint-tuned component, never registered -- only the layout functions run
+	UObstacleSpawnerComponent* Spawner = DuplicateObject<UObstacleSpawnerComponent>(SpawnerTemplate, GetTransientPackage());
+	Spawner->bDebugForce3LaneBlockage = bForce3Lane;
+
+	// Same for the difficulty curves the layout reads (obstacle counts, breather gaps)
+	UDifficultyDirectorComponent* Director = GameModeDefaults->GetDifficultyDirectorComponent()
+		? DuplicateObject<UDifficultyDirectorComponent>(GameModeDefaults->GetDifficultyDirectorComponent(), GetTransientPackage())
+		: NewObject<UDifficultyDirectorComponent>(GetTransientPackage());
+	Director->BuildLookupTables();
+
+	UE_LOG(LogStateRunner_Arcade, Display, TEXT("SpawnerBenchmark: %s, %d patterns, %d segments per difficulty 0..%d, seed %d%s"),
+		*GameModeClass->GetName(), Spawner->GetPatternCount(), SegmentsPerDifficulty, MaxDifficulty, Seed,
+		bForce3Lane ? TEXT(", forced 3-lane blockage") : TEXT(""));
+
+	// Fixes are logged per segment (and the forced blockage on every one); keep them out of the report
+	const ELogVerbosity::Type PreviousVerbosity = LogStateRunner_Arcade.GetVerbosity();
+	LogStateRunner_Arcade.SetVerbosity(ELogVerbosity::Error);
+
+	FSpawnerBenchmark_MallocCounter MallocCounter(GMalloc);
+	FMalloc* OriginalMalloc = GMalloc;
+	GMalloc = &MallocCounter;
+
+	// --- Generation ---
+
+	TArray<FSpawnerBenchmark_Result> Results;
+	TArray<TPair<int32, int32>> Violations;
+	int32 ReportedBlockedRows = 0;
+	int32 ReportedSpacing = 0;
+
+	for (int32 Difficulty = 0; Difficulty <= MaxDifficulty; Difficulty++)
+	{
+		FSpawnerBenchmark_Result& Result = Results.AddDefaulted_GetRef();
+
+		// Each difficulty reproduces on its own: same seed, fresh variety window
+		FObstacleLayoutGenerator Generator = Spawner->CreateLayoutGenerator(Seed + Difficulty);
+		const int32 BaseObstacleCount = Director->GetBaseObstacleCount(Difficulty);
+		const float BreatherGapFraction = Director->GetBreatherGapFraction(Difficulty);
+		int32 SinceEmpty = 0;
+
+		const uint64 AllocationsBefore = MallocCounter.NumAllocations;
+		const uint64 BytesBefore = MallocCounter.NumBytes;
+		const double StartTime = FPlatformTime::Seconds();
+		double CheckSeconds = 0.0;
+
+		for (int32 SegmentIndex = 0; SegmentIndex < SegmentsPerDifficulty; SegmentIndex++)
+		{
+			// Same breather progression PlanNextSegment applies
+			SinceEmpty++;
+			FObstacleSegmentPlan Plan;
+			Plan.SegmentNumber = SegmentIndex + 1;
+			Plan.DifficultyLevel = Difficulty;
+			Plan.bIsBreather = Spawner->ShouldBeBreatherSegment(Difficulty, SinceEmpty);
+			Plan.BaseObstacleCount = BaseObstacleCount;
+			Plan.BreatherGapFraction = BreatherGapFraction;
+			if (Plan.bIsBreather)
+			{
+				SinceEmpty = 0;
+			}
+
+			const FObstacleSegmentLayout Layout = Generator.BuildSegmentLayout(Plan);
+
+			// Checks are off the clock and their allocations aren't the spawner's
+			const double CheckStart = FPlatformTime::Seconds();
+			const uint64 CheckAllocations = MallocCounter.NumAllocations;
+			const uint64 CheckBytes = MallocCounter.NumBytes;
+
+			Result.Segments++;
+			Result.Obstacles += Layout.Obstacles.Num();
+			Result.PatternSegments += Layout.PatternName.IsEmpty() ? 0 : 1;
+			Result.BreatherSegments += Plan.bIsBreather ? 1 : 0;
+
+			const float BlockedX = FindBlockedRow(Layout.Obstacles);
+			if (BlockedX >= 0.0f)
+			{
+				Result.BlockedRows++;
+				if (ReportedBlockedRows++ < SpawnerBenchmark_MaxReportedFailures)
+				{
+					UE_LOG(LogStateRunner_Arcade, Error, TEXT("SpawnerBenchmark: All 3 lanes blocked at X=%.3f -- difficulty %d, segment %d, seed %d, pattern '%s'%s"),
+						BlockedX, Difficulty, SegmentIndex, Seed + Difficulty, *Layout.PatternName, Plan.bIsBreather ? TEXT(" (breather)") : TEXT(""));
+				}
+			}
+
+			if (Generator.GetSettings().bEnableTypeAwareSpacing)
+			{
+				Violations.Reset();
+				Generator.FindTypeSpacingViolations(Layout.Obstacles, Violations);
+				if (Violations.Num() > 0)
+				{
+					Result.SpacingViolations += Violations.Num();
+					if (ReportedSpacing++ < SpawnerBenchmark_MaxReportedFailures)
+					{
+						const FObstacleSpawnData& First = Layout.Obstacles[Violations[0].Key];
+						const FObstacleSpawnData& Second = Layout.Obstacles[Violations[0].Value];
+						UE_LOG(LogStateRunner_Arcade, Error, TEXT("SpawnerBenchmark: %d spacing violation(s), first X=%.3f/%.3f -- difficulty %d, segment %d, seed %d, pattern '%s'%s"),
+							Violations.Num(), First.RelativeXOffset, Second.RelativeXOffset, Difficulty, SegmentIndex, Seed + Difficulty,
+							*Layout.PatternName, Plan.bIsBreather ? TEXT(" (breather)") : TEXT(""));
+					}
+				}
+			}
+
+			CheckSeconds += FPlatformTime::Seconds() - CheckStart;
+			MallocCounter.NumAllocations = CheckAllocations;
+			MallocCounter.NumBytes = CheckBytes;
+		}
+
+		Result.Seconds = FPlatformTime::Seconds() - StartTime - CheckSeconds;
+		Result.Allocations = MallocCounter.NumAllocations - AllocationsBefore;
+		Result.AllocatedBytes = MallocCounter.NumBytes - BytesBefore;
+	}
+
+	GMalloc = OriginalMalloc;
+	LogStateRunner_Arcade.SetVerbosity(PreviousVerbosity);
+
+	// --- Report ---
+
+	FSpawnerBenchmark_Result Total;
+	for (int32 Difficulty = 0; Difficulty < Results.Num(); Difficulty++)
+	{
+		UE_LOG(LogStateRunner_Arcade, Display, TEXT("SpawnerBenchmark: Difficulty %2d  %s"), Difficulty, *Results[Difficulty].ToString());
+		Total.Accumulate(Results[Difficulty]);
+	}
+	UE_LOG(LogStateRunner_Arcade, Display, TEXT("SpawnerBenchmark: Total          %s"), *Total.ToString());
+
+	const bool bFailed = Total.BlockedRows > 0 || Total.SpacingViolations > 0;
+	if (bFailed)
+	{
+		UE_LOG(LogStateRunner_Arcade, Error, TEXT("SpawnerBenchmark: FAILED -- %d blocked segment(s), %d spacing violation(s)"), Total.BlockedRows, Total.SpacingViolations);
+	}
+	else
+	{
+		UE_LOG(LogStateRunner_Arcade, Display, TEXT("SpawnerBenchmark: PASSED"));
+	}
+
+	return bFailed ? 1 : 0;
+}
+
+float USpawnerBenchmarkCommandlet::FindBlockedRow(const TArray<FObstacleSpawnData>& Obstacles)
+{
+	// Independent of EnsureFairLayout's sweep: sorted by X, a row is a run of FullWalls
+	// each within the threshold of the previous one
+	TArray<const FObstacleSpawnData*, TInlineAllocator<32>> FullWalls;
+	for (const FObstacleSpawnData& Data : Obstacles)
+	{
+		if (Data.ObstacleType == EObstacleType::FullWall)
+		{
+			FullWalls.Add(&Data);
+		}
+	}
+
+	FullWalls.Sort([](const FObstacleSpawnData& A, const FObstacleSpawnData& B)
+	{
+		return A.RelativeXOffset < B.RelativeXOffset;
+	});
+
+	uint8 RowLanes = 0;
+	float RowStartX = 0.0f;
+	for (int32 i = 0; i < FullWalls.Num(); i++)
+	{
+		if (i == 0 || FullWalls[i]->RelativeXOffset - FullWalls[i - 1]->RelativeXOffset > FObstacleLayoutGenerator::FullWallRowThreshold)
+		{
+			RowLanes = 0;
+			RowStartX = FullWalls[i]->RelativeXOffset;
+		}
+
+		RowLanes |= 1 << static_cast<uint8>(FullWalls[i]->Lane);
+		if (RowLanes == 0b111)
+		{
+			return RowStartX;
+		}
+	}
+
+	return -1.0f;
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "SpawnerBenchmarkCommandlet.generated.h"
+
+struct FObstacleSpawnData;
+
+/**
+ * Spawner Benchmark Commandlet
+ *
+ * Generates obstacle segment layouts headlessly (no world, no actors) through the obstacle
+ * spawner's own layout path -- pattern or procedural generation, EnsureFairLayout and the
+ * breather shift -- across every difficulty, and reports segments/sec and game-thread
+ * allocations per segment. Every finished layout is checked for:
+ *
+ * - a FullWall row covering all 3 lanes (what bDebugForce3LaneBlockage injects by hand)
+ * - type-aware spacing violations left over (FindTypeSpacingViolations)
+ *
+ * Spawner settings come from the game mode's class defaults, so a Blueprint game mode's
+ * tuning and pattern library are what get exercised.
+ *
+ * UnrealEditor-Cmd OVERCLOCKED_DDM_Game.uproject -run=SpawnerBenchmark
+ *     -Segments=2000000     Total segments, split evenly across the difficulties
+ *     -MaxDifficulty=20     Difficulties 0..MaxDifficulty are generated
+ *     -Seed=1234            Layout RNG seed (difficulty N uses Seed + N)
+ *     -GameMode=/Game/...   Game mode class (default: the project's GlobalDefaultGameMode)
+ *     -Force3Lane           Inject the debug 3-lane blockage into every segment
+ *
+ * Returns 1 if any layout failed a check (so it can gate a build), 0 otherwise.
+ */
+UCLASS()
+class USpawnerBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	USpawnerBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+protected:
+
+	/** X of the first FullWall row that covers all 3 lanes, or a negative value if none */
+	static float FindBlockedRow(const TArray<FObstacleSpawnData>& Obstacles);
+};
@@ -3,4 +3,33 @@
 
 IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, StateRunner_Arcade, "StateRunner_Arcade" );
 
-DEFINE_LOG_CATEGORY(LogStateRunner_Arcade)
\ No newline at end of file
+DEFINE_LOG_CATEGORY(LogStateRunner_Arcade)
+
+DEFINE_STAT(STAT_StateRunner_WorldScrollTick);
+DEFINE_STAT(STAT_StateRunner_SpawnObstacles);
+DEFINE_STAT(STAT_StateRunner_EnsureFairLayout);
+DEFINE_STAT(STAT_StateRunner_SpawnPickups);
+DEFINE_STAT(STAT_StateRunner_PoolPrewarm);
+DEFINE_STAT(STAT_StateRunner_MagnetTick);
+DEFINE_STAT(STAT_StateRunner_HUDTick);
+DEFINE_STAT(STAT_StateRunner_ThemeRefresh);
+DEFINE_STAT(STAT_StateRunner_SaveWrite);
+DEFINE_STAT(STAT_StateRunner_SaveLoad);
+
+DEFINE_STAT(STAT_StateRunner_PooledObstacles);
+DEFINE_STAT(STAT_StateRunner_ActiveObstacles);
+DEFINE_STAT(STAT_StateRunner_PooledPickups);
+DEFINE_STAT(STAT_StateRunner_ActivePickups);
+
+DEFINE_STAT(STAT_StateRunner_ObstaclePoolMemory);
+DEFINE_STAT(STAT_StateRunner_PickupPoolMemory);
+
+LLM_DEFINE_TAG(StateRunner);
+LLM_DEFINE_TAG(StateRunner_Theme);
+LLM_DEFINE_TAG(StateRunner_Music);
+LLM_DEFINE_TAG(StateRunner_SFX);
+LLM_DEFINE_TAG(StateRunner_ObstaclePool);
+LLM_DEFINE_TAG(StateRunner_PickupPool);
+
+uint64 GStateRunnerScopeCycles[static_cast<int32>(EStateRunnerScope::Count)] = {};
+EStateRunnerFrameEvent GStateRunnerFrameEvents = EStateRunnerFrameEvent::None;
@@ -1,6 +1,141 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "HAL/LowLevelMemTracker.h"
 
 /** Main log category used across the project */
-DECLARE_LOG_CATEGORY_EXTERN(LogStateRunner_Arcade, Log, All);
\ No newline at end of file
+DECLARE_LOG_CATEGORY_EXTERN(LogStateRunner_Arcade, Log, All);
+
+// --- Stats ---
+// "stat StateRunner" in game, or the StateRunner group in a stats / Insights capture
+
+DECLARE_STATS_GROUP(TEXT("StateRunner"), STATGROUP_StateRunner, STATCAT_Advanced);
+
+// Frame time per gameplay system
+DECLARE_CYCLE_STAT_EXTERN(TEXT("World Scroll Tick"), STAT_StateRunner_WorldScrollTick, STATGROUP_StateRunner, STATERUNNER_ARCADE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Spawn Obstacles For Segment"), STAT_StateRunner_SpawnObstacles, STATGROUP_StateRunner, STATERUNNER_ARCADE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Ensure Fair Layout"), STAT_StateRunner_EnsureFairLayout, STATGROUP_StateRunner, STATERUNNER_ARCADE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Spawn Pickups For Segment"), STAT_StateRunner_SpawnPickups, STATGROUP_StateRunner, STATERUNNER_ARCADE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Pool Prewarm"), STAT_StateRunner_PoolPrewarm, STATGROUP_StateRunner, STATERUNNER_ARCADE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Magnet Tick"), STAT_StateRunner_MagnetTick, STATGROUP_StateRunner, STATERUNNER_ARCADE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("HUD Tick"), STAT_StateRunner_HUDTick, STATGROUP_StateRunner, STATERUNNER_ARCADE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Theme Refresh"), STAT_StateRunner_ThemeRefresh, STATGROUP_StateRunner, STATERUNNER_ARCADE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Save Write"), STAT_StateRunner_SaveWrite, STATGROUP_StateRunner, STATERUNNER_ARCADE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Save Load"), STAT_StateRunner_SaveLoad, STATGROUP_StateRunner, STATERUNNER_ARCADE_API);
+
+// Pool and active actor counts (set by the spawners each segment and prewarm step)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Pooled Obstacles"), STAT_StateRunner_PooledObstacles, STATGROUP_StateRunner, STATERUNNER_ARCADE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Active Obstacles"), STAT_StateRunner_ActiveObstacles, STATGROUP_StateRunner, STATERUNNER_ARCADE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Pooled Pickups"), STAT_StateRunner_PooledPickups, STATGROUP_StateRunner, STATERUNNER_ARCADE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Active Pickups"), STAT_StateRunner_ActivePickups, STATGROUP_StateRunner, STATERUNNER_ARCADE_API);
+
+// Pool bookkeeping (slot, free-stack and active list arrays; the actors themselves are in the UObject stats)
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Obstacle Pool Memory"), STAT_StateRunner_ObstaclePoolMemory, STATGROUP_StateRunner, STATERUNNER_ARCADE_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Pickup Pool Memory"), STAT_StateRunner_PickupPoolMemory, STATGROUP_StateRunner, STATERUNNER_ARCADE_API);
+
+// --- Memory Tags ---
+// LLM tags per gameplay system: "-llm" (then "stat LLM" / "stat LLMFULL") or an Insights
+// memory trace shows what each one holds. The soak test reads them at every restart.
+
+LLM_DECLARE_TAG_API(StateRunner, STATERUNNER_ARCADE_API);
+LLM_DECLARE_TAG_API(StateRunner_Theme, STATERUNNER_ARCADE_API);
+LLM_DECLARE_TAG_API(StateRunner_Music, STATERUNNER_ARCADE_API);
+LLM_DECLARE_TAG_API(StateRunner_SFX, STATERUNNER_ARCADE_API);
+LLM_DECLARE_TAG_API(StateRunner_ObstaclePool, STATERUNNER_ARCADE_API);
+LLM_DECLARE_TAG_API(StateRunner_PickupPool, STATERUNNER_ARCADE_API);
+
+/**
+ * The tagged systems, in the order the soak test reports them.
+ * Tag names are "StateRunner/<Name>" (LLM turns the underscore into a path separator).
+ */
+enum class EStateRunnerMemoryTag : uint8
+{
+	Theme,
+	Music,
+	SFX,
+	ObstaclePool,
+	PickupPool,
+
+	Count
+};
+
+/** Allocations in this scope are charged to StateRunner/<Name>, e.g. STATERUNNER_LLM_SCOPE(Theme) */
+#define STATERUNNER_LLM_SCOPE(Name) LLM_SCOPE_BYTAG(StateRunner_##Name)
+
+/**
+ * Timed gameplay scopes, one per cycle stat above (STAT_StateRunner_<Name>).
+ * Also timed outside the stats system for the in-game performance overlay and hitch detector.
+ */
+enum class EStateRunnerScope : uint8
+{
+	WorldScrollTick,
+	SpawnObstacles,
+	EnsureFairLayout,
+	SpawnPickups,
+	PoolPrewarm,
+	MagnetTick,
+	HUDTick,
+	ThemeRefresh,
+	SaveWrite,
+	SaveLoad,
+
+	Count
+};
+
+/**
+ * FPlatformTime cycles spent in each scope since the debug subsystem last sampled (game
+ * thread only). Kept in every build: the hitch detector attributes field hitches with it.
+ */
+extern STATERUNNER_ARCADE_API uint64 GStateRunnerScopeCycles[static_cast<int32>(EStateRunnerScope::Count)];
+
+/** Adds its lifetime to GStateRunnerScopeCycles (inclusive of nested scopes) */
+struct FStateRunnerScopeTimer
+{
+	explicit FStateRunnerScopeTimer(EStateRunnerScope InScope)
+		: Scope(InScope)
+		, StartCycles(FPlatformTime::Cycles64())
+	{
+	}
+
+	~FStateRunnerScopeTimer()
+	{
+		GStateRunnerScopeCycles[static_cast<int32>(Scope)] += FPlatformTime::Cycles64() - StartCycles;
+	}
+
+	EStateRunnerScope Scope;
+	uint64 StartCycles;
+};
+
+#define STATERUNNER_SCOPE_TIMER(Name) FStateRunnerScopeTimer ANONYMOUS_VARIABLE(StateRunnerScope_)(EStateRunnerScope::Name)
+
+/**
+ * One-off work that can explain a long frame on its own. Flagged where it happens and read
+ * (then cleared) once per frame by the hitch detector in UGameDebugSubsystem.
+ */
+enum class EStateRunnerFrameEvent : uint16
+{
+	None					= 0,
+	ObstaclePoolExpanded	= 1 << 0,
+	PickupPoolExpanded		= 1 << 1,
+	WidgetConstructed		= 1 << 2,
+	GarbageCollected		= 1 << 3
+};
+ENUM_CLASS_FLAGS(EStateRunnerFrameEvent);
+
+/** Events flagged since the hitch detector last sampled (game thread only) */
+extern STATERUNNER_ARCADE_API EStateRunnerFrameEvent GStateRunnerFrameEvents;
+
+/** Flag a frame event, e.g. STATERUNNER_FRAME_EVENT(WidgetConstructed) */
+#define STATERUNNER_FRAME_EVENT(Name) (GStateRunnerFrameEvents |= EStateRunnerFrameEvent::Name)
+
+/**
+ * Cycle counter plus a CPU trace event of the same name, so the scope shows up by name in
+ * Insights captures (and in Test builds, where stats are compiled out), plus the overlay / hitch timer.
+ * Name is an EStateRunnerScope value, e.g. STATERUNNER_SCOPE_CYCLE_COUNTER(MagnetTick).
+ */
+#define STATERUNNER_SCOPE_CYCLE_COUNTER(Name) \
+	SCOPE_CYCLE_COUNTER(STAT_StateRunner_##Name); \
+	TRACE_CPUPROFILER_EVENT_SCOPE(StateRunner_##Name); \
+	STATERUNNER_SCOPE_TIMER(Name)
@@ -11,8 +11,14 @@
 #include "DrawDebugHelpers.h"  // For debug visualization
 #include "StateRunner_Arcade.h"
 #include "OverclockSystemComponent.h"
+#include "AutopilotComponent.h"
 #include "PickupSpawnerComponent.h"
 #include "StateRunner_ArcadeGameMode.h"
+#include "WorldScrollComponent.h"
+#include "VersusModeComponent.h"
+#include "GameDebugSubsystem.h"
+#include "SFXSubsystem.h"
+#include "Engine/GameViewportClient.h"
 #include "Camera/CameraShakeBase.h"  // For camera shake effects
 #include "Kismet/GameplayStatics.h"  // For sound playback
 #include "Sound/SoundBase.h"
@@ -133,12 +139,12 @@ void AStateRunner_ArcadeCharacter::BeginPlay()
 	if (bStartBelowGround)
 	{
 		CurrentRiseOffset = -RiseStartOffset;
-		SetActorLocation(FVector(LockedXPosition, InitialY, BaseZPosition + CurrentRiseOffset));
+		SetActorLocation(FVector(GetLockedX(), InitialY, BaseZPosition + CurrentRiseOffset));
 		UE_LOG(LogStateRunner_Arcade, Log, TEXT("Character starting below ground (offset: %.2f) - waiting for StartRiseFromGround()"), CurrentRiseOffset);
 	}
 	else
 	{
-		SetActorLocation(FVector(LockedXPosition, InitialY, BaseZPosition));
+		SetActorLocation(FVector(GetLockedX(), InitialY, BaseZPosition));
 	}
 	
 	// Ensure character faces forward (positive X direction, into the tunnel)
@@ -166,6 +172,26 @@ void AStateRunner_ArcadeCharacter::BeginPlay()
 	// Lock cameras before Tick enables to prevent snap during intro rise
 	EnforceCameraLaneLock();
 
+	// Fixed-step mode: movement integrates at the simulation rate, not the frame rate
+	if (UGameplaySimulationSubsystem* Simulation = UGameplaySimulationSubsystem::Get(this))
+	{
+		if (Simulation->IsFixedStepEnabled())
+		{
+			Simulation->RegisterParticipant(this, this, ESimulationPhase::Runner);
+			bSimulationDriven = true;
+		}
+	}
+
+	// Input latency and frame times are measured per run
+	if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
+	{
+		Debug->ResetInputLatency();
+		Debug->BeginPerfRun();
+	}
+	if (UGameViewportClient* Viewport = GetWorld() ? GetWorld()->GetGameViewport() : nullptr)
+	{
+		ViewportEndDrawHandle = Viewport->OnEndDraw().AddUObject(this, &AStateRunner_ArcadeCharacter::OnViewportEndDraw);
+	}
 }
 
 // --- End Play ---
@@ -179,15 +205,89 @@ void AStateRunner_ArcadeCharacter::EndPlay(const EEndPlayReason::Type EndPlayRea
 		World->GetTimerManager().ClearTimer(DamageFadeOutTimerHandle);
 	}
 
+	if (UGameplaySimulationSubsystem* Simulation = UGameplaySimulationSubsystem::Get(this))
+	{
+		Simulation->UnregisterParticipant(this);
+	}
+
+	if (UGameViewportClient* Viewport = GetWorld() ? GetWorld()->GetGameViewport() : nullptr)
+	{
+		Viewport->OnEndDraw().Remove(ViewportEndDrawHandle);
+	}
+	ViewportEndDrawHandle.Reset();
+
+	if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
+	{
+		const FString LatencySummary = Debug->BuildInputLatencySummary();
+		if (!LatencySummary.IsEmpty())
+		{
+			UE_LOG(LogStateRunner_Arcade, Log, TEXT("Run %s"), *LatencySummary);
+		}
+	}
+
 	Super::EndPlay(EndPlayReason);
 }
 
+void AStateRunner_ArcadeCharacter::PossessedBy(AController* NewController)
+{
+	Super::PossessedBy(NewController);
+
+	if (!bLateLatchInput || !NewController)
+	{
+		return;
+	}
+
+	// Input is processed in the controller's tick -- run it before our movement and the scroll pass
+	AddTickPrerequisiteActor(NewController);
+
+	if (AStateRunner_ArcadeGameMode* GameMode = GetWorld() ? Cast<AStateRunner_ArcadeGameMode>(GetWorld()->GetAuthGameMode()) : nullptr)
+	{
+		if (UWorldScrollComponent* WorldScroll = GameMode->GetWorldScrollComponent())
+		{
+			WorldScroll->PrimaryComponentTick.AddPrerequisite(NewController, NewController->PrimaryActorTick);
+		}
+	}
+}
+
 // --- Tick ---
 
 void AStateRunner_ArcadeCharacter::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
+	// Fixed-step mode runs these from SimulateStep instead; a late-latched press may already have run them this frame
+	if (!bSimulationDriven && LastMovementFrame != GFrameCounter)
+	{
+		LastMovementFrame = GFrameCounter;
+		ProcessMovement(DeltaTime);
+	}
+
+	// Process camera zoom (OVERCLOCK effect)
+	ProcessCameraZoom(DeltaTime);
+
+	// Always enforce position lock (X locked, Z = BaseZPosition + JumpOffset + RiseOffset)
+	EnforcePositionLock();
+
+	// One actor move for everything above, then pose the cameras from where the runner ended up
+	CommitPendingTransform();
+
+	// Keep cameras centered on track (don't follow lane switches)
+	EnforceCameraLaneLock();
+
+	// Update tick state - disable tick if no active movement AND no camera zoom in progress
+	const bool bCameraZoomInProgress = CameraBoom && 
+		FMath::Abs(CameraBoom->TargetArmLength - TargetCameraArmLength) > 1.0f;
+	
+	// Fixed-step mode: movement doesn't need the tick, only the zoom does
+	const bool bMovementNeedsTick = !bSimulationDriven && (IsAnyMovementActive() || bIsRising || InputBufferCount > 0);
+	if (!bMovementNeedsTick && !bCameraZoomInProgress)
+	{
+		SetActorTickEnabled(false);
+	}
+}
+
+void AStateRunner_ArcadeCharacter::ProcessMovement(float DeltaTime)
+{
 	// Process intro rise effect if active
 	if (bIsRising)
 	{
@@ -212,22 +312,343 @@ void AStateRunner_ArcadeCharacter::Tick(float DeltaTime)
 		ProcessSlide(DeltaTime);
 	}
 
-	// Process camera zoom (OVERCLOCK effect)
-	ProcessCameraZoom(DeltaTime);
+	// Retry presses refused while a move was running, now that this step's moves may have settled
+	ProcessInputBuffer();
+}
 
-	// Keep cameras centered on track (don't follow lane switches)
-	EnforceCameraLaneLock();
+// --- Fixed-Step Simulation ---
 
-	// Always enforce position lock (X locked, Z = BaseZPosition + JumpOffset + RiseOffset)
+void AStateRunner_ArcadeCharacter::SimulateStep(float StepSeconds)
+{
+	// Steps work on the simulated location, not the one last drawn
+	RestoreSimulatedLocation();
+	const FVector StepStartLocation = GetActorLocation();
+
+	if (!IsAnyMovementActive() && !bIsRising && !bHasPendingLocation && InputBufferCount == 0)
+	{
+		PreviousSimLocation = StepStartLocation;
+		CurrentSimLocation = StepStartLocation;
+		return;
+	}
+
+	// Commit every step -- contact resolution later in this step reads the capsule
+	ProcessMovement(StepSeconds);
 	EnforcePositionLock();
+	CommitPendingTransform();
+	PreviousSimLocation = StepStartLocation;
+	CurrentSimLocation = GetActorLocation();
+	bSimulatedMovementThisFrame = true;
+}
 
-	// Update tick state - disable tick if no active movement AND no camera zoom in progress
-	const bool bCameraZoomInProgress = CameraBoom && 
-		FMath::Abs(CameraBoom->TargetArmLength - TargetCameraArmLength) > 1.0f;
-	
-	if (!IsAnyMovementActive() && !bCameraZoomInProgress && !bIsRising)
+void AStateRunner_ArcadeCharacter::PostSimulate(float Alpha, int32 StepsThisFrame)
+{
+	// Draw between the last two steps so lane/jump/slide motion stays smooth against the
+	// interpolated scroll, including frames that ran no step
+	const bool bInterpolating = !PreviousSimLocation.Equals(CurrentSimLocation);
+	if (bInterpolating || bRenderInterpolated)
+	{
+		RestoreSimulatedLocation();
+		const FVector SimLocation = GetActorLocation();
+		const FVector DrawLocation(SimLocation.X,
+			FMath::Lerp(PreviousSimLocation.Y, CurrentSimLocation.Y, Alpha),
+			FMath::Lerp(PreviousSimLocation.Z, CurrentSimLocation.Z, Alpha));
+
+		if (!DrawLocation.Equals(SimLocation))
+		{
+			SetActorLocation(DrawLocation, false, nullptr, ETeleportType::TeleportPhysics);
+			RenderLocation = DrawLocation;
+			bRenderInterpolated = true;
+		}
+	}
+
+	// Cameras hold the track center while the runner moves between lanes
+	if (bSimulatedMovementThisFrame || bInterpolating)
 	{
-		SetActorTickEnabled(false);
+		EnforceCameraLaneLock();
+		bSimulatedMovementThisFrame = false;
+	}
+}
+
+void AStateRunner_ArcadeCharacter::RestoreSimulatedLocation()
+{
+	if (!bRenderInterpolated)
+	{
+		return;
+	}
+	bRenderInterpolated = false;
+
+	// X may have been re-locked since (track offset); only Y/Z were interpolated. If something
+	// else has moved the runner since, its location stands.
+	const FVector Location = GetActorLocation();
+	if (FMath::IsNearlyEqual(Location.Y, RenderLocation.Y) && FMath::IsNearlyEqual(Location.Z, RenderLocation.Z))
+	{
+		SetActorLocation(FVector(Location.X, CurrentSimLocation.Y, CurrentSimLocation.Z), false, nullptr, ETeleportType::TeleportPhysics);
+	}
+}
+
+// --- Pending Transform ---
+
+FVector AStateRunner_ArcadeCharacter::GetPendingLocation() const
+{
+	if (bHasPendingLocation)
+	{
+		return PendingLocation;
+	}
+
+	// Build on the simulated location, not the interpolated one being drawn
+	const FVector Location = GetActorLocation();
+	return bRenderInterpolated ? FVector(Location.X, CurrentSimLocation.Y, CurrentSimLocation.Z) : Location;
+}
+
+void AStateRunner_ArcadeCharacter::SetPendingLocation(const FVector& NewLocation)
+{
+	PendingLocation = NewLocation;
+	bHasPendingLocation = true;
+}
+
+void AStateRunner_ArcadeCharacter::CommitPendingTransform()
+{
+	UCapsuleComponent* Capsule = GetCapsuleComponent();
+
+	// Resize without its own overlap update -- the move below does one for both
+	bool bCapsuleResized = false;
+	if (PendingCapsuleHalfHeight >= 0.0f && Capsule)
+	{
+		Capsule->SetCapsuleHalfHeight(PendingCapsuleHalfHeight, false);
+		bCapsuleResized = true;
+	}
+	PendingCapsuleHalfHeight = -1.0f;
+
+	// Raise the mesh while sliding to prevent it from sinking underground
+	// (the actor was lowered, so the mesh goes back up by the same amount)
+	const float SlideCompensation = bIsSliding ? SlideZOffset : 0.0f;
+	if (SlideCompensation != MeshSlideCompensation && GetMesh())
+	{
+		FVector MeshLocation = GetMesh()->GetRelativeLocation();
+		MeshLocation.Z += SlideCompensation - MeshSlideCompensation;
+		GetMesh()->SetRelativeLocation(MeshLocation);
+		MeshSlideCompensation = SlideCompensation;
+	}
+
+	bool bMoved = false;
+	if (bHasPendingLocation)
+	{
+		bHasPendingLocation = false;
+
+		// X is re-locked here so a track offset change since staging still applies
+		PendingLocation.X = GetLockedX();
+		if (!PendingLocation.Equals(GetActorLocation()))
+		{
+			SetActorLocation(PendingLocation);
+			bMoved = true;
+
+			// A committed move is simulated state; nothing to interpolate toward until the next step
+			PreviousSimLocation = PendingLocation;
+			CurrentSimLocation = PendingLocation;
+			bRenderInterpolated = false;
+		}
+	}
+
+	// First visible reaction to the pending press -- present latency is closed out at OnViewportEndDraw
+	if (bMoved && PendingInputTime > 0.0)
+	{
+		ReactedInputTime = PendingInputTime;
+		ReactedInputToStepMs = static_cast<float>((FPlatformTime::Seconds() - PendingInputTime) * 1000.0);
+		PendingInputTime = 0.0;
+	}
+
+	if (bCapsuleResized && !bMoved && Capsule)
+	{
+		Capsule->UpdateOverlaps();
+	}
+}
+
+uint8 AStateRunner_ArcadeCharacter::GetMovementStateBits() const
+{
+	return (bIsLaneSwitching ? 1 : 0) | (bIsJumping ? 2 : 0) | (bIsSliding ? 4 : 0) | (bIsFastFalling ? 8 : 0);
+}
+
+void AStateRunner_ArcadeCharacter::OnMovementInput(EBufferedInput Action, double InputTime, uint8 StateBitsBefore)
+{
+	// A newer lane press cancels a queued one the other way
+	if (Action == EBufferedInput::LaneLeft)
+	{
+		RemoveBufferedInput(EBufferedInput::LaneRight);
+	}
+	else if (Action == EBufferedInput::LaneRight)
+	{
+		RemoveBufferedInput(EBufferedInput::LaneLeft);
+	}
+
+	// Blocked presses (input disabled, already jumping, edge lane) don't count;
+	// ones refused only because another move is running are retried for a short window
+	if (GetMovementStateBits() == StateBitsBefore)
+	{
+		if (bGameplayInputEnabled && IsAnyMovementActive())
+		{
+			BufferMovementInput(Action);
+		}
+		return;
+	}
+
+	// Accepted now, so an older queued press of the same kind is stale
+	RemoveBufferedInput(Action);
+
+	// Measure from the oldest press nothing has reacted to yet
+	if (PendingInputTime <= 0.0)
+	{
+		PendingInputTime = InputTime;
+	}
+
+	// Fixed-step mode steps after input anyway; otherwise run this frame's movement now,
+	// unless Tick already did (then this press is picked up next frame as before)
+	if (!bLateLatchInput || bSimulationDriven || LastMovementFrame == GFrameCounter)
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	LastMovementFrame = GFrameCounter;
+	ProcessMovement(World->GetDeltaSeconds());
+	EnforcePositionLock();
+	CommitPendingTransform();
+	EnforceCameraLaneLock();
+}
+
+// --- Input Buffer ---
+
+double AStateRunner_ArcadeCharacter::GetInputBufferTime() const
+{
+	if (const UGameplaySimulationSubsystem* Simulation = UGameplaySimulationSubsystem::Get(this))
+	{
+		return Simulation->GetGameplayTime();
+	}
+
+	const UWorld* World = GetWorld();
+	return World ? World->GetTimeSeconds() : 0.0;
+}
+
+void AStateRunner_ArcadeCharacter::BufferMovementInput(EBufferedInput Action)
+{
+	if (InputBufferWindow <= 0.0f)
+	{
+		return;
+	}
+
+	// Re-pressing refreshes the entry (moves it to the back) instead of stacking repeats
+	RemoveBufferedInput(Action);
+
+	if (InputBufferCount == InputBufferCapacity)
+	{
+		// One slot per action, so this only trips if EBufferedInput grows -- drop the oldest
+		RemoveBufferedInput(InputBuffer[0].Action);
+	}
+
+	FBufferedInputEntry& Entry = InputBuffer[InputBufferCount++];
+	Entry.Action = Action;
+	Entry.Time = GetInputBufferTime();
+
+	// Tick (or the next step) has to run for the buffer to drain
+	RequestMovementUpdate();
+}
+
+void AStateRunner_ArcadeCharacter::RemoveBufferedInput(EBufferedInput Action)
+{
+	for (int32 i = 0; i < InputBufferCount; i++)
+	{
+		if (InputBuffer[i].Action == Action)
+		{
+			for (int32 j = i + 1; j < InputBufferCount; j++)
+			{
+				InputBuffer[j - 1] = InputBuffer[j];
+			}
+			InputBufferCount--;
+			return;
+		}
+	}
+}
+
+void AStateRunner_ArcadeCharacter::ProcessInputBuffer()
+{
+	if (InputBufferCount == 0)
+	{
+		return;
+	}
+
+	if (!bGameplayInputEnabled)
+	{
+		ClearInputBuffer();
+		return;
+	}
+
+	const double Now = GetInputBufferTime();
+
+	int32 i = 0;
+	while (i < InputBufferCount)
+	{
+		const FBufferedInputEntry Entry = InputBuffer[i];
+
+		// Expired, or just fired -- either way it leaves the queue
+		if (Now - Entry.Time > InputBufferWindow || TryMovementAction(Entry.Action))
+		{
+			RemoveBufferedInput(Entry.Action);
+			continue;
+		}
+
+		i++;
+	}
+}
+
+bool AStateRunner_ArcadeCharacter::TryMovementAction(EBufferedInput Action)
+{
+	const uint8 StateBitsBefore = GetMovementStateBits();
+
+	switch (Action)
+	{
+		case EBufferedInput::LaneLeft:
+			SwitchLaneLeft();
+			break;
+		case EBufferedInput::LaneRight:
+			SwitchLaneRight();
+			break;
+		case EBufferedInput::Jump:
+			StartJump();
+			break;
+		case EBufferedInput::Slide:
+			StartSlide();
+			break;
+	}
+
+	return GetMovementStateBits() != StateBitsBefore;
+}
+
+void AStateRunner_ArcadeCharacter::OnViewportEndDraw()
+{
+	if (ReactedInputTime <= 0.0)
+	{
+		return;
+	}
+
+	const float InputToPresentMs = static_cast<float>((FPlatformTime::Seconds() - ReactedInputTime) * 1000.0);
+	ReactedInputTime = 0.0;
+
+	if (UGameDebugSubsystem* Debug = UGameDebugSubsystem::Get(this))
+	{
+		Debug->RecordInputLatency(ReactedInputToStepMs, InputToPresentMs);
+	}
+}
+
+void AStateRunner_ArcadeCharacter::RequestMovementUpdate()
+{
+	// Fixed-step mode picks movement up on the next step; only the camera needs the tick
+	if (!bSimulationDriven && !IsActorTickEnabled())
+	{
+		SetActorTickEnabled(true);
 	}
 }
 
@@ -359,7 +780,7 @@ void AStateRunner_ArcadeCharacter::SwitchLaneLeft()
 
 	// Begin lane switch
 	bIsLaneSwitching = true;
-	SetActorTickEnabled(true);  // Enable tick for smooth interpolation
+	RequestMovementUpdate();
 
 	// Play lane switch sound
 	PlayPlayerSound(LaneSwitchSound);
@@ -406,7 +827,7 @@ void AStateRunner_ArcadeCharacter::SwitchLaneRight()
 
 	// Begin lane switch
 	bIsLaneSwitching = true;
-	SetActorTickEnabled(true);  // Enable tick for smooth interpolation
+	RequestMovementUpdate();
 
 	// Play lane switch sound
 	PlayPlayerSound(LaneSwitchSound);
@@ -433,7 +854,7 @@ float AStateRunner_ArcadeCharacter::GetLaneYPosition(ELanePosition Lane) const
 void AStateRunner_ArcadeCharacter::ProcessLaneSwitching(float DeltaTime)
 {
 	// Get current and target Y positions
-	const FVector CurrentLocation = GetActorLocation();
+	const FVector CurrentLocation = GetPendingLocation();
 	const float CurrentY = CurrentLocation.Y;
 	const float TargetY = GetLaneYPosition(TargetLane);
 	const float Distance = FMath::Abs(TargetY - CurrentY);
@@ -459,7 +880,7 @@ void AStateRunner_ArcadeCharacter::ProcessLaneSwitching(float DeltaTime)
 	if (Distance <= LaneSnapThreshold)
 	{
 		// Snap to exact target Y position, preserve appropriate Z
-		SetActorLocation(FVector(LockedXPosition, TargetY, TargetZ));
+		SetPendingLocation(FVector(GetLockedX(), TargetY, TargetZ));
 		
 		// Update lane state
 		CurrentLane = TargetLane;
@@ -470,21 +891,17 @@ void AStateRunner_ArcadeCharacter::ProcessLaneSwitching(float DeltaTime)
 
 		// Check if lane key is still held - queue another switch if possible
 		// This allows holding left/right to smoothly cross multiple lanes
+		// (Tick turns itself off once nothing is moving)
+		// A held key already carries the queued press, so drop it rather than switch twice
 		if (bIsLaneLeftHeld && CurrentLane != ELanePosition::Left)
 		{
+			RemoveBufferedInput(EBufferedInput::LaneLeft);
 			SwitchLaneLeft();
-			return;  // New switch started, keep tick enabled
 		}
 		else if (bIsLaneRightHeld && CurrentLane != ELanePosition::Right)
 		{
+			RemoveBufferedInput(EBufferedInput::LaneRight);
 			SwitchLaneRight();
-			return;  // New switch started, keep tick enabled
-		}
-		
-		// Only disable tick if no other movement is active (jump may still be processing)
-		if (!IsAnyMovementActive())
-		{
-			SetActorTickEnabled(false);
 		}
 		return;
 	}
@@ -506,17 +923,17 @@ void AStateRunner_ArcadeCharacter::ProcessLaneSwitching(float DeltaTime)
 		NewY = FMath::Max(CurrentY + Movement, TargetY);
 	}
 
-	// Apply new position - X locked, Y interpolating, Z based on state
-	SetActorLocation(FVector(LockedXPosition, NewY, TargetZ));
+	// Stage new position - X locked, Y interpolating, Z based on state
+	SetPendingLocation(FVector(GetLockedX(), NewY, TargetZ));
 }
 
 void AStateRunner_ArcadeCharacter::EnforcePositionLock()
 {
-	// Get current position
-	const FVector CurrentLocation = GetActorLocation();
+	// Get current position (including anything staged this tick)
+	const FVector CurrentLocation = GetPendingLocation();
 	
-	// Always enforce X position (player locked at -5000)
-	const bool bXDrifted = !FMath::IsNearlyEqual(CurrentLocation.X, LockedXPosition, 0.1f);
+	// Always enforce X position (player locked at -5000, plus track offset in MoveRunner scroll mode)
+	const bool bXDrifted = !FMath::IsNearlyEqual(CurrentLocation.X, GetLockedX(), 0.1f);
 	
 	// Z position handling depends on current state:
 	// - During jump: We manually control Z via CurrentJumpOffset
@@ -552,12 +969,12 @@ void AStateRunner_ArcadeCharacter::EnforcePositionLock()
 	{
 		// Correct position drift while preserving Y (lane position)
 		const float FinalZ = bZDrifted ? ExpectedZ : CurrentLocation.Z;
-		SetActorLocation(FVector(LockedXPosition, CurrentLocation.Y, FinalZ));
+		SetPendingLocation(FVector(GetLockedX(), CurrentLocation.Y, FinalZ));
 		
 		if (bXDrifted)
 		{
 			UE_LOG(LogStateRunner_Arcade, Warning, TEXT("X position drifted to %.2f, corrected to %.2f"), 
-				CurrentLocation.X, LockedXPosition);
+				CurrentLocation.X, GetLockedX());
 		}
 		if (bZDrifted)
 		{
@@ -567,29 +984,76 @@ void AStateRunner_ArcadeCharacter::EnforcePositionLock()
 	}
 }
 
+void AStateRunner_ArcadeCharacter::SetRunnerTrackOffset(float NewOffset)
+{
+	RunnerTrackOffset = NewOffset;
+
+	// Drawn between steps: move X only and keep the interpolated Y/Z
+	if (bRenderInterpolated && !bHasPendingLocation)
+	{
+		const FVector Location = GetActorLocation();
+		SetActorLocation(FVector(GetLockedX(), Location.Y, Location.Z), false, nullptr, ETeleportType::TeleportPhysics);
+		return;
+	}
+
+	// Only X changes -- Y/Z stay under lane/jump/slide control (commit re-locks X)
+	SetPendingLocation(GetPendingLocation());
+	CommitPendingTransform();
+}
+
 // --- Input Callbacks: Lane Switching ---
 
 void AStateRunner_ArcadeCharacter::OnLaneLeftPressed()
 {
+	if (ConsumePlayerInput(ERunReplayInput::LaneLeft, true))
+	{
+		return;
+	}
+
+	const double InputTime = FPlatformTime::Seconds();
+	const uint8 StateBitsBefore = GetMovementStateBits();
+
 	bIsLaneLeftHeld = true;
 	bIsLaneRightHeld = false;  // Cancel opposite direction
 	SwitchLaneLeft();
+
+	OnMovementInput(EBufferedInput::LaneLeft, InputTime, StateBitsBefore);
 }
 
 void AStateRunner_ArcadeCharacter::OnLaneLeftReleased()
 {
+	if (ConsumePlayerInput(ERunReplayInput::LaneLeft, false))
+	{
+		return;
+	}
+
 	bIsLaneLeftHeld = false;
 }
 
 void AStateRunner_ArcadeCharacter::OnLaneRightPressed()
 {
+	if (ConsumePlayerInput(ERunReplayInput::LaneRight, true))
+	{
+		return;
+	}
+
+	const double InputTime = FPlatformTime::Seconds();
+	const uint8 StateBitsBefore = GetMovementStateBits();
+
 	bIsLaneRightHeld = true;
 	bIsLaneLeftHeld = false;  // Cancel opposite direction
 	SwitchLaneRight();
+
+	OnMovementInput(EBufferedInput::LaneRight, InputTime, StateBitsBefore);
 }
 
 void AStateRunner_ArcadeCharacter::OnLaneRightReleased()
 {
+	if (ConsumePlayerInput(ERunReplayInput::LaneRight, false))
+	{
+		return;
+	}
+
 	bIsLaneRightHeld = false;
 }
 
@@ -625,8 +1089,7 @@ void AStateRunner_ArcadeCharacter::StartJump()
 	JumpHoldTime = 0.0f;
 	ApexHangTimeRemaining = 0.0f;
 
-	// Enable tick for jump processing
-	SetActorTickEnabled(true);
+	RequestMovementUpdate();
 
 	// Play jump sound
 	PlayPlayerSound(JumpSound);
@@ -774,18 +1237,31 @@ void AStateRunner_ArcadeCharacter::ProcessJump(float DeltaTime)
 		}
 	}
 
-	// Apply jump offset to position (X and Y stay locked, Z = BaseZPosition + offset)
-	const FVector CurrentLocation = GetActorLocation();
-	SetActorLocation(FVector(LockedXPosition, CurrentLocation.Y, BaseZPosition + CurrentJumpOffset));
+	// Stage jump offset (X and Y stay locked, Z = BaseZPosition + offset)
+	const FVector CurrentLocation = GetPendingLocation();
+	SetPendingLocation(FVector(GetLockedX(), CurrentLocation.Y, BaseZPosition + CurrentJumpOffset));
 }
 
 void AStateRunner_ArcadeCharacter::OnJumpPressed()
 {
+	if (ConsumePlayerInput(ERunReplayInput::Jump, true))
+	{
+		return;
+	}
+
+	const double InputTime = FPlatformTime::Seconds();
+	const uint8 StateBitsBefore = GetMovementStateBits();
 	StartJump();
+	OnMovementInput(EBufferedInput::Jump, InputTime, StateBitsBefore);
 }
 
 void AStateRunner_ArcadeCharacter::OnJumpReleased()
 {
+	if (ConsumePlayerInput(ERunReplayInput::Jump, false))
+	{
+		return;
+	}
+
 	EndJump();
 }
 
@@ -832,32 +1308,16 @@ void AStateRunner_ArcadeCharacter::StartSlide()
 	// 1. Notify movement component we're crouching (prevents Z position fighting)
 	// 2. Manually apply capsule resize (since our MaxWalkSpeed=0 means crouch won't auto-apply)
 	// 3. Manually set position (to get immediate visual feedback)
+	// The resize, move and mesh/camera compensation are all applied by the next commit
 	Crouch();  // Tell movement component we're crouching
-	GetCapsuleComponent()->SetCapsuleHalfHeight(SlideCapsuleHalfHeight);  // Manual resize
+	PendingCapsuleHalfHeight = SlideCapsuleHalfHeight;  // Manual resize
 	
-	// Apply Z offset to lower character (keeps capsule bottom at floor level)
-	const FVector CurrentLocation = GetActorLocation();
-	SetActorLocation(FVector(LockedXPosition, CurrentLocation.Y, BaseZPosition - SlideZOffset));
+	// Lower character by the Z offset (keeps capsule bottom at floor level);
+	// the commit raises the mesh and camera boom back by the same amount
+	const FVector CurrentLocation = GetPendingLocation();
+	SetPendingLocation(FVector(GetLockedX(), CurrentLocation.Y, BaseZPosition - SlideZOffset));
 
-	// Compensate camera boom so the camera doesn't dip when the character lowers
-	if (CameraBoom)
-	{
-		FVector BoomLocation = CameraBoom->GetRelativeLocation();
-		BoomLocation.Z += SlideZOffset;
-		CameraBoom->SetRelativeLocation(BoomLocation);
-	}
-
-	// Compensate mesh position to prevent it from sinking underground
-	// The actor was lowered, so we raise the mesh back up by the same amount
-	if (GetMesh())
-	{
-		FVector MeshLocation = GetMesh()->GetRelativeLocation();
-		MeshLocation.Z += SlideZOffset;
-		GetMesh()->SetRelativeLocation(MeshLocation);
-	}
-
-	// Enable tick for slide processing
-	SetActorTickEnabled(true);
+	RequestMovementUpdate();
 
 	// Play slide sound
 	PlayPlayerSound(SlideSound);
@@ -884,27 +1344,11 @@ void AStateRunner_ArcadeCharacter::EndSlide()
 		// 2. Manually restore capsule height
 		// 3. Manually restore position
 		UnCrouch();  // Tell movement component we're standing
-		GetCapsuleComponent()->SetCapsuleHalfHeight(NormalCapsuleHalfHeight);  // Manual restore
+		PendingCapsuleHalfHeight = NormalCapsuleHalfHeight;  // Manual restore
 		
-		// Restore Z position to normal standing height
-		const FVector CurrentLocation = GetActorLocation();
-		SetActorLocation(FVector(LockedXPosition, CurrentLocation.Y, BaseZPosition));
-
-		// Restore camera boom to original position
-		if (CameraBoom)
-		{
-			FVector BoomLocation = CameraBoom->GetRelativeLocation();
-			BoomLocation.Z -= SlideZOffset;  // Remove the compensation we added
-			CameraBoom->SetRelativeLocation(BoomLocation);
-		}
-
-		// Restore mesh position (remove the compensation we added)
-		if (GetMesh())
-		{
-			FVector MeshLocation = GetMesh()->GetRelativeLocation();
-			MeshLocation.Z -= SlideZOffset;
-			GetMesh()->SetRelativeLocation(MeshLocation);
-		}
+		// Restore Z position to normal standing height (the commit removes the mesh/camera compensation)
+		const FVector CurrentLocation = GetPendingLocation();
+		SetPendingLocation(FVector(GetLockedX(), CurrentLocation.Y, BaseZPosition));
 
 		// End slide state
 		bIsSliding = false;
@@ -934,27 +1378,11 @@ void AStateRunner_ArcadeCharacter::ForceEndSlide()
 	// 2. Manually restore capsule height
 	// 3. Manually restore position
 	UnCrouch();  // Tell movement component we're standing
-	GetCapsuleComponent()->SetCapsuleHalfHeight(NormalCapsuleHalfHeight);  // Manual restore
+	PendingCapsuleHalfHeight = NormalCapsuleHalfHeight;  // Manual restore
 	
-	// Restore Z position to normal standing height
-	const FVector CurrentLocation = GetActorLocation();
-	SetActorLocation(FVector(LockedXPosition, CurrentLocation.Y, BaseZPosition));
-
-	// Restore camera boom to original position
-	if (CameraBoom)
-	{
-		FVector BoomLocation = CameraBoom->GetRelativeLocation();
-		BoomLocation.Z -= SlideZOffset;  // Remove the compensation we added
-		CameraBoom->SetRelativeLocation(BoomLocation);
-	}
-
-	// Restore mesh position (remove the compensation we added)
-	if (GetMesh())
-	{
-		FVector MeshLocation = GetMesh()->GetRelativeLocation();
-		MeshLocation.Z -= SlideZOffset;
-		GetMesh()->SetRelativeLocation(MeshLocation);
-	}
+	// Restore Z position to normal standing height (the commit removes the mesh/camera compensation)
+	const FVector CurrentLocation = GetPendingLocation();
+	SetPendingLocation(FVector(GetLockedX(), CurrentLocation.Y, BaseZPosition));
 
 	// End slide completely
 	bIsSliding = false;
@@ -1038,11 +1466,24 @@ void AStateRunner_ArcadeCharacter::ProcessSlide(float DeltaTime)
 
 void AStateRunner_ArcadeCharacter::OnSlidePressed()
 {
+	if (ConsumePlayerInput(ERunReplayInput::Slide, true))
+	{
+		return;
+	}
+
+	const double InputTime = FPlatformTime::Seconds();
+	const uint8 StateBitsBefore = GetMovementStateBits();
 	StartSlide();
+	OnMovementInput(EBufferedInput::Slide, InputTime, StateBitsBefore);
 }
 
 void AStateRunner_ArcadeCharacter::OnSlideReleased()
 {
+	if (ConsumePlayerInput(ERunReplayInput::Slide, false))
+	{
+		return;
+	}
+
 	// Key released - stop extending slide duration, but slide continues
 	if (bIsSliding)
 	{
@@ -1090,40 +1531,90 @@ bool AStateRunner_ArcadeCharacter::IsAnyMovementActive() const
 
 void AStateRunner_ArcadeCharacter::OnOverclockPressed()
 {
+	if (ConsumePlayerInput(ERunReplayInput::Overclock, true))
+	{
+		return;
+	}
+
 	// Block input during intro/countdown
 	if (!bGameplayInputEnabled)
 	{
 		return;
 	}
 
-	// Get OVERCLOCK system from GameMode
-	if (UWorld* World = GetWorld())
+	// This runner's OVERCLOCK (a versus rival has its own)
+	if (UOverclockSystemComponent* OverclockSystem = UVersusModeComponent::FindPlayerSystems(this).OverclockSystem)
 	{
-		if (AStateRunner_ArcadeGameMode* GameMode = Cast<AStateRunner_ArcadeGameMode>(World->GetAuthGameMode()))
-		{
-			if (UOverclockSystemComponent* OverclockSystem = GameMode->GetOverclockSystemComponent())
-			{
-				OverclockSystem->OnOverclockKeyPressed();
-			}
-		}
+		OverclockSystem->OnOverclockKeyPressed();
 	}
 }
 
 void AStateRunner_ArcadeCharacter::OnOverclockReleased()
 {
-	// Get OVERCLOCK system from GameMode
-	if (UWorld* World = GetWorld())
+	if (ConsumePlayerInput(ERunReplayInput::Overclock, false))
 	{
-		if (AStateRunner_ArcadeGameMode* GameMode = Cast<AStateRunner_ArcadeGameMode>(World->GetAuthGameMode()))
-		{
-			if (UOverclockSystemComponent* OverclockSystem = GameMode->GetOverclockSystemComponent())
-			{
-				OverclockSystem->OnOverclockKeyReleased();
-			}
-		}
+		return;
+	}
+
+	// This runner's OVERCLOCK (a versus rival has its own)
+	if (UOverclockSystemComponent* OverclockSystem = UVersusModeComponent::FindPlayerSystems(this).OverclockSystem)
+	{
+		OverclockSystem->OnOverclockKeyReleased();
 	}
 }
 
+// --- Autopilot and Replay ---
+
+void AStateRunner_ArcadeCharacter::ApplyReplayInput(ERunReplayInput Input, bool bPressed)
+{
+	TGuardValue<bool> ApplyingGuard(bApplyingReplayInput, true);
+
+	switch (Input)
+	{
+		case ERunReplayInput::LaneLeft:
+			bPressed ? OnLaneLeftPressed() : OnLaneLeftReleased();
+			break;
+		case ERunReplayInput::LaneRight:
+			bPressed ? OnLaneRightPressed() : OnLaneRightReleased();
+			break;
+		case ERunReplayInput::Jump:
+			bPressed ? OnJumpPressed() : OnJumpReleased();
+			break;
+		case ERunReplayInput::Slide:
+			bPressed ? OnSlidePressed() : OnSlideReleased();
+			break;
+		case ERunReplayInput::Overclock:
+			bPressed ? OnOverclockPressed() : OnOverclockReleased();
+			break;
+		default:
+			break;
+	}
+}
+
+bool AStateRunner_ArcadeCharacter::ConsumePlayerInput(ERunReplayInput Input, bool bPressed)
+{
+	if (bApplyingReplayInput)
+	{
+		return false;
+	}
+
+	const UWorld* World = GetWorld();
+	const AStateRunner_ArcadeGameMode* GameMode = World ? Cast<AStateRunner_ArcadeGameMode>(World->GetAuthGameMode()) : nullptr;
+	if (!GameMode)
+	{
+		return false;
+	}
+
+	UAutopilotComponent* Autopilot = GameMode->GetAutopilotComponent();
+	if (Autopilot && Autopilot->HandlePlayerInput())
+	{
+		return true;
+	}
+
+	URunReplayComponent* Replay = GameMode->GetRunReplayComponent();
+	return Replay && Replay->HandlePlayerInput(Input, bPressed);
+}
+
 // --- Disabled Standard Movement Functions (kept for interface compatibility) ---
 
 void AStateRunner_ArcadeCharacter::Move(const FInputActionValue& Value)
@@ -1174,13 +1665,17 @@ void AStateRunner_ArcadeCharacter::StartRiseFromGround()
 	RiseSpeed = RiseStartOffset / RiseDuration;
 	
 	bIsRising = true;
-	SetActorTickEnabled(true);
+	RequestMovementUpdate();
 	
 	// Immediately apply the starting position
 	EnforcePositionLock();
+	CommitPendingTransform();
 	
 	UE_LOG(LogStateRunner_Arcade, Log, TEXT("Intro rise started - Rising %.2f units over %.2f seconds"), 
 		RiseStartOffset, RiseDuration);
+
+	// Versus: the rivals rise with Player 1
+	UVersusModeComponent::FollowPlayerOne(this, [](AStateRunner_ArcadeCharacter& Runner) { Runner.StartRiseFromGround(); });
 }
 
 void AStateRunner_ArcadeCharacter::ProcessRiseEffect(float DeltaTime)
@@ -1212,6 +1707,9 @@ void AStateRunner_ArcadeCharacter::EnableGameplayInput()
 		bGameplayInputEnabled = true;
 		UE_LOG(LogStateRunner_Arcade, Log, TEXT("Gameplay input ENABLED - Player can now move, jump, slide, etc."));
 	}
+
+	// Versus: the rivals get control with Player 1
+	UVersusModeComponent::FollowPlayerOne(this, [](AStateRunner_ArcadeCharacter& Runner) { Runner.EnableGameplayInput(); });
 }
 
 void AStateRunner_ArcadeCharacter::DisableGameplayInput()
@@ -1219,6 +1717,7 @@ void AStateRunner_ArcadeCharacter::DisableGameplayInput()
 	if (bGameplayInputEnabled)
 	{
 		bGameplayInputEnabled = false;
+		ClearInputBuffer();
 		UE_LOG(LogStateRunner_Arcade, Log, TEXT("Gameplay input DISABLED - Player movement blocked"));
 	}
 }
@@ -1401,11 +1900,6 @@ void AStateRunner_ArcadeCharacter::ProcessCameraZoom(float DeltaTime)
 
 void AStateRunner_ArcadeCharacter::EnforceCameraLaneLock()
 {
-	if (!bLockCameraToCenter)
-	{
-		return;
-	}
-
 	const FVector CharacterLocation = GetActorLocation();
 	
 	// Y offset keeps camera at center lane (world Y=0) regardless of lane switches
@@ -1415,19 +1909,35 @@ void AStateRunner_ArcadeCharacter::EnforceCameraLaneLock()
 
 	if (CameraBoom)
 	{
-		FVector BoomLocation = CameraBoom->GetRelativeLocation();
-		BoomLocation.Y = CameraOffsetY;
-		BoomLocation.Z = CameraOffsetZ;
-		CameraBoom->SetRelativeLocation(BoomLocation);
+		const FVector CurrentBoomLocation = CameraBoom->GetRelativeLocation();
+		FVector BoomLocation = CurrentBoomLocation;
+
+		// Raise the boom while sliding so the camera doesn't dip when the character lowers
+		const float SlideCompensation = bIsSliding ? SlideZOffset : 0.0f;
+		BoomLocation.Z += SlideCompensation - BoomSlideCompensation;
+		BoomSlideCompensation = SlideCompensation;
+
+		if (bLockCameraToCenter)
+		{
+			BoomLocation.Y = CameraOffsetY;
+			BoomLocation.Z = CameraOffsetZ;
+		}
+
+		if (!BoomLocation.Equals(CurrentBoomLocation))
+		{
+			CameraBoom->SetRelativeLocation(BoomLocation);
+		}
 	}
 
 	// Top-down uses its own cached Z baseline from Blueprint
-	if (TopDownCameraBoom)
+	if (bLockCameraToCenter && TopDownCameraBoom)
 	{
-		FVector BoomLocation = TopDownCameraBoom->GetRelativeLocation();
-		BoomLocation.Y = CameraOffsetY;
-		BoomLocation.Z = TopDownCameraBoomBaseZ + CameraOffsetZ;
-		TopDownCameraBoom->SetRelativeLocation(BoomLocation);
+		const FVector CurrentBoomLocation = TopDownCameraBoom->GetRelativeLocation();
+		const FVector BoomLocation(CurrentBoomLocation.X, CameraOffsetY, TopDownCameraBoomBaseZ + CameraOffsetZ);
+		if (!BoomLocation.Equals(CurrentBoomLocation))
+		{
+			TopDownCameraBoom->SetRelativeLocation(BoomLocation);
+		}
 	}
 }
 
@@ -1452,8 +1962,9 @@ void AStateRunner_ArcadeCharacter::PlayPlayerSound(USoundBase* Sound, float Volu
 		return;
 	}
 
-	UGameplayStatics::PlaySoundAtLocation(
+	USFXSubsystem::PlaySFXAtLocation(
 		this,
+		ESFXCategory::Player,
 		Sound,
 		GetActorLocation(),
 		MovementSoundVolume * VolumeMultiplier
@@ -3,6 +3,8 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
 #include "Logging/LogMacros.h"
+#include "GameplaySimulationSubsystem.h"
+#include "RunReplayComponent.h"
 #include "StateRunner_ArcadeCharacter.generated.h"
 
 class USpringArmComponent;
@@ -26,13 +28,25 @@ enum class ELanePosition : uint8
 	Right = 2   UMETA(DisplayName = "Right Lane")
 };
 
+/**
+ * Movement presses the input buffer can hold.
+ */
+UENUM(BlueprintType)
+enum class EBufferedInput : uint8
+{
+	LaneLeft,
+	LaneRight,
+	Jump,
+	Slide
+};
+
 /**
  * Main player character for StateRunner Arcade.
  * Endless runner with lane-based movement -- the player stays in place
  * and the world scrolls past. Only Y-axis movement for lane switching.
  */
 UCLASS(config=Game)
-class AStateRunner_ArcadeCharacter : public ACharacter
+class AStateRunner_ArcadeCharacter : public ACharacter, public IGameplaySimulated
 {
 	GENERATED_BODY()
 
@@ -60,6 +74,12 @@ public:
 	/** Called every frame */
 	virtual void Tick(float DeltaTime) override;
 
+	/** Fixed-step mode: advance rise/lane/jump/slide by one step */
+	virtual void SimulateStep(float StepSeconds) override;
+
+	/** Fixed-step mode: draw the runner between its last two steps, then re-lock cameras */
+	virtual void PostSimulate(float Alpha, int32 StepsThisFrame) override;
+
 protected:
 
 	/** Called when the game starts or when spawned */
@@ -68,6 +88,9 @@ protected:
 	/** Called when actor is being removed from the level */
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
+	/** Late-latch mode: order the controller's input processing ahead of movement and scrolling */
+	virtual void PossessedBy(AController* NewController) override;
+
 	/** Initialize input action bindings */
 	virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
 
@@ -114,10 +137,21 @@ protected:
 	/** 
 	 * Locked X position (player never moves forward/backward).
 	 * World scrolls in negative X direction to create movement illusion.
+	 * In EScrollMode::MoveRunner this is relative to RunnerTrackOffset instead.
 	 */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Position Lock")
 	float LockedXPosition = -5000.0f;
 
+	/**
+	 * Distance the runner has advanced along +X since the last origin rebase.
+	 * Always 0 in the default MoveWorld scroll mode. Driven by UWorldScrollComponent.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category="Position Lock")
+	float RunnerTrackOffset = 0.0f;
+
+	/** Effective locked X (LockedXPosition + RunnerTrackOffset) */
+	float GetLockedX() const { return LockedXPosition + RunnerTrackOffset; }
+
 	/** 
 	 * Base Z position (height). Jump will offset from this value in Phase 2.
 	 */
@@ -371,6 +405,17 @@ public:
 	UFUNCTION(BlueprintPure, Category="Lane System")
 	bool IsLaneSwitching() const { return bIsLaneSwitching; }
 
+	/**
+	 * Advance (or rebase) the runner along the track.
+	 * Called by UWorldScrollComponent in MoveRunner scroll mode; moves X only.
+	 * 
+	 * @param NewOffset Distance past LockedXPosition along +X
+	 */
+	void SetRunnerTrackOffset(float NewOffset);
+
+	/** Current runner offset along +X (0 in MoveWorld scroll mode) */
+	float GetRunnerTrackOffset() const { return RunnerTrackOffset; }
+
 protected:
 
 	/** Process lane switching interpolation - called from Tick when switching */
@@ -474,6 +519,157 @@ protected:
 	/** Check if any active movement is happening (jump, slide, or lane switch) */
 	bool IsAnyMovementActive() const;
 
+	/** Run the active rise/lane/jump/slide processors (from Tick, or SimulateStep in fixed-step mode) */
+	void ProcessMovement(float DeltaTime);
+
+	/** True when UGameplaySimulationSubsystem drives movement (Tick only handles the camera) */
+	bool bSimulationDriven = false;
+
+	/** A step moved the runner since the last PostSimulate */
+	bool bSimulatedMovementThisFrame = false;
+
+	// --- Render Interpolation ---
+	// Fixed-step mode draws the runner at Lerp(previous step, latest step, Alpha) in Y/Z, like
+	// the world scroll; X stays locked. Each step first snaps back to the latest simulated
+	// location so movement and contact resolution never see an interpolated position.
+
+	/** Runner location before and after the latest step */
+	FVector PreviousSimLocation = FVector::ZeroVector;
+	FVector CurrentSimLocation = FVector::ZeroVector;
+
+	/** Location PostSimulate drew the runner at (valid while bRenderInterpolated) */
+	FVector RenderLocation = FVector::ZeroVector;
+
+	/** The actor sits at RenderLocation rather than its simulated location */
+	bool bRenderInterpolated = false;
+
+	/** Put the runner back on CurrentSimLocation if PostSimulate moved it and nothing else has since */
+	void RestoreSimulatedLocation();
+
+	// --- Pending Transform ---
+	// Movement processors and Start*/End* functions write here; CommitPendingTransform()
+	// applies it once at the end of the tick (or step), and EnforceCameraLaneLock() poses
+	// the cameras from the result -- one actor move and overlap update per frame.
+
+	/** Runner location built up by this tick's movement (valid while bHasPendingLocation) */
+	FVector PendingLocation = FVector::ZeroVector;
+
+	/** Something wrote PendingLocation since the last commit */
+	bool bHasPendingLocation = false;
+
+	/** Capsule half height to apply at the next commit (slide start/end); negative = unchanged */
+	float PendingCapsuleHalfHeight = -1.0f;
+
+	/** Slide Z compensation currently applied to the mesh's relative location */
+	float MeshSlideCompensation = 0.0f;
+
+	/** Slide Z compensation currently applied to CameraBoom's relative location */
+	float BoomSlideCompensation = 0.0f;
+
+	/** PendingLocation if set this tick, else the actor's simulated location */
+	FVector GetPendingLocation() const;
+
+	/** Stage a runner location for the next commit (X is re-locked at commit) */
+	void SetPendingLocation(const FVector& NewLocation);
+
+	/** Apply the pending capsule height, slide mesh compensation and location in one pass */
+	void CommitPendingTransform();
+
+	/** Make sure movement gets processed: enables tick unless the simulation subsystem drives movement */
+	void RequestMovementUpdate();
+
+	// --- Input Latency ---
+
+	/**
+	 * Late-latch lane/jump/slide presses: the press handler runs this frame's movement and
+	 * commits it immediately instead of leaving the new state for the next Tick, and the
+	 * controller's input processing is ordered ahead of this Tick and the scroll pass.
+	 * Fixed-step mode already steps after input every frame, so only the ordering applies there.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Input")
+	bool bLateLatchInput = false;
+
+	/** FPlatformTime of the oldest accepted press no commit has reacted to yet (0 = none) */
+	double PendingInputTime = 0.0;
+
+	/** Press whose reaction was committed, waiting for the viewport to draw it (0 = none) */
+	double ReactedInputTime = 0.0;
+
+	/** Input-to-step latency of ReactedInputTime */
+	float ReactedInputToStepMs = 0.0f;
+
+	/** GFrameCounter of the last frame movement was processed (Tick or late-latched press) */
+	uint64 LastMovementFrame = 0;
+
+	/** Binding on the game viewport's OnEndDraw */
+	FDelegateHandle ViewportEndDrawHandle;
+
+	/** Lane switch / jump / slide / fast fall flags packed, to tell whether a press was accepted */
+	uint8 GetMovementStateBits() const;
+
+	/**
+	 * Called by press handlers after the Start* call. If the press changed movement state,
+	 * timestamp it and (bLateLatchInput) apply it this frame; if it was refused because
+	 * another move is still running, buffer it.
+	 *
+	 * @param Action Which press this was
+	 * @param InputTime FPlatformTime when the handler was entered
+	 * @param StateBitsBefore GetMovementStateBits() before the Start* call
+	 */
+	void OnMovementInput(EBufferedInput Action, double InputTime, uint8 StateBitsBefore);
+
+	// --- Input Buffer ---
+
+	/**
+	 * Presses refused while a lane switch, jump or slide is still running are kept this long
+	 * (seconds) and fire at the first tick/step where they're accepted, e.g. a lane switch as
+	 * soon as the previous one settles. 0 = no buffering.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Input", meta=(ClampMin="0.0", ClampMax="0.5"))
+	float InputBufferWindow = 0.15f;
+
+	struct FBufferedInputEntry
+	{
+		EBufferedInput Action = EBufferedInput::Jump;
+
+		/** Gameplay-clock time of the press */
+		double Time = 0.0;
+	};
+
+	/** Most presses held at once (one per action, in press order) */
+	static constexpr int32 InputBufferCapacity = 4;
+
+	/** Pending presses, oldest first. Fixed storage -- buffering never allocates. */
+	FBufferedInputEntry InputBuffer[InputBufferCapacity];
+
+	/** Valid entries at the front of InputBuffer */
+	int32 InputBufferCount = 0;
+
+	/** Clock the buffer window is measured on (gameplay timeline, so it's deterministic and pauses) */
+	double GetInputBufferTime() const;
+
+	/** Queue a refused press, replacing an older press of the same action */
+	void BufferMovementInput(EBufferedInput Action);
+
+	/** Drop a queued press of this action, if any */
+	void RemoveBufferedInput(EBufferedInput Action);
+
+	/** Drop everything queued */
+	void ClearInputBuffer() { InputBufferCount = 0; }
+
+	/** Expire stale presses and fire the ones that are now accepted, oldest first */
+	void ProcessInputBuffer();
+
+	/**
+	 * Run the Start* function for an action.
+	 *
+	 * @return True if it changed movement state (the press was accepted)
+	 */
+	bool TryMovementAction(EBufferedInput Action);
+
+	/** Viewport finished drawing: close out the reacted input's present latency */
+	void OnViewportEndDraw();
+
 	// --- Overclock System Functions ---
 
 protected:
@@ -484,6 +680,24 @@ protected:
 	/** Input callback for OVERCLOCK released */
 	void OnOverclockReleased();
 
+	// --- Autopilot and Replay ---
+
+public:
+
+	/** Run a recorded press/release through the same handler a live one goes through (URunReplayComponent) */
+	void ApplyReplayInput(ERunReplayInput Input, bool bPressed);
+
+protected:
+
+	/**
+	 * Offer a player press/release to the GameMode's autopilot, then its replay component.
+	 * True if one used it up (attract exit, benchmark, replay playback); otherwise the replay records it.
+	 */
+	bool ConsumePlayerInput(ERunReplayInput Input, bool bPressed);
+
+	/** Inside ApplyReplayInput -- the handler is fed by the replay, not the player */
+	bool bApplyingReplayInput = false;
+
 	// --- Intro Rise Effect ---
 
 protected:
@@ -684,7 +898,11 @@ protected:
 	/** Process camera zoom interpolation (called from Tick) */
 	void ProcessCameraZoom(float DeltaTime);
 
-	/** Counteract character Y/Z movement to keep cameras fixed on track */
+	/**
+	 * Camera pose for the committed runner location: slide compensation on CameraBoom, plus
+	 * (with bLockCameraToCenter) counteracting Y/Z movement to keep cameras fixed on track.
+	 * Booms are only moved if their location actually changes.
+	 */
 	void EnforceCameraLaneLock();
 
 	/** Input callback for camera switch - pressed (switch to top-down) */
@@ -5,6 +5,15 @@
 #include "ScoreSystemComponent.h"
 #include "LivesSystemComponent.h"
 #include "OverclockSystemComponent.h"
+#include "LaneCollisionComponent.h"
+#include "ShaderPrecacheComponent.h"
+#include "AutopilotComponent.h"
+#include "RunReplayComponent.h"
+#include "DifficultyDirectorComponent.h"
+#include "TrackSegmentManagerComponent.h"
+#include "PerformanceGovernorComponent.h"
+#include "VersusModeComponent.h"
+#include "RunSeedSubsystem.h"
 #include "StateRunner_Arcade.h"
 
 // --- Constructor ---
@@ -34,12 +43,116 @@ AStateRunner_ArcadeGameMode::AStateRunner_ArcadeGameMode()
 	// Create the OVERCLOCK System Component
 	// This component manages OVERCLOCK meter, activation, and bonuses
 	OverclockSystemComponent = CreateDefaultSubobject<UOverclockSystemComponent>(TEXT("OverclockSystemComponent"));
+
+	// Create the Lane Collision Component
+	// This component resolves runner/obstacle/pickup contacts without physics overlaps
+	LaneCollisionComponent = CreateDefaultSubobject<ULaneCollisionComponent>(TEXT("LaneCollisionComponent"));
+
+	// Create the Shader Precache Component
+	// This component compiles obstacle/pickup/theme pipelines before the run needs them
+	ShaderPrecacheComponent = CreateDefaultSubobject<UShaderPrecacheComponent>(TEXT("ShaderPrecacheComponent"));
+
+	// Create the Autopilot Component
+	// This component plays the run for the perf benchmark and attract mode
+	AutopilotComponent = CreateDefaultSubobject<UAutopilotComponent>(TEXT("AutopilotComponent"));
+
+	// Create the Run Replay Component
+	// This component records each run's inputs and plays replays and ghosts back
+	RunReplayComponent = CreateDefaultSubobject<URunReplayComponent>(TEXT("RunReplayComponent"));
+
+	// Create the Difficulty Director Component
+	// This component bakes the difficulty curves every other system reads
+	DifficultyDirectorComponent = CreateDefaultSubobject<UDifficultyDirectorComponent>(TEXT("DifficultyDirectorComponent"));
+
+	// Create the Track Segment Manager Component
+	// This component pools track segments and spawns them at a speed-scaled horizon
+	TrackSegmentManagerComponent = CreateDefaultSubobject<UTrackSegmentManagerComponent>(TEXT("TrackSegmentManagerComponent"));
+
+	// Create the Performance Governor Component
+	// This component scales quality down under OVERCLOCK / high speed to hold the frame time target
+	PerformanceGovernorComponent = CreateDefaultSubobject<UPerformanceGovernorComponent>(TEXT("PerformanceGovernorComponent"));
+
+	// Create the Versus Mode Component
+	// This component adds the second split-screen player and its own score, lives and OVERCLOCK
+	VersusModeComponent = CreateDefaultSubobject<UVersusModeComponent>(TEXT("VersusModeComponent"));
+}
+
+// --- Loading ---
+
+void AStateRunner_ArcadeGameMode::PostLoad()
+{
+	Super::PostLoad();
+
+#if WITH_EDITORONLY_DATA
+	// Blueprints tuned before the difficulty director keep their ramps: the systems' old
+	// settings are rebuilt as director curves (saved with the Blueprint on its next save)
+	if (DifficultyDirectorComponent)
+	{
+		if (WorldScrollComponent)
+		{
+			WorldScrollComponent->MigrateDeprecatedDifficulty(*DifficultyDirectorComponent);
+		}
+		if (ObstacleSpawnerComponent)
+		{
+			ObstacleSpawnerComponent->MigrateDeprecatedDifficulty(*DifficultyDirectorComponent);
+		}
+		if (PickupSpawnerComponent)
+		{
+			PickupSpawnerComponent->MigrateDeprecatedDifficulty(*DifficultyDirectorComponent);
+		}
+	}
+#endif
+}
+
+// --- System Accessors ---
+
+UScoreSystemComponent* AStateRunner_ArcadeGameMode::GetScoreSystemComponent() const
+{
+	// A rival's contact handlers (Blueprint hit effects included) reach that rival's systems
+	const FVersusPlayerSystems* Contact = VersusModeComponent ? VersusModeComponent->GetContactSystems() : nullptr;
+	return Contact ? Contact->ScoreSystem.Get() : ScoreSystemComponent.Get();
+}
+
+ULivesSystemComponent* AStateRunner_ArcadeGameMode::GetLivesSystemComponent() const
+{
+	const FVersusPlayerSystems* Contact = VersusModeComponent ? VersusModeComponent->GetContactSystems() : nullptr;
+	return Contact ? Contact->LivesSystem.Get() : LivesSystemComponent.Get();
+}
+
+UOverclockSystemComponent* AStateRunner_ArcadeGameMode::GetOverclockSystemComponent() const
+{
+	const FVersusPlayerSystems* Contact = VersusModeComponent ? VersusModeComponent->GetContactSystems() : nullptr;
+	return Contact ? Contact->OverclockSystem.Get() : OverclockSystemComponent.Get();
 }
 
 // --- Begin Play ---
 
 void AStateRunner_ArcadeGameMode::BeginPlay()
 {
+	// Autopilot queues its benchmark seed BEFORE the run seed is picked
+	if (AutopilotComponent)
+	{
+		AutopilotComponent->ApplyLaunchOptions(OptionsString);
+	}
+
+	// Versus stands down under the autopilot, and replays stand down under versus
+	if (VersusModeComponent)
+	{
+		VersusModeComponent->ApplyLaunchOptions(OptionsString);
+	}
+
+	// A replay queues its recorded seed the same way (and stands down under the autopilot)
+	if (RunReplayComponent)
+	{
+		RunReplayComponent->ApplyLaunchOptions(OptionsString);
+	}
+
+	// Seed the run's random streams BEFORE Super::BeginPlay so the spawners start from them
+	if (URunSeedSubsystem* RunSeed = URunSeedSubsystem::Get(this))
+	{
+		RunSeed->BeginRun(OptionsString);
+	}
+
 	// Apply debug overrides BEFORE Super::BeginPlay so components see them during init
 	if (bDebugEndgameBlockageTest)
 	{
@@ -99,6 +212,38 @@ void AStateRunner_ArcadeGameMode::BeginPlay()
 	{
 		UE_LOG(LogStateRunner_Arcade, Error, TEXT("  - OverclockSystemComponent: MISSING!"));
 	}
+	if (!LaneCollisionComponent)
+	{
+		UE_LOG(LogStateRunner_Arcade, Error, TEXT("  - LaneCollisionComponent: MISSING!"));
+	}
+	if (!ShaderPrecacheComponent)
+	{
+		UE_LOG(LogStateRunner_Arcade, Error, TEXT("  - ShaderPrecacheComponent: MISSING!"));
+	}
+	if (!AutopilotComponent)
+	{
+		UE_LOG(LogStateRunner_Arcade, Error, TEXT("  - AutopilotComponent: MISSING!"));
+	}
+	if (!RunReplayComponent)
+	{
+		UE_LOG(LogStateRunner_Arcade, Error, TEXT("  - RunReplayComponent: MISSING!"));
+	}
+	if (!DifficultyDirectorComponent)
+	{
+		UE_LOG(LogStateRunner_Arcade, Error, TEXT("  - DifficultyDirectorComponent: MISSING!"));
+	}
+	if (!TrackSegmentManagerComponent)
+	{
+		UE_LOG(LogStateRunner_Arcade, Error, TEXT("  - TrackSegmentManagerComponent: MISSING!"));
+	}
+	if (!PerformanceGovernorComponent)
+	{
+		UE_LOG(LogStateRunner_Arcade, Error, TEXT("  - PerformanceGovernorComponent: MISSING!"));
+	}
+	if (!VersusModeComponent)
+	{
+		UE_LOG(LogStateRunner_Arcade, Error, TEXT("  - VersusModeComponent: MISSING!"));
+	}
 
 	// Scrolling and scoring are NOT started here — the game flow system
 	// (countdown, etc.) calls SetScrollingEnabled / StartScoring when ready.
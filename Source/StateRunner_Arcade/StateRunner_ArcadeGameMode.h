@@ -10,6 +10,14 @@ class UPickupSpawnerComponent;
 class UScoreSystemComponent;
 class ULivesSystemComponent;
 class UOverclockSystemComponent;
+class ULaneCollisionComponent;
+class UShaderPrecacheComponent;
+class UAutopilotComponent;
+class URunReplayComponent;
+class UDifficultyDirectorComponent;
+class UTrackSegmentManagerComponent;
+class UPerformanceGovernorComponent;
+class UVersusModeComponent;
 
 /**
  * Central game mode for StateRunner Arcade.
@@ -21,6 +29,9 @@ class AStateRunner_ArcadeGameMode : public AGameModeBase
 {
 	GENERATED_BODY()
 
+	/** Reads Player 1's score/lives/OVERCLOCK directly (the getters may be routed to a rival's contact) */
+	friend class UVersusModeComponent;
+
 	// --- System Components ---
 
 protected:
@@ -36,7 +47,7 @@ protected:
 	/**
 	 * Obstacle Spawner Component
 	 * Manages obstacle spawning, object pooling, and pattern generation.
-	 * Call SpawnObstaclesForSegment() when a new track segment is created.
+	 * SpawnObstaclesForSegment() is called per new track segment (by the TrackSegmentManagerComponent when it's on).
 	 */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Systems", meta=(AllowPrivateAccess="true"))
 	TObjectPtr<UObstacleSpawnerComponent> ObstacleSpawnerComponent;
@@ -44,7 +55,7 @@ protected:
 	/**
 	 * Pickup Spawner Component
 	 * Manages pickup (Data Packet) spawning and object pooling.
-	 * Call SpawnPickupsForSegment() when a new track segment is created.
+	 * SpawnPickupsForSegment() is called per new track segment (by the TrackSegmentManagerComponent when it's on).
 	 */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Systems", meta=(AllowPrivateAccess="true"))
 	TObjectPtr<UPickupSpawnerComponent> PickupSpawnerComponent;
@@ -70,11 +81,74 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Systems", meta=(AllowPrivateAccess="true"))
 	TObjectPtr<UOverclockSystemComponent> OverclockSystemComponent;
 
+	/**
+	 * Lane Collision Component
+	 * Resolves runner contacts with obstacles/pickups as lane interval tests (replaces physics overlaps).
+	 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Systems", meta=(AllowPrivateAccess="true"))
+	TObjectPtr<ULaneCollisionComponent> LaneCollisionComponent;
+
+	/**
+	 * Shader Precache Component
+	 * Compiles obstacle, pickup and theme material pipelines during the countdown/intro.
+	 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Systems", meta=(AllowPrivateAccess="true"))
+	TObjectPtr<UShaderPrecacheComponent> ShaderPrecacheComponent;
+
+	/**
+	 * Autopilot Component
+	 * Plays the run itself for the perf benchmark (-Autopilot) and the idle-cabinet attract mode.
+	 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Systems", meta=(AllowPrivateAccess="true"))
+	TObjectPtr<UAutopilotComponent> AutopilotComponent;
+
+	/**
+	 * Run Replay Component
+	 * Records each run's seed and inputs, plays a replay back through the runner, and drives the ghost.
+	 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Systems", meta=(AllowPrivateAccess="true"))
+	TObjectPtr<URunReplayComponent> RunReplayComponent;
+
+	/**
+	 * Difficulty Director Component
+	 * Authored difficulty curves baked into lookup tables: scroll speed, obstacle difficulty and counts,
+	 * breather gaps and pickup density all read from here.
+	 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Systems", meta=(AllowPrivateAccess="true"))
+	TObjectPtr<UDifficultyDirectorComponent> DifficultyDirectorComponent;
+
+	/**
+	 * Track Segment Manager Component
+	 * Pools the track segment actors and spawns each one, with its obstacles and pickups, at a
+	 * look-ahead horizon that scales with scroll speed.
+	 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Systems", meta=(AllowPrivateAccess="true"))
+	TObjectPtr<UTrackSegmentManagerComponent> TrackSegmentManagerComponent;
+
+	/**
+	 * Performance Governor Component
+	 * Watches game thread and GPU frame time during OVERCLOCK and high speed, and steps pickup
+	 * effects, distant detail, post-process and resolution down (and back up) to hold the target.
+	 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Systems", meta=(AllowPrivateAccess="true"))
+	TObjectPtr<UPerformanceGovernorComponent> PerformanceGovernorComponent;
+
+	/**
+	 * Versus Mode Component
+	 * Two-player split-screen on one shared track: adds the second local player and its own
+	 * score, lives and OVERCLOCK, while scrolling, spawning and pools stay single.
+	 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Systems", meta=(AllowPrivateAccess="true"))
+	TObjectPtr<UVersusModeComponent> VersusModeComponent;
+
 public:
 	
 	/** Constructor */
 	AStateRunner_ArcadeGameMode();
 
+	/** Moves difficulty settings saved before the DifficultyDirectorComponent onto its curves */
+	virtual void PostLoad() override;
+
 	// --- System Accessors ---
 
 public:
@@ -109,29 +183,104 @@ public:
 	/**
 	 * Get the Score System Component.
 	 * Manages score tracking and high score persistence.
+	 * Player 1's -- or, while a versus rival's obstacle/pickup contact is handled, that rival's.
 	 * 
 	 * @return Score System Component (never null after construction)
 	 */
 	UFUNCTION(BlueprintPure, Category="Systems")
-	UScoreSystemComponent* GetScoreSystemComponent() const { return ScoreSystemComponent; }
+	UScoreSystemComponent* GetScoreSystemComponent() const;
 
 	/**
 	 * Get the Lives System Component.
 	 * Manages player lives, damage, and invulnerability.
+	 * Player 1's -- or, while a versus rival's obstacle/pickup contact is handled, that rival's.
 	 * 
 	 * @return Lives System Component (never null after construction)
 	 */
 	UFUNCTION(BlueprintPure, Category="Systems")
-	ULivesSystemComponent* GetLivesSystemComponent() const { return LivesSystemComponent; }
+	ULivesSystemComponent* GetLivesSystemComponent() const;
 
 	/**
 	 * Get the OVERCLOCK System Component.
 	 * Manages OVERCLOCK meter and activation state.
+	 * Player 1's -- or, while a versus rival's obstacle/pickup contact is handled, that rival's.
 	 * 
 	 * @return OVERCLOCK System Component (never null after construction)
 	 */
 	UFUNCTION(BlueprintPure, Category="Systems")
-	UOverclockSystemComponent* GetOverclockSystemComponent() const { return OverclockSystemComponent; }
+	UOverclockSystemComponent* GetOverclockSystemComponent() const;
+
+	/**
+	 * Get the Lane Collision Component.
+	 * Resolves runner contacts when analytic collision is enabled.
+	 * 
+	 * @return Lane Collision Component (never null after construction)
+	 */
+	UFUNCTION(BlueprintPure, Category="Systems")
+	ULaneCollisionComponent* GetLaneCollisionComponent() const { return LaneCollisionComponent; }
+
+	/**
+	 * Get the Shader Precache Component.
+	 * Reports whether the pre-run pipeline precache is still running.
+	 * 
+	 * @return Shader Precache Component (never null after construction)
+	 */
+	UFUNCTION(BlueprintPure, Category="Systems")
+	UShaderPrecacheComponent* GetShaderPrecacheComponent() const { return ShaderPrecacheComponent; }
+
+	/**
+	 * Get the Autopilot Component.
+	 * Reports whether the run is being played by the benchmark / attract bot.
+	 * 
+	 * @return Autopilot Component (never null after construction)
+	 */
+	UFUNCTION(BlueprintPure, Category="Systems")
+	UAutopilotComponent* GetAutopilotComponent() const { return AutopilotComponent; }
+
+	/**
+	 * Get the Run Replay Component.
+	 * Records player input for replays and reports whether a replay is playing back.
+	 * 
+	 * @return Run Replay Component (never null after construction)
+	 */
+	UFUNCTION(BlueprintPure, Category="Systems")
+	URunReplayComponent* GetRunReplayComponent() const { return RunReplayComponent; }
+
+	/**
+	 * Get the Difficulty Director Component.
+	 * Scroll speed, difficulty and density lookups for every system and the HUD.
+	 * 
+	 * @return Difficulty Director Component (never null after construction)
+	 */
+	UFUNCTION(BlueprintPure, Category="Systems")
+	UDifficultyDirectorComponent* GetDifficultyDirectorComponent() const { return DifficultyDirectorComponent; }
+
+	/**
+	 * Get the Track Segment Manager Component.
+	 * Lays the track and triggers segment content (when its TrackSegmentClass is set).
+	 * 
+	 * @return Track Segment Manager Component (never null after construction)
+	 */
+	UFUNCTION(BlueprintPure, Category="Systems")
+	UTrackSegmentManagerComponent* GetTrackSegmentManagerComponent() const { return TrackSegmentManagerComponent; }
+
+	/**
+	 * Get the Performance Governor Component.
+	 * Trades quality for frame time under OVERCLOCK / high speed, per the settings menu preset.
+	 * 
+	 * @return Performance Governor Component (never null after construction)
+	 */
+	UFUNCTION(BlueprintPure, Category="Systems")
+	UPerformanceGovernorComponent* GetPerformanceGovernorComponent() const { return PerformanceGovernorComponent; }
+
+	/**
+	 * Get the Versus Mode Component.
+	 * Reports whether this is a two-player match and finds each player's own systems.
+	 * 
+	 * @return Versus Mode Component (never null after construction)
+	 */
+	UFUNCTION(BlueprintPure, Category="Systems")
+	UVersusModeComponent* GetVersusModeComponent() const { return VersusModeComponent; }
 
 	// --- Debug Configuration ---
 
@@ -1,9 +1,16 @@
 #include "StateRunner_ArcadePlayerController.h"
 #include "EnhancedInputSubsystems.h"
+#include "Engine/Engine.h"
+#include "Engine/GameViewportClient.h"
 #include "Engine/LocalPlayer.h"
+#include "EngineUtils.h"
+#include "GameFramework/WorldSettings.h"
+#include "Components/AudioComponent.h"
 #include "InputMappingContext.h"
-#include "Blueprint/UserWidget.h"
+#include "GameplaySimulationSubsystem.h"
+#include "DisplaySettingsSubsystem.h"
 #include "StateRunner_Arcade.h"
+#include "TimerManager.h"
 #include "Widgets/Input/SVirtualJoystick.h"
 
 void AStateRunner_ArcadePlayerController::BeginPlay()
@@ -28,6 +35,22 @@ void AStateRunner_ArcadePlayerController::BeginPlay()
 		}
 
 	}
+
+	// Spread menu construction over the first frames of the level
+	if (IsLocalPlayerController() && PreconstructedWidgetClasses.Num() > 0)
+	{
+		NextPreconstructIndex = 0;
+		GetWorldTimerManager().SetTimerForNextTick(this, &AStateRunner_ArcadePlayerController::PreconstructNextWidget);
+	}
+}
+
+void AStateRunner_ArcadePlayerController::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// The frame cap and viewport flag outlive the world, so never leave them set
+	QuiescenceRequests.Reset();
+	UpdateQuiescence();
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void AStateRunner_ArcadePlayerController::SetupInputComponent()
@@ -62,3 +85,246 @@ bool AStateRunner_ArcadePlayerController::ShouldUseTouchControls() const
 	// are we on a mobile platform? Should we force touch?
 	return SVirtualJoystick::ShouldDisplayTouchInterface() || bForceTouchControls;
 }
+
+// --- Widget Cache ---
+
+UUserWidget* AStateRunner_ArcadePlayerController::GetCachedWidget(TSubclassOf<UUserWidget> WidgetClass)
+{
+	if (!WidgetClass)
+	{
+		return nullptr;
+	}
+
+	if (TObjectPtr<UUserWidget>* Cached = CachedWidgets.Find(WidgetClass.Get()))
+	{
+		if (*Cached)
+		{
+			return *Cached;
+		}
+	}
+
+	STATERUNNER_FRAME_EVENT(WidgetConstructed);
+	UUserWidget* Widget = CreateWidget<UUserWidget>(this, WidgetClass);
+	if (!Widget)
+	{
+		UE_LOG(LogStateRunner_Arcade, Error, TEXT("PlayerController: Could not create widget %s"), *WidgetClass->GetName());
+		return nullptr;
+	}
+
+	CachedWidgets.Add(WidgetClass.Get(), Widget);
+	return Widget;
+}
+
+void AStateRunner_ArcadePlayerController::PreconstructNextWidget()
+{
+	// Skip entries already built (a menu opened before its turn, or a duplicate entry)
+	while (PreconstructedWidgetClasses.IsValidIndex(NextPreconstructIndex))
+	{
+		const TSubclassOf<UUserWidget> WidgetClass = PreconstructedWidgetClasses[NextPreconstructIndex++];
+		if (WidgetClass && !CachedWidgets.Contains(WidgetClass.Get()))
+		{
+			GetCachedWidget(WidgetClass);
+			break;
+		}
+	}
+
+	if (PreconstructedWidgetClasses.IsValidIndex(NextPreconstructIndex))
+	{
+		GetWorldTimerManager().SetTimerForNextTick(this, &AStateRunner_ArcadePlayerController::PreconstructNextWidget);
+	}
+	else
+	{
+		UE_LOG(LogStateRunner_Arcade, Log, TEXT("PlayerController: %d menu widgets preconstructed"), CachedWidgets.Num());
+	}
+}
+
+// --- Menu Quiescence ---
+
+void AStateRunner_ArcadePlayerController::EnterMenuQuiescence(UObject* Requester, bool bHidesWorld, bool bCapsFrameRate)
+{
+	if (!Requester)
+	{
+		return;
+	}
+
+	FQuiescenceRequest* Existing = QuiescenceRequests.FindByPredicate([Requester](const FQuiescenceRequest& Request)
+	{
+		return Request.Requester.Get() == Requester;
+	});
+
+	if (Existing)
+	{
+		Existing->bHidesWorld = bHidesWorld;
+		Existing->bCapsFrameRate = bCapsFrameRate;
+	}
+	else
+	{
+		QuiescenceRequests.Add({ Requester, bHidesWorld, bCapsFrameRate });
+	}
+
+	UpdateQuiescence();
+}
+
+void AStateRunner_ArcadePlayerController::ExitMenuQuiescence(UObject* Requester)
+{
+	QuiescenceRequests.RemoveAll([Requester](const FQuiescenceRequest& Request)
+	{
+		return Request.Requester.Get() == Requester;
+	});
+
+	UpdateQuiescence();
+}
+
+void AStateRunner_ArcadePlayerController::UpdateQuiescence()
+{
+	QuiescenceRequests.RemoveAll([](const FQuiescenceRequest& Request)
+	{
+		return !Request.Requester.IsValid();
+	});
+
+	const bool bWantQuiescent = QuiescenceRequests.Num() > 0;
+	if (bWantQuiescent && !bQuiescent)
+	{
+		BeginQuiescence();
+	}
+	else if (!bWantQuiescent && bQuiescent)
+	{
+		EndQuiescence();
+	}
+
+	// Skip drawing the 3D scene only while an opaque full-screen menu is up
+	const bool bWantWorldHidden = QuiescenceRequests.ContainsByPredicate([](const FQuiescenceRequest& Request)
+	{
+		return Request.bHidesWorld;
+	});
+
+	if (bWantWorldHidden != bWorldRenderingDisabled)
+	{
+		if (ULocalPlayer* LocalPlayer = GetLocalPlayer())
+		{
+			if (LocalPlayer->ViewportClient)
+			{
+				LocalPlayer->ViewportClient->bDisableWorldRendering = bWantWorldHidden;
+				bWorldRenderingDisabled = bWantWorldHidden;
+			}
+		}
+	}
+
+	// Cap the frame rate unless a shown menu measures it (the settings menu's readout)
+	const bool bWantFrameCap = bQuiescent && QuiescentMaxFPS > 0.0f
+		&& !QuiescenceRequests.ContainsByPredicate([](const FQuiescenceRequest& Request)
+		{
+			return !Request.bCapsFrameRate;
+		});
+
+	if (bWantFrameCap != bFrameRateCapped && GEngine)
+	{
+		bFrameRateCapped = bWantFrameCap;
+		if (bWantFrameCap)
+		{
+			GEngine->SetMaxFPS(QuiescentMaxFPS);
+		}
+		else if (const UDisplaySettingsSubsystem* DisplaySettings = UDisplaySettingsSubsystem::Get(this))
+		{
+			// Back to the current setting -- it may have changed while the menu was up
+			DisplaySettings->ApplySettings();
+		}
+	}
+}
+
+bool AStateRunner_ArcadePlayerController::ShouldKeepTicking(const AActor* Actor) const
+{
+	return Actor == this
+		|| Actor == PlayerCameraManager
+		|| Actor == MyHUD
+		|| Actor->IsA<AWorldSettings>()
+		|| Actor->PrimaryActorTick.bTickEvenWhenPaused;
+}
+
+void AStateRunner_ArcadePlayerController::BeginQuiescence()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	bQuiescent = true;
+
+	// Turn off every enabled gameplay tick, remembering exactly which ones so leaving
+	// quiescence doesn't wake anything that was already asleep (idle pooled actors, etc.)
+	TInlineComponentArray<UActorComponent*> Components;
+	for (TActorIterator<AActor> It(World); It; ++It)
+	{
+		AActor* Actor = *It;
+		if (!Actor || ShouldKeepTicking(Actor))
+		{
+			continue;
+		}
+
+		if (Actor->IsActorTickEnabled())
+		{
+			Actor->SetActorTickEnabled(false);
+			SuspendedActors.Add(Actor);
+		}
+
+		Actor->GetComponents(Components);
+		for (UActorComponent* Component : Components)
+		{
+			// Sounds (music, the death sting) and anything built to run through a pause keep going
+			if (Component && Component->IsComponentTickEnabled()
+				&& !Component->PrimaryComponentTick.bTickEvenWhenPaused
+				&& !Component->IsA<UAudioComponent>())
+			{
+				Component->SetComponentTickEnabled(false);
+				SuspendedComponents.Add(Component);
+			}
+		}
+	}
+
+	// Gameplay-clock timers and the fixed step (Real-clock timers like the music monitor keep running)
+	if (UGameplaySimulationSubsystem* Timeline = UGameplaySimulationSubsystem::Get(this))
+	{
+		Timeline->SetSuspended(true);
+	}
+
+	bPhysicsWasSimulating = World->bShouldSimulatePhysics;
+	World->bShouldSimulatePhysics = false;
+
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("PlayerController: Quiescent (%d actor ticks, %d component ticks suspended)"),
+		SuspendedActors.Num(), SuspendedComponents.Num());
+}
+
+void AStateRunner_ArcadePlayerController::EndQuiescence()
+{
+	bQuiescent = false;
+
+	for (const TWeakObjectPtr<AActor>& Actor : SuspendedActors)
+	{
+		if (Actor.IsValid())
+		{
+			Actor->SetActorTickEnabled(true);
+		}
+	}
+	for (const TWeakObjectPtr<UActorComponent>& Component : SuspendedComponents)
+	{
+		if (Component.IsValid())
+		{
+			Component->SetComponentTickEnabled(true);
+		}
+	}
+	SuspendedActors.Reset();
+	SuspendedComponents.Reset();
+
+	if (UGameplaySimulationSubsystem* Timeline = UGameplaySimulationSubsystem::Get(this))
+	{
+		Timeline->SetSuspended(false);
+	}
+
+	if (UWorld* World = GetWorld())
+	{
+		World->bShouldSimulatePhysics = bPhysicsWasSimulating;
+	}
+
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("PlayerController: Left quiescence"));
+}
@@ -2,14 +2,15 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/PlayerController.h"
+#include "Blueprint/UserWidget.h"
+#include "StateRunner_Arcade.h"
 #include "StateRunner_ArcadePlayerController.generated.h"
 
 class UInputMappingContext;
-class UUserWidget;
 
 /**
  *  Basic PlayerController class for a third person game
- *  Manages input mappings
+ *  Manages input mappings, the menu widget cache and menu-mode world quiescence
  */
 UCLASS(abstract)
 class AStateRunner_ArcadePlayerController : public APlayerController
@@ -41,10 +42,140 @@ protected:
 	/** Gameplay initialization */
 	virtual void BeginPlay() override;
 
+	/** Restores anything quiescence changed outside the world (frame cap, world rendering) */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	/** Input mapping context setup */
 	virtual void SetupInputComponent() override;
 
 	/** Returns true if the player should use UMG touch controls */
 	bool ShouldUseTouchControls() const;
 
+	// --- Widget Cache ---
+	// Menus are created once per controller and reused: Open* adds the cached instance to the
+	// viewport and Close* removes it. NativeConstruct/NativeDestruct still run on every add/remove,
+	// so each menu resets its focus and bindings on show without rebuilding its widget tree.
+
+protected:
+
+	/**
+	 * Menus to construct ahead of time (pause menu, game over, settings, leaderboard, ...).
+	 * Built one per frame after BeginPlay, so the first open mid-session doesn't stall.
+	 */
+	UPROPERTY(EditAnywhere, Category="UI|Widget Cache")
+	TArray<TSubclassOf<UUserWidget>> PreconstructedWidgetClasses;
+
+	/** One instance per widget class, kept alive for the controller's lifetime */
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UClass>, TObjectPtr<UUserWidget>> CachedWidgets;
+
+	/** Next PreconstructedWidgetClasses entry to build */
+	int32 NextPreconstructIndex = 0;
+
+	/** Build the next queued widget and schedule the one after for the next frame */
+	void PreconstructNextWidget();
+
+public:
+
+	/**
+	 * Cached instance of WidgetClass, creating it on first use.
+	 * The caller owns adding it to / removing it from the viewport.
+	 */
+	UFUNCTION(BlueprintCallable, Category="UI|Widget Cache", meta=(DeterminesOutputType="WidgetClass"))
+	UUserWidget* GetCachedWidget(TSubclassOf<UUserWidget> WidgetClass);
+
+	/**
+	 * Menu widgets use this instead of CreateWidget: the owning controller's cached instance,
+	 * or a fresh widget if the owner isn't an arcade controller (e.g. a menu-level controller).
+	 */
+	template <typename WidgetT>
+	static WidgetT* GetOrCreateWidget(APlayerController* OwningPlayer, TSubclassOf<WidgetT> WidgetClass)
+	{
+		if (!WidgetClass)
+		{
+			return nullptr;
+		}
+
+		if (AStateRunner_ArcadePlayerController* ArcadeController = Cast<AStateRunner_ArcadePlayerController>(OwningPlayer))
+		{
+			return Cast<WidgetT>(ArcadeController->GetCachedWidget(WidgetClass.Get()));
+		}
+		STATERUNNER_FRAME_EVENT(WidgetConstructed);
+		return CreateWidget<WidgetT>(OwningPlayer, WidgetClass);
+	}
+
+	// --- Menu Quiescence ---
+	// While any full-screen menu is up the world is quiescent: every gameplay actor and
+	// component tick is disabled, the gameplay timeline is suspended, physics stops stepping
+	// and the frame rate is capped (unless a shown menu opts out). Menus request it on
+	// construct and release it on destruct; the state is entered on the first request and
+	// left when the last one is released.
+
+protected:
+
+	/** Frame rate cap while quiescent (0 = leave the current cap) */
+	UPROPERTY(EditAnywhere, Category="UI|Quiescence", meta=(ClampMin="0.0"))
+	float QuiescentMaxFPS = 30.0f;
+
+	struct FQuiescenceRequest
+	{
+		TWeakObjectPtr<UObject> Requester;
+
+		/** The requester covers the whole screen, so the 3D scene needn't be drawn */
+		bool bHidesWorld = false;
+
+		/** The requester lets the frame rate drop to QuiescentMaxFPS */
+		bool bCapsFrameRate = true;
+	};
+
+	/** Active requests (usually one menu, plus a popup on top) */
+	TArray<FQuiescenceRequest> QuiescenceRequests;
+
+	/** Actors and components whose ticks quiescence turned off (and must turn back on) */
+	TArray<TWeakObjectPtr<AActor>> SuspendedActors;
+	TArray<TWeakObjectPtr<UActorComponent>> SuspendedComponents;
+
+	bool bQuiescent = false;
+
+	/** World physics setting before quiescence */
+	bool bPhysicsWasSimulating = false;
+
+	/** QuiescentMaxFPS is in force (the display settings' cap is re-applied when it lifts) */
+	bool bFrameRateCapped = false;
+
+	/** World rendering is currently switched off by quiescence */
+	bool bWorldRenderingDisabled = false;
+
+	/** Disable gameplay ticks, timeline and physics */
+	void BeginQuiescence();
+
+	/** Undo BeginQuiescence */
+	void EndQuiescence();
+
+	/** Drop stale requests, then enter/leave quiescence, world rendering and the frame cap to match */
+	void UpdateQuiescence();
+
+	/** True for actors that must keep ticking through a menu (this controller, camera, HUD, pause-tickers) */
+	bool ShouldKeepTicking(const AActor* Actor) const;
+
+public:
+
+	/**
+	 * Ask for the world to go quiescent while Requester is shown. Requesting twice is a no-op.
+	 *
+	 * @param Requester Menu whose lifetime bounds the request
+	 * @param bHidesWorld Requester is opaque and full-screen (world rendering can be skipped)
+	 * @param bCapsFrameRate Requester allows QuiescentMaxFPS (off for menus that measure the frame rate)
+	 */
+	void EnterMenuQuiescence(UObject* Requester, bool bHidesWorld, bool bCapsFrameRate = true);
+
+	/** Release Requester's request */
+	void ExitMenuQuiescence(UObject* Requester);
+
+	/** True while any menu holds a quiescence request */
+	bool IsQuiescent() const { return bQuiescent; }
+
+	/** True while QuiescentMaxFPS overrides the display settings' frame rate cap */
+	bool IsFrameRateCapped() const { return bFrameRateCapped; }
+
 };
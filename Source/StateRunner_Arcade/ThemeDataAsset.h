@@ -98,6 +98,14 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Laser Pointer")
 	TObjectPtr<UMaterialInterface> LaserPointerMaterial;
 
+	/**
+	 * Laser color written to the theme parameter collection.
+	 * In collection mode the laser elements keep one shared material that reads this,
+	 * instead of swapping to LaserPointerMaterial.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Laser Pointer")
+	FLinearColor LaserPointerColor = FLinearColor(0.0f, 1.0f, 1.0f, 1.0f);
+
 	//=============================================================================
 	// OPTIONAL: ADDITIONAL ACCENT COLORS
 	//=============================================================================
@@ -0,0 +1,37 @@
+#include "ThemeRowWidget.h"
+#include "Components/TextBlock.h"
+#include "Components/Image.h"
+
+void UThemeRowWidget::NativeOnListItemObjectSet(UObject* ListItemObject)
+{
+	const UThemeListItem* Item = Cast<UThemeListItem>(ListItemObject);
+	if (!Item)
+	{
+		return;
+	}
+
+	if (Item->ThemeData)
+	{
+		if (ThemeNameText)
+		{
+			ThemeNameText->SetText(Item->ThemeData->DisplayName);
+		}
+		if (SwatchImage)
+		{
+			SwatchImage->SetColorAndOpacity(Item->ThemeData->CircuitEmissiveColor);
+		}
+	}
+
+	// A recycled row keeps the previous item's selection visuals until told otherwise
+	NativeOnItemSelectionChanged(IsListItemSelected());
+
+	OnThemeRowSet(Item->ThemeType, Item->ThemeData);
+}
+
+void UThemeRowWidget::NativeOnItemSelectionChanged(bool bIsSelected)
+{
+	SetRenderOpacity(bIsSelected ? 1.0f : UnselectedOpacity);
+	SetRenderScale(bIsSelected ? FVector2D(1.05f, 1.05f) : FVector2D(1.0f, 1.0f));
+
+	OnThemeRowSelectionChanged(bIsSelected);
+}
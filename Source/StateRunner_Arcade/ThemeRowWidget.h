@@ -0,0 +1,79 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Blueprint/UserWidget.h"
+#include "Blueprint/IUserObjectListEntry.h"
+#include "ThemeDataAsset.h"
+#include "ThemeRowWidget.generated.h"
+
+class UTextBlock;
+class UImage;
+
+/**
+ * List item for one theme in the theme selector.
+ */
+UCLASS(BlueprintType)
+class STATERUNNER_ARCADE_API UThemeListItem : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	UPROPERTY(BlueprintReadOnly, Category="Theme")
+	EThemeType ThemeType = EThemeType::Cyan;
+
+	UPROPERTY(BlueprintReadOnly, Category="Theme")
+	TObjectPtr<UThemeDataAsset> ThemeData;
+};
+
+/**
+ * Theme Row Widget
+ *
+ * Entry widget for UThemeSelectorWidget's ThemeList. Shows a theme's name and swatch and
+ * dims itself when not selected; the list view recycles these while scrolling.
+ *
+ * USAGE:
+ * 1. Create WBP_ThemeRow extending this class with ThemeNameText and (optionally) SwatchImage
+ * 2. Set it as the Entry Widget Class of the ThemeList list view in WBP_ThemeSelector
+ */
+UCLASS(Abstract, Blueprintable)
+class STATERUNNER_ARCADE_API UThemeRowWidget : public UUserWidget, public IUserObjectListEntry
+{
+	GENERATED_BODY()
+
+protected:
+
+	virtual void NativeOnListItemObjectSet(UObject* ListItemObject) override;
+	virtual void NativeOnItemSelectionChanged(bool bIsSelected) override;
+
+	// --- Row Widgets ---
+
+protected:
+
+	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Row")
+	TObjectPtr<UTextBlock> ThemeNameText;
+
+	/** Tinted with the theme's circuit color */
+	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Row")
+	TObjectPtr<UImage> SwatchImage;
+
+	// --- Configuration ---
+
+protected:
+
+	/** Opacity of rows that aren't selected */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Configuration", meta=(ClampMin="0.0", ClampMax="1.0"))
+	float UnselectedOpacity = 0.5f;
+
+	// --- Blueprint Events ---
+
+public:
+
+	/** Called after the row is bound to a theme */
+	UFUNCTION(BlueprintImplementableEvent, Category="Events")
+	void OnThemeRowSet(EThemeType ThemeType, UThemeDataAsset* ThemeData);
+
+	/** Called when the row gains or loses the selection (for focus animations) */
+	UFUNCTION(BlueprintImplementableEvent, Category="Events")
+	void OnThemeRowSelectionChanged(bool bIsSelected);
+};
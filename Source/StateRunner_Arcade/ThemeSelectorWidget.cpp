@@ -2,6 +2,8 @@
 #include "Components/Button.h"
 #include "Components/TextBlock.h"
 #include "Components/Image.h"
+#include "Components/ListView.h"
+#include "ThemeRowWidget.h"
 #include "ThemeSubsystem.h"
 #include "Kismet/GameplayStatics.h"
 #include "StateRunner_Arcade.h"
@@ -22,6 +24,16 @@ void UThemeSelectorWidget::NativeConstruct()
 		ThemeSubsystem = GI->GetSubsystem<UThemeSubsystem>();
 	}
 
+	// List mode replaces the fixed buttons
+	if (ThemeList)
+	{
+		Super::NativeConstruct();
+		SetupThemeList();
+
+		UE_LOG(LogStateRunner_Arcade, Log, TEXT("ThemeSelectorWidget: Constructed with %d themes in list"), ThemeItems.Num());
+		return;
+	}
+
 	// Register theme buttons BEFORE calling Super
 	if (ThemeButton_Cyan)
 	{
@@ -88,6 +100,25 @@ void UThemeSelectorWidget::NativeConstruct()
 
 void UThemeSelectorWidget::NativeDestruct()
 {
+	if (ThemeList)
+	{
+		ThemeList->OnItemClicked().RemoveAll(this);
+		ThemeList->OnItemSelectionChanged().RemoveAll(this);
+	}
+
+	// Drop the rows' refs so themes browsed past can be unloaded
+	for (UThemeListItem* Item : ThemeItems)
+	{
+		if (Item)
+		{
+			Item->ThemeData = nullptr;
+		}
+	}
+	if (ThemeSubsystem)
+	{
+		ThemeSubsystem->ReleaseUnusedThemes();
+	}
+
 	// Unbind button delegates
 	if (ThemeButton_Cyan)
 	{
@@ -117,6 +148,150 @@ void UThemeSelectorWidget::NativeDestruct()
 	Super::NativeDestruct();
 }
 
+FReply UThemeSelectorWidget::NativeOnKeyDown(const FGeometry& InGeometry, const FKeyEvent& InKeyEvent)
+{
+	if (!ThemeList)
+	{
+		return Super::NativeOnKeyDown(InGeometry, InKeyEvent);
+	}
+
+	const FKey Key = InKeyEvent.GetKey();
+
+	if (Key == EKeys::Up || Key == EKeys::Gamepad_DPad_Up)
+	{
+		MoveListSelection(-1);
+		return FReply::Handled();
+	}
+	if (Key == EKeys::Down || Key == EKeys::Gamepad_DPad_Down)
+	{
+		MoveListSelection(1);
+		return FReply::Handled();
+	}
+	if (Key == EKeys::Enter || Key == EKeys::SpaceBar || Key == EKeys::Gamepad_FaceButton_Bottom)
+	{
+		if (const UThemeListItem* Item = ThemeList->GetSelectedItem<UThemeListItem>())
+		{
+			SelectTheme(Item->ThemeType);
+		}
+		return FReply::Handled();
+	}
+
+	// Back and everything else go through the standard menu handling
+	return Super::NativeOnKeyDown(InGeometry, InKeyEvent);
+}
+
+//=============================================================================
+// THEME LIST
+//=============================================================================
+
+void UThemeSelectorWidget::SetupThemeList()
+{
+	if (!ThemeList || !ThemeSubsystem)
+	{
+		return;
+	}
+
+	// Build items once; the widget is cached between opens so this only runs the first time
+	if (ThemeItems.Num() == 0)
+	{
+		for (EThemeType ThemeType : ThemeSubsystem->GetAvailableThemes())
+		{
+			UThemeListItem* Item = NewObject<UThemeListItem>(this);
+			Item->ThemeType = ThemeType;
+			ThemeItems.Add(Item);
+		}
+	}
+
+	// Rows stream their theme in (swatch + name); cleared again in NativeDestruct
+	for (UThemeListItem* Item : ThemeItems)
+	{
+		if (!Item || Item->ThemeData)
+		{
+			continue;
+		}
+
+		TWeakObjectPtr<UThemeSelectorWidget> WeakThis(this);
+		TWeakObjectPtr<UThemeListItem> WeakItem(Item);
+		ThemeSubsystem->RequestThemeData(Item->ThemeType, [WeakThis, WeakItem](UThemeDataAsset* ThemeData)
+		{
+			if (!WeakThis.IsValid() || !WeakItem.IsValid() || !ThemeData)
+			{
+				return;
+			}
+			WeakItem->ThemeData = ThemeData;
+			if (WeakThis->ThemeList)
+			{
+				WeakThis->ThemeList->RegenerateAllEntries();
+			}
+		});
+	}
+
+	if (ThemeList->GetNumItems() != ThemeItems.Num())
+	{
+		ThemeList->SetListItems(ThemeItems);
+	}
+
+	ThemeList->OnItemClicked().RemoveAll(this);
+	ThemeList->OnItemSelectionChanged().RemoveAll(this);
+	ThemeList->OnItemClicked().AddUObject(this, &UThemeSelectorWidget::HandleThemeItemClicked);
+	ThemeList->OnItemSelectionChanged().AddUObject(this, &UThemeSelectorWidget::HandleThemeSelectionChanged);
+
+	// Start on the active theme
+	const EThemeType CurrentTheme = ThemeSubsystem->GetCurrentThemeType();
+	const int32 CurrentIndex = ThemeItems.IndexOfByPredicate([CurrentTheme](const UThemeListItem* Item)
+	{
+		return Item && Item->ThemeType == CurrentTheme;
+	});
+
+	if (ThemeItems.IsValidIndex(CurrentIndex))
+	{
+		ThemeList->SetSelectedIndex(CurrentIndex);
+		ThemeList->ScrollIndexIntoView(CurrentIndex);
+	}
+
+	UpdatePreview(CurrentTheme);
+}
+
+void UThemeSelectorWidget::MoveListSelection(int32 Delta)
+{
+	const int32 NumItems = ThemeItems.Num();
+	if (!ThemeList || NumItems == 0)
+	{
+		return;
+	}
+
+	const int32 Current = ThemeList->GetIndexForItem(ThemeList->GetSelectedItem());
+	int32 Next = (Current == INDEX_NONE) ? 0 : Current + Delta;
+
+	if (bWrapNavigation)
+	{
+		Next = (Next % NumItems + NumItems) % NumItems;
+	}
+	else
+	{
+		Next = FMath::Clamp(Next, 0, NumItems - 1);
+	}
+
+	ThemeList->SetSelectedIndex(Next);
+	ThemeList->ScrollIndexIntoView(Next);
+}
+
+void UThemeSelectorWidget::HandleThemeItemClicked(UObject* Item)
+{
+	if (const UThemeListItem* ThemeItem = Cast<UThemeListItem>(Item))
+	{
+		SelectTheme(ThemeItem->ThemeType);
+	}
+}
+
+void UThemeSelectorWidget::HandleThemeSelectionChanged(UObject* Item)
+{
+	if (const UThemeListItem* ThemeItem = Cast<UThemeListItem>(Item))
+	{
+		UpdatePreview(ThemeItem->ThemeType);
+	}
+}
+
 //=============================================================================
 // BUTTON CLICK HANDLERS
 //=============================================================================
@@ -206,12 +381,22 @@ void UThemeSelectorWidget::UpdatePreview(EThemeType ThemeType)
 		return;
 	}
 
-	UThemeDataAsset* ThemeData = ThemeSubsystem->GetThemeData(ThemeType);
-	if (!ThemeData)
+	PreviewedTheme = ThemeType;
+
+	// Resident themes call back immediately; otherwise the preview updates when it streams in
+	TWeakObjectPtr<UThemeSelectorWidget> WeakThis(this);
+	ThemeSubsystem->RequestThemeData(ThemeType, [WeakThis, ThemeType](UThemeDataAsset* ThemeData)
 	{
-		return;
-	}
+		// Ignore themes the player has already scrolled past
+		if (WeakThis.IsValid() && ThemeData && WeakThis->PreviewedTheme == ThemeType)
+		{
+			WeakThis->ShowPreview(ThemeData);
+		}
+	});
+}
 
+void UThemeSelectorWidget::ShowPreview(const UThemeDataAsset* ThemeData)
+{
 	// Update preview image color
 	if (ThemePreviewImage)
 	{
@@ -8,7 +8,9 @@
 class UButton;
 class UTextBlock;
 class UImage;
+class UListView;
 class UThemeSubsystem;
+class UThemeListItem;
 
 /**
  * Delegate broadcast when a theme is successfully selected (not cancelled).
@@ -32,6 +34,10 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnThemeApplied, const FString&, The
  * 2. Add BindWidget components: ThemeButton_Cyan, ThemeButton_Orange, etc.
  * 3. Reference this class in MainMenuWidget's ThemeSelectorWidgetClass
  * 4. Opens when player clicks/selects "Theme" button on main menu
+ *
+ * LIST MODE:
+ * Bind a ThemeList list view (entry class extending UThemeRowWidget) instead of the buttons to
+ * show every theme the subsystem has. Only the visible rows exist as widgets.
  */
 UCLASS(Abstract, Blueprintable)
 class STATERUNNER_ARCADE_API UThemeSelectorWidget : public UArcadeMenuWidget
@@ -46,6 +52,31 @@ protected:
 
 	virtual void NativeConstruct() override;
 	virtual void NativeDestruct() override;
+	virtual FReply NativeOnKeyDown(const FGeometry& InGeometry, const FKeyEvent& InKeyEvent) override;
+
+	//=============================================================================
+	// THEME LIST (Optional)
+	// Replaces the fixed buttons when bound
+	//=============================================================================
+
+protected:
+
+	/** Virtualized list of all available themes */
+	UPROPERTY(BlueprintReadWrite, meta=(BindWidgetOptional), Category="Theme List")
+	TObjectPtr<UListView> ThemeList;
+
+	/** One item per available theme, built once and reused across opens */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UThemeListItem>> ThemeItems;
+
+	/** Fill ThemeList (if needed) and select the current theme */
+	void SetupThemeList();
+
+	/** Move the list selection by Delta rows */
+	void MoveListSelection(int32 Delta);
+
+	void HandleThemeItemClicked(UObject* Item);
+	void HandleThemeSelectionChanged(UObject* Item);
 
 	//=============================================================================
 	// THEME BUTTON REFERENCES
@@ -180,12 +211,19 @@ protected:
 
 	/**
 	 * Update the preview elements to show a theme.
-	 * Called when focus changes between theme options.
+	 * Called when focus changes between theme options. Also streams the highlighted theme in,
+	 * so it's usually resident by the time the player confirms it.
 	 * 
 	 * @param ThemeType Theme to preview
 	 */
 	void UpdatePreview(EThemeType ThemeType);
 
+	/** Write a loaded theme into the preview elements */
+	void ShowPreview(const UThemeDataAsset* ThemeData);
+
+	/** Theme the preview is currently showing (or waiting on) */
+	EThemeType PreviewedTheme = EThemeType::Cyan;
+
 	/**
 	 * Get the theme type for a menu index.
 	 */
@@ -1,18 +1,23 @@
 #include "ThemeSubsystem.h"
 #include "Components/StaticMeshComponent.h"
 #include "Materials/MaterialInstanceDynamic.h"
-#include "GameFramework/GameUserSettings.h"
+#include "Materials/MaterialParameterCollection.h"
+#include "Materials/MaterialParameterCollectionInstance.h"
+#include "ArcadeSaveSubsystem.h"
 #include "StateRunner_Arcade.h"
 
 //=============================================================================
 // STATIC CONSTANTS
 //=============================================================================
 
-const FString UThemeSubsystem::ThemeConfigSection = TEXT("StateRunnerArcade.Theme");
-const FString UThemeSubsystem::ThemeConfigKey = TEXT("CurrentTheme");
-
 // Element index constants are defined in header
 
+const FName UThemeSubsystem::ParamCircuitEmissiveColor(TEXT("CircuitEmissiveColor"));
+const FName UThemeSubsystem::ParamCircuitEmissiveIntensity(TEXT("CircuitEmissiveIntensity"));
+const FName UThemeSubsystem::ParamLaserPointerColor(TEXT("LaserPointerColor"));
+const FName UThemeSubsystem::ParamPrimaryAccentColor(TEXT("PrimaryAccentColor"));
+const FName UThemeSubsystem::ParamSecondaryAccentColor(TEXT("SecondaryAccentColor"));
+
 //=============================================================================
 // SUBSYSTEM LIFECYCLE
 //=============================================================================
@@ -21,6 +26,9 @@ void UThemeSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 
+	// Saved theme preference lives in the unified save record
+	Collection.InitializeDependency<UArcadeSaveSubsystem>();
+
 	// Set up default asset paths if not already configured
 	if (ThemeAssetPaths.Num() == 0)
 	{
@@ -33,28 +41,61 @@ void UThemeSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 		ThemeAssetPaths.Add(EThemeType::Gold, FSoftObjectPath(TEXT("/Game/_DEVELOPER/Data/Themes/DA_Theme_Gold.DA_Theme_Gold")));
 	}
 
-	// Load theme assets from paths
-	LoadThemeAssets();
+	if (ThemeParameterCollectionPath.IsNull())
+	{
+		ThemeParameterCollectionPath = FSoftObjectPath(TEXT("/Game/_DEVELOPER/Data/Themes/MPC_Theme.MPC_Theme"));
+	}
+
+	LoadParameterCollection();
 
-	// Load saved theme preference
+	// Load saved theme preference (decides which theme streams in first)
 	LoadThemePreference();
 
-	if (ThemeAssets.Num() == 0)
+	if (IsUsingParameterCollection())
 	{
-		UE_LOG(LogStateRunner_Arcade, Error, TEXT("ThemeSubsystem: Initialized with theme %d but 0 assets loaded! Theme switching DISABLED."), 
+		PostWorldInitHandle = FWorldDelegates::OnPostWorldInitialization.AddUObject(this, &UThemeSubsystem::HandlePostWorldInitialization);
+	}
+
+	// Stream the current theme; it's applied when it lands
+	LoadThemeAssets();
+
+	if (GetAvailableThemes().Num() == 0)
+	{
+		UE_LOG(LogStateRunner_Arcade, Error, TEXT("ThemeSubsystem: Initialized with theme %d but no theme paths configured! Theme switching DISABLED."), 
 			static_cast<int32>(CurrentThemeType));
 	}
 	else
 	{
-		UE_LOG(LogStateRunner_Arcade, Log, TEXT("ThemeSubsystem: Initialized with theme %d, %d assets loaded"), 
-			static_cast<int32>(CurrentThemeType), ThemeAssets.Num());
+		UE_LOG(LogStateRunner_Arcade, Log, TEXT("ThemeSubsystem: Initialized with theme %d, %d themes available"), 
+			static_cast<int32>(CurrentThemeType), GetAvailableThemes().Num());
 	}
 }
 
 void UThemeSubsystem::Deinitialize()
 {
+	if (PostWorldInitHandle.IsValid())
+	{
+		FWorldDelegates::OnPostWorldInitialization.Remove(PostWorldInitHandle);
+		PostWorldInitHandle.Reset();
+	}
+
+	// Cancel streaming and let the themes go
+	for (TPair<EThemeType, TSharedPtr<FStreamableHandle>>& Pair : ThemeLoadHandles)
+	{
+		if (Pair.Value.IsValid())
+		{
+			Pair.Value->CancelHandle();
+		}
+	}
+	ThemeLoadHandles.Empty();
+	PendingThemeCallbacks.Empty();
+	ThemeAssets.Empty();
+
 	// Clear registered meshes
-	RegisteredMeshes.Empty();
+	MeshSlots.Empty();
+	FreeMeshSlots.Empty();
+	DenseMeshes.Empty();
+	MeshHandles.Empty();
 
 	UE_LOG(LogStateRunner_Arcade, Log, TEXT("ThemeSubsystem: Deinitialized"));
 
@@ -83,14 +124,47 @@ void UThemeSubsystem::SetCurrentTheme(EThemeType NewTheme, bool bApplyImmediatel
 	// Save preference
 	SaveThemePreference();
 
+	// Collection mode: the whole switch is these few writes
+	const bool bLoaded = IsThemeLoaded(NewTheme);
+	if (bLoaded && IsUsingParameterCollection())
+	{
+		ApplyThemeParameters(GetGameInstance()->GetWorld());
+	}
+
 	// Broadcast change
 	OnThemeChanged.Broadcast(NewTheme);
 
 	UE_LOG(LogStateRunner_Arcade, Log, TEXT("ThemeSubsystem: Theme changed from %d to %d"), 
 		static_cast<int32>(OldTheme), static_cast<int32>(NewTheme));
 
-	// Apply to all registered meshes if requested
-	if (bApplyImmediately)
+	if (!bLoaded)
+	{
+		// Not preloaded -- apply once it streams in, unless the player has moved on by then
+		RequestThemeData(NewTheme, [this, NewTheme, bApplyImmediately](UThemeDataAsset* ThemeData)
+		{
+			if (ThemeData && CurrentThemeType == NewTheme && (bApplyImmediately || IsUsingParameterCollection()))
+			{
+				ApplyCurrentTheme();
+			}
+		});
+	}
+	// Apply to all registered meshes if requested (nothing registered in collection mode)
+	else if (bApplyImmediately && !IsUsingParameterCollection())
+	{
+		RefreshAllThemedMeshes();
+	}
+
+	// The previous theme is no longer needed unless the selector is still showing it
+	ReleaseUnusedThemes();
+}
+
+void UThemeSubsystem::ApplyCurrentTheme()
+{
+	if (IsUsingParameterCollection())
+	{
+		ApplyThemeParameters(GetGameInstance()->GetWorld());
+	}
+	else
 	{
 		RefreshAllThemedMeshes();
 	}
@@ -104,15 +178,30 @@ UThemeDataAsset* UThemeSubsystem::GetThemeData(EThemeType ThemeType) const
 		return *FoundAsset;
 	}
 
-	UE_LOG(LogStateRunner_Arcade, Warning, TEXT("ThemeSubsystem: No theme data asset found for theme type %d"), 
+	// Normal for a theme that hasn't streamed in (see RequestThemeData)
+	UE_LOG(LogStateRunner_Arcade, Verbose, TEXT("ThemeSubsystem: Theme data for type %d not loaded"), 
 		static_cast<int32>(ThemeType));
 	return nullptr;
 }
 
 TArray<EThemeType> UThemeSubsystem::GetAvailableThemes() const
 {
+	// Everything that can be loaded, not just what's resident
 	TArray<EThemeType> AvailableThemes;
-	ThemeAssets.GetKeys(AvailableThemes);
+	for (const TPair<EThemeType, FSoftObjectPath>& Pair : ThemeAssetPaths)
+	{
+		if (Pair.Value.IsValid())
+		{
+			AvailableThemes.AddUnique(Pair.Key);
+		}
+	}
+	for (const TPair<EThemeType, TObjectPtr<UThemeDataAsset>>& Pair : ThemeAssets)
+	{
+		AvailableThemes.AddUnique(Pair.Key);
+	}
+
+	// Enum order, so the selector lists themes the same way every time
+	AvailableThemes.Sort();
 	return AvailableThemes;
 }
 
@@ -132,42 +221,165 @@ void UThemeSubsystem::RegisterThemeAsset(EThemeType ThemeType, UThemeDataAsset*
 
 void UThemeSubsystem::LoadThemeAssets()
 {
-	int32 LoadedCount = 0;
+	const EThemeType RequestedTheme = CurrentThemeType;
+	RequestThemeData(RequestedTheme, [this, RequestedTheme](UThemeDataAsset* ThemeData)
+	{
+		if (ThemeData && CurrentThemeType == RequestedTheme)
+		{
+			ApplyCurrentTheme();
+		}
+	});
+}
+
+//=============================================================================
+// STREAMING
+//=============================================================================
+
+void UThemeSubsystem::RequestThemeData(EThemeType ThemeType, TFunction<void(UThemeDataAsset*)>&& OnLoaded)
+{
+	// Most recently requested goes last (evicted last)
+	ThemeRequestOrder.Remove(ThemeType);
+	ThemeRequestOrder.Add(ThemeType);
 
-	for (const auto& Pair : ThemeAssetPaths)
+	if (UThemeDataAsset* Resident = GetThemeData(ThemeType))
 	{
-		EThemeType ThemeType = Pair.Key;
-		const FSoftObjectPath& AssetPath = Pair.Value;
+		if (OnLoaded)
+		{
+			OnLoaded(Resident);
+		}
+		return;
+	}
 
-		if (AssetPath.IsValid())
+	const FSoftObjectPath* AssetPath = ThemeAssetPaths.Find(ThemeType);
+	if (!AssetPath || !AssetPath->IsValid())
+	{
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("ThemeSubsystem: No asset path for theme type %d"), static_cast<int32>(ThemeType));
+		if (OnLoaded)
 		{
-			// Synchronously load the asset
-			// In shipping builds, TryLoad() fails if the asset wasn't cooked.
-			// Make sure theme directories are in DirectoriesToAlwaysCook (DefaultGame.ini).
-			UObject* LoadedObject = AssetPath.TryLoad();
-			if (UThemeDataAsset* ThemeData = Cast<UThemeDataAsset>(LoadedObject))
-			{
-				ThemeAssets.Add(ThemeType, ThemeData);
-				LoadedCount++;
-				UE_LOG(LogStateRunner_Arcade, Log, TEXT("ThemeSubsystem: Loaded theme asset for type %d: %s"),
-					static_cast<int32>(ThemeType), *ThemeData->GetName());
-			}
-			else
-			{
-				// Use Error severity so this is visible in shipping builds
-				UE_LOG(LogStateRunner_Arcade, Error, TEXT("ThemeSubsystem: FAILED to load theme asset at path: %s (Object: %s). Ensure /Game/_DEVELOPER/Data/Themes is in DirectoriesToAlwaysCook!"),
-					*AssetPath.ToString(), LoadedObject ? *LoadedObject->GetClass()->GetName() : TEXT("NULL"));
-			}
+			OnLoaded(nullptr);
 		}
+		return;
 	}
 
-	if (LoadedCount == 0)
+	if (OnLoaded)
 	{
-		UE_LOG(LogStateRunner_Arcade, Error, TEXT("ThemeSubsystem: ZERO theme assets loaded out of %d paths! Themes will NOT work. Check DirectoriesToAlwaysCook in DefaultGame.ini."), ThemeAssetPaths.Num());
+		PendingThemeCallbacks.FindOrAdd(ThemeType).Add(MoveTemp(OnLoaded));
+	}
+
+	// One request per theme; later callers just queue behind it
+	if (ThemeLoadHandles.Contains(ThemeType))
+	{
+		return;
+	}
+
+	TSharedPtr<FStreamableHandle> Handle = StreamableManager.RequestAsyncLoad(*AssetPath,
+		FStreamableDelegate::CreateUObject(this, &UThemeSubsystem::OnThemeStreamed, ThemeType));
+
+	// The handle keeps the asset resident until ReleaseUnusedThemes (skip it if it already failed)
+	if (Handle.IsValid() && (!Handle->HasLoadCompleted() || ThemeAssets.Contains(ThemeType)))
+	{
+		ThemeLoadHandles.Add(ThemeType, Handle);
+		TrimResidentThemes();
+	}
+}
+
+void UThemeSubsystem::PreloadTheme(EThemeType ThemeType)
+{
+	RequestThemeData(ThemeType, nullptr);
+}
+
+void UThemeSubsystem::OnThemeStreamed(EThemeType ThemeType)
+{
+	// Resolved from the path rather than the handle -- an already-loaded asset can complete
+	// before RequestAsyncLoad has returned the handle
+	UThemeDataAsset* ThemeData = nullptr;
+	if (const FSoftObjectPath* AssetPath = ThemeAssetPaths.Find(ThemeType))
+	{
+		ThemeData = Cast<UThemeDataAsset>(AssetPath->ResolveObject());
+	}
+
+	if (ThemeData)
+	{
+		ThemeAssets.Add(ThemeType, ThemeData);
+		UE_LOG(LogStateRunner_Arcade, Log, TEXT("ThemeSubsystem: Streamed theme asset for type %d: %s"),
+			static_cast<int32>(ThemeType), *ThemeData->GetName());
 	}
 	else
 	{
-		UE_LOG(LogStateRunner_Arcade, Log, TEXT("ThemeSubsystem: Loaded %d/%d theme assets"), LoadedCount, ThemeAssetPaths.Num());
+		// Use Error severity so this is visible in shipping builds
+		UE_LOG(LogStateRunner_Arcade, Error, TEXT("ThemeSubsystem: FAILED to load theme asset for type %d. Ensure /Game/_DEVELOPER/Data/Themes is in DirectoriesToAlwaysCook!"),
+			static_cast<int32>(ThemeType));
+		ThemeLoadHandles.Remove(ThemeType);
+	}
+
+	TArray<TFunction<void(UThemeDataAsset*)>> Callbacks;
+	PendingThemeCallbacks.RemoveAndCopyValue(ThemeType, Callbacks);
+	for (TFunction<void(UThemeDataAsset*)>& Callback : Callbacks)
+	{
+		Callback(ThemeData);
+	}
+}
+
+void UThemeSubsystem::ReleaseUnusedThemes()
+{
+	int32 ReleasedCount = 0;
+	for (auto It = ThemeLoadHandles.CreateIterator(); It; ++It)
+	{
+		// Keep the active theme and anything someone is still waiting on
+		if (It.Key() == CurrentThemeType || PendingThemeCallbacks.Contains(It.Key()))
+		{
+			continue;
+		}
+
+		if (It.Value().IsValid())
+		{
+			It.Value()->ReleaseHandle();
+		}
+		ThemeAssets.Remove(It.Key());
+		It.RemoveCurrent();
+		ReleasedCount++;
+	}
+
+	if (ReleasedCount > 0)
+	{
+		UE_LOG(LogStateRunner_Arcade, Log, TEXT("ThemeSubsystem: Released %d unused themes"), ReleasedCount);
+	}
+}
+
+void UThemeSubsystem::SetMaxResidentThemes(int32 MaxThemes)
+{
+	MaxResidentThemes = FMath::Max(MaxThemes, 0);
+	TrimResidentThemes();
+}
+
+void UThemeSubsystem::TrimResidentThemes()
+{
+	if (MaxResidentThemes <= 0)
+	{
+		return;
+	}
+
+	for (int32 i = 0; i < ThemeRequestOrder.Num() && ThemeLoadHandles.Num() > MaxResidentThemes; )
+	{
+		const EThemeType ThemeType = ThemeRequestOrder[i];
+
+		// Same exemptions as ReleaseUnusedThemes; the newest request is last, so it goes last
+		TSharedPtr<FStreamableHandle>* Handle = ThemeLoadHandles.Find(ThemeType);
+		if (!Handle || ThemeType == CurrentThemeType || PendingThemeCallbacks.Contains(ThemeType))
+		{
+			i++;
+			continue;
+		}
+
+		if (Handle->IsValid())
+		{
+			(*Handle)->ReleaseHandle();
+		}
+		ThemeLoadHandles.Remove(ThemeType);
+		ThemeAssets.Remove(ThemeType);
+		ThemeRequestOrder.RemoveAt(i);
+
+		UE_LOG(LogStateRunner_Arcade, Log, TEXT("ThemeSubsystem: Released theme %d (residency cap %d)"), static_cast<int32>(ThemeType), MaxResidentThemes);
 	}
 }
 
@@ -177,16 +389,26 @@ void UThemeSubsystem::LoadThemeAssets()
 
 void UThemeSubsystem::ApplyThemeToMesh(UStaticMeshComponent* MeshComponent)
 {
+	// Dynamic material instances made for the mesh are the theme's to account for
+	STATERUNNER_LLM_SCOPE(Theme);
+
 	if (!MeshComponent)
 	{
 		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("ThemeSubsystem: ApplyThemeToMesh called with null mesh"));
 		return;
 	}
 
+	// The shared materials already read the theme from the collection
+	if (IsUsingParameterCollection())
+	{
+		return;
+	}
+
 	const UThemeDataAsset* ThemeData = GetCurrentThemeData();
 	if (!ThemeData)
 	{
-		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("ThemeSubsystem: No theme data available for current theme"));
+		// Still streaming -- ApplyCurrentTheme refreshes every registered mesh when it lands
+		UE_LOG(LogStateRunner_Arcade, Verbose, TEXT("ThemeSubsystem: No theme data available for current theme"));
 		return;
 	}
 
@@ -201,61 +423,117 @@ void UThemeSubsystem::ApplyThemeToMesh(UStaticMeshComponent* MeshComponent)
 }
 
 void UThemeSubsystem::RegisterThemedMesh(UStaticMeshComponent* MeshComponent)
+{
+	AddThemedMesh(MeshComponent);
+}
+
+void UThemeSubsystem::UnregisterThemedMesh(UStaticMeshComponent* MeshComponent)
 {
 	if (!MeshComponent)
 	{
 		return;
 	}
 
-	// Check if already registered
-	for (const TWeakObjectPtr<UStaticMeshComponent>& Weak : RegisteredMeshes)
+	if (FThemedMeshHandle* Handle = MeshHandles.Find(MeshComponent))
 	{
-		if (Weak.Get() == MeshComponent)
-		{
-			return; // Already registered
-		}
+		FThemedMeshHandle Copy = *Handle;
+		RemoveThemedMesh(Copy);
 	}
+}
+
+FThemedMeshHandle UThemeSubsystem::AddThemedMesh(UStaticMeshComponent* MeshComponent)
+{
+	// Collection mode needs no per-mesh bookkeeping
+	if (!MeshComponent || IsUsingParameterCollection())
+	{
+		return FThemedMeshHandle();
+	}
+
+	if (const FThemedMeshHandle* Existing = MeshHandles.Find(MeshComponent))
+	{
+		return *Existing; // Already registered
+	}
+
+	int32 SlotIndex;
+	if (FreeMeshSlots.Num() > 0)
+	{
+		SlotIndex = FreeMeshSlots.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		SlotIndex = MeshSlots.AddDefaulted();
+	}
+
+	FMeshSlot& Slot = MeshSlots[SlotIndex];
+	Slot.DenseIndex = DenseMeshes.Add({ MeshComponent, MeshComponent, SlotIndex });
 
-	RegisteredMeshes.Add(MeshComponent);
+	FThemedMeshHandle Handle;
+	Handle.Index = SlotIndex;
+	Handle.Generation = Slot.Generation;
+	MeshHandles.Add(MeshComponent, Handle);
 
 	// Apply current theme immediately
 	ApplyThemeToMesh(MeshComponent);
 
 	UE_LOG(LogStateRunner_Arcade, Verbose, TEXT("ThemeSubsystem: Registered mesh %s (total: %d)"),
-		*MeshComponent->GetName(), RegisteredMeshes.Num());
+		*MeshComponent->GetName(), DenseMeshes.Num());
+
+	return Handle;
 }
 
-void UThemeSubsystem::UnregisterThemedMesh(UStaticMeshComponent* MeshComponent)
+void UThemeSubsystem::RemoveThemedMesh(FThemedMeshHandle& Handle)
 {
-	if (!MeshComponent)
+	if (MeshSlots.IsValidIndex(Handle.Index))
 	{
-		return;
+		const FMeshSlot& Slot = MeshSlots[Handle.Index];
+		if (Slot.Generation == Handle.Generation && Slot.DenseIndex != INDEX_NONE)
+		{
+			ReleaseDenseMesh(Slot.DenseIndex);
+		}
 	}
 
-	for (int32 i = RegisteredMeshes.Num() - 1; i >= 0; --i)
+	Handle.Invalidate();
+}
+
+void UThemeSubsystem::ReleaseDenseMesh(int32 DenseIndex)
+{
+	const int32 SlotIndex = DenseMeshes[DenseIndex].SlotIndex;
+
+	// Keyed by object key, so this works even if the mesh is already gone
+	MeshHandles.Remove(DenseMeshes[DenseIndex].Key);
+
+	// Swap the last dense entry into the hole and repoint its slot
+	const int32 LastIndex = DenseMeshes.Num() - 1;
+	if (DenseIndex != LastIndex)
 	{
-		if (RegisteredMeshes[i].Get() == MeshComponent)
-		{
-			RegisteredMeshes.RemoveAt(i);
-			UE_LOG(LogStateRunner_Arcade, Verbose, TEXT("ThemeSubsystem: Unregistered mesh %s"), *MeshComponent->GetName());
-			return;
-		}
+		MeshSlots[DenseMeshes[LastIndex].SlotIndex].DenseIndex = DenseIndex;
 	}
+	DenseMeshes.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+
+	FMeshSlot& Slot = MeshSlots[SlotIndex];
+	Slot.DenseIndex = INDEX_NONE;
+	Slot.Generation++;
+	FreeMeshSlots.Add(SlotIndex);
 }
 
 void UThemeSubsystem::RefreshAllThemedMeshes()
 {
-	// Clean up any invalid references first
-	CleanupInvalidMeshReferences();
+	STATERUNNER_SCOPE_CYCLE_COUNTER(ThemeRefresh);
 
 	int32 RefreshedCount = 0;
-	for (const TWeakObjectPtr<UStaticMeshComponent>& Weak : RegisteredMeshes)
+
+	// Backwards so releasing a mesh destroyed without unregistering only swaps in already-visited entries
+	for (int32 i = DenseMeshes.Num() - 1; i >= 0; --i)
 	{
-		if (UStaticMeshComponent* Mesh = Weak.Get())
+		if (UStaticMeshComponent* Mesh = DenseMeshes[i].Mesh.Get())
 		{
 			ApplyThemeToMesh(Mesh);
 			RefreshedCount++;
 		}
+		else
+		{
+			ReleaseDenseMesh(i);
+		}
 	}
 
 	UE_LOG(LogStateRunner_Arcade, Log, TEXT("ThemeSubsystem: Refreshed %d themed meshes"), RefreshedCount);
@@ -267,11 +545,10 @@ void UThemeSubsystem::RefreshAllThemedMeshes()
 
 void UThemeSubsystem::SaveThemePreference()
 {
-	// Save to GameUserSettings (persists across sessions)
-	if (GConfig)
+	// Goes into the unified save record; written with its next batch
+	if (UArcadeSaveSubsystem* Saves = GetGameInstance()->GetSubsystem<UArcadeSaveSubsystem>())
 	{
-		GConfig->SetInt(*ThemeConfigSection, *ThemeConfigKey, static_cast<int32>(CurrentThemeType), GGameUserSettingsIni);
-		GConfig->Flush(false, GGameUserSettingsIni);
+		Saves->SetThemeIndex(static_cast<int32>(CurrentThemeType));
 
 		UE_LOG(LogStateRunner_Arcade, Log, TEXT("ThemeSubsystem: Saved theme preference %d"), static_cast<int32>(CurrentThemeType));
 	}
@@ -279,27 +556,22 @@ void UThemeSubsystem::SaveThemePreference()
 
 void UThemeSubsystem::LoadThemePreference()
 {
-	// Load from GameUserSettings
-	if (GConfig)
+	const UArcadeSaveSubsystem* Saves = GetGameInstance()->GetSubsystem<UArcadeSaveSubsystem>();
+	const int32 SavedTheme = Saves ? Saves->GetThemeIndex() : INDEX_NONE;
+
+	if (SavedTheme == INDEX_NONE)
 	{
-		int32 SavedTheme = 0;
-		if (GConfig->GetInt(*ThemeConfigSection, *ThemeConfigKey, SavedTheme, GGameUserSettingsIni))
-		{
-			// Validate the loaded value
-			if (SavedTheme >= 0 && SavedTheme <= static_cast<int32>(EThemeType::Gold))
-			{
-				CurrentThemeType = static_cast<EThemeType>(SavedTheme);
-				UE_LOG(LogStateRunner_Arcade, Log, TEXT("ThemeSubsystem: Loaded theme preference %d"), SavedTheme);
-			}
-			else
-			{
-				UE_LOG(LogStateRunner_Arcade, Warning, TEXT("ThemeSubsystem: Invalid saved theme %d, using default"), SavedTheme);
-			}
-		}
-		else
-		{
-			UE_LOG(LogStateRunner_Arcade, Log, TEXT("ThemeSubsystem: No saved theme preference, using default Cryogenic (Cyan)"));
-		}
+		UE_LOG(LogStateRunner_Arcade, Log, TEXT("ThemeSubsystem: No saved theme preference, using default Cryogenic (Cyan)"));
+	}
+	else if (SavedTheme >= 0 && SavedTheme <= static_cast<int32>(EThemeType::Gold))
+	{
+		// Validated -- the stored value is a plain int
+		CurrentThemeType = static_cast<EThemeType>(SavedTheme);
+		UE_LOG(LogStateRunner_Arcade, Log, TEXT("ThemeSubsystem: Loaded theme preference %d"), SavedTheme);
+	}
+	else
+	{
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("ThemeSubsystem: Invalid saved theme %d, using default"), SavedTheme);
 	}
 }
 
@@ -368,13 +640,61 @@ void UThemeSubsystem::ApplyLaserPointerTheme(UStaticMeshComponent* MeshComponent
 	}
 }
 
-void UThemeSubsystem::CleanupInvalidMeshReferences()
+//=============================================================================
+// PARAMETER COLLECTION
+//=============================================================================
+
+void UThemeSubsystem::LoadParameterCollection()
 {
-	for (int32 i = RegisteredMeshes.Num() - 1; i >= 0; --i)
+	ThemeParameterCollection = nullptr;
+
+	if (ThemeParameterCollectionPath.IsNull())
 	{
-		if (!RegisteredMeshes[i].IsValid())
-		{
-			RegisteredMeshes.RemoveAt(i);
-		}
+		return;
+	}
+
+	ThemeParameterCollection = Cast<UMaterialParameterCollection>(ThemeParameterCollectionPath.TryLoad());
+	if (ThemeParameterCollection)
+	{
+		UE_LOG(LogStateRunner_Arcade, Log, TEXT("ThemeSubsystem: Using parameter collection %s"), *ThemeParameterCollection->GetName());
+	}
+	else
+	{
+		UE_LOG(LogStateRunner_Arcade, Log, TEXT("ThemeSubsystem: No parameter collection at %s, using per-mesh materials"),
+			*ThemeParameterCollectionPath.ToString());
+	}
+}
+
+void UThemeSubsystem::ApplyThemeParameters(UWorld* World) const
+{
+	if (!World || !ThemeParameterCollection)
+	{
+		return;
+	}
+
+	const UThemeDataAsset* ThemeData = GetCurrentThemeData();
+	UMaterialParameterCollectionInstance* Instance = World->GetParameterCollectionInstance(ThemeParameterCollection);
+	if (!ThemeData || !Instance)
+	{
+		return;
+	}
+
+	// Premultiplied like the per-mesh path, so existing materials can read the color directly
+	Instance->SetVectorParameterValue(ParamCircuitEmissiveColor, ThemeData->CircuitEmissiveColor * ThemeData->CircuitEmissiveIntensity);
+	Instance->SetScalarParameterValue(ParamCircuitEmissiveIntensity, ThemeData->CircuitEmissiveIntensity);
+	Instance->SetVectorParameterValue(ParamLaserPointerColor, ThemeData->LaserPointerColor);
+	Instance->SetVectorParameterValue(ParamPrimaryAccentColor, ThemeData->PrimaryAccentColor);
+	Instance->SetVectorParameterValue(ParamSecondaryAccentColor, ThemeData->SecondaryAccentColor);
+
+	UE_LOG(LogStateRunner_Arcade, Verbose, TEXT("ThemeSubsystem: Wrote theme %s to %s in %s"),
+		*ThemeData->DisplayName.ToString(), *ThemeParameterCollection->GetName(), *World->GetName());
+}
+
+void UThemeSubsystem::HandlePostWorldInitialization(UWorld* World, const UWorld::InitializationValues IVS)
+{
+	// A fresh world starts from the collection's defaults
+	if (World && World->IsGameWorld() && World->GetGameInstance() == GetGameInstance())
+	{
+		ApplyThemeParameters(World);
 	}
 }
@@ -2,11 +2,15 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Engine/World.h"
+#include "UObject/ObjectKey.h"
+#include "Engine/StreamableManager.h"
 #include "ThemeDataAsset.h"
 #include "ThemeSubsystem.generated.h"
 
 class UStaticMeshComponent;
 class UMaterialInstanceDynamic;
+class UMaterialParameterCollection;
 
 /**
  * Delegate broadcast when the theme changes.
@@ -14,10 +18,36 @@ class UMaterialInstanceDynamic;
  */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnThemeChanged, EThemeType, NewTheme);
 
+/**
+ * Handle to a mesh in UThemeSubsystem's registry.
+ * The generation changes whenever a slot is released, so a stale handle (double
+ * unregister, a pooled actor's outdated copy) can't remove the slot's next occupant.
+ */
+struct FThemedMeshHandle
+{
+	int32 Index = INDEX_NONE;
+	uint32 Generation = 0;
+
+	bool IsValid() const { return Index != INDEX_NONE; }
+	void Invalidate() { Index = INDEX_NONE; Generation = 0; }
+};
+
 /**
  * Game Instance Subsystem that manages visual themes (colors, materials).
  * Persists theme selection across level loads via GameUserSettings.
  * Apply themes to track meshes and broadcast changes to subscribers.
+ *
+ * Two modes:
+ * - Collection (when ThemeParameterCollectionPath loads): the theme lives in a material
+ *   parameter collection that the track materials read. A switch is a few parameter writes
+ *   per world; meshes keep their shared base materials and are never touched, so pooled
+ *   segments and obstacles need no re-theming when they activate.
+ * - Per-mesh (fallback): registered meshes get a dynamic material instance per circuit
+ *   element and laser material swaps, redone on every switch and registration.
+ *
+ * Theme data assets are streamed, not loaded up front: only the current theme is resident
+ * during play (requested asynchronously at boot), the theme selector loads what it shows and
+ * preloads the highlighted theme, and ReleaseUnusedThemes drops the rest again.
  */
 UCLASS()
 class STATERUNNER_ARCADE_API UThemeSubsystem : public UGameInstanceSubsystem
@@ -41,7 +71,7 @@ public:
 
 	/**
 	 * Get the current theme data asset.
-	 * Returns nullptr if theme assets are not configured.
+	 * Returns nullptr if theme assets are not configured or it's still streaming in.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Theme")
 	UThemeDataAsset* GetCurrentThemeData() const;
@@ -97,6 +127,19 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Theme")
 	void UnregisterThemedMesh(UStaticMeshComponent* MeshComponent);
 
+	/**
+	 * Register a mesh and get a handle for removing it in O(1).
+	 * Registering an already-registered mesh returns its existing handle.
+	 * Returns an invalid handle in collection mode (nothing to track).
+	 */
+	FThemedMeshHandle AddThemedMesh(UStaticMeshComponent* MeshComponent);
+
+	/** Remove the mesh behind Handle and invalidate it (stale or invalid handles are ignored) */
+	void RemoveThemedMesh(FThemedMeshHandle& Handle);
+
+	/** Number of registered meshes (debug) */
+	int32 GetThemedMeshCount() const { return DenseMeshes.Num(); }
+
 	/**
 	 * Refresh all registered meshes with the current theme.
 	 * Useful after loading a level or changing themes.
@@ -104,6 +147,26 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Theme")
 	void RefreshAllThemedMeshes();
 
+	/** True when themes are driven by the parameter collection (mesh application is a no-op) */
+	UFUNCTION(BlueprintPure, Category="Theme")
+	bool IsUsingParameterCollection() const { return ThemeParameterCollection != nullptr; }
+
+	// --- Parameter Collection ---
+
+	/** Collection parameter names the themed materials read */
+	static const FName ParamCircuitEmissiveColor;
+	static const FName ParamCircuitEmissiveIntensity;
+	static const FName ParamLaserPointerColor;
+	static const FName ParamPrimaryAccentColor;
+	static const FName ParamSecondaryAccentColor;
+
+	/**
+	 * Material parameter collection for collection mode.
+	 * Leave unset (or point at a missing asset) to use per-mesh material instances.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Theme Configuration")
+	FSoftObjectPath ThemeParameterCollectionPath;
+
 	// --- Events ---
 
 	/**
@@ -116,8 +179,8 @@ public:
 	// --- Theme Asset Configuration ---
 
 	/**
-	 * Map of theme types to their data assets.
-	 * These are auto-loaded from the ThemeAssetPaths or can be set manually.
+	 * Resident theme data assets, streamed in from ThemeAssetPaths or set manually.
+	 * Only loaded themes appear here; see GetAvailableThemes for the full catalog.
 	 */
 	UPROPERTY(BlueprintReadOnly, Category="Theme Configuration")
 	TMap<EThemeType, TObjectPtr<UThemeDataAsset>> ThemeAssets;
@@ -137,12 +200,43 @@ public:
 	void RegisterThemeAsset(EThemeType ThemeType, UThemeDataAsset* ThemeData);
 
 	/**
-	 * Load theme assets from the configured paths.
+	 * Start streaming the current theme from the configured paths.
 	 * Called automatically on Initialize, but can be called manually if paths change.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Theme")
 	void LoadThemeAssets();
 
+	// --- Streaming ---
+
+	/**
+	 * Get a theme's data, streaming it in if needed.
+	 * OnLoaded runs immediately if it's resident, otherwise when the load finishes
+	 * (with nullptr if the theme has no path or failed to load).
+	 */
+	void RequestThemeData(EThemeType ThemeType, TFunction<void(UThemeDataAsset*)>&& OnLoaded);
+
+	/** Start streaming a theme ahead of use (e.g. the one highlighted in the selector) */
+	UFUNCTION(BlueprintCallable, Category="Theme")
+	void PreloadTheme(EThemeType ThemeType);
+
+	/** True if the theme's data is resident */
+	UFUNCTION(BlueprintPure, Category="Theme")
+	bool IsThemeLoaded(EThemeType ThemeType) const { return ThemeAssets.Contains(ThemeType); }
+
+	/** Release every streamed theme except the current one (manually registered themes stay) */
+	UFUNCTION(BlueprintCallable, Category="Theme")
+	void ReleaseUnusedThemes();
+
+	/**
+	 * Cap the number of streamed themes kept resident (hardware tier budget; 0 = no cap).
+	 * Past the cap, the least recently requested theme is released (never the current one
+	 * or one still loading for someone).
+	 */
+	void SetMaxResidentThemes(int32 MaxThemes);
+
+	/** Streamed themes currently held resident (or loading) */
+	int32 GetResidentThemeCount() const { return ThemeLoadHandles.Num(); }
+
 protected:
 
 	// --- Internal State ---
@@ -151,20 +245,71 @@ protected:
 	UPROPERTY()
 	EThemeType CurrentThemeType = EThemeType::Cyan;
 
-	/** Registered mesh components that receive automatic theme updates */
+	// --- Themed Mesh Registry (per-mesh mode only) ---
+	// Slots give handles a stable index; the dense arrays are what refresh walks.
+	// Register/unregister are O(1): a free-list pop/push plus a swap-remove.
+
+	struct FMeshSlot
+	{
+		/** Bumped on release so old handles stop matching */
+		uint32 Generation = 1;
+
+		/** Position in DenseMeshes, INDEX_NONE while free */
+		int32 DenseIndex = INDEX_NONE;
+	};
+
+	TArray<FMeshSlot> MeshSlots;
+
+	/** Released slot indices */
+	TArray<int32> FreeMeshSlots;
+
+	struct FDenseMesh
+	{
+		TWeakObjectPtr<UStaticMeshComponent> Mesh;
+
+		/** MeshHandles key, still usable after Mesh has gone stale */
+		TObjectKey<UStaticMeshComponent> Key;
+
+		/** Slot owning this entry */
+		int32 SlotIndex = INDEX_NONE;
+	};
+
+	/** Registered meshes, packed */
+	TArray<FDenseMesh> DenseMeshes;
+
+	/** Handle for each registered mesh (duplicate checks and the pointer-based Blueprint API) */
+	TMap<TObjectKey<UStaticMeshComponent>, FThemedMeshHandle> MeshHandles;
+
+	/** Streaming requests keeping loaded (or loading) themes resident */
+	TMap<EThemeType, TSharedPtr<FStreamableHandle>> ThemeLoadHandles;
+
+	/** Callbacks waiting for a theme to finish loading */
+	TMap<EThemeType, TArray<TFunction<void(UThemeDataAsset*)>>> PendingThemeCallbacks;
+
+	/** Streamed themes, least recently requested first (eviction order for the residency cap) */
+	TArray<EThemeType> ThemeRequestOrder;
+
+	/** Resident streamed theme cap (0 = no cap) */
+	int32 MaxResidentThemes = 0;
+
+	FStreamableManager StreamableManager;
+
+	/** Loaded collection (null = per-mesh mode) */
 	UPROPERTY()
-	TArray<TWeakObjectPtr<UStaticMeshComponent>> RegisteredMeshes;
+	TObjectPtr<UMaterialParameterCollection> ThemeParameterCollection;
 
-	/** Config section name for saving theme preference */
-	static const FString ThemeConfigSection;
-	static const FString ThemeConfigKey;
+	/** Handle for the world-initialization hook that seeds each new world's collection instance */
+	FDelegateHandle PostWorldInitHandle;
 
 	// --- Internal Helpers ---
 
-	/** Save theme preference to config */
+	/** Release least recently requested themes until the residency cap holds */
+	void TrimResidentThemes();
+
+	/** Save theme preference to the save record */
 	void SaveThemePreference();
 
-	/** Load theme preference from config */
+	/** Load theme preference from the save record */
 	void LoadThemePreference();
 
 	/** Apply theme colors to circuit pattern elements (0-255) */
@@ -173,8 +318,23 @@ protected:
 	/** Swap laser pointer materials (258-265, 269-272) */
 	void ApplyLaserPointerTheme(UStaticMeshComponent* MeshComponent, const UThemeDataAsset* ThemeData);
 
-	/** Clean up invalid weak references in RegisteredMeshes */
-	void CleanupInvalidMeshReferences();
+	/** Release the slot behind the dense entry at DenseIndex */
+	void ReleaseDenseMesh(int32 DenseIndex);
+
+	/** Streaming completion for one theme */
+	void OnThemeStreamed(EThemeType ThemeType);
+
+	/** Push the current theme to the collection or the registered meshes */
+	void ApplyCurrentTheme();
+
+	/** Load ThemeParameterCollectionPath; stays in per-mesh mode if it doesn't resolve */
+	void LoadParameterCollection();
+
+	/** Write the current theme into World's collection instance */
+	void ApplyThemeParameters(UWorld* World) const;
+
+	/** Collection instances are per world -- fill in every new game world of this instance */
+	void HandlePostWorldInitialization(UWorld* World, const UWorld::InitializationValues IVS);
 
 	// --- Element Index Constants (SM_NewTunnel1) ---
 
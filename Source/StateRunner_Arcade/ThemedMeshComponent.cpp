@@ -25,6 +25,12 @@ void UThemedMeshComponent::BeginPlay()
 		return;
 	}
 
+	// Collection mode: no registration, no MIDs, no theme-change callback
+	if (ThemeSubsystem->IsUsingParameterCollection())
+	{
+		return;
+	}
+
 	// Auto-find mesh if configured
 	if (bAutoFindMesh && !TargetMeshComponent)
 	{
@@ -62,7 +68,7 @@ void UThemedMeshComponent::BeginPlay()
 	// Register with theme subsystem
 	if (TargetMeshComponent)
 	{
-		ThemeSubsystem->RegisterThemedMesh(TargetMeshComponent);
+		TargetMeshHandle = ThemeSubsystem->AddThemedMesh(TargetMeshComponent);
 		bIsRegistered = true;
 	}
 
@@ -86,24 +92,23 @@ void UThemedMeshComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	{
 		ThemeSubsystem->OnThemeChanged.RemoveDynamic(this, &UThemedMeshComponent::OnThemeChanged);
 
-		// Unregister meshes
-		if (bIsRegistered && TargetMeshComponent)
+		// Unregister meshes (O(1) each; stale handles are ignored)
+		if (bIsRegistered)
 		{
-			ThemeSubsystem->UnregisterThemedMesh(TargetMeshComponent);
+			ThemeSubsystem->RemoveThemedMesh(TargetMeshHandle);
 		}
 
 		// Unregister additional meshes
-		for (const TWeakObjectPtr<UStaticMeshComponent>& Weak : AdditionalMeshes)
+		for (FThemedMeshHandle& Handle : AdditionalMeshHandles)
 		{
-			if (UStaticMeshComponent* Mesh = Weak.Get())
-			{
-				ThemeSubsystem->UnregisterThemedMesh(Mesh);
-			}
+			ThemeSubsystem->RemoveThemedMesh(Handle);
 		}
 	}
 
 	bIsRegistered = false;
+	TargetMeshHandle.Invalidate();
 	AdditionalMeshes.Empty();
+	AdditionalMeshHandles.Empty();
 
 	Super::EndPlay(EndPlayReason);
 }
@@ -154,10 +159,7 @@ void UThemedMeshComponent::RegisterAdditionalMesh(UStaticMeshComponent* MeshComp
 	AdditionalMeshes.Add(MeshComponent);
 
 	// Register with subsystem and apply theme
-	if (ThemeSubsystem)
-	{
-		ThemeSubsystem->RegisterThemedMesh(MeshComponent);
-	}
+	AdditionalMeshHandles.Add(ThemeSubsystem ? ThemeSubsystem->AddThemedMesh(MeshComponent) : FThemedMeshHandle());
 
 	UE_LOG(LogStateRunner_Arcade, Verbose, TEXT("ThemedMeshComponent: Registered additional mesh %s"),
 		*MeshComponent->GetName());
@@ -3,10 +3,10 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "ThemeDataAsset.h"
+#include "ThemeSubsystem.h"
 #include "ThemedMeshComponent.generated.h"
 
 class UStaticMeshComponent;
-class UThemeSubsystem;
 
 /**
  * Themed Mesh Component
@@ -27,6 +27,9 @@ class UThemeSubsystem;
  * 
  * ALTERNATIVE: If you have multiple themed meshes per actor, you can call
  * RegisterAdditionalMesh() in Blueprint's BeginPlay for each extra mesh.
+ *
+ * When the theme subsystem runs in parameter-collection mode this component does nothing:
+ * the mesh's materials read the theme directly.
  */
 UCLASS(ClassGroup=(Theme), meta=(BlueprintSpawnableComponent))
 class STATERUNNER_ARCADE_API UThemedMeshComponent : public UActorComponent
@@ -132,6 +135,12 @@ protected:
 	UPROPERTY()
 	TArray<TWeakObjectPtr<UStaticMeshComponent>> AdditionalMeshes;
 
+	/** Registry handle for TargetMeshComponent */
+	FThemedMeshHandle TargetMeshHandle;
+
+	/** Registry handles for AdditionalMeshes (same order) */
+	TArray<FThemedMeshHandle> AdditionalMeshHandles;
+
 	/** Whether we're registered with the theme subsystem */
 	bool bIsRegistered = false;
 };
@@ -0,0 +1,60 @@
+#include "TrackSegment.h"
+#include "WorldScrollComponent.h"
+#include "StateRunner_ArcadeGameMode.h"
+#include "Engine/World.h"
+
+ATrackSegment::ATrackSegment()
+{
+	// Moved by the batched scroller (or not at all, in MoveRunner mode)
+	PrimaryActorTick.bCanEverTick = false;
+
+	SegmentRoot = CreateDefaultSubobject<USceneComponent>(TEXT("SegmentRoot"));
+	RootComponent = SegmentRoot;
+}
+
+// --- Pooling Functions ---
+
+void ATrackSegment::Activate(const FVector& TrackStartLocation, int32 InSegmentNumber)
+{
+	bIsActive = true;
+	SegmentNumber = InSegmentNumber;
+
+	if (!WorldScrollComponent)
+	{
+		if (AStateRunner_ArcadeGameMode* GameMode = GetWorld() ? Cast<AStateRunner_ArcadeGameMode>(GetWorld()->GetAuthGameMode()) : nullptr)
+		{
+			WorldScrollComponent = GameMode->GetWorldScrollComponent();
+		}
+	}
+
+	FVector WorldLocation = TrackStartLocation;
+	if (WorldScrollComponent)
+	{
+		WorldLocation.X = WorldScrollComponent->TrackToWorldX(TrackStartLocation.X);
+	}
+	SetActorLocation(WorldLocation);
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+
+	// The manager recycles segments itself, so the scroller never despawns them
+	if (WorldScrollComponent)
+	{
+		WorldScrollComponent->RegisterScrollable(this, this, -MAX_flt);
+	}
+
+	OnSegmentActivated(SegmentNumber);
+}
+
+void ATrackSegment::Deactivate()
+{
+	bIsActive = false;
+
+	if (WorldScrollComponent)
+	{
+		WorldScrollComponent->UnregisterScrollable(this);
+	}
+
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+	SetActorLocation(FVector(0.0f, 0.0f, -10000.0f));
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "WorldScrollable.h"
+#include "TrackSegment.generated.h"
+
+class UWorldScrollComponent;
+
+/**
+ * One pooled piece of track, recycled by UTrackSegmentManagerComponent.
+ *
+ * The Blueprint subclass adds the floor/wall meshes under the root; the native side only
+ * handles pooling: Activate() places the segment (track space), shows it and hands it to
+ * the batched scroller, Deactivate() parks it below the world. Segments are positioned
+ * by their start (root at the -X end), SegmentLength long along +X.
+ */
+UCLASS(Abstract)
+class STATERUNNER_ARCADE_API ATrackSegment : public AActor, public IWorldScrollable
+{
+	GENERATED_BODY()
+
+public:
+
+	ATrackSegment();
+
+	// --- Pooling Functions ---
+
+public:
+
+	/**
+	 * Take this segment out of the pool.
+	 *
+	 * @param TrackStartLocation Track-space segment start (world location in MoveWorld scroll mode)
+	 * @param SegmentNumber Running segment count, for Blueprint variation
+	 */
+	void Activate(const FVector& TrackStartLocation, int32 SegmentNumber);
+
+	/** Hide, stop scrolling and park below the world */
+	void Deactivate();
+
+	UFUNCTION(BlueprintPure, Category="Pooling")
+	bool IsActive() const { return bIsActive; }
+
+	/** Segment number of the current activation */
+	UFUNCTION(BlueprintPure, Category="Pooling")
+	int32 GetSegmentNumber() const { return SegmentNumber; }
+
+	int32 GetPoolSlotIndex() const { return PoolSlotIndex; }
+	void SetPoolSlotIndex(int32 InIndex) { PoolSlotIndex = InIndex; }
+
+	// IWorldScrollable
+	virtual int32 GetScrollEntryIndex() const override { return ScrollEntryIndex; }
+	virtual void SetScrollEntryIndex(int32 InIndex) override { ScrollEntryIndex = InIndex; }
+
+protected:
+
+	/** Called after every activation (swap props, decals, lighting per segment) */
+	UFUNCTION(BlueprintImplementableEvent, Category="Pooling")
+	void OnSegmentActivated(int32 InSegmentNumber);
+
+	// --- Components ---
+
+protected:
+
+	/** Segment start; Blueprint meshes hang off this */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Components")
+	TObjectPtr<USceneComponent> SegmentRoot;
+
+	// --- Runtime State ---
+
+protected:
+
+	UPROPERTY()
+	TObjectPtr<UWorldScrollComponent> WorldScrollComponent;
+
+	bool bIsActive = false;
+
+	int32 SegmentNumber = 0;
+
+	/** Slot in the manager's TActorPool */
+	int32 PoolSlotIndex = INDEX_NONE;
+
+	/** Index in the world scroller's entry list */
+	int32 ScrollEntryIndex = INDEX_NONE;
+};
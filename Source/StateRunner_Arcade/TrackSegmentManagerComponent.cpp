@@ -0,0 +1,242 @@
+#include "TrackSegmentManagerComponent.h"
+#include "TrackSegment.h"
+#include "WorldScrollComponent.h"
+#include "ObstacleSpawnerComponent.h"
+#include "PickupSpawnerComponent.h"
+#include "DifficultyDirectorComponent.h"
+#include "StateRunner_ArcadeGameMode.h"
+#include "StateRunner_Arcade.h"
+#include "Engine/World.h"
+
+/** Highest scroll speed the prewarm plans for when the speed curve never tops out */
+static constexpr float TrackSegmentManager_PrewarmSpeedCap = 10000.0f;
+
+// --- Component Lifecycle ---
+
+UTrackSegmentManagerComponent::UTrackSegmentManagerComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+
+	// Ticking fallback runs after WorldScroll moved everything this frame
+	PrimaryComponentTick.TickGroup = TG_PostPhysics;
+}
+
+void UTrackSegmentManagerComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (!TrackSegmentClass)
+	{
+		return;
+	}
+
+	if (AStateRunner_ArcadeGameMode* GameMode = Cast<AStateRunner_ArcadeGameMode>(GetOwner()))
+	{
+		WorldScroll = GameMode->GetWorldScrollComponent();
+		ObstacleSpawner = GameMode->GetObstacleSpawnerComponent();
+		PickupSpawner = GameMode->GetPickupSpawnerComponent();
+	}
+
+	if (!WorldScroll || !ObstacleSpawner || !PickupSpawner)
+	{
+		UE_LOG(LogStateRunner_Arcade, Error, TEXT("TrackSegmentManager: Needs the GameMode's WorldScroll and spawner components, track not managed"));
+		TrackSegmentClass = nullptr;
+		return;
+	}
+
+	SegmentLength = ObstacleSpawner->GetSegmentLength();
+	RunnerTrackX = ObstacleSpawner->GetPlayerXPosition();
+	NextSegmentDistance = -RecycleBehindDistance;
+
+	const int32 PrewarmCount = GetPrewarmCount();
+	SegmentPool.Reserve(PrewarmCount);
+	for (int32 i = 0; i < PrewarmCount; i++)
+	{
+		SpawnPooledSegment();
+	}
+
+	// Fixed-step mode: laid out after the frame's steps are presented, tick stays off
+	UGameplaySimulationSubsystem* Simulation = UGameplaySimulationSubsystem::Get(this);
+	bSimulationDriven = Simulation && Simulation->IsFixedStepEnabled();
+	if (bSimulationDriven)
+	{
+		Simulation->RegisterParticipant(this, this, ESimulationPhase::Scroll);
+	}
+	else
+	{
+		SetComponentTickEnabled(true);
+	}
+
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("TrackSegmentManager: %s, %.0f long, %d pooled, horizon %.0f + speed x (latency + %.2f s)"),
+		*TrackSegmentClass->GetName(), SegmentLength, SegmentPool.Num(), VisibleAheadDistance, LatencyMarginSeconds);
+
+	// The opening track goes down on the first update, once the spawners have begun play
+}
+
+void UTrackSegmentManagerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UGameplaySimulationSubsystem* Simulation = UGameplaySimulationSubsystem::Get(this))
+	{
+		Simulation->UnregisterParticipant(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UTrackSegmentManagerComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	UpdateSegments();
+}
+
+void UTrackSegmentManagerComponent::PostSimulate(float Alpha, int32 StepsThisFrame)
+{
+	UpdateSegments();
+}
+
+void UTrackSegmentManagerComponent::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+	UTrackSegmentManagerComponent* This = CastChecked<UTrackSegmentManagerComponent>(InThis);
+	This->SegmentPool.AddReferencedObjects(Collector);
+
+	Super::AddReferencedObjects(InThis, Collector);
+}
+
+// --- Public Functions ---
+
+float UTrackSegmentManagerComponent::GetLookAheadDistance() const
+{
+	const float Speed = WorldScroll ? WorldScroll->GetCurrentScrollSpeed() : 0.0f;
+	const float Latency = ObstacleSpawner ? ObstacleSpawner->GetLayoutLatencySeconds() : 0.0f;
+	return VisibleAheadDistance + Speed * (Latency + LatencyMarginSeconds);
+}
+
+// --- Internal Functions ---
+
+void UTrackSegmentManagerComponent::UpdateSegments()
+{
+	if (!TrackSegmentClass)
+	{
+		return;
+	}
+
+	const double Presented = WorldScroll->GetPresentedScrollDistance();
+
+	// Scroll was reset (restart without a level reload): lay the track again from the top
+	if (Presented < LastPresentedDistance)
+	{
+		for (const TPair<TObjectPtr<ATrackSegment>, double>& Entry : ActiveSegments)
+		{
+			if (IsValid(Entry.Key))
+			{
+				Entry.Key->Deactivate();
+				SegmentPool.Release(Entry.Key);
+			}
+		}
+		ActiveSegments.Reset();
+		NextSegmentDistance = -RecycleBehindDistance;
+		bOpeningTrackLaid = false;
+	}
+	LastPresentedDistance = Presented;
+
+	// Oldest first, so stop at the first one still in use
+	int32 NumRecycled = 0;
+	while (NumRecycled < ActiveSegments.Num() && ActiveSegments[NumRecycled].Value + SegmentLength < Presented - RecycleBehindDistance)
+	{
+		if (ATrackSegment* Segment = ActiveSegments[NumRecycled].Key)
+		{
+			Segment->Deactivate();
+			SegmentPool.Release(Segment);
+		}
+		NumRecycled++;
+	}
+	ActiveSegments.RemoveAt(0, NumRecycled, EAllowShrinking::No);
+
+	// The opening fill goes down at once; after that the horizon only creeps forward
+	const double Horizon = Presented + GetLookAheadDistance();
+	const int32 MaxToSpawn = bOpeningTrackLaid ? MaxSegmentsPerFrame : MAX_int32;
+	for (int32 Spawned = 0; NextSegmentDistance < Horizon && Spawned < MaxToSpawn; Spawned++)
+	{
+		if (!PlaceNextSegment(Presented))
+		{
+			break;
+		}
+	}
+	bOpeningTrackLaid = true;
+}
+
+bool UTrackSegmentManagerComponent::PlaceNextSegment(double PresentedDistance)
+{
+	ATrackSegment* Segment = AcquireSegment();
+	if (!Segment)
+	{
+		return false;
+	}
+
+	const double StartDistance = NextSegmentDistance;
+	NextSegmentDistance += SegmentLength;
+	SegmentsPlaced++;
+
+	// Run distance to track space: the runner sits at RunnerTrackX, PresentedDistance into the run
+	const float TrackStartX = RunnerTrackX + static_cast<float>(StartDistance - PresentedDistance);
+	Segment->Activate(FVector(TrackStartX, SegmentOrigin.Y, SegmentOrigin.Z), SegmentsPlaced);
+	ActiveSegments.Emplace(Segment, StartDistance);
+
+	// Content positions are in track space too (world space in MoveWorld mode)
+	if (StartDistance >= ContentStartDistance)
+	{
+		const float TrackEndX = TrackStartX + SegmentLength;
+		ObstacleSpawner->SpawnObstaclesForSegment(TrackStartX, TrackEndX);
+		PickupSpawner->SpawnPickupsForSegment(TrackStartX, TrackEndX);
+	}
+
+	return true;
+}
+
+ATrackSegment* UTrackSegmentManagerComponent::AcquireSegment()
+{
+	if (ATrackSegment* Segment = SegmentPool.Acquire())
+	{
+		return Segment;
+	}
+
+	// Horizon outgrew the pool (OVERCLOCK past the prewarmed speed)
+	if (!SpawnPooledSegment())
+	{
+		return nullptr;
+	}
+
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("TrackSegmentManager: Pool grown to %d segments (horizon %.0f)"),
+		SegmentPool.Num(), GetLookAheadDistance());
+	return SegmentPool.Acquire();
+}
+
+ATrackSegment* UTrackSegmentManagerComponent::SpawnPooledSegment()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	ATrackSegment* Segment = World->SpawnActor<ATrackSegment>(TrackSegmentClass, FVector(0.0f, 0.0f, -10000.0f), FRotator::ZeroRotator, SpawnParams);
+	if (Segment)
+	{
+		Segment->Deactivate();
+		SegmentPool.Add(Segment);
+	}
+	return Segment;
+}
+
+int32 UTrackSegmentManagerComponent::GetPrewarmCount() const
+{
+	// Horizon at base top speed, plus what's kept behind the runner, plus the segment straddling each end
+	const float TopSpeed = FMath::Min(UDifficultyDirectorComponent::Get(this)->GetMaxScrollSpeed(), TrackSegmentManager_PrewarmSpeedCap);
+	const float Covered = VisibleAheadDistance + TopSpeed * LatencyMarginSeconds + RecycleBehindDistance;
+	return FMath::CeilToInt(Covered / FMath::Max(SegmentLength, 1.0f)) + 2;
+}
@@ -0,0 +1,171 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "GameplaySimulationSubsystem.h"
+#include "ActorPool.h"
+#include "TrackSegmentManagerComponent.generated.h"
+
+class ATrackSegment;
+class UWorldScrollComponent;
+class UObstacleSpawnerComponent;
+class UPickupSpawnerComponent;
+
+/**
+ * Track Segment Manager Component
+ *
+ * Pools the track segment actors and lays them down in front of the runner, calling
+ * SpawnObstaclesForSegment / SpawnPickupsForSegment for each new one.
+ *
+ * Segments are placed by run distance (scroll distance covered since the start), so their
+ * positions don't depend on when they spawn. A segment spawns once its start is inside the
+ * look-ahead horizon:
+ *
+ *   VisibleAheadDistance + ScrollSpeed * (layout latency + LatencyMarginSeconds)
+ *
+ * where ScrollSpeed includes OVERCLOCK and the layout latency is the obstacle spawner's
+ * measured async generation time. At base speed only the visible track plus a short lead
+ * exists; at OVERCLOCK speed the horizon stretches so nothing pops in. Segments whose end is
+ * RecycleBehindDistance behind the runner go back to the pool.
+ *
+ * Inactive until TrackSegmentClass is set, so levels that still build the track in
+ * Blueprint keep doing that. Attached to GameMode.
+ */
+UCLASS(ClassGroup=(StateRunner), meta=(BlueprintSpawnableComponent))
+class STATERUNNER_ARCADE_API UTrackSegmentManagerComponent : public UActorComponent, public IGameplaySimulated
+{
+	GENERATED_BODY()
+
+public:
+
+	UTrackSegmentManagerComponent();
+
+protected:
+
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+public:
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	/** Report the pooled segments to GC (the pool isn't a UPROPERTY) */
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+
+	// --- IGameplaySimulated ---
+
+	/** Segments are placed by distance, so nothing happens per step */
+	virtual void SimulateStep(float StepSeconds) override {}
+
+	/** Recycle and spawn against this frame's presented scroll */
+	virtual void PostSimulate(float Alpha, int32 StepsThisFrame) override;
+
+	// --- Configuration ---
+
+protected:
+
+	/** Track segment Blueprint to pool. Empty = the native manager stays off. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Track Segments")
+	TSubclassOf<ATrackSegment> TrackSegmentClass;
+
+	/** Y/Z every segment is placed at (X comes from the run distance) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Track Segments")
+	FVector SegmentOrigin = FVector::ZeroVector;
+
+	/** Track ahead of the runner the camera can see -- always covered, whatever the speed */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Track Segments|Look-Ahead", meta=(ClampMin="1000.0"))
+	float VisibleAheadDistance = 15000.0f;
+
+	/** Extra lead time on top of the layout latency (segment spawn cost, first-frame render) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Track Segments|Look-Ahead", meta=(ClampMin="0.0", ClampMax="2.0"))
+	float LatencyMarginSeconds = 0.25f;
+
+	/** Segments stay this far behind the runner (camera behind the runner) before recycling */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Track Segments", meta=(ClampMin="0.0"))
+	float RecycleBehindDistance = 2000.0f;
+
+	/** Segments starting closer than this ahead of the runner at the start of the run are bare track */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Track Segments", meta=(ClampMin="0.0"))
+	float ContentStartDistance = 6250.0f;
+
+	/** Most segments spawned in one frame after the opening fill (a horizon jump spreads over frames) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Track Segments", meta=(ClampMin="1", ClampMax="8"))
+	int32 MaxSegmentsPerFrame = 1;
+
+	// --- Runtime State ---
+
+protected:
+
+	UPROPERTY()
+	TObjectPtr<UWorldScrollComponent> WorldScroll;
+
+	UPROPERTY()
+	TObjectPtr<UObstacleSpawnerComponent> ObstacleSpawner;
+
+	UPROPERTY()
+	TObjectPtr<UPickupSpawnerComponent> PickupSpawner;
+
+	/** Every segment actor spawned (reported in AddReferencedObjects) */
+	TActorPool<ATrackSegment> SegmentPool;
+
+	/** Segments on the track, oldest (furthest behind) first, with their start run distance */
+	TArray<TPair<TObjectPtr<ATrackSegment>, double>> ActiveSegments;
+
+	/** Run distance where the next segment starts */
+	double NextSegmentDistance = 0.0;
+
+	/** Presented scroll distance at the last update (going backwards = the run was reset) */
+	double LastPresentedDistance = 0.0;
+
+	/** The first update fills the whole horizon at once */
+	bool bOpeningTrackLaid = false;
+
+	int32 SegmentsPlaced = 0;
+
+	/** Segment length, from the obstacle spawner so content and track line up */
+	float SegmentLength = 6250.0f;
+
+	/** Runner's track-space X */
+	float RunnerTrackX = -5000.0f;
+
+	/** Stepped by the simulation subsystem (PostSimulate) rather than ticking */
+	bool bSimulationDriven = false;
+
+	// --- Public Functions ---
+
+public:
+
+	/** Whether the native manager is laying the track */
+	UFUNCTION(BlueprintPure, Category="Track Segments")
+	bool IsManagingTrack() const { return TrackSegmentClass != nullptr; }
+
+	/** Current look-ahead horizon, ahead of the runner */
+	UFUNCTION(BlueprintPure, Category="Track Segments")
+	float GetLookAheadDistance() const;
+
+	UFUNCTION(BlueprintPure, Category="Track Segments")
+	int32 GetActiveSegmentCount() const { return ActiveSegments.Num(); }
+
+	/** Segment actors pooled (active + spare) */
+	UFUNCTION(BlueprintPure, Category="Track Segments")
+	int32 GetPooledSegmentCount() const { return SegmentPool.Num(); }
+
+	// --- Internal Functions ---
+
+protected:
+
+	/** Recycle passed segments and spawn up to the horizon */
+	void UpdateSegments();
+
+	/** Place the next segment and request its obstacles and pickups (false if no actor) */
+	bool PlaceNextSegment(double PresentedDistance);
+
+	/** Pooled segment, spawning one if the pool is dry */
+	ATrackSegment* AcquireSegment();
+
+	/** Spawn a parked segment into the pool */
+	ATrackSegment* SpawnPooledSegment();
+
+	/** Segments alive at base top speed, spawned up front */
+	int32 GetPrewarmCount() const;
+};
@@ -0,0 +1,494 @@
+#include "VersusModeComponent.h"
+#include "StateRunner_ArcadeGameMode.h"
+#include "StateRunner_ArcadeCharacter.h"
+#include "ScoreSystemComponent.h"
+#include "LivesSystemComponent.h"
+#include "OverclockSystemComponent.h"
+#include "WorldScrollComponent.h"
+#include "AutopilotComponent.h"
+#include "StateRunner_Arcade.h"
+#include "Blueprint/UserWidget.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/GameViewportClient.h"
+#include "GameFramework/PlayerController.h"
+#include "Kismet/GameplayStatics.h"
+
+/**
+ * New per-player system for a rival slot. The archetype carries Player 1's Blueprint-tuned
+ * defaults without anything bound to Player 1's instance at runtime.
+ */
+template <typename SystemT>
+static SystemT* VersusMode_CreateRivalSystem(AActor* Owner, const SystemT* PlayerOneSystem, int32 Slot)
+{
+	if (!PlayerOneSystem)
+	{
+		return nullptr;
+	}
+
+	const FName Name = MakeUniqueObjectName(Owner, PlayerOneSystem->GetClass(),
+		FName(*FString::Printf(TEXT("%s_P%d"), *PlayerOneSystem->GetName(), Slot + 1)));
+	return NewObject<SystemT>(Owner, PlayerOneSystem->GetClass(), Name, RF_Transient, PlayerOneSystem->GetArchetype());
+}
+
+// --- Component Lifecycle ---
+
+UVersusModeComponent::UVersusModeComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+UVersusModeComponent* UVersusModeComponent::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	AStateRunner_ArcadeGameMode* GameMode = World ? Cast<AStateRunner_ArcadeGameMode>(World->GetAuthGameMode()) : nullptr;
+	return GameMode ? GameMode->GetVersusModeComponent() : nullptr;
+}
+
+void UVersusModeComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (!bVersusActive)
+	{
+		return;
+	}
+
+	if (!CreateRivalPlayers())
+	{
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("VersusMode: Could not create the second local player -- playing solo"));
+		bVersusActive = false;
+		return;
+	}
+
+	for (int32 Slot = 1; Slot < MaxVersusPlayers; Slot++)
+	{
+		CreateRivalSystems(Slot);
+	}
+
+	ConfigureRunners();
+
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("VersusMode: %d-player split-screen match on one shared track"), MaxVersusPlayers);
+}
+
+void UVersusModeComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	for (UUserWidget* HUD : RivalHUDs)
+	{
+		if (HUD)
+		{
+			HUD->RemoveFromParent();
+		}
+	}
+	RivalHUDs.Reset();
+
+	// Local players outlive the map -- the next level (the menu) must not open split
+	if (bCreatedRivalPlayers && EndPlayReason == EEndPlayReason::LevelTransition)
+	{
+		for (int32 Slot = 1; Slot < MaxVersusPlayers; Slot++)
+		{
+			if (Players[Slot].Controller)
+			{
+				UGameplayStatics::RemovePlayer(Players[Slot].Controller, true);
+			}
+		}
+	}
+	bCreatedRivalPlayers = false;
+
+	Super::EndPlay(EndPlayReason);
+}
+
+// --- Public Functions ---
+
+void UVersusModeComponent::ApplyLaunchOptions(const FString& Options)
+{
+	const AStateRunner_ArcadeGameMode* GameMode = Cast<AStateRunner_ArcadeGameMode>(GetOwner());
+	const UAutopilotComponent* Autopilot = GameMode ? GameMode->GetAutopilotComponent() : nullptr;
+	if (Autopilot && Autopilot->IsActive())
+	{
+		return;
+	}
+
+	bVersusActive = UGameplayStatics::HasOption(Options, TEXT("Versus")) || FParse::Param(FCommandLine::Get(), TEXT("Versus"));
+}
+
+FVersusPlayerSystems UVersusModeComponent::GetPlayerSystems(int32 Slot) const
+{
+	FVersusPlayerSystems Systems;
+
+	if (Slot == 0)
+	{
+		// The GameMode's own components -- read directly, the getters may be routed to a contact
+		if (const AStateRunner_ArcadeGameMode* GameMode = Cast<AStateRunner_ArcadeGameMode>(GetOwner()))
+		{
+			Systems.ScoreSystem = GameMode->ScoreSystemComponent;
+			Systems.LivesSystem = GameMode->LivesSystemComponent;
+			Systems.OverclockSystem = GameMode->OverclockSystemComponent;
+		}
+		Systems.Controller = UGameplayStatics::GetPlayerController(this, 0);
+	}
+	else if (bVersusActive && Slot > 0 && Slot < MaxVersusPlayers)
+	{
+		Systems = Players[Slot];
+	}
+
+	Systems.Runner = Systems.Controller ? Cast<AStateRunner_ArcadeCharacter>(Systems.Controller->GetPawn()) : nullptr;
+	return Systems;
+}
+
+int32 UVersusModeComponent::GetPlayerSlot(const UObject* RunnerOrSystem) const
+{
+	if (!bVersusActive || !RunnerOrSystem)
+	{
+		return 0;
+	}
+
+	const APlayerController* Controller = Cast<APlayerController>(RunnerOrSystem);
+	if (const APawn* Pawn = Cast<APawn>(RunnerOrSystem))
+	{
+		Controller = Cast<APlayerController>(Pawn->GetController());
+	}
+
+	for (int32 Slot = 1; Slot < MaxVersusPlayers; Slot++)
+	{
+		const FVersusPlayerSystems& Player = Players[Slot];
+		if ((Controller && Controller == Player.Controller.Get())
+			|| RunnerOrSystem == Player.ScoreSystem.Get()
+			|| RunnerOrSystem == Player.LivesSystem.Get()
+			|| RunnerOrSystem == Player.OverclockSystem.Get())
+		{
+			return Slot;
+		}
+	}
+
+	return 0;
+}
+
+FVersusPlayerSystems UVersusModeComponent::FindPlayerSystems(const UObject* RunnerOrSystem)
+{
+	const UVersusModeComponent* Versus = Get(RunnerOrSystem);
+	return Versus ? Versus->GetPlayerSystems(Versus->GetPlayerSlot(RunnerOrSystem)) : FVersusPlayerSystems();
+}
+
+const FVersusPlayerSystems* UVersusModeComponent::GetContactSystems() const
+{
+	return ContactSlot > 0 ? &Players[ContactSlot] : nullptr;
+}
+
+void UVersusModeComponent::ForEachRivalRunner(TFunctionRef<void(int32 Slot, AStateRunner_ArcadeCharacter& Runner)> Func) const
+{
+	if (!bVersusActive)
+	{
+		return;
+	}
+
+	for (int32 Slot = 1; Slot < MaxVersusPlayers; Slot++)
+	{
+		const APlayerController* Controller = Players[Slot].Controller;
+		if (AStateRunner_ArcadeCharacter* Runner = Controller ? Cast<AStateRunner_ArcadeCharacter>(Controller->GetPawn()) : nullptr)
+		{
+			Func(Slot, *Runner);
+		}
+	}
+}
+
+void UVersusModeComponent::FollowPlayerOne(const AActor* Source, TFunctionRef<void(AStateRunner_ArcadeCharacter& Runner)> Func)
+{
+	const UVersusModeComponent* Versus = Get(Source);
+	if (!Versus || !Versus->IsVersusActive() || Versus->GetPlayerSlot(Source) != 0)
+	{
+		return;
+	}
+
+	Versus->ForEachRivalRunner([Versus, &Func](int32 Slot, AStateRunner_ArcadeCharacter& Runner)
+	{
+		if (!Versus->IsPlayerOut(Slot))
+		{
+			Func(Runner);
+		}
+	});
+}
+
+void UVersusModeComponent::HandleScoringStarted(const UScoreSystemComponent* ScoreSystem)
+{
+	if (!bVersusActive || GetPlayerSlot(ScoreSystem) != 0)
+	{
+		return;
+	}
+
+	for (int32 Slot = 1; Slot < MaxVersusPlayers; Slot++)
+	{
+		if (Players[Slot].ScoreSystem && !bPlayerOut[Slot])
+		{
+			Players[Slot].ScoreSystem->StartScoring();
+		}
+	}
+}
+
+void UVersusModeComponent::UpdateSharedOverclock()
+{
+	const AStateRunner_ArcadeGameMode* GameMode = Cast<AStateRunner_ArcadeGameMode>(GetOwner());
+	UWorldScrollComponent* WorldScroll = GameMode ? GameMode->GetWorldScrollComponent() : nullptr;
+	if (!WorldScroll)
+	{
+		return;
+	}
+
+	float Multiplier = 1.0f;
+	bool bAnyActive = false;
+	for (int32 Slot = 0; Slot < GetNumPlayers(); Slot++)
+	{
+		const UOverclockSystemComponent* Overclock = GetPlayerSystems(Slot).OverclockSystem;
+		if (Overclock && Overclock->IsOverclockActive())
+		{
+			Multiplier = FMath::Max(Multiplier, Overclock->GetSpeedMultiplier());
+			bAnyActive = true;
+		}
+	}
+
+	WorldScroll->SetOverclockMultiplier(Multiplier, bAnyActive);
+}
+
+void UVersusModeComponent::HandlePlayerKnockedOut(const ULivesSystemComponent* LivesSystem)
+{
+	const int32 Slot = GetPlayerSlot(LivesSystem);
+	if (!bVersusActive || bMatchOver || bPlayerOut[Slot])
+	{
+		return;
+	}
+
+	bPlayerOut[Slot] = true;
+
+	const FVersusPlayerSystems Systems = GetPlayerSystems(Slot);
+	if (Systems.OverclockSystem)
+	{
+		Systems.OverclockSystem->ResetOverclock();
+	}
+	if (Systems.Runner)
+	{
+		Systems.Runner->DisableGameplayInput();
+	}
+
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("VersusMode: Player %d is out (score %d)"),
+		Slot + 1, Systems.ScoreSystem ? Systems.ScoreSystem->GetCurrentScore() : 0);
+
+	for (int32 Other = 0; Other < MaxVersusPlayers; Other++)
+	{
+		if (!bPlayerOut[Other])
+		{
+			return;
+		}
+	}
+
+	EndMatch();
+}
+
+void UVersusModeComponent::ResetRivals()
+{
+	if (!bVersusActive)
+	{
+		return;
+	}
+
+	for (int32 Slot = 1; Slot < MaxVersusPlayers; Slot++)
+	{
+		const FVersusPlayerSystems& Player = Players[Slot];
+		if (Player.ScoreSystem)
+		{
+			Player.ScoreSystem->ResetScore();
+		}
+		if (Player.LivesSystem)
+		{
+			Player.LivesSystem->ResetLives();
+		}
+		if (Player.OverclockSystem)
+		{
+			Player.OverclockSystem->ResetOverclock();
+		}
+	}
+
+	for (bool& bOut : bPlayerOut)
+	{
+		bOut = false;
+	}
+	bMatchOver = false;
+}
+
+// --- Contact Scope ---
+
+UVersusModeComponent::FContactScope::FContactScope(UVersusModeComponent* InVersus, int32 Slot)
+	: Versus(InVersus)
+	, PreviousSlot(InVersus ? InVersus->ContactSlot : 0)
+{
+	if (Versus)
+	{
+		Versus->ContactSlot = Slot;
+	}
+}
+
+UVersusModeComponent::FContactScope::~FContactScope()
+{
+	if (Versus)
+	{
+		Versus->ContactSlot = PreviousSlot;
+	}
+}
+
+// --- Internal Functions ---
+
+bool UVersusModeComponent::CreateRivalPlayers()
+{
+	for (int32 Slot = 1; Slot < MaxVersusPlayers; Slot++)
+	{
+		// Reuse a local player that's already there (PIE with several players, a restarted level)
+		APlayerController* Controller = UGameplayStatics::GetPlayerController(this, Slot);
+		if (!Controller)
+		{
+			Controller = UGameplayStatics::CreatePlayer(this, Slot, true);
+			bCreatedRivalPlayers |= Controller != nullptr;
+		}
+
+		if (!Controller)
+		{
+			return false;
+		}
+		Players[Slot].Controller = Controller;
+	}
+
+	if (UGameViewportClient* Viewport = GetWorld() ? GetWorld()->GetGameViewport() : nullptr)
+	{
+		Viewport->SetForceDisableSplitscreen(false);
+	}
+
+	return true;
+}
+
+void UVersusModeComponent::CreateRivalSystems(int32 Slot)
+{
+	AStateRunner_ArcadeGameMode* GameMode = Cast<AStateRunner_ArcadeGameMode>(GetOwner());
+	if (!GameMode)
+	{
+		return;
+	}
+
+	FVersusPlayerSystems& Player = Players[Slot];
+	Player.ScoreSystem = VersusMode_CreateRivalSystem(GameMode, GameMode->ScoreSystemComponent.Get(), Slot);
+	Player.LivesSystem = VersusMode_CreateRivalSystem(GameMode, GameMode->LivesSystemComponent.Get(), Slot);
+	Player.OverclockSystem = VersusMode_CreateRivalSystem(GameMode, GameMode->OverclockSystemComponent.Get(), Slot);
+
+	// Debug overrides are set on Player 1's instance, not its defaults
+	if (Player.ScoreSystem)
+	{
+		Player.ScoreSystem->DebugInitialScore = GameMode->ScoreSystemComponent->DebugInitialScore;
+		Player.ScoreSystem->DebugInitialTimeElapsed = GameMode->ScoreSystemComponent->DebugInitialTimeElapsed;
+	}
+
+	// Registered once all three exist: their BeginPlay finds its siblings through FindPlayerSystems
+	UActorComponent* const Systems[] = { Player.ScoreSystem.Get(), Player.LivesSystem.Get(), Player.OverclockSystem.Get() };
+	for (UActorComponent* System : Systems)
+	{
+		if (System)
+		{
+			GameMode->AddInstanceComponent(System);
+			System->RegisterComponent();
+		}
+	}
+}
+
+void UVersusModeComponent::ConfigureRunners()
+{
+	for (int32 Slot = 0; Slot < MaxVersusPlayers; Slot++)
+	{
+		const FVersusPlayerSystems Systems = GetPlayerSystems(Slot);
+		if (!Systems.Runner)
+		{
+			UE_LOG(LogStateRunner_Arcade, Warning, TEXT("VersusMode: Player %d has no runner"), Slot + 1);
+			continue;
+		}
+
+		// Both run the same lanes -- they must pass through each other
+		if (UCapsuleComponent* Capsule = Systems.Runner->GetCapsuleComponent())
+		{
+			Capsule->SetCollisionResponseToChannel(ECC_Pawn, ECR_Ignore);
+		}
+		if (USkeletalMeshComponent* Mesh = Systems.Runner->GetMesh())
+		{
+			Mesh->SetCollisionResponseToChannel(ECC_Pawn, ECR_Ignore);
+		}
+
+		if (!bShowRivalRunner)
+		{
+			for (int32 Other = 0; Other < MaxVersusPlayers; Other++)
+			{
+				APlayerController* OtherController = GetPlayerSystems(Other).Controller;
+				if (Other != Slot && OtherController)
+				{
+					OtherController->HiddenActors.AddUnique(Systems.Runner);
+				}
+			}
+		}
+
+		if (Slot > 0 && RivalHUDClass)
+		{
+			if (UUserWidget* HUD = CreateWidget<UUserWidget>(Systems.Controller, RivalHUDClass))
+			{
+				HUD->AddToPlayerScreen();
+				RivalHUDs.Add(HUD);
+			}
+		}
+	}
+}
+
+void UVersusModeComponent::EndMatch()
+{
+	bMatchOver = true;
+
+	const AStateRunner_ArcadeGameMode* GameMode = Cast<AStateRunner_ArcadeGameMode>(GetOwner());
+	if (UWorldScrollComponent* WorldScroll = GameMode ? GameMode->GetWorldScrollComponent() : nullptr)
+	{
+		WorldScroll->SetScrollingEnabled(false);
+	}
+
+	int32 WinnerSlot = INDEX_NONE;
+	int32 WinningScore = -1;
+	for (int32 Slot = 0; Slot < MaxVersusPlayers; Slot++)
+	{
+		const UScoreSystemComponent* Score = GetPlayerSystems(Slot).ScoreSystem;
+		const int32 FinalScore = Score ? Score->GetCurrentScore() : 0;
+		if (FinalScore > WinningScore)
+		{
+			WinnerSlot = Slot;
+			WinningScore = FinalScore;
+		}
+		else if (FinalScore == WinningScore)
+		{
+			WinnerSlot = INDEX_NONE;
+		}
+	}
+
+	if (WinnerSlot != INDEX_NONE)
+	{
+		UE_LOG(LogStateRunner_Arcade, Log, TEXT("VersusMode: Match over -- Player %d wins with %d"), WinnerSlot + 1, WinningScore);
+	}
+	else
+	{
+		UE_LOG(LogStateRunner_Arcade, Log, TEXT("VersusMode: Match over -- tied at %d"), WinningScore);
+	}
+
+	OnVersusMatchOver.Broadcast(WinnerSlot, WinningScore);
+
+	// Held back at each knockout so the game-over flow runs once, for the whole match
+	for (int32 Slot = 0; Slot < MaxVersusPlayers; Slot++)
+	{
+		if (ULivesSystemComponent* Lives = GetPlayerSystems(Slot).LivesSystem)
+		{
+			Lives->OnPlayerDied.Broadcast();
+		}
+	}
+}
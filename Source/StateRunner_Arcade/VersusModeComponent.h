@@ -0,0 +1,220 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "Templates/Function.h"
+#include "VersusModeComponent.generated.h"
+
+class AStateRunner_ArcadeCharacter;
+class APlayerController;
+class UScoreSystemComponent;
+class ULivesSystemComponent;
+class UOverclockSystemComponent;
+class UUserWidget;
+
+/**
+ * Delegate broadcast when the last versus runner is out.
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnVersusMatchOver, int32, WinnerSlot, int32, WinningScore);
+
+/**
+ * One player's own systems. Everything else (scroll, spawners, pools, difficulty) is shared.
+ */
+USTRUCT(BlueprintType)
+struct FVersusPlayerSystems
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category="Versus")
+	TObjectPtr<APlayerController> Controller;
+
+	/** The controller's pawn when the lookup was made (may be null before it spawns) */
+	UPROPERTY(BlueprintReadOnly, Category="Versus")
+	TObjectPtr<AStateRunner_ArcadeCharacter> Runner;
+
+	UPROPERTY(BlueprintReadOnly, Category="Versus")
+	TObjectPtr<UScoreSystemComponent> ScoreSystem;
+
+	UPROPERTY(BlueprintReadOnly, Category="Versus")
+	TObjectPtr<ULivesSystemComponent> LivesSystem;
+
+	UPROPERTY(BlueprintReadOnly, Category="Versus")
+	TObjectPtr<UOverclockSystemComponent> OverclockSystem;
+};
+
+/**
+ * Versus Mode Component
+ *
+ * Head-to-head split-screen: a second local player runs the same track as Player 1. Both
+ * runners share ONE world scroll, obstacle/pickup spawner, pool set and difficulty curve --
+ * the seeded segment layout is generated once and both runners play it -- so the second
+ * player costs a pawn, a viewport and its own score, lives and OVERCLOCK, not a second
+ * simulation.
+ *
+ * Player 1 keeps the GameMode's own score/lives/OVERCLOCK components. Each rival slot gets
+ * copies built from the same Blueprint defaults at BeginPlay. Per-player code finds its own
+ * through FindPlayerSystems (runner, controller or per-player system in, that player's set
+ * out); while a runner's obstacle/pickup contact is dispatched, the GameMode getters return
+ * that runner's systems so Blueprint hit handlers reach the right player.
+ *
+ * What the shared track means for play:
+ * - Pickups go to whichever runner reaches them first; an EMP clears the track for both.
+ * - The scroll runs at the fastest active OVERCLOCK, and a hit doesn't slow it down.
+ * - A runner that loses its last life is out (input off, contacts ignored). The match ends
+ *   when the last one is out: scrolling stops, OnVersusMatchOver names the top score, then
+ *   every player's OnPlayerDied fires so the usual game-over flow runs once.
+ * - The game flow drives Player 1; rivals follow its rise, input enable and scoring start.
+ *
+ * Started with "?Versus" on the level URL or "-Versus" on the command line. Stands down
+ * under the autopilot, and replays/ghosts stand down under it. Split-screen layout is the
+ * project's two-player splitscreen setting. Attached to GameMode.
+ */
+UCLASS(ClassGroup=(StateRunner), meta=(BlueprintSpawnableComponent))
+class STATERUNNER_ARCADE_API UVersusModeComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+
+	UVersusModeComponent();
+
+	/** Players in a versus match, Player 1 included */
+	static constexpr int32 MaxVersusPlayers = 2;
+
+	/** Get the running GameMode's versus component (null outside a run) */
+	static UVersusModeComponent* Get(const UObject* WorldContextObject);
+
+protected:
+
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	// --- Configuration ---
+
+protected:
+
+	/** HUD added to each rival's split of the screen (Player 1's comes from the usual game flow) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Versus")
+	TSubclassOf<UUserWidget> RivalHUDClass;
+
+	/** Draw the other runner in each player's view (both run the same lanes, so it overlaps) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Versus")
+	bool bShowRivalRunner = true;
+
+	// --- Runtime State ---
+
+protected:
+
+	/** Requested by the launch options and not stood down */
+	bool bVersusActive = false;
+
+	/** Rival local players this component created (removed again at EndPlay) */
+	bool bCreatedRivalPlayers = false;
+
+	/** Slot 0 is filled from the GameMode on demand; rival slots are built at BeginPlay */
+	UPROPERTY()
+	FVersusPlayerSystems Players[MaxVersusPlayers];
+
+	UPROPERTY()
+	TArray<TObjectPtr<UUserWidget>> RivalHUDs;
+
+	/** Slot whose contact handlers are running (0 when none) */
+	int32 ContactSlot = 0;
+
+	/** Out of lives, waiting for the match to end */
+	bool bPlayerOut[MaxVersusPlayers] = {};
+
+	bool bMatchOver = false;
+
+	// --- Events ---
+
+public:
+
+	/** Last runner out; WinnerSlot is INDEX_NONE on a tie */
+	UPROPERTY(BlueprintAssignable, Category="Versus")
+	FOnVersusMatchOver OnVersusMatchOver;
+
+	// --- Public Functions ---
+
+public:
+
+	/** Read ?Versus / -Versus. Called by the GameMode before Super::BeginPlay, after the autopilot's. */
+	void ApplyLaunchOptions(const FString& Options);
+
+	UFUNCTION(BlueprintPure, Category="Versus")
+	bool IsVersusActive() const { return bVersusActive; }
+
+	/** 2 in versus, 1 otherwise */
+	UFUNCTION(BlueprintPure, Category="Versus")
+	int32 GetNumPlayers() const { return bVersusActive ? MaxVersusPlayers : 1; }
+
+	/** A player's systems, with Runner resolved now (empty for an unused slot) */
+	UFUNCTION(BlueprintPure, Category="Versus")
+	FVersusPlayerSystems GetPlayerSystems(int32 Slot) const;
+
+	/** Slot of a runner, its controller, or one of its per-player systems (0 if it isn't a rival's) */
+	UFUNCTION(BlueprintPure, Category="Versus")
+	int32 GetPlayerSlot(const UObject* RunnerOrSystem) const;
+
+	/** True once a versus player has lost their last life (always false outside versus) */
+	UFUNCTION(BlueprintPure, Category="Versus")
+	bool IsPlayerOut(int32 Slot) const { return bVersusActive && Slot >= 0 && Slot < MaxVersusPlayers && bPlayerOut[Slot]; }
+
+	/** Per-player systems of a runner, controller or per-player system (Player 1's outside versus) */
+	static FVersusPlayerSystems FindPlayerSystems(const UObject* RunnerOrSystem);
+
+	/** Systems of the rival whose contact is being dispatched (null when none, or it's Player 1's) */
+	const FVersusPlayerSystems* GetContactSystems() const;
+
+	/**
+	 * Call Func for every rival runner that has a pawn, out or not.
+	 * Does nothing outside versus.
+	 */
+	void ForEachRivalRunner(TFunctionRef<void(int32 Slot, AStateRunner_ArcadeCharacter& Runner)> Func) const;
+
+	/**
+	 * Player 1's game flow step, repeated for the rival runners still in. Does nothing unless
+	 * versus is on and Source is Player 1's runner.
+	 */
+	static void FollowPlayerOne(const AActor* Source, TFunctionRef<void(AStateRunner_ArcadeCharacter& Runner)> Func);
+
+	/** Player 1's scoring started (countdown GO or restart): start the rivals' still in */
+	void HandleScoringStarted(const UScoreSystemComponent* ScoreSystem);
+
+	/** A player's OVERCLOCK changed: the shared scroll runs at the fastest active multiplier */
+	void UpdateSharedOverclock();
+
+	/** A player lost their last life. Ends the match when no one is left. */
+	void HandlePlayerKnockedOut(const ULivesSystemComponent* LivesSystem);
+
+	/** Reset the rivals' score, lives and OVERCLOCK and bring everyone back in (game over restart) */
+	UFUNCTION(BlueprintCallable, Category="Versus")
+	void ResetRivals();
+
+	/** Routes the GameMode's score/lives/OVERCLOCK getters to one runner while its contact handlers run */
+	struct FContactScope
+	{
+		FContactScope(UVersusModeComponent* InVersus, int32 Slot);
+		~FContactScope();
+
+	private:
+		UVersusModeComponent* Versus;
+		int32 PreviousSlot;
+	};
+
+	// --- Internal Functions ---
+
+protected:
+
+	/** Create the rival local players (with their pawns and split-screen views) */
+	bool CreateRivalPlayers();
+
+	/** Build a rival slot's score, lives and OVERCLOCK from Player 1's Blueprint defaults */
+	void CreateRivalSystems(int32 Slot);
+
+	/** Runners ignore each other, optionally can't see each other, and rivals get their HUDs */
+	void ConfigureRunners();
+
+	/** Stop scrolling, pick the winner, and let every player's OnPlayerDied fire */
+	void EndMatch();
+};
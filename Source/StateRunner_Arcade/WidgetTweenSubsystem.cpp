@@ -0,0 +1,179 @@
+#include "WidgetTweenSubsystem.h"
+#include "StateRunner_Arcade.h"
+#include "Components/Widget.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+// --- Subsystem Lifecycle ---
+
+bool UWidgetTweenSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld() && Super::ShouldCreateSubsystem(Outer);
+}
+
+TStatId UWidgetTweenSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UWidgetTweenSubsystem, STATGROUP_Tickables);
+}
+
+void UWidgetTweenSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	const UWorld* World = GetWorld();
+	if (!World || Tweens.Num() == 0)
+	{
+		return;
+	}
+
+	// Undilated, like the widget ticks this replaces
+	const float RealDeltaTime = World->DeltaRealTimeSeconds;
+
+	for (int32 i = Tweens.Num() - 1; i >= 0; i--)
+	{
+		FActiveTween& Tween = Tweens[i];
+		if (!Tween.Owner.IsValid())
+		{
+			Tweens.RemoveAtSwap(i, EAllowShrinking::No);
+			continue;
+		}
+
+		Tween.Elapsed += RealDeltaTime;
+		const float Alpha = Tween.Params.Duration > 0.0f ? FMath::Min(Tween.Elapsed / Tween.Params.Duration, 1.0f) : 1.0f;
+		const float Eased = EvaluateEase(Tween.Params.Ease, Alpha, Tween.Params.EaseExponent);
+		ApplyValue(Tween, FMath::Lerp(Tween.Params.From, Tween.Params.To, Eased));
+
+		if (Alpha >= 1.0f)
+		{
+			if (Tween.OnComplete)
+			{
+				PendingCompletions.Add(MoveTemp(Tween.OnComplete));
+			}
+			Tweens.RemoveAtSwap(i, EAllowShrinking::No);
+		}
+	}
+
+	// After the pass -- completions commonly start the next tween on the same channel
+	for (int32 i = 0; i < PendingCompletions.Num(); i++)
+	{
+		TFunction<void()> Callback = MoveTemp(PendingCompletions[i]);
+		Callback();
+	}
+	PendingCompletions.Reset();
+}
+
+UWidgetTweenSubsystem* UWidgetTweenSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject || !GEngine)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UWidgetTweenSubsystem>() : nullptr;
+}
+
+// --- Public Functions ---
+
+void UWidgetTweenSubsystem::StartTween(UObject* Owner, FName Channel, TArrayView<UWidget* const> Targets,
+	const FWidgetTweenParams& Params, TFunction<void()>&& OnComplete)
+{
+	if (!Owner)
+	{
+		UE_LOG(LogStateRunner_Arcade, Warning, TEXT("WidgetTweenSubsystem: StartTween called without an owner"));
+		return;
+	}
+
+	const int32 ExistingIndex = FindTween(Owner, Channel);
+	FActiveTween& Tween = ExistingIndex != INDEX_NONE ? Tweens[ExistingIndex] : Tweens.AddDefaulted_GetRef();
+
+	Tween.Owner = Owner;
+	Tween.Channel = Channel;
+	Tween.Targets.Reset();
+	for (UWidget* Target : Targets)
+	{
+		if (Target)
+		{
+			Tween.Targets.Add(Target);
+		}
+	}
+	Tween.Params = Params;
+	Tween.Elapsed = 0.0f;
+	Tween.OnComplete = MoveTemp(OnComplete);
+
+	ApplyValue(Tween, Params.From);
+}
+
+void UWidgetTweenSubsystem::StopTween(const UObject* Owner, FName Channel)
+{
+	const int32 Index = FindTween(Owner, Channel);
+	if (Index != INDEX_NONE)
+	{
+		Tweens.RemoveAtSwap(Index, EAllowShrinking::No);
+	}
+}
+
+void UWidgetTweenSubsystem::StopAllTweens(const UObject* Owner)
+{
+	Tweens.RemoveAllSwap([Owner](const FActiveTween& Tween)
+	{
+		return Tween.Owner.Get() == Owner;
+	}, EAllowShrinking::No);
+}
+
+bool UWidgetTweenSubsystem::IsTweening(const UObject* Owner, FName Channel) const
+{
+	return FindTween(Owner, Channel) != INDEX_NONE;
+}
+
+float UWidgetTweenSubsystem::EvaluateEase(EWidgetTweenEase Ease, float Alpha, float Exponent)
+{
+	switch (Ease)
+	{
+	case EWidgetTweenEase::EaseIn:
+		return FMath::Pow(Alpha, Exponent);
+	case EWidgetTweenEase::EaseOut:
+		return 1.0f - FMath::Pow(1.0f - Alpha, Exponent);
+	case EWidgetTweenEase::EaseInOut:
+		return FMath::InterpEaseInOut(0.0f, 1.0f, Alpha, Exponent);
+	default:
+		return Alpha;
+	}
+}
+
+// --- Internal Functions ---
+
+int32 UWidgetTweenSubsystem::FindTween(const UObject* Owner, FName Channel) const
+{
+	for (int32 i = 0; i < Tweens.Num(); i++)
+	{
+		if (Tweens[i].Channel == Channel && Tweens[i].Owner.Get() == Owner)
+		{
+			return i;
+		}
+	}
+	return INDEX_NONE;
+}
+
+void UWidgetTweenSubsystem::ApplyValue(const FActiveTween& Tween, float Value)
+{
+	for (const TWeakObjectPtr<UWidget>& WeakTarget : Tween.Targets)
+	{
+		UWidget* Target = WeakTarget.Get();
+		if (!Target)
+		{
+			continue;
+		}
+
+		switch (Tween.Params.Property)
+		{
+		case EWidgetTweenProperty::RenderScale:
+			Target->SetRenderScale(FVector2D(Value, Value));
+			break;
+		case EWidgetTweenProperty::RenderOpacity:
+			Target->SetRenderOpacity(Value);
+			break;
+		}
+	}
+}
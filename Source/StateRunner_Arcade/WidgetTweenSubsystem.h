@@ -0,0 +1,152 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WidgetTweenSubsystem.generated.h"
+
+class UWidget;
+
+/**
+ * Easing curve of a widget tween.
+ */
+enum class EWidgetTweenEase : uint8
+{
+	Linear,
+
+	/** Alpha^Exponent -- starts slow, accelerates (shrink-out) */
+	EaseIn,
+
+	/** 1 - (1 - Alpha)^Exponent -- starts fast, decelerates (grow-in) */
+	EaseOut,
+
+	/** EaseIn for the first half, EaseOut for the second */
+	EaseInOut
+};
+
+/**
+ * Widget property a tween drives.
+ */
+enum class EWidgetTweenProperty : uint8
+{
+	/** Uniform SetRenderScale(Value, Value) */
+	RenderScale,
+
+	/** SetRenderOpacity(Value) */
+	RenderOpacity
+};
+
+/**
+ * Parameters for UWidgetTweenSubsystem::StartTween.
+ */
+struct FWidgetTweenParams
+{
+	EWidgetTweenProperty Property = EWidgetTweenProperty::RenderScale;
+	float From = 0.0f;
+	float To = 1.0f;
+	float Duration = 0.2f;
+	EWidgetTweenEase Ease = EWidgetTweenEase::EaseOut;
+	float EaseExponent = 2.0f;
+};
+
+/**
+ * Widget Tween Subsystem
+ *
+ * One shared animator for code-driven widget motion (popup grow/shrink, fades), so widgets
+ * don't each run their own per-frame state machines from NativeTick.
+ *
+ * Active tweens live in one compact array and are evaluated in a single pass per frame;
+ * finished tweens are swap-removed and their completion callbacks run after the pass
+ * (a callback may start the next tween). With nothing animating the subsystem reports
+ * itself not tickable, so idle UI costs nothing.
+ *
+ * Tweens are keyed by (Owner, Channel): starting a tween on a channel replaces whatever was
+ * running there, which is exactly the "cancel grow, start shrink" a popup needs.
+ * Time is undilated real time and keeps running while paused, like widget ticks.
+ */
+UCLASS()
+class STATERUNNER_ARCADE_API UWidgetTweenSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	// --- Subsystem Lifecycle ---
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Menus animate while the game is paused */
+	virtual bool IsTickableWhenPaused() const override { return true; }
+
+	/** Idle = no tick */
+	virtual bool IsTickable() const override { return Tweens.Num() > 0; }
+
+	/** Get the subsystem from a world context (null outside game worlds) */
+	static UWidgetTweenSubsystem* Get(const UObject* WorldContextObject);
+
+	// --- Runtime State ---
+
+protected:
+
+	struct FActiveTween
+	{
+		TWeakObjectPtr<UObject> Owner;
+		FName Channel;
+
+		/** Widgets moved together (a popup's container, background and text) */
+		TArray<TWeakObjectPtr<UWidget>, TInlineAllocator<3>> Targets;
+
+		FWidgetTweenParams Params;
+		float Elapsed = 0.0f;
+		TFunction<void()> OnComplete;
+	};
+
+	/** Running tweens (unordered; swap-removed when they finish) */
+	TArray<FActiveTween> Tweens;
+
+	/** Callbacks of tweens that finished this pass, run once the pass is done */
+	TArray<TFunction<void()>> PendingCompletions;
+
+	// --- Public Functions ---
+
+public:
+
+	/**
+	 * Animate Targets from Params.From to Params.To. Replaces any tween on (Owner, Channel)
+	 * without calling its completion. The From value is applied immediately.
+	 *
+	 * @param Owner UObject whose lifetime bounds the tween (dropped silently once it's gone)
+	 * @param Channel Slot on Owner (e.g. "TutorialPopup")
+	 * @param Targets Widgets to drive (nulls are skipped)
+	 * @param Params Property, range, duration and easing
+	 * @param OnComplete Called once after the final value is applied
+	 */
+	void StartTween(UObject* Owner, FName Channel, TArrayView<UWidget* const> Targets,
+		const FWidgetTweenParams& Params, TFunction<void()>&& OnComplete = nullptr);
+
+	/** Stop the tween on (Owner, Channel), leaving the widgets where they are (no completion) */
+	void StopTween(const UObject* Owner, FName Channel);
+
+	/** Stop every tween Owner started */
+	void StopAllTweens(const UObject* Owner);
+
+	/** True while a tween runs on (Owner, Channel) */
+	bool IsTweening(const UObject* Owner, FName Channel) const;
+
+	/** Number of running tweens (debug) */
+	int32 GetActiveTweenCount() const { return Tweens.Num(); }
+
+	/** Map linear 0..1 progress through an easing curve */
+	static float EvaluateEase(EWidgetTweenEase Ease, float Alpha, float Exponent);
+
+	// --- Internal Functions ---
+
+protected:
+
+	/** Index of the tween on (Owner, Channel), or INDEX_NONE */
+	int32 FindTween(const UObject* Owner, FName Channel) const;
+
+	/** Push Value to every live target */
+	static void ApplyValue(const FActiveTween& Tween, float Value);
+};
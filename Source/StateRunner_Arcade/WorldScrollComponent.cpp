@@ -3,6 +3,14 @@
 #include "StateRunner_Arcade.h"
 #include "StateRunner_ArcadeGameMode.h"
 #include "ObstacleSpawnerComponent.h"
+#include "DifficultyDirectorComponent.h"
+#include "BaseObstacle.h"
+#include "BasePickup.h"
+#include "StateRunner_ArcadeCharacter.h"
+#include "VersusModeComponent.h"
+#include "Kismet/GameplayStatics.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
 #include "Engine/Engine.h"
 
 //=============================================================================
@@ -40,11 +48,12 @@ void UWorldScrollComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// Initialize scroll speed to base value
-	CurrentScrollSpeed = BaseScrollSpeed;
-	LastBroadcastSpeed = BaseScrollSpeed;
+	// Initialize scroll speed to the curve's starting value
+	DifficultyDirector = UDifficultyDirectorComponent::Get(this);
+	CurrentScrollSpeed = DifficultyDirector->GetScrollSpeedAt(0.0f);
+	LastBroadcastSpeed = CurrentScrollSpeed;
 
-	// Cache ObstacleSpawnerComponent reference for tutorial prompt checking
+	// Cache ObstacleSpawnerComponent reference for the instanced obstacle sync
 	if (UWorld* World = GetWorld())
 	{
 		if (AStateRunner_ArcadeGameMode* GameMode = Cast<AStateRunner_ArcadeGameMode>(World->GetAuthGameMode()))
@@ -53,12 +62,46 @@ void UWorldScrollComponent::BeginPlay()
 		}
 	}
 
+	// Significance distances are measured from the runner's spawn line
+	if (CachedObstacleSpawner)
+	{
+		RunnerTrackX = CachedObstacleSpawner->GetPlayerXPosition();
+	}
+	CollisionDistance = FMath::Min(CollisionDistance, FullDetailDistance);
+
+	// Fixed-step mode: the simulation subsystem steps us, tick stays off
+	if (UGameplaySimulationSubsystem* Simulation = UGameplaySimulationSubsystem::Get(this))
+	{
+		if (Simulation->IsFixedStepEnabled())
+		{
+			Simulation->RegisterParticipant(this, this, ESimulationPhase::Scroll);
+			bSimulationDriven = true;
+			SetComponentTickEnabled(false);
+		}
+	}
+
 	UE_LOG(LogStateRunner_Arcade, Log, TEXT("WorldScrollComponent initialized:"));
-	UE_LOG(LogStateRunner_Arcade, Log, TEXT("  - BaseScrollSpeed: %.2f units/sec"), BaseScrollSpeed);
-	UE_LOG(LogStateRunner_Arcade, Log, TEXT("  - ScrollSpeedIncrease: %.2f units/sec²"), ScrollSpeedIncrease);
-	UE_LOG(LogStateRunner_Arcade, Log, TEXT("  - MaxScrollSpeed: %.2f units/sec"), MaxScrollSpeed);
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("  - Scroll speed: %.2f units/sec, tops out at %.2f after %.1f sec"),
+		CurrentScrollSpeed, DifficultyDirector->GetMaxScrollSpeed(), DifficultyDirector->GetTimeToMaxScrollSpeed());
 	UE_LOG(LogStateRunner_Arcade, Log, TEXT("  - DamageSlowdownMultiplier: %.2f (%.0f%% speed)"), 
 		DamageSlowdownMultiplier, DamageSlowdownMultiplier * 100.0f);
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("  - ScrollMode: %s"),
+		ScrollMode == EScrollMode::MoveRunner ? TEXT("MoveRunner (static world)") : TEXT("MoveWorld"));
+	if (bUseDistanceSignificance)
+	{
+		UE_LOG(LogStateRunner_Arcade, Log, TEXT("  - Significance: full detail within %.0f, collision within %.0f of X=%.0f"),
+			FullDetailDistance, CollisionDistance, RunnerTrackX);
+	}
+}
+
+void UWorldScrollComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UGameplaySimulationSubsystem* Simulation = UGameplaySimulationSubsystem::Get(this))
+	{
+		Simulation->UnregisterParticipant(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 //=============================================================================
@@ -67,6 +110,8 @@ void UWorldScrollComponent::BeginPlay()
 
 void UWorldScrollComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
+	STATERUNNER_SCOPE_CYCLE_COUNTER(WorldScrollTick);
+
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
 	// Only process if scrolling is enabled
@@ -75,6 +120,47 @@ void UWorldScrollComponent::TickComponent(float DeltaTime, ELevelTick TickType,
 		return;
 	}
 
+	AdvanceScrollTime(DeltaTime);
+
+	LastStepScrollDistance = GetCurrentScrollSpeed() * DeltaTime;
+	PresentScroll(LastStepScrollDistance);
+}
+
+//=============================================================================
+// FIXED-STEP SIMULATION
+//=============================================================================
+
+void UWorldScrollComponent::SimulateStep(float StepSeconds)
+{
+	if (!bIsScrolling)
+	{
+		LastStepScrollDistance = 0.0f;
+		return;
+	}
+
+	AdvanceScrollTime(StepSeconds);
+
+	LastStepScrollDistance = GetCurrentScrollSpeed() * StepSeconds;
+	SimScrollDistance += LastStepScrollDistance;
+}
+
+void UWorldScrollComponent::PostSimulate(float Alpha, int32 StepsThisFrame)
+{
+	if (!bIsScrolling)
+	{
+		return;
+	}
+
+	// Present between the last two steps so motion is smooth at any frame rate
+	const double DisplayedDistance = SimScrollDistance - (1.0f - Alpha) * LastStepScrollDistance;
+	const float FrameDelta = static_cast<float>(FMath::Max(DisplayedDistance - AppliedScrollDistance, 0.0));
+	AppliedScrollDistance += FrameDelta;
+
+	PresentScroll(FrameDelta);
+}
+
+void UWorldScrollComponent::AdvanceScrollTime(float DeltaTime)
+{
 	// Update time elapsed
 	TimeElapsed += DeltaTime;
 
@@ -86,15 +172,27 @@ void UWorldScrollComponent::TickComponent(float DeltaTime, ELevelTick TickType,
 	{
 		ProcessDamageSlowdown(DeltaTime);
 	}
+}
 
+void UWorldScrollComponent::PresentScroll(float ScrollDelta)
+{
 	// Broadcast speed change if threshold exceeded
 	BroadcastSpeedChangeIfNeeded();
 
-	// Check tutorial prompts (broadcasts OnTutorialPrompt event for HUD)
-	// Player is locked at X: -5000
-	if (CachedObstacleSpawner)
+	PresentedScrollDistance += ScrollDelta;
+
+	// Move all registered obstacles/pickups in one pass (or the runner, in MoveRunner mode)
+	bool bRebased = false;
+	if (ScrollMode == EScrollMode::MoveRunner)
+	{
+		bRebased = AdvanceRunner(ScrollDelta);
+	}
+	ScrollRegisteredActors(ScrollDelta);
+
+	// Instanced obstacle visuals (MoveRunner only) move with a rebase; spawns/despawns push their own slots
+	if (CachedObstacleSpawner && CachedObstacleSpawner->IsUsingInstancedRendering())
 	{
-		CachedObstacleSpawner->CheckTutorialPrompts(GetCurrentScrollSpeed(), -5000.0f);
+		CachedObstacleSpawner->SyncInstancedObstacleTransforms(bRebased);
 	}
 
 	// Periodic log every 5 seconds to show speed is increasing (for debugging)
@@ -153,15 +251,15 @@ void UWorldScrollComponent::SetScrollingEnabled(bool bEnabled)
 
 	bIsScrolling = bEnabled;
 
-	// Enable/disable tick based on scrolling state
-	SetComponentTickEnabled(bEnabled);
+	// Enable/disable tick based on scrolling state (fixed-step mode never ticks)
+	SetComponentTickEnabled(bEnabled && !bSimulationDriven);
 
 	if (bEnabled)
 	{
 		// Ensure scroll speed is initialized (in case called before BeginPlay)
 		if (CurrentScrollSpeed <= 0.0f)
 		{
-			CurrentScrollSpeed = BaseScrollSpeed;
+			UpdateScrollSpeed();
 		}
 		
 		// Reset periodic log timer when scrolling starts
@@ -176,22 +274,29 @@ void UWorldScrollComponent::SetScrollingEnabled(bool bEnabled)
 	{
 		UE_LOG(LogStateRunner_Arcade, Log, TEXT("WorldScrollComponent: Scrolling DISABLED (TimeElapsed: %.2f sec)"), TimeElapsed);
 	}
+
+	// Effective speed went to/from zero
+	OnScrollSpeedChanged.Broadcast(GetCurrentScrollSpeed());
 }
 
 void UWorldScrollComponent::ResetScrollSpeed()
 {
 	TimeElapsed = 0.0f;
-	CurrentScrollSpeed = BaseScrollSpeed;
-	LastBroadcastSpeed = BaseScrollSpeed;
+	UpdateScrollSpeed();
+	LastBroadcastSpeed = CurrentScrollSpeed;
 	LastPeriodicLogTime = 0.0f;
 	bIsDamageSlowdownActive = false;
 	DamageSlowdownTimeRemaining = 0.0f;
+	SimScrollDistance = 0.0;
+	AppliedScrollDistance = 0.0;
+	LastStepScrollDistance = 0.0f;
+	PresentedScrollDistance = 0.0;
 	
 	// Reset OVERCLOCK state
 	OverclockMultiplier = 1.0f;
 	bIsOverclockActive = false;
 
-	UE_LOG(LogStateRunner_Arcade, Log, TEXT("WorldScrollComponent: Speed RESET to base (%.2f units/sec)"), BaseScrollSpeed);
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("WorldScrollComponent: Speed RESET to base (%.2f units/sec)"), CurrentScrollSpeed);
 
 	// Broadcast the reset
 	OnScrollSpeedChanged.Broadcast(CurrentScrollSpeed);
@@ -199,12 +304,12 @@ void UWorldScrollComponent::ResetScrollSpeed()
 
 void UWorldScrollComponent::UpdateScrollSpeed()
 {
-	// Calculate new scroll speed: Base + (Time * Increase), capped at Max
-	// Formula: CurrentScrollSpeed = BaseScrollSpeed + (TimeElapsed * ScrollSpeedIncrease)
-	float NewSpeed = BaseScrollSpeed + (TimeElapsed * ScrollSpeedIncrease);
-
-	// Cap at maximum speed
-	CurrentScrollSpeed = FMath::Min(NewSpeed, MaxScrollSpeed);
+	// Table lookup -- the ramp and its cap are authored on the difficulty director
+	if (!DifficultyDirector)
+	{
+		DifficultyDirector = UDifficultyDirectorComponent::Get(this);
+	}
+	CurrentScrollSpeed = DifficultyDirector->GetScrollSpeedAt(TimeElapsed);
 }
 
 void UWorldScrollComponent::BroadcastSpeedChangeIfNeeded()
@@ -222,6 +327,257 @@ void UWorldScrollComponent::BroadcastSpeedChangeIfNeeded()
 	}
 }
 
+//=============================================================================
+// BATCHED SCROLLING
+//=============================================================================
+
+void UWorldScrollComponent::RegisterScrollable(AActor* Actor, IWorldScrollable* Scrollable, float DespawnX, EScrollSignificance Significance)
+{
+	if (!Actor || !Scrollable)
+	{
+		return;
+	}
+
+	// Already registered -- just refresh the entry
+	const int32 ExistingIndex = Scrollable->GetScrollEntryIndex();
+	if (ScrollableEntries.IsValidIndex(ExistingIndex) && ScrollableEntries[ExistingIndex].Scrollable == Scrollable)
+	{
+		FScrollableEntry& Entry = ScrollableEntries[ExistingIndex];
+		Entry.DespawnX = DespawnX;
+		Entry.Significance = Significance;
+		return;
+	}
+
+	Scrollable->SetScrollEntryIndex(ScrollableEntries.Num());
+
+	FScrollableEntry& NewEntry = ScrollableEntries.AddDefaulted_GetRef();
+	NewEntry.Actor = Actor;
+	NewEntry.Scrollable = Scrollable;
+	NewEntry.DespawnX = DespawnX;
+	NewEntry.Significance = Significance;
+}
+
+void UWorldScrollComponent::UnregisterScrollable(IWorldScrollable* Scrollable)
+{
+	if (!Scrollable)
+	{
+		return;
+	}
+
+	const int32 Index = Scrollable->GetScrollEntryIndex();
+	if (ScrollableEntries.IsValidIndex(Index) && ScrollableEntries[Index].Scrollable == Scrollable)
+	{
+		RemoveScrollableAt(Index);
+	}
+}
+
+void UWorldScrollComponent::RemoveScrollableAt(int32 Index)
+{
+	// A destroyed actor's storage can't be written -- only live actors get their index touched
+	if (IsValid(ScrollableEntries[Index].Actor))
+	{
+		ScrollableEntries[Index].Scrollable->SetScrollEntryIndex(INDEX_NONE);
+	}
+
+	ScrollableEntries.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+
+	// Whoever got swapped into the hole needs its index fixed
+	if (ScrollableEntries.IsValidIndex(Index) && IsValid(ScrollableEntries[Index].Actor))
+	{
+		ScrollableEntries[Index].Scrollable->SetScrollEntryIndex(Index);
+	}
+}
+
+void UWorldScrollComponent::ScrollRegisteredActors(float ScrollDelta)
+{
+	PendingDespawns.Reset();
+	PendingPromotions.Reset();
+
+	// Static world: actors stay put, only test despawn
+	const bool bMoveActors = (ScrollMode == EScrollMode::MoveWorld);
+
+	for (int32 i = ScrollableEntries.Num() - 1; i >= 0; --i)
+	{
+		FScrollableEntry& Entry = ScrollableEntries[i];
+		AActor* Actor = Entry.Actor;
+		if (!IsValid(Actor))
+		{
+			// Destroyed out from under us (level teardown etc.)
+			RemoveScrollableAt(i);
+			continue;
+		}
+
+		FVector Location = Actor->GetActorLocation();
+		if (bMoveActors)
+		{
+			Location.X -= ScrollDelta;
+		}
+
+		const float TrackX = WorldToTrackX(Location.X);
+		if (TrackX < Entry.DespawnX)
+		{
+			PendingDespawns.Add(Entry);
+			continue;
+		}
+
+		if (bMoveActors)
+		{
+			Actor->SetActorLocation(Location);
+		}
+
+		// Most entries are already at Contact -- the distance test only runs for the ones still far out
+		if (Entry.Significance != EScrollSignificance::Contact)
+		{
+			const EScrollSignificance NewSignificance = GetSignificanceAt(TrackX);
+			if (NewSignificance > Entry.Significance)
+			{
+				Entry.Significance = NewSignificance;
+				PendingPromotions.Add(Entry);
+			}
+		}
+	}
+
+	// Promote after the loop too -- enabling collision can collect a pickup, which unregisters it
+	for (const FScrollableEntry& Promotion : PendingPromotions)
+	{
+		PromoteScrollable(Promotion.Actor, Promotion.Significance);
+	}
+
+	// Deactivate after the loop -- Deactivate() unregisters and would reshuffle the array mid-iteration
+	for (const FScrollableEntry& Despawn : PendingDespawns)
+	{
+		DespawnScrollable(Despawn);
+	}
+}
+
+EScrollSignificance UWorldScrollComponent::GetSignificanceAt(float TrackX) const
+{
+	if (!bUseDistanceSignificance)
+	{
+		return EScrollSignificance::Contact;
+	}
+
+	const float DistanceAhead = TrackX - RunnerTrackX;
+	if (DistanceAhead > FullDetailDistance)
+	{
+		return EScrollSignificance::Far;
+	}
+	if (DistanceAhead > CollisionDistance)
+	{
+		return EScrollSignificance::Near;
+	}
+	return EScrollSignificance::Contact;
+}
+
+void UWorldScrollComponent::ApplySignificanceLOD(UStaticMeshComponent* Mesh, EScrollSignificance Significance)
+{
+	const UStaticMesh* StaticMesh = Mesh ? Mesh->GetStaticMesh() : nullptr;
+	if (!StaticMesh)
+	{
+		return;
+	}
+
+	// ForcedLodModel is 1-based (0 = automatic); single-LOD meshes have nothing to drop to
+	const int32 NumLODs = StaticMesh->GetNumLODs();
+	const int32 ForcedLod = (Significance == EScrollSignificance::Far && NumLODs > 1) ? NumLODs : 0;
+	if (Mesh->ForcedLodModel != ForcedLod)
+	{
+		Mesh->SetForcedLodModel(ForcedLod);
+	}
+}
+
+void UWorldScrollComponent::DespawnScrollable(const FScrollableEntry& Entry)
+{
+	if (ABaseObstacle* Obstacle = Cast<ABaseObstacle>(Entry.Actor))
+	{
+		Obstacle->Deactivate();
+	}
+	else if (ABasePickup* Pickup = Cast<ABasePickup>(Entry.Actor))
+	{
+		Pickup->Deactivate();
+	}
+	else if (IsValid(Entry.Actor))
+	{
+		UnregisterScrollable(Entry.Scrollable);
+	}
+}
+
+void UWorldScrollComponent::PromoteScrollable(AActor* Actor, EScrollSignificance Significance)
+{
+	if (ABaseObstacle* Obstacle = Cast<ABaseObstacle>(Actor))
+	{
+		Obstacle->SetSignificance(Significance);
+	}
+	else if (ABasePickup* Pickup = Cast<ABasePickup>(Actor))
+	{
+		Pickup->SetSignificance(Significance);
+	}
+}
+
+bool UWorldScrollComponent::AdvanceRunner(float ScrollDelta)
+{
+	if (!CachedRunner)
+	{
+		CachedRunner = Cast<AStateRunner_ArcadeCharacter>(UGameplayStatics::GetPlayerPawn(this, 0));
+		if (!CachedRunner)
+		{
+			return false;
+		}
+	}
+
+	TrackOffset += ScrollDelta;
+	CachedRunner->SetRunnerTrackOffset(TrackOffset);
+	SetRivalTrackOffsets(TrackOffset);
+
+	if (TrackOffset >= OriginRebaseDistance)
+	{
+		RebaseTrackOrigin();
+		return true;
+	}
+	return false;
+}
+
+void UWorldScrollComponent::SetRivalTrackOffsets(float Offset)
+{
+	// Versus rivals run the same track, so they move with Player 1
+	if (const UVersusModeComponent* Versus = UVersusModeComponent::Get(this))
+	{
+		Versus->ForEachRivalRunner([Offset](int32 Slot, AStateRunner_ArcadeCharacter& Runner)
+		{
+			Runner.SetRunnerTrackOffset(Offset);
+		});
+	}
+}
+
+void UWorldScrollComponent::RebaseTrackOrigin()
+{
+	const float Shift = TrackOffset;
+	if (FMath::IsNearlyZero(Shift))
+	{
+		return;
+	}
+
+	for (const FScrollableEntry& Entry : ScrollableEntries)
+	{
+		if (IsValid(Entry.Actor))
+		{
+			Entry.Actor->SetActorLocation(Entry.Actor->GetActorLocation() - FVector(Shift, 0.0f, 0.0f));
+		}
+	}
+
+	TrackOffset = 0.0f;
+	if (CachedRunner)
+	{
+		CachedRunner->SetRunnerTrackOffset(0.0f);
+	}
+	SetRivalTrackOffsets(0.0f);
+
+	UE_LOG(LogStateRunner_Arcade, Log, TEXT("WorldScrollComponent: Track origin rebased by %.0f units (%d actors shifted)"),
+		Shift, ScrollableEntries.Num());
+
+	OnTrackOriginRebased.Broadcast(Shift);
+}
+
 //=============================================================================
 // DAMAGE SLOWDOWN FUNCTIONS
 //=============================================================================
@@ -233,6 +589,8 @@ void UWorldScrollComponent::ApplyDamageSlowdown()
 
 	UE_LOG(LogStateRunner_Arcade, Log, TEXT("WorldScrollComponent: Damage slowdown APPLIED (%.2f%% speed for %.2f sec)"), 
 		DamageSlowdownMultiplier * 100.0f, DamageSlowdownDuration);
+
+	OnScrollSpeedChanged.Broadcast(GetCurrentScrollSpeed());
 }
 
 void UWorldScrollComponent::ProcessDamageSlowdown(float DeltaTime)
@@ -246,6 +604,8 @@ void UWorldScrollComponent::ProcessDamageSlowdown(float DeltaTime)
 
 		UE_LOG(LogStateRunner_Arcade, Log, TEXT("WorldScrollComponent: Damage slowdown ENDED, speed restored to %.2f units/sec"), 
 			CurrentScrollSpeed);
+
+		OnScrollSpeedChanged.Broadcast(GetCurrentScrollSpeed());
 	}
 }
 
@@ -272,3 +632,24 @@ void UWorldScrollComponent::SetOverclockMultiplier(float Multiplier, bool bActiv
 	// Broadcast speed change since effective speed has changed
 	OnScrollSpeedChanged.Broadcast(GetCurrentScrollSpeed());
 }
+
+// --- Deprecated Settings ---
+
+#if WITH_EDITORONLY_DATA
+void UWorldScrollComponent::MigrateDeprecatedDifficulty(UDifficultyDirectorComponent& Director) const
+{
+	// Old defaults = never tuned, or already migrated and resaved
+	const UWorldScrollComponent* Defaults = GetDefault<UWorldScrollComponent>();
+	if (BaseScrollSpeed_DEPRECATED == Defaults->BaseScrollSpeed_DEPRECATED
+		&& ScrollSpeedIncrease_DEPRECATED == Defaults->ScrollSpeedIncrease_DEPRECATED
+		&& MaxScrollSpeed_DEPRECATED == Defaults->MaxScrollSpeed_DEPRECATED)
+	{
+		return;
+	}
+
+	Director.SetLinearScrollSpeedRamp(BaseScrollSpeed_DEPRECATED, ScrollSpeedIncrease_DEPRECATED, MaxScrollSpeed_DEPRECATED);
+
+	UE_LOG(LogStateRunner_Arcade, Warning, TEXT("WorldScrollComponent: Moved scroll speed ramp %.0f +%.2f/sec (max %.0f) to the difficulty director's ScrollSpeedCurve - resave %s"),
+		BaseScrollSpeed_DEPRECATED, ScrollSpeedIncrease_DEPRECATED, MaxScrollSpeed_DEPRECATED, *GetPathName());
+}
+#endif
@@ -2,9 +2,15 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "GameplaySimulationSubsystem.h"
+#include "BaseObstacle.h" // For EScrollSignificance
+#include "WorldScrollable.h"
 #include "WorldScrollComponent.generated.h"
 
 class UObstacleSpawnerComponent;
+class UDifficultyDirectorComponent;
+class AStateRunner_ArcadeCharacter;
+class UStaticMeshComponent;
 
 /**
  * Delegate broadcast when scroll speed changes significantly.
@@ -12,13 +18,58 @@ class UObstacleSpawnerComponent;
  */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnScrollSpeedChanged, float, NewScrollSpeed);
 
+/**
+ * Delegate broadcast after the track origin is rebased (MoveRunner mode only).
+ * Every registered scrollable and the runner have already been shifted by -RebaseShift on X.
+ * Anything else placed in world space (e.g. Blueprint track segments) should shift itself too.
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnTrackOriginRebased, float, RebaseShift);
+
+/**
+ * How forward motion is produced.
+ */
+UENUM(BlueprintType)
+enum class EScrollMode : uint8
+{
+	/** Runner stays at its locked X, obstacles/pickups move toward -X every frame (original behavior) */
+	MoveWorld		UMETA(DisplayName = "Move World"),
+
+	/** Obstacles/pickups stay where they spawned, runner + cameras advance along +X. Origin is rebased periodically. */
+	MoveRunner		UMETA(DisplayName = "Move Runner (Static World)")
+};
+
+/**
+ * One entry in the batched scroll list.
+ * Obstacles and pickups register themselves on Activate() and are moved
+ * by UWorldScrollComponent in a single pass instead of ticking individually.
+ */
+USTRUCT()
+struct FScrollableEntry
+{
+	GENERATED_BODY()
+
+	/** The pooled actor being scrolled (ABaseObstacle, ABasePickup or ATrackSegment) */
+	UPROPERTY()
+	TObjectPtr<AActor> Actor = nullptr;
+
+	/** Actor's scroll index storage (same object; only touched while Actor is valid) */
+	IWorldScrollable* Scrollable = nullptr;
+
+	/** X position below which the actor is returned to its pool */
+	float DespawnX = -8000.0f;
+
+	/** Distance tier; promoted as the actor closes on the runner (Contact entries are never checked) */
+	EScrollSignificance Significance = EScrollSignificance::Contact;
+};
+
 /**
  * Manages the world scroll speed for the entire game.
  * Attached to GameMode -- other actors call GetCurrentScrollSpeed()
- * to figure out how fast they should move.
+ * to figure out how fast they should move. Pooled obstacles/pickups
+ * register here and are moved in one batched pass (see ScrollMode).
  */
 UCLASS(ClassGroup=(StateRunner), meta=(BlueprintSpawnableComponent))
-class STATERUNNER_ARCADE_API UWorldScrollComponent : public UActorComponent
+class STATERUNNER_ARCADE_API UWorldScrollComponent : public UActorComponent, public IGameplaySimulated
 {
 	GENERATED_BODY()
 
@@ -32,32 +83,38 @@ protected:
 	/** Called when the game starts */
 	virtual void BeginPlay() override;
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 public:
 
-	/** Called every frame - handles scroll speed calculation */
+	/** Called every frame - handles scroll speed calculation (only when not driven by the fixed-step simulation) */
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
+	// --- IGameplaySimulated ---
+
+	/** Advance scroll time/speed by one fixed step and accumulate the simulated scroll distance */
+	virtual void SimulateStep(float StepSeconds) override;
+
+	/** Move the world (or runner) to the interpolated scroll distance */
+	virtual void PostSimulate(float Alpha, int32 StepsThisFrame) override;
+
 	// --- Scroll Speed Configuration ---
 
 protected:
 
-	/** Base scroll speed in units/sec. Starting speed when the game begins. */
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Scroll Speed", meta=(ClampMin="100.0", ClampMax="5000.0"))
-	float BaseScrollSpeed = 1250.0f;
+	// Base speed over time comes from the GameMode's DifficultyDirectorComponent (ScrollSpeedCurve)
 
-	/**
-	 * Speed increase per second (linear).
-	 * 8.0 = about +480 units/min. Slower ramp for a more manageable curve.
-	 */
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Scroll Speed", meta=(ClampMin="0.0", ClampMax="100.0"))
-	float ScrollSpeedIncrease = 8.0f;
+#if WITH_EDITORONLY_DATA
+	/** Old linear ramp (Base + Increase/sec, capped at Max), moved into ScrollSpeedCurve on load */
+	UPROPERTY()
+	float BaseScrollSpeed_DEPRECATED = 1250.0f;
 
-	/**
-	 * Max scroll speed cap so the game doesn't get impossibly fast.
-	 * Lowered from 3750 for a more survivable endgame.
-	 */
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Scroll Speed", meta=(ClampMin="500.0", ClampMax="10000.0"))
-	float MaxScrollSpeed = 3000.0f;
+	UPROPERTY()
+	float ScrollSpeedIncrease_DEPRECATED = 8.0f;
+
+	UPROPERTY()
+	float MaxScrollSpeed_DEPRECATED = 3000.0f;
+#endif
 
 	/**
 	 * Threshold for broadcasting OnScrollSpeedChanged.
@@ -67,6 +124,67 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Scroll Speed", meta=(ClampMin="1.0", ClampMax="100.0"))
 	float SpeedChangeThreshold = 50.0f;
 
+	// --- Scroll Mode ---
+
+protected:
+
+	/**
+	 * MoveWorld translates every active actor each frame (O(active actors) transform updates).
+	 * MoveRunner only moves the runner (O(1)); pooled actors are placed once at spawn.
+	 * Blueprint-spawned track segments must read IsRunnerMoving() and bind OnTrackOriginRebased to support
+	 * MoveRunner; ATrackSegments from the TrackSegmentManagerComponent register here and are handled.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Scroll Mode")
+	EScrollMode ScrollMode = EScrollMode::MoveWorld;
+
+	/**
+	 * MoveRunner only: once the runner has advanced this far, everything is shifted back to the origin.
+	 * Keeps world coordinates small so float precision holds in long runs.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Scroll Mode", meta=(ClampMin="10000.0", ClampMax="1000000.0"))
+	float OriginRebaseDistance = 100000.0f;
+
+	/**
+	 * MoveRunner only: distance the runner has advanced since the last rebase.
+	 * Track-space X (player-relative, as used by the spawners) = World X - TrackOffset.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category="Scroll Mode")
+	float TrackOffset = 0.0f;
+
+	/** Runner moved in MoveRunner mode (found lazily -- pawn may not exist at BeginPlay) */
+	UPROPERTY()
+	TObjectPtr<AStateRunner_ArcadeCharacter> CachedRunner;
+
+	// --- Distance Significance ---
+
+protected:
+
+	/**
+	 * Whether obstacles/pickups far ahead of the runner start reduced (lowest LOD, no
+	 * collision, no spin/bob) and are promoted as they cross the distances below.
+	 * Off: everything activates at full fidelity.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Significance")
+	bool bUseDistanceSignificance = true;
+
+	/** Distance ahead of the runner (track X) inside which meshes use normal LODs and pickups spin/bob */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Significance", meta=(ClampMin="0.0", EditCondition="bUseDistanceSignificance"))
+	float FullDetailDistance = 8000.0f;
+
+	/**
+	 * Distance ahead of the runner inside which physics collision is enabled (physics overlap mode).
+	 * Clamped to FullDetailDistance. Keep it well above a frame's scroll at top OVERCLOCK speed.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Significance", meta=(ClampMin="0.0", EditCondition="bUseDistanceSignificance"))
+	float CollisionDistance = 2500.0f;
+
+	/** Runner's track X (the spawners' PlayerXPosition), read at BeginPlay */
+	float RunnerTrackX = -5000.0f;
+
+	/** Scratch list of entries promoted this frame (reused to avoid allocs) */
+	UPROPERTY()
+	TArray<FScrollableEntry> PendingPromotions;
+
 	// --- Overclock System ---
 
 protected:
@@ -92,7 +210,7 @@ protected:
 
 	/**
 	 * Current calculated scroll speed in units per second.
-	 * Formula: BaseScrollSpeed + (TimeElapsed * ScrollSpeedIncrease), capped at MaxScrollSpeed
+	 * The difficulty director's scroll speed at TimeElapsed.
 	 */
 	UPROPERTY(BlueprintReadOnly, Category="Scroll Speed|Runtime")
 	float CurrentScrollSpeed = 0.0f;
@@ -156,23 +274,76 @@ protected:
 protected:
 
 	/**
-	 * Cached reference to ObstacleSpawnerComponent for tutorial prompt checking.
+	 * Cached reference to ObstacleSpawnerComponent for the instanced obstacle sync.
 	 */
 	UPROPERTY()
 	TObjectPtr<UObstacleSpawnerComponent> CachedObstacleSpawner;
 
+	/** Scroll speed lookup, owned by the GameMode (or the class defaults) */
+	const UDifficultyDirectorComponent* DifficultyDirector = nullptr;
+
+	// --- Batched Scrolling ---
+
+protected:
+
+	/**
+	 * Every active scrolling actor, moved together in TickComponent.
+	 * Kept contiguous -- removal is swap-based so order is not preserved, and each
+	 * actor holds its own index (IWorldScrollable) so removal never searches.
+	 */
+	UPROPERTY()
+	TArray<FScrollableEntry> ScrollableEntries;
+
+	/** Scratch list of entries that crossed their despawn line this frame (reused to avoid allocs) */
+	UPROPERTY()
+	TArray<FScrollableEntry> PendingDespawns;
+
+	// --- Fixed-Step Simulation ---
+
+protected:
+
+	/** True when UGameplaySimulationSubsystem steps this component (tick stays off) */
+	bool bSimulationDriven = false;
+
+	/** Total scroll distance simulated so far */
+	double SimScrollDistance = 0.0;
+
+	/** Scroll distance actually applied to actors (lags the simulation by the interpolation remainder) */
+	double AppliedScrollDistance = 0.0;
+
+	/** Distance covered by the most recent step */
+	float LastStepScrollDistance = 0.0f;
+
+	/** Total scroll actually applied this run (fixed-step or ticking) */
+	double PresentedScrollDistance = 0.0;
+
 	// --- Events ---
 
 public:
 
-	/** Broadcast when scroll speed changes by at least SpeedChangeThreshold. */
+	/**
+	 * Broadcast when the base speed moves by at least SpeedChangeThreshold, and whenever the
+	 * effective speed steps (scrolling on/off, OVERCLOCK, damage slowdown, reset).
+	 */
 	UPROPERTY(BlueprintAssignable, Category="Events")
 	FOnScrollSpeedChanged OnScrollSpeedChanged;
 
+	/** Broadcast after a MoveRunner origin rebase. */
+	UPROPERTY(BlueprintAssignable, Category="Events")
+	FOnTrackOriginRebased OnTrackOriginRebased;
+
 	// --- Public Functions ---
 
 public:
 
+#if WITH_EDITORONLY_DATA
+	/**
+	 * Carry ramp settings saved before the difficulty director existed over to its curves.
+	 * Called from the GameMode's PostLoad; does nothing while the settings hold their old defaults.
+	 */
+	void MigrateDeprecatedDifficulty(UDifficultyDirectorComponent& Director) const;
+#endif
+
 	/**
 	 * Returns current scroll speed in units per second.
 	 * 
@@ -269,14 +440,140 @@ public:
 	UFUNCTION(BlueprintPure, Category="OVERCLOCK")
 	bool IsOverclockActive() const { return bIsOverclockActive; }
 
+	// --- Scroll Mode Functions ---
+
+public:
+
+	/** Get the active scroll mode */
+	UFUNCTION(BlueprintPure, Category="Scroll Mode")
+	EScrollMode GetScrollMode() const { return ScrollMode; }
+
+	/** True when the runner advances instead of the world (static world mode) */
+	UFUNCTION(BlueprintPure, Category="Scroll Mode")
+	bool IsRunnerMoving() const { return ScrollMode == EScrollMode::MoveRunner; }
+
+	/**
+	 * Offset between track space and world space on X.
+	 * Always 0 in MoveWorld mode.
+	 */
+	UFUNCTION(BlueprintPure, Category="Scroll Mode")
+	float GetTrackOffset() const { return TrackOffset; }
+
+	/** Convert a track-space X (player-relative, e.g. spawn positions) to world X */
+	float TrackToWorldX(float TrackX) const { return TrackX + TrackOffset; }
+
+	/** Convert a world X to track space */
+	float WorldToTrackX(float WorldX) const { return WorldX - TrackOffset; }
+
+	// --- Batched Scrolling Functions ---
+
+public:
+
+	/**
+	 * Add an actor to the batched scroll list.
+	 * Called by ABaseObstacle / ABasePickup on Activate(). Registering twice only updates the entry.
+	 * 
+	 * @param Actor The pooled actor to scroll
+	 * @param Scrollable Same actor's IWorldScrollable, which holds its index in the list
+	 * @param DespawnX X position below which the actor gets deactivated
+	 * @param Significance Tier the actor activated at (GetSignificanceAt); anything below Contact gets promoted
+	 */
+	void RegisterScrollable(AActor* Actor, IWorldScrollable* Scrollable, float DespawnX, EScrollSignificance Significance = EScrollSignificance::Contact);
+
+	/**
+	 * Remove an actor from the batched scroll list.
+	 * Called by ABaseObstacle / ABasePickup on Deactivate(). No-op if not registered.
+	 * 
+	 * @param Scrollable The actor to stop scrolling
+	 */
+	void UnregisterScrollable(IWorldScrollable* Scrollable);
+
+	/** Distance tier for an actor at this track X (Contact when significance is off) */
+	EScrollSignificance GetSignificanceAt(float TrackX) const;
+
+	/**
+	 * Pin Mesh to its lowest LOD for Far, back to automatic otherwise.
+	 * Only touches the render state when the forced LOD actually changes.
+	 */
+	static void ApplySignificanceLOD(UStaticMeshComponent* Mesh, EScrollSignificance Significance);
+
+	/** Number of actors currently being scrolled */
+	UFUNCTION(BlueprintPure, Category="Scroll Speed")
+	int32 GetScrollableCount() const { return ScrollableEntries.Num(); }
+
+	/**
+	 * Simulated scroll not yet applied to actor positions.
+	 * Mid-step, scrolled actors sit this much further toward +X (relative to the runner)
+	 * than their simulated position. 0 when not driven by the fixed-step simulation.
+	 */
+	float GetUnappliedScrollDistance() const { return static_cast<float>(SimScrollDistance - AppliedScrollDistance); }
+
+	/** Scroll distance covered by the most recent fixed step (or frame, when ticking) */
+	float GetLastStepScrollDistance() const { return LastStepScrollDistance; }
+
+	/**
+	 * Total scroll applied since the run started. Anything recorded in track space has since
+	 * moved -X by the difference (debug draw of spawn-time snapshots).
+	 */
+	double GetPresentedScrollDistance() const { return PresentedScrollDistance; }
+
 protected:
 
 	/**
-	 * Calculate and update the current scroll speed based on time elapsed.
+	 * Move every registered actor by -ScrollDelta on X, deactivate
+	 * any that passed their despawn threshold and promote any that crossed a significance distance.
+	 * In MoveRunner mode actors are not moved; only the despawn test runs (in track space).
+	 * 
+	 * @param ScrollDelta Distance to move this frame (speed * DeltaTime)
+	 */
+	void ScrollRegisteredActors(float ScrollDelta);
+
+	/**
+	 * Return a despawned actor to its pool via its own Deactivate().
+	 */
+	void DespawnScrollable(const FScrollableEntry& Entry);
+
+	/** Swap-remove one entry, fixing up the index of the entry moved into its place */
+	void RemoveScrollableAt(int32 Index);
+
+	/**
+	 * Hand a new distance tier to an obstacle/pickup via its own SetSignificance().
+	 */
+	void PromoteScrollable(AActor* Actor, EScrollSignificance Significance);
+
+	/**
+	 * MoveRunner only: advance the runner by ScrollDelta and rebase if past OriginRebaseDistance.
+	 * 
+	 * @return True if the origin was rebased this call
+	 */
+	bool AdvanceRunner(float ScrollDelta);
+
+	/** MoveRunner only: put the versus rival runners at the same track offset as Player 1 */
+	void SetRivalTrackOffsets(float Offset);
+
+	/**
+	 * MoveRunner only: shift registered actors and the runner back by TrackOffset, then reset it.
+	 */
+	void RebaseTrackOrigin();
+
+	/**
+	 * Look up the current scroll speed for the time elapsed.
 	 * Called every tick when scrolling is enabled.
 	 */
 	void UpdateScrollSpeed();
 
+	/**
+	 * Advance TimeElapsed, scroll speed and damage slowdown.
+	 * Once per step (fixed-step) or once per frame (ticking).
+	 */
+	void AdvanceScrollTime(float DeltaTime);
+
+	/**
+	 * Apply a scroll distance to the world and run the once-per-frame work
+	 * (speed broadcast, instanced sync, tutorial prompts, debug stats).
+	 */
+	void PresentScroll(float ScrollDelta);
+
 	/**
 	 * Process damage slowdown timer.
 	 * Called every tick to handle slowdown duration.
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Something UWorldScrollComponent moves in its batched pass (obstacles, pickups, track segments).
+ * Plain C++ interface -- the actor stores its own index in the scroll list, so registering
+ * and unregistering never search it (same scheme as TActiveActorList in ActorPool.h).
+ */
+class IWorldScrollable
+{
+public:
+
+	virtual ~IWorldScrollable() = default;
+
+	/** Index in UWorldScrollComponent's entry list (INDEX_NONE when not scrolling) */
+	virtual int32 GetScrollEntryIndex() const = 0;
+	virtual void SetScrollEntryIndex(int32 InIndex) = 0;
+};